@@ -31,9 +31,10 @@ std::vector<TResourceGroupUsage> ResourceGroupUsageRecorder::get_resource_group_
 
     std::unordered_map<int64_t, TResourceGroupUsage> group_to_usage;
     std::unordered_map<int64_t, int64_t> curr_group_to_cpu_runtime_ns;
+    std::unordered_map<int64_t, int64_t> curr_group_to_io_bytes;
 
     workgroup::WorkGroupManager::instance()->for_each_workgroup(
-            [&group_to_usage, &curr_group_to_cpu_runtime_ns](const workgroup::WorkGroup& wg) {
+            [&group_to_usage, &curr_group_to_cpu_runtime_ns, &curr_group_to_io_bytes](const workgroup::WorkGroup& wg) {
                 auto it = group_to_usage.find(wg.id());
                 if (it == group_to_usage.end()) {
                     TResourceGroupUsage group_usage;
@@ -43,12 +44,14 @@ std::vector<TResourceGroupUsage> ResourceGroupUsageRecorder::get_resource_group_
                     group_to_usage.emplace(wg.id(), std::move(group_usage));
 
                     curr_group_to_cpu_runtime_ns.emplace(wg.id(), wg.cpu_runtime_ns());
+                    curr_group_to_io_bytes.emplace(wg.id(), wg.io_bytes());
                 } else {
                     TResourceGroupUsage& group_usage = it->second;
                     group_usage.__set_mem_used_bytes(group_usage.mem_used_bytes + wg.mem_consumption_bytes());
                     group_usage.__set_num_running_queries(group_usage.num_running_queries + wg.num_running_queries());
 
                     curr_group_to_cpu_runtime_ns[wg.id()] += wg.cpu_runtime_ns();
+                    curr_group_to_io_bytes[wg.id()] += wg.io_bytes();
                 }
             });
 
@@ -66,12 +69,22 @@ std::vector<TResourceGroupUsage> ResourceGroupUsageRecorder::get_resource_group_
     }
     _group_to_cpu_runtime_ns = std::move(curr_group_to_cpu_runtime_ns);
 
+    for (const auto& [group_id, io_bytes] : curr_group_to_io_bytes) {
+        auto iter_prev = _group_to_io_bytes.find(group_id);
+        int64_t prev_io_bytes = iter_prev == _group_to_io_bytes.end() ? 0 : iter_prev->second;
+        // The counter restarts from zero when a new version of the group replaces the old one.
+        int128_t delta_io_bytes = std::max<int64_t>(0, io_bytes - prev_io_bytes);
+        int64_t io_bytes_per_second = delta_io_bytes * NANOS_PER_SEC / delta_ns;
+        group_to_usage[group_id].__set_io_bytes_per_second(io_bytes_per_second);
+    }
+    _group_to_io_bytes = std::move(curr_group_to_io_bytes);
+
     std::vector<TResourceGroupUsage> group_usages;
     group_usages.reserve(group_to_usage.size());
     for (auto& [_, group_usage] : group_to_usage) {
         // Only report the resource group with effective resource usages.
         if (group_usage.cpu_core_used_permille > 0 || group_usage.mem_used_bytes > 0 ||
-            group_usage.num_running_queries > 0) {
+            group_usage.num_running_queries > 0 || group_usage.io_bytes_per_second > 0) {
             group_usages.emplace_back(std::move(group_usage));
         }
     }
@@ -30,12 +30,13 @@ public:
 
     /// Get the resource usages of all the resource groups.
     ///
-    /// The cpu usage of any group is recorded for the time interval between two invocations of this method.
+    /// The cpu and I/O usages of any group are recorded for the time interval between two invocations of this method.
     std::vector<TResourceGroupUsage> get_resource_group_usages();
 
 private:
     int64_t _timestamp_ns = 0;
     std::unordered_map<int64_t, int64_t> _group_to_cpu_runtime_ns;
+    std::unordered_map<int64_t, int64_t> _group_to_io_bytes;
 };
 
 } // namespace starrocks
@@ -0,0 +1,170 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/datum.h"
+#include "common/logging.h"
+#include "runtime/types.h"
+
+namespace starrocks {
+
+// The distribution of the values of a generated column.
+struct ColumnSpec {
+    // TYPE_INT, TYPE_BIGINT, TYPE_DOUBLE or TYPE_VARCHAR.
+    LogicalType type = TYPE_BIGINT;
+    // The number of distinct values.
+    int64_t cardinality = 1024;
+    // The exponent of the Zipf distribution over the distinct values, 0 means uniform.
+    double skew = 0;
+    // The fraction of NULLs, the column is nullable iff it is positive.
+    double null_ratio = 0;
+    // The length of the VARCHAR values is uniformly distributed in [min_length, max_length].
+    int32_t min_length = 8;
+    int32_t max_length = 16;
+
+    bool nullable() const { return null_ratio > 0; }
+    TypeDescriptor type_desc() const {
+        return type == TYPE_VARCHAR ? TypeDescriptor::create_varchar_type(std::max(max_length, 1))
+                                    : TypeDescriptor::from_logical_type(type);
+    }
+};
+
+// ChunkGenerator builds chunks whose columns follow a list of ColumnSpec, the i-th column is
+// appended with slot id first_slot_id + i. The output is deterministic for a given seed, so the
+// same input can be replayed against different builds.
+class ChunkGenerator {
+public:
+    explicit ChunkGenerator(std::vector<ColumnSpec> specs, SlotId first_slot_id = 0, uint64_t seed = 0)
+            : _specs(std::move(specs)), _first_slot_id(first_slot_id), _rng(seed) {
+        for (const auto& spec : _specs) {
+            DCHECK_GT(spec.cardinality, 0);
+            DCHECK_LE(spec.min_length, spec.max_length);
+            _columns.emplace_back(_build_distribution(spec));
+        }
+    }
+
+    ChunkPtr next(size_t num_rows) {
+        auto chunk = std::make_shared<Chunk>();
+        for (size_t i = 0; i < _specs.size(); i++) {
+            const auto& spec = _specs[i];
+            auto column = ColumnHelper::create_column(spec.type_desc(), spec.nullable());
+            column->reserve(num_rows);
+            for (size_t row = 0; row < num_rows; row++) {
+                if (spec.nullable() && _uniform(_rng) < spec.null_ratio) {
+                    column->append_nulls(1);
+                } else {
+                    _append_value(spec, _columns[i], _next_rank(_columns[i]), column.get());
+                }
+            }
+            chunk->append_column(std::move(column), _first_slot_id + i);
+        }
+        return chunk;
+    }
+
+    std::vector<ChunkPtr> generate(size_t num_chunks, size_t chunk_size) {
+        std::vector<ChunkPtr> chunks;
+        chunks.reserve(num_chunks);
+        for (size_t i = 0; i < num_chunks; i++) {
+            chunks.emplace_back(next(chunk_size));
+        }
+        return chunks;
+    }
+
+private:
+    struct Distribution {
+        int64_t cardinality = 0;
+        // The cumulative probabilities of the ranks, empty for the uniform distribution.
+        std::vector<double> cdf;
+        // The dictionary of the VARCHAR values, indexed by rank.
+        std::vector<std::string> strings;
+    };
+
+    Distribution _build_distribution(const ColumnSpec& spec) {
+        Distribution dist;
+        dist.cardinality = spec.cardinality;
+        if (spec.skew > 0) {
+            dist.cdf.resize(spec.cardinality);
+            double sum = 0;
+            for (int64_t k = 0; k < spec.cardinality; k++) {
+                sum += 1.0 / std::pow(k + 1, spec.skew);
+                dist.cdf[k] = sum;
+            }
+            for (auto& p : dist.cdf) {
+                p /= sum;
+            }
+        }
+        if (spec.type == TYPE_VARCHAR) {
+            static constexpr char kAlphabet[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+            std::uniform_int_distribution<int32_t> length(spec.min_length, spec.max_length);
+            dist.strings.resize(spec.cardinality);
+            for (int64_t k = 0; k < spec.cardinality; k++) {
+                // Prefix the rank so that the dictionary has exactly |cardinality| distinct values.
+                std::string value = std::to_string(k);
+                const size_t len = std::max<size_t>(length(_rng), value.size());
+                while (value.size() < len) {
+                    value.push_back(kAlphabet[_rng() % (sizeof(kAlphabet) - 1)]);
+                }
+                dist.strings[k] = std::move(value);
+            }
+        }
+        return dist;
+    }
+
+    int64_t _next_rank(const Distribution& dist) {
+        if (dist.cdf.empty()) {
+            return _rng() % dist.cardinality;
+        }
+        auto it = std::lower_bound(dist.cdf.begin(), dist.cdf.end(), _uniform(_rng));
+        return std::min<int64_t>(it - dist.cdf.begin(), dist.cdf.size() - 1);
+    }
+
+    static void _append_value(const ColumnSpec& spec, const Distribution& dist, int64_t rank, Column* column) {
+        // Scatter the ranks over the value domain, so that hot values are not clustered at the small end.
+        // Multiplying by an odd constant is a bijection, so distinct ranks keep distinct values.
+        const auto value = static_cast<int64_t>(static_cast<uint64_t>(rank) * 0x9E3779B97F4A7C15ULL);
+        switch (spec.type) {
+        case TYPE_INT:
+            column->append_datum(Datum(static_cast<int32_t>(static_cast<uint32_t>(rank) * 0x9E3779B9U)));
+            break;
+        case TYPE_BIGINT:
+            column->append_datum(Datum(value));
+            break;
+        case TYPE_DOUBLE:
+            column->append_datum(Datum(static_cast<double>(value) / 1000));
+            break;
+        case TYPE_VARCHAR:
+            column->append_datum(Datum(Slice(dist.strings[rank])));
+            break;
+        default:
+            CHECK(false) << "unsupported type " << logical_type_to_string(spec.type);
+        }
+    }
+
+    const std::vector<ColumnSpec> _specs;
+    const SlotId _first_slot_id;
+    std::vector<Distribution> _columns;
+    std::mt19937_64 _rng;
+    std::uniform_real_distribution<double> _uniform{0.0, 1.0};
+};
+
+} // namespace starrocks
@@ -22,6 +22,7 @@
 
 #include "bench.h"
 #include "exprs/hash_functions.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 
@@ -85,6 +86,22 @@ static void BM_HashFunctions_Eval(benchmark::State& state) {
 
 BENCHMARK(BM_HashFunctions_Eval)->Apply(BM_HashFunctions_Eval_Arg);
 
+// Column::fnv_hash is what the exchange shuffle and the partitioned hash join use to spread rows.
+static void BM_Column_FnvHash(benchmark::State& state) {
+    size_t num_rows = state.range(0);
+    auto column = Bench::create_random_column(TypeDescriptor(TYPE_INT), num_rows, false, false);
+    std::vector<uint32_t> hashes(num_rows);
+
+    for (auto _ : state) {
+        std::fill(hashes.begin(), hashes.end(), HashUtil::FNV_SEED);
+        column->fnv_hash(hashes.data(), 0, num_rows);
+        benchmark::DoNotOptimize(hashes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK(BM_Column_FnvHash)->Arg(4096)->Arg(65536);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
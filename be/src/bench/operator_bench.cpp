@@ -0,0 +1,329 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "chunk_generator.h"
+#include "common/config.h"
+#include "exec/aggregator.h"
+#include "exec/chunk_buffer_memory_manager.h"
+#include "exec/hash_joiner.h"
+#include "exec/pipeline/aggregate/aggregate_blocking_sink_operator.h"
+#include "exec/pipeline/aggregate/aggregate_blocking_source_operator.h"
+#include "exec/pipeline/exchange/local_exchange.h"
+#include "exec/pipeline/exchange/local_exchange_sink_operator.h"
+#include "exec/pipeline/exchange/local_exchange_source_operator.h"
+#include "exec/pipeline/hashjoin/hash_join_build_operator.h"
+#include "exec/pipeline/hashjoin/hash_join_probe_operator.h"
+#include "exec/pipeline/hashjoin/hash_joiner_factory.h"
+#include "exec/pipeline/sort/local_merge_sort_source_operator.h"
+#include "exec/pipeline/sort/partition_sort_sink_operator.h"
+#include "exec/pipeline/sort/sort_context.h"
+#include "exec/pipeline/spill_process_channel.h"
+#include "exec/sort_exec_exprs.h"
+#include "operator_bench.h"
+
+namespace starrocks {
+
+using namespace pipeline;
+
+static constexpr int kChunkSize = 4096;
+static constexpr int32_t kPlanNodeId = 1;
+
+// The arguments shared by the benchmarks: the number of input chunks, the key type (0: BIGINT, 1: VARCHAR),
+// the key cardinality and the Zipf skew of the key multiplied by 100.
+struct KeyArgs {
+    int64_t num_chunks;
+    LogicalType key_type;
+    int64_t cardinality;
+    double skew;
+
+    explicit KeyArgs(const benchmark::State& state)
+            : num_chunks(state.range(0)),
+              key_type(state.range(1) == 0 ? TYPE_BIGINT : TYPE_VARCHAR),
+              cardinality(state.range(2)),
+              skew(state.range(3) / 100.0) {}
+
+    std::vector<ColumnSpec> input_specs(double null_ratio = 0) const {
+        ColumnSpec key{.type = key_type, .cardinality = cardinality, .skew = skew, .null_ratio = null_ratio};
+        ColumnSpec value{.type = TYPE_BIGINT, .cardinality = 1 << 20};
+        return {key, value};
+    }
+};
+
+static SlotTypeDescInfoArray to_slot_infos(const std::vector<ColumnSpec>& specs) {
+    SlotTypeDescInfoArray slots;
+    for (size_t i = 0; i < specs.size(); i++) {
+        slots.emplace_back("c" + std::to_string(i), specs[i].type_desc(), specs[i].nullable());
+    }
+    return slots;
+}
+
+static void report(benchmark::State& state, const StatusOr<size_t>& res) {
+    if (!res.ok()) {
+        state.SkipWithError(res.status().to_string().c_str());
+        return;
+    }
+    state.counters["output_rows"] = static_cast<double>(res.value());
+}
+
+// local exchange: a single sink shuffles or passes the chunks through to |dop| sources.
+static void BM_LocalExchange(benchmark::State& state) {
+    const bool is_shuffle = state.range(0) != 0;
+    const int32_t dop = state.range(1);
+    const std::vector<ColumnSpec> specs = {{.type = TYPE_BIGINT, .cardinality = 1 << 20},
+                                           {.type = TYPE_VARCHAR, .cardinality = 1 << 16, .null_ratio = 0.1}};
+    const auto chunks = ChunkGenerator(specs).generate(256, kChunkSize);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        OperatorBenchEnv env({to_slot_infos(specs)}, kChunkSize);
+        auto* runtime_state = env.runtime_state();
+        auto mem_mgr =
+                std::make_shared<ChunkBufferMemoryManager>(dop, config::local_exchange_buffer_mem_limit_per_driver);
+        auto source_factory = std::make_shared<LocalExchangeSourceOperatorFactory>(1, kPlanNodeId, mem_mgr);
+        std::shared_ptr<LocalExchanger> exchanger;
+        if (is_shuffle) {
+            auto partition_exprs =
+                    env.create_expr_ctxs({OperatorBenchEnv::slot_ref(0, 0, specs[0].type_desc(), false)});
+            if (!partition_exprs.ok()) {
+                state.SkipWithError(partition_exprs.status().to_string().c_str());
+                break;
+            }
+            exchanger = std::make_shared<PartitionExchanger>(mem_mgr, source_factory.get(),
+                                                             TPartitionType::HASH_PARTITIONED, partition_exprs.value());
+        } else {
+            exchanger = std::make_shared<PassthroughExchanger>(mem_mgr, source_factory.get());
+        }
+        auto sink_factory = std::make_shared<LocalExchangeSinkOperatorFactory>(0, kPlanNodeId, exchanger);
+        auto sources = env.create_operators(source_factory, dop);
+        auto sinks = env.create_operators(sink_factory, 1);
+        if (!sources.ok() || !sinks.ok()) {
+            state.SkipWithError("failed to prepare operators");
+            break;
+        }
+        auto input = clone_chunks(chunks);
+        state.ResumeTiming();
+
+        auto res = run_sink_and_sources(runtime_state, sinks.value()[0].get(), sources.value(), std::move(input));
+
+        state.PauseTiming();
+        report(state, res);
+        env.close();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * chunks.size() * kChunkSize);
+}
+
+// blocking aggregate: SELECT key, sum(value) FROM t GROUP BY key.
+static void BM_AggregateBlocking(benchmark::State& state) {
+    const KeyArgs args(state);
+    const auto specs = args.input_specs(0.05);
+    const auto chunks = ChunkGenerator(specs).generate(args.num_chunks, kChunkSize);
+
+    const auto key_type = specs[0].type_desc();
+    const auto value_type = TypeDescriptor(TYPE_BIGINT).to_thrift();
+    // tuple 0 is the input, tuple 1 and tuple 2 are the intermediate and the output tuples.
+    const SlotTypeDescInfoArray agg_slots = {{"key", key_type, true}, {"sum", TypeDescriptor(TYPE_BIGINT), true}};
+    TPlanNode tnode;
+    tnode.node_id = kPlanNodeId;
+    tnode.node_type = TPlanNodeType::AGGREGATION_NODE;
+    tnode.limit = -1;
+    tnode.__isset.agg_node = true;
+    tnode.agg_node.need_finalize = true;
+    tnode.agg_node.streaming_preaggregation_mode = TStreamingPreaggregationMode::AUTO;
+    tnode.agg_node.intermediate_tuple_id = 1;
+    tnode.agg_node.output_tuple_id = 2;
+    tnode.agg_node.grouping_exprs = {OperatorBenchEnv::slot_ref(0, 0, key_type, true)};
+    auto sum = ExprsTestHelper::create_aggregate_expr(
+            ExprsTestHelper::create_builtin_function("sum", {value_type}, value_type, value_type),
+            {ExprsTestHelper::create_slot_expr_node(0, 1, value_type, false)});
+    sum.nodes[0].__set_is_nullable(true);
+    tnode.agg_node.aggregate_functions = {sum};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        OperatorBenchEnv env({to_slot_infos(specs), agg_slots, agg_slots}, kChunkSize);
+        auto* runtime_state = env.runtime_state();
+        auto aggregator_factory = std::make_shared<AggregatorFactory>(tnode);
+        auto sink_factory =
+                std::make_shared<AggregateBlockingSinkOperatorFactory>(0, kPlanNodeId, aggregator_factory, nullptr);
+        auto source_factory =
+                std::make_shared<AggregateBlockingSourceOperatorFactory>(1, kPlanNodeId, aggregator_factory);
+        auto sinks = env.create_operators(sink_factory, 1);
+        auto sources = env.create_operators(source_factory, 1);
+        if (!sources.ok() || !sinks.ok()) {
+            state.SkipWithError("failed to prepare operators");
+            break;
+        }
+        auto input = clone_chunks(chunks);
+        state.ResumeTiming();
+
+        auto res = run_sink_and_sources(runtime_state, sinks.value()[0].get(), sources.value(), std::move(input));
+
+        state.PauseTiming();
+        report(state, res);
+        env.close();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * args.num_chunks * kChunkSize);
+}
+
+// full sort: SELECT * FROM t ORDER BY key.
+static void BM_FullSort(benchmark::State& state) {
+    const KeyArgs args(state);
+    const auto specs = args.input_specs(0.05);
+    const auto chunks = ChunkGenerator(specs).generate(args.num_chunks, kChunkSize);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        // tuple 0 is the input, tuple 1 is the materialized tuple to sort, their slots are [0, 1] and [2, 3].
+        OperatorBenchEnv env({to_slot_infos(specs), to_slot_infos(specs)}, kChunkSize);
+        auto* runtime_state = env.runtime_state();
+        std::vector<TExpr> materialized_exprs;
+        std::vector<OrderByType> order_by_types;
+        for (size_t i = 0; i < specs.size(); i++) {
+            materialized_exprs.emplace_back(
+                    OperatorBenchEnv::slot_ref(0, static_cast<SlotId>(i), specs[i].type_desc(), specs[i].nullable()));
+            order_by_types.push_back({specs[i].type_desc(), specs[i].nullable()});
+        }
+        const std::vector<TExpr> ordering_exprs = {
+                OperatorBenchEnv::slot_ref(1, specs.size(), specs[0].type_desc(), specs[0].nullable())};
+        auto* sort_exec_exprs = env.obj_pool()->add(new SortExecExprs());
+        const std::vector<bool> is_asc_order = {true};
+        const std::vector<bool> is_null_first = {false};
+        auto st = sort_exec_exprs->init(ordering_exprs, &materialized_exprs, env.obj_pool(), runtime_state);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+
+        auto context_factory = std::make_shared<SortContextFactory>(
+                runtime_state, TTopNType::ROW_NUMBER, true, sort_exec_exprs->lhs_ordering_expr_ctxs(), is_asc_order,
+                is_null_first, std::vector<TExpr>{}, 0, -1, "", order_by_types,
+                std::vector<RuntimeFilterBuildDescriptor*>{});
+        auto sink_factory = std::make_shared<PartitionSortSinkOperatorFactory>(
+                0, kPlanNodeId, context_factory, *sort_exec_exprs, is_asc_order, is_null_first, "", 0, -1,
+                TTopNType::ROW_NUMBER, order_by_types, env.desc_tbl()->get_tuple_descriptor(1), env.row_desc({0}),
+                env.row_desc({1}), std::vector<ExprContext*>{}, 1024000, 16 * 1024 * 1024, std::vector<SlotId>{},
+                std::make_shared<SpillProcessChannelFactory>(1));
+        auto source_factory = std::make_shared<LocalMergeSortSourceOperatorFactory>(1, kPlanNodeId, context_factory);
+        auto sinks = env.create_operators(sink_factory, 1);
+        auto sources = env.create_operators(source_factory, 1);
+        if (!sources.ok() || !sinks.ok()) {
+            state.SkipWithError("failed to prepare operators");
+            break;
+        }
+        auto input = clone_chunks(chunks);
+        state.ResumeTiming();
+
+        auto res = run_sink_and_sources(runtime_state, sinks.value()[0].get(), sources.value(), std::move(input));
+
+        state.PauseTiming();
+        report(state, res);
+        env.close();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * args.num_chunks * kChunkSize);
+}
+
+// hash join: SELECT * FROM probe JOIN build ON probe.key = build.key. The build side has |cardinality| rows whose keys
+// are drawn uniformly from |cardinality| values, the probe keys are drawn from the same values with skew.
+static void BM_HashJoin(benchmark::State& state) {
+    const KeyArgs args(state);
+    const auto probe_specs = args.input_specs();
+    std::vector<ColumnSpec> build_specs = {{.type = args.key_type, .cardinality = args.cardinality},
+                                           {.type = TYPE_VARCHAR, .cardinality = 1 << 16}};
+    const size_t num_build_chunks = (args.cardinality + kChunkSize - 1) / kChunkSize;
+    // Probe side is tuple 0 with slots [0, 1], build side is tuple 1 with slots [2, 3].
+    const auto probe_chunks = ChunkGenerator(probe_specs, 0, 1).generate(args.num_chunks, kChunkSize);
+    const auto build_chunks =
+            ChunkGenerator(build_specs, probe_specs.size(), 2).generate(num_build_chunks, kChunkSize);
+
+    THashJoinNode join_node;
+    join_node.join_op = TJoinOp::INNER_JOIN;
+    join_node.distribution_mode = TJoinDistributionMode::PARTITIONED;
+    join_node.is_push_down = false;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        OperatorBenchEnv env({to_slot_infos(probe_specs), to_slot_infos(build_specs)}, kChunkSize);
+        auto* runtime_state = env.runtime_state();
+        auto build_keys = env.create_expr_ctxs(
+                {OperatorBenchEnv::slot_ref(1, probe_specs.size(), build_specs[0].type_desc(), false)});
+        auto probe_keys = env.create_expr_ctxs({OperatorBenchEnv::slot_ref(0, 0, probe_specs[0].type_desc(), false)});
+        if (!build_keys.ok() || !probe_keys.ok()) {
+            state.SkipWithError("failed to create join keys");
+            break;
+        }
+        HashJoinerParam param(env.obj_pool(), join_node, kPlanNodeId, TPlanNodeType::HASH_JOIN_NODE, {false},
+                              build_keys.value(), probe_keys.value(), {}, {}, env.row_desc({1}), env.row_desc({0}),
+                              env.row_desc({0, 1}), TPlanNodeType::EXCHANGE_NODE, TPlanNodeType::EXCHANGE_NODE, true,
+                              {}, {}, {}, TJoinDistributionMode::PARTITIONED, false);
+        auto joiner_factory = std::make_shared<HashJoinerFactory>(param);
+        auto build_factory = std::make_shared<HashJoinBuildOperatorFactory>(
+                0, kPlanNodeId, joiner_factory,
+                std::make_unique<PartialRuntimeFilterMerger>(env.obj_pool(), UINT64_MAX, UINT64_MAX),
+                TJoinDistributionMode::PARTITIONED, std::make_shared<SpillProcessChannelFactory>(1));
+        auto probe_factory = std::make_shared<HashJoinProbeOperatorFactory>(1, kPlanNodeId, joiner_factory);
+        build_factory->init_runtime_filter(env.runtime_filter_hub(), {1}, {}, env.row_desc({1}), nullptr, {}, {});
+        probe_factory->init_runtime_filter(env.runtime_filter_hub(), {0}, {}, env.row_desc({0}), nullptr, {}, {});
+        env.runtime_filter_hub()->add_holder(kPlanNodeId);
+
+        auto builders = env.create_operators(build_factory, 1);
+        auto probers = env.create_operators(probe_factory, 1);
+        if (!builders.ok() || !probers.ok()) {
+            state.SkipWithError("failed to prepare operators");
+            break;
+        }
+        auto build_input = clone_chunks(build_chunks);
+        auto probe_input = clone_chunks(probe_chunks);
+        state.ResumeTiming();
+
+        auto* builder = builders.value()[0].get();
+        auto build = [&]() -> Status {
+            for (auto& chunk : build_input) {
+                RETURN_IF_ERROR(builder->push_chunk(runtime_state, chunk));
+            }
+            return builder->set_finishing(runtime_state);
+        };
+        auto st = build();
+        auto res = st.ok() ? run_processor(runtime_state, probers.value()[0].get(), std::move(probe_input))
+                           : StatusOr<size_t>(st);
+
+        state.PauseTiming();
+        report(state, res);
+        env.close();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * (num_build_chunks + args.num_chunks) * kChunkSize);
+}
+
+// {is_shuffle, dop}
+BENCHMARK(BM_LocalExchange)->ArgsProduct({{0, 1}, {1, 4, 16}})->Unit(benchmark::kMillisecond);
+
+// {num_chunks, key_type, cardinality, skew * 100}
+static void KeyArguments(benchmark::internal::Benchmark* b) {
+    b->ArgsProduct({{256}, {0, 1}, {1 << 4, 1 << 16, 1 << 20}, {0, 120}});
+}
+BENCHMARK(BM_AggregateBlocking)->Apply(KeyArguments)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FullSort)->ArgsProduct({{256}, {0, 1}, {1 << 16, 1 << 20}, {0, 120}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_HashJoin)->ArgsProduct({{64}, {0, 1}, {1 << 16, 1 << 20}, {0, 120}})->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
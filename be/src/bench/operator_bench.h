@@ -0,0 +1,197 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "column/chunk.h"
+#include "common/statusor.h"
+#include "exec/pipeline/operator.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/runtime_filter_types.h"
+#include "exprs/expr.h"
+#include "runtime/descriptors.h"
+#include "runtime/mem_tracker.h"
+#include "runtime/runtime_state.h"
+#include "testutil/desc_tbl_helper.h"
+#include "testutil/exprs_test_helper.h"
+
+namespace starrocks {
+
+// OperatorBenchEnv is a minimal query environment which runs real pipeline operators on the current thread,
+// without ExecEnv, FragmentExecutor or the driver executor, so that the cost of the operators themselves can
+// be measured and compared between builds.
+class OperatorBenchEnv {
+public:
+    // The i-th element of |tuples| is the tuple with id i, slot ids are assigned in order across the tuples.
+    explicit OperatorBenchEnv(const std::vector<SlotTypeDescInfoArray>& tuples, int chunk_size = 4096)
+            : _root_mem_tracker(std::make_unique<MemTracker>(std::numeric_limits<int64_t>::max(), "operator_bench")),
+              _query_ctx(std::make_unique<pipeline::QueryContext>()),
+              _runtime_state(std::make_unique<RuntimeState>(TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr)) {
+        _query_ctx->init_mem_tracker(-1, _root_mem_tracker.get());
+        _runtime_state->init_mem_trackers(_query_ctx->mem_tracker());
+        _runtime_state->set_query_ctx(_query_ctx.get());
+        _runtime_state->set_chunk_size(chunk_size);
+        _desc_tbl = DescTblHelper::generate_desc_tbl(_runtime_state.get(), *_runtime_state->obj_pool(), tuples);
+        _runtime_state->set_desc_tbl(_desc_tbl);
+    }
+
+    ~OperatorBenchEnv() { close(); }
+
+    RuntimeState* runtime_state() { return _runtime_state.get(); }
+    ObjectPool* obj_pool() { return _runtime_state->obj_pool(); }
+    DescriptorTbl* desc_tbl() { return _desc_tbl; }
+    pipeline::RuntimeFilterHub* runtime_filter_hub() { return &_runtime_filter_hub; }
+
+    RowDescriptor row_desc(const std::vector<TTupleId>& tuple_ids) const {
+        return RowDescriptor(*_desc_tbl, tuple_ids, std::vector<bool>(tuple_ids.size(), false));
+    }
+
+    static TExpr slot_ref(TupleId tuple_id, SlotId slot_id, const TypeDescriptor& type, bool nullable) {
+        return ExprsTestHelper::create_slot_expr(
+                ExprsTestHelper::create_slot_expr_node(tuple_id, slot_id, type.to_thrift(), nullable));
+    }
+
+    StatusOr<std::vector<ExprContext*>> create_expr_ctxs(const std::vector<TExpr>& exprs) {
+        std::vector<ExprContext*> ctxs;
+        RETURN_IF_ERROR(Expr::create_expr_trees(obj_pool(), exprs, &ctxs, runtime_state()));
+        return ctxs;
+    }
+
+    // Prepare |factory|, then create and prepare its |dop| operators. The operators and the factory are closed
+    // by close() in the reverse order of creation.
+    StatusOr<std::vector<pipeline::OperatorPtr>> create_operators(const pipeline::OperatorFactoryPtr& factory,
+                                                                  int32_t dop) {
+        RETURN_IF_ERROR(factory->prepare(runtime_state()));
+        _created.emplace_back(factory, std::vector<pipeline::OperatorPtr>());
+        auto& operators = _created.back().second;
+        for (int32_t i = 0; i < dop; i++) {
+            operators.emplace_back(factory->create(dop, i));
+        }
+        for (auto& op : operators) {
+            RETURN_IF_ERROR(op->prepare(runtime_state()));
+        }
+        return operators;
+    }
+
+    void close() {
+        for (auto it = _created.rbegin(); it != _created.rend(); ++it) {
+            for (auto& op : it->second) {
+                op->close(runtime_state());
+            }
+            it->first->close(runtime_state());
+        }
+        _created.clear();
+    }
+
+private:
+    std::unique_ptr<MemTracker> _root_mem_tracker;
+    std::unique_ptr<pipeline::QueryContext> _query_ctx;
+    std::unique_ptr<RuntimeState> _runtime_state;
+    DescriptorTbl* _desc_tbl = nullptr;
+    pipeline::RuntimeFilterHub _runtime_filter_hub;
+    std::vector<std::pair<pipeline::OperatorFactoryPtr, std::vector<pipeline::OperatorPtr>>> _created;
+};
+
+// Operators may modify the chunks pushed to them, every iteration of a benchmark should push its own copy.
+inline std::vector<ChunkPtr> clone_chunks(const std::vector<ChunkPtr>& chunks) {
+    std::vector<ChunkPtr> copies;
+    copies.reserve(chunks.size());
+    for (const auto& chunk : chunks) {
+        copies.emplace_back(chunk->clone_unique());
+    }
+    return copies;
+}
+
+// Pull all the available output of |op| and return the number of rows.
+inline StatusOr<size_t> pull_all(RuntimeState* state, pipeline::Operator* op) {
+    size_t num_rows = 0;
+    while (op->has_output()) {
+        ASSIGN_OR_RETURN(auto chunk, op->pull_chunk(state));
+        if (chunk != nullptr) {
+            num_rows += chunk->num_rows();
+        }
+    }
+    return num_rows;
+}
+
+// Drive the pipeline |sink| => ... => |sources| on the current thread, where the sink and the sources are the two
+// ends of a blocking operator (aggregate, sort) or of a local exchange. The chunks are pushed to the sink and the
+// sources are drained whenever the sink is full. Returns the number of output rows.
+inline StatusOr<size_t> run_sink_and_sources(RuntimeState* state, pipeline::Operator* sink,
+                                             const std::vector<pipeline::OperatorPtr>& sources,
+                                             std::vector<ChunkPtr> chunks) {
+    size_t num_rows = 0;
+    auto drain = [&]() -> StatusOr<bool> {
+        bool has_progress = false;
+        for (const auto& source : sources) {
+            ASSIGN_OR_RETURN(auto rows, pull_all(state, source.get()));
+            has_progress |= rows > 0;
+            num_rows += rows;
+        }
+        return has_progress;
+    };
+
+    for (auto& chunk : chunks) {
+        while (!sink->need_input()) {
+            ASSIGN_OR_RETURN(auto has_progress, drain());
+            if (!has_progress) {
+                return Status::InternalError("sink is blocked but no source has output");
+            }
+        }
+        RETURN_IF_ERROR(sink->push_chunk(state, chunk));
+    }
+    RETURN_IF_ERROR(sink->set_finishing(state));
+
+    for (const auto& source : sources) {
+        while (!source->is_finished()) {
+            ASSIGN_OR_RETURN(auto rows, pull_all(state, source.get()));
+            if (rows == 0 && !source->is_finished()) {
+                return Status::InternalError("source is blocked after the sink has finished");
+            }
+            num_rows += rows;
+        }
+    }
+    return num_rows;
+}
+
+// Drive a processor operator (e.g. hash join probe) on the current thread. Returns the number of output rows.
+inline StatusOr<size_t> run_processor(RuntimeState* state, pipeline::Operator* op, std::vector<ChunkPtr> chunks) {
+    size_t num_rows = 0;
+    for (auto& chunk : chunks) {
+        while (!op->need_input()) {
+            ASSIGN_OR_RETURN(auto rows, pull_all(state, op));
+            if (rows == 0 && !op->need_input()) {
+                return Status::InternalError("operator neither needs input nor has output");
+            }
+            num_rows += rows;
+        }
+        RETURN_IF_ERROR(op->push_chunk(state, chunk));
+    }
+    RETURN_IF_ERROR(op->set_finishing(state));
+    while (!op->is_finished()) {
+        ASSIGN_OR_RETURN(auto rows, pull_all(state, op));
+        if (rows == 0 && !op->is_finished()) {
+            return Status::InternalError("operator is blocked after finishing");
+        }
+        num_rows += rows;
+    }
+    return num_rows;
+}
+
+} // namespace starrocks
@@ -17,8 +17,12 @@
 #include <memory>
 #include <random>
 
+#include "column/binary_column.h"
+#include "column/fixed_length_column.h"
+#include "formats/parquet/encoding_delta.h"
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
+#include "formats/parquet/level_codec.h"
 
 namespace starrocks {
 namespace parquet {
@@ -98,6 +102,87 @@ static void BM_DictDecoder(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecoder)->DenseRange(0, 100, 10)->Unit(benchmark::kMillisecond);
 
+// decode the definition levels of a page, range(0) is the length of the runs of the same level
+static void BM_LevelDecoder(benchmark::State& state) {
+    auto run_length = state.range(0);
+    faststring buffer;
+    buffer.resize(sizeof(uint32_t));
+    {
+        faststring encoded;
+        RleEncoder<level_t> encoder(&encoded, 1);
+        for (int i = 0; i < kTestChunkSize; i++) {
+            encoder.Put((i / run_length) % 2);
+        }
+        encoder.Flush();
+        encode_fixed32_le(buffer.data(), encoded.size());
+        buffer.append(encoded.data(), encoded.size());
+    }
+
+    int64_t timer = 0;
+    LevelDecoder decoder(&timer);
+    level_t* levels = nullptr;
+    for (auto _ : state) {
+        Slice data(buffer.data(), buffer.size());
+        decoder.reset();
+        Status st = decoder.parse(tparquet::Encoding::RLE, 1, kTestChunkSize, &data);
+        decoder.get_avail_levels(kTestChunkSize, &levels);
+        benchmark::DoNotOptimize(levels);
+        decoder.consume_levels(kTestChunkSize);
+    }
+}
+
+BENCHMARK(BM_LevelDecoder)->RangeMultiplier(4)->Range(1, 1024);
+
+static void BM_DeltaBinaryPackedDecoder(benchmark::State& state) {
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    // range(0) is the max delta between the values
+    std::uniform_int_distribution<int64_t> dist(0, state.range(0));
+    std::vector<int64_t> values(kTestChunkSize);
+    for (int i = 1; i < kTestChunkSize; i++) {
+        values[i] = values[i - 1] + dist(rng);
+    }
+    DeltaBinaryPackedEncoder<int64_t> encoder;
+    encoder.append(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    Slice data = encoder.build();
+
+    DeltaBinaryPackedDecoder<int64_t> decoder;
+    auto column = FixedLengthColumn<int64_t>::create();
+    for (auto _ : state) {
+        state.PauseTiming();
+        column->reset_column();
+        state.ResumeTiming();
+        decoder.set_data(data);
+        Status st = decoder.next_batch(kTestChunkSize, ColumnContentType::VALUE, column.get());
+    }
+}
+
+BENCHMARK(BM_DeltaBinaryPackedDecoder)->RangeMultiplier(16)->Range(1, 1 << 20);
+
+static void BM_DeltaByteArrayDecoder(benchmark::State& state) {
+    // values sharing the prefix like the sorted keys
+    std::vector<std::string> values;
+    for (int i = 0; i < kTestChunkSize; i++) {
+        values.emplace_back("key_" + std::to_string(1000000 + i));
+    }
+    std::vector<Slice> slices(values.begin(), values.end());
+    DeltaByteArrayEncoder encoder;
+    encoder.append(reinterpret_cast<const uint8_t*>(slices.data()), slices.size());
+    Slice data = encoder.build();
+
+    DeltaByteArrayDecoder decoder;
+    auto column = BinaryColumn::create();
+    for (auto _ : state) {
+        state.PauseTiming();
+        column->reset_column();
+        state.ResumeTiming();
+        decoder.set_data(data);
+        Status st = decoder.next_batch(kTestChunkSize, ColumnContentType::VALUE, column.get());
+    }
+}
+
+BENCHMARK(BM_DeltaByteArrayDecoder);
+
 } // namespace parquet
 } // namespace starrocks
 
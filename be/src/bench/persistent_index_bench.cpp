@@ -96,6 +96,7 @@ private:
 
     IOStat _total_stat;
     uint64_t _long_tail_stat = 0;
+    size_t _peak_memory_usage = 0;
 };
 
 void PersistentIndexBenchTest::do_verify() {
@@ -153,15 +154,16 @@ void PersistentIndexBenchTest::do_bench(benchmark::State& state) {
             LOG(INFO) << stat.print_str();
         }
         _long_tail_stat = std::max(tail, _long_tail_stat);
+        _peak_memory_usage = std::max(_index->memory_usage(), _peak_memory_usage);
     }
 
     // print result
     LOG(INFO) << fmt::format(
             "PersistentIndexBench result, l0_write_cost: {} l1_l2_read_cost: {} flush_or_wal_cost: {} compaction_cost: "
-            "{} reload_meta_cost: {} long_tail_cost: {}",
+            "{} reload_meta_cost: {} long_tail_cost: {} peak_memory_usage: {}",
             _total_stat.l0_write_cost / total_step, _total_stat.l1_l2_read_cost / total_step,
             _total_stat.flush_or_wal_cost / total_step, _total_stat.compaction_cost / total_step,
-            _total_stat.reload_meta_cost / total_step, _long_tail_stat);
+            _total_stat.reload_meta_cost / total_step, _long_tail_stat, _peak_memory_usage);
     // verify
     do_verify();
 }
@@ -0,0 +1,323 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <utility>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "fs/fs_memory.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/chunk_iterator.h"
+#include "storage/column_predicate.h"
+#include "storage/olap_common.h"
+#include "storage/page_cache.h"
+#include "storage/predicate_tree/predicate_tree.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+// Scan benchmarks over single segments generated in memory. A segment has a BIGINT row id key column `k0` and a
+// bloom-filtered value column `v0`, which is the column under test. `v0` takes |cardinality| distinct values,
+// either in ascending order (sorted) or uniformly shuffled, so that the same predicate prunes most pages by zone
+// map on sorted data and nothing on shuffled data.
+static constexpr int64_t kNumRows = 1 << 20;
+static constexpr size_t kChunkSize = 4096;
+static constexpr ColumnId kValueColumn = 1;
+
+enum ScanQuery {
+    // Decode all the rows of v0.
+    FULL_SCAN = 0,
+    // v0 < x, which selects 1% of the distinct values.
+    RANGE = 1,
+    // v0 = x, where x is one of the distinct values.
+    EQUAL = 2,
+};
+
+struct SegmentSpec {
+    LogicalType type;
+    EncodingTypePB encoding;
+    CompressionTypePB compression;
+    bool sorted;
+    int64_t cardinality;
+
+    auto key() const { return std::make_tuple(type, encoding, compression, sorted, cardinality); }
+};
+
+static std::string format_value(LogicalType type, int64_t value) {
+    // Zero padded, so that strings are ordered as the numbers.
+    return type == TYPE_VARCHAR ? fmt::format("{:012d}", value) : std::to_string(value);
+}
+
+static Datum make_datum(LogicalType type, int64_t value, std::string* buffer) {
+    switch (type) {
+    case TYPE_INT:
+        return {static_cast<int32_t>(value)};
+    case TYPE_BIGINT:
+        return {value};
+    default:
+        *buffer = format_value(type, value);
+        return {Slice(*buffer)};
+    }
+}
+
+static TabletSchemaCSPtr create_tablet_schema(const SegmentSpec& spec) {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+    schema_pb.set_compression_type(spec.compression);
+
+    auto* key = schema_pb.add_column();
+    key->set_unique_id(0);
+    key->set_name("k0");
+    key->set_type("BIGINT");
+    key->set_is_key(true);
+    key->set_length(8);
+    key->set_index_length(8);
+    key->set_is_nullable(false);
+
+    auto* value = schema_pb.add_column();
+    value->set_unique_id(1);
+    value->set_name("v0");
+    value->set_type(logical_type_to_string(spec.type));
+    value->set_length(spec.type == TYPE_INT ? 4 : (spec.type == TYPE_BIGINT ? 8 : 20));
+    value->set_is_key(false);
+    value->set_is_nullable(false);
+    value->set_is_bf_column(true);
+    value->set_aggregation("NONE");
+    return TabletSchema::create(schema_pb);
+}
+
+class SegmentScanBench {
+public:
+    static SegmentScanBench* instance() {
+        static SegmentScanBench bench;
+        return &bench;
+    }
+
+    std::shared_ptr<MemoryFileSystem> fs() const { return _fs; }
+
+    // Segments are cached across benchmarks, the same segment is shared by all the queries over it.
+    StatusOr<std::pair<SegmentSharedPtr, TabletSchemaCSPtr>> get_or_build(const SegmentSpec& spec) {
+        auto it = _segments.find(spec.key());
+        if (it != _segments.end()) {
+            return it->second;
+        }
+        auto tablet_schema = create_tablet_schema(spec);
+        auto filename = fmt::format("/segments/{}.dat", _segments.size());
+        ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(filename));
+
+        SegmentWriterOptions opts;
+        opts.column_encodings.emplace(tablet_schema->column(kValueColumn).unique_id(), spec.encoding);
+        SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+        RETURN_IF_ERROR(writer.init());
+
+        auto schema = ChunkHelper::convert_schema(tablet_schema);
+        std::mt19937_64 rng(spec.cardinality);
+        std::string buffer;
+        for (int64_t begin = 0; begin < kNumRows; begin += kChunkSize) {
+            auto chunk = ChunkHelper::new_chunk(schema, kChunkSize);
+            for (int64_t row = begin; row < begin + static_cast<int64_t>(kChunkSize); row++) {
+                const int64_t value = spec.sorted ? row * spec.cardinality / kNumRows : rng() % spec.cardinality;
+                chunk->get_column_by_index(0)->append_datum(Datum(row));
+                chunk->get_column_by_index(1)->append_datum(make_datum(spec.type, value, &buffer));
+            }
+            RETURN_IF_ERROR(writer.append_chunk(*chunk));
+        }
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        RETURN_IF_ERROR(writer.finalize(&file_size, &index_size, &footer_position));
+
+        ASSIGN_OR_RETURN(auto segment, Segment::open(_fs, FileInfo{filename}, 0, tablet_schema));
+        _file_sizes[spec.key()] = file_size;
+        return _segments.emplace(spec.key(), std::make_pair(std::move(segment), std::move(tablet_schema)))
+                .first->second;
+    }
+
+    uint64_t file_size(const SegmentSpec& spec) const { return _file_sizes.at(spec.key()); }
+
+private:
+    SegmentScanBench() : _fs(std::make_shared<MemoryFileSystem>()) {
+        CHECK(_fs->create_dir("/segments").ok());
+        if (StoragePageCache::instance() == nullptr) {
+            _page_cache_tracker = std::make_unique<MemTracker>(-1, "segment_scan_bench_page_cache");
+            StoragePageCache::create_global_cache(_page_cache_tracker.get(), 1024L * 1024 * 1024);
+        }
+    }
+
+    using Key = decltype(std::declval<SegmentSpec>().key());
+
+    std::shared_ptr<MemoryFileSystem> _fs;
+    std::unique_ptr<MemTracker> _page_cache_tracker;
+    std::map<Key, std::pair<SegmentSharedPtr, TabletSchemaCSPtr>> _segments;
+    std::map<Key, uint64_t> _file_sizes;
+};
+
+static ColumnPredicate* create_predicate(const SegmentSpec& spec, ScanQuery query) {
+    auto type_info = get_type_info(spec.type);
+    if (query == RANGE) {
+        const int64_t bound = std::max<int64_t>(spec.cardinality / 100, 1);
+        return new_column_lt_predicate(type_info, kValueColumn, format_value(spec.type, bound));
+    }
+    return new_column_eq_predicate(type_info, kValueColumn, format_value(spec.type, spec.cardinality / 2));
+}
+
+// Args: type, encoding, compression, sorted, cardinality, query, page cache.
+static void run_segment_scan(benchmark::State& state) {
+    SegmentSpec spec;
+    spec.type = static_cast<LogicalType>(state.range(0));
+    spec.encoding = static_cast<EncodingTypePB>(state.range(1));
+    spec.compression = static_cast<CompressionTypePB>(state.range(2));
+    spec.sorted = state.range(3) != 0;
+    spec.cardinality = state.range(4);
+    const auto query = static_cast<ScanQuery>(state.range(5));
+    const bool use_page_cache = state.range(6) != 0;
+    state.SetLabel(fmt::format("{}/{}/{}/{}", logical_type_to_string(spec.type), EncodingTypePB_Name(spec.encoding),
+                               CompressionTypePB_Name(spec.compression), spec.sorted ? "sorted" : "shuffled"));
+
+    auto* bench = SegmentScanBench::instance();
+    auto res = bench->get_or_build(spec);
+    if (!res.ok()) {
+        state.SkipWithError(res.status().to_string().c_str());
+        return;
+    }
+    auto [segment, tablet_schema] = res.value();
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    std::unique_ptr<ColumnPredicate> predicate(query == FULL_SCAN ? nullptr : create_predicate(spec, query));
+    // Start every benchmark with a cold page cache.
+    StoragePageCache::instance()->prune();
+
+    OlapReaderStatistics stats;
+    int64_t rows_read = 0;
+    for (auto _ : state) {
+        stats = OlapReaderStatistics();
+        SegmentReadOptions opts;
+        opts.fs = bench->fs();
+        opts.stats = &stats;
+        opts.tablet_schema = tablet_schema;
+        opts.use_page_cache = use_page_cache;
+        if (predicate != nullptr) {
+            PredicateAndNode pred_root;
+            pred_root.add_child(PredicateColumnNode{predicate.get()});
+            opts.pred_tree = PredicateTree::create(std::move(pred_root));
+            opts.predicates_for_zone_map.emplace(kValueColumn, PredicateList{predicate.get()});
+        }
+        ASSIGN_OR_ABORT(auto iter, segment->new_iterator(schema, opts));
+        auto chunk = ChunkHelper::new_chunk(schema, kChunkSize);
+        while (true) {
+            chunk->reset();
+            auto st = iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK(st.ok()) << st;
+            rows_read += chunk->num_rows();
+            benchmark::DoNotOptimize(chunk->columns().data());
+        }
+        iter->close();
+    }
+
+    // The pruning and page cache counters of the last iteration, which runs with a warm page cache.
+    state.counters["rows_read"] = benchmark::Counter(rows_read, benchmark::Counter::kIsRate);
+    state.counters["segment_bytes"] = bench->file_size(spec);
+    state.counters["zone_map_filtered"] = stats.rows_stats_filtered;
+    state.counters["bloom_filter_filtered"] = stats.rows_bf_filtered;
+    state.counters["pages"] = stats.total_pages_num;
+    state.counters["cached_pages"] = stats.cached_pages_num;
+    state.counters["decompress_ms"] = stats.decompress_ns / 1000000.0;
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static const std::vector<LogicalType> kTypes = {TYPE_INT, TYPE_BIGINT, TYPE_VARCHAR};
+static const std::vector<CompressionTypePB> kCompressions = {NO_COMPRESSION, LZ4_FRAME, ZSTD};
+static constexpr int64_t kLowCardinality = 1024;
+static constexpr int64_t kHighCardinality = kNumRows;
+
+static std::vector<EncodingTypePB> encodings_of(LogicalType type) {
+    if (type == TYPE_VARCHAR) {
+        return {DICT_ENCODING, PLAIN_ENCODING, PREFIX_ENCODING};
+    }
+    return {DICT_ENCODING, FOR_ENCODING, BIT_SHUFFLE, PLAIN_ENCODING};
+}
+
+static void decode_args(benchmark::internal::Benchmark* b) {
+    for (auto type : kTypes) {
+        for (auto encoding : encodings_of(type)) {
+            for (auto compression : kCompressions) {
+                for (int sorted : {0, 1}) {
+                    for (int64_t cardinality : {kLowCardinality, kHighCardinality}) {
+                        b->Args({type, encoding, compression, sorted, cardinality, FULL_SCAN, 0});
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void pruning_args(benchmark::internal::Benchmark* b) {
+    for (auto type : kTypes) {
+        for (int sorted : {0, 1}) {
+            for (auto query : {RANGE, EQUAL}) {
+                b->Args({type, PLAIN_ENCODING, LZ4_FRAME, sorted, kHighCardinality, query, 0});
+            }
+        }
+    }
+}
+
+static void page_cache_args(benchmark::internal::Benchmark* b) {
+    for (auto type : kTypes) {
+        for (auto compression : {LZ4_FRAME, ZSTD}) {
+            for (int use_page_cache : {0, 1}) {
+                b->Args({type, BIT_SHUFFLE, compression, 1, kHighCardinality, FULL_SCAN, use_page_cache});
+            }
+        }
+    }
+}
+
+// Decode throughput of the encodings and compression codecs.
+static void BM_SegmentDecode(benchmark::State& state) {
+    run_segment_scan(state);
+}
+
+// Zone map and bloom filter pruning of sorted and shuffled data.
+static void BM_SegmentPruning(benchmark::State& state) {
+    run_segment_scan(state);
+}
+
+// Decompressed pages served by the page cache instead of being decoded again.
+static void BM_SegmentPageCache(benchmark::State& state) {
+    run_segment_scan(state);
+}
+
+#define SEGMENT_SCAN_ARG_NAMES {"type", "encoding", "compression", "sorted", "cardinality", "query", "page_cache"}
+
+BENCHMARK(BM_SegmentDecode)->ArgNames(SEGMENT_SCAN_ARG_NAMES)->Apply(decode_args)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SegmentPruning)->ArgNames(SEGMENT_SCAN_ARG_NAMES)->Apply(pruning_args)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SegmentPageCache)->ArgNames(SEGMENT_SCAN_ARG_NAMES)->Apply(page_cache_args)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,114 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "column/column_helper.h"
+#include "simd/batch_run_counter.h"
+#include "simd/selector.h"
+#include "simd/simd.h"
+
+namespace starrocks {
+
+// The kernels are compiled to SSE/AVX2 on x86 and to NEON on aarch64,
+// run the same binary on both to compare the per-core throughput.
+
+// selectivity in percent of the nonzero bytes
+static std::vector<uint8_t> gen_filter(size_t num_rows, int selectivity) {
+    std::mt19937 rng(num_rows);
+    std::uniform_int_distribution<int> dist(0, 99);
+    std::vector<uint8_t> filter(num_rows);
+    for (auto& f : filter) {
+        f = dist(rng) < selectivity;
+    }
+    return filter;
+}
+
+static void BM_count_nonzero(benchmark::State& state) {
+    auto filter = gen_filter(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SIMD::count_nonzero(filter));
+    }
+    state.SetBytesProcessed(state.iterations() * filter.size());
+}
+
+static void BM_count_nonzero_int32(benchmark::State& state) {
+    auto filter = gen_filter(state.range(0), state.range(1));
+    std::vector<uint32_t> nums(filter.begin(), filter.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SIMD::count_nonzero(nums));
+    }
+    state.SetItemsProcessed(state.iterations() * nums.size());
+}
+
+static void BM_to_index(benchmark::State& state) {
+    auto filter = gen_filter(state.range(0), state.range(1));
+    std::vector<uint32_t> indexes(filter.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SIMD::to_index(filter.data(), filter.size(), indexes.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * filter.size());
+}
+
+static void BM_batch_run_counter(benchmark::State& state) {
+    auto filter = gen_filter(state.range(0), state.range(1));
+    for (auto _ : state) {
+        BatchRunCounter<32> counter(filter.data(), 0, filter.size());
+        size_t all_set = 0;
+        for (BatchCount batch = counter.next_batch(); batch.length > 0; batch = counter.next_batch()) {
+            all_set += batch.AllSet();
+        }
+        benchmark::DoNotOptimize(all_set);
+    }
+    state.SetItemsProcessed(state.iterations() * filter.size());
+}
+
+template <LogicalType TYPE>
+static void BM_select_if(benchmark::State& state) {
+    using Container = typename RunTimeColumnType<TYPE>::Container;
+    auto filter = gen_filter(state.range(0), state.range(1));
+    Container a(filter.size(), 1);
+    Container b(filter.size(), 2);
+    Container dst(filter.size());
+    for (auto _ : state) {
+        SIMD_selector<TYPE>::select_if(filter.data(), dst, a, b);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * filter.size());
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    for (int64_t num_rows : {4096, 65536}) {
+        for (int64_t selectivity : {1, 50, 99}) {
+            b->Args({num_rows, selectivity});
+        }
+    }
+}
+
+BENCHMARK(BM_count_nonzero)->Apply(process_args);
+BENCHMARK(BM_count_nonzero_int32)->Apply(process_args);
+BENCHMARK(BM_to_index)->Apply(process_args);
+BENCHMARK(BM_batch_run_counter)->Apply(process_args);
+BENCHMARK_TEMPLATE(BM_select_if, TYPE_TINYINT)->Apply(process_args);
+BENCHMARK_TEMPLATE(BM_select_if, TYPE_SMALLINT)->Apply(process_args);
+BENCHMARK_TEMPLATE(BM_select_if, TYPE_INT)->Apply(process_args);
+BENCHMARK_TEMPLATE(BM_select_if, TYPE_BIGINT)->Apply(process_args);
+BENCHMARK_TEMPLATE(BM_select_if, TYPE_DOUBLE)->Apply(process_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "column/binary_column.h"
+#include "exprs/string_functions.h"
+
+namespace starrocks {
+
+// Short strings mixing ascii, latin, CJK and emoji chars, so that the column is never pure ascii.
+static ColumnPtr create_utf8_column(size_t num_rows, size_t max_chars) {
+    static const std::vector<std::string> pieces = {"a", "Z", "é", "ß", "中", "文", "😀", " "};
+    std::mt19937 rng(0);
+    auto column = BinaryColumn::create();
+    for (size_t i = 0; i < num_rows; ++i) {
+        std::string s;
+        size_t num_chars = rng() % (max_chars + 1);
+        for (size_t k = 0; k < num_chars; ++k) {
+            s.append(pieces[rng() % pieces.size()]);
+        }
+        column->append(s);
+    }
+    return column;
+}
+
+template <StatusOr<ColumnPtr> (*Fn)(FunctionContext*, const Columns&)>
+static void BM_StringFunction(benchmark::State& state) {
+    const size_t num_rows = 4096;
+    Columns columns{create_utf8_column(num_rows, state.range(0))};
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+
+    for (auto _ : state) {
+        auto result = Fn(ctx.get(), columns).value();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK_TEMPLATE(BM_StringFunction, StringFunctions::utf8_length)->Arg(8)->Arg(32)->Arg(256);
+BENCHMARK_TEMPLATE(BM_StringFunction, StringFunctions::upper)->Arg(8)->Arg(32)->Arg(256);
+BENCHMARK_TEMPLATE(BM_StringFunction, StringFunctions::lower)->Arg(8)->Arg(32)->Arg(256);
+BENCHMARK_TEMPLATE(BM_StringFunction, StringFunctions::reverse)->Arg(8)->Arg(32)->Arg(256);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
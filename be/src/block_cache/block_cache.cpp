@@ -70,6 +70,12 @@ Status BlockCache::init(const CacheOptions& options) {
         return Status::NotSupported("unsupported block cache engine");
     }
     RETURN_IF_ERROR(_kv_cache->init(cache_options));
+    if (_populate_pool == nullptr) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("dc_populate")
+                                .set_min_threads(1)
+                                .set_max_threads(std::max(1, config::datacache_populate_threads))
+                                .build(&_populate_pool));
+    }
     _initialized.store(true, std::memory_order_relaxed);
     if (_disk_space_monitor) {
         _disk_space_monitor->start();
@@ -105,6 +111,54 @@ Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, size_t
     return write_buffer(cache_key, offset, buffer, options);
 }
 
+Status BlockCache::write_buffer_in_background(const CacheKey& cache_key, off_t offset, size_t size,
+                                              const char* data) {
+    if (offset % _block_size != 0) {
+        LOG(WARNING) << "write block key: " << cache_key << " with invalid args, offset: " << offset;
+        return Status::InvalidArgument(strings::Substitute("offset must be aligned by block size $0", _block_size));
+    }
+    if (size == 0) {
+        return Status::OK();
+    }
+    if (_populate_pool == nullptr) {
+        return write_buffer(cache_key, offset, size, data);
+    }
+    int64_t pending = _populate_pending_bytes.fetch_add(size) + size;
+    if (pending > config::datacache_populate_max_pending_bytes) {
+        _populate_pending_bytes.fetch_sub(size);
+        return Status::ResourceBusy("too many bytes pending to be written to block cache");
+    }
+
+    auto buffer = std::make_shared<std::string>(data, size);
+    Status st = _populate_pool->submit_func([this, cache_key, offset, buffer]() {
+        WriteCacheOptions options;
+        Status r = write_buffer(cache_key, offset, buffer->size(), buffer->data(), &options);
+        LOG_IF(WARNING, !r.ok() && !r.is_already_exist() && !r.is_resource_busy())
+                << "write block cache in background failed, errmsg: " << r.message();
+        _populate_pending_bytes.fetch_sub(buffer->size());
+    });
+    if (!st.ok()) {
+        _populate_pending_bytes.fetch_sub(size);
+    }
+    return st;
+}
+
+bool BlockCache::admit_to_populate(const CacheKey& cache_key, off_t offset) {
+    int32_t min_frequency = config::datacache_populate_admission_min_frequency;
+    if (min_frequency <= 1) {
+        return true;
+    }
+    size_t index = offset / _block_size;
+    uint64_t hash = std::hash<std::string>()(cache_key) ^ (index * 0x9E3779B97F4A7C15ULL);
+    return _populate_sketch.increment(hash) >= static_cast<uint32_t>(min_frequency);
+}
+
+void BlockCache::wait_for_background_writes() {
+    if (_populate_pool != nullptr) {
+        _populate_pool->wait();
+    }
+}
+
 Status BlockCache::write_object(const CacheKey& cache_key, const void* ptr, size_t size, DeleterFunc deleter,
                                 CacheHandle* handle, WriteCacheOptions* options) {
     if (!ptr) {
@@ -152,6 +206,15 @@ Status BlockCache::remove(const CacheKey& cache_key, off_t offset, size_t size)
     return _kv_cache->remove(block_key);
 }
 
+bool BlockCache::exist(const CacheKey& cache_key, off_t offset) const {
+    if (!_initialized.load(std::memory_order_relaxed) || offset < 0) {
+        return false;
+    }
+    size_t index = offset / _block_size;
+    std::string block_key = fmt::format("{}/{}", cache_key, index);
+    return _kv_cache->exist(block_key);
+}
+
 Status BlockCache::update_mem_quota(size_t quota_bytes) {
     return _kv_cache->update_mem_quota(quota_bytes);
 }
@@ -185,6 +248,8 @@ Status BlockCache::shutdown() {
     if (!_initialized.load(std::memory_order_relaxed)) {
         return Status::OK();
     }
+    // The pending writes would write to the cache being shut down.
+    wait_for_background_writes();
     Status st = _kv_cache->shutdown();
     if (_disk_space_monitor) {
         _disk_space_monitor->stop();
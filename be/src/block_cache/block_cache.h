@@ -15,8 +15,10 @@
 #pragma once
 
 #include "block_cache/disk_space_monitor.h"
+#include "block_cache/frequency_sketch.h"
 #include "block_cache/kv_cache.h"
 #include "common/status.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -40,6 +42,17 @@ public:
     Status write_buffer(const CacheKey& cache_key, off_t offset, size_t size, const char* data,
                         WriteCacheOptions* options = nullptr);
 
+    // Copy the data buffer and write it to cache by a background thread, the `offset` must be aligned by
+    // block size. Return Status::ResourceBusy if too many bytes are pending to be written.
+    Status write_buffer_in_background(const CacheKey& cache_key, off_t offset, size_t size, const char* data);
+
+    // Record a miss of the block at |offset|, and return whether it has been missed often enough recently
+    // to be populated, see `datacache_populate_admission_min_frequency`.
+    bool admit_to_populate(const CacheKey& cache_key, off_t offset);
+
+    // Wait until all the background writes finish.
+    void wait_for_background_writes();
+
     // Write object to cache, the `ptr` is the object pointer.
     Status write_object(const CacheKey& cache_key, const void* ptr, size_t size, DeleterFunc deleter,
                         CacheHandle* handle, WriteCacheOptions* options = nullptr);
@@ -60,6 +73,10 @@ public:
     // Remove data from cache. The offset and size must be aligned by block size
     Status remove(const CacheKey& cache_key, off_t offset, size_t size);
 
+    // Return whether the block containing |offset| is in cache. It is a cheap probe which neither reads
+    // the block nor changes its priority.
+    bool exist(const CacheKey& cache_key, off_t offset) const;
+
     // Update the datacache memory quota.
     Status update_mem_quota(size_t quota_bytes);
 
@@ -94,6 +111,9 @@ private:
     size_t _block_size = 0;
     std::unique_ptr<KvCache> _kv_cache;
     std::unique_ptr<DiskSpaceMonitor> _disk_space_monitor;
+    std::unique_ptr<ThreadPool> _populate_pool;
+    std::atomic<int64_t> _populate_pending_bytes = 0;
+    FrequencySketch _populate_sketch{1 << 16};
     std::atomic<bool> _initialized = false;
 };
 
@@ -94,6 +94,10 @@ Status CacheLibWrapper::remove(const std::string& key) {
     return Status::OK();
 }
 
+bool CacheLibWrapper::exist(const std::string& key) const {
+    return _cache->peek(key) != nullptr;
+}
+
 const DataCacheMetrics CacheLibWrapper::cache_metrics(int level) {
     // not implemented
     DataCacheMetrics metrics{};
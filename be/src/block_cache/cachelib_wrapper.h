@@ -56,6 +56,8 @@ public:
 
     Status remove(const std::string& key) override;
 
+    bool exist(const std::string& key) const override;
+
     Status update_mem_quota(size_t quota_bytes) override;
 
     Status update_disk_spaces(const std::vector<DirSpace>& spaces) override;
@@ -14,6 +14,10 @@
 
 #include "block_cache/datacache_utils.h"
 
+#include <cstring>
+
+#include "util/hash_util.hpp"
+
 namespace starrocks {
 void DataCacheUtils::set_metrics_from_thrift(TDataCacheMetrics& t_metrics, const DataCacheMetrics& metrics) {
     switch (metrics.status) {
@@ -36,4 +40,31 @@ void DataCacheUtils::set_metrics_from_thrift(TDataCacheMetrics& t_metrics, const
     t_metrics.__set_mem_used_bytes(metrics.mem_used_bytes);
 }
 
+std::string DataCacheUtils::calc_cache_key(const std::string& filename, size_t file_size, int64_t modification_time) {
+    std::string cache_key;
+    cache_key.resize(12);
+
+    char* data = cache_key.data();
+    uint64_t hash_value = HashUtil::hash64(filename.data(), filename.size(), 0);
+    memcpy(data, &hash_value, sizeof(hash_value));
+    // The modification time is more appropriate to indicate the different file versions.
+    // While some data source, such as Hudi, have no modification time because their files
+    // cannot be overwritten. So, if the modification time is unsupported, we use file size instead.
+    // Usually the last modification timestamp has 41 bits, to reduce memory usage, we ignore the tail 9
+    // bytes and choose the high 32 bits to represent the second timestamp.
+    if (modification_time > 0) {
+        uint32_t mtime_s = (modification_time >> 9) & 0x00000000FFFFFFFF;
+        memcpy(data + 8, &mtime_s, sizeof(mtime_s));
+    } else {
+        uint32_t size = file_size;
+        memcpy(data + 8, &size, sizeof(size));
+    }
+    return cache_key;
+}
+
+std::string DataCacheUtils::calc_metacache_key(const std::string& filename, size_t file_size, int64_t modification_time,
+                                               const std::string& suffix) {
+    return calc_cache_key(filename, file_size, modification_time) + suffix;
+}
+
 } // namespace starrocks
\ No newline at end of file
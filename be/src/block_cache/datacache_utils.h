@@ -22,6 +22,15 @@ namespace starrocks {
 class DataCacheUtils {
 public:
     static void set_metrics_from_thrift(TDataCacheMetrics& t_metrics, const DataCacheMetrics& metrics);
+
+    // Return the cache key of the blocks of a remote file, it identifies the file version by the modification
+    // time, or by the file size if the modification time is not supported.
+    static std::string calc_cache_key(const std::string& filename, size_t file_size, int64_t modification_time);
+
+    // Return the cache key of a metadata object of a remote file, such as the parsed footer, which is the cache
+    // key of the file followed by |suffix| naming the kind of the object.
+    static std::string calc_metacache_key(const std::string& filename, size_t file_size, int64_t modification_time,
+                                          const std::string& suffix);
 };
 
 } // namespace starrocks
\ No newline at end of file
@@ -0,0 +1,87 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace starrocks {
+
+// A count-min sketch estimating how many times a key has been accessed recently, in a fixed memory
+// footprint. The counters saturate at 15, and all of them are halved once `10 * width` accesses were
+// recorded, so that the estimation favors the recent accesses.
+class FrequencySketch {
+public:
+    // |width| is rounded up to a power of 2.
+    explicit FrequencySketch(size_t width) {
+        size_t w = 1;
+        while (w < width) {
+            w <<= 1;
+        }
+        _mask = w - 1;
+        _sample_size = 10 * w;
+        _counters.assign(kDepth * w, 0);
+    }
+
+    // Record an access of the key with |hash|, and return the estimated access count including this one.
+    uint32_t increment(uint64_t hash) {
+        std::lock_guard l(_mutex);
+        uint32_t estimated = kMaxCount;
+        for (int i = 0; i < kDepth; i++) {
+            uint8_t& counter = _counters[_index(hash, i)];
+            if (counter < kMaxCount) {
+                counter++;
+            }
+            estimated = std::min<uint32_t>(estimated, counter);
+        }
+        if (++_size >= _sample_size) {
+            for (auto& counter : _counters) {
+                counter >>= 1;
+            }
+            _size /= 2;
+        }
+        return estimated;
+    }
+
+    uint32_t estimate(uint64_t hash) const {
+        std::lock_guard l(_mutex);
+        uint32_t estimated = kMaxCount;
+        for (int i = 0; i < kDepth; i++) {
+            estimated = std::min<uint32_t>(estimated, _counters[_index(hash, i)]);
+        }
+        return estimated;
+    }
+
+private:
+    static constexpr int kDepth = 4;
+    static constexpr uint8_t kMaxCount = 15;
+
+    // Double hashing, each row uses a different combination of the two halves of |hash|.
+    size_t _index(uint64_t hash, int row) const {
+        uint64_t h1 = hash;
+        uint64_t h2 = (hash >> 32) | 1;
+        return row * (_mask + 1) + ((h1 + row * h2 * 0x9E3779B97F4A7C15ULL) & _mask);
+    }
+
+    mutable std::mutex _mutex;
+    std::vector<uint8_t> _counters;
+    size_t _mask = 0;
+    size_t _sample_size = 0;
+    size_t _size = 0;
+};
+
+} // namespace starrocks
@@ -50,6 +50,9 @@ public:
     // Remove data from cache. The offset must be aligned by block size
     virtual Status remove(const std::string& key) = 0;
 
+    // Return whether the key is in cache, without reading the data or promoting it.
+    virtual bool exist(const std::string& key) const = 0;
+
     // Update the datacache memory quota.
     virtual Status update_mem_quota(size_t quota_bytes) = 0;
 
@@ -126,6 +126,10 @@ Status StarCacheWrapper::remove(const std::string& key) {
     return Status::OK();
 }
 
+bool StarCacheWrapper::exist(const std::string& key) const {
+    return _cache->exist(key);
+}
+
 Status StarCacheWrapper::update_mem_quota(size_t quota_bytes) {
     return to_status(_cache->update_mem_quota(quota_bytes));
 }
@@ -271,11 +271,39 @@ void Chunk::rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32
 }
 
 size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
-    if (!force && SIMD::count_zero(selection) == 0) {
+    if (_columns.size() <= 1) {
+        if (!force && SIMD::count_zero(selection) == 0) {
+            return num_rows();
+        }
+        for (auto& column : _columns) {
+            column->filter(selection);
+        }
+        return num_rows();
+    }
+
+    size_t selected = SIMD::count_nonzero(selection);
+    if (!force && selected == selection.size()) {
+        return num_rows();
+    }
+    if (selected * SPARSE_SELECTION_RATIO > selection.size()) {
+        for (auto& column : _columns) {
+            column->filter(selection);
+        }
         return num_rows();
     }
+
+    // The selection is sparse, so convert it to the indexes of the selected rows at once, and gather them
+    // column by column, instead of scanning the whole selection for each column.
+    Buffer<uint32_t> indexes(selected);
+    SIMD::to_index(selection.data(), selection.size(), indexes.data());
     for (auto& column : _columns) {
-        column->filter(selection);
+        if (column->is_constant()) {
+            column->filter(selection);
+            continue;
+        }
+        auto dst = column->clone_empty();
+        dst->append_selective(*column, indexes.data(), 0, selected);
+        column->swap_column(*dst);
     }
     return num_rows();
 }
@@ -200,6 +200,8 @@ public:
     // @param force whether check zero-count of filter, skip the filter procedure if no data to filter
     // @return the number of rows after filter.
     size_t filter(const Buffer<uint8_t>& selection, bool force = false);
+    // filter() gathers the selected rows by their indexes when at most 1/SPARSE_SELECTION_RATIO rows are selected.
+    static constexpr size_t SPARSE_SELECTION_RATIO = 32;
 
     // Return the number of rows after filter.
     size_t filter_range(const Buffer<uint8_t>& selection, size_t from, size_t to);
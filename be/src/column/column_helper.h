@@ -423,6 +423,11 @@ public:
                 if constexpr (avx512f && sizeof(T) == 4) {
                     AVX512_ASM_COPY(0, 0xffff, 32, d);
                     AVX512_ASM_COPY(16, 0xffff, 32, d);
+                } else if constexpr (avx512f && sizeof(T) == 8) {
+                    AVX512_ASM_COPY(0, 0xff, 64, q);
+                    AVX512_ASM_COPY(8, 0xff, 64, q);
+                    AVX512_ASM_COPY(16, 0xff, 64, q);
+                    AVX512_ASM_COPY(24, 0xff, 64, q);
                 } else {
                     phmap::priv::BitMask<uint32_t, 32> bitmask(mask);
                     for (auto idx : bitmask) {
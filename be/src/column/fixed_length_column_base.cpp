@@ -220,8 +220,13 @@ void FixedLengthColumnBase<T>::deserialize_and_append_batch(Buffer<Slice>& srcs,
 
 template <typename T>
 void FixedLengthColumnBase<T>::fnv_hash(uint32_t* hash, uint32_t from, uint32_t to) const {
-    for (uint32_t i = from; i < to; ++i) {
-        hash[i] = HashUtil::fnv_hash(&_data[i], sizeof(ValueType), hash[i]);
+    if constexpr (sizeof(ValueType) == 1 || sizeof(ValueType) == 2 || sizeof(ValueType) == 4 ||
+                  sizeof(ValueType) == 8) {
+        HashUtil::fnv_hash_batch(_data.data() + from, hash + from, to - from);
+    } else {
+        for (uint32_t i = from; i < to; ++i) {
+            hash[i] = HashUtil::fnv_hash(&_data[i], sizeof(ValueType), hash[i]);
+        }
     }
 }
 
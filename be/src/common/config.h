@@ -100,6 +100,11 @@ CONF_mInt32(transaction_publish_version_worker_count, "0");
 // 0 means apply worker count is equal to cpu core count
 CONF_mInt32(transaction_apply_worker_count, "0");
 CONF_mInt32(get_pindex_worker_count, "0");
+// The number of the most recently written primary key tablets whose primary index is loaded in background
+// after BE starts, so that the first writes after a restart do not wait for loading it. 0 means disabled.
+CONF_Int32(pindex_preload_tablet_num, "0");
+// The count of thread to preload primary index, which bounds the disk io taken by the preloading.
+CONF_Int32(pindex_preload_worker_count, "2");
 
 // The count of thread to clear transaction task.
 CONF_Int32(clear_transaction_task_worker_count, "1");
@@ -143,6 +148,9 @@ CONF_mInt32(max_download_speed_kbps, "50000");
 CONF_mInt32(download_low_speed_limit_kbps, "50");
 // The download low speed time(seconds).
 CONF_mInt32(download_low_speed_time, "300");
+// The number of files of a snapshot downloaded in parallel by a clone task, every download is limited
+// by max_download_speed_kbps separately.
+CONF_mInt32(clone_download_parallelism, "4");
 // The sleep time for one second.
 CONF_Int32(sleep_one_second, "1");
 // The sleep time for five seconds.
@@ -225,14 +233,43 @@ CONF_mInt32(max_scan_key_num, "1024");
 CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 // (Advanced) Maximum size of per-query receive-side buffer.
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
+// A merging exchange without limit switches to merge-path based parallel merge when it has at least
+// this many senders, even if the FE did not ask for it. 0, the default, leaves the choice to the FE.
+CONF_mInt32(exchange_parallel_merge_min_senders, "0");
+// The serialized data of a chunk at least this large is attached to the brpc request as a user-owned
+// IOBuf block instead of being copied into the IOBuf. A value <= 0 always copies.
+CONF_mInt64(exchange_zero_copy_attachment_min_bytes, "65536");
+// Whether the exchange sink chooses none, LZ4 or ZSTD for each destination by the measured compression ratio,
+// compression time and network throughput to the destination, instead of always using
+// transmission_compression_type.
+CONF_mBool(exchange_enable_adaptive_compression, "false");
+// Every Nth partition hash of a hash shuffle is fed into a heavy hitter sketch, and the keys that exceed
+// the fair share of a receiver are reported in the profile as SkewHotKeys. 0, the default, disables the detection
+// and its cost; otherwise a sampled row costs one scan of at most 64 counters.
+CONF_mInt32(exchange_skew_detection_sample_interval, "0");
+// Whether a pipeline exchange receiver deserializes the received chunks on the brpc thread while its buffer is
+// below exchg_node_buffer_size_bytes, and merges the small chunks of a request into chunks of up to chunk_size
+// rows, instead of deserializing every chunk lazily on the consumer driver.
+CONF_mBool(exchange_receiver_eager_deserialize, "false");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
+// The max bytes of the memcmp-able key that the heap top-n sorter encodes from the leading sort columns
+// of a multi-column ORDER BY, so that most comparisons are a single memcmp. 0 disables it.
+CONF_mInt32(sort_normalized_key_max_bytes, "32");
+// The local partition top-n of ROW_NUMBER keeps the rows of a partition in a bounded heap over a row arena shared
+// by all the partitions instead of a sorter per partition, if a partition keeps at most this many rows.
+// 0 disables it.
+CONF_mInt64(local_partition_topn_heap_max_rows, "64");
 
 CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
 // The memory_limitation_per_thread_for_schema_change unit GB.
 CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
 CONF_mDouble(memory_ratio_for_sorting_schema_change, "0.8");
+// Change the type of a value column without rewriting its data when the new type is a lossless widening of
+// the old one (e.g. INT to BIGINT, or a longer VARCHAR). The segments are linked and the values are cast on read,
+// the data is converted by the following compactions.
+CONF_mBool(enable_lazy_schema_change, "true");
 
 CONF_mInt32(update_cache_expire_sec, "360");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
@@ -258,10 +295,17 @@ CONF_mInt32(snapshot_expire_time_sec, "172800");
 CONF_mInt32(trash_file_expire_time_sec, "86400");
 //file descriptors cache, by default, cache 16384 descriptors
 CONF_Int32(file_descriptor_cache_capacity, "16384");
+// The maximum readahead window in bytes that a local file stream advises to the kernel with POSIX_FADV_WILLNEED
+// once it detects sequential reads. The window starts from 128KB and doubles up to this size, 0 disables it.
+CONF_mInt64(local_file_readahead_max_bytes, "4194304");
 // minimum file descriptor number
 // modify them upon necessity
 CONF_Int32(min_file_descriptor_number, "60000");
 CONF_Int64(index_stream_cache_capacity, "10737418240");
+// The capacity in bytes of the cache of the rows deleted by the delete predicates (DELETE FROM ... WHERE) of
+// duplicate and aggregate key tables. A segment evaluates its delete predicates once into a bitmap, and the following
+// scans skip the deleted rows by the bitmap instead of evaluating the predicates row by row. 0 means disable it.
+CONF_Int64(delete_predicate_bitmap_cache_capacity, "268435456");
 // CONF_Int64(max_packed_row_block_size, "20971520");
 
 // data and index page size, default is 64k
@@ -271,6 +315,21 @@ CONF_Int32(data_page_size, "65536");
 CONF_mString(storage_page_cache_limit, "20%");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
+// Cache for the compressed bytes of storage pages, as a second tier of the storage page cache.
+// Pages read from disk are kept here first, and promoted to the decompressed tier on the next hit.
+// "0" disables the tier.
+CONF_mString(storage_page_cache_compressed_limit, "0");
+// Whether the storage page cache admits pages by TinyLFU and keeps the pages hit again in a protected
+// segment, so that large scans do not evict the frequently accessed pages.
+CONF_Bool(enable_storage_page_cache_tiny_lfu, "false");
+// The number of the most accessed storage pages recorded in a hot list, which is saved in the first storage root
+// periodically and at shutdown. A restarted BE reads the pages of the saved list in the background to warm up the
+// OS page cache, the block cache and the compressed tier of the storage page cache. 0 disables it.
+CONF_mInt32(page_cache_hot_list_capacity, "50000");
+// The interval in seconds to save the page cache hot list.
+CONF_mInt32(page_cache_hot_list_save_interval_seconds, "300");
+// The max bytes per second read to warm up the caches from the page cache hot list, 0 means unlimited.
+CONF_mInt64(page_cache_warmup_bytes_per_second, "104857600");
 // whether to enable the bitmap index memory cache
 CONF_mBool(enable_bitmap_index_memory_page_cache, "false");
 // whether to enable the zonemap index memory cache
@@ -303,8 +362,23 @@ CONF_Int32(cumulative_compaction_num_threads_per_disk, "1");
 // when candidate num reach this value, the condidate with lowest score will be dropped.
 CONF_mInt64(max_compaction_candidate_num, "40960");
 
+// If true, compaction candidates are ranked by the expected reduction of query cost per byte compacted,
+// i.e. the compaction score weighed by how often the tablet is scanned and divided by the input size,
+// instead of by the compaction score only.
+CONF_mBool(enable_compaction_query_cost_score, "false");
+// When the utilization of the pipeline driver executor is above the busy ratio, fewer compaction tasks are
+// allowed to run, down to one when it is fully used. 1 means never throttle.
+CONF_mDouble(compaction_busy_query_load_ratio, "0.8");
+// When the utilization of the pipeline driver executor is below the idle ratio, the limits of running
+// compaction tasks per disk are doubled. 0 means never.
+CONF_mDouble(compaction_idle_query_load_ratio, "0.1");
+
 // If true, SR will try no to merge delta column back to main segment
 CONF_mBool(enable_lazy_delta_column_compaction, "true");
+// When a segment already has at least this many delta column groups, a column mode partial update
+// also rewrites the columns of the older delta column groups into its own .cols files, so that the older
+// ones can be garbage collected and reads open fewer files. 0 means never merge.
+CONF_mInt32(partial_update_merge_delta_column_group_threshold, "8");
 
 CONF_mInt32(update_compaction_check_interval_seconds, "10");
 CONF_mInt32(update_compaction_num_threads_per_disk, "1");
@@ -344,10 +418,20 @@ CONF_mInt32(compaction_trace_threshold, "60");
 // If enabled, will verify compaction/schema-change output rowset correctness
 CONF_mBool(enable_rowset_verify, "false");
 
+// If enabled, the compaction of non-overlapping rowsets whose ranges of the leading sort key are
+// disjoint and ascending by version links their segment files into the output rowset without
+// decoding them, like the shortcut compaction of a single rowset.
+CONF_mBool(enable_compaction_link_disjoint_rowsets, "false");
+
 // Max columns of each compaction group.
 // If the number of schema columns is greater than this,
 // the columns will be divided into groups for vertical compaction.
 CONF_Int64(vertical_compaction_max_columns_per_group, "5");
+// Max columns of each non-key compaction group when narrow columns are merged into wider groups,
+// as long as the read chunk size of the group is not lowered by compaction_memory_limit_per_worker.
+// Fewer groups mean fewer passes over the input rowsets. A value not greater than
+// vertical_compaction_max_columns_per_group disables the merging.
+CONF_mInt64(vertical_compaction_max_columns_per_group_by_memory, "40");
 
 CONF_Bool(enable_event_based_compaction_framework, "true");
 
@@ -357,6 +441,14 @@ CONF_mInt64(size_tiered_min_level_size, "131072");
 CONF_mInt64(size_tiered_level_multiple, "5");
 CONF_mInt64(size_tiered_level_multiple_dupkey, "10");
 CONF_mInt64(size_tiered_level_num, "7");
+// If true, the score of a size-tiered level is scaled by how much the key ranges of its segments overlap on the
+// first sort key, i.e. by how much merging them cuts the segments read by a query. The levels of disjoint segments
+// keep more of their score on the tablets scanned more frequently.
+CONF_mBool(enable_size_tiered_read_amplification_score, "true");
+// The scans per minute at which a tablet is considered half hot by the size-tiered read amplification score.
+CONF_mDouble(size_tiered_hot_tablet_scans_per_minute, "60");
+// The ratio of score kept by a size-tiered level of disjoint segments on a tablet that is never scanned.
+CONF_mDouble(size_tiered_disjoint_level_min_score_ratio, "0.2");
 
 CONF_Bool(enable_check_string_lengths, "true");
 
@@ -401,9 +493,18 @@ CONF_Int32(dictionary_page_size, "1048576");
 // no-string column.
 CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
 
+// Whether to write FLOAT/DOUBLE columns with ALP encoding instead of bitshuffle by default. The segments written
+// with ALP encoding could not be read by the versions without it, so it is disabled by default.
+CONF_mBool(enable_alp_encoding_for_float, "false");
+
 // The minimum chunk size for dictionary encoding speculation
 CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
 
+// Whether to keep the global dictionary codes of the dictionary words in the column meta of a segment, when the
+// segment is loaded with a global dictionary covering all its words. A query using the same version of the global
+// dictionary then maps the local codes to the global ones without looking up the words.
+CONF_mBool(enable_segment_global_dict_codes, "true");
+
 // Whether to use special thread pool for streaming load to avoid deadlock for
 // concurrent streaming loads. The maximum number of threads and queue size are
 // set INT32_MAX which indicate there is no limit for the thread pool. Note you
@@ -418,6 +519,9 @@ CONF_mInt64(streaming_load_max_mb, "102400");
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
 CONF_mInt64(streaming_load_max_batch_size_mb, "100");
+// The number of 1MB buffers decompressed ahead of the parser by a dedicated thread for compressed load files,
+// so that reading and decompressing overlap with parsing. 0 means to decompress on the scanner thread.
+CONF_mInt32(load_async_decompression_buffers, "4");
 // The alive time of a TabletsChannel.
 // If the channel does not receive any data till this time,
 // the channel will be removed.
@@ -493,7 +597,8 @@ CONF_String(scratch_dirs, "/tmp");
 // then only the first writable directory is used
 // CONF_Bool(allow_multiple_scratch_dirs_per_device, "false");
 
-// Linux transparent huge page.
+// Linux transparent huge page. When enabled, large buffers such as the join hash table buckets are advised
+// with MADV_HUGEPAGE before they are touched.
 CONF_Bool(madvise_huge_pages, "false");
 
 // Whether use mmap to allocate memory.
@@ -530,6 +635,9 @@ CONF_mInt32(tablet_stat_cache_update_interval_second, "300");
 
 // Result buffer cancelled time (unit: second).
 CONF_mInt32(result_buffer_cancelled_interval_time, "300");
+// Serialize the rows of an unordered MySQL protocol result with data sink dop drivers, rather than with the single
+// driver of the gathering exchange.
+CONF_mBool(enable_parallel_mysql_result_sink, "false");
 
 // The increased frequency of priority for remaining tasks in BlockingPriorityQueue.
 CONF_mInt32(priority_queue_remaining_tasks_increased_frequency, "512");
@@ -584,6 +692,14 @@ CONF_Int32(es_http_timeout_ms, "5000");
 // if request batch size exceeds this value, ES will return bad request(400)
 // https://www.elastic.co/guide/en/elasticsearch/reference/current/index-modules.html
 CONF_Int32(es_index_max_result_window, "10000");
+// The max number of sliced scrolls reading a shard of an Elasticsearch index concurrently, when there are fewer
+// shards than the pipeline dop of the scan. A value <= 1 reads each shard with a single scroll. Sliced scrolls
+// require Elasticsearch 5.0 or later.
+CONF_mInt32(es_scroll_max_slices_per_shard, "1");
+// The max number of connections reading a MySQL external table concurrently, each of them reads a range of the
+// leading integer column of the primary key, which is split by its min and max values. A table without such a key
+// is read by a single connection, and so is a value <= 1.
+CONF_mInt32(mysql_scan_max_parallel_connections, "1");
 
 // The max client cache number per each host.
 // There are variety of client cache in BE, but currently we use the
@@ -647,12 +763,21 @@ CONF_Int32(txn_shard_size, "1024");
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_load_tablet_failure, "false");
 
+// The number of threads loading the tablet metas and rowset metas of each data dir at startup.
+// 1, the default, loads them on the thread of the data dir.
+CONF_Int32(load_tablet_meta_threads_per_data_dir, "1");
+
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
 
+// The bytes a chunk is allowed to grow to before chunk_size rows, chunks of wide rows are cut at this size by the
+// segment iterator and the chunk accumulator, so that the columns being processed stay in the cpu cache.
+// -1 means 4 times the L2 cache size, 0 disables it.
+CONF_mInt64(chunk_target_bytes, "-1");
+
 // Valid range: [0-1000].
 // `0` will disable late materialization.
 // `1000` will enable late materialization always.
@@ -726,6 +851,18 @@ CONF_mDouble(pipeline_connector_scan_thread_num_per_cpu, "8");
 CONF_Int64(pipeline_scan_thread_pool_queue_size, "102400");
 // The number of execution threads for pipeline engine.
 CONF_Int64(pipeline_exec_thread_pool_thread_num, "0");
+// Whether to bind the pipeline execution threads and scan threads to NUMA nodes in a round-robin way.
+// The i-th execution thread and the i-th scan thread are bound to the same node, and the chunks
+// allocated by a bound thread are placed in the memory of its node by the first-touch policy.
+// Only the threads are pinned: drivers and scan tasks are still picked by any thread regardless of
+// the node of their data, and memory is not allocated from per-node arenas, so it is off by default.
+CONF_Bool(pipeline_enable_numa_aware_thread_binding, "false");
+// The frequency (Hz of thread CPU time) at which the pipeline execution threads sample the query, driver and
+// operator they are running, exposed by /api/pipeline_sampling_profile. 0 disables the sampling.
+CONF_mInt32(pipeline_sampling_profiler_frequency, "0");
+// Whether the operators evaluate their conjuncts in the order of the selectivity and cost measured at runtime,
+// instead of the order in the plan.
+CONF_mBool(pipeline_enable_adaptive_conjuncts_order, "true");
 // The number of threads for preparing fragment instances in pipeline engine, vCPUs by default.
 // *  "n": positive integer, fixed number of threads to n.
 // *  "0": default value, means the same as number of cpu cores.
@@ -739,6 +876,10 @@ CONF_Int64(pipeline_sink_io_thread_pool_queue_size, "102400");
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "64");
+// Whether the sink buffer packs the pending requests to the fragment instances on the same host into one rpc.
+CONF_mBool(pipeline_sink_enable_rpc_coalescing, "false");
+// The max attachment bytes of one coalesced rpc.
+CONF_mInt64(pipeline_sink_coalesce_rpc_max_bytes, "1048576");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
@@ -748,6 +889,13 @@ CONF_mBool(pipeline_print_profile, "false");
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
+// Whether to put a local driver queue per executor thread in front of the shared driver queue,
+// and let the idle executor threads steal drivers from the others.
+// It reduces the lock contention of the shared driver queue, when there are many cores and short drivers.
+CONF_Bool(pipeline_enable_work_stealing_driver_queue, "false");
+// Whether to run the ready drivers of the short-query workgroup ahead of all the other workgroups,
+// and let the running drivers of the other workgroups yield at the next chunk boundary.
+CONF_mBool(pipeline_enable_short_query_preemption, "true");
 // 0 represents PriorityScanTaskQueue (by default), while 1 represents MultiLevelFeedScanTaskQueue.
 // - PriorityScanTaskQueue prioritizes scan tasks with lower committed times.
 // - MultiLevelFeedScanTaskQueue prioritizes scan tasks with shorter execution time.
@@ -760,8 +908,44 @@ CONF_Double(pipeline_scan_queue_ratio_of_adjacent_queue, "1.5");
 
 CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
+// When the columns buffered by an analytic operator take at least this many bytes, the rows which are no longer
+// needed are removed right away instead of waiting for pipeline_analytic_removable_chunk_num chunks.
+// A value <= 0 disables it.
+CONF_Int64(pipeline_analytic_max_buffered_bytes, "268435456");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_Bool(pipeline_analytic_enable_removable_cumulative_process, "true");
+// Evaluate sliding ROWS frames consisting of MIN/MAX only with monotonic queues instead of rescanning each frame.
+CONF_Bool(pipeline_analytic_enable_sliding_min_max_process, "true");
+// Evaluate sliding ROWS frames at least this wide with a segment tree over the intermediate states of the
+// window functions, if all of them could merge their states. A value <= 0 disables it.
+CONF_Int32(pipeline_analytic_segment_tree_min_frame_rows, "128");
+
+// The build rows of a hash join are radix-partitioned by their buckets before building the hash table,
+// when the number of build rows is not less than this value, so that each partition of the hash table
+// fits in the cache. 0 means always, and a negative value, which is the default, disables the partitioned build.
+// The build columns are copied one by one while reordering, which costs the memory of the largest one.
+CONF_mInt64(hash_join_partitioned_build_min_rows, "-1");
+// The max number of threads inserting the partitions of a partitioned build into the hash table concurrently,
+// including the thread of the build operator, the others are borrowed from a pool of hash_join_build_thread_num
+// threads. A value <= 1, the default, inserts all the partitions by the thread of the build operator.
+CONF_mInt32(hash_join_parallel_build_dop, "1");
+// The number of threads of the pool helping the partitioned builds of hash joins, 0 means the number of cores.
+CONF_Int32(hash_join_build_thread_num, "0");
+// Whether to software-prefetch the buckets and build keys of a probe chunk before searching the hash table,
+// when the hash table is too large to fit in the cache.
+CONF_mBool(hash_join_probe_enable_prefetch, "true");
+// Whether to inline a single string join key into a 8 or 16 bytes fixed size key, when all the build values are
+// short enough, so that searching the hash table compares integers instead of the bytes behind slices.
+CONF_mBool(enable_hash_join_inline_short_string_key, "true");
+// Whether the fragment instances of a query on a BE, which receive the same build rows of a broadcast join, share the
+// hash table built by the first of them instead of building one each. The shared hash table is charged to the memory
+// tracker of the query instead of the fragment instances.
+CONF_mBool(enable_broadcast_join_build_sharing, "false");
+// Whether an inner nested loop join with range conditions like `probe.ts BETWEEN build.start AND build.end` sorts
+// the build rows by a bound and only pairs each probe row with the build rows that may fall in its range,
+// instead of the whole cross product. The build side is not indexed when it has less rows than this value,
+// a negative value disables the index, which is the default.
+CONF_mInt64(nljoin_range_index_min_build_rows, "-1");
 
 /// For parallel scan on the single tablet.
 // These three configs are used to calculate the minimum number of rows picked up from a segment at one time.
@@ -824,7 +1008,18 @@ CONF_Strings(fallback_to_hadoop_fs_list, "");
 CONF_Strings(s3_compatible_fs_list, "s3n://, s3a://, s3://, oss://, cos://, cosn://, obs://, ks3://, tos://");
 
 // Lake
+// Whether to merge the reads of the columns of a segment file into fewer large reads, by
+// io_coalesce_read_max_distance_size and io_coalesce_read_max_buffer_size.
 CONF_mBool(io_coalesce_lake_read_enable, "false");
+// The same as io_coalesce_lake_read_enable, for the segment files of local tablets.
+CONF_mBool(io_coalesce_local_read_enable, "false");
+// Whether to read the coalesced buffers of the next chunks ahead asynchronously,
+// only works with the coalesced reads above.
+CONF_mBool(io_coalesce_lake_read_prefetch_enable, "false");
+// The number of chunks to read ahead for io_coalesce_lake_read_prefetch_enable.
+CONF_mInt32(io_coalesce_lake_read_prefetch_chunks, "4");
+// The max number of threads reading ahead for io_coalesce_lake_read_prefetch_enable.
+CONF_Int32(io_coalesce_lake_read_prefetch_thread_num, "16");
 
 // orc reader
 CONF_Bool(enable_orc_late_materialization, "true");
@@ -843,11 +1038,27 @@ CONF_Int32(orc_loading_buffer_size, "8388608");
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
+// Whether to skip the pages of the lazy columns without any row left by the filter of the active columns,
+// located by the offset index, so that they are neither read nor decompressed.
+CONF_mBool(parquet_lazy_column_page_skip_enable, "true");
+// Whether to read the next row group ahead asynchronously while the current one is being decoded,
+// only works with parquet_coalesce_read_enable and without datacache. The threads are shared with
+// io_coalesce_lake_read_prefetch_thread_num.
+CONF_mBool(parquet_prefetch_next_row_group_enable, "false");
+// The next row group is not read ahead if the active columns of it are larger than this.
+CONF_mInt64(parquet_prefetch_max_bytes, "67108864"); // 64MB
+// The number of threads encoding the columns of a chunk in parallel in the parquet writer of the
+// connector sinks, the sink driver itself is one of them and the others are taken from the connector sink
+// executor. 1 means the columns are encoded one by one by the sink driver.
+CONF_mInt32(parquet_writer_encode_parallelism, "4");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
 CONF_Int32(io_tasks_per_scan_operator, "4");
+// Whether to shrink the io tasks of a scan operator at runtime while the scan executor has more queued
+// tasks than threads, and grow them back to io_tasks_per_scan_operator once it catches up.
+CONF_mBool(enable_scan_elastic_io_tasks, "true");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
 CONF_Int32(connector_io_tasks_adjust_interval_ms, "50");
@@ -856,6 +1067,12 @@ CONF_Int32(connector_io_tasks_adjust_smooth, "4");
 CONF_Int32(connector_io_tasks_slow_io_latency_ms, "50");
 CONF_mDouble(scan_use_query_mem_ratio, "0.25");
 CONF_Double(connector_scan_use_query_mem_ratio, "0.3");
+// Whether the concurrent scans of the same columns of a duplicate key tablet at the same version share one
+// storage read, every scan applies its own predicates to the shared chunks.
+CONF_mBool(enable_shared_scan, "false");
+// Max number of chunks a shared scan buffers for its slower scans, a scan falling further behind reads the
+// rest of its rows by itself.
+CONF_mInt32(shared_scan_window_chunks, "16");
 
 // hdfs hedged read
 CONF_Bool(hdfs_client_enable_hedged_read, "false");
@@ -865,6 +1082,15 @@ CONF_Int32(hdfs_client_hedged_read_threadpool_size, "128");
 CONF_Int32(hdfs_client_hedged_read_threshold_millis, "2500");
 CONF_Int32(hdfs_client_max_cache_size, "64");
 CONF_Int32(hdfs_client_io_read_retry, "0");
+// hdfs short-circuit local read, which reads the blocks of the co-located DataNode from the local disk through
+// the unix domain socket at hdfs_client_domain_socket_path (dfs.domain.socket.path), it must be the same as the
+// one of the DataNode.
+CONF_Bool(hdfs_client_enable_short_circuit_read, "false");
+CONF_String(hdfs_client_domain_socket_path, "");
+// dfs.client.socketcache.capacity and dfs.client.socketcache.expiryMsec, the DataNode connections cached by the
+// hdfs client are reused by the following reads of the same or other files. Negative means the hadoop default.
+CONF_Int32(hdfs_client_socket_cache_capacity, "-1");
+CONF_Int32(hdfs_client_socket_cache_expiry_ms, "-1");
 
 // Enable output trace logs in aws-sdk-cpp for diagnosis purpose.
 // Once logging is enabled in your application, the SDK will generate log files in your current working directory
@@ -886,6 +1112,28 @@ CONF_mInt64(experimental_s3_max_single_part_size, "16777216");
 // default: 16MB
 CONF_mInt64(experimental_s3_min_upload_part_size, "16777216");
 
+// The reads of S3InputStream not smaller than s3_parallel_read_min_size are split into ranged GETs of
+// s3_read_part_size issued in parallel. 0 means never split.
+CONF_mInt64(s3_parallel_read_min_size, "16777216");
+CONF_mInt64(s3_read_part_size, "4194304");
+// If true, a duplicate GET is fired when a GET of S3InputStream has not finished within the p95 latency
+// of the recent GETs to the same bucket, and the data of whichever finishes first is used.
+CONF_mBool(enable_s3_hedged_read, "true");
+// The duplicate GET is fired no earlier than this after the first one.
+CONF_mInt64(s3_hedged_read_min_delay_ms, "20");
+// If true, the remote requests of every scan, i.e. the GETs of S3, the reads of starlet files and the reads served
+// by the data cache, are summarized by request size and latency in the runtime profile of the scan.
+CONF_mBool(enable_remote_io_trace, "true");
+// The max number of threads issuing the parallel and hedged GETs of S3InputStream.
+CONF_Int32(s3_read_max_threads, "64");
+// The max number of parts of a multipart upload of S3OutputStream being uploaded concurrently,
+// 1 means uploading the parts one by one in the writing thread.
+CONF_mInt32(s3_upload_max_inflight_parts, "4");
+// The max number of threads uploading the parts of S3OutputStream.
+CONF_Int32(s3_upload_max_threads, "64");
+// The max bytes of the part buffers of S3OutputStream cached for reuse by other streams.
+CONF_mInt64(s3_upload_buffer_pool_max_bytes, "268435456");
+
 CONF_Int64(max_load_dop, "16");
 
 CONF_Bool(enable_load_colocate_mv, "true");
@@ -902,6 +1150,10 @@ CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
 // if runtime filter size is larger than send_runtime_filter_via_http_rpc_min_size, be will transmit runtime filter via http protocol.
 // this is a default value, maybe changed by global_runtime_filter_rpc_http_min_size in session variable.
 CONF_Int64(send_runtime_filter_via_http_rpc_min_size, "67108864");
+// The merged global bloom filter is folded into fewer buckets as long as its estimated false positive rate
+// stays under this value, which shrinks the filters of over-estimated build sides before they are sent.
+// 0 disables folding. Only enable it when all the BEs support folded bloom filters.
+CONF_mDouble(runtime_filter_bloom_fold_max_fpp, "0");
 
 CONF_Int64(rpc_connect_timeout_ms, "30000");
 
@@ -959,10 +1211,21 @@ CONF_mInt32(starlet_delete_files_max_key_in_batch, "1000");
 #endif
 
 CONF_mInt64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
+// The number of threads used to fetch the tablet metadata of a batch of tablets in parallel, e.g., all the
+// tablets of a scan, and to prefetch tablet metadata in background. Set to 0 to fetch them one by one.
+CONF_Int32(lake_metadata_fetch_thread_num, "16");
+// The max number of tablet metadata being prefetched in background, more prefetches are dropped.
+CONF_mInt32(lake_metadata_max_pending_prefetches, "1024");
 CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
 CONF_mInt32(lake_compaction_check_valid_interval_minutes, "30"); // 30 minutes
+// Whether the vertical compaction of lake tables puts the columns usually read together by scans into the same
+// column groups, so that they are contiguous in the output segments and a scan reads fewer, larger ranges.
+CONF_mBool(enable_lake_column_access_layout, "true");
+// A set of columns read together is laid out together if it is read by at least this ratio of the scans
+// recorded for the table.
+CONF_mDouble(lake_column_access_hot_set_min_ratio, "0.05");
 // Used to ensure service availability in extreme situations by sacrificing a certain degree of correctness
 CONF_mBool(experimental_lake_ignore_lost_segment, "false");
 CONF_mInt64(experimental_lake_wait_per_put_ms, "0");
@@ -984,6 +1247,9 @@ CONF_mInt32(lake_pk_preload_memory_limit_percent, "30");
 CONF_mInt32(lake_pk_index_sst_min_compaction_versions, "2");
 CONF_mInt32(lake_pk_index_sst_max_compaction_bytes, /*1GB*/ "1073741824");
 CONF_Int32(lake_pk_index_block_cache_limit_percent, "10");
+// The bits per key of the bloom filter of a new persistent index sstable, 10 bits gives a false positive rate
+// of about 1%, 16 bits about 0.05%. The filters of opened sstables are kept in metacache.
+CONF_mInt32(lake_pk_index_sst_bloom_filter_bits_per_key, "10");
 
 CONF_mBool(dependency_librdkafka_debug_enable, "false");
 
@@ -1011,6 +1277,13 @@ CONF_Int16(jdbc_minimum_idle_connections, "1");
 // The minimum allowed value is 10000(10 seconds).
 CONF_Int32(jdbc_connection_idle_timeout_ms, "600000");
 
+// The memory of the rows buffered by a state table of the stream engine, beyond which they are spilled into a
+// sorted run on the local disk.
+CONF_mInt64(stream_state_table_mem_limit_bytes, "67108864");
+// A state table of the stream engine merges its sorted runs into one when there are more than this.
+CONF_mInt32(stream_state_table_max_sorted_runs, "8");
+// The capacity of the cache of the hot keys read back from the sorted runs of a state table of the stream engine.
+CONF_mInt64(stream_state_table_hot_key_cache_bytes, "16777216");
 // spill dirs
 CONF_String(spill_local_storage_dir, "${STARROCKS_HOME}/spill");
 // when spill occurs, whether enable skip synchronous flush
@@ -1028,6 +1301,20 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 // be the same with storage path. Spill will return with error when used size has exceeded
 // the limit.
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
+// Whether SPILL_BY_COLUMN spills compress every column with LZ4 or ZSTD, picked per column by
+// the measured compression ratio. It trades spill CPU for less spill IO.
+CONF_mBool(spill_enable_column_compression, "false");
+// Size of the read-ahead buffer of each spill block reader, restore reads smaller than it are served from
+// one large sequential read. 0 means reading the block directly.
+CONF_mInt64(spill_read_ahead_bytes, "1048576");
+// When the process memory exceeds this ratio of the process limit, the spillable operators of queries with
+// spill enabled are asked to spill, the ones holding the most revocable memory first, instead of letting the
+// process hit its limit and cancel queries. A value <= 0 or >= 1 disables it.
+CONF_mDouble(spill_process_mem_soft_limit_ratio, "0.9");
+// With spill enabled, the chunks buffered by a multicast local exchanger for its lagging consumers are spilled
+// once they take more than this. The blocks are written by the sink driver and read back by the source drivers
+// synchronously, on the pipeline threads. 0, the default, means never spilling them.
+CONF_mInt64(multi_cast_local_exchange_spill_bytes, "0");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
 
@@ -1073,6 +1360,19 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// If true, the scan ranges of external tables whose first blocks are in the datacache are scanned
+// before the others, so that they don't wait behind the scan ranges reading from remote storage.
+CONF_mBool(datacache_cache_aware_scan_schedule, "true");
+// A missed block is populated to datacache only if it has been missed at least this many times recently,
+// estimated by a frequency sketch, so that the blocks read only once don't evict the hot ones.
+// Set it to 1 to populate every missed block.
+CONF_mInt32(datacache_populate_admission_min_frequency, "2");
+// If true, the missed blocks are copied and written to datacache by background threads, so that the scan
+// threads don't wait for the cache writes. The blocks are skipped if the pending bytes exceed
+// `datacache_populate_max_pending_bytes`.
+CONF_mBool(datacache_background_populate_enable, "true");
+CONF_Int32(datacache_populate_threads, "4");
+CONF_mInt64(datacache_populate_max_pending_bytes, "268435456"); // 256MB
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1164,9 +1464,30 @@ CONF_mBool(enable_pindex_rebuild_in_compaction, "true");
 
 // enable read pindex by page
 CONF_mBool(enable_pindex_read_by_page, "false");
+// When reading pindex by page, the consecutive pages probed by a batch of keys are merged into one read of at
+// most this many bytes.
+CONF_mInt64(pindex_read_by_page_max_merge_bytes, "1048576");
+// The capacity of the cache of primary key table rows for point lookups, 0 disables the cache.
+CONF_Int64(row_cache_capacity, "0");
+// The concurrent point lookups of the same tablet version arrived within this many microseconds are coalesced into
+// one primary index probe and one column read. 0 disables the coalescing.
+CONF_mInt32(short_circuit_multi_get_batch_window_us, "0");
+// The max number of keys in a coalesced point lookup.
+CONF_mInt32(short_circuit_multi_get_batch_max_keys, "4096");
 
 // Used by query cache, cache entries are evicted when it exceeds its capacity(500MB in default)
 CONF_Int64(query_cache_capacity, "536870912");
+// Whether the query cache keeps a copy of its entries in the disk space of the block cache. An entry evicted from
+// memory or lost by a BE restart is loaded back from disk in the background when it is probed again.
+CONF_Bool(query_cache_enable_disk_tier, "false");
+// The max number of query cache entries waiting to be written to or loaded from the disk tier.
+CONF_Int32(query_cache_disk_tier_max_pending_tasks, "1024");
+
+// Whether the blocking aggregations remember the final sizes of their hash tables, and reserve the hash tables
+// by them when the same plan runs again.
+CONF_mBool(enable_hash_table_size_hints, "true");
+// The max number of the hash table size hints kept in the BE.
+CONF_Int64(hash_table_size_hints_capacity, "100000");
 
 // When query cache enabled, the operators in the drivers contains cache operator are multilane
 // operators, if the number of lanes is big, Fragment Instance would spend too much time to prepare
@@ -1177,6 +1498,11 @@ CONF_mInt32(query_cache_num_lanes_per_driver, "4");
 // Used to limit buffer size of tablet send channel.
 CONF_mInt64(send_channel_buffer_limit, "67108864");
 
+// The target size of the chunk sent by one tablet sink request. Chunks of narrow rows keep coalescing
+// beyond chunk_size rows until they reach this size, so that fewer and larger rpcs are sent.
+// 0 means sending a request every chunk_size rows.
+CONF_mInt64(tablet_sink_chunk_target_bytes, "1048576");
+
 // exception_stack_level controls when to print exception's stack
 // -1, enable print all exceptions' stack
 // 0, disable print exceptions' stack
@@ -1197,10 +1523,21 @@ CONF_String(rocksdb_db_options_string, "create_if_missing=true;create_missing_co
 
 // limit local exchange buffer's memory size per driver
 CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
+// A colocate execution group runs fewer buckets concurrently when the memory its active buckets are observed to use
+// would exceed this ratio of the query memory limit. A value <= 0 keeps running one bucket per driver.
+CONF_mDouble(group_execution_bucket_mem_limit_ratio, "0.8");
 // only used for test. default: 128M
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
+// The streaming pre-aggregation in auto mode aggregates a chunk by the runs of adjacent rows with the same group by
+// keys instead of the hash table, if the runs are at least this long on average, e.g. for input scanned in the order
+// of the sort key of the table. Looking for the runs costs a comparison of the keys of every chunk that is not
+// aggregated this way, so 0, the default, disables it.
+CONF_mInt32(streaming_agg_sorted_run_min_avg_length, "0");
+// The streaming pre-aggregation directly over a colocated scan aggregates the scan output bucket by bucket, if its
+// group by keys cover the bucket columns, so that a hash table only holds the groups of one bucket at a time.
+CONF_mBool(enable_streaming_agg_per_bucket, "false");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
 
 // Max size of a binlog file. The default is 512MB.
@@ -1222,6 +1559,11 @@ CONF_mBool(enable_pk_value_column_zonemap, "true");
 CONF_Double(default_mv_resource_group_memory_limit, "0.8");
 CONF_Int32(default_mv_resource_group_cpu_limit, "1");
 
+// The I/O bandwidth (bytes per second) of scan and spill tasks shared by all the resource groups of a BE.
+// Each resource group gets a share proportional to its cpu_limit, and its I/O tasks are not scheduled
+// once the share is used up. 0 means unlimited.
+CONF_mInt64(resource_group_io_bytes_per_second_limit, "0");
+
 // Max size of key columns size of primary key table, default value is 128 bytes
 CONF_mInt32(primary_key_limit_size, "128");
 
@@ -1235,6 +1577,13 @@ CONF_mBool(enable_short_key_for_one_column_filter, "false");
 
 CONF_mBool(enable_index_segment_level_zonemap_filter, "true");
 CONF_mBool(enable_index_page_level_zonemap_filter, "true");
+// Keep the segment-level zone maps of the segments written into lake tablets in the rowset
+// metadata, so that a query can prune the segments whose zone maps can not satisfy its predicates
+// without opening them.
+CONF_mBool(lake_enable_rowset_segment_zone_map, "false");
+// Skip the frames of FOR-encoded pages whose value bounds can not satisfy the predicates,
+// before decoding any column of the rows in them.
+CONF_mBool(enable_index_page_bounds_filter, "true");
 CONF_mBool(enable_index_bloom_filter, "true");
 CONF_mBool(enable_index_bitmap_filter, "true");
 
@@ -1253,6 +1602,8 @@ CONF_mBool(enable_drop_tablet_if_unfinished_txn, "true");
 CONF_Int32(lake_service_max_concurrency, "0");
 
 CONF_mInt64(lake_vacuum_min_batch_delete_size, "100");
+// The max number of batch delete requests of a vacuum task being executed at the same time.
+CONF_mInt64(lake_vacuum_max_concurrent_delete_batches, "4");
 
 // TOPN RuntimeFilter parameters
 CONF_mInt32(desc_hint_split_range, "10");
@@ -1280,12 +1631,24 @@ CONF_mInt32(json_flat_internal_column_min_limit, "5");
 // the maximum number of extracted JSON sub-field
 CONF_mInt32(json_flat_column_max, "20");
 
+// the maximum number of JSON sub-field paths whose query accesses are tracked, the tracked paths are preferred
+// when choosing the sub-fields to extract. 0 means disable the tracking.
+CONF_mInt32(json_flat_hot_path_capacity, "1024");
+
 // Allowable intervals for continuous generation of pk dumps
 // Disable when pk_dump_interval_seconds <= 0
 CONF_mInt64(pk_dump_interval_seconds, "3600"); // 1 hour
 
 // Min data processed when scaling connector sink writers, default value is the same as Trino
 CONF_mInt64(writer_scaling_min_size_mb, "128");
+// The max number of partition file writers kept open by one hive/iceberg/file sink driver, the least recently
+// written one is committed when a new partition exceeds it. 0 means unlimited.
+CONF_mInt32(connector_sink_max_open_partition_writers, "128");
+
+// The capacity in bytes of the cache of iceberg position delete files, which keeps the deleted positions of every
+// data file referred by a delete file, so that a delete file is read once rather than once per data file and
+// query. 0 means disable the cache.
+CONF_Int64(iceberg_position_delete_cache_capacity, "268435456");
 
 // whether enable query profile for queries initiated by spark or flink
 CONF_mBool(enable_profile_for_external_plan, "false");
@@ -1295,12 +1658,30 @@ CONF_mInt32(olap_string_max_length, "1048576");
 
 // Skip get from pk index when light pk compaction publish is enabled
 CONF_mBool(enable_light_pk_compaction_publish, "true");
+// The max number of rows of an output segment whose primary keys are replaced in the pk index in one batch, when
+// resolving the conflicts of a light pk compaction publish.
+CONF_mInt32(pk_compaction_index_replace_batch_rows, "131072");
 
 // jit LRU cache size for total 32 shards, it will be an auto value if it <=0:
 // mem_limit = system memory or process memory limit if set.
 // if mem_limit < 16 GB, disable JIT.
 // else it = min(mem_limit*0.01, 1GB)
 CONF_mInt64(jit_lru_cache_size, "0");
+// With adaptive JIT (jit_level = 1), an expression that is not in the JIT cache yet is interpreted
+// until it has been prepared this many times, so one-off queries don't pay for the compilation.
+// <= 1 compiles an expression the first time it is seen.
+CONF_mInt32(jit_compile_hot_threshold, "3");
+
+// The max number of compiled hyperscan databases of constant LIKE/REGEXP patterns cached by the process,
+// <= 0 disables the cache.
+CONF_mInt32(hyperscan_database_cache_capacity, "1024");
+
+// Evaluate the deterministic subexpressions that occur more than once in an expression tree only once per chunk.
+CONF_mBool(enable_expr_common_sub_expr_reuse, "true");
+
+// The distinct state of multi_distinct_count/multi_distinct_sum on INT/BIGINT columns is switched from a hash set
+// to a roaring bitmap once it holds this many values and they are dense enough. <= 0 disables the switching.
+CONF_mInt64(distinct_agg_bitmap_switch_threshold, "65536");
 
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
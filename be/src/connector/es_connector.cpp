@@ -46,6 +46,38 @@ const TupleDescriptor* ESDataSourceProvider::tuple_descriptor(RuntimeState* stat
     return state->desc_tbl().get_tuple_descriptor(_es_scan_node.tuple_id);
 }
 
+StatusOr<pipeline::MorselQueuePtr> ESDataSourceProvider::convert_scan_range_to_morsel_queue(
+        const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+        bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+        size_t num_total_scan_ranges) {
+    // Split each shard into sliced scrolls, only to keep the drivers busy which would be idle otherwise.
+    int32_t num_slices = 1;
+    if (!scan_ranges.empty()) {
+        const auto num_shards = static_cast<int32_t>(scan_ranges.size());
+        num_slices = std::min(config::es_scroll_max_slices_per_shard, (pipeline_dop + num_shards - 1) / num_shards);
+    }
+    if (num_slices <= 1) {
+        return DataSourceProvider::convert_scan_range_to_morsel_queue(scan_ranges, node_id, pipeline_dop,
+                                                                      enable_tablet_internal_parallel,
+                                                                      tablet_internal_parallel_mode,
+                                                                      num_total_scan_ranges);
+    }
+
+    std::vector<TScanRangeParams> sliced_scan_ranges;
+    sliced_scan_ranges.reserve(scan_ranges.size() * num_slices);
+    for (const auto& scan_range : scan_ranges) {
+        for (int32_t slice_id = 0; slice_id < num_slices; slice_id++) {
+            auto& sliced_scan_range = sliced_scan_ranges.emplace_back(scan_range);
+            sliced_scan_range.scan_range.es_scan_range.__set_slice_id(slice_id);
+            sliced_scan_range.scan_range.es_scan_range.__set_num_slices(num_slices);
+        }
+    }
+    return DataSourceProvider::convert_scan_range_to_morsel_queue(sliced_scan_ranges, node_id, pipeline_dop,
+                                                                  enable_tablet_internal_parallel,
+                                                                  tablet_internal_parallel_mode,
+                                                                  num_total_scan_ranges);
+}
+
 // ================================
 
 ESDataSource::ESDataSource(const ESDataSourceProvider* provider, const TScanRange& scan_range)
@@ -199,12 +231,18 @@ Status ESDataSource::_create_scanner() {
         _properties[ESScanReader::KEY_TYPE] = es_scan_range.type;
     }
     _properties[ESScanReader::KEY_SHARD] = std::to_string(es_scan_range.shard_id);
+    const bool sliced = es_scan_range.__isset.num_slices && es_scan_range.num_slices > 1;
+    if (sliced) {
+        _properties[ESScanReader::KEY_SLICE_ID] = std::to_string(es_scan_range.slice_id);
+        _properties[ESScanReader::KEY_NUM_SLICES] = std::to_string(es_scan_range.num_slices);
+    }
     _properties[ESScanReader::KEY_BATCH_SIZE] =
             std::to_string(std::min(config::es_index_max_result_window, _runtime_state->chunk_size()));
     _properties[ESScanReader::KEY_HOST_PORT] = get_host_port(es_scan_range.es_hosts);
     // push down limit to Elasticsearch
     // if have conjunct ES can not process, then must not push down limit operator
-    if (_conjunct_ctxs.size() == 0 && _read_limit != -1 && _read_limit <= _runtime_state->chunk_size()) {
+    // the limited search is not sliced, so a sliced shard doesn't push down limit either
+    if (!sliced && _conjunct_ctxs.size() == 0 && _read_limit != -1 && _read_limit <= _runtime_state->chunk_size()) {
         _properties[ESScanReader::KEY_TERMINATE_AFTER] = std::to_string(_read_limit);
     }
 
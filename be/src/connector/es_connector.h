@@ -47,6 +47,13 @@ public:
 
     const TupleDescriptor* tuple_descriptor(RuntimeState* state) const override;
 
+    // Split a shard into at most es_scroll_max_slices_per_shard sliced scrolls, when there are fewer shards
+    // than the pipeline dop.
+    StatusOr<pipeline::MorselQueuePtr> convert_scan_range_to_morsel_queue(
+            const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+            bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+            size_t num_total_scan_ranges) override;
+
 protected:
     ConnectorScanNode* _scan_node;
     const TEsScanNode _es_scan_node;
@@ -17,6 +17,7 @@
 #include <future>
 
 #include "column/datum.h"
+#include "common/config.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exprs/expr.h"
 #include "formats/csv/csv_file_writer.h"
@@ -38,7 +39,8 @@ FileChunkSink::FileChunkSink(std::vector<std::string> partition_columns,
           _location_provider(std::move(location_provider)),
           _file_writer_factory(std::move(file_writer_factory)),
           _max_file_size(max_file_size),
-          _state(state) {}
+          _state(state),
+          _partition_writers(std::max(config::connector_sink_max_open_partition_writers, 0)) {}
 
 Status FileChunkSink::init() {
     RETURN_IF_ERROR(ColumnEvaluator::init(_partition_column_evaluators));
@@ -62,10 +64,7 @@ StatusOr<ConnectorChunkSink::Futures> FileChunkSink::add(ChunkPtr chunk) {
 
 ConnectorChunkSink::Futures FileChunkSink::finish() {
     Futures futures;
-    for (auto& [_, writer] : _partition_writers) {
-        auto f = writer->commit();
-        futures.commit_file_futures.push_back(std::move(f));
-    }
+    _partition_writers.commit_all(&futures);
     return futures;
 }
 
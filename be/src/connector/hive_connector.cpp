@@ -16,6 +16,8 @@
 
 #include <filesystem>
 
+#include "block_cache/block_cache.h"
+#include "block_cache/datacache_utils.h"
 #include "exec/exec_node.h"
 #include "exec/hdfs_scanner_orc.h"
 #include "exec/hdfs_scanner_parquet.h"
@@ -41,9 +43,86 @@ std::unique_ptr<ConnectorChunkSinkProvider> HiveConnector::create_data_sink_prov
 
 // ================================
 
+static StatusOr<std::string> get_native_file_path(const HiveTableDescriptor* hive_table,
+                                                  const THdfsScanRange& scan_range) {
+    std::string native_file_path = scan_range.full_path;
+    if (hive_table != nullptr && hive_table->has_partition() && !hive_table->has_base_path()) {
+        auto* partition_desc = hive_table->get_partition(scan_range.partition_id);
+        if (partition_desc == nullptr) {
+            return Status::InternalError(fmt::format(
+                    "Plan inconsistency. scan_range.partition_id = {} not found in partition description map",
+                    scan_range.partition_id));
+        }
+        std::filesystem::path file_path(partition_desc->location());
+        file_path /= scan_range.relative_path;
+        native_file_path = file_path.native();
+    }
+    if (native_file_path.empty() && hive_table != nullptr) {
+        native_file_path = hive_table->get_base_path() + scan_range.relative_path;
+    }
+    return native_file_path;
+}
+
 HiveDataSourceProvider::HiveDataSourceProvider(ConnectorScanNode* scan_node, const TPlanNode& plan_node)
         : _scan_node(scan_node), _hdfs_scan_node(plan_node.hdfs_scan_node) {}
 
+Status HiveDataSourceProvider::init(ObjectPool* pool, RuntimeState* state) {
+    RETURN_IF_ERROR(DataSourceProvider::init(pool, state));
+    const auto* tuple_desc = tuple_descriptor(state);
+    if (tuple_desc != nullptr) {
+        _hive_table = dynamic_cast<const HiveTableDescriptor*>(tuple_desc->table_desc());
+    }
+    _cache_aware_scan_schedule = config::datacache_enable && config::datacache_cache_aware_scan_schedule;
+    if (state->query_options().__isset.enable_scan_datacache) {
+        _cache_aware_scan_schedule &= state->query_options().enable_scan_datacache;
+    }
+    return Status::OK();
+}
+
+bool HiveDataSourceProvider::_is_scan_range_cached(const THdfsScanRange& scan_range) const {
+    auto* cache = BlockCache::instance();
+    if (scan_range.file_length == 0 || !cache->is_initialized()) {
+        return false;
+    }
+    auto path_or = get_native_file_path(_hive_table, scan_range);
+    if (!path_or.ok() || path_or->empty()) {
+        return false;
+    }
+    auto cache_key = DataCacheUtils::calc_cache_key(*path_or, scan_range.file_length, scan_range.modification_time);
+    return cache->exist(cache_key, scan_range.offset);
+}
+
+StatusOr<pipeline::MorselQueuePtr> HiveDataSourceProvider::convert_scan_range_to_morsel_queue(
+        const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+        bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+        size_t num_total_scan_ranges) {
+    if (!_cache_aware_scan_schedule || scan_ranges.size() <= 1) {
+        return DataSourceProvider::convert_scan_range_to_morsel_queue(scan_ranges, node_id, pipeline_dop,
+                                                                      enable_tablet_internal_parallel,
+                                                                      tablet_internal_parallel_mode,
+                                                                      num_total_scan_ranges);
+    }
+    // The morsels are taken in order, so the cached ones are scanned without waiting behind the uncached
+    // ones. The original order is kept within each of them.
+    std::vector<TScanRangeParams> ordered_scan_ranges;
+    ordered_scan_ranges.reserve(scan_ranges.size());
+    std::vector<const TScanRangeParams*> uncached_scan_ranges;
+    for (const auto& scan_range : scan_ranges) {
+        if (scan_range.scan_range.__isset.hdfs_scan_range &&
+            _is_scan_range_cached(scan_range.scan_range.hdfs_scan_range)) {
+            ordered_scan_ranges.emplace_back(scan_range);
+        } else {
+            uncached_scan_ranges.emplace_back(&scan_range);
+        }
+    }
+    for (const auto* scan_range : uncached_scan_ranges) {
+        ordered_scan_ranges.emplace_back(*scan_range);
+    }
+    return DataSourceProvider::convert_scan_range_to_morsel_queue(ordered_scan_ranges, node_id, pipeline_dop,
+                                                                  enable_tablet_internal_parallel,
+                                                                  tablet_internal_parallel_mode, num_total_scan_ranges);
+}
+
 DataSourcePtr HiveDataSourceProvider::create_data_source(const TScanRange& scan_range) {
     return std::make_unique<HiveDataSource>(this, scan_range);
 }
@@ -214,16 +293,48 @@ Status HiveDataSource::_init_partition_values() {
 
     if (_enable_dynamic_prune_scan_range && _runtime_filters) {
         _init_rf_counters();
+        _num_partition_evaluated_rfs = _num_arrived_runtime_filters();
         _runtime_filters->evaluate_partial_chunk(partition_chunk.get(), runtime_bloom_filter_eval_context);
         if (!partition_chunk->has_rows()) {
             _filter_by_eval_partition_conjuncts = true;
             return Status::OK();
         }
+        if (_num_partition_evaluated_rfs < _runtime_filters->size()) {
+            _partition_chunk = std::move(partition_chunk);
+        }
     }
 
     return Status::OK();
 }
 
+size_t HiveDataSource::_num_arrived_runtime_filters() const {
+    size_t num_arrived = 0;
+    for (const auto& [_, rf_desc] : _runtime_filters->descriptors()) {
+        if (rf_desc->runtime_filter(runtime_bloom_filter_eval_context.driver_sequence) != nullptr) {
+            num_arrived++;
+        }
+    }
+    return num_arrived;
+}
+
+bool HiveDataSource::_prune_partition_by_late_runtime_filters() {
+    const size_t num_arrived = _num_arrived_runtime_filters();
+    if (num_arrived <= _num_partition_evaluated_rfs) {
+        return false;
+    }
+    _num_partition_evaluated_rfs = num_arrived;
+    // The partition chunk is filtered in place, it has one row until it is pruned.
+    _runtime_filters->evaluate_partial_chunk(_partition_chunk.get(), runtime_bloom_filter_eval_context);
+    if (!_partition_chunk->has_rows()) {
+        COUNTER_UPDATE(_late_rf_pruned_scan_ranges, 1);
+        return true;
+    }
+    if (num_arrived == _runtime_filters->size()) {
+        _partition_chunk.reset();
+    }
+    return false;
+}
+
 int32_t HiveDataSource::scan_range_indicate_const_column_index(SlotId id) const {
     if (!_scan_range.__isset.identity_partition_slot_ids) {
         return -1;
@@ -481,6 +592,7 @@ void HiveDataSource::_init_rf_counters() {
                 ADD_CHILD_COUNTER(root, "JoinRuntimeFilterOutputScanRanges", TUnit::UNIT, prefix);
         runtime_bloom_filter_eval_context.join_runtime_filter_eval_counter =
                 ADD_CHILD_COUNTER(root, "JoinRuntimeFilterEvaluate", TUnit::UNIT, prefix);
+        _late_rf_pruned_scan_ranges = ADD_CHILD_COUNTER(root, "LateRuntimeFilterPrunedScanRanges", TUnit::UNIT, prefix);
     }
 }
 
@@ -488,21 +600,7 @@ Status HiveDataSource::_init_scanner(RuntimeState* state) {
     SCOPED_TIMER(_profile.open_file_timer);
 
     const auto& scan_range = _scan_range;
-    std::string native_file_path = scan_range.full_path;
-    if (_hive_table != nullptr && _hive_table->has_partition() && !_hive_table->has_base_path()) {
-        auto* partition_desc = _hive_table->get_partition(scan_range.partition_id);
-        if (partition_desc == nullptr) {
-            return Status::InternalError(fmt::format(
-                    "Plan inconsistency. scan_range.partition_id = {} not found in partition description map",
-                    scan_range.partition_id));
-        }
-        std::filesystem::path file_path(partition_desc->location());
-        file_path /= scan_range.relative_path;
-        native_file_path = file_path.native();
-    }
-    if (native_file_path.empty()) {
-        native_file_path = _hive_table->get_base_path() + scan_range.relative_path;
-    }
+    ASSIGN_OR_RETURN(auto native_file_path, get_native_file_path(_hive_table, scan_range));
 
     const auto& hdfs_scan_node = _provider->_hdfs_scan_node;
     auto fsOptions =
@@ -645,6 +743,10 @@ Status HiveDataSource::get_next(RuntimeState* state, ChunkPtr* chunk) {
     if (_no_data) {
         return Status::EndOfFile("no data");
     }
+    if (_partition_chunk != nullptr && _prune_partition_by_late_runtime_filters()) {
+        _no_data = true;
+        return Status::EndOfFile("pruned by runtime filters");
+    }
     _init_chunk(chunk, _runtime_state->chunk_size());
     do {
         RETURN_IF_ERROR(_scanner->get_next(state, chunk));
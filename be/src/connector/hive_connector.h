@@ -42,17 +42,29 @@ public:
     ~HiveDataSourceProvider() override = default;
     friend class HiveDataSource;
     HiveDataSourceProvider(ConnectorScanNode* scan_node, const TPlanNode& plan_node);
+    Status init(ObjectPool* pool, RuntimeState* state) override;
     DataSourcePtr create_data_source(const TScanRange& scan_range) override;
     const TupleDescriptor* tuple_descriptor(RuntimeState* state) const override;
 
     void peek_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) override;
     void default_data_source_mem_bytes(int64_t* min_value, int64_t* max_value) override;
 
+    // Put the scan ranges whose data is in the local datacache ahead of the others.
+    StatusOr<pipeline::MorselQueuePtr> convert_scan_range_to_morsel_queue(
+            const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+            bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+            size_t num_total_scan_ranges) override;
+
     friend class HiveDataSource;
 
 protected:
+    // Return whether the first block of |scan_range| is in the datacache.
+    bool _is_scan_range_cached(const THdfsScanRange& scan_range) const;
+
     ConnectorScanNode* _scan_node;
     const THdfsScanNode _hdfs_scan_node;
+    const HiveTableDescriptor* _hive_table = nullptr;
+    bool _cache_aware_scan_schedule = false;
     int64_t _max_file_length = 0;
     std::atomic<int32_t> _lazy_column_coalesce_counter = 0;
 };
@@ -96,6 +108,10 @@ private:
     void _init_rf_counters();
 
     Status _init_partition_values();
+    // Evaluate the runtime filters arrived after the scan range was opened on the partition values, return true if
+    // the partition is pruned by them, so that the rest of the file is skipped.
+    bool _prune_partition_by_late_runtime_filters();
+    size_t _num_arrived_runtime_filters() const;
     Status _init_scanner(RuntimeState* state);
     HdfsScanner* _create_hudi_jni_scanner(const FSOptions& options);
     HdfsScanner* _create_paimon_jni_scanner(const FSOptions& options);
@@ -138,6 +154,11 @@ private:
     bool _has_partition_conjuncts = false;
     bool _filter_by_eval_partition_conjuncts = false;
     bool _no_data = false;
+    // The partition values of the scan range and the number of runtime filters evaluated on them, it is
+    // re-evaluated when more runtime filters arrive.
+    ChunkPtr _partition_chunk;
+    size_t _num_partition_evaluated_rfs = 0;
+    RuntimeProfile::Counter* _late_rf_pruned_scan_ranges = nullptr;
 
     int _min_max_tuple_id = 0;
     const TupleDescriptor* _min_max_tuple_desc = nullptr;
@@ -18,6 +18,7 @@
 #include "exec/pipeline/fragment_context.h"
 #include "runtime/global_dict/parser.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/lake/column_access_stats.h"
 #include "storage/lake/tablet.h"
 #include "storage/olap_runtime_range_pruner.hpp"
 #include "storage/predicate_parser.h"
@@ -155,6 +156,8 @@ Status LakeDataSource::init_global_dicts(TabletReaderParams* params) {
     const TLakeScanNode& thrift_lake_scan_node = _provider->_t_lake_scan_node;
     const auto& global_dict_map = _runtime_state->get_query_global_dict_map();
     auto global_dict = _obj_pool.add(new ColumnIdToGlobalDictMap());
+    auto global_dict_versions = _obj_pool.add(new ColumnIdToGlobalDictVersion());
+    const auto& query_dict_versions = _runtime_state->query_dict_versions();
     // mapping column id to storage column ids
     const TupleDescriptor* tuple_desc = _runtime_state->desc_tbl().get_tuple_descriptor(thrift_lake_scan_node.tuple_id);
     for (auto slot : tuple_desc->slots()) {
@@ -167,9 +170,13 @@ Status LakeDataSource::init_global_dicts(TabletReaderParams* params) {
             int32_t index = _tablet_schema->field_index(slot->col_name());
             DCHECK(index >= 0);
             global_dict->emplace(index, const_cast<GlobalDictMap*>(&dict_map));
+            if (auto version = query_dict_versions.find(slot->id()); version != query_dict_versions.end()) {
+                global_dict_versions->emplace(index, version->second);
+            }
         }
     }
     params->global_dictmaps = global_dict;
+    params->global_dict_versions = global_dict_versions;
     return Status::OK();
 }
 
@@ -307,6 +314,7 @@ Status LakeDataSource::init_tablet_reader(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(init_unused_output_columns(thrift_lake_scan_node.unused_output_column_name));
     RETURN_IF_ERROR(init_scanner_columns(scanner_columns));
     RETURN_IF_ERROR(init_reader_params(_scanner_ranges, scanner_columns, reader_columns));
+    record_column_access(reader_columns);
 
     if (_split_context != nullptr) {
         auto split_context = down_cast<const pipeline::LakeSplitContext*>(_split_context);
@@ -349,6 +357,19 @@ Status LakeDataSource::init_tablet_reader(RuntimeState* runtime_state) {
     return Status::OK();
 }
 
+void LakeDataSource::record_column_access(const std::vector<uint32_t>& reader_columns) {
+    if (!config::enable_lake_column_access_layout || _tablet_schema->id() == TabletSchema::invalid_id()) {
+        return;
+    }
+    std::vector<ColumnUID> column_uids;
+    column_uids.reserve(reader_columns.size());
+    for (auto index : reader_columns) {
+        column_uids.emplace_back(_tablet_schema->column(index).unique_id());
+    }
+    lake::ColumnAccessStats::instance()->record(_tablet_schema->id(), _tablet_schema->num_columns(),
+                                                std::move(column_uids));
+}
+
 Status LakeDataSource::build_scan_range(RuntimeState* state) {
     // Get key_ranges and not_push_down_conjuncts from _conjuncts_manager.
     RETURN_IF_ERROR(_conjuncts_manager.get_key_ranges(&_key_ranges));
@@ -610,6 +631,24 @@ StatusOr<pipeline::MorselQueuePtr> LakeDataSourceProvider::convert_scan_range_to
         const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
         bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
         size_t num_total_scan_ranges) {
+    // Fetch the metadata of all the tablets at once, so that the checks below and the data sources hit the
+    // metacache instead of fetching them one by one. The errors are reported by the one who needs the metadata.
+    if (scan_ranges.size() > 1) {
+        std::vector<std::pair<int64_t, int64_t>> tablet_versions;
+        tablet_versions.reserve(scan_ranges.size());
+        for (const auto& scan_range : scan_ranges) {
+            const auto& internal_scan_range = scan_range.scan_range.internal_scan_range;
+            tablet_versions.emplace_back(internal_scan_range.tablet_id, std::stoll(internal_scan_range.version));
+        }
+#ifdef BE_TEST
+        auto* tablet_manager = _tablet_manager;
+#else
+        auto* tablet_manager = ExecEnv::GetInstance()->lake_tablet_manager();
+#endif
+        if (tablet_manager != nullptr) {
+            (void)tablet_manager->get_tablet_metadatas(tablet_versions);
+        }
+    }
     auto morsel_queue = DataSourceProvider::convert_scan_range_to_morsel_queue(
             scan_ranges, node_id, pipeline_dop, enable_tablet_internal_parallel, tablet_internal_parallel_mode,
             num_total_scan_ranges);
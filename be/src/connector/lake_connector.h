@@ -64,6 +64,8 @@ private:
     Status init_reader_params(const std::vector<OlapScanRange*>& key_ranges,
                               const std::vector<uint32_t>& scanner_columns, std::vector<uint32_t>& reader_columns);
     Status init_tablet_reader(RuntimeState* state);
+    // Records the columns read by this scan for the column layout of compaction, see lake::ColumnAccessStats.
+    void record_column_access(const std::vector<uint32_t>& reader_columns);
     Status build_scan_range(RuntimeState* state);
     void init_counter(RuntimeState* state);
     void update_realtime_counter(Chunk* chunk);
@@ -205,7 +207,7 @@ protected:
     const TLakeScanNode _t_lake_scan_node;
 
     // for ut
-    lake::TabletManager* _tablet_manager;
+    lake::TabletManager* _tablet_manager = nullptr;
 
 private:
     StatusOr<bool> _could_tablet_internal_parallel(const std::vector<TScanRangeParams>& scan_ranges,
@@ -15,9 +15,12 @@
 #include "connector/mysql_connector.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
+#include "exec/connector_scan_node.h"
 #include "exprs/expr.h"
 #include "exprs/in_const_predicate.hpp"
 #include "storage/chunk_helper.h"
+#include "util/string_parser.hpp"
 
 namespace starrocks::connector {
 #define APPLY_FOR_NUMERICAL_TYPE(M, APPEND_TO_SQL) \
@@ -46,17 +49,147 @@ MySQLDataSourceProvider::MySQLDataSourceProvider(ConnectorScanNode* scan_node, c
         : _scan_node(scan_node), _mysql_scan_node(plan_node.mysql_scan_node) {}
 
 DataSourcePtr MySQLDataSourceProvider::create_data_source(const TScanRange& scan_range) {
-    return std::make_unique<MySQLDataSource>(this, scan_range);
+    // A data source is created for each morsel, so each partition is read by exactly one of them.
+    return std::make_unique<MySQLDataSource>(this, scan_range, _next_partition.fetch_add(1));
 }
 
 const TupleDescriptor* MySQLDataSourceProvider::tuple_descriptor(RuntimeState* state) const {
     return state->desc_tbl().get_tuple_descriptor(_mysql_scan_node.tuple_id);
 }
 
+StatusOr<pipeline::MorselQueuePtr> MySQLDataSourceProvider::convert_scan_range_to_morsel_queue(
+        const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+        bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+        size_t num_total_scan_ranges) {
+    const int32_t num_partitions = std::min(config::mysql_scan_max_parallel_connections, pipeline_dop);
+    // A limited scan reads a few rows, which isn't worth more connections.
+    if (num_partitions <= 1 || _scan_node->limit() != -1) {
+        return DataSourceProvider::convert_scan_range_to_morsel_queue(scan_ranges, node_id, pipeline_dop,
+                                                                      enable_tablet_internal_parallel,
+                                                                      tablet_internal_parallel_mode,
+                                                                      num_total_scan_ranges);
+    }
+
+    _num_partitions = num_partitions;
+    pipeline::Morsels morsels;
+    for (int32_t i = 0; i < num_partitions; i++) {
+        morsels.emplace_back(std::make_unique<pipeline::ScanMorsel>(node_id, TScanRangeParams()));
+    }
+    return std::make_unique<pipeline::DynamicMorselQueue>(std::move(morsels));
+}
+
+// Run |sql| and collect the first column of the rows, a NULL value is collected as an empty string.
+static Status query_first_column(MysqlScanner* scanner, const std::string& sql, std::vector<std::string>* values) {
+    RETURN_IF_ERROR(scanner->query(sql));
+    // The rows of mysql_use_result() must be drained before the next query.
+    while (true) {
+        char** data = nullptr;
+        unsigned long* length = nullptr;
+        bool eos = false;
+        RETURN_IF_ERROR(scanner->get_next_row(&data, &length, &eos));
+        if (eos) {
+            return Status::OK();
+        }
+        for (int i = 0; i < scanner->field_num(); i++) {
+            values->emplace_back(data[i] == nullptr ? "" : std::string(data[i], length[i]));
+        }
+    }
+}
+
+Status MySQLDataSourceProvider::_init_partition_filters(MysqlScanner* scanner) const {
+    // The table name is quoted by backquotes.
+    std::string table = _mysql_scan_node.table_name;
+    if (table.size() >= 2 && table.front() == '`' && table.back() == '`') {
+        table = table.substr(1, table.size() - 2);
+    }
+
+    // The ranges of the leading column of the primary key are read by its index.
+    std::vector<std::string> keys;
+    RETURN_IF_ERROR(query_first_column(
+            scanner,
+            fmt::format("SELECT k.COLUMN_NAME FROM information_schema.KEY_COLUMN_USAGE k "
+                        "JOIN information_schema.COLUMNS c ON c.TABLE_SCHEMA = k.TABLE_SCHEMA "
+                        "AND c.TABLE_NAME = k.TABLE_NAME AND c.COLUMN_NAME = k.COLUMN_NAME "
+                        "WHERE k.TABLE_SCHEMA = DATABASE() AND k.TABLE_NAME = '{}' AND k.CONSTRAINT_NAME = 'PRIMARY' "
+                        "AND k.ORDINAL_POSITION = 1 AND c.DATA_TYPE IN ('tinyint', 'smallint', 'mediumint', 'int', "
+                        "'bigint') AND c.COLUMN_TYPE NOT LIKE '%unsigned%'",
+                        scanner->escape(table).to_string()),
+            &keys));
+    if (keys.size() != 1) {
+        return Status::OK();
+    }
+    const std::string column = fmt::format("`{}`", keys[0]);
+
+    std::vector<std::string> bounds;
+    RETURN_IF_ERROR(query_first_column(
+            scanner, fmt::format("SELECT MIN({}), MAX({}) FROM {}", column, column, _mysql_scan_node.table_name),
+            &bounds));
+    if (bounds.size() == 2) {
+        _partition_filters = _split_partition_filters(column, bounds[0], bounds[1], _num_partitions);
+    }
+    return Status::OK();
+}
+
+std::vector<std::string> MySQLDataSourceProvider::_split_partition_filters(const std::string& column,
+                                                                           const std::string& min_value,
+                                                                           const std::string& max_value,
+                                                                           int32_t num_partitions) {
+    // The bounds are NULL, read as empty strings, if the table is empty.
+    StringParser::ParseResult min_result;
+    StringParser::ParseResult max_result;
+    const auto min = StringParser::string_to_int<int64_t>(min_value.data(), min_value.size(), &min_result);
+    const auto max = StringParser::string_to_int<int64_t>(max_value.data(), max_value.size(), &max_result);
+    if (num_partitions <= 1 || min_result != StringParser::PARSE_SUCCESS ||
+        max_result != StringParser::PARSE_SUCCESS || min > max) {
+        return {};
+    }
+
+    // The splits are computed in 128 bits, since (max - min) * i overflows 64 bits for the full range of BIGINT.
+    std::vector<int64_t> splits;
+    for (int32_t i = 1; i < num_partitions; i++) {
+        const auto distance = static_cast<__int128>(max) - static_cast<__int128>(min);
+        splits.emplace_back(static_cast<int64_t>(min + distance * i / num_partitions));
+    }
+    // The first and the last ranges are unbounded, so every row falls into exactly one range, even if the table
+    // is changed after the bounds are read.
+    std::vector<std::string> filters;
+    for (int32_t i = 0; i < num_partitions; i++) {
+        if (i == 0) {
+            filters.emplace_back(fmt::format("{} < {}", column, splits[i]));
+        } else if (i == num_partitions - 1) {
+            filters.emplace_back(fmt::format("{} >= {}", column, splits[i - 1]));
+        } else {
+            filters.emplace_back(fmt::format("{} >= {} AND {} < {}", column, splits[i - 1], column, splits[i]));
+        }
+    }
+    return filters;
+}
+
+Status MySQLDataSourceProvider::_get_partition_filter(MysqlScanner* scanner, int32_t partition, std::string* filter,
+                                                      bool* skip) const {
+    std::lock_guard<std::mutex> l(_partition_mutex);
+    if (!_partition_filters_initialized) {
+        RETURN_IF_ERROR(_init_partition_filters(scanner));
+        _partition_filters_initialized = true;
+    }
+    if (partition < 0 || partition >= _num_partitions) {
+        // create_data_source() is expected to be called once per morsel.
+        return Status::InternalError(
+                fmt::format("mysql scan partition {} is out of {} partitions", partition, _num_partitions));
+    }
+    if (_partition_filters.empty()) {
+        *skip = partition != 0;
+    } else {
+        *filter = _partition_filters[partition];
+    }
+    return Status::OK();
+}
+
 // ================================
 
-MySQLDataSource::MySQLDataSource(const MySQLDataSourceProvider* provider, const TScanRange& scan_range)
-        : _provider(provider) {}
+MySQLDataSource::MySQLDataSource(const MySQLDataSourceProvider* provider, const TScanRange& scan_range,
+                                 int32_t partition)
+        : _provider(provider), _partition(partition) {}
 
 Status MySQLDataSource::_init_params(RuntimeState* state) {
     VLOG(1) << "MySQLDataSource::init mysql scan params";
@@ -101,6 +234,19 @@ Status MySQLDataSource::open(RuntimeState* state) {
     SCOPED_TIMER(_runtime_profile->total_time_counter());
     RETURN_IF_ERROR(_mysql_scanner->open());
 
+    if (_provider->_num_partitions > 1) {
+        std::string partition_filter;
+        bool skip = false;
+        RETURN_IF_ERROR(_provider->_get_partition_filter(_mysql_scanner.get(), _partition, &partition_filter, &skip));
+        if (skip) {
+            _is_finished = true;
+            return Status::OK();
+        }
+        if (!partition_filter.empty()) {
+            _filters.emplace_back(std::move(partition_filter));
+        }
+    }
+
     // Get [slot_id, slot] map
     std::unordered_map<SlotId, SlotDescriptor*> slot_by_id;
     for (SlotDescriptor* slot : _tuple_desc->slots()) {
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include "column/column.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
@@ -45,16 +48,40 @@ public:
     bool accept_empty_scan_ranges() const override { return false; }
     const TupleDescriptor* tuple_descriptor(RuntimeState* state) const override;
 
+    // Read the table by at most mysql_scan_max_parallel_connections connections, each of them reads a range of
+    // the integer primary key, rather than by a single one.
+    StatusOr<pipeline::MorselQueuePtr> convert_scan_range_to_morsel_queue(
+            const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+            bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+            size_t num_total_scan_ranges) override;
+
 protected:
+    // Get the filter of |partition|, which is empty if it reads all the rows. |skip| is set if it reads nothing,
+    // which happens if the table isn't partitioned by ranges and |partition| isn't the first one.
+    // The ranges are decided once by the connection of the first data source opened.
+    Status _get_partition_filter(MysqlScanner* scanner, int32_t partition, std::string* filter, bool* skip) const;
+    Status _init_partition_filters(MysqlScanner* scanner) const;
+    // The filters of |num_partitions| ranges of |column| split evenly between |min_value| and |max_value|, the
+    // bounds of the column read from the table. No filter is returned if the bounds aren't integers, e.g. they are
+    // empty because the table is empty.
+    static std::vector<std::string> _split_partition_filters(const std::string& column, const std::string& min_value,
+                                                             const std::string& max_value, int32_t num_partitions);
+
     ConnectorScanNode* _scan_node;
     const TMySQLScanNode _mysql_scan_node;
+
+    int32_t _num_partitions = 1;
+    std::atomic<int32_t> _next_partition = 0;
+    mutable std::mutex _partition_mutex;
+    mutable bool _partition_filters_initialized = false;
+    mutable std::vector<std::string> _partition_filters;
 };
 
 class MySQLDataSource final : public DataSource {
 public:
     ~MySQLDataSource() override = default;
 
-    MySQLDataSource(const MySQLDataSourceProvider* provider, const TScanRange& scan_range);
+    MySQLDataSource(const MySQLDataSourceProvider* provider, const TScanRange& scan_range, int32_t partition);
     std::string name() const override;
     Status open(RuntimeState* state) override;
     void close(RuntimeState* state) override;
@@ -67,6 +94,8 @@ public:
 
 private:
     const MySQLDataSourceProvider* _provider;
+    // The range of the table read by this data source, see MySQLDataSourceProvider::_get_partition_filter().
+    const int32_t _partition;
 
     // ============= init func =============
     Status _init_params(RuntimeState* state);
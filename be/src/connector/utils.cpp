@@ -112,30 +112,58 @@ StatusOr<std::string> HiveUtils::column_value(const TypeDescriptor& type_desc, c
 StatusOr<ConnectorChunkSink::Futures> HiveUtils::hive_style_partitioning_write_chunk(
         const ChunkPtr& chunk, bool partitioned, const std::string& partition, int64_t max_file_size,
         const formats::FileWriterFactory* file_writer_factory, LocationProvider* location_provider,
-        std::map<std::string, std::shared_ptr<formats::FileWriter>>& partition_writers) {
+        PartitionWriters& partition_writers) {
     ConnectorChunkSink::Futures futures;
-    auto it = partition_writers.find(partition);
-    if (it != partition_writers.end()) {
-        auto* writer = it->second.get();
-        if (writer->get_written_bytes() >= max_file_size) {
-            futures.commit_file_futures.push_back(writer->commit());
-            partition_writers.erase(it);
-            auto path = partitioned ? location_provider->get(partition) : location_provider->get();
-            ASSIGN_OR_RETURN(auto new_writer, file_writer_factory->create(path));
-            RETURN_IF_ERROR(new_writer->init());
-            futures.add_chunk_futures.push_back(new_writer->write(chunk));
-            partition_writers.emplace(partition, std::move(new_writer));
-        } else {
-            futures.add_chunk_futures.push_back(writer->write(chunk));
-        }
-    } else {
+    auto* writer = partition_writers.get(partition);
+    if (writer != nullptr && writer->get_written_bytes() >= max_file_size) {
+        partition_writers.commit(partition, &futures);
+        writer = nullptr;
+    }
+    if (writer == nullptr) {
         auto path = partitioned ? location_provider->get(partition) : location_provider->get();
         ASSIGN_OR_RETURN(auto new_writer, file_writer_factory->create(path));
         RETURN_IF_ERROR(new_writer->init());
-        futures.add_chunk_futures.push_back(new_writer->write(chunk));
-        partition_writers.emplace(partition, std::move(new_writer));
+        writer = new_writer.get();
+        partition_writers.put(partition, std::move(new_writer), &futures);
     }
+    futures.add_chunk_futures.push_back(writer->write(chunk));
     return futures;
 }
 
+formats::FileWriter* PartitionWriters::get(const std::string& partition) {
+    auto it = _index.find(partition);
+    if (it == _index.end()) {
+        return nullptr;
+    }
+    _writers.splice(_writers.begin(), _writers, it->second);
+    return it->second->second.get();
+}
+
+void PartitionWriters::put(const std::string& partition, std::shared_ptr<formats::FileWriter> writer,
+                           ConnectorChunkSink::Futures* futures) {
+    DCHECK(_index.find(partition) == _index.end());
+    _writers.emplace_front(partition, std::move(writer));
+    _index.emplace(partition, _writers.begin());
+    while (_max_open_writers > 0 && _writers.size() > _max_open_writers) {
+        commit(_writers.back().first, futures);
+        _num_evicted_writers++;
+    }
+}
+
+void PartitionWriters::commit(const std::string& partition, ConnectorChunkSink::Futures* futures) {
+    auto it = _index.find(partition);
+    DCHECK(it != _index.end());
+    futures->commit_file_futures.push_back(it->second->second->commit());
+    _writers.erase(it->second);
+    _index.erase(it);
+}
+
+void PartitionWriters::commit_all(ConnectorChunkSink::Futures* futures) {
+    for (auto& [_, writer] : _writers) {
+        futures->commit_file_futures.push_back(writer->commit());
+    }
+    _writers.clear();
+    _index.clear();
+}
+
 } // namespace starrocks::connector
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/statusor.h"
@@ -29,6 +31,40 @@ namespace starrocks::connector {
 
 class LocationProvider;
 
+// The open file writers of the partitions written by a connector sink, ordered by their last write. Every open
+// writer buffers a row group or stripe, so with high-cardinality partition keys the least recently written
+// writers are committed once there are more than |max_open_writers| of them, and a partition seen again later
+// goes on with a new file. 0 means unlimited.
+class PartitionWriters {
+public:
+    explicit PartitionWriters(size_t max_open_writers) : _max_open_writers(max_open_writers) {}
+
+    // Return nullptr if |partition| has no open writer, and mark it the most recently written otherwise.
+    formats::FileWriter* get(const std::string& partition);
+
+    // Add the new writer of |partition|, the commit futures of the evicted writers are appended to |futures|.
+    void put(const std::string& partition, std::shared_ptr<formats::FileWriter> writer,
+             ConnectorChunkSink::Futures* futures);
+
+    // Commit the writer of |partition| and append the future to |futures|.
+    void commit(const std::string& partition, ConnectorChunkSink::Futures* futures);
+
+    // Commit all the open writers and append the futures to |futures|.
+    void commit_all(ConnectorChunkSink::Futures* futures);
+
+    size_t size() const { return _writers.size(); }
+    int64_t num_evicted_writers() const { return _num_evicted_writers; }
+
+private:
+    using WriterList = std::list<std::pair<std::string, std::shared_ptr<formats::FileWriter>>>;
+
+    const size_t _max_open_writers;
+    // The most recently written one first.
+    WriterList _writers;
+    std::unordered_map<std::string, WriterList::iterator> _index;
+    int64_t _num_evicted_writers = 0;
+};
+
 class HiveUtils {
 public:
     static StatusOr<std::string> make_partition_name(
@@ -42,7 +78,7 @@ public:
     static StatusOr<ConnectorChunkSink::Futures> hive_style_partitioning_write_chunk(
             const ChunkPtr& chunk, bool partitioned, const std::string& partition, int64_t max_file_size,
             const formats::FileWriterFactory* file_writer_factory, LocationProvider* location_provider,
-            std::map<std::string, std::shared_ptr<formats::FileWriter>>& partition_writers);
+            PartitionWriters& partition_writers);
 
 private:
     static StatusOr<std::string> column_value(const TypeDescriptor& type_desc, const ColumnPtr& column);
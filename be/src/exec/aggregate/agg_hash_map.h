@@ -74,6 +74,8 @@ using FixedSize16SliceAggHashMap =
 // two level agg hash map
 template <PhmapSeed seed>
 using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+template <PhmapSeed seed>
+using Int64AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
 
 // The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
 // The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
@@ -186,7 +188,10 @@ struct AggHashMapWithOneNumberKeyWithNullable
             (*not_founds).assign(chunk_size, 0);
         }
 
-        if (bucket_count < prefetch_threhold) {
+        if (has_long_key_runs(column)) {
+            this->template compute_agg_by_runs<Func, allocate_and_compute_state, compute_not_founds>(
+                    column, agg_states, std::forward<Func>(allocate_func), not_founds);
+        } else if (bucket_count < prefetch_threhold) {
             this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                     column, agg_states, std::forward<Func>(allocate_func), not_founds);
         } else {
@@ -220,7 +225,10 @@ struct AggHashMapWithOneNumberKeyWithNullable
 
             // Shortcut: if nullable column has no nulls.
             if (!nullable_column->has_null()) {
-                if (this->hash_map.bucket_count() < prefetch_threhold) {
+                if (has_long_key_runs(data_column)) {
+                    this->template compute_agg_by_runs<Func, allocate_and_compute_state, compute_not_founds>(
+                            data_column, agg_states, std::forward<Func>(allocate_func), not_founds);
+                } else if (this->hash_map.bucket_count() < prefetch_threhold) {
                     this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                             data_column, agg_states, std::forward<Func>(allocate_func), not_founds);
                 } else {
@@ -234,6 +242,72 @@ struct AggHashMapWithOneNumberKeyWithNullable
         }
     }
 
+    // The keys of sorted input come in runs of equal values, e.g. a partition date repeated over the whole chunk.
+    // Such a chunk searches the hash map once per run instead of once per row.
+    static constexpr size_t kMinAverageKeyRunLength = 4;
+
+    static bool same_key(const FieldType& lhs, const FieldType& rhs) {
+        if constexpr (std::is_integral_v<FieldType>) {
+            return lhs == rhs;
+        } else {
+            // Compare the bits, so that the keys equal by value but hashed differently (e.g. 0.0 and -0.0) are
+            // still searched separately.
+            return memcmp(&lhs, &rhs, sizeof(FieldType)) == 0;
+        }
+    }
+
+    static bool has_long_key_runs(const ColumnType* column) {
+        const auto& data = column->get_data();
+        size_t num_rows = column->size();
+        size_t max_runs = num_rows / kMinAverageKeyRunLength;
+        size_t num_runs = 1;
+        for (size_t i = 1; i < num_rows; i++) {
+            num_runs += !same_key(data[i], data[i - 1]);
+            if (num_runs > max_runs) {
+                return false;
+            }
+        }
+        return num_rows > 0 && num_runs <= max_runs;
+    }
+
+    template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
+    ALWAYS_NOINLINE void compute_agg_by_runs(ColumnType* column, Buffer<AggDataPtr>* agg_states, Func&& allocate_func,
+                                             std::vector<uint8_t>* not_founds) {
+        const auto& data = column->get_data();
+        size_t num_rows = column->size();
+        size_t run_start = 0;
+        while (run_start < num_rows) {
+            FieldType key = data[run_start];
+            size_t run_end = run_start + 1;
+            while (run_end < num_rows && same_key(data[run_end], key)) {
+                run_end++;
+            }
+
+            AggDataPtr state = nullptr;
+            if constexpr (allocate_and_compute_state) {
+                auto iter = this->hash_map.lazy_emplace(key, [&](const auto& ctor) {
+                    if constexpr (compute_not_founds) {
+                        DCHECK(not_founds);
+                        (*not_founds)[run_start] = 1;
+                    }
+                    ctor(key, allocate_func(key));
+                });
+                state = iter->second;
+            } else if constexpr (compute_not_founds) {
+                DCHECK(not_founds);
+                if (auto iter = this->hash_map.find(key); iter != this->hash_map.end()) {
+                    state = iter->second;
+                } else {
+                    std::fill(not_founds->begin() + run_start, not_founds->begin() + run_end, 1);
+                }
+            }
+            if (state != nullptr) {
+                std::fill(agg_states->begin() + run_start, agg_states->begin() + run_end, state);
+            }
+            run_start = run_end;
+        }
+    }
+
     // prefetch branch better performance in case with larger hash tables
     template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
     ALWAYS_NOINLINE void compute_agg_prefetch(ColumnType* column, Buffer<AggDataPtr>* agg_states, Func&& allocate_func,
@@ -31,6 +31,10 @@ struct AggStatistics {
         input_row_count = ADD_COUNTER(runtime_profile, "InputRowCount", TUnit::UNIT);
         hash_table_size = ADD_COUNTER(runtime_profile, "HashTableSize", TUnit::UNIT);
         pass_through_row_count = ADD_COUNTER(runtime_profile, "PassThroughRowCount", TUnit::UNIT);
+        preagg_chunk_count = ADD_COUNTER(runtime_profile, "PreaggChunkCount", TUnit::UNIT);
+        pass_through_chunk_count = ADD_COUNTER(runtime_profile, "PassThroughChunkCount", TUnit::UNIT);
+        selective_preagg_chunk_count = ADD_COUNTER(runtime_profile, "SelectivePreaggChunkCount", TUnit::UNIT);
+        auto_state_switch_count = ADD_COUNTER(runtime_profile, "AutoStateSwitchCount", TUnit::UNIT);
         rows_returned_counter = ADD_COUNTER(runtime_profile, "RowsReturned", TUnit::UNIT);
         state_destroy_timer = ADD_TIMER(runtime_profile, "StateDestroy");
         allocate_state_timer = ADD_TIMER(runtime_profile, "StateAllocate");
@@ -61,6 +65,13 @@ struct AggStatistics {
     RuntimeProfile::Counter* group_by_append_timer{};
     // hash streaming aggregate pass through rows
     RuntimeProfile::Counter* pass_through_row_count{};
+    // streaming aggregate chunks which are pre-aggregated, passed through, or pre-aggregated only for the keys
+    // already in the hash table
+    RuntimeProfile::Counter* preagg_chunk_count{};
+    RuntimeProfile::Counter* pass_through_chunk_count{};
+    RuntimeProfile::Counter* selective_preagg_chunk_count{};
+    // times of the auto streaming aggregate switching between the modes
+    RuntimeProfile::Counter* auto_state_switch_count{};
     // timer for get input from hash table
     RuntimeProfile::Counter* expr_compute_timer{};
     // timer for result input from hash table
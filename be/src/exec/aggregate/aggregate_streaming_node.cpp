@@ -14,13 +14,18 @@
 
 #include "exec/aggregate/aggregate_streaming_node.h"
 
+#include <unordered_set>
 #include <variant>
 
+#include "exec/olap_scan_node.h"
 #include "exec/pipeline/aggregate/aggregate_streaming_sink_operator.h"
 #include "exec/pipeline/aggregate/aggregate_streaming_source_operator.h"
+#include "exec/pipeline/bucket_process_operator.h"
+#include "exec/pipeline/exchange/local_exchange_source_operator.h"
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/pipeline_builder.h"
+#include "exprs/column_ref.h"
 #include "runtime/current_thread.h"
 #include "simd/simd.h"
 
@@ -206,6 +211,40 @@ Status AggregateStreamingNode::_output_chunk_from_hash_map(ChunkPtr* chunk) {
     return Status::OK();
 }
 
+OlapScanNode* AggregateStreamingNode::bucket_aligned_scan_node() const {
+    const auto& agg_node = _tnode.agg_node;
+    if (_children.size() != 1 || _children[0]->type() != TPlanNodeType::OLAP_SCAN_NODE) {
+        return nullptr;
+    }
+    if (!agg_node.__isset.grouping_exprs || agg_node.grouping_exprs.empty()) {
+        return nullptr;
+    }
+    // Aggregating per bucket is useless if the input is always passed through.
+    if (agg_node.__isset.streaming_preaggregation_mode &&
+        agg_node.streaming_preaggregation_mode == TStreamingPreaggregationMode::FORCE_STREAMING) {
+        return nullptr;
+    }
+    auto* scan_node = down_cast<OlapScanNode*>(_children[0]);
+    const auto& bucket_exprs = scan_node->bucket_exprs();
+    if (bucket_exprs.empty()) {
+        return nullptr;
+    }
+
+    std::unordered_set<SlotId> group_by_slots;
+    for (const auto& texpr : agg_node.grouping_exprs) {
+        if (texpr.nodes.size() == 1 && texpr.nodes[0].node_type == TExprNodeType::SLOT_REF) {
+            group_by_slots.insert(texpr.nodes[0].slot_ref.slot_id);
+        }
+    }
+    for (const auto* ctx : bucket_exprs) {
+        if (!ctx->root()->is_slotref() ||
+            group_by_slots.count(down_cast<const ColumnRef*>(ctx->root())->slot_id()) == 0) {
+            return nullptr;
+        }
+    }
+    return scan_node;
+}
+
 pipeline::OpFactories AggregateStreamingNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
 
@@ -234,16 +273,31 @@ pipeline::OpFactories AggregateStreamingNode::decompose_to_pipeline(pipeline::Pi
         return std::tuple<OpFactoryPtr, SourceOperatorFactoryPtr>{sink_operator, source_operator};
     };
 
+    // The scan outputs chunks by bucket only if the morsels are not shuffled locally.
+    bool per_bucket_optimize = _per_bucket_optimize && !should_cache &&
+                               dynamic_cast<LocalExchangeSourceOperatorFactory*>(ops_with_sink.back().get()) == nullptr;
+
     auto [agg_sink_op, agg_source_op] = operators_generator(false);
     // Create a shared RefCountedRuntimeFilterCollector
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(agg_sink_op.get(), context, rc_rf_probe_collector);
+    auto bucket_process_context_factory = std::make_shared<BucketProcessContextFactory>();
+    if (per_bucket_optimize) {
+        agg_sink_op = std::make_shared<BucketProcessSinkOperatorFactory>(
+                context->next_operator_id(), id(), bucket_process_context_factory, std::move(agg_sink_op));
+    }
     ops_with_sink.emplace_back(std::move(agg_sink_op));
 
     OpFactories ops_with_source;
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(agg_source_op.get(), context, rc_rf_probe_collector);
+    if (per_bucket_optimize) {
+        auto bucket_source_operator = std::make_shared<BucketProcessSourceOperatorFactory>(
+                context->next_operator_id(), id(), bucket_process_context_factory, std::move(agg_source_op));
+        context->inherit_upstream_source_properties(bucket_source_operator.get(), upstream_source_op);
+        agg_source_op = std::move(bucket_source_operator);
+    }
     ops_with_source.push_back(std::move(agg_source_op));
 
     if (should_cache) {
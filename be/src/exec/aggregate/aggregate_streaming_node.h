@@ -20,6 +20,8 @@
 // Streaming means this node will handle input in get_next phase, and maybe directly
 // ouput child chunk.
 namespace starrocks {
+class OlapScanNode;
+
 class AggregateStreamingNode final : public AggregateBaseNode {
 public:
     AggregateStreamingNode(ObjectPool* pool, const TPlanNode& tnode, const DescriptorTbl& descs)
@@ -31,7 +33,14 @@ public:
 
     pipeline::OpFactories decompose_to_pipeline(pipeline::PipelineBuilderContext* context) override;
 
+    // Returns the child if it is an olap scan node whose bucket columns are all group by keys, so that no group spans
+    // buckets and the input can be aggregated bucket by bucket once the scan outputs chunks by bucket.
+    OlapScanNode* bucket_aligned_scan_node() const;
+    void enable_per_bucket_optimize() { _per_bucket_optimize = true; }
+
 private:
     Status _output_chunk_from_hash_map(ChunkPtr* chunk);
+
+    bool _per_bucket_optimize = false;
 };
 } // namespace starrocks
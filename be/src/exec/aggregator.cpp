@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 #include <variant>
 
@@ -25,12 +26,14 @@
 #include "common/config.h"
 #include "common/status.h"
 #include "exec/exec_node.h"
+#include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/operator.h"
 #include "exec/spill/spiller.hpp"
 #include "exprs/anyval_util.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "types/logical_type.h"
 #include "udf/java/utils.h"
 #include "util/runtime_profile.h"
@@ -51,6 +54,8 @@ std::string AggrAutoContext::get_auto_state_string(const AggrAutoState& state) {
         return "PREAGG";
     case SELECTIVE_PREAGG:
         return "SELECTIVE_PREAGG";
+    case SORTED_PREAGG:
+        return "SORTED_PREAGG";
     }
     return "UNKNOWN";
 }
@@ -67,8 +72,9 @@ bool AggrAutoContext::is_high_reduction(const size_t agg_count, const size_t chu
     return agg_count >= HighReduction * chunk_size;
 }
 
-bool AggrAutoContext::is_low_reduction(const size_t agg_count, const size_t chunk_size) {
-    return agg_count <= LowReduction * chunk_size;
+bool AggrAutoContext::is_low_reduction(const size_t agg_count, const size_t chunk_size, const size_t ht_mem) {
+    double low_reduction = ht_mem > MaxCacheFriendlyHtSize ? LowReductionOutOfCache : LowReduction;
+    return agg_count <= low_reduction * chunk_size;
 }
 
 Status init_udaf_context(int64_t fid, const std::string& url, const std::string& checksum, const std::string& symbol,
@@ -78,6 +84,7 @@ AggregatorParamsPtr convert_to_aggregator_params(const TPlanNode& tnode) {
     auto params = std::make_shared<AggregatorParams>();
     params->conjuncts = tnode.conjuncts;
     params->limit = tnode.limit;
+    params->plan_node_id = tnode.node_id;
 
     // TODO: STREAM_AGGREGATION_NODE will be added later.
     DCHECK_EQ(tnode.node_type, TPlanNodeType::AGGREGATION_NODE);
@@ -190,7 +197,6 @@ ChunkUniquePtr AggregatorParams::create_result_chunk(bool is_serialize_fmt, cons
 }
 
 #define ALIGN_TO(size, align) ((size + align - 1) / align * align)
-#define PAD(size, align) (align - (size % align)) % align;
 
 Aggregator::Aggregator(AggregatorParamsPtr params) : _params(std::move(params)) {}
 
@@ -234,6 +240,9 @@ Status Aggregator::open(RuntimeState* state) {
     } else {
         TRY_CATCH_BAD_ALLOC(_init_agg_hash_variant(_hash_map_variant));
     }
+    if (_use_ht_size_hints()) {
+        TRY_CATCH_BAD_ALLOC(_reserve_hash_table_by_hint());
+    }
 
     {
         _agg_states_total_size = 16;
@@ -247,22 +256,26 @@ Status Aggregator::open(RuntimeState* state) {
             });
 
             DCHECK_GT(_agg_fn_ctxs.size(), 0);
-            _max_agg_state_align_size = std::max(_max_agg_state_align_size, _agg_functions[0]->alignof_size());
-            _agg_states_total_size += PAD(_agg_states_total_size, _agg_functions[0]->alignof_size());
+            // Lay the states out by descending alignment and then ascending size instead of in function order.
+            // This removes the padding between states and packs the small fixed-size states (count/sum/min/max)
+            // next to the key, so that several aggregate functions updating the same group touch fewer cache lines.
+            std::vector<size_t> layout_order(_agg_fn_ctxs.size());
+            std::iota(layout_order.begin(), layout_order.end(), 0);
+            std::stable_sort(layout_order.begin(), layout_order.end(), [this](size_t lhs, size_t rhs) {
+                if (_agg_functions[lhs]->alignof_size() != _agg_functions[rhs]->alignof_size()) {
+                    return _agg_functions[lhs]->alignof_size() > _agg_functions[rhs]->alignof_size();
+                }
+                return _agg_functions[lhs]->size() < _agg_functions[rhs]->size();
+            });
 
             // compute agg state total size and offsets
-            for (int i = 0; i < _agg_fn_ctxs.size(); ++i) {
+            for (size_t k = 0; k < layout_order.size(); ++k) {
+                size_t i = layout_order[k];
+                // pad it so that this aggregate_state will be aligned.
+                _agg_states_total_size = ALIGN_TO(_agg_states_total_size, _agg_functions[i]->alignof_size());
                 _agg_states_offsets[i] = _agg_states_total_size;
                 _agg_states_total_size += _agg_functions[i]->size();
                 _max_agg_state_align_size = std::max(_max_agg_state_align_size, _agg_functions[i]->alignof_size());
-
-                // If not the last aggregate_state, we need pad it so that next aggregate_state will be aligned.
-                if (i + 1 < _agg_fn_ctxs.size()) {
-                    size_t next_state_align_size = _agg_functions[i + 1]->alignof_size();
-                    // Extend total_size to next alignment requirement
-                    // Add padding by rounding up '_agg_states_total_size' to be a multiplier of next_state_align_size.
-                    _agg_states_total_size = ALIGN_TO(_agg_states_total_size, next_state_align_size);
-                }
             }
             _agg_states_total_size = ALIGN_TO(_agg_states_total_size, _max_agg_state_align_size);
             _state_allocator.aggregate_key_size = _agg_states_total_size;
@@ -593,6 +606,9 @@ void Aggregator::close(RuntimeState* state) {
     }
 
     _is_closed = true;
+    if (_use_ht_size_hints() && is_sink_complete() && !state->is_cancelled()) {
+        _update_ht_size_hint();
+    }
     // Clear the buffer
     while (!_buffer.empty()) {
         _buffer.pop();
@@ -870,6 +886,13 @@ Status Aggregator::evaluate_groupby_exprs(Chunk* chunk) {
     return _evaluate_group_by_exprs(chunk);
 }
 
+void Aggregator::share_groupby_columns(Chunk* chunk, const Aggregator& other) {
+    DCHECK_EQ(_group_by_columns.size(), other._group_by_columns.size());
+    _set_passthrough(chunk->owner_info().is_passthrough());
+    _reset_exprs();
+    _group_by_columns = other._group_by_columns;
+}
+
 Status Aggregator::output_chunk_by_streaming(Chunk* input_chunk, ChunkPtr* chunk) {
     // The input chunk is already intermediate-typed, so there is no need to convert it again.
     // Only when the input chunk is input-typed, we should convert it into intermediate-typed chunk.
@@ -1003,6 +1026,42 @@ Status Aggregator::output_chunk_by_streaming_with_selection(Chunk* input_chunk,
     return Status::OK();
 }
 
+// Only the blocking aggregations use the hints, the hash tables of the streaming ones are bounded by the
+// streaming heuristics instead of the number of groups.
+bool Aggregator::_use_ht_size_hints() const {
+    if (!config::enable_hash_table_size_hints || _state == nullptr || _aggr_phase != AggrPhase2 ||
+        _group_by_expr_ctxs.empty() || _params->plan_node_id < 0) {
+        return false;
+    }
+    auto* fragment_ctx = _state->fragment_ctx();
+    return fragment_ctx != nullptr && fragment_ctx->plan_fingerprint() != 0 && _state->exec_env() != nullptr &&
+           _state->exec_env()->ht_size_hints() != nullptr;
+}
+
+void Aggregator::_reserve_hash_table_by_hint() {
+    size_t hint = _state->exec_env()->ht_size_hints()->lookup(_state->fragment_ctx()->plan_fingerprint(),
+                                                               _params->plan_node_id);
+    if (hint == 0) {
+        return;
+    }
+    if (_is_only_group_by_columns) {
+        _hash_set_variant.visit([&](auto& hash_set_with_key) { hash_set_with_key->hash_set.reserve(hint); });
+    } else {
+        _hash_map_variant.visit([&](auto& hash_map_with_key) { hash_map_with_key->hash_map.reserve(hint); });
+    }
+    _runtime_profile->add_info_string("HashTableSizeHint", std::to_string(hint));
+}
+
+void Aggregator::_update_ht_size_hint() {
+    // the hash table only holds a part of the groups if it has spilled.
+    if (_spiller != nullptr && _spiller->spilled()) {
+        return;
+    }
+    size_t ht_size = _is_only_group_by_columns ? _hash_set_variant.size() : _hash_map_variant.size();
+    _state->exec_env()->ht_size_hints()->update(_state->fragment_ctx()->plan_fingerprint(), _params->plan_node_id,
+                                                ht_size);
+}
+
 void Aggregator::try_convert_to_two_level_map() {
     auto current_size = _hash_map_variant.reserved_memory_usage(mem_pool());
     if (current_size > two_level_memory_threshold) {
@@ -158,7 +158,7 @@ enum AggrMode {
     AM_STREAMING_POST_CACHE
 };
 
-enum AggrAutoState { INIT_PREAGG = 0, ADJUST, PASS_THROUGH, FORCE_PREAGG, PREAGG, SELECTIVE_PREAGG };
+enum AggrAutoState { INIT_PREAGG = 0, ADJUST, PASS_THROUGH, FORCE_PREAGG, PREAGG, SELECTIVE_PREAGG, SORTED_PREAGG };
 
 struct AggrAutoContext {
     static constexpr size_t ContinuousUpperLimit = 10000;
@@ -166,6 +166,10 @@ struct AggrAutoContext {
     static constexpr int PreaggLimit = 100;
     static constexpr int AdjustLimit = 100;
     static constexpr double LowReduction = 0.2;
+    // Once the hash table outgrows the cache, almost every probe of it is a cache miss, which makes the
+    // pre-aggregation more expensive, so a higher reduction is required to keep on pre-aggregating.
+    static constexpr double LowReductionOutOfCache = 0.4;
+    static constexpr size_t MaxCacheFriendlyHtSize = 2 * 1024 * 1024; // 2 MB
     static constexpr double HighReduction = 0.9;
     static constexpr size_t MaxHtSize = 64 * 1024 * 1024; // 64 MB
     static constexpr int StableLimit = 5;
@@ -173,7 +177,7 @@ struct AggrAutoContext {
     size_t get_continuous_limit();
     void update_continuous_limit();
     bool is_high_reduction(const size_t agg_count, const size_t chunk_size);
-    bool is_low_reduction(const size_t agg_count, const size_t chunk_size);
+    bool is_low_reduction(const size_t agg_count, const size_t chunk_size, const size_t ht_mem);
     size_t init_preagg_count = 0;
     size_t adjust_count = 0;
     size_t pass_through_count = 0;
@@ -220,7 +224,7 @@ struct AggregatorParams {
     std::vector<TExpr> intermediate_aggr_exprs;
 
     // Incremental MV
-    // Whether it's testing, use MemStateTable in testing, instead use IMTStateTable.
+    // Whether it's testing, use MemStateTable in testing, instead use SpillableStateTable.
     bool is_testing;
     // Whether input is only append-only or with retract messages.
     bool is_append_only;
@@ -238,6 +242,9 @@ struct AggregatorParams {
 
     bool has_nullable_key;
 
+    // the id of the aggregation plan node, used to look up the hash table size hints
+    int32_t plan_node_id = -1;
+
     void init();
 
     ChunkUniquePtr create_result_chunk(bool is_serialize_fmt, const TupleDescriptor& desc);
@@ -271,6 +278,7 @@ public:
     bool only_group_by_exprs() { return _is_only_group_by_columns; }
     const std::vector<ExprContext*>& conjunct_ctxs() { return _conjunct_ctxs; }
     const std::vector<ExprContext*>& group_by_expr_ctxs() { return _group_by_expr_ctxs; }
+    const Columns& group_by_columns() const { return _group_by_columns; }
     const std::vector<FunctionContext*>& agg_fn_ctxs() { return _agg_fn_ctxs; }
     const std::vector<std::vector<ExprContext*>>& agg_expr_ctxs() { return _agg_expr_ctxs; }
     int64_t limit() { return _limit; }
@@ -313,6 +321,10 @@ public:
     RuntimeProfile::Counter* rows_returned_counter() { return _agg_stat->rows_returned_counter; }
     RuntimeProfile::Counter* hash_table_size() { return _agg_stat->hash_table_size; }
     RuntimeProfile::Counter* pass_through_row_count() { return _agg_stat->pass_through_row_count; }
+    RuntimeProfile::Counter* preagg_chunk_count() { return _agg_stat->preagg_chunk_count; }
+    RuntimeProfile::Counter* pass_through_chunk_count() { return _agg_stat->pass_through_chunk_count; }
+    RuntimeProfile::Counter* selective_preagg_chunk_count() { return _agg_stat->selective_preagg_chunk_count; }
+    RuntimeProfile::Counter* auto_state_switch_count() { return _agg_stat->auto_state_switch_count; }
 
     void sink_complete() { _is_sink_complete.store(true, std::memory_order_release); }
 
@@ -336,6 +348,9 @@ public:
     void process_limit(ChunkPtr* chunk);
 
     [[nodiscard]] Status evaluate_groupby_exprs(Chunk* chunk);
+    // Takes the group by columns |other|, which has the same group by exprs, has evaluated on the chunk, instead of
+    // evaluating them again.
+    void share_groupby_columns(Chunk* chunk, const Aggregator& other);
     [[nodiscard]] Status evaluate_agg_fn_exprs(Chunk* chunk);
     [[nodiscard]] Status evaluate_agg_fn_exprs(Chunk* chunk, bool use_intermediate);
     [[nodiscard]] Status evaluate_agg_input_column(Chunk* chunk, std::vector<ExprContext*>& agg_expr_ctxs, int i);
@@ -564,6 +579,12 @@ protected:
 
     void _release_agg_memory();
 
+    // Whether to reserve the hash table by the size hint of the last execution of the same plan, and record
+    // the final size as the hint for the next execution.
+    bool _use_ht_size_hints() const;
+    void _reserve_hash_table_by_hint();
+    void _update_ht_size_hint();
+
     template <class HashMapWithKey>
     friend struct AllocateState;
 };
@@ -14,9 +14,11 @@
 
 #include "exec/analytor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <ios>
 #include <memory>
+#include <unordered_set>
 
 #include "column/chunk.h"
 #include "column/column_helper.h"
@@ -107,6 +109,16 @@ Analytor::Analytor(const TPlanNode& tnode, const RowDescriptor& child_row_desc,
         if (config::pipeline_analytic_enable_removable_cumulative_process) {
             _use_removable_cumulative_process = (window.__isset.window_start && window.__isset.window_end);
         }
+        if (config::pipeline_analytic_enable_sliding_min_max_process) {
+            _use_sliding_min_max_process = (window.__isset.window_start && window.__isset.window_end);
+        }
+        if (config::pipeline_analytic_segment_tree_min_frame_rows > 0 && window.__isset.window_start &&
+            window.__isset.window_end) {
+            // Narrow frames are cheaper to scan directly.
+            const int64_t min_frame_rows = std::max<int64_t>(config::pipeline_analytic_segment_tree_min_frame_rows,
+                                                             2 * kSegmentTreeLeafRows);
+            _use_segment_tree_process = _rows_end_offset - _rows_start_offset + 1 >= min_frame_rows;
+        }
         _is_unbounded_preceding = !window.__isset.window_start;
     }
 }
@@ -136,6 +148,10 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
     _agg_fn_types.resize(agg_size);
     _agg_states_offsets.resize(agg_size);
     _partition_size_required_function_index.resize(0);
+    _sliding_min_max_directions.resize(agg_size);
+    _sliding_extreme_rows.resize(agg_size);
+    _agg_intermediate_types.resize(agg_size);
+    _segment_tree_nodes.resize(agg_size);
 
     bool has_outer_join_child = analytic_node.__isset.has_outer_join_child && analytic_node.has_outer_join_child;
 
@@ -170,6 +186,25 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
             _use_removable_cumulative_process = false;
         }
 
+        if (fn.name.function_name == "min") {
+            _sliding_min_max_directions[i] = 1;
+        } else if (fn.name.function_name == "max") {
+            _sliding_min_max_directions[i] = -1;
+        } else {
+            _use_sliding_min_max_process = false;
+        }
+
+        // Functions whose intermediate states could be merged in any order to build the segment tree.
+        static const std::unordered_set<std::string> segment_tree_functions = {
+                "sum",      "avg",        "min", "max",        "variance",    "variance_pop", "var_pop",
+                "var_samp", "variance_samp", "std", "stddev", "stddev_pop", "stddev_samp"};
+        if (fn.binary_type == TFunctionBinaryType::BUILTIN && !fn.ignore_nulls && fn.__isset.aggregate_fn &&
+            segment_tree_functions.count(fn.name.function_name) > 0) {
+            _agg_intermediate_types[i] = TypeDescriptor::from_thrift(fn.aggregate_fn.intermediate_type);
+        } else {
+            _use_segment_tree_process = false;
+        }
+
         bool is_input_nullable = false;
         if (fn.name.function_name == "count" || fn.name.function_name == "row_number" ||
             fn.name.function_name == "rank" || fn.name.function_name == "dense_rank" ||
@@ -242,6 +277,11 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
         _is_lead_lag_functions[i] = (_agg_functions[i]->get_name() == "lead-lag");
     }
 
+    // The removable cumulative process and the sliding MIN/MAX process are cheaper if applicable.
+    if (_use_removable_cumulative_process || _use_sliding_min_max_process) {
+        _use_segment_tree_process = false;
+    }
+
     // Compute agg state total size and offsets.
     for (int i = 0; i < agg_size; ++i) {
         _agg_states_offsets[i] = _agg_states_total_size;
@@ -334,6 +374,20 @@ Status Analytor::open(RuntimeState* state) {
         }
         AggDataPtr agg_states = _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
         _managed_fn_states.emplace_back(std::make_unique<ManagedFunctionStates>(&_agg_fn_ctxs, agg_states, this));
+        // Every evaluator which keeps state across rows must still be able to read the rows its state refers to.
+    if (_use_sliding_min_max_process) {
+        for (const auto& extremes : _sliding_extreme_rows) {
+            if (!extremes.empty()) {
+                position = std::min(position, extremes.front());
+            }
+        }
+    }
+    if (_use_segment_tree_process) {
+            // Scratch states to build the nodes of segment tree.
+            AggDataPtr scratch_states = _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
+            _managed_fn_states.emplace_back(
+                    std::make_unique<ManagedFunctionStates>(&_agg_fn_ctxs, scratch_states, this));
+        }
         return Status::OK();
     };
 
@@ -421,8 +475,15 @@ Status Analytor::_prepare_processing_mode(RuntimeState* state, RuntimeProfile* r
     _process_impl = &Analytor::_materializing_process;
     std::stringstream process_mode;
     process_mode << (_need_partition_materializing ? "Materializing/" : "Streaming/");
-    process_mode << (_use_removable_cumulative_process ? "RemovableCumulative"
-                                                       : (_is_unbounded_preceding ? "Cumulative" : "ByDefinition"));
+    if (_use_removable_cumulative_process) {
+        process_mode << "RemovableCumulative";
+    } else if (_use_sliding_min_max_process) {
+        process_mode << "SlidingMinMax";
+    } else if (_use_segment_tree_process) {
+        process_mode << "SegmentTree";
+    } else {
+        process_mode << (_is_unbounded_preceding ? "Cumulative" : "ByDefinition");
+    }
     runtime_profile->add_info_string("ProcessMode", process_mode.str());
     if (!_tnode.analytic_node.__isset.window) {
         _materializing_process_impl = &Analytor::_materializing_process_for_unbounded_frame;
@@ -502,32 +563,85 @@ Status Analytor::_check_has_error() {
     return Status::OK();
 }
 
-void Analytor::_remove_unused_rows(RuntimeState* state) {
-    const size_t chunk_num = config::pipeline_analytic_removable_chunk_num;
-    // Keep at least one chunk, because the process of _find_partition_end() may access the end position of
-    // the last chunk.
-    if (_removed_chunk_index + chunk_num + 1 >= _input_chunk_first_row_positions.size()) {
-        return;
-    }
-
-    const int64_t remove_end_position = _input_chunk_first_row_positions[_removed_chunk_index + chunk_num];
+int64_t Analytor::_first_needed_global_position() const {
+    int64_t position;
     if (_need_partition_materializing) {
-        if (_get_global_position(_partition.start) <= remove_end_position) {
-            return;
-        }
+        return _get_global_position(_partition.start);
     } else if (_use_removable_cumulative_process || !_is_unbounded_preceding) {
         // Both cumulative process or sliding process need to access position around range.start
         const auto frame = _get_frame_range();
-        if (_get_global_position(frame.start - 1) <= remove_end_position) {
-            return;
-        }
+        position = _get_global_position(frame.start - 1);
     } else {
         // Cumulative process only access the position around the frame.end
         const auto frame = _get_frame_range();
-        if (_get_global_position(std::min(_current_row_position, frame.end)) <= remove_end_position) {
-            return;
+        position = _get_global_position(std::min(_current_row_position, frame.end));
+    }
+
+    // Every evaluator which keeps state across rows must still be able to read the rows its state refers to.
+    if (_use_sliding_min_max_process) {
+        for (const auto& extremes : _sliding_extreme_rows) {
+            if (!extremes.empty()) {
+                position = std::min(position, extremes.front());
+            }
+        }
+    }
+    if (_use_segment_tree_process) {
+        // The rows of the last incomplete leaf are read when the leaf is built, which may happen after the frame
+        // start passed them.
+        for (const auto& levels : _segment_tree_nodes) {
+            const int64_t num_leaves = levels.empty() ? 0 : static_cast<int64_t>(levels[0]->size());
+            position = std::min(position, _segment_tree_base + num_leaves * kSegmentTreeLeafRows);
         }
     }
+    return position;
+}
+
+size_t Analytor::_buffered_columns_bytes() const {
+    size_t bytes = 0;
+    for (const auto& columns : _agg_intput_columns) {
+        for (const auto& column : columns) {
+            bytes += column->memory_usage();
+        }
+    }
+    for (const auto& column : _partition_columns) {
+        bytes += column->memory_usage();
+    }
+    for (const auto& column : _order_columns) {
+        bytes += column->memory_usage();
+    }
+    return bytes;
+}
+
+void Analytor::_remove_unused_rows(RuntimeState* state) {
+    int64_t chunk_num = config::pipeline_analytic_removable_chunk_num;
+    // Keep at least one chunk, because the process of _find_partition_end() may access the end position of
+    // the last chunk.
+    const int64_t max_chunk_num =
+            static_cast<int64_t>(_input_chunk_first_row_positions.size()) - _removed_chunk_index - 2;
+    if (max_chunk_num < 1) {
+        return;
+    }
+    const int64_t first_needed_position = _first_needed_global_position();
+
+    // Removing rows shifts all the remaining rows, so they are removed in batches of chunk_num chunks. But when the
+    // buffered columns are too large, every chunk in front of the first needed position is removed right away.
+    const int64_t max_buffered_bytes = config::pipeline_analytic_max_buffered_bytes;
+    if (max_buffered_bytes > 0 && _buffered_columns_bytes() >= static_cast<size_t>(max_buffered_bytes)) {
+        auto begin = _input_chunk_first_row_positions.begin() + _removed_chunk_index;
+        auto end = begin + max_chunk_num + 1;
+        const int64_t removable_chunk_num = std::lower_bound(begin, end, first_needed_position) - begin - 1;
+        if (removable_chunk_num >= 1) {
+            chunk_num = removable_chunk_num;
+        }
+    }
+    if (chunk_num > max_chunk_num) {
+        return;
+    }
+
+    const int64_t remove_end_position = _input_chunk_first_row_positions[_removed_chunk_index + chunk_num];
+    if (first_needed_position <= remove_end_position) {
+        return;
+    }
 
     const int64_t remove_rows = remove_end_position - _removed_from_buffer_rows;
     COUNTER_ADD(_peak_buffered_rows, -remove_rows);
@@ -812,6 +926,10 @@ Status Analytor::_streaming_process_for_sliding_frame(RuntimeState* state) {
 
             if (_use_removable_cumulative_process) {
                 _update_window_batch_removable_cumulatively();
+            } else if (_use_sliding_min_max_process) {
+                _update_window_batch_sliding_min_max();
+            } else if (_use_segment_tree_process) {
+                _update_window_batch_by_segment_tree();
             } else {
                 // Update agg state in batch manner for each row.
                 _reset_window_state();
@@ -909,6 +1027,20 @@ void Analytor::_materializing_process_for_sliding_frame(RuntimeState* state) {
         while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
             _update_window_batch_removable_cumulatively();
 
+            _get_window_function_result(_window_result_position(), _window_result_position() + 1);
+            _update_current_row_position(1);
+        }
+    } else if (_use_sliding_min_max_process) {
+        while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
+            _update_window_batch_sliding_min_max();
+
+            _get_window_function_result(_window_result_position(), _window_result_position() + 1);
+            _update_current_row_position(1);
+        }
+    } else if (_use_segment_tree_process) {
+        while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
+            _update_window_batch_by_segment_tree();
+
             _get_window_function_result(_window_result_position(), _window_result_position() + 1);
             _update_current_row_position(1);
         }
@@ -961,6 +1093,138 @@ void Analytor::_update_window_batch_removable_cumulatively() {
     }
 }
 
+void Analytor::_update_window_batch_sliding_min_max() {
+    const FrameRange range = _get_frame_range();
+    const int64_t frame_start = std::max<int64_t>(range.start, _partition.start);
+    const int64_t frame_end = std::min<int64_t>(range.end, _partition.end);
+    const int64_t global_frame_start = _get_global_position(frame_start);
+    // Rows before the partition start belong to the previous partition and must never enter the queues.
+    const int64_t push_start = std::max<int64_t>(_sliding_extreme_end - _removed_from_buffer_rows, frame_start);
+
+    _reset_window_state();
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        const Column* column = _agg_intput_columns[i][0].get();
+        const int direction = _sliding_min_max_directions[i];
+        auto& extremes = _sliding_extreme_rows[i];
+
+        // Rows which left the frame are popped before any comparison, because they may have been removed from
+        // the buffer already.
+        while (!extremes.empty() && extremes.front() < global_frame_start) {
+            extremes.pop_front();
+        }
+        for (int64_t pos = push_start; pos < frame_end; ++pos) {
+            if (column->is_null(pos)) {
+                continue;
+            }
+            // Rows which are not better than the new one can never be the extreme of any later frame.
+            while (!extremes.empty() &&
+                   direction * column->compare_at(extremes.back() - _removed_from_buffer_rows, pos, *column, 1) >= 0) {
+                extremes.pop_back();
+            }
+            extremes.push_back(_get_global_position(pos));
+        }
+
+        if (!extremes.empty()) {
+            const Column* data_columns[1] = {column};
+            const int64_t extreme = extremes.front() - _removed_from_buffer_rows;
+            _agg_functions[i]->update_batch_single_state_with_frame(
+                    _agg_fn_ctxs[i], _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i], data_columns,
+                    _partition.start, _partition.end, extreme, extreme + 1);
+        }
+    }
+    _sliding_extreme_end = std::max<int64_t>(_sliding_extreme_end, _get_global_position(frame_end));
+}
+
+void Analytor::_build_segment_tree() {
+    // Only complete leaves are built, the rows of the last incomplete leaf are updated directly on query.
+    const int64_t num_leaves = (_get_global_position(_partition.end) - _segment_tree_base) / kSegmentTreeLeafRows;
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        auto& levels = _segment_tree_nodes[i];
+        if (levels.empty() && num_leaves > 0) {
+            levels.emplace_back(ColumnHelper::create_column(_agg_intermediate_types[i], true));
+        }
+        if (levels.empty() || static_cast<int64_t>(levels[0]->size()) >= num_leaves) {
+            continue;
+        }
+
+        size_t column_size = _agg_intput_columns[i].size();
+        const Column* data_columns[column_size];
+        for (size_t j = 0; j < column_size; j++) {
+            data_columns[j] = _agg_intput_columns[i][j].get();
+        }
+        AggDataPtr scratch = _managed_fn_states[1]->mutable_data() + _agg_states_offsets[i];
+
+        while (static_cast<int64_t>(levels[0]->size()) < num_leaves) {
+            const int64_t start = _segment_tree_base + static_cast<int64_t>(levels[0]->size()) * kSegmentTreeLeafRows -
+                                  _removed_from_buffer_rows;
+            DCHECK_GE(start, 0);
+            _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], scratch);
+            _agg_functions[i]->update_batch_single_state_with_frame(_agg_fn_ctxs[i], scratch, data_columns,
+                                                                    _partition.start, _partition.end, start,
+                                                                    start + kSegmentTreeLeafRows);
+            _agg_functions[i]->serialize_to_column(_agg_fn_ctxs[i], scratch, levels[0].get());
+        }
+
+        for (size_t level = 1; levels[level - 1]->size() >= 2; level++) {
+            if (levels.size() == level) {
+                levels.emplace_back(ColumnHelper::create_column(_agg_intermediate_types[i], true));
+            }
+            const Column* children = levels[level - 1].get();
+            while (levels[level]->size() * 2 + 1 < children->size()) {
+                const size_t left = levels[level]->size() * 2;
+                _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], scratch);
+                _agg_functions[i]->merge(_agg_fn_ctxs[i], children, scratch, left);
+                _agg_functions[i]->merge(_agg_fn_ctxs[i], children, scratch, left + 1);
+                _agg_functions[i]->serialize_to_column(_agg_fn_ctxs[i], scratch, levels[level].get());
+            }
+        }
+    }
+}
+
+void Analytor::_update_window_batch_by_segment_tree() {
+    _build_segment_tree();
+    _reset_window_state();
+
+    const FrameRange range = _get_frame_range();
+    const int64_t frame_start = std::max<int64_t>(range.start, _partition.start);
+    const int64_t frame_end = std::min<int64_t>(range.end, _partition.end);
+    if (frame_start >= frame_end) {
+        return;
+    }
+    // Leaves fully covered by the frame.
+    int64_t lo = (_get_global_position(frame_start) - _segment_tree_base + kSegmentTreeLeafRows - 1) /
+                 kSegmentTreeLeafRows;
+    int64_t hi = (_get_global_position(frame_end) - _segment_tree_base) / kSegmentTreeLeafRows;
+    if (lo >= hi) {
+        _update_window_batch(_partition.start, _partition.end, frame_start, frame_end);
+        return;
+    }
+    const int64_t inner_start = _segment_tree_base + lo * kSegmentTreeLeafRows - _removed_from_buffer_rows;
+    const int64_t inner_end = _segment_tree_base + hi * kSegmentTreeLeafRows - _removed_from_buffer_rows;
+    _update_window_batch(_partition.start, _partition.end, frame_start, inner_start);
+    _update_window_batch(_partition.start, _partition.end, inner_end, frame_end);
+
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        const auto& levels = _segment_tree_nodes[i];
+        AggDataPtr state = _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i];
+        for (size_t level = 0, l = lo, h = hi; l < h; level++, l >>= 1, h >>= 1) {
+            if (l & 1) {
+                _agg_functions[i]->merge(_agg_fn_ctxs[i], levels[level].get(), state, l++);
+            }
+            if (h & 1) {
+                _agg_functions[i]->merge(_agg_fn_ctxs[i], levels[level].get(), state, --h);
+            }
+        }
+    }
+}
+
+void Analytor::_reset_segment_tree() {
+    for (auto& levels : _segment_tree_nodes) {
+        levels.clear();
+    }
+    _segment_tree_base = _get_global_position(_partition.start);
+}
+
 Status Analytor::_output_result_chunk(ChunkPtr* chunk) {
     ChunkPtr output_chunk = std::move(_input_chunks[_output_chunk_index]);
     for (size_t i = 0; i < _result_window_columns.size(); i++) {
@@ -989,6 +1253,20 @@ void Analytor::_reset_state_for_next_partition() {
     _partition.start = _partition.end;
     _current_row_position = _partition.start;
     _reset_window_state();
+    for (auto& extremes : _sliding_extreme_rows) {
+        extremes.clear();
+    }
+    // Every evaluator which keeps state across rows must still be able to read the rows its state refers to.
+    if (_use_sliding_min_max_process) {
+        for (const auto& extremes : _sliding_extreme_rows) {
+            if (!extremes.empty()) {
+                position = std::min(position, extremes.front());
+            }
+        }
+    }
+    if (_use_segment_tree_process) {
+        _reset_segment_tree();
+    }
     DCHECK_GE(_current_row_position, 0);
 }
 
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <deque>
 #include <queue>
 #include <string>
 
@@ -193,6 +194,10 @@ private:
 
     void _update_window_batch(int64_t partition_start, int64_t partition_end, int64_t frame_start, int64_t frame_end);
     void _update_window_batch_removable_cumulatively();
+    void _update_window_batch_sliding_min_max();
+    void _build_segment_tree();
+    void _update_window_batch_by_segment_tree();
+    void _reset_segment_tree();
 
     Status _output_result_chunk(ChunkPtr* chunk);
 
@@ -206,6 +211,10 @@ private:
     void _find_candidate_partition_ends();
     void _find_candidate_peer_group_ends();
 
+    // The first global position which the evaluation of the current row may still access.
+    int64_t _first_needed_global_position() const;
+    size_t _buffered_columns_bytes() const;
+
     bool _has_output() const { return _output_chunk_index < _input_chunks.size(); }
     int64_t _first_global_position_of_current_chunk() const {
         return _input_chunk_first_row_positions[_output_chunk_index];
@@ -290,6 +299,25 @@ private:
     // Any of these conditions is satisfied, the materializing processing is required.
     bool _need_partition_materializing = false;
     bool _use_removable_cumulative_process = false;
+    // For sliding ROWS frames made up of MIN/MAX only, every function keeps a monotonic queue of the global
+    // positions of the candidate extremes in the current frame, so each row is evaluated in amortized O(1)
+    // instead of rescanning the whole frame.
+    bool _use_sliding_min_max_process = false;
+    // 1 for MIN, -1 for MAX.
+    std::vector<int> _sliding_min_max_directions;
+    std::vector<std::deque<int64_t>> _sliding_extreme_rows;
+    // Global position of the first row which has not been pushed into the queues.
+    int64_t _sliding_extreme_end = 0;
+    // For sliding ROWS frames whose functions can merge their intermediate states, the rows of the current
+    // partition are summarized by a segment tree, whose leaves cover kSegmentTreeLeafRows rows each. A frame
+    // is then evaluated by merging O(log n) nodes plus the rows at both edges, instead of updating every row.
+    static constexpr int64_t kSegmentTreeLeafRows = 32;
+    bool _use_segment_tree_process = false;
+    std::vector<TypeDescriptor> _agg_intermediate_types;
+    // _segment_tree_nodes[i][level] stores the serialized states of the i-th function, where the j-th node covers
+    // the global positions [_segment_tree_base + j * (kSegmentTreeLeafRows << level), ...) of the partition.
+    std::vector<std::vector<ColumnPtr>> _segment_tree_nodes;
+    int64_t _segment_tree_base = 0;
     // When calculating window functions such as CUME_DIST and PERCENT_RANK,
     // it's necessary to specify the size of the partition.
     bool _should_set_partition_size = false;
@@ -221,4 +221,32 @@ Status ChunksSorter::done(RuntimeState* state) {
     return Status::OK();
 }
 
+int ChunksSorter::_compare_row(const DataSegment& left, size_t lhs, const DataSegment& right, size_t rhs) const {
+    size_t first_column = 0;
+    int res = compare_normalized_keys(left.normalized_keys, lhs, right.normalized_keys, rhs, &first_column);
+    if (res != 0) {
+        return res;
+    }
+    for (size_t j = first_column; j < left.order_by_columns.size(); ++j) {
+        const auto& desc = _sort_desc.get_column_desc(j);
+        int res = left.order_by_columns[j]->compare_at(lhs, rhs, *right.order_by_columns[j], desc.null_first);
+        if (res != 0) {
+            return res * desc.sort_order;
+        }
+    }
+    return 0;
+}
+
+bool ChunksSorter::_is_presorted(const DataSegment& segment) const {
+    // unordered input usually breaks the order within the first few rows, so this costs little
+    // when it fails, and is much cheaper than sorting when it succeeds.
+    const size_t num_rows = segment.chunk->num_rows();
+    for (size_t i = 1; i < num_rows; ++i) {
+        if (_compare_row(segment, i - 1, segment, i) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace starrocks
@@ -21,6 +21,7 @@
 #include "common/object_pool.h"
 #include "exec/pipeline/spill_process_channel.h"
 #include "exec/sort_exec_exprs.h"
+#include "exec/sorting/normalized_key.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
 #include "exec/spill/executor.h"
@@ -40,6 +41,8 @@ struct DataSegment {
 
     ChunkPtr chunk;
     Columns order_by_columns;
+    // optional, only built by the sorters that compare rows one by one
+    NormalizedKeys normalized_keys;
 
     DataSegment() : chunk(std::make_shared<Chunk>()) {}
 
@@ -63,6 +66,7 @@ struct DataSegment {
     void clear() {
         chunk.reset(std::make_unique<Chunk>().release());
         order_by_columns.clear();
+        normalized_keys.clear();
     }
 
     // Return value:
@@ -153,6 +157,14 @@ public:
 protected:
     size_t _get_number_of_order_by_columns() const { return _sort_exprs->size(); }
 
+    // Compare the row |lhs| of |left| with the row |rhs| of |right| by the sort keys.
+    int _compare_row(const DataSegment& left, size_t lhs, const DataSegment& right, size_t rhs) const;
+
+    // Whether the rows of |segment| are already in the order of the sort keys, e.g. they are scanned
+    // from a tablet whose sort key is prefixed by the ORDER BY columns. Only the first (offset + limit)
+    // rows of such input can make a row-number top-n, so the rest of it can be skipped without sorting.
+    bool _is_presorted(const DataSegment& segment) const;
+
     RuntimeState* _state;
 
     // sort rules
@@ -21,6 +21,7 @@
 #include "column/nullable_column.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exec/sorting/merge.h"
 #include "exprs/runtime_filter.h"
@@ -41,8 +42,21 @@ Status ChunksSorterHeapSort::update(RuntimeState* state, const ChunkPtr& chunk)
     // chunk_holder was shared ownership by itself
     auto* chunk_holder = new detail::ChunkHolder(std::make_shared<DataSegment>(_sort_exprs, chunk));
     chunk_holder->ref();
+    // a single column is compared directly by _do_filter_data, normalized keys only pay off for more
+    if (_sort_desc.num_columns() > 1 && config::sort_normalized_key_max_bytes > 0) {
+        auto& segment = *chunk_holder->value();
+        build_normalized_keys(segment.order_by_columns, _sort_desc, config::sort_normalized_key_max_bytes,
+                              &segment.normalized_keys);
+    }
     DeferOp defer([&] { chunk_holder->unref(); });
     int row_sz = chunk_holder->value()->chunk->num_rows();
+    const int num_rows = row_sz;
+    // For presorted input only a prefix of the chunk gets into the heap, stop at the first row that doesn't,
+    // since all the rows after it are not less than it either.
+    const bool presorted = _is_presorted(*chunk_holder->value());
+    if (presorted) {
+        row_sz = std::min<size_t>(_number_of_rows_to_sort(), row_sz);
+    }
     if (_sort_heap == nullptr) {
         _sort_heap = std::make_unique<CommonCursorSortHeap>(detail::ChunkCursorComparator(_sort_desc));
         // avoid exaggerated limit + offset, for an example select * from t order by col limit 9223372036854775800,1
@@ -60,7 +74,9 @@ Status ChunksSorterHeapSort::update(RuntimeState* state, const ChunkPtr& chunk)
         // compare to heap top and replace top
         for (; i < row_sz; ++i) {
             detail::ChunkRowCursor cursor(i, chunk_holder);
-            _sort_heap->replace_top_if_less(std::move(cursor));
+            if (!_sort_heap->replace_top_if_less(std::move(cursor)) && presorted) {
+                break;
+            }
         }
 
         // Special optimization for single columns
@@ -80,7 +96,18 @@ Status ChunksSorterHeapSort::update(RuntimeState* state, const ChunkPtr& chunk)
         }
 
     } else {
-        if (_number_of_rows_to_sort() == _sort_heap->size()) {
+        if (_number_of_rows_to_sort() == _sort_heap->size() && presorted) {
+            int i = 0;
+            for (; i < row_sz; ++i) {
+                detail::ChunkRowCursor cursor(i, chunk_holder);
+                if (!_sort_heap->replace_top_if_less(std::move(cursor))) {
+                    break;
+                }
+            }
+            if (_sort_filter_rows != nullptr) {
+                COUNTER_UPDATE(_sort_filter_rows, (num_rows - i));
+            }
+        } else if (_number_of_rows_to_sort() == _sort_heap->size()) {
             // if heap was full
             int rows_afterfilter_sz = _filter_data(chunk_holder, row_sz);
             if (_sort_filter_rows != nullptr) {
@@ -104,7 +131,9 @@ Status ChunksSorterHeapSort::update(RuntimeState* state, const ChunkPtr& chunk)
             // compare to heap top and replace top
             for (; i < row_sz; ++i) {
                 detail::ChunkRowCursor cursor(i, chunk_holder);
-                _sort_heap->replace_top_if_less(std::move(cursor));
+                if (!_sort_heap->replace_top_if_less(std::move(cursor)) && presorted) {
+                    break;
+                }
             }
         }
     }
@@ -272,7 +301,6 @@ int ChunksSorterHeapSort::_filter_data(detail::ChunkHolder* chunk_holder, int ro
     // Filter greater or equal top_cursor columns
     const auto& top_cursor = _sort_heap->top();
     const int cursor_rid = top_cursor.row_id();
-    const int column_sz = top_cursor.data_segment()->order_by_columns.size();
 
     Filter filter(row_sz);
 
@@ -281,17 +309,13 @@ int ChunksSorterHeapSort::_filter_data(detail::ChunkHolder* chunk_holder, int ro
         _do_filter_data(chunk_holder, &filter, row_sz);
     } else {
         for (int i = 0; i < row_sz; ++i) {
-            for (int j = 0; j < column_sz; ++j) {
-                int res = chunk_holder->value()->order_by_columns[j]->compare_at(
-                        i, cursor_rid, *top_cursor.data_segment()->order_by_columns[j],
-                        _sort_desc.get_column_desc(j).null_first);
-                if (res != 0) {
-                    filter[i] = (res * _sort_desc.get_column_desc(j).sort_order) < 0;
-                    break;
-                }
-            }
+            filter[i] = _compare_row(*chunk_holder->value(), i, *top_cursor.data_segment(), cursor_rid) < 0;
         }
     }
+    auto& keys = chunk_holder->value()->normalized_keys;
+    if (!keys.empty()) {
+        keys.filter(filter.data(), row_sz);
+    }
     return chunk_holder->value()->chunk->filter(filter);
 }
 
@@ -143,10 +143,12 @@ public:
     Sequence& container() { return _queue; }
 
     // replace top if val less than top()
-    void replace_top_if_less(T&& val) {
+    bool replace_top_if_less(T&& val) {
         if (_comp(val, top())) {
             replace_top(std::move(val));
+            return true;
         }
+        return false;
     }
 
 private:
@@ -206,8 +208,14 @@ struct ChunkCursorComparator {
     bool operator()(const ChunkRowCursor& lhs, const ChunkRowCursor& rhs) const {
         size_t l_row_id = lhs.row_id();
         size_t r_row_id = rhs.row_id();
+        size_t first_column = 0;
+        int key_res = compare_normalized_keys(lhs.data_segment()->normalized_keys, l_row_id,
+                                              rhs.data_segment()->normalized_keys, r_row_id, &first_column);
+        if (key_res != 0) {
+            return key_res < 0;
+        }
         int order_by_columns_sz = lhs.data_segment()->order_by_columns.size();
-        for (int i = 0; i < order_by_columns_sz; ++i) {
+        for (int i = first_column; i < order_by_columns_sz; ++i) {
             int null_first = _sort_desc.get_column_desc(i).null_first;
             int sort_order = _sort_desc.get_column_desc(i).sort_order;
             int res = lhs.data_segment()->order_by_columns[i]->compare_at(
@@ -54,7 +54,16 @@ void ChunksSorterTopn::setup_runtime(RuntimeState* state, RuntimeProfile* profil
 }
 
 // Cumulative chunks into _raw_chunks for sorting.
-Status ChunksSorterTopn::update(RuntimeState* state, const ChunkPtr& chunk) {
+Status ChunksSorterTopn::update(RuntimeState* state, const ChunkPtr& input) {
+    ChunkPtr chunk = input;
+    bool presorted = false;
+    if (_topn_type == TTopNType::ROW_NUMBER && _limit > 0 && chunk->num_rows() > 0) {
+        presorted = _prune_presorted_chunk(&chunk);
+        if (chunk == nullptr) {
+            return Status::OK();
+        }
+    }
+
     auto& raw_chunks = _raw_chunks.chunks;
     size_t chunk_number = raw_chunks.size();
     if (chunk_number <= 0) {
@@ -77,13 +86,43 @@ Status ChunksSorterTopn::update(RuntimeState* state, const ChunkPtr& chunk) {
     // TopN caches _limit or _size_of_chunk_batch primitive chunks,
     // performs sorting once, and discards extra rows
 
-    if (_limit > 0 && (chunk_number >= _limit || chunk_number >= _max_buffered_chunks)) {
+    // Presorted input has been cut to at most rows_to_sort rows, so sorting it right away is cheap, and
+    // it gives the runtime filter of the top-n boundary to the scanners as soon as possible.
+    if (_limit > 0 && (chunk_number >= _limit || chunk_number >= _max_buffered_chunks ||
+                       (presorted && _raw_chunks.size_of_rows >= _get_number_of_rows_to_sort()))) {
         RETURN_IF_ERROR(_sort_chunks(state));
     }
 
     return Status::OK();
 }
 
+bool ChunksSorterTopn::_prune_presorted_chunk(ChunkPtr* chunk) {
+    DataSegment segment(_sort_exprs, *chunk);
+    if (!_is_presorted(segment)) {
+        return false;
+    }
+    const size_t rows_to_sort = _get_number_of_rows_to_sort();
+    const size_t num_rows = (*chunk)->num_rows();
+    // none of the rows can get into the top-n if the first one doesn't
+    if (_init_merged_segment && _merged_segment.chunk->num_rows() >= rows_to_sort &&
+        _compare_row(segment, 0, _merged_segment, rows_to_sort - 1) >= 0) {
+        if (_sort_filter_rows != nullptr) {
+            COUNTER_UPDATE(_sort_filter_rows, num_rows);
+        }
+        chunk->reset();
+        return true;
+    }
+    if (num_rows > rows_to_sort) {
+        ChunkPtr prefix = (*chunk)->clone_empty(rows_to_sort);
+        prefix->append_safe(**chunk, 0, rows_to_sort);
+        if (_sort_filter_rows != nullptr) {
+            COUNTER_UPDATE(_sort_filter_rows, num_rows - rows_to_sort);
+        }
+        *chunk = std::move(prefix);
+    }
+    return true;
+}
+
 Status ChunksSorterTopn::do_done(RuntimeState* state) {
     auto& raw_chunks = _raw_chunks.chunks;
     if (!raw_chunks.empty()) {
@@ -66,7 +66,7 @@ public:
     ~ChunksSorterTopn() override;
 
     // Append a Chunk for sort.
-    [[nodiscard]] Status update(RuntimeState* state, const ChunkPtr& chunk) override;
+    [[nodiscard]] Status update(RuntimeState* state, const ChunkPtr& input) override;
     // Finish seeding Chunk, and get sorted data with top OFFSET rows have been skipped.
     [[nodiscard]] Status do_done(RuntimeState* state) override;
     // get_next only works after done().
@@ -85,6 +85,10 @@ private:
 
     [[nodiscard]] Status _sort_chunks(RuntimeState* state);
 
+    // Cut the chunk to the rows that can make the top-n if it's already in the order of the sort keys,
+    // |chunk| is reset if none of them can. Return false if the chunk isn't presorted.
+    bool _prune_presorted_chunk(ChunkPtr* chunk);
+
     // build data for top-n
     [[nodiscard]] Status _build_sorting_data(RuntimeState* state, Permutation& permutation_second,
                                              DataSegments& segments);
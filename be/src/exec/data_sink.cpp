@@ -38,12 +38,14 @@
 #include <map>
 #include <memory>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "connector/connector.h"
 #include "connector/file_chunk_sink.h"
 #include "connector/file_connector.h"
 #include "connector/hive_chunk_sink.h"
 #include "connector/iceberg_chunk_sink.h"
+#include "exec/exchange_node.h"
 #include "exec/exec_node.h"
 #include "exec/file_builder.h"
 #include "exec/hdfs_scanner_text.h"
@@ -271,6 +273,17 @@ Status DataSink::decompose_data_sink_to_pipeline(pipeline::PipelineBuilderContex
                     context->next_operator_id(), result_sink->get_sink_type(), result_sink->isBinaryFormat(),
                     result_sink->get_format_type(), result_sink->get_output_exprs(), fragment_ctx);
         }
+        // The rows of a MySQL protocol result are serialized by the result sink, so an unordered result gathered by
+        // a single exchange driver is passed through to data sink dop drivers to serialize it in parallel.
+        // A merging exchange or any other root may produce ordered rows, which must be sent in order.
+        auto* root = fragment_ctx->plan();
+        if (config::enable_parallel_mysql_result_sink &&
+            result_sink->get_sink_type() == TResultSinkType::MYSQL_PROTOCAL && dop < context->data_sink_dop() &&
+            root->type() == TPlanNodeType::EXCHANGE_NODE && !down_cast<ExchangeNode*>(root)->is_merging()) {
+            prev_operators = context->maybe_interpolate_local_passthrough_exchange(
+                    runtime_state, Operator::s_pseudo_plan_node_id_for_final_sink, prev_operators,
+                    context->data_sink_dop());
+        }
         // Add result sink operator to last pipeline
         prev_operators.emplace_back(op);
         context->add_pipeline(std::move(prev_operators));
@@ -124,6 +124,13 @@ std::string ESScrollQueryBuilder::build(const std::map<std::string, std::string>
     es_query_dsl.AddMember("sort", sort_node, allocator);
     // number of docuements returned
     es_query_dsl.AddMember("size", size, allocator);
+    // read one slice of the shard, which is split into several sliced scrolls read concurrently
+    if (properties.find(ESScanReader::KEY_NUM_SLICES) != properties.end()) {
+        rapidjson::Value slice_node(rapidjson::kObjectType);
+        slice_node.AddMember("id", atoi(properties.at(ESScanReader::KEY_SLICE_ID).c_str()), allocator);
+        slice_node.AddMember("max", atoi(properties.at(ESScanReader::KEY_NUM_SLICES).c_str()), allocator);
+        es_query_dsl.AddMember("slice", slice_node, allocator);
+    }
     rapidjson::StringBuffer buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
     es_query_dsl.Accept(writer);
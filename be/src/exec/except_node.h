@@ -34,6 +34,7 @@ namespace starrocks {
 class DescriptorTbl;
 class SlotDescriptor;
 class TupleDescriptor;
+class RuntimeFilterBuildDescriptor;
 } // namespace starrocks
 
 namespace starrocks {
@@ -73,6 +74,8 @@ private:
     const TupleDescriptor* _tuple_desc;
     // Exprs materialized by this node. The i-th result expr list refers to the i-th child.
     std::vector<std::vector<ExprContext*>> _child_expr_lists;
+    // Runtime filters built from the keys of the first child, only used by the pipeline engine.
+    std::vector<RuntimeFilterBuildDescriptor*> _build_runtime_filters;
 
     struct ExceptColumnTypes {
         TypeDescriptor result_type;
@@ -35,6 +35,7 @@
 #include "exec/exchange_node.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/chunk_accumulate_operator.h"
 #include "exec/pipeline/exchange/exchange_merge_sort_source_operator.h"
 #include "exec/pipeline/exchange/exchange_parallel_merge_source_operator.h"
@@ -245,6 +246,16 @@ void ExchangeNode::debug_string(int indentation_level, std::stringstream* out) c
     *out << ")";
 }
 
+bool ExchangeNode::_use_parallel_merge(size_t dop) const {
+    if (_is_parallel_merge || _sort_exec_exprs.is_constant_lhs_ordering()) {
+        return true;
+    }
+    // With a limit the single merger stops early, so only unbounded merges over many senders are worth
+    // spreading across all the drivers.
+    const int min_senders = config::exchange_parallel_merge_min_senders;
+    return min_senders > 0 && _limit < 0 && dop > 1 && _num_senders >= min_senders;
+}
+
 pipeline::OpFactories ExchangeNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
     auto exec_group = context->find_exec_group_by_plan_node_id(_id);
@@ -258,7 +269,7 @@ pipeline::OpFactories ExchangeNode::decompose_to_pipeline(pipeline::PipelineBuil
         exchange_source_op->set_degree_of_parallelism(context->degree_of_parallelism());
         operators.emplace_back(exchange_source_op);
     } else {
-        if (_is_parallel_merge || _sort_exec_exprs.is_constant_lhs_ordering()) {
+        if (_use_parallel_merge(context->degree_of_parallelism())) {
             auto exchange_merge_sort_source_operator = std::make_shared<ExchangeParallelMergeSourceOperatorFactory>(
                     context->next_operator_id(), id(), _num_senders, _input_row_desc, &_sort_exec_exprs, _is_asc_order,
                     _nulls_first, _offset, _limit);
@@ -70,6 +70,8 @@ public:
     // the number of senders needs to be set after the c'tor, because it's not
     // recorded in TPlanNode, and before calling prepare()
     void set_num_senders(int num_senders) { _num_senders = num_senders; }
+    // whether the rows are merged in the order of the sort exprs.
+    bool is_merging() const { return _is_merging; }
 
     std::vector<std::shared_ptr<pipeline::OperatorFactory>> decompose_to_pipeline(
             pipeline::PipelineBuilderContext* context) override;
@@ -82,6 +84,10 @@ private:
     // call to the underlying DataStreamRecvr.
     Status get_next_merging(RuntimeState* state, ChunkPtr* chunk, bool* eos);
 
+    // Whether the merging exchange is decomposed into ExchangeParallelMergeSourceOperators instead of
+    // a single ExchangeMergeSortSourceOperator.
+    bool _use_parallel_merge(size_t dop) const;
+
     const TExchangeNode& _texchange_node;
 
     int _num_senders; // needed for _stream_recvr construction
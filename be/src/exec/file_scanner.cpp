@@ -20,6 +20,7 @@
 #include "column/column_helper.h"
 #include "column/hash_set.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/csv_scanner.h"
 #include "exec/orc_scanner.h"
 #include "exec/parquet_scanner.h"
@@ -318,7 +319,11 @@ Status FileScanner::create_sequential_file(const TBrokerRangeDesc& range_desc, c
     using DecompressorPtr = std::shared_ptr<StreamCompression>;
     std::unique_ptr<StreamCompression> dec;
     RETURN_IF_ERROR(StreamCompression::create_decompressor(compression, &dec));
-    auto stream = std::make_unique<io::CompressedInputStream>(src_file->stream(), DecompressorPtr(dec.release()));
+    std::shared_ptr<io::InputStream> stream =
+            std::make_shared<io::CompressedInputStream>(src_file->stream(), DecompressorPtr(dec.release()));
+    if (int num_buffers = config::load_async_decompression_buffers; num_buffers > 0) {
+        stream = std::make_shared<io::AsyncCompressedInputStream>(std::move(stream), num_buffers);
+    }
     *file = std::make_shared<SequentialFile>(std::move(stream), range_desc.path);
     return Status::OK();
 }
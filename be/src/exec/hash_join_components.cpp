@@ -93,4 +93,10 @@ Status HashJoinBuilder::build(RuntimeState* state) {
     return Status::OK();
 }
 
+void HashJoinBuilder::share_build(std::shared_ptr<const JoinHashTableItems> build, RuntimeState* state) {
+    _key_columns.clear();
+    _ht.share_build(std::move(build), state);
+    _ready = true;
+}
+
 } // namespace starrocks
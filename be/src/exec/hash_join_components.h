@@ -63,6 +63,9 @@ public:
 
     Status build(RuntimeState* state);
 
+    // Shares the items built by the builder of the same join in another fragment instance instead of building.
+    void share_build(std::shared_ptr<const JoinHashTableItems> build, RuntimeState* state);
+
     size_t hash_table_row_count() { return _ht.get_row_count(); }
 
     void reset_probe(RuntimeState* state);
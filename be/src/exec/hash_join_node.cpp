@@ -16,17 +16,21 @@
 
 #include <runtime/runtime_state.h>
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/hash_joiner.h"
 #include "exec/pipeline/chunk_accumulate_operator.h"
 #include "exec/pipeline/exchange/exchange_source_operator.h"
 #include "exec/pipeline/group_execution/execution_group_builder.h"
 #include "exec/pipeline/group_execution/execution_group_fwd.h"
+#include "exec/pipeline/hashjoin/asof_join_build_operator.h"
+#include "exec/pipeline/hashjoin/asof_join_probe_operator.h"
 #include "exec/pipeline/hashjoin/hash_join_build_operator.h"
 #include "exec/pipeline/hashjoin/hash_join_probe_operator.h"
 #include "exec/pipeline/hashjoin/hash_joiner_factory.h"
@@ -128,6 +132,26 @@ Status HashJoinNode::init(const TPlanNode& tnode, RuntimeState* state) {
     RETURN_IF_ERROR(Expr::create_expr_trees(_pool, tnode.hash_join_node.other_join_conjuncts,
                                             &_other_join_conjunct_ctxs, state));
 
+    if (is_asof_join(_join_type)) {
+        if (!tnode.hash_join_node.__isset.asof_join_condition) {
+            return Status::InternalError("asof join without asof_join_condition");
+        }
+        RETURN_IF_ERROR(
+                Expr::create_expr_tree(_pool, tnode.hash_join_node.asof_join_condition, &_asof_join_ctx, state));
+        const Expr* asof_condition = _asof_join_ctx->root();
+        const auto op = asof_condition->op();
+        if (asof_condition->get_num_children() != 2 ||
+            (op != TExprOpcode::LT && op != TExprOpcode::LE && op != TExprOpcode::GT && op != TExprOpcode::GE)) {
+            return Status::NotSupported("asof join condition must be one of <, <=, > and >=");
+        }
+        if (!_other_join_conjunct_ctxs.empty()) {
+            return Status::NotSupported("asof join doesn't support other join conjuncts");
+        }
+        if (std::any_of(_is_null_safes.begin(), _is_null_safes.end(), [](bool null_safe) { return null_safe; })) {
+            return Status::NotSupported("asof join doesn't support null-safe equal join conjuncts");
+        }
+    }
+
     for (const auto& desc : tnode.hash_join_node.build_runtime_filters) {
         auto* rf_desc = _pool->add(new RuntimeFilterBuildDescriptor());
         RETURN_IF_ERROR(rf_desc->init(_pool, desc, state));
@@ -226,6 +250,10 @@ Status HashJoinNode::open(RuntimeState* state) {
     ScopedTimer<MonotonicStopWatch> build_timer(_build_timer);
     RETURN_IF_CANCELLED(state);
 
+    if (is_asof_join(_join_type)) {
+        return Status::NotSupported("asof join is only supported by the pipeline engine");
+    }
+
     RETURN_IF_ERROR(ExecNode::open(state));
     RETURN_IF_ERROR(Expr::open(_build_expr_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_probe_expr_ctxs, state));
@@ -429,6 +457,14 @@ void HashJoinNode::close(RuntimeState* state) {
 template <class HashJoinerFactory, class HashJoinBuilderFactory, class HashJoinProbeFactory>
 pipeline::OpFactories HashJoinNode::_decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
+    // The fragment instances of a broadcast join on this BE receive the same build rows from the exchange, unless
+    // they are filtered by the runtime filters of each instance or cut by a limit, so they can share one hash table.
+    // The runtime filters are moved out of the exchange node while decomposing it.
+    const bool share_broadcast_build =
+            config::enable_broadcast_join_build_sharing && _distribution_mode == TJoinDistributionMode::BROADCAST &&
+            std::is_same_v<HashJoinBuilderFactory, HashJoinBuildOperatorFactory> &&
+            child(1)->type() == TPlanNodeType::EXCHANGE_NODE && child(1)->limit() == -1 &&
+            child(1)->runtime_filter_collector().empty();
     auto rhs_operators = child(1)->decompose_to_pipeline(context);
     // "col NOT IN (NULL, val1, val2)" always returns false, so hash join should
     // return empty result in this case. Hash join cannot be divided into multiple
@@ -495,6 +531,7 @@ pipeline::OpFactories HashJoinNode::_decompose_to_pipeline(pipeline::PipelineBui
                                                              std::move(partial_rf_merger), _distribution_mode,
                                                              build_side_spill_channel_factory);
     this->init_runtime_filter_for_operator(build_op.get(), context, rc_rf_probe_collector);
+    build_op->set_share_broadcast_build(share_broadcast_build);
 
     auto probe_op = std::make_shared<HashJoinProbeFactory>(context->next_operator_id(), id(), hash_joiner_factory);
     this->init_runtime_filter_for_operator(probe_op.get(), context, rc_rf_probe_collector);
@@ -564,8 +601,54 @@ pipeline::OpFactories HashJoinNode::_decompose_to_pipeline(pipeline::PipelineBui
     return lhs_operators;
 }
 
+pipeline::OpFactories HashJoinNode::_decompose_asof_join_to_pipeline(pipeline::PipelineBuilderContext* context) {
+    using namespace pipeline;
+
+    // All the builders append rows to a shared AsofJoinContext, which sorts the whole build side once, so every
+    // prober can search the build rows regardless of how both sides are distributed.
+    auto rhs_operators = child(1)->decompose_to_pipeline(context);
+    context->fragment_context()->runtime_filter_hub()->add_holder(_id);
+    auto rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
+
+    AsofJoinContextParams params;
+    params.plan_node_id = _id;
+    params.join_type = _join_type;
+    params.build_expr_ctxs = _build_expr_ctxs;
+    params.asof_join_ctx = _asof_join_ctx;
+    params.build_row_desc = &child(1)->row_desc();
+    params.rf_hub = context->fragment_context()->runtime_filter_hub();
+    auto asof_join_context = std::make_shared<AsofJoinContext>(std::move(params));
+
+    auto build_op =
+            std::make_shared<AsofJoinBuildOperatorFactory>(context->next_operator_id(), id(), asof_join_context);
+    this->init_runtime_filter_for_operator(build_op.get(), context, rc_rf_probe_collector);
+    rhs_operators.emplace_back(std::move(build_op));
+    context->add_pipeline(rhs_operators);
+    context->push_dependent_pipeline(context->last_pipeline());
+    DeferOp pop_dependent_pipeline([context]() { context->pop_dependent_pipeline(); });
+
+    auto lhs_operators = child(0)->decompose_to_pipeline(context);
+    auto probe_op = std::make_shared<AsofJoinProbeOperatorFactory>(
+            context->next_operator_id(), id(), _join_type, child(0)->row_desc(), child(1)->row_desc(),
+            _build_expr_ctxs, _probe_expr_ctxs, _asof_join_ctx, _conjunct_ctxs, std::move(asof_join_context));
+    this->init_runtime_filter_for_operator(probe_op.get(), context, rc_rf_probe_collector);
+    if (!context->is_colocate_group()) {
+        lhs_operators = context->maybe_interpolate_local_adpative_passthrough_exchange(
+                runtime_state(), id(), lhs_operators, context->degree_of_parallelism());
+    }
+    lhs_operators.emplace_back(std::move(probe_op));
+
+    if (limit() != -1) {
+        lhs_operators.emplace_back(std::make_shared<LimitOperatorFactory>(context->next_operator_id(), id(), limit()));
+    }
+    return lhs_operators;
+}
+
 pipeline::OpFactories HashJoinNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
+    if (is_asof_join(_join_type)) {
+        return _decompose_asof_join_to_pipeline(context);
+    }
     // now spill only support INNER_JOIN and LEFT-SEMI JOIN. we could implement LEFT_OUTER_JOIN later
     if (runtime_state()->enable_spill() && runtime_state()->enable_hash_join_spill() && is_spillable(_join_type)) {
         return _decompose_to_pipeline<HashJoinerFactory, SpillableHashJoinBuildOperatorFactory,
@@ -52,6 +52,7 @@ public:
 private:
     template <class HashJoinerFactory, class HashJoinBuilderFactory, class HashJoinProbeFactory>
     pipeline::OpFactories _decompose_to_pipeline(pipeline::PipelineBuilderContext* context);
+    pipeline::OpFactories _decompose_asof_join_to_pipeline(pipeline::PipelineBuilderContext* context);
 
     static bool _has_null(const ColumnPtr& column);
 
@@ -96,6 +97,8 @@ private:
     std::vector<ExprContext*> _build_expr_ctxs;
     std::vector<ExprContext*> _other_join_conjunct_ctxs;
     std::vector<bool> _is_null_safes;
+    // The inequality of ASOF joins, probe_expr op build_expr.
+    ExprContext* _asof_join_ctx = nullptr;
 
     // If distribution type is SHUFFLE_HASH_BUCKET, local shuffle can use the
     // equivalence of ExchagneNode's partition colums
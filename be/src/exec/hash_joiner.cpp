@@ -39,6 +39,7 @@ void HashJoinProbeMetrics::prepare(RuntimeProfile* runtime_profile) {
     probe_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "ProbeConjunctEvaluateTime");
     other_join_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "OtherJoinConjunctEvaluateTime");
     where_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "WhereConjunctEvaluateTime");
+    prefetch_rows_counter = ADD_COUNTER(runtime_profile, "HashTablePrefetchRows", TUnit::UNIT);
 }
 
 void HashJoinBuildMetrics::prepare(RuntimeProfile* runtime_profile) {
@@ -50,6 +51,7 @@ void HashJoinBuildMetrics::prepare(RuntimeProfile* runtime_profile) {
     runtime_filter_num = ADD_COUNTER(runtime_profile, "RuntimeFilterNum", TUnit::UNIT);
     build_keys_per_bucket = ADD_COUNTER(runtime_profile, "BuildKeysPerBucket%", TUnit::UNIT);
     hash_table_memory_usage = ADD_COUNTER(runtime_profile, "HashTableMemoryUsage", TUnit::BYTES);
+    hash_table_huge_page_bytes = ADD_COUNTER(runtime_profile, "HashTableHugePageBytes", TUnit::BYTES);
 }
 
 HashJoiner::HashJoiner(const HashJoinerParam& param)
@@ -125,11 +127,12 @@ Status HashJoiner::prepare_prober(RuntimeState* state, RuntimeProfile* runtime_p
 
     auto& hash_table = _hash_join_builder->hash_table();
     hash_table.set_probe_profile(probe_metrics().search_ht_timer, probe_metrics().output_probe_column_timer,
-                                 probe_metrics().output_build_column_timer);
+                                 probe_metrics().output_build_column_timer, probe_metrics().prefetch_rows_counter);
 
     _hash_table_param.search_ht_timer = probe_metrics().search_ht_timer;
     _hash_table_param.output_build_column_timer = probe_metrics().output_build_column_timer;
     _hash_table_param.output_probe_column_timer = probe_metrics().output_probe_column_timer;
+    _hash_table_param.prefetch_rows_counter = probe_metrics().prefetch_rows_counter;
 
     return Status::OK();
 }
@@ -207,11 +210,24 @@ Status HashJoiner::build_ht(RuntimeState* state) {
         size_t bucket_size = _hash_join_builder->hash_table().get_bucket_size();
         COUNTER_SET(build_metrics().build_buckets_counter, static_cast<int64_t>(bucket_size));
         COUNTER_SET(build_metrics().build_keys_per_bucket, static_cast<int64_t>(100 * avg_keys_per_bucket()));
+        COUNTER_SET(build_metrics().hash_table_huge_page_bytes,
+                    static_cast<int64_t>(_hash_join_builder->hash_table().get_huge_page_bytes()));
     }
 
     return Status::OK();
 }
 
+void HashJoiner::share_build_ht(RuntimeState* state, std::shared_ptr<const JoinHashTableItems> build) {
+    if (_phase == HashJoinPhase::BUILD) {
+        _hash_join_builder->share_build(std::move(build), state);
+        // The rows appended to this builder are dropped.
+        _hash_table_build_rows = _hash_join_builder->hash_table_row_count();
+        size_t bucket_size = _hash_join_builder->hash_table().get_bucket_size();
+        COUNTER_SET(build_metrics().build_buckets_counter, static_cast<int64_t>(bucket_size));
+        COUNTER_SET(build_metrics().build_keys_per_bucket, static_cast<int64_t>(100 * avg_keys_per_bucket()));
+    }
+}
+
 bool HashJoiner::need_input() const {
     // when _buffered_chunk accumulates several chunks to form into a large enough chunk, it is moved into
     // _probe_chunk for probe operations.
@@ -315,7 +331,7 @@ void HashJoiner::reference_hash_table(HashJoiner* src_join_builder) {
     _hash_table_param = src_join_builder->hash_table_param();
     hash_table = src_join_builder->_hash_join_builder->hash_table().clone_readable_table();
     hash_table.set_probe_profile(probe_metrics().search_ht_timer, probe_metrics().output_probe_column_timer,
-                                 probe_metrics().output_build_column_timer);
+                                 probe_metrics().output_build_column_timer, probe_metrics().prefetch_rows_counter);
 
     // _hash_table_build_rows is root truth, it used to by _short_circuit_break().
     _hash_table_build_rows = src_join_builder->_hash_table_build_rows;
@@ -133,6 +133,10 @@ inline bool has_post_probe(TJoinOp::type join_type) {
            join_type == TJoinOp::FULL_OUTER_JOIN;
 }
 
+inline bool is_asof_join(TJoinOp::type join_type) {
+    return join_type == TJoinOp::ASOF_INNER_JOIN || join_type == TJoinOp::ASOF_LEFT_OUTER_JOIN;
+}
+
 inline bool is_spillable(TJoinOp::type join_type) {
     return join_type == TJoinOp::LEFT_SEMI_JOIN || join_type == TJoinOp::INNER_JOIN ||
            join_type == TJoinOp::LEFT_ANTI_JOIN || join_type == TJoinOp::LEFT_OUTER_JOIN ||
@@ -147,6 +151,7 @@ struct HashJoinProbeMetrics {
     RuntimeProfile::Counter* other_join_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* where_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
+    RuntimeProfile::Counter* prefetch_rows_counter = nullptr;
 
     void prepare(RuntimeProfile* runtime_profile);
 };
@@ -160,6 +165,7 @@ struct HashJoinBuildMetrics {
     RuntimeProfile::Counter* runtime_filter_num = nullptr;
     RuntimeProfile::Counter* build_keys_per_bucket = nullptr;
     RuntimeProfile::Counter* hash_table_memory_usage = nullptr;
+    RuntimeProfile::Counter* hash_table_huge_page_bytes = nullptr;
 
     void prepare(RuntimeProfile* runtime_profile);
 };
@@ -209,6 +215,8 @@ public:
     [[nodiscard]] Status append_spill_task(RuntimeState* state, std::function<StatusOr<ChunkPtr>()>& spill_task);
 
     [[nodiscard]] Status build_ht(RuntimeState* state);
+    // Shares the hash table built by the same join of another fragment instance instead of building one.
+    void share_build_ht(RuntimeState* state, std::shared_ptr<const JoinHashTableItems> build);
     // probe phase
     [[nodiscard]] Status push_chunk(RuntimeState* state, ChunkPtr&& chunk);
     [[nodiscard]] StatusOr<ChunkPtr> pull_chunk(RuntimeState* state);
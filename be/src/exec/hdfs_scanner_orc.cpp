@@ -16,6 +16,9 @@
 
 #include <utility>
 
+#include "block_cache/block_cache.h"
+#include "block_cache/datacache_utils.h"
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "exec/iceberg/iceberg_delete_builder.h"
 #include "formats/orc/orc_chunk_reader.h"
@@ -445,6 +448,49 @@ Status HdfsOrcScanner::build_split_tasks(orc::Reader* reader, const std::vector<
     return Status::OK();
 }
 
+std::string HdfsOrcScanner::_build_metacache_key() {
+    return DataCacheUtils::calc_metacache_key(_file->filename(), _scanner_params.file_size,
+                                              _scanner_params.modification_time, "ot");
+}
+
+std::shared_ptr<std::string> HdfsOrcScanner::_read_file_tail_from_cache() {
+#ifdef WITH_STARCACHE
+    // Only support file metacache in starcache engine
+    if (!_scanner_ctx.use_file_metacache || !config::datacache_enable) {
+        return nullptr;
+    }
+    SCOPED_RAW_TIMER(&_app_stats.footer_cache_read_ns);
+    CacheHandle cache_handle;
+    Status st = BlockCache::instance()->read_object(_build_metacache_key(), &cache_handle);
+    if (st.ok()) {
+        _app_stats.footer_cache_read_count += 1;
+        return *(static_cast<const std::shared_ptr<std::string>*>(cache_handle.ptr()));
+    }
+#endif
+    return nullptr;
+}
+
+void HdfsOrcScanner::_write_file_tail_to_cache(orc::Reader* reader) {
+#ifdef WITH_STARCACHE
+    if (!_scanner_ctx.use_file_metacache || !config::datacache_enable) {
+        return;
+    }
+    // The serialized file tail contains the postscript, the footer and the metadata of the file, which
+    // lets the next reader skip reading them.
+    auto file_tail = std::make_shared<std::string>(reader->getSerializedFileTail());
+    size_t size = file_tail->size();
+    // cache does not understand shared ptr at all, so we have to new a object to hold this shared ptr.
+    auto* capture = new std::shared_ptr<std::string>(std::move(file_tail));
+    auto deleter = [capture]() { delete capture; };
+    CacheHandle cache_handle;
+    Status st = BlockCache::instance()->write_object(_build_metacache_key(), capture, size, deleter, &cache_handle);
+    if (st.ok()) {
+        _app_stats.footer_cache_write_bytes += size;
+        _app_stats.footer_cache_write_count += 1;
+    }
+#endif
+}
+
 Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
     // create wrapped input stream.
     RETURN_IF_ERROR(open_random_access_file());
@@ -459,15 +505,23 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
     // create orc reader on this input stream.
     SCOPED_RAW_TIMER(&_app_stats.reader_init_ns);
     std::unique_ptr<orc::Reader> reader;
+    std::shared_ptr<std::string> file_tail;
+    if (_scanner_ctx.split_context != nullptr) {
+        file_tail = down_cast<const SplitContext*>(_scanner_ctx.split_context)->footer;
+    } else {
+        file_tail = _read_file_tail_from_cache();
+    }
     try {
         errno = 0;
         orc::ReaderOptions options;
         options.setMemoryPool(*getOrcMemoryPool());
-        if (_scanner_ctx.split_context != nullptr) {
-            auto* split_context = down_cast<const SplitContext*>(_scanner_ctx.split_context);
-            options.setSerializedFileTail(*(split_context->footer.get()));
+        if (file_tail != nullptr) {
+            options.setSerializedFileTail(*file_tail);
         }
         reader = orc::createReader(std::move(_input_stream), options);
+        if (file_tail == nullptr) {
+            _write_file_tail_to_cache(reader.get());
+        }
     } catch (std::exception& e) {
         bool is_not_found = (errno == ENOENT);
         auto s = strings::Substitute("HdfsOrcScanner::do_open failed. reason = $0", e.what());
@@ -708,6 +762,16 @@ void HdfsOrcScanner::do_update_counter(HdfsScanProfile* profile) {
     COUNTER_UPDATE(stripe_active_lazy_coalesce_seperately_counter,
                    _app_stats.orc_stripe_active_lazy_coalesce_seperately);
 
+    RuntimeProfile::Counter* footer_cache_read_counter =
+            ADD_CHILD_COUNTER(root_profile, "FooterCacheReadCount", TUnit::UNIT, orcProfileSectionPrefix);
+    RuntimeProfile::Counter* footer_cache_write_counter =
+            ADD_CHILD_COUNTER(root_profile, "FooterCacheWriteCount", TUnit::UNIT, orcProfileSectionPrefix);
+    RuntimeProfile::Counter* footer_cache_write_bytes =
+            ADD_CHILD_COUNTER(root_profile, "FooterCacheWriteBytes", TUnit::BYTES, orcProfileSectionPrefix);
+    COUNTER_UPDATE(footer_cache_read_counter, _app_stats.footer_cache_read_count);
+    COUNTER_UPDATE(footer_cache_write_counter, _app_stats.footer_cache_write_count);
+    COUNTER_UPDATE(footer_cache_write_bytes, _app_stats.footer_cache_write_bytes);
+
     if (_orc_reader != nullptr) {
         // _orc_reader is nullptr for split task
         root_profile->add_info_string("ORCSearchArgument: ", _orc_reader->get_search_argument_string());
@@ -56,6 +56,11 @@ private:
     Status build_io_ranges(ORCHdfsFileStream* file_stream, const std::vector<DiskRange>& stripes);
     Status resolve_columns(orc::Reader* reader);
 
+    // Cache the serialized file tail by the metacache, so that the footer of the file is not read again.
+    std::string _build_metacache_key();
+    std::shared_ptr<std::string> _read_file_tail_from_cache();
+    void _write_file_tail_to_cache(orc::Reader* reader);
+
     // disable orc search argument would be much easier for
     // writing unittest of customized filter
     bool _use_orc_sargs;
@@ -14,10 +14,12 @@
 
 #include "exec/hdfs_scanner_parquet.h"
 
+#include "common/config.h"
 #include "exec/hdfs_scanner.h"
 #include "exec/iceberg/iceberg_delete_builder.h"
 #include "formats/parquet/file_reader.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -142,10 +144,27 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     do_update_iceberg_v2_counter(root, kParquetProfileSectionPrefix);
     COUNTER_UPDATE(rows_before_page_index, _app_stats.rows_before_page_index);
     COUNTER_UPDATE(page_index_timer, _app_stats.page_index_ns);
+
+    if (_shared_buffered_input_stream != nullptr && _shared_buffered_input_stream->prefetch_count() > 0) {
+        RuntimeProfile::Counter* prefetch_counter =
+                ADD_CHILD_COUNTER(root, "PrefetchCount", TUnit::UNIT, kParquetProfileSectionPrefix);
+        RuntimeProfile::Counter* prefetch_bytes =
+                ADD_CHILD_COUNTER(root, "PrefetchBytes", TUnit::BYTES, kParquetProfileSectionPrefix);
+        RuntimeProfile::Counter* prefetch_wait_timer =
+                ADD_CHILD_TIMER(root, "PrefetchWaitTime", kParquetProfileSectionPrefix);
+        COUNTER_UPDATE(prefetch_counter, _shared_buffered_input_stream->prefetch_count());
+        COUNTER_UPDATE(prefetch_bytes, _shared_buffered_input_stream->prefetch_bytes());
+        COUNTER_UPDATE(prefetch_wait_timer, _shared_buffered_input_stream->prefetch_wait_timer());
+    }
 }
 
 Status HdfsParquetScanner::do_open(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(open_random_access_file());
+    // The prefetching reads the remote file directly, which would bypass the datacache.
+    if (config::parquet_prefetch_next_row_group_enable && _cache_input_stream == nullptr &&
+        _shared_buffered_input_stream != nullptr) {
+        _shared_buffered_input_stream->set_prefetch_pool(ExecEnv::GetInstance()->lake_read_prefetch_pool());
+    }
     // create file reader
     _reader = std::make_shared<parquet::FileReader>(runtime_state->chunk_size(), _file.get(), _file->get_size().value(),
                                                     _scanner_params.modification_time,
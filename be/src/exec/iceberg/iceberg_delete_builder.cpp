@@ -17,6 +17,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/hdfs_scanner.h"
 #include "exec/iceberg/iceberg_delete_file_iterator.h"
+#include "exec/iceberg/iceberg_position_delete_cache.h"
 #include "formats/orc/orc_chunk_reader.h"
 #include "formats/orc/orc_input_stream.h"
 #include "formats/parquet/file_reader.h"
@@ -38,8 +39,38 @@ static const IcebergColumnMeta k_delete_file_path{
 static const IcebergColumnMeta k_delete_file_pos{
         .id = INT32_MAX - 102, .col_name = "pos", .type = TPrimitiveType::BIGINT};
 
-Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
-                                           int64_t file_length, std::set<int64_t>* need_skip_rowids) {
+Status PositionDeleteBuilder::build(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                                    std::set<int64_t>* need_skip_rowids) {
+    auto* cache = IcebergPositionDeleteCache::instance();
+    if (!cache->enabled()) {
+        return read(timezone, file_path, file_length, [&](const Slice& datafile_path, int64_t pos) {
+            if (datafile_path == _datafile_path) {
+                need_skip_rowids->emplace(pos);
+            }
+        });
+    }
+
+    auto load = [&](IcebergPositionDeleteCache::DeleteFile* delete_file) {
+        // The rows of a delete file are sorted by file_path, so the positions of the last data file are reused.
+        std::string last_path;
+        std::vector<int64_t>* positions = nullptr;
+        return read(timezone, file_path, file_length, [&](const Slice& datafile_path, int64_t pos) {
+            if (positions == nullptr || datafile_path != last_path) {
+                last_path = datafile_path.to_string();
+                positions = &(*delete_file)[last_path];
+            }
+            positions->push_back(pos);
+        });
+    };
+    ASSIGN_OR_RETURN(auto delete_file, cache->get_or_load(file_path, file_length, load));
+    if (auto it = delete_file->find(_datafile_path); it != delete_file->end()) {
+        need_skip_rowids->insert(it->second.begin(), it->second.end());
+    }
+    return Status::OK();
+}
+
+Status ParquetPositionDeleteBuilder::read(const std::string& timezone, const std::string& delete_file_path,
+                                          int64_t file_length, const PositionConsumer& consumer) {
     std::vector<SlotDescriptor*> slot_descriptors{&(IcebergDeleteFileMeta::get_delete_file_path_slot()),
                                                   &(IcebergDeleteFileMeta::get_delete_file_pos_slot())};
     auto iter = std::make_unique<IcebergDeleteFileIterator>();
@@ -57,9 +88,8 @@ Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const st
         ::arrow::StringArray* file_path_array = static_cast<arrow::StringArray*>(batch->column(0).get());
         ::arrow::Int64Array* pos_array = static_cast<arrow::Int64Array*>(batch->column(1).get());
         for (size_t row = 0; row < batch->num_rows(); row++) {
-            if (file_path_array->Value(row) == _datafile_path) {
-                need_skip_rowids->emplace(pos_array->Value(row));
-            }
+            auto file_path = file_path_array->GetView(row);
+            consumer(Slice(file_path.data(), file_path.size()), pos_array->Value(row));
         }
     }
 
@@ -71,8 +101,8 @@ Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const st
     return Status::OK();
 }
 
-Status ORCPositionDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
-                                       int64_t file_length, std::set<int64_t>* need_skip_rowids) {
+Status ORCPositionDeleteBuilder::read(const std::string& timezone, const std::string& delete_file_path,
+                                      int64_t file_length, const PositionConsumer& consumer) {
     std::vector<SlotDescriptor*> slot_descriptors{&(IcebergDeleteFileMeta::get_delete_file_path_slot()),
                                                   &(IcebergDeleteFileMeta::get_delete_file_pos_slot())};
 
@@ -125,10 +155,7 @@ Status ORCPositionDeleteBuilder::build(const std::string& timezone, const std::s
         auto* file_path_col = static_cast<BinaryColumn*>(chunk->get_column_by_slot_id(k_delete_file_path.id).get());
         auto* position_col = static_cast<Int64Column*>(chunk->get_column_by_slot_id(k_delete_file_pos.id).get());
         for (auto row = 0; row < chunk_size; row++) {
-            if (file_path_col->get_slice(row) != _datafile_path) {
-                continue;
-            }
-            need_skip_rowids->emplace(position_col->get_data()[row]);
+            consumer(file_path_col->get_slice(row), position_col->get_data()[row]);
         }
     }
 }
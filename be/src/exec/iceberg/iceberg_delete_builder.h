@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <functional>
 #include <utility>
 
 #include "common/status.h"
@@ -22,17 +23,29 @@
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/descriptors.h"
+#include "util/slice.h"
 
 namespace starrocks {
 struct IcebergColumnMeta;
 
 class PositionDeleteBuilder {
 public:
-    PositionDeleteBuilder() = default;
+    explicit PositionDeleteBuilder(std::string datafile_path) : _datafile_path(std::move(datafile_path)) {}
     virtual ~PositionDeleteBuilder() = default;
 
-    virtual Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
-                         std::set<int64_t>* need_skip_rowids) = 0;
+    // Collect the positions of the data file deleted by the delete file into |need_skip_rowids|. The delete file
+    // is read through IcebergPositionDeleteCache if it is enabled, so it is read once for all the data files.
+    Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                 std::set<int64_t>* need_skip_rowids);
+
+protected:
+    using PositionConsumer = std::function<void(const Slice& datafile_path, int64_t pos)>;
+
+    // Read all the (file_path, pos) rows of the delete file.
+    virtual Status read(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                        const PositionConsumer& consumer) = 0;
+
+    const std::string _datafile_path;
 };
 
 class EqualityDeleteBuilder {
@@ -82,29 +95,29 @@ private:
 class ORCPositionDeleteBuilder : public PositionDeleteBuilder {
 public:
     ORCPositionDeleteBuilder(FileSystem* fs, std::string datafile_path)
-            : _fs(fs), _datafile_path(std::move(datafile_path)) {}
+            : PositionDeleteBuilder(std::move(datafile_path)), _fs(fs) {}
     ~ORCPositionDeleteBuilder() override = default;
 
-    Status build(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
-                 std::set<int64_t>* need_skip_rowids) override;
+protected:
+    Status read(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
+                const PositionConsumer& consumer) override;
 
 private:
     FileSystem* _fs;
-    std::string _datafile_path;
 };
 
 class ParquetPositionDeleteBuilder : public PositionDeleteBuilder {
 public:
     ParquetPositionDeleteBuilder(FileSystem* fs, std::string datafile_path)
-            : _fs(fs), _datafile_path(std::move(datafile_path)) {}
+            : PositionDeleteBuilder(std::move(datafile_path)), _fs(fs) {}
     ~ParquetPositionDeleteBuilder() override = default;
 
-    Status build(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
-                 std::set<int64_t>* need_skip_rowids) override;
+protected:
+    Status read(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
+                const PositionConsumer& consumer) override;
 
 private:
     FileSystem* _fs;
-    std::string _datafile_path;
 };
 
 class IcebergDeleteBuilder {
@@ -0,0 +1,113 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/iceberg/iceberg_position_delete_cache.h"
+
+#include <fmt/format.h>
+
+#include "common/config.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+static void delete_file_deleter(const CacheKey& key, void* value) {
+    delete static_cast<IcebergPositionDeleteCache::DeleteFilePtr*>(value);
+}
+
+static size_t delete_file_charge(const IcebergPositionDeleteCache::DeleteFile& delete_file) {
+    size_t charge = sizeof(IcebergPositionDeleteCache::DeleteFile);
+    for (const auto& [data_file, positions] : delete_file) {
+        charge += data_file.size() + positions.capacity() * sizeof(int64_t) + 64;
+    }
+    return charge;
+}
+
+IcebergPositionDeleteCache* IcebergPositionDeleteCache::instance() {
+    static IcebergPositionDeleteCache cache(std::max<int64_t>(config::iceberg_position_delete_cache_capacity, 0));
+    return &cache;
+}
+
+IcebergPositionDeleteCache::IcebergPositionDeleteCache(size_t capacity) {
+    if (capacity > 0) {
+        _cache.reset(new_lru_cache(capacity));
+    }
+}
+
+IcebergPositionDeleteCache::~IcebergPositionDeleteCache() = default;
+
+StatusOr<IcebergPositionDeleteCache::DeleteFilePtr> IcebergPositionDeleteCache::get_or_load(const std::string& path,
+                                                                                          int64_t length,
+                                                                                          const Loader& loader) {
+    DCHECK(enabled());
+    const std::string key = fmt::format("{}:{}", path, length);
+    if (auto delete_file = _lookup(key); delete_file != nullptr) {
+        return delete_file;
+    }
+
+    std::shared_future<StatusOr<DeleteFilePtr>> loading;
+    std::promise<StatusOr<DeleteFilePtr>> promise;
+    {
+        std::lock_guard l(_mutex);
+        if (auto it = _loading.find(key); it != _loading.end()) {
+            loading = it->second;
+        } else if (auto delete_file = _lookup(key); delete_file != nullptr) {
+            // Loaded by another caller between the lookup and the lock.
+            return delete_file;
+        } else {
+            _loading.emplace(key, promise.get_future().share());
+        }
+    }
+    if (loading.valid()) {
+        return loading.get();
+    }
+
+    auto delete_file = std::make_shared<DeleteFile>();
+    Status status = loader(delete_file.get());
+    if (status.ok()) {
+        for (auto& [_, positions] : *delete_file) {
+            positions.shrink_to_fit();
+        }
+        _insert(key, delete_file);
+    }
+    StatusOr<DeleteFilePtr> result =
+            status.ok() ? StatusOr<DeleteFilePtr>(std::move(delete_file)) : StatusOr<DeleteFilePtr>(status);
+    promise.set_value(result);
+    std::lock_guard l(_mutex);
+    _loading.erase(key);
+    return result;
+}
+
+size_t IcebergPositionDeleteCache::memory_usage() const {
+    return _cache != nullptr ? _cache->get_memory_usage() : 0;
+}
+
+IcebergPositionDeleteCache::DeleteFilePtr IcebergPositionDeleteCache::_lookup(const std::string& key) {
+    Cache::Handle* handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    DeleteFilePtr delete_file = *static_cast<DeleteFilePtr*>(_cache->value(handle));
+    _cache->release(handle);
+    return delete_file;
+}
+
+void IcebergPositionDeleteCache::_insert(const std::string& key, const DeleteFilePtr& delete_file) {
+    auto* value = new DeleteFilePtr(delete_file);
+    Cache::Handle* handle = _cache->insert(CacheKey(key), value, delete_file_charge(*delete_file), delete_file_deleter);
+    if (handle != nullptr) {
+        _cache->release(handle);
+    }
+}
+
+} // namespace starrocks
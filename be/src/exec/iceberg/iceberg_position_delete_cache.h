@@ -0,0 +1,69 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/statusor.h"
+#include "gutil/macros.h"
+
+namespace starrocks {
+
+class Cache;
+
+// IcebergPositionDeleteCache keeps the position delete files read by the iceberg scanners. A position delete file
+// usually refers to many data files, it is read once into the deleted positions of every data file, so that the
+// scanners of the other data files and of the following queries don't read it again. Iceberg files are never
+// rewritten in place, so an entry keyed by the path and length of the delete file never goes stale.
+//
+// Concurrent loads of the same delete file are merged, the later callers wait for the first one.
+class IcebergPositionDeleteCache {
+public:
+    // Data file path -> deleted positions of it.
+    using DeleteFile = std::unordered_map<std::string, std::vector<int64_t>>;
+    using DeleteFilePtr = std::shared_ptr<const DeleteFile>;
+    using Loader = std::function<Status(DeleteFile*)>;
+
+    static IcebergPositionDeleteCache* instance();
+
+    ~IcebergPositionDeleteCache();
+
+    bool enabled() const { return _cache != nullptr; }
+
+    // Return the delete file at |path|, it is loaded by |loader| on miss.
+    StatusOr<DeleteFilePtr> get_or_load(const std::string& path, int64_t length, const Loader& loader);
+
+    size_t memory_usage() const;
+
+private:
+    explicit IcebergPositionDeleteCache(size_t capacity);
+    DISALLOW_COPY_AND_MOVE(IcebergPositionDeleteCache);
+
+    DeleteFilePtr _lookup(const std::string& key);
+    void _insert(const std::string& key, const DeleteFilePtr& delete_file);
+
+    std::unique_ptr<Cache> _cache;
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::shared_future<StatusOr<DeleteFilePtr>>> _loading;
+};
+
+} // namespace starrocks
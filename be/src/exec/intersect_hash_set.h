@@ -64,6 +64,8 @@ public:
 
     bool empty() { return _hash_set->empty(); }
 
+    size_t size() { return _hash_set->size(); }
+
     void build_set(RuntimeState* state, const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs,
                    MemPool* pool);
 
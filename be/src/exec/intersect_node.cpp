@@ -17,13 +17,17 @@
 #include <memory>
 
 #include "column/column_helper.h"
+#include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
 #include "exec/pipeline/set/intersect_build_sink_operator.h"
 #include "exec/pipeline/set/intersect_context.h"
 #include "exec/pipeline/set/intersect_output_source_operator.h"
 #include "exec/pipeline/set/intersect_probe_sink_operator.h"
+#include "exec/pipeline/set/set_operation_runtime_filter.h"
+#include "exec/pipeline/spill_process_operator.h"
 #include "exprs/expr.h"
+#include "exprs/runtime_filter_bank.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
 
@@ -45,6 +49,12 @@ Status IntersectNode::init(const TPlanNode& tnode, RuntimeState* state) {
         RETURN_IF_ERROR(Expr::create_expr_trees(_pool, texprs, &ctxs, state));
         _child_expr_lists.push_back(ctxs);
     }
+
+    for (const auto& desc : tnode.intersect_node.build_runtime_filters) {
+        auto* rf_desc = _pool->add(new RuntimeFilterBuildDescriptor());
+        RETURN_IF_ERROR(rf_desc->init(_pool, desc, state));
+        _build_runtime_filters.emplace_back(rf_desc);
+    }
     return Status::OK();
 }
 
@@ -253,8 +263,20 @@ pipeline::OpFactories IntersectNode::decompose_to_pipeline(pipeline::PipelineBui
     OpFactories ops_with_intersect_build_sink = child(0)->decompose_to_pipeline(context);
     ops_with_intersect_build_sink = context->maybe_interpolate_local_shuffle_exchange(
             runtime_state(), id(), ops_with_intersect_build_sink, _child_expr_lists[0]);
+    const size_t num_partitions = context->source_operator(ops_with_intersect_build_sink)->degree_of_parallelism();
+    auto rf_builder = SetOperationRuntimeFilterBuilder::create(runtime_state(), runtime_state()->obj_pool(), id(),
+                                                               _build_runtime_filters, num_partitions);
+    if (rf_builder != nullptr) {
+        context->fragment_context()->runtime_filter_hub()->add_holder(_id);
+    }
+    // The spill process operators dump the hash sets of the spilled partitions.
+    auto spill_channel_factory = std::make_shared<SpillProcessChannelFactory>(num_partitions);
+    if (runtime_state()->enable_spill() && runtime_state()->enable_set_operation_spill()) {
+        context->interpolate_spill_process(id(), spill_channel_factory, num_partitions);
+    }
     ops_with_intersect_build_sink.emplace_back(std::make_shared<IntersectBuildSinkOperatorFactory>(
-            context->next_operator_id(), id(), intersect_partition_ctx_factory, _child_expr_lists[0]));
+            context->next_operator_id(), id(), intersect_partition_ctx_factory, _child_expr_lists[0],
+            std::move(rf_builder), std::move(spill_channel_factory)));
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(ops_with_intersect_build_sink.back().get(), context, rc_rf_probe_collector);
     context->add_pipeline(ops_with_intersect_build_sink);
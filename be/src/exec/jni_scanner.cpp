@@ -21,6 +21,7 @@
 #include "fmt/core.h"
 #include "udf/java/java_udf.h"
 #include "util/defer_op.h"
+#include "util/raw_container.h"
 
 namespace starrocks {
 
@@ -80,9 +81,6 @@ Status JniScanner::_init_jni_method(JNIEnv* env) {
     _jni_scanner_close = env->GetMethodID(_jni_scanner_cls, "close", "()V");
     RETURN_IF_ERROR(_check_jni_exception(env, "Failed to get `close` jni method"));
 
-    _jni_scanner_release_column = env->GetMethodID(_jni_scanner_cls, "releaseOffHeapColumnVector", "(I)V");
-    RETURN_IF_ERROR(_check_jni_exception(env, "Failed to get `releaseOffHeapColumnVector` jni method"));
-
     _jni_scanner_release_table = env->GetMethodID(_jni_scanner_cls, "releaseOffHeapTable", "()V");
     RETURN_IF_ERROR(_check_jni_exception(env, "Failed to get `releaseOffHeapTable` jni method"));
     return Status::OK();
@@ -168,8 +166,9 @@ Status JniScanner::_append_string_data(const FillColumnArgs& args) {
     Offsets& offsets = runtime_column->get_offset();
 
     int total_length = offset_ptr[args.num_rows];
+    // Both of them are overwritten by memcpy below.
     bytes.resize(total_length);
-    offsets.resize(args.num_rows + 1);
+    raw::stl_vector_resize_uninitialized(&offsets, args.num_rows + 1);
 
     memcpy(offsets.data(), offset_ptr, (args.num_rows + 1) * sizeof(uint32_t));
     memcpy(bytes.data(), column_ptr, total_length);
@@ -283,7 +282,7 @@ Status JniScanner::_fill_column(FillColumnArgs* pargs) {
         auto* nullable_column = down_cast<NullableColumn*>(args.column);
 
         NullData& null_data = nullable_column->null_column_data();
-        null_data.resize(args.num_rows);
+        raw::stl_vector_resize_uninitialized(&null_data, args.num_rows);
         memcpy(null_data.data(), null_column_ptr, args.num_rows);
         nullable_column->update_has_null();
 
@@ -359,10 +358,8 @@ Status JniScanner::_fill_chunk(JNIEnv* env, ChunkPtr* chunk, const std::vector<S
                             .column = column.get(),
                             .must_nullable = true};
         RETURN_IF_ERROR(_fill_column(&args));
-        env->CallVoidMethod(_jni_scanner_obj, _jni_scanner_release_column, col_idx);
-        RETURN_IF_ERROR(_check_jni_exception(
-                env, "Failed to call the releaseOffHeapColumnVector method of off-heap table scanner."));
     }
+    // The off-heap columns are released together by releaseOffHeapTable, rather than one jni call per column.
     return Status::OK();
 }
 
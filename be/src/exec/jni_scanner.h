@@ -90,7 +90,6 @@ private:
     jmethodID _jni_scanner_open = nullptr;
     jmethodID _jni_scanner_get_next_chunk = nullptr;
     jmethodID _jni_scanner_close = nullptr;
-    jmethodID _jni_scanner_release_column = nullptr;
     jmethodID _jni_scanner_release_table = nullptr;
 
     std::map<std::string, std::string> _jni_scanner_params;
@@ -17,13 +17,20 @@
 #include <column/chunk.h>
 #include <runtime/descriptors.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/hash_join_node.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "serde/column_array_serde.h"
 #include "simd/simd.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -73,14 +80,169 @@ void HashTableProbeState::consider_probe_time_locality() {
     ++probe_chunks;
 }
 
+void JoinHashMapHelper::prepare_build_key_columns(const JoinHashTableItems& table_items, Columns* data_columns,
+                                                  NullColumns* null_columns) {
+    for (size_t i = 0; i < table_items.key_columns.size(); i++) {
+        if (table_items.join_keys[i].is_null_safe_equal) {
+            data_columns->emplace_back(table_items.key_columns[i]);
+        } else if (table_items.key_columns[i]->is_nullable()) {
+            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items.key_columns[i]);
+            data_columns->emplace_back(nullable_column->data_column());
+            if (table_items.key_columns[i]->has_null()) {
+                null_columns->emplace_back(nullable_column->null_column());
+            }
+        } else {
+            data_columns->emplace_back(table_items.key_columns[i]);
+        }
+    }
+}
+
+void JoinHashMapHelper::partition_build_rows(JoinHashTableItems* table_items, const Buffer<uint32_t>& buckets) {
+    const uint32_t num_partitions = table_items->num_build_partitions;
+    DCHECK_GT(num_partitions, 1);
+    DCHECK_EQ(0, table_items->bucket_size & (table_items->bucket_size - 1));
+    DCHECK_EQ(0, table_items->bucket_size % num_partitions);
+    const uint32_t num_rows = table_items->row_count + 1;
+    const int shift = __builtin_ctz(table_items->bucket_size / num_partitions);
+
+    // Counting sort the rows [1, row_count] by partitions, and keep row 0 at the head.
+    std::vector<uint32_t> offsets(num_partitions + 1, 0);
+    for (uint32_t i = 1; i < num_rows; i++) {
+        offsets[(buckets[i] >> shift) + 1]++;
+    }
+    offsets[0] = 1;
+    for (uint32_t p = 0; p < num_partitions; p++) {
+        offsets[p + 1] += offsets[p];
+    }
+    table_items->build_partition_offsets = offsets;
+    Buffer<uint32_t> indexes(num_rows);
+    indexes[0] = 0;
+    for (uint32_t i = 1; i < num_rows; i++) {
+        indexes[offsets[buckets[i] >> shift]++] = i;
+    }
+
+    auto reorder_column = [&indexes, num_rows](const ColumnPtr& column) -> ColumnPtr {
+        ColumnPtr new_column = column->clone_empty();
+        new_column->append_selective(*column, indexes.data(), 0, num_rows);
+        return new_column;
+    };
+
+    // Drop the key columns which reference the build columns first, so that every build column is released as soon
+    // as its reordered copy replaces it.
+    for (size_t i = 0; i < table_items->key_columns.size(); i++) {
+        if (table_items->join_keys[i].col_ref != nullptr) {
+            table_items->key_columns[i] = nullptr;
+        }
+    }
+    for (auto& column : table_items->build_chunk->columns()) {
+        column = reorder_column(column);
+    }
+    for (size_t i = 0; i < table_items->key_columns.size(); i++) {
+        if (table_items->join_keys[i].col_ref != nullptr) {
+            // Reference the reordered column of the build chunk.
+            SlotId slot_id = table_items->join_keys[i].col_ref->slot_id();
+            table_items->key_columns[i] = table_items->build_chunk->get_column_by_slot_id(slot_id);
+        } else {
+            table_items->key_columns[i] = reorder_column(table_items->key_columns[i]);
+        }
+    }
+}
+
+void JoinHashMapHelper::build_rows_by_partition(const JoinHashTableItems& table_items,
+                                                const std::function<void(uint32_t, uint32_t)>& build_rows) {
+    const uint32_t num_partitions = table_items.num_build_partitions;
+    const int32_t dop = config::hash_join_parallel_build_dop;
+    ThreadPool* pool = ExecEnv::GetInstance()->hash_join_build_pool();
+    if (num_partitions <= 1 || dop <= 1 || pool == nullptr) {
+        build_rows(1, table_items.row_count);
+        return;
+    }
+
+    DCHECK_EQ(num_partitions + 1, table_items.build_partition_offsets.size());
+    const auto& offsets = table_items.build_partition_offsets;
+    build_partitions_in_parallel(pool, dop, num_partitions, [&](uint32_t partition) {
+        build_rows(offsets[partition], offsets[partition + 1] - offsets[partition]);
+    });
+}
+
+void JoinHashMapHelper::build_partitions_in_parallel(ThreadPool* pool, int32_t dop, uint32_t num_partitions,
+                                                     const std::function<void(uint32_t)>& build_partition) {
+    struct ParallelBuildState {
+        std::atomic<uint32_t> next_partition{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        uint32_t num_built_partitions = 0;
+    };
+    // The tasks may start after this function returns, so they share the state, and they never touch
+    // |build_partition| unless they have claimed a partition, which this function waits for.
+    auto state = std::make_shared<ParallelBuildState>();
+    const auto* build_fn = &build_partition;
+    auto build = [state, build_fn, num_partitions](MemTracker* mem_tracker) {
+        uint32_t num_built = 0;
+        for (uint32_t p = state->next_partition.fetch_add(1); p < num_partitions;
+             p = state->next_partition.fetch_add(1)) {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            (*build_fn)(p);
+            num_built++;
+        }
+        if (num_built > 0) {
+            std::lock_guard<std::mutex> l(state->mutex);
+            state->num_built_partitions += num_built;
+            if (state->num_built_partitions == num_partitions) {
+                state->cv.notify_all();
+            }
+        }
+    };
+
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    const auto num_tasks = std::min<uint32_t>(dop - 1, num_partitions - 1);
+    for (uint32_t i = 0; i < num_tasks; i++) {
+        // The partitions of a task failed to be submitted are built by the others.
+        if (!pool->submit_func([build, mem_tracker]() { build(mem_tracker); }).ok()) {
+            break;
+        }
+    }
+    build(mem_tracker);
+
+    // The build operator finishes the hash table synchronously in set_finishing(), so it can't yield here,
+    // but it waits for at most one partition of each running task, since all the partitions are claimed.
+    std::unique_lock<std::mutex> l(state->mutex);
+    state->cv.wait(l, [&state, num_partitions]() { return state->num_built_partitions == num_partitions; });
+}
+
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::resize_with_huge_pages(&table_items->first, table_items->bucket_size,
+                                              &table_items->huge_page_bytes);
+    JoinHashMapHelper::resize_with_huge_pages(&table_items->next, table_items->row_count + 1,
+                                              &table_items->huge_page_bytes);
     table_items->build_slice.resize(table_items->row_count + 1);
     table_items->build_pool = std::make_unique<MemPool>();
 }
 
+void SerializedJoinBuildFunc::compute_bucket_nums(RuntimeState* state, JoinHashTableItems* table_items,
+                                                  Buffer<uint32_t>* buckets) {
+    Columns data_columns;
+    NullColumns null_columns;
+    JoinHashMapHelper::prepare_build_key_columns(*table_items, &data_columns, &null_columns);
+
+    // Serialize each row to a reused buffer to get the hash, rather than keeping the serialized keys,
+    // since the keys are serialized again by construct_hash_table() after the build rows are reordered.
+    std::vector<uint8_t> buffer;
+    const uint32_t num_rows = table_items->row_count + 1;
+    for (uint32_t i = 0; i < num_rows; i++) {
+        size_t row_size = 0;
+        for (const auto& data_column : data_columns) {
+            row_size += data_column->serialize_size(i);
+        }
+        if (buffer.size() < row_size) {
+            buffer.resize(row_size);
+        }
+        Slice key = JoinHashMapHelper::get_hash_key(data_columns, i, buffer.data());
+        (*buckets)[i] = JoinHashMapHelper::calc_bucket_num<Slice>(key, table_items->bucket_size);
+    }
+}
+
 void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                                    HashTableProbeState* probe_state) {
     uint32_t row_count = table_items->row_count;
@@ -88,20 +250,7 @@ void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHash
     // prepare columns
     Columns data_columns;
     NullColumns null_columns;
-
-    for (size_t i = 0; i < table_items->key_columns.size(); i++) {
-        if (table_items->join_keys[i].is_null_safe_equal) {
-            data_columns.emplace_back(table_items->key_columns[i]);
-        } else if (table_items->key_columns[i]->is_nullable()) {
-            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[i]);
-            data_columns.emplace_back(nullable_column->data_column());
-            if (table_items->key_columns[i]->has_null()) {
-                null_columns.emplace_back(nullable_column->null_column());
-            }
-        } else {
-            data_columns.emplace_back(table_items->key_columns[i]);
-        }
-    }
+    JoinHashMapHelper::prepare_build_key_columns(*table_items, &data_columns, &null_columns);
 
     // calc serialize size
     size_t serialize_size = 0;
@@ -224,6 +373,7 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
         ptr += probe_state->probe_slice[i].size;
     }
 
+    JoinHashMapHelper::prefetch_buckets(table_items, *probe_state);
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->next[i] = table_items.first[probe_state->buckets[i]];
     }
@@ -247,14 +397,15 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
             probe_state->probe_slice[i] = JoinHashMapHelper::get_hash_key(data_columns, i, ptr);
+            probe_state->buckets[i] =
+                    JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
             ptr += probe_state->probe_slice[i].size;
         }
     }
 
+    JoinHashMapHelper::prefetch_buckets(table_items, *probe_state);
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
-            probe_state->buckets[i] =
-                    JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
             probe_state->next[i] = table_items.first[probe_state->buckets[i]];
         } else {
             probe_state->next[i] = 0;
@@ -268,6 +419,7 @@ JoinHashTable JoinHashTable::clone_readable_table() {
     ht._hash_map_type = this->_hash_map_type;
 
     ht._table_items = this->_table_items;
+    ht._mem_tracker = this->_mem_tracker;
     // Clone a new probe state.
     ht._probe_state = std::make_unique<HashTableProbeState>(*this->_probe_state);
 
@@ -288,18 +440,25 @@ JoinHashTable JoinHashTable::clone_readable_table() {
 
 void JoinHashTable::set_probe_profile(RuntimeProfile::Counter* search_ht_timer,
                                       RuntimeProfile::Counter* output_probe_column_timer,
-                                      RuntimeProfile::Counter* output_build_column_timer) {
+                                      RuntimeProfile::Counter* output_build_column_timer,
+                                      RuntimeProfile::Counter* prefetch_rows_counter) {
     if (_probe_state == nullptr) return;
     _probe_state->search_ht_timer = search_ht_timer;
     _probe_state->output_probe_column_timer = output_probe_column_timer;
     _probe_state->output_build_column_timer = output_build_column_timer;
+    _probe_state->prefetch_rows_counter = prefetch_rows_counter;
 }
 
 float JoinHashTable::get_keys_per_bucket() const {
     return _table_items->get_keys_per_bucket();
 }
 
+MemTracker* JoinHashTable::_current_mem_tracker() const {
+    return _mem_tracker != nullptr ? _mem_tracker.get() : CurrentThread::mem_tracker();
+}
+
 void JoinHashTable::close() {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_current_mem_tracker());
     _table_items.reset();
     _probe_state.reset();
     _probe_state = nullptr;
@@ -314,6 +473,7 @@ void JoinHashTable::create(const HashTableParam& param) {
         _probe_state->search_ht_timer = param.search_ht_timer;
         _probe_state->output_probe_column_timer = param.output_probe_column_timer;
         _probe_state->output_build_column_timer = param.output_build_column_timer;
+        _probe_state->prefetch_rows_counter = param.prefetch_rows_counter;
     }
 
     _table_items->build_chunk = std::make_shared<Chunk>();
@@ -438,6 +598,7 @@ int64_t JoinHashTable::mem_usage() const {
 }
 
 Status JoinHashTable::build(RuntimeState* state) {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_current_mem_tracker());
     RETURN_IF_ERROR(_table_items->build_chunk->upgrade_if_overflow());
     _table_items->has_large_column = _table_items->build_chunk->has_large_column();
 
@@ -453,6 +614,8 @@ Status JoinHashTable::build(RuntimeState* state) {
     RETURN_IF_ERROR(_upgrade_key_columns_if_overflow());
 
     _hash_map_type = _choose_join_hash_map();
+    _table_items->hash_map_type = _hash_map_type;
+    _table_items->num_build_partitions = _choose_num_build_partitions();
 
     switch (_hash_map_type) {
 #define M(NAME)                                                                                                       \
@@ -471,6 +634,43 @@ Status JoinHashTable::build(RuntimeState* state) {
     return Status::OK();
 }
 
+void JoinHashTable::share_build(std::shared_ptr<const JoinHashTableItems> build, RuntimeState* state) {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_current_mem_tracker());
+    auto& items = *_table_items;
+    items.build_chunk = build->build_chunk;
+    items.key_columns = build->key_columns;
+    items.first = build->first;
+    items.next = build->next;
+    items.build_slice = build->build_slice;
+    items.build_key_column = build->build_key_column;
+    items.bucket_size = build->bucket_size;
+    items.row_count = build->row_count;
+    items.has_large_column = build->has_large_column;
+    items.keys_per_bucket = build->keys_per_bucket;
+    items.used_buckets = build->used_buckets;
+    items.cache_miss_serious = build->cache_miss_serious;
+    items.num_build_partitions = build->num_build_partitions;
+    items.hash_map_type = build->hash_map_type;
+    DCHECK_EQ(items.join_keys.size(), build->join_keys.size());
+    for (size_t i = 0; i < items.join_keys.size(); i++) {
+        items.join_keys[i].is_null_safe_equal = build->join_keys[i].is_null_safe_equal;
+    }
+    items.shared_build = std::move(build);
+
+    _hash_map_type = items.hash_map_type;
+    switch (_hash_map_type) {
+#define M(NAME)                                                                                                       \
+    case JoinHashMapType::NAME:                                                                                       \
+        _##NAME = std::make_unique<typename decltype(_##NAME)::element_type>(_table_items.get(), _probe_state.get()); \
+        _##NAME->probe_prepare(state);                                                                                \
+        break;
+        APPLY_FOR_JOIN_VARIANTS(M)
+#undef M
+    default:
+        assert(false);
+    }
+}
+
 void JoinHashTable::reset_probe_state(starrocks::RuntimeState* state) {
     _hash_map_type = _choose_join_hash_map();
     switch (_hash_map_type) {
@@ -522,6 +722,7 @@ Status JoinHashTable::probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* e
 }
 
 void JoinHashTable::append_chunk(const ChunkPtr& chunk, const Columns& key_columns) {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_current_mem_tracker());
     Columns& columns = _table_items->build_chunk->columns();
 
     for (size_t i = 0; i < _table_items->build_column_count; i++) {
@@ -663,8 +864,18 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
         case LogicalType::TYPE_DOUBLE:
             return JoinHashMapType::keydouble;
         case LogicalType::TYPE_VARCHAR:
-        case LogicalType::TYPE_CHAR:
+        case LogicalType::TYPE_CHAR: {
+            if (config::enable_hash_join_inline_short_string_key) {
+                size_t max_length = _get_max_length_of_string_key();
+                if (max_length <= JoinHashMapHelper::max_inlined_string_length<int64_t>()) {
+                    return JoinHashMapType::fixed64;
+                }
+                if (max_length <= JoinHashMapHelper::max_inlined_string_length<int128_t>()) {
+                    return JoinHashMapType::fixed128;
+                }
+            }
             return JoinHashMapType::keystring;
+        }
         case LogicalType::TYPE_DATE:
             // date will be convert to datetime, so current can't reach here
             return JoinHashMapType::keydate;
@@ -710,6 +921,50 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
     return JoinHashMapType::slice;
 }
 
+uint32_t JoinHashTable::_choose_num_build_partitions() const {
+    switch (_hash_map_type) {
+    case JoinHashMapType::empty:
+    case JoinHashMapType::keyboolean:
+    case JoinHashMapType::key8:
+    case JoinHashMapType::key16:
+        // The direct mapping tables are small enough.
+        return 1;
+    default:
+        break;
+    }
+
+    const int64_t min_rows = config::hash_join_partitioned_build_min_rows;
+    if (min_rows < 0 || _table_items->row_count < min_rows) {
+        return 1;
+    }
+    return JoinHashMapHelper::calc_num_build_partitions(
+            JoinHashMapHelper::calc_bucket_size(_table_items->row_count + 1));
+}
+
+template <typename BinaryColumnType>
+static size_t max_string_length(const BinaryColumnType* column) {
+    const auto& offsets = column->get_offset();
+    size_t max_length = 0;
+    for (size_t i = 1; i < offsets.size(); i++) {
+        max_length = std::max<size_t>(max_length, offsets[i] - offsets[i - 1]);
+    }
+    return max_length;
+}
+
+size_t JoinHashTable::_get_max_length_of_string_key() const {
+    const Column* column = _table_items->key_columns[0].get();
+    if (column->is_nullable()) {
+        column = down_cast<const NullableColumn*>(column)->data_column().get();
+    }
+    if (column->is_binary()) {
+        return max_string_length(down_cast<const BinaryColumn*>(column));
+    }
+    if (column->is_large_binary()) {
+        return max_string_length(down_cast<const LargeBinaryColumn*>(column));
+    }
+    return std::numeric_limits<size_t>::max();
+}
+
 size_t JoinHashTable::_get_size_of_fixed_and_contiguous_type(LogicalType data_type) {
     switch (data_type) {
     case LogicalType::TYPE_BOOLEAN:
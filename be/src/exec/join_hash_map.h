@@ -22,12 +22,14 @@
 
 #include <coroutine>
 #include <cstdint>
+#include <functional>
 #include <set>
 
 #include "column/chunk.h"
 #include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "runtime/memory/system_allocator.h"
 #include "simd/simd.h"
 #include "util/phmap/phmap.h"
 
@@ -37,6 +39,8 @@
 namespace starrocks {
 
 class ColumnRef;
+class ThreadPool;
+class MemTracker;
 
 #define APPLY_FOR_JOIN_VARIANTS(M) \
     M(empty)                       \
@@ -125,8 +129,16 @@ struct JoinHashTableItems {
     bool has_large_column = false;
     float keys_per_bucket = 0;
     size_t used_buckets = 0;
+    // Bytes of "first" and "next" advised to be backed by huge pages.
+    size_t huge_page_bytes = 0;
     bool cache_miss_serious = false;
     bool mor_reader_mode = false;
+    // The build rows are radix-partitioned by the high bits of their buckets before building,
+    // if it is larger than 1. See JoinHashMapHelper::partition_build_rows().
+    uint32_t num_build_partitions = 1;
+    // The build rows of partition p are [build_partition_offsets[p], build_partition_offsets[p + 1]) after
+    // they are partitioned.
+    std::vector<uint32_t> build_partition_offsets;
 
     float get_keys_per_bucket() const { return keys_per_bucket; }
     bool ht_cache_miss_serious() const { return cache_miss_serious; }
@@ -148,9 +160,13 @@ struct JoinHashTableItems {
     }
 
     TJoinOp::type join_type = TJoinOp::INNER_JOIN;
+    JoinHashMapType hash_map_type = JoinHashMapType::empty;
 
     std::unique_ptr<MemPool> build_pool = nullptr;
     std::vector<JoinKeyDesc> join_keys;
+    // The items built by another hash table of the same join, which this one shares, see JoinHashTable::share_build().
+    // The build_slice of this one refers to its build_pool.
+    std::shared_ptr<const JoinHashTableItems> shared_build = nullptr;
 };
 
 struct HashTableProbeState {
@@ -187,9 +203,14 @@ struct HashTableProbeState {
 
     std::unique_ptr<MemPool> probe_pool = nullptr;
 
+    // prefetch the buckets and the build keys of the probe rows in batch before searching the hash table,
+    // so that the cache misses of a chunk are overlapped instead of being paid one by one.
+    bool enable_prefetch = false;
+
     RuntimeProfile::Counter* search_ht_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
+    RuntimeProfile::Counter* prefetch_rows_counter = nullptr;
 
     HashTableProbeState() = default;
 
@@ -239,8 +260,10 @@ struct HashTableProbeState {
               cur_probe_index(rhs.cur_probe_index),
               cur_row_match_count(rhs.cur_row_match_count),
               probe_pool(rhs.probe_pool == nullptr ? nullptr : std::make_unique<MemPool>()),
+              enable_prefetch(rhs.enable_prefetch),
               search_ht_timer(rhs.search_ht_timer),
-              output_probe_column_timer(rhs.output_probe_column_timer) {}
+              output_probe_column_timer(rhs.output_probe_column_timer),
+              prefetch_rows_counter(rhs.prefetch_rows_counter) {}
 
     // Disable copy assignment.
     HashTableProbeState& operator=(const HashTableProbeState& rhs) = delete;
@@ -272,6 +295,7 @@ struct HashTableParam {
     RuntimeProfile::Counter* search_ht_timer = nullptr;
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
+    RuntimeProfile::Counter* prefetch_rows_counter = nullptr;
     bool mor_reader_mode = false;
 };
 
@@ -313,6 +337,19 @@ class JoinHashMapHelper {
 public:
     // maxinum bucket size
     const static uint32_t MAX_BUCKET_SIZE = 1 << 31;
+    // The number of buckets in a partition of the partitioned build, 256KB for the `first` array,
+    // so that the sub-table of a partition fits in L2 cache.
+    const static uint32_t NUM_BUCKETS_PER_BUILD_PARTITION = 1 << 16;
+    const static uint32_t MAX_NUM_BUILD_PARTITIONS = 1 << 14;
+
+    // Reserve the buffer before zero filling it, so that a large buffer can still be advised to be backed by
+    // huge pages while its memory is untouched.
+    template <typename T>
+    static void resize_with_huge_pages(Buffer<T>* buffer, size_t size, size_t* huge_page_bytes) {
+        buffer->reserve(size);
+        *huge_page_bytes += SystemAllocator::advise_huge_pages(buffer->data(), buffer->capacity() * sizeof(T));
+        buffer->resize(size, 0);
+    }
 
     static uint32_t calc_bucket_size(uint32_t size) {
         size_t expect_bucket_size = static_cast<size_t>(size) + (size - 1) / 7;
@@ -338,6 +375,75 @@ public:
         }
     }
 
+    static uint32_t calc_num_build_partitions(uint32_t bucket_size) {
+        if (bucket_size <= NUM_BUCKETS_PER_BUILD_PARTITION) {
+            return 1;
+        }
+        return std::min(bucket_size / NUM_BUCKETS_PER_BUILD_PARTITION, MAX_NUM_BUILD_PARTITIONS);
+    }
+
+    // Reorder the build rows [1, row_count] of the build chunk and the key columns by the radix partitions
+    // of their buckets, which are the high bits of the buckets. After that, the rows are inserted into the
+    // hash table partition by partition, and the buckets, the chains and the keys of a partition are close
+    // to each other in memory, which keeps the random accesses of the build inside a cache-sized sub-table.
+    // The probe is not made more local, because the probe rows still hit all the partitions in random order.
+    // The reordering is stable, so the rows in a bucket chain keep their relative order, and row 0 is kept
+    // in place as the end of chains. The columns are reordered one by one, so the extra memory at any time is
+    // about one column rather than the whole build chunk.
+    static void partition_build_rows(JoinHashTableItems* table_items, const Buffer<uint32_t>& buckets);
+
+    // Call |build_rows| with (start, count) of the build rows to insert into the hash table, which cover the
+    // rows [1, row_count]. The partitions of a partitioned build own disjoint ranges of buckets, so they are
+    // inserted concurrently by up to hash_join_parallel_build_dop threads, one call per partition, without
+    // any synchronization on `first` and `next`. Otherwise, |build_rows| is called once with all the rows.
+    static void build_rows_by_partition(const JoinHashTableItems& table_items,
+                                        const std::function<void(uint32_t, uint32_t)>& build_rows);
+
+    // Call |build_partition| once for each of the partitions [0, num_partitions), which are claimed one by one
+    // by the calling thread and at most dop - 1 tasks submitted to |pool|. The calling thread never waits for
+    // the tasks still queued in the pool, but only for the partitions claimed by the running ones.
+    static void build_partitions_in_parallel(ThreadPool* pool, int32_t dop, uint32_t num_partitions,
+                                             const std::function<void(uint32_t)>& build_partition);
+
+    // Split the build key columns into the data columns to be serialized and the null columns of the
+    // keys which are not null-safe equal.
+    static void prepare_build_key_columns(const JoinHashTableItems& table_items, Columns* data_columns,
+                                          NullColumns* null_columns);
+
+    // Issue the prefetches of the chain heads of all the probe rows, before `next` is filled from `first`,
+    // so that the loads of `first` hit the cache. It must be called after the buckets are calculated.
+    // The buckets of the null rows may be stale, but they are still in the range of `first`.
+    static void prefetch_buckets(const JoinHashTableItems& table_items, const HashTableProbeState& probe_state) {
+        if (!probe_state.enable_prefetch) {
+            return;
+        }
+        const uint32_t* first = table_items.first.data();
+        const uint32_t* buckets = probe_state.buckets.data();
+        for (size_t i = 0; i < probe_state.probe_row_count; i++) {
+            __builtin_prefetch(first + buckets[i], 0, 3);
+        }
+    }
+
+    // Issue the prefetches of the first build rows of the matched chains, including the build key and the
+    // next pointer, which are the first loads of searching the hash table. It must be called after `next`
+    // is filled from `first`.
+    template <typename CppType>
+    static void prefetch_build_rows(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                    const Buffer<CppType>& build_data) {
+        const uint32_t* next = probe_state->next.data();
+        size_t num_prefetched = 0;
+        for (size_t i = 0; i < probe_state->probe_row_count; i++) {
+            if (next[i] != 0) {
+                __builtin_prefetch(build_data.data() + next[i], 0, 3);
+                __builtin_prefetch(table_items.next.data() + next[i], 0, 3);
+                num_prefetched++;
+            }
+        }
+        if (probe_state->prefetch_rows_counter != nullptr) {
+            COUNTER_UPDATE(probe_state->prefetch_rows_counter, num_prefetched);
+        }
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -347,6 +453,35 @@ public:
     }
 
     // combine keys into fixed size key by column.
+    // A single string key whose build values are all short is inlined into a fixed size key: the first byte is
+    // the length and the rest is the zero padded string, so that the probe compares integers instead of following
+    // the pointers of slices. A probe string too long to be inlined gets the length byte kNonInlinedStringLength,
+    // which never matches any build key.
+    static constexpr uint8_t kNonInlinedStringLength = 0xFF;
+
+    template <typename CppType>
+    static constexpr size_t max_inlined_string_length() {
+        return sizeof(CppType) - 1;
+    }
+
+    template <typename CppType, typename BinaryColumnType>
+    static void serialize_inline_string_key_column(const BinaryColumnType* key_column, CppType* dst, uint32_t start,
+                                                   uint32_t count) {
+        const auto& offsets = key_column->get_offset();
+        const uint8_t* bytes = key_column->get_bytes().data();
+        for (uint32_t i = 0; i < count; i++) {
+            auto* buf = reinterpret_cast<uint8_t*>(dst + i);
+            memset(buf, 0, sizeof(CppType));
+            size_t length = offsets[start + i + 1] - offsets[start + i];
+            if (length <= max_inlined_string_length<CppType>()) {
+                buf[0] = static_cast<uint8_t>(length);
+                memcpy(buf + 1, bytes + offsets[start + i], length);
+            } else {
+                buf[0] = kNonInlinedStringLength;
+            }
+        }
+    }
+
     template <LogicalType LT>
     static void serialize_fixed_size_key_column(const Columns& key_columns, Column* fixed_size_key_column,
                                                 uint32_t start, uint32_t count) {
@@ -354,6 +489,16 @@ public:
         using ColumnType = typename RunTimeTypeTraits<LT>::ColumnType;
 
         auto& data = reinterpret_cast<ColumnType*>(fixed_size_key_column)->get_data();
+        if (key_columns.size() == 1 && key_columns[0]->is_binary()) {
+            serialize_inline_string_key_column(down_cast<const BinaryColumn*>(key_columns[0].get()), &data[start],
+                                               start, count);
+            return;
+        }
+        if (key_columns.size() == 1 && key_columns[0]->is_large_binary()) {
+            serialize_inline_string_key_column(down_cast<const LargeBinaryColumn*>(key_columns[0].get()),
+                                               &data[start], start, count);
+            return;
+        }
         auto* buf = reinterpret_cast<uint8_t*>(&data[start]);
 
         const size_t byte_interval = sizeof(CppType);
@@ -373,8 +518,13 @@ public:
 
     static void prepare(RuntimeState* runtime, JoinHashTableItems* table_items);
     static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items);
+    // Calculate the buckets of the build rows [1, row_count], which is used by the partitioned build.
+    static void compute_bucket_nums(RuntimeState* state, JoinHashTableItems* table_items, Buffer<uint32_t>* buckets);
     static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                      HashTableProbeState* probe_state);
+
+private:
+    static void _build_rows(JoinHashTableItems* table_items, uint32_t start, uint32_t count);
 };
 
 template <LogicalType LT>
@@ -385,6 +535,8 @@ public:
 
     static void prepare(RuntimeState* runtime, JoinHashTableItems* table_items);
     static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items);
+    // Calculate the buckets of the build rows [1, row_count], which is used by the partitioned build.
+    static void compute_bucket_nums(RuntimeState* state, JoinHashTableItems* table_items, Buffer<uint32_t>* buckets);
     static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                      HashTableProbeState* probe_state);
 };
@@ -400,22 +552,25 @@ public:
     static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items) {
         return ColumnHelper::as_raw_column<const ColumnType>(table_items.build_key_column)->get_data();
     }
+    static void compute_bucket_nums(RuntimeState* state, JoinHashTableItems* table_items, Buffer<uint32_t>* buckets);
     static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                      HashTableProbeState* probe_state);
 
 private:
-    static void _build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
-                               const Columns& data_columns, uint32_t start, uint32_t count);
+    // |buckets| and |is_nulls| are the scratch buffers of at least |count| elements.
+    static void _build_columns(JoinHashTableItems* table_items, Buffer<uint32_t>* buckets, const Columns& data_columns,
+                               uint32_t start, uint32_t count);
 
-    static void _build_nullable_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
-                                        const Columns& data_columns, const NullColumns& null_columns, uint32_t start,
-                                        uint32_t count);
+    static void _build_nullable_columns(JoinHashTableItems* table_items, Buffer<uint32_t>* buckets,
+                                        Buffer<uint8_t>* is_nulls, const Columns& data_columns,
+                                        const NullColumns& null_columns, uint32_t start, uint32_t count);
 };
 
 class SerializedJoinBuildFunc {
 public:
     static void prepare(RuntimeState* state, JoinHashTableItems* table_items);
     static const Buffer<Slice>& get_key_data(const JoinHashTableItems& table_items) { return table_items.build_slice; }
+    static void compute_bucket_nums(RuntimeState* state, JoinHashTableItems* table_items, Buffer<uint32_t>* buckets);
     static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                      HashTableProbeState* probe_state);
 
@@ -742,12 +897,22 @@ public:
     // and the different probe state from this.
     JoinHashTable clone_readable_table();
     void set_probe_profile(RuntimeProfile::Counter* search_ht_timer, RuntimeProfile::Counter* output_probe_column_timer,
-                           RuntimeProfile::Counter* output_build_column_timer);
+                           RuntimeProfile::Counter* output_build_column_timer,
+                           RuntimeProfile::Counter* prefetch_rows_counter);
 
     void create(const HashTableParam& param);
     void close();
 
     [[nodiscard]] Status build(RuntimeState* state);
+    // The built items of this hash table, which the hash tables of the same join in other fragment instances
+    // receiving the same build rows can share.
+    std::shared_ptr<const JoinHashTableItems> build_items() const { return _table_items; }
+    // Shares the items built by another hash table of the same join instead of building, the rows appended to this
+    // hash table are dropped. Only the built data is taken from |build|, the descriptors are still of this hash table.
+    void share_build(std::shared_ptr<const JoinHashTableItems> build, RuntimeState* state);
+    // The items of a build shared by the fragment instances outlive the instance which built them, so they are built,
+    // shared and released under |mem_tracker| instead of the tracker of the current thread.
+    void set_mem_tracker(std::shared_ptr<MemTracker> mem_tracker) { _mem_tracker = std::move(mem_tracker); }
     void reset_probe_state(RuntimeState* state);
     [[nodiscard]] Status probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
                                bool* eos);
@@ -765,6 +930,7 @@ public:
     size_t get_build_column_count() const { return _table_items->build_column_count; }
     size_t get_output_build_column_count() const { return _table_items->output_build_column_count; }
     size_t get_bucket_size() const { return _table_items->bucket_size; }
+    size_t get_huge_page_bytes() const { return _table_items->huge_page_bytes; }
     float get_keys_per_bucket() const;
     void remove_duplicate_index(Filter* filter);
 
@@ -772,10 +938,15 @@ public:
 
 private:
     JoinHashMapType _choose_join_hash_map();
+    uint32_t _choose_num_build_partitions() const;
     static size_t _get_size_of_fixed_and_contiguous_type(LogicalType data_type);
+    // The length of the longest value of the single string join key of the build rows.
+    size_t _get_max_length_of_string_key() const;
 
     [[nodiscard]] Status _upgrade_key_columns_if_overflow();
 
+    MemTracker* _current_mem_tracker() const;
+
     void _remove_duplicate_index_for_left_outer_join(Filter* filter);
     void _remove_duplicate_index_for_left_semi_join(Filter* filter);
     void _remove_duplicate_index_for_left_anti_join(Filter* filter);
@@ -809,6 +980,7 @@ private:
 
     std::shared_ptr<JoinHashTableItems> _table_items;
     std::unique_ptr<HashTableProbeState> _probe_state = std::make_unique<HashTableProbeState>();
+    std::shared_ptr<MemTracker> _mem_tracker;
 };
 } // namespace starrocks
 
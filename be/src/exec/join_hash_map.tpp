@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "common/config.h"
 #include "simd/simd.h"
 
 #define JOIN_HASH_MAP_TPP
@@ -24,8 +25,10 @@ namespace starrocks {
 template <LogicalType LT>
 void JoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::resize_with_huge_pages(&table_items->first, table_items->bucket_size,
+                                              &table_items->huge_page_bytes);
+    JoinHashMapHelper::resize_with_huge_pages(&table_items->next, table_items->row_count + 1,
+                                              &table_items->huge_page_bytes);
 }
 
 template <LogicalType LT>
@@ -50,14 +53,29 @@ const Buffer<typename JoinBuildFunc<LT>::CppType>& JoinBuildFunc<LT>::get_key_da
     }
 }
 
+template <LogicalType LT>
+void JoinBuildFunc<LT>::compute_bucket_nums(RuntimeState* state, JoinHashTableItems* table_items,
+                                            Buffer<uint32_t>* buckets) {
+    auto& data = get_key_data(*table_items);
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, buckets, 0,
+                                                 table_items->row_count + 1);
+}
+
 template <LogicalType LT>
 void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
+    JoinHashMapHelper::build_rows_by_partition(
+            *table_items, [table_items](uint32_t start, uint32_t count) { _build_rows(table_items, start, count); });
+    table_items->calculate_ht_info(table_items->key_columns[0]->byte_size());
+}
+
+template <LogicalType LT>
+void JoinBuildFunc<LT>::_build_rows(JoinHashTableItems* table_items, uint32_t start, uint32_t count) {
     auto& data = get_key_data(*table_items);
     if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
-        for (size_t i = 1; i < table_items->row_count + 1; i++) {
+        for (size_t i = start; i < start + count; i++) {
             if (null_array[i] == 0) {
                 uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
                 table_items->next[i] = table_items->first[bucket_num];
@@ -65,13 +83,12 @@ void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableI
             }
         }
     } else {
-        for (size_t i = 1; i < table_items->row_count + 1; i++) {
+        for (size_t i = start; i < start + count; i++) {
             uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
             table_items->next[i] = table_items->first[bucket_num];
             table_items->first[bucket_num] = i;
         }
     }
-    table_items->calculate_ht_info(table_items->key_columns[0]->byte_size());
 }
 
 template <LogicalType LT>
@@ -79,8 +96,10 @@ void DirectMappingJoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTabl
     static constexpr size_t BUCKET_SIZE =
             (int64_t)(RunTimeTypeLimits<LT>::max_value()) - (int64_t)(RunTimeTypeLimits<LT>::min_value()) + 1L;
     table_items->bucket_size = BUCKET_SIZE;
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::resize_with_huge_pages(&table_items->first, table_items->bucket_size,
+                                              &table_items->huge_page_bytes);
+    JoinHashMapHelper::resize_with_huge_pages(&table_items->next, table_items->row_count + 1,
+                                              &table_items->huge_page_bytes);
 }
 
 template <LogicalType LT>
@@ -94,6 +113,17 @@ const Buffer<typename DirectMappingJoinBuildFunc<LT>::CppType>& DirectMappingJoi
     return ColumnHelper::as_raw_column<ColumnType>(table_items.key_columns[0])->get_data();
 }
 
+template <LogicalType LT>
+void DirectMappingJoinBuildFunc<LT>::compute_bucket_nums(RuntimeState* state, JoinHashTableItems* table_items,
+                                                         Buffer<uint32_t>* buckets) {
+    static constexpr CppType MIN_VALUE = RunTimeTypeLimits<LT>::min_value();
+
+    auto& data = get_key_data(*table_items);
+    for (size_t i = 0; i < table_items->row_count + 1; i++) {
+        (*buckets)[i] = data[i] - MIN_VALUE;
+    }
+}
+
 template <LogicalType LT>
 void DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                                           HashTableProbeState* probe_state) {
@@ -123,91 +153,94 @@ void DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, J
 template <LogicalType LT>
 void FixedSizeJoinBuildFunc<LT>::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::resize_with_huge_pages(&table_items->first, table_items->bucket_size,
+                                              &table_items->huge_page_bytes);
+    JoinHashMapHelper::resize_with_huge_pages(&table_items->next, table_items->row_count + 1,
+                                              &table_items->huge_page_bytes);
     table_items->build_key_column = ColumnType::create(table_items->row_count + 1);
 }
 
+template <LogicalType LT>
+void FixedSizeJoinBuildFunc<LT>::compute_bucket_nums(RuntimeState* state, JoinHashTableItems* table_items,
+                                                     Buffer<uint32_t>* buckets) {
+    Columns data_columns;
+    NullColumns null_columns;
+    JoinHashMapHelper::prepare_build_key_columns(*table_items, &data_columns, &null_columns);
+
+    // The keys are serialized again by construct_hash_table() after the build rows are reordered.
+    const uint32_t num_rows = table_items->row_count + 1;
+    JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), 0,
+                                                           num_rows);
+    const auto& data = get_key_data(*table_items);
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, buckets, 0, num_rows);
+}
+
 template <LogicalType LT>
 void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                                       HashTableProbeState* probe_state) {
-    uint32_t row_count = table_items->row_count;
-
     // prepare columns
     Columns data_columns;
     NullColumns null_columns;
-    for (size_t i = 0; i < table_items->key_columns.size(); i++) {
-        if (table_items->join_keys[i].is_null_safe_equal) {
-            data_columns.emplace_back(table_items->key_columns[i]);
-        } else if (table_items->key_columns[i]->is_nullable()) {
-            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[i]);
-            data_columns.emplace_back(nullable_column->data_column());
-            if (table_items->key_columns[i]->has_null()) {
-                null_columns.emplace_back(nullable_column->null_column());
+    JoinHashMapHelper::prepare_build_key_columns(*table_items, &data_columns, &null_columns);
+
+    // serialize and build hash table chunk by chunk, the partitions may be built concurrently, so each of them
+    // has its own scratch buffers.
+    const uint32_t chunk_size = state->chunk_size();
+    auto build_rows = [&](uint32_t start, uint32_t count) {
+        Buffer<uint32_t> buckets(chunk_size);
+        Buffer<uint8_t> is_nulls(null_columns.empty() ? 0 : chunk_size);
+        for (uint32_t offset = 0; offset < count; offset += chunk_size) {
+            const uint32_t num_rows = std::min(chunk_size, count - offset);
+            if (!null_columns.empty()) {
+                _build_nullable_columns(table_items, &buckets, &is_nulls, data_columns, null_columns, start + offset,
+                                        num_rows);
+            } else {
+                _build_columns(table_items, &buckets, data_columns, start + offset, num_rows);
             }
-        } else {
-            data_columns.emplace_back(table_items->key_columns[i]);
-        }
-    }
-
-    // serialize and build hash table
-    uint32_t quo = row_count / state->chunk_size();
-    uint32_t rem = row_count % state->chunk_size();
-
-    if (!null_columns.empty()) {
-        for (size_t i = 0; i < quo; i++) {
-            _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * i,
-                                    state->chunk_size());
-        }
-        _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * quo,
-                                rem);
-    } else {
-        for (size_t i = 0; i < quo; i++) {
-            _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * i, state->chunk_size());
         }
-        _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem);
-    }
+    };
+    JoinHashMapHelper::build_rows_by_partition(*table_items, build_rows);
     table_items->calculate_ht_info(table_items->build_key_column->byte_size());
 }
 
 template <LogicalType LT>
-void FixedSizeJoinBuildFunc<LT>::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
+void FixedSizeJoinBuildFunc<LT>::_build_columns(JoinHashTableItems* table_items, Buffer<uint32_t>* buckets,
                                                 const Columns& data_columns, uint32_t start, uint32_t count) {
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), start,
                                                            count);
 
     const auto& data = get_key_data(*table_items);
-    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, buckets, start, count);
 
     for (uint32_t i = 0; i < count; i++) {
-        table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-        table_items->first[probe_state->buckets[i]] = start + i;
+        table_items->next[start + i] = table_items->first[(*buckets)[i]];
+        table_items->first[(*buckets)[i]] = start + i;
     }
 }
 
 template <LogicalType LT>
-void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* table_items,
-                                                         HashTableProbeState* probe_state, const Columns& data_columns,
+void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* table_items, Buffer<uint32_t>* buckets,
+                                                         Buffer<uint8_t>* is_nulls, const Columns& data_columns,
                                                          const NullColumns& null_columns, uint32_t start,
                                                          uint32_t count) {
     for (uint32_t i = 0; i < count; i++) {
-        probe_state->is_nulls[i] = null_columns[0]->get_data()[start + i];
+        (*is_nulls)[i] = null_columns[0]->get_data()[start + i];
     }
     for (uint32_t i = 1; i < null_columns.size(); i++) {
         for (uint32_t j = 0; j < count; j++) {
-            probe_state->is_nulls[j] |= null_columns[i]->get_data()[start + j];
+            (*is_nulls)[j] |= null_columns[i]->get_data()[start + j];
         }
     }
 
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), start,
                                                            count);
     const auto& data = get_key_data(*table_items);
-    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, buckets, start, count);
 
     for (size_t i = 0; i < count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-            table_items->first[probe_state->buckets[i]] = start + i;
+        if ((*is_nulls)[i] == 0) {
+            table_items->next[start + i] = table_items->first[(*buckets)[i]];
+            table_items->first[(*buckets)[i]] = start + i;
         }
     }
 }
@@ -268,6 +301,7 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
     if ((*probe_state->key_columns)[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
 
+        JoinHashMapHelper::prefetch_buckets(table_items, *probe_state);
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
             for (size_t i = 0; i < probe_row_count; i++) {
@@ -288,6 +322,7 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
         return;
     }
 
+    JoinHashMapHelper::prefetch_buckets(table_items, *probe_state);
     for (size_t i = 0; i < probe_row_count; i++) {
         probe_state->next[i] = table_items.first[probe_state->buckets[i]];
     }
@@ -351,6 +386,7 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
+    JoinHashMapHelper::prefetch_buckets(table_items, *probe_state);
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->next[i] = table_items.first[probe_state->buckets[i]];
     }
@@ -377,6 +413,7 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
+    JoinHashMapHelper::prefetch_buckets(table_items, *probe_state);
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
             probe_state->next[i] = table_items.first[probe_state->buckets[i]];
@@ -412,6 +449,11 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::probe_prepare(RuntimeState* state) {
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
 void JoinHashMap<LT, BuildFunc, ProbeFunc>::build(RuntimeState* state) {
+    if (_table_items->num_build_partitions > 1) {
+        Buffer<uint32_t> buckets(_table_items->row_count + 1);
+        BuildFunc().compute_bucket_nums(state, _table_items, &buckets);
+        JoinHashMapHelper::partition_build_rows(_table_items, buckets);
+    }
     BuildFunc().construct_hash_table(state, _table_items, _probe_state);
 }
 
@@ -670,10 +712,17 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_search_ht(RuntimeState* state, Chun
         if (state->query_options().interleaving_group_size > 0 && !_table_items->ht_cache_miss_serious()) {
             _probe_state->active_coroutines = 0;
         }
+        // the prefetches are useless if the ht fits in the cache.
+        _probe_state->enable_prefetch =
+                config::hash_join_probe_enable_prefetch && _table_items->ht_cache_miss_serious();
         ProbeFunc().lookup_init(*_table_items, _probe_state);
 
         auto& build_data = BuildFunc().get_key_data(*_table_items);
         auto& probe_data = ProbeFunc().get_key_data(*_probe_state);
+        // the coroutines hide the misses of searching the hash table by themselves.
+        if (_probe_state->enable_prefetch && _probe_state->active_coroutines == 0) {
+            JoinHashMapHelper::prefetch_build_rows(*_table_items, _probe_state, build_data);
+        }
         _search_ht_impl<true>(state, build_data, probe_data);
     } else {
         auto& build_data = BuildFunc().get_key_data(*_table_items);
@@ -514,8 +514,8 @@ Status JsonReader::_read_rows(Chunk* chunk, int32_t rows_to_read, int32_t* rows_
 Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* row, Chunk* chunk) {
     _parsed_columns.assign(chunk->num_columns(), false);
 
+    uint32_t key_index = 0;
     try {
-        uint32_t key_index = 0;
         for (auto field : *row) {
             int column_index;
             std::string_view key = field.unescaped_key();
@@ -551,6 +551,7 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
                 auto itr = _slot_desc_dict.find(key);
                 if (itr == _slot_desc_dict.end()) {
                     // parsed key of the json object is not in the slot dict, and we will skip this field
+                    _missing_columns_valid = false;
                     if (_prev_parsed_position.size() <= key_index) {
                         _prev_parsed_position.emplace_back(key);
                     } else {
@@ -564,6 +565,7 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
                 auto slot_desc = itr->second;
 
                 // update the prev parsed position
+                _missing_columns_valid = false;
                 column_index = chunk->get_index_by_slot_id(slot_desc->id());
                 if (_prev_parsed_position.size() <= key_index) {
                     _prev_parsed_position.emplace_back(key, column_index, slot_desc->type());
@@ -591,20 +593,32 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
         return Status::DataQualityError(err_msg);
     }
 
+    // Rows of a load usually share the same keys in the same order. When every key of this row hit
+    // _prev_parsed_position and the key count is unchanged, the columns without data are the same as
+    // the previous row's, so reuse them instead of scanning all the columns of the chunk.
+    if (!_missing_columns_valid || key_index != _prev_num_keys) {
+        _missing_columns.clear();
+        for (int i = 0; i < chunk->num_columns(); i++) {
+            if (!_parsed_columns[i]) {
+                _missing_columns.push_back(i);
+            }
+        }
+        _prev_num_keys = key_index;
+        _missing_columns_valid = true;
+    }
+
     // append null to the column without data.
-    for (int i = 0; i < chunk->num_columns(); i++) {
-        if (!_parsed_columns[i]) {
-            auto& column = chunk->get_column_by_index(i);
-            if (UNLIKELY(i == _op_col_index)) {
-                // special treatment for __op column, fill default value '0' rather than null
-                if (column->is_binary()) {
-                    std::ignore = column->append_strings(std::vector{Slice{"0"}});
-                } else {
-                    column->append_datum(Datum((uint8_t)0));
-                }
+    for (int i : _missing_columns) {
+        auto& column = chunk->get_column_by_index(i);
+        if (UNLIKELY(i == _op_col_index)) {
+            // special treatment for __op column, fill default value '0' rather than null
+            if (column->is_binary()) {
+                std::ignore = column->append_strings(std::vector{Slice{"0"}});
             } else {
-                column->append_nulls(1);
+                column->append_datum(Datum((uint8_t)0));
             }
+        } else {
+            column->append_nulls(1);
         }
     }
     return Status::OK();
@@ -146,6 +146,11 @@ private:
     std::vector<PreviousParsedItem> _prev_parsed_position;
     // record the parsed column index for current json object
     std::vector<uint8_t> _parsed_columns;
+    // record the chunk columns which previous parsed json object has no data for, it's valid until
+    // _prev_parsed_position is changed
+    std::vector<int> _missing_columns;
+    bool _missing_columns_valid = false;
+    uint32_t _prev_num_keys = 0;
     // record the "__op" column's index
     int _op_col_index;
 
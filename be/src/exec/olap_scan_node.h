@@ -97,6 +97,8 @@ public:
     }
 
     bool output_chunk_by_bucket() const override { return _output_chunk_by_bucket; }
+    // Must be called before the morsel queue factory of this node is created.
+    void set_output_chunk_by_bucket(bool value) { _output_chunk_by_bucket = value; }
     bool is_asc_hint() const override { return _output_asc_hint; }
     std::optional<bool> partition_order_hint() const override { return _partition_order_hint; }
 
@@ -0,0 +1,152 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/partition/partition_topn_heaps.h"
+
+#include <algorithm>
+
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "exec/sorting/sort_helper.h"
+
+namespace starrocks {
+
+PartitionTopnHeaps::PartitionTopnHeaps(const std::vector<ExprContext*>* sort_exprs,
+                                       const std::vector<bool>& is_asc_order, const std::vector<bool>& is_null_first,
+                                       size_t offset, size_t limit)
+        : _sort_exprs(sort_exprs),
+          _sort_descs(is_asc_order, is_null_first),
+          _offset(offset),
+          _rows_to_keep(offset + limit) {}
+
+bool PartitionTopnHeaps::_less(uint32_t lhs, uint32_t rhs) const {
+    return compare_chunk_row(_sort_descs, _arena_keys, _arena_keys, lhs, rhs) < 0;
+}
+
+Status PartitionTopnHeaps::update(size_t partition_idx, const ChunkPtr& chunk) {
+    if (chunk == nullptr || chunk->is_empty() || _rows_to_keep == 0) {
+        return Status::OK();
+    }
+    const size_t num_rows = chunk->num_rows();
+    Columns keys;
+    keys.reserve(_sort_exprs->size());
+    for (auto* ctx : *_sort_exprs) {
+        ASSIGN_OR_RETURN(ColumnPtr key, ctx->evaluate(chunk.get()));
+        keys.emplace_back(ColumnHelper::unpack_and_duplicate_const_column(num_rows, key));
+    }
+    if (_arena == nullptr) {
+        _arena = chunk->clone_empty();
+        for (const auto& key : keys) {
+            _arena_keys.emplace_back(key->clone_empty());
+        }
+    }
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (keys[i]->is_nullable() && !_arena_keys[i]->is_nullable()) {
+            _arena_keys[i] = NullableColumn::wrap_if_necessary(_arena_keys[i]);
+        }
+    }
+
+    // Only the rows which beat the top of a full heap can be kept.
+    auto& heap = _heaps[partition_idx];
+    const bool is_full = heap.size() >= _rows_to_keep;
+    _selection.clear();
+    for (uint32_t i = 0; i < num_rows; i++) {
+        if (!is_full || compare_chunk_row(_sort_descs, keys, _arena_keys, i, heap.front()) < 0) {
+            _selection.push_back(i);
+        }
+    }
+    if (_selection.empty()) {
+        return Status::OK();
+    }
+
+    const auto first_row = static_cast<uint32_t>(_arena->num_rows());
+    const auto num_selected = static_cast<uint32_t>(_selection.size());
+    _arena->append_selective(*chunk, _selection.data(), 0, num_selected);
+    for (size_t i = 0; i < keys.size(); i++) {
+        _arena_keys[i]->append_selective(*keys[i], _selection.data(), 0, num_selected);
+    }
+
+    auto less = [this](uint32_t lhs, uint32_t rhs) { return _less(lhs, rhs); };
+    for (uint32_t row = first_row; row < first_row + num_selected; row++) {
+        if (heap.size() < _rows_to_keep) {
+            heap.push_back(row);
+            std::push_heap(heap.begin(), heap.end(), less);
+            _num_kept_rows++;
+        } else if (_less(row, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), less);
+            heap.back() = row;
+            std::push_heap(heap.begin(), heap.end(), less);
+        }
+    }
+
+    if (_arena->num_rows() >= kMinRowsToCompact && _arena->num_rows() > 2 * _num_kept_rows) {
+        _compact();
+    }
+    return Status::OK();
+}
+
+void PartitionTopnHeaps::_compact() {
+    // Renumbering the rows keeps their order, so every heap is still a heap.
+    std::vector<uint32_t> rows;
+    rows.reserve(_num_kept_rows);
+    for (auto& heap : _heaps) {
+        for (auto& row : heap) {
+            const auto new_row = static_cast<uint32_t>(rows.size());
+            rows.push_back(row);
+            row = new_row;
+        }
+    }
+
+    const auto num_rows = static_cast<uint32_t>(rows.size());
+    ChunkPtr arena = _arena->clone_empty(num_rows);
+    arena->append_selective(*_arena, rows.data(), 0, num_rows);
+    _arena = std::move(arena);
+    for (auto& key : _arena_keys) {
+        ColumnPtr new_key = key->clone_empty();
+        new_key->append_selective(*key, rows.data(), 0, num_rows);
+        key = std::move(new_key);
+    }
+}
+
+void PartitionTopnHeaps::done() {
+    auto less = [this](uint32_t lhs, uint32_t rhs) { return _less(lhs, rhs); };
+    _output_rows.reserve(_num_kept_rows);
+    for (auto& heap : _heaps) {
+        std::sort_heap(heap.begin(), heap.end(), less);
+        if (heap.size() > _offset) {
+            _output_rows.insert(_output_rows.end(), heap.begin() + _offset, heap.end());
+        }
+    }
+    _heaps.clear();
+    _arena_keys.clear();
+    _selection.clear();
+}
+
+ChunkPtr PartitionTopnHeaps::get_next(size_t chunk_size) {
+    if (!has_output()) {
+        return nullptr;
+    }
+    const auto count = static_cast<uint32_t>(std::min(chunk_size, _output_rows.size() - _output_pos));
+    ChunkPtr chunk = _arena->clone_empty(count);
+    chunk->append_selective(*_arena, _output_rows.data(), _output_pos, count);
+    _output_pos += count;
+    if (!has_output()) {
+        _arena.reset();
+        _output_rows.clear();
+        _output_pos = 0;
+    }
+    return chunk;
+}
+
+} // namespace starrocks
@@ -0,0 +1,81 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "exec/sorting/sorting.h"
+#include "exprs/expr_context.h"
+
+namespace starrocks {
+
+class RuntimeState;
+
+// PartitionTopnHeaps keeps the first |offset + limit| rows of every partition of a ROW_NUMBER top-n, which is
+// what `ROW_NUMBER() OVER (PARTITION BY ... ORDER BY ...) <= k` is rewritten to.
+//
+// A ChunksSorterTopn per partition costs far more than the few rows it keeps when there are many partitions.
+// Instead, the rows of all the partitions are appended to one row arena, and each partition only owns a bounded
+// max-heap of the indexes of its rows in the arena, whose top is the last row the partition keeps so far. Rows that
+// can't beat the top of a full heap are dropped before they get into the arena, and the arena is compacted once
+// most of its rows have been evicted from the heaps.
+class PartitionTopnHeaps {
+public:
+    PartitionTopnHeaps(const std::vector<ExprContext*>* sort_exprs, const std::vector<bool>& is_asc_order,
+                       const std::vector<bool>& is_null_first, size_t offset, size_t limit);
+
+    void add_partition() { _heaps.emplace_back(); }
+
+    [[nodiscard]] Status update(size_t partition_idx, const ChunkPtr& chunk);
+
+    // Sort the rows of each partition, no more update after it.
+    void done();
+
+    // Output the rows partition by partition, and in the order of the sort keys in a partition.
+    // Return nullptr if all the rows have been output.
+    ChunkPtr get_next(size_t chunk_size);
+
+    bool has_output() const { return _output_pos < _output_rows.size(); }
+
+    size_t num_arena_rows() const { return _arena == nullptr ? 0 : _arena->num_rows(); }
+
+private:
+    static constexpr size_t kMinRowsToCompact = 4096;
+
+    // Whether arena row |lhs| sorts before arena row |rhs|.
+    bool _less(uint32_t lhs, uint32_t rhs) const;
+    void _compact();
+
+    const std::vector<ExprContext*>* _sort_exprs;
+    const SortDescs _sort_descs;
+    const size_t _offset;
+    const size_t _rows_to_keep;
+
+    ChunkPtr _arena;
+    Columns _arena_keys;
+    // The arena rows each partition keeps, a max-heap before done() and sorted after it.
+    std::vector<std::vector<uint32_t>> _heaps;
+    size_t _num_kept_rows = 0;
+
+    std::vector<uint32_t> _selection;
+    std::vector<uint32_t> _output_rows;
+    size_t _output_pos = 0;
+};
+
+} // namespace starrocks
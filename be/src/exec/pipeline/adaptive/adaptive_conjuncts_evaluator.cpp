@@ -0,0 +1,131 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/adaptive/adaptive_conjuncts_evaluator.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "exprs/expr_context.h"
+#include "runtime/current_thread.h"
+#include "simd/simd.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+void AdaptiveConjunctsEvaluator::init(const std::vector<ExprContext*>& conjuncts) {
+    _conjuncts = conjuncts;
+    _stats.assign(conjuncts.size(), ConjunctStats{});
+    _num_chunks = 0;
+}
+
+double AdaptiveConjunctsEvaluator::ConjunctStats::rank() const {
+    if (evaluated_rows == 0 || input_rows == 0) {
+        return 0;
+    }
+    const double cost_per_row = cost_ns / evaluated_rows;
+    const double drop_rate = 1 - output_rows / input_rows;
+    if (drop_rate <= 0) {
+        // A conjunct dropping nothing goes to the end, ordered by its cost.
+        return std::numeric_limits<double>::max() / 2 + cost_per_row;
+    }
+    return cost_per_row / drop_rate;
+}
+
+void AdaptiveConjunctsEvaluator::_reorder() {
+    std::vector<size_t> order(_conjuncts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [this](size_t lhs, size_t rhs) { return _stats[lhs].rank() < _stats[rhs].rank(); });
+
+    std::vector<ExprContext*> conjuncts;
+    std::vector<ConjunctStats> stats;
+    conjuncts.reserve(order.size());
+    stats.reserve(order.size());
+    for (size_t i : order) {
+        conjuncts.emplace_back(_conjuncts[i]);
+        ConjunctStats& s = stats.emplace_back(_stats[i]);
+        s.evaluated_rows /= 2;
+        s.cost_ns /= 2;
+        s.input_rows /= 2;
+        s.output_rows /= 2;
+    }
+    _conjuncts = std::move(conjuncts);
+    _stats = std::move(stats);
+}
+
+Status AdaptiveConjunctsEvaluator::evaluate(Chunk* chunk) {
+    if (_conjuncts.empty() || chunk == nullptr || chunk->is_empty()) {
+        return Status::OK();
+    }
+    ++_num_chunks;
+    if (_conjuncts.size() > 1 && (_num_chunks == kWarmupChunks || _num_chunks % kReorderInterval == 0)) {
+        _reorder();
+    }
+    TRY_CATCH_ALLOC_SCOPE_START()
+    RETURN_IF_ERROR(_evaluate(chunk));
+    TRY_CATCH_ALLOC_SCOPE_END()
+    return Status::OK();
+}
+
+Status AdaptiveConjunctsEvaluator::_evaluate(Chunk* chunk) {
+    Filter filter(chunk->num_rows(), 1);
+    // The rows of |chunk| not filtered yet.
+    size_t num_selected = chunk->num_rows();
+
+    for (size_t i = 0; i < _conjuncts.size(); i++) {
+        ConjunctStats& stats = _stats[i];
+        const int64_t start_ns = MonotonicNanos();
+        ASSIGN_OR_RETURN(ColumnPtr column, _conjuncts[i]->evaluate(chunk));
+        stats.cost_ns += MonotonicNanos() - start_ns;
+        stats.evaluated_rows += chunk->num_rows();
+        stats.input_rows += num_selected;
+
+        const size_t true_count = ColumnHelper::count_true_with_notnull(column);
+        if (true_count == column->size()) {
+            // all hit, skip
+            stats.output_rows += num_selected;
+            continue;
+        }
+        if (true_count == 0) {
+            // all not hit, return
+            chunk->set_num_rows(0);
+            return Status::OK();
+        }
+        bool all_zero = false;
+        ColumnHelper::merge_two_filters(column, &filter, &all_zero);
+        if (all_zero) {
+            chunk->set_num_rows(0);
+            return Status::OK();
+        }
+        num_selected = SIMD::count_nonzero(filter.data(), filter.size());
+        stats.output_rows += num_selected;
+
+        // Prune the chunk when more than half of its rows are dropped, a chunk with few rows left saves the
+        // evaluation of the following conjuncts, at the cost of copying the columns.
+        if (i + 1 < _conjuncts.size() && num_selected < chunk->num_rows() / 2) {
+            chunk->filter(filter, true);
+            filter.assign(num_selected, 1);
+        }
+    }
+    if (num_selected < chunk->num_rows()) {
+        chunk->filter(filter, true);
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks::pipeline
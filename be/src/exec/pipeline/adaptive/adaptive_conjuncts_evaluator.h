@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+
+namespace starrocks {
+
+class ExprContext;
+
+namespace pipeline {
+
+// AdaptiveConjunctsEvaluator evaluates the conjuncts of an operator in the order of their measured rank, so that
+// the conjuncts which are cheap and drop many rows run first, regardless of their order in the plan.
+//
+// The rank of a conjunct is cost_per_row / (1 - pass_rate), the optimal order of independent filters. The cost and
+// selectivity are measured on every chunk, the order is computed after the first kWarmupChunks chunks and then every
+// kReorderInterval chunks, where the stats are halved so that the order follows the change of the data.
+//
+// The chunk is filtered as soon as the evaluated conjuncts drop more than half of its rows, so that the following
+// conjuncts only evaluate the surviving rows.
+class AdaptiveConjunctsEvaluator {
+public:
+    void init(const std::vector<ExprContext*>& conjuncts);
+
+    // The conjuncts in the current evaluation order.
+    const std::vector<ExprContext*>& conjuncts() const { return _conjuncts; }
+    bool empty() const { return _conjuncts.empty(); }
+
+    // Evaluate all the conjuncts and filter |chunk| in place.
+    Status evaluate(Chunk* chunk);
+
+private:
+    static constexpr size_t kWarmupChunks = 8;
+    static constexpr size_t kReorderInterval = 64;
+
+    struct ConjunctStats {
+        // The rows evaluated by the conjunct, and the time spent on them.
+        double evaluated_rows = 0;
+        double cost_ns = 0;
+        // The rows not filtered yet when the conjunct is evaluated, and the rows passing it.
+        double input_rows = 0;
+        double output_rows = 0;
+
+        double rank() const;
+    };
+
+    Status _evaluate(Chunk* chunk);
+    void _reorder();
+
+    std::vector<ExprContext*> _conjuncts;
+    // Aligned with |_conjuncts|.
+    std::vector<ConjunctStats> _stats;
+    size_t _num_chunks = 0;
+};
+
+} // namespace pipeline
+} // namespace starrocks
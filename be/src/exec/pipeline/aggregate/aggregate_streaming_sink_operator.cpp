@@ -29,12 +29,24 @@ Status AggregateStreamingSinkOperator::prepare(RuntimeState* state) {
     if (_aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::LIMITED_MEM) {
         _limited_mem_state.limited_memory_size = config::streaming_agg_limited_memory_size;
     }
-    return _aggregator->open(state);
+    RETURN_IF_ERROR(_aggregator->open(state));
+
+    if (_sorted_aggregator != nullptr) {
+        RETURN_IF_ERROR(_sorted_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get()));
+        RETURN_IF_ERROR(_sorted_aggregator->open(state));
+        _detect_sorted_runs = !_aggregator->only_group_by_exprs();
+        _sorted_accumulator.set_max_size(state->chunk_size());
+        _sorted_runs_chunk_count = ADD_COUNTER(_unique_metrics, "SortedRunsChunkCount", TUnit::UNIT);
+    }
+    return Status::OK();
 }
 
 void AggregateStreamingSinkOperator::close(RuntimeState* state) {
     auto* counter = ADD_COUNTER(_unique_metrics, "HashTableMemoryUsage", TUnit::BYTES);
     counter->set(_aggregator->hash_map_memory_usage());
+    if (_sorted_aggregator != nullptr) {
+        _sorted_aggregator->unref(state);
+    }
     _aggregator->unref(state);
     Operator::close(state);
 }
@@ -47,6 +59,18 @@ Status AggregateStreamingSinkOperator::set_finishing(RuntimeState* state) {
         return Status::OK();
     }
 
+    if (_detect_sorted_runs) {
+        // Output the last group of the sorted runs, which is still open.
+        ASSIGN_OR_RETURN(auto res, _sorted_aggregator->pull_eos_chunk());
+        if (res != nullptr && !res->is_empty()) {
+            _sorted_accumulator.push(std::move(res));
+        }
+        _sorted_accumulator.finalize();
+        while (_sorted_accumulator.has_output()) {
+            _aggregator->offer_chunk_to_buffer(std::move(_sorted_accumulator.pull()));
+        }
+    }
+
     if (_aggregator->hash_map_variant().size() == 0) {
         _aggregator->set_ht_eos();
     }
@@ -88,8 +112,38 @@ Status AggregateStreamingSinkOperator::push_chunk(RuntimeState* state, const Chu
     return Status::OK();
 }
 
+bool AggregateStreamingSinkOperator::_is_grouped_in_runs(const size_t chunk_size) {
+    const int32_t min_avg_length = config::streaming_agg_sorted_run_min_avg_length;
+    if (!_detect_sorted_runs || min_avg_length <= 0 || chunk_size < min_avg_length) {
+        return false;
+    }
+    auto num_runs = SortedStreamingAggregator::count_runs(_aggregator->group_by_columns(), &_run_cmp_vector);
+    if (!num_runs.ok()) {
+        // The group by columns can't be compared row by row, never try it again.
+        _detect_sorted_runs = false;
+        return false;
+    }
+    return num_runs.value() * min_avg_length <= chunk_size;
+}
+
+Status AggregateStreamingSinkOperator::_push_chunk_by_sorted_runs(const ChunkPtr& chunk, const size_t chunk_size) {
+    SCOPED_TIMER(_aggregator->agg_compute_timer());
+    COUNTER_UPDATE(_sorted_runs_chunk_count, 1);
+    _sorted_aggregator->share_groupby_columns(chunk.get(), *_aggregator);
+    RETURN_IF_ERROR(_sorted_aggregator->evaluate_agg_fn_exprs(chunk.get()));
+    ASSIGN_OR_RETURN(auto res, _sorted_aggregator->streaming_compute_agg_state(chunk_size));
+    if (res != nullptr && !res->is_empty()) {
+        _sorted_accumulator.push(std::move(res));
+    }
+    if (_sorted_accumulator.has_output()) {
+        _aggregator->offer_chunk_to_buffer(std::move(_sorted_accumulator.pull()));
+    }
+    return Status::OK();
+}
+
 Status AggregateStreamingSinkOperator::_push_chunk_by_force_streaming(const ChunkPtr& chunk) {
     SCOPED_TIMER(_aggregator->streaming_timer());
+    COUNTER_UPDATE(_aggregator->pass_through_chunk_count(), 1);
     ChunkPtr res = std::make_shared<Chunk>();
     RETURN_IF_ERROR(_aggregator->output_chunk_by_streaming(chunk.get(), &res));
     _aggregator->offer_chunk_to_buffer(std::move(res));
@@ -99,6 +153,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_force_streaming(const Chun
 Status AggregateStreamingSinkOperator::_push_chunk_by_force_preaggregation(const ChunkPtr& chunk,
                                                                            const size_t chunk_size) {
     SCOPED_TIMER(_aggregator->agg_compute_timer());
+    COUNTER_UPDATE(_aggregator->preagg_chunk_count(), 1);
     TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map(chunk_size));
     if (_aggregator->is_none_group_by_exprs()) {
         RETURN_IF_ERROR(_aggregator->compute_single_agg_state(chunk.get(), chunk_size));
@@ -115,6 +170,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_force_preaggregation(const
 Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(const ChunkPtr& chunk,
                                                                                const size_t chunk_size,
                                                                                bool need_build) {
+    COUNTER_UPDATE(_aggregator->selective_preagg_chunk_count(), 1);
     if (need_build) {
         SCOPED_TIMER(_aggregator->agg_compute_timer());
         TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection(chunk_size));
@@ -163,10 +219,34 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(c
  * should be small enough to limit the size of hash table.
  *
  * SELECTIVE_PREAGG state aggregates continuous_limit chunks, then shifting to ADJUST state.
+ *
+ * If the rows of a chunk come in INIT_PREAGG or ADJUST state in long runs of the same group by keys, the state shifts
+ * to SORTED_PREAGG, which aggregates the chunks by the runs without the hash table. It sustains as long as the chunks
+ * come in long runs, then going back to the state it came from.
  */
 Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk, const size_t chunk_size) {
     size_t allocated_bytes = _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool());
     const size_t continuous_limit = _auto_context.get_continuous_limit();
+    const AggrAutoState prev_state = _auto_state;
+    DeferOp update_switch_count([&]() {
+        if (_auto_state != prev_state) {
+            COUNTER_UPDATE(_aggregator->auto_state_switch_count(), 1);
+        }
+    });
+    if (_auto_state == AggrAutoState::SORTED_PREAGG) {
+        if (!_is_grouped_in_runs(chunk_size)) {
+            _auto_state = _state_before_sorted_preagg;
+            _auto_context.adjust_count = 0;
+            VLOG_ROW << "auto agg: short runs " << _auto_context.get_auto_state_string(AggrAutoState::SORTED_PREAGG)
+                     << " -> " << _auto_context.get_auto_state_string(_auto_state);
+        }
+    } else if ((_auto_state == AggrAutoState::INIT_PREAGG || _auto_state == AggrAutoState::ADJUST) &&
+               _is_grouped_in_runs(chunk_size)) {
+        _state_before_sorted_preagg = _auto_state;
+        _auto_state = AggrAutoState::SORTED_PREAGG;
+        VLOG_ROW << "auto agg: long runs " << _auto_context.get_auto_state_string(_state_before_sorted_preagg)
+                 << " -> " << _auto_context.get_auto_state_string(_auto_state);
+    }
     switch (_auto_state) {
     case AggrAutoState::INIT_PREAGG: {
         bool ht_needs_expansion = _aggregator->hash_map_variant().need_expand(chunk_size);
@@ -202,7 +282,8 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
         }
 
         size_t hit_count = SIMD::count_zero(_aggregator->streaming_selection());
-        if (_auto_context.adjust_count < continuous_limit && _auto_context.is_low_reduction(hit_count, chunk_size)) {
+        if (_auto_context.adjust_count < continuous_limit &&
+            _auto_context.is_low_reduction(hit_count, chunk_size, allocated_bytes)) {
             RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
             _auto_context.pass_through_count++;
             _auto_context.preagg_count = 0;
@@ -292,6 +373,10 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
         }
         break;
     }
+    case AggrAutoState::SORTED_PREAGG: {
+        RETURN_IF_ERROR(_push_chunk_by_sorted_runs(chunk, chunk_size));
+        break;
+    }
     }
     return Status::OK();
 }
@@ -308,6 +393,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_limited_memory(const Chunk
 
 Status AggregateStreamingSinkOperator::reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) {
     _is_finished = false;
+    _sorted_accumulator.reset_state();
     return _aggregator->reset_state(state, refill_chunks, this);
 }
 } // namespace starrocks::pipeline
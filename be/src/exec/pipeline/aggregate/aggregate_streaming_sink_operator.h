@@ -16,20 +16,28 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "exec/aggregator.h"
 #include "exec/pipeline/operator.h"
+#include "exec/sorted_streaming_aggregator.h"
+#include "storage/chunk_helper.h"
 
 namespace starrocks::pipeline {
 
 class AggregateStreamingSinkOperator : public Operator {
 public:
     AggregateStreamingSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-                                   AggregatorPtr aggregator)
+                                   AggregatorPtr aggregator, SortedStreamingAggregatorPtr sorted_aggregator = nullptr)
             : Operator(factory, id, "aggregate_streaming_sink", plan_node_id, false, driver_sequence),
               _aggregator(std::move(aggregator)),
+              _sorted_aggregator(std::move(sorted_aggregator)),
               _auto_state(AggrAutoState::INIT_PREAGG) {
         _aggregator->set_aggr_phase(AggrPhase1);
         _aggregator->ref();
+        if (_sorted_aggregator != nullptr) {
+            _sorted_aggregator->set_aggr_phase(AggrPhase1);
+            _sorted_aggregator->ref();
+        }
     }
     ~AggregateStreamingSinkOperator() override = default;
 
@@ -65,15 +73,31 @@ private:
     // Invoked by push_chunk  if current mode is TStreamingPreaggregationMode::LIMITED
     [[nodiscard]] Status _push_chunk_by_limited_memory(const ChunkPtr& chunk, const size_t chunk_size);
 
+    // Whether the rows of the chunk come in long runs of the same group by keys.
+    bool _is_grouped_in_runs(const size_t chunk_size);
+
+    // Invoked by _push_chunk_by_auto in SORTED_PREAGG state, aggregates the chunk by the runs of the same group by
+    // keys without the hash table.
+    [[nodiscard]] Status _push_chunk_by_sorted_runs(const ChunkPtr& chunk, const size_t chunk_size);
+
     // It is used to perform aggregation algorithms shared by
     // AggregateStreamingSourceOperator. It is
     // - prepared at SinkOperator::prepare(),
     // - reffed at constructor() of both sink and source operator,
     // - unreffed at close() of both sink and source operator.
     AggregatorPtr _aggregator = nullptr;
+    // Aggregates the chunks whose rows come in long runs of the same group by keys, e.g. the input is sorted by
+    // the group by keys. Its output is partial too, so it's fine that a group is also in the hash table.
+    SortedStreamingAggregatorPtr _sorted_aggregator = nullptr;
+    bool _detect_sorted_runs = false;
+    std::vector<uint8_t> _run_cmp_vector;
+    ChunkPipelineAccumulator _sorted_accumulator;
+    RuntimeProfile::Counter* _sorted_runs_chunk_count = nullptr;
     // Whether prev operator has no output
     bool _is_finished = false;
     AggrAutoState _auto_state{};
+    // The state to go back to once the chunks no longer come in long runs in SORTED_PREAGG state.
+    AggrAutoState _state_before_sorted_preagg{};
     AggrAutoContext _auto_context;
     LimitedMemAggState _limited_mem_state;
 };
@@ -82,16 +106,26 @@ class AggregateStreamingSinkOperatorFactory final : public OperatorFactory {
 public:
     AggregateStreamingSinkOperatorFactory(int32_t id, int32_t plan_node_id, AggregatorFactoryPtr aggregator_factory)
             : OperatorFactory(id, "aggregate_streaming_sink", plan_node_id),
-              _aggregator_factory(std::move(aggregator_factory)) {}
+              _aggregator_factory(std::move(aggregator_factory)) {
+        const auto& agg_node = _aggregator_factory->t_node().agg_node;
+        if (config::streaming_agg_sorted_run_min_avg_length > 0 && _aggregator_factory->aggr_mode() == AM_DEFAULT &&
+            !agg_node.grouping_exprs.empty()) {
+            _sorted_aggregator_factory = std::make_shared<StreamingAggregatorFactory>(_aggregator_factory->t_node());
+            _sorted_aggregator_factory->set_aggr_mode(_aggregator_factory->aggr_mode());
+        }
+    }
 
     ~AggregateStreamingSinkOperatorFactory() override = default;
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
-        return std::make_shared<AggregateStreamingSinkOperator>(this, _id, _plan_node_id, driver_sequence,
-                                                                _aggregator_factory->get_or_create(driver_sequence));
+        return std::make_shared<AggregateStreamingSinkOperator>(
+                this, _id, _plan_node_id, driver_sequence, _aggregator_factory->get_or_create(driver_sequence),
+                _sorted_aggregator_factory == nullptr ? nullptr
+                                                      : _sorted_aggregator_factory->get_or_create(driver_sequence));
     }
 
 private:
     AggregatorFactoryPtr _aggregator_factory = nullptr;
+    StreamingAggregatorFactoryPtr _sorted_aggregator_factory = nullptr;
 };
 } // namespace starrocks::pipeline
@@ -21,6 +21,7 @@ namespace starrocks::pipeline {
 Status ChunkAccumulateOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     _acc.set_max_size(state->chunk_size());
+    _acc.set_max_bytes(ChunkHelper::target_chunk_bytes());
     return Status::OK();
 }
 
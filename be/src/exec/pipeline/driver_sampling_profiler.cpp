@@ -0,0 +1,250 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/driver_sampling_profiler.h"
+
+#include <fmt/format.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <ctime>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "runtime/current_thread.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+namespace starrocks::pipeline {
+
+// A single-producer ring written by the signal handler of its owner thread. Every slot is guarded by a sequence
+// number, which is odd while the slot is being written, so readers can copy slots concurrently and drop torn ones.
+struct DriverSampleRing {
+    struct Slot {
+        std::atomic<uint64_t> seq{0};
+        DriverSamplingProfiler::Sample sample;
+    };
+
+    std::atomic<uint64_t> next{0};
+    Slot slots[DriverSamplingProfiler::kRingCapacity];
+
+    // Only accessed by the owner thread.
+    timer_t timer;
+    bool has_timer = false;
+    int32_t frequency = 0;
+};
+
+// Constant-initialized, so that it can be read by the signal handler.
+static thread_local DriverSampleRing* tls_sample_ring = nullptr;
+
+// SIGRTMIN is used by get_stack_trace_for_thread.
+static int sampling_signal() {
+    return SIGRTMIN + 1;
+}
+
+static void sampling_signal_handler(int signum, siginfo_t* siginfo, void* ucontext) {
+    int saved_errno = errno;
+    DriverSamplingProfiler::sample_current_thread();
+    errno = saved_errno;
+}
+
+DriverSamplingProfiler* DriverSamplingProfiler::instance() {
+    static DriverSamplingProfiler profiler;
+    return &profiler;
+}
+
+void DriverSamplingProfiler::sample_current_thread() {
+    auto* ring = tls_sample_ring;
+    if (ring == nullptr) {
+        return;
+    }
+    const auto& ctx = tls_driver_sample_ctx;
+    const uint64_t pos = ring->next.load(std::memory_order_relaxed);
+    auto& slot = ring->slots[pos % kRingCapacity];
+    const uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto& sample = slot.sample;
+    sample.timestamp_ns = MonotonicNanos();
+    sample.query_id_hi = ctx.query_id_hi;
+    sample.query_id_lo = ctx.query_id_lo;
+    sample.workgroup_id = ctx.workgroup_id;
+    sample.driver_id = ctx.driver_id;
+    sample.plan_node_id = ctx.plan_node_id;
+    size_t name_len = 0;
+    if (ctx.operator_name != nullptr) {
+        name_len = std::min(ctx.operator_name->size(), kOperatorNameLength - 1);
+        memcpy(sample.operator_name, ctx.operator_name->data(), name_len);
+    }
+    sample.operator_name[name_len] = '\0';
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+    ring->next.store(pos + 1, std::memory_order_release);
+}
+
+void DriverSamplingProfiler::register_thread() {
+    std::call_once(_install_handler_once, [this]() {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = sampling_signal_handler;
+        action.sa_flags = SA_RESTART | SA_SIGINFO;
+        _handler_installed = sigaction(sampling_signal(), &action, nullptr) == 0;
+        LOG_IF(WARNING, !_handler_installed) << "install driver sampling signal handler failed: " << strerror(errno);
+    });
+    if (tls_sample_ring != nullptr) {
+        return;
+    }
+
+    auto ring = std::make_shared<DriverSampleRing>();
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _rings.emplace_back(ring);
+    }
+    tls_sample_ring = ring.get();
+    refresh_thread_timer();
+}
+
+void DriverSamplingProfiler::unregister_thread() {
+    auto* ring = tls_sample_ring;
+    if (ring == nullptr) {
+        return;
+    }
+    // Detach the ring before deleting the timer, a signal already pending is ignored by the handler.
+    tls_sample_ring = nullptr;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    if (ring->has_timer) {
+        timer_delete(ring->timer);
+        ring->has_timer = false;
+    }
+
+    std::lock_guard<std::mutex> l(_mutex);
+    auto it = std::find_if(_rings.begin(), _rings.end(), [ring](const auto& r) { return r.get() == ring; });
+    if (it != _rings.end()) {
+        _rings.erase(it);
+    }
+}
+
+void DriverSamplingProfiler::refresh_thread_timer() {
+    auto* ring = tls_sample_ring;
+    if (ring == nullptr || !_handler_installed) {
+        return;
+    }
+    const int32_t frequency = std::clamp<int32_t>(config::pipeline_sampling_profiler_frequency, 0, 1000);
+    if (frequency == ring->frequency) {
+        return;
+    }
+    // Remember the frequency even if it fails, so that a broken timer is not retried on every driver.
+    ring->frequency = frequency;
+
+    if (!ring->has_timer) {
+        if (frequency == 0) {
+            return;
+        }
+        struct sigevent sev;
+        memset(&sev, 0, sizeof(sev));
+        sev.sigev_notify = SIGEV_THREAD_ID;
+        sev.sigev_signo = sampling_signal();
+        sev.sigev_notify_thread_id = static_cast<pid_t>(syscall(SYS_gettid));
+        if (timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &ring->timer) != 0) {
+            LOG(WARNING) << "create driver sampling timer failed: " << strerror(errno);
+            return;
+        }
+        ring->has_timer = true;
+    }
+
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    if (frequency > 0) {
+        const int64_t interval_ns = NANOS_PER_SEC / frequency;
+        spec.it_interval.tv_sec = interval_ns / NANOS_PER_SEC;
+        spec.it_interval.tv_nsec = interval_ns % NANOS_PER_SEC;
+        spec.it_value = spec.it_interval;
+    }
+    if (timer_settime(ring->timer, 0, &spec, nullptr) != 0) {
+        LOG(WARNING) << "set driver sampling timer failed: " << strerror(errno);
+    }
+}
+
+std::vector<DriverSamplingProfiler::Sample> DriverSamplingProfiler::collect_samples(int64_t since_ns) const {
+    std::vector<std::shared_ptr<DriverSampleRing>> rings;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        rings = _rings;
+    }
+
+    std::vector<Sample> samples;
+    for (const auto& ring : rings) {
+        for (const auto& slot : ring->slots) {
+            const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+            if (seq == 0 || (seq & 1) != 0) {
+                continue;
+            }
+            Sample sample;
+            memcpy(&sample, &slot.sample, sizeof(Sample));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seq || sample.timestamp_ns < since_ns) {
+                continue;
+            }
+            samples.emplace_back(sample);
+        }
+    }
+    return samples;
+}
+
+static std::string to_frame(std::string name) {
+    // ';' separates the frames of a folded stack.
+    std::replace(name.begin(), name.end(), ';', '_');
+    return name;
+}
+
+std::map<std::string, int64_t> DriverSamplingProfiler::fold(
+        const std::vector<Sample>& samples, GroupBy group_by,
+        const std::unordered_map<int64_t, std::string>& workgroup_names) {
+    std::map<std::string, int64_t> stacks;
+    for (const auto& sample : samples) {
+        std::string workgroup;
+        if (auto it = workgroup_names.find(sample.workgroup_id); it != workgroup_names.end()) {
+            workgroup = to_frame(it->second);
+        } else if (sample.workgroup_id < 0) {
+            workgroup = "<no_workgroup>";
+        } else {
+            workgroup = std::to_string(sample.workgroup_id);
+        }
+        // Samples taken outside of operators are charged to the scheduling of the execution thread.
+        std::string op = sample.operator_name[0] == '\0'
+                                 ? "<scheduler>"
+                                 : fmt::format("{}_({})", to_frame(sample.operator_name), sample.plan_node_id);
+
+        if (group_by == GroupBy::WORKGROUP) {
+            stacks[fmt::format("{};{}", workgroup, op)]++;
+        } else {
+            std::string query = sample.query_id_hi == 0 && sample.query_id_lo == 0
+                                        ? "<no_query>"
+                                        : print_id(UniqueId(sample.query_id_hi, sample.query_id_lo));
+            stacks[fmt::format("{};{};driver_{};{}", workgroup, query, sample.driver_id, op)]++;
+        }
+    }
+    return stacks;
+}
+
+} // namespace starrocks::pipeline
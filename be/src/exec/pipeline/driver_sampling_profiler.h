@@ -0,0 +1,91 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gutil/macros.h"
+
+namespace starrocks::pipeline {
+
+struct DriverSampleRing;
+
+// DriverSamplingProfiler continuously samples which query, driver and operator the pipeline execution threads
+// are running, which is cheap enough to be left on, unlike RuntimeProfile timers or a process-wide pprof.
+//
+// Every execution thread arms a CLOCK_THREAD_CPUTIME_ID timer, so a thread is only sampled while it consumes CPU.
+// The timer signal is handled on the sampled thread itself, which copies tls_driver_sample_ctx into a lock-free
+// ring buffer owned by that thread. Readers aggregate the rings into folded stacks, one "frame;frame;... count"
+// line per stack, which is the input format of flamegraph.pl.
+class DriverSamplingProfiler {
+public:
+    static constexpr size_t kOperatorNameLength = 48;
+    static constexpr size_t kRingCapacity = 2048;
+
+    struct Sample {
+        int64_t timestamp_ns;
+        int64_t query_id_hi;
+        int64_t query_id_lo;
+        int64_t workgroup_id;
+        int32_t driver_id;
+        int32_t plan_node_id;
+        char operator_name[kOperatorNameLength];
+    };
+
+    enum class GroupBy {
+        // workgroup;query;driver;operator
+        DRIVER,
+        // workgroup;operator
+        WORKGROUP,
+    };
+
+    static DriverSamplingProfiler* instance();
+
+    // Called by each execution thread when it starts and before it exits.
+    void register_thread();
+    void unregister_thread();
+    // Arm, re-arm or disarm the timer of the current thread according to config::pipeline_sampling_profiler_frequency.
+    // It is called by the execution threads between drivers and costs a thread-local compare when nothing changed.
+    void refresh_thread_timer();
+
+    // Return the samples of all the registered threads taken after |since_ns| (MonotonicNanos).
+    std::vector<Sample> collect_samples(int64_t since_ns) const;
+
+    // Aggregate |samples| into folded stacks ordered by stack. Workgroups are named by |workgroup_names|
+    // and fall back to their ids.
+    static std::map<std::string, int64_t> fold(const std::vector<Sample>& samples, GroupBy group_by,
+                                               const std::unordered_map<int64_t, std::string>& workgroup_names);
+
+    // Append a sample of tls_driver_sample_ctx to the ring of the current thread, it is async-signal-safe.
+    static void sample_current_thread();
+
+private:
+    DriverSamplingProfiler() = default;
+    DISALLOW_COPY_AND_MOVE(DriverSamplingProfiler);
+
+    std::once_flag _install_handler_once;
+    bool _handler_installed = false;
+
+    mutable std::mutex _mutex;
+    std::vector<std::shared_ptr<DriverSampleRing>> _rings;
+};
+
+} // namespace starrocks::pipeline
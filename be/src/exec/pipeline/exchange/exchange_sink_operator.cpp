@@ -25,6 +25,7 @@
 #include "common/config.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
+#include "exec/pipeline/exchange/zero_copy_attachments.h"
 #include "exprs/expr.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/descriptors.h"
@@ -35,6 +36,7 @@
 #include "service/brpc.h"
 #include "util/compression/block_compression.h"
 #include "util/compression/compression_utils.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -54,7 +56,8 @@ public:
               _enable_exchange_pass_through(enable_exchange_pass_through),
               _enable_exchange_perf(enable_exchange_perf),
               _pass_through_context(pass_through_chunk_buffer, fragment_instance_id, dest_node_id),
-              _chunks(num_shuffles) {}
+              _chunks(num_shuffles),
+              _chunk_physical_bytes(num_shuffles, 0) {}
 
     // Initialize channel.
     // Returns OK if successful, error indication otherwise.
@@ -69,6 +72,10 @@ public:
     Status send_one_chunk(RuntimeState* state, const Chunk* chunk, int32_t driver_sequence, bool eos,
                           bool* is_real_sent);
 
+    // Same as above, but the chunk owned by this channel is moved to the pass through receiver
+    // instead of being cloned. The chunk is left untouched if the channel doesn't use pass through.
+    Status send_one_chunk(RuntimeState* state, ChunkUniquePtr& chunk, int32_t driver_sequence);
+
     // Channel will sent input request directly without batch it.
     // This function is only used when broadcast, because request can be reused
     // by all the channels.
@@ -102,6 +109,9 @@ public:
 private:
     Status _close_internal(RuntimeState* state, FragmentContext* fragment_ctx);
 
+    // |owned_chunk| is moved to the pass through receiver if it's not null
+    Status _send_one_chunk(RuntimeState* state, const Chunk* chunk, int32_t driver_sequence, bool eos,
+                           bool* is_real_sent, ChunkUniquePtr* owned_chunk);
     bool _check_use_pass_through();
     void _prepare_pass_through();
 
@@ -125,6 +135,9 @@ private:
     // If pipeline level shuffle is disable, the size of _chunks
     // always be 1
     std::vector<std::unique_ptr<Chunk>> _chunks;
+    // The bytes allocated by this thread for each of _chunks if it uses pass through, they are
+    // handed over to the pass through receiver together with the chunk.
+    std::vector<int64_t> _chunk_physical_bytes;
     PTransmitChunkParamsPtr _chunk_request;
     size_t _current_request_bytes = 0;
 
@@ -190,14 +203,29 @@ Status ExchangeSinkOperator::Channel::init(RuntimeState* state) {
 
 Status ExchangeSinkOperator::Channel::add_rows_selective(Chunk* chunk, int32_t driver_sequence, const uint32_t* indexes,
                                                          uint32_t from, uint32_t size, RuntimeState* state) {
+    // Measure the allocated bytes like the cloning pass through does, the buffers may be reallocated
+    // while the rows are appended, so the released bytes are taken off.
+    auto net_consumed_bytes = []() {
+        return CurrentThread::current().get_consumed_bytes() - CurrentThread::current().get_released_bytes();
+    };
+    int64_t before_bytes = net_consumed_bytes();
     if (UNLIKELY(_chunks[driver_sequence] == nullptr)) {
         _chunks[driver_sequence] = chunk->clone_empty_with_slot(size);
     }
 
     if (_chunks[driver_sequence]->num_rows() + size > state->chunk_size()) {
-        RETURN_IF_ERROR(send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
-        // we only clear column data, because we need to reuse column schema
-        _chunks[driver_sequence]->set_num_rows(0);
+        if (_use_pass_through) {
+            _chunk_physical_bytes[driver_sequence] += net_consumed_bytes() - before_bytes;
+        }
+        RETURN_IF_ERROR(send_one_chunk(state, _chunks[driver_sequence], driver_sequence));
+        before_bytes = net_consumed_bytes();
+        if (_chunks[driver_sequence] == nullptr) {
+            // the chunk has been moved to the pass through receiver
+            _chunks[driver_sequence] = chunk->clone_empty_with_slot(state->chunk_size());
+        } else {
+            // we only clear column data, because we need to reuse column schema
+            _chunks[driver_sequence]->set_num_rows(0);
+        }
     }
 
     {
@@ -205,6 +233,9 @@ Status ExchangeSinkOperator::Channel::add_rows_selective(Chunk* chunk, int32_t d
         _chunks[driver_sequence]->append_selective(*chunk, indexes, from, size);
         COUNTER_UPDATE(_parent->_shuffle_chunk_append_counter, 1);
     }
+    if (_use_pass_through) {
+        _chunk_physical_bytes[driver_sequence] += net_consumed_bytes() - before_bytes;
+    }
     return Status::OK();
 }
 
@@ -214,8 +245,23 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
     return send_one_chunk(state, chunk, driver_sequence, eos, &is_real_sent);
 }
 
+Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, ChunkUniquePtr& chunk,
+                                                     int32_t driver_sequence) {
+    if (!_use_pass_through) {
+        return send_one_chunk(state, chunk.get(), driver_sequence, false);
+    }
+    bool is_real_sent = false;
+    return _send_one_chunk(state, chunk.get(), driver_sequence, false, &is_real_sent, &chunk);
+}
+
 Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const Chunk* chunk, int32_t driver_sequence,
                                                      bool eos, bool* is_real_sent) {
+    return _send_one_chunk(state, chunk, driver_sequence, eos, is_real_sent, nullptr);
+}
+
+Status ExchangeSinkOperator::Channel::_send_one_chunk(RuntimeState* state, const Chunk* chunk,
+                                                      int32_t driver_sequence, bool eos, bool* is_real_sent,
+                                                      ChunkUniquePtr* owned_chunk) {
     *is_real_sent = false;
 
     if (_ignore_local_data && !eos) {
@@ -237,9 +283,16 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
         if (_use_pass_through) {
             size_t chunk_size = serde::ProtobufChunkSerde::max_serialized_size(*chunk);
             // -1 means disable pipeline level shuffle
-            TRY_CATCH_BAD_ALLOC(
-                    _pass_through_context.append_chunk(_parent->_sender_id, chunk, chunk_size,
-                                                       _parent->_is_pipeline_level_shuffle ? driver_sequence : -1));
+            const int32_t pass_through_driver_sequence = _parent->_is_pipeline_level_shuffle ? driver_sequence : -1;
+            if (owned_chunk != nullptr) {
+                TRY_CATCH_BAD_ALLOC(_pass_through_context.append_chunk(
+                        _parent->_sender_id, std::move(*owned_chunk), chunk_size,
+                        _chunk_physical_bytes[driver_sequence], pass_through_driver_sequence));
+                _chunk_physical_bytes[driver_sequence] = 0;
+            } else {
+                TRY_CATCH_BAD_ALLOC(_pass_through_context.append_chunk(_parent->_sender_id, chunk, chunk_size,
+                                                                       pass_through_driver_sequence));
+            }
             _current_request_bytes += chunk_size;
             COUNTER_UPDATE(_parent->_bytes_pass_through_counter, chunk_size);
             COUNTER_SET(_parent->_pass_through_buffer_peak_mem_usage, _pass_through_context.total_bytes());
@@ -248,7 +301,8 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
             auto pchunk = _chunk_request->add_chunks();
-            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(
+                    _parent->serialize_chunk(chunk, pchunk, &_is_first_chunk, 1, &_fragment_instance_id)));
             _current_request_bytes += pchunk->data().size();
         }
     }
@@ -306,7 +360,7 @@ Status ExchangeSinkOperator::Channel::_close_internal(RuntimeState* state, Fragm
     if (!fragment_ctx->is_canceled()) {
         for (auto driver_sequence = 0; driver_sequence < _chunks.size(); ++driver_sequence) {
             if (_chunks[driver_sequence] != nullptr) {
-                RETURN_IF_ERROR(res = send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
+                RETURN_IF_ERROR(res = send_one_chunk(state, _chunks[driver_sequence], driver_sequence));
             }
         }
         RETURN_IF_ERROR(res = send_one_chunk(state, nullptr, ExchangeSinkOperator::DEFAULT_DRIVER_SEQUENCE, true));
@@ -426,6 +480,9 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
         _unique_metrics->add_info_string("ShuffleNumPerChannel", std::to_string(_num_shuffles_per_channel));
         _unique_metrics->add_info_string("TotalShuffleNum", std::to_string(_num_shuffles));
         _unique_metrics->add_info_string("PipelineLevelShuffle", _is_pipeline_level_shuffle ? "Yes" : "No");
+        if (config::exchange_skew_detection_sample_interval > 0 && _channels.size() > 1) {
+            _skew_sketch = std::make_unique<HeavyHitterSketch>(std::min(_channels.size(), kMaxSkewSketchCapacity));
+        }
     }
 
     // Randomize the order we open/transmit to channels to avoid thundering herd problems.
@@ -446,6 +503,20 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     _shuffle_chunk_append_counter = ADD_COUNTER(_unique_metrics, "ShuffleChunkAppendCounter", TUnit::UNIT);
     _shuffle_chunk_append_timer = ADD_TIMER(_unique_metrics, "ShuffleChunkAppendTime");
     _compress_timer = ADD_TIMER(_unique_metrics, "CompressTime");
+    _adaptive_compression = config::exchange_enable_adaptive_compression;
+    if (_adaptive_compression) {
+        _unique_metrics->add_info_string("AdaptiveCompression", "Yes");
+        const std::pair<CompressionTypePB, const char*> candidates[] = {{CompressionTypePB::NO_COMPRESSION, "None"},
+                                                                         {CompressionTypePB::LZ4, "Lz4"},
+                                                                         {CompressionTypePB::ZSTD, "Zstd"}};
+        for (const auto& [type, name] : candidates) {
+            auto& cost = _codec_costs.emplace_back();
+            cost.type = type;
+            RETURN_IF_ERROR(get_block_compression_codec(type, &cost.codec));
+            cost.chosen_counter =
+                    ADD_COUNTER(_unique_metrics, fmt::format("AdaptiveCompress{}Chunks", name), TUnit::UNIT);
+        }
+    }
     _pass_through_buffer_peak_mem_usage = _unique_metrics->AddHighWaterMarkCounter(
             "PassThroughBufferPeakMemoryUsage", TUnit::BYTES,
             RuntimeProfile::Counter::create_strategy(TUnit::BYTES, TCounterMergeType::SKIP_FIRST_MERGE));
@@ -583,6 +654,10 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
                 }
             }
 
+            if (_skew_sketch != nullptr) {
+                _observe_skew(num_rows);
+            }
+
             // Compute row indexes for each channel's each shuffle
             _channel_row_idx_start_points.assign(_num_shuffles + 1, 0);
             _shuffler->exchange_shuffle(_shuffle_channel_ids, _hash_values, num_rows);
@@ -662,10 +737,87 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     if (_driver_sequence == 0) {
         _buffer->update_profile(_unique_metrics.get());
     }
+    if (_skew_sketch != nullptr) {
+        _report_skew();
+    }
     Operator::close(state);
 }
 
-Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers) {
+void ExchangeSinkOperator::_observe_skew(size_t num_rows) {
+    const size_t interval = std::max(config::exchange_skew_detection_sample_interval, 1);
+    size_t i = _skew_sample_offset;
+    for (; i < num_rows; i += interval) {
+        _skew_sketch->update(_hash_values[i]);
+    }
+    _skew_sample_offset = i - num_rows;
+}
+
+void ExchangeSinkOperator::_report_skew() {
+    const int64_t num_observed = _skew_sketch->num_observed();
+    if (num_observed == 0) {
+        return;
+    }
+    // A key is hot when it alone exceeds the fair share of one receiver.
+    const auto hot_keys = _skew_sketch->heavy_hitters(1.0 / _channels.size());
+    if (hot_keys.empty()) {
+        return;
+    }
+    std::string description;
+    for (const auto& [hash, count] : hot_keys) {
+        if (!description.empty()) {
+            description.append(", ");
+        }
+        description.append(fmt::format("{:#x}:{:.1f}%", hash, 100.0 * count / num_observed));
+    }
+    _unique_metrics->add_info_string("SkewHotKeys", description);
+}
+
+Status ExchangeSinkOperator::_sample_compression(const std::string& data) {
+    if (_num_serialized_chunks++ % kAdaptiveCompressionSampleInterval != 0) {
+        return Status::OK();
+    }
+    for (auto& cost : _codec_costs) {
+        if (cost.codec == nullptr || cost.codec->exceed_max_input_size(data.size())) {
+            continue;
+        }
+        _sample_compression_scratch.resize(cost.codec->max_compressed_len(data.size()));
+        Slice compressed{_sample_compression_scratch.data(), _sample_compression_scratch.size()};
+        int64_t start = MonotonicNanos();
+        RETURN_IF_ERROR(cost.codec->compress(Slice(data), &compressed));
+        cost.compress_ns += MonotonicNanos() - start;
+        cost.raw_bytes += data.size();
+        cost.compressed_bytes += compressed.size;
+    }
+    return Status::OK();
+}
+
+const BlockCompressionCodec* ExchangeSinkOperator::_choose_compress_codec(const TUniqueId& dest_instance_id,
+                                                                          size_t size) {
+    const int64_t bytes_per_second = _buffer->network_bytes_per_second(dest_instance_id);
+    if (bytes_per_second <= 0) {
+        // no rpc has finished yet
+        return _compress_codec;
+    }
+    CodecCost* best = &_codec_costs[0];
+    double best_ns = static_cast<double>(size) * 1e9 / bytes_per_second;
+    for (auto& cost : _codec_costs) {
+        if (cost.codec == nullptr || cost.raw_bytes == 0 || cost.codec->exceed_max_input_size(size)) {
+            continue;
+        }
+        const double ratio = static_cast<double>(cost.compressed_bytes) / cost.raw_bytes;
+        const double compress_ns_per_byte = static_cast<double>(cost.compress_ns) / cost.raw_bytes;
+        const double ns = size * compress_ns_per_byte + size * ratio * 1e9 / bytes_per_second;
+        if (ns < best_ns) {
+            best = &cost;
+            best_ns = ns;
+        }
+    }
+    COUNTER_UPDATE(best->chosen_counter, 1);
+    return best->codec;
+}
+
+Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers,
+                                             const TUniqueId* dest_instance_id) {
     VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
     auto send_input_bytes = serde::ProtobufChunkSerde::max_serialized_size(*src, nullptr);
     COUNTER_UPDATE(_sender_input_bytes_counter, send_input_bytes * num_receivers);
@@ -694,22 +846,29 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
     const size_t serialized_size = dst->uncompressed_size();
     COUNTER_UPDATE(_serialized_bytes_counter, serialized_size * num_receivers);
 
-    if (_compress_codec != nullptr && _compress_codec->exceed_max_input_size(serialized_size)) {
+    const BlockCompressionCodec* compress_codec = _compress_codec;
+    if (_adaptive_compression && dest_instance_id != nullptr && serialized_size > 0) {
+        SCOPED_TIMER(_compress_timer);
+        RETURN_IF_ERROR(_sample_compression(dst->data()));
+        compress_codec = _choose_compress_codec(*dest_instance_id, serialized_size);
+    }
+
+    if (compress_codec != nullptr && compress_codec->exceed_max_input_size(serialized_size)) {
         return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
-                                                         _compress_codec->max_input_size()));
+                                                         compress_codec->max_input_size()));
     }
 
     // try compress the ChunkPB data
-    if (_compress_codec != nullptr && serialized_size > 0) {
+    if (compress_codec != nullptr && serialized_size > 0) {
         SCOPED_TIMER(_compress_timer);
 
-        if (use_compression_pool(_compress_codec->type())) {
+        if (use_compression_pool(compress_codec->type())) {
             Slice compressed_slice;
             Slice input(dst->data());
-            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
-                                                      &_compression_scratch));
+            RETURN_IF_ERROR(compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
+                                                     &_compression_scratch));
         } else {
-            int max_compressed_size = _compress_codec->max_compressed_len(serialized_size);
+            int max_compressed_size = compress_codec->max_compressed_len(serialized_size);
 
             if (_compression_scratch.size() < max_compressed_size) {
                 _compression_scratch.resize(max_compressed_size);
@@ -718,14 +877,14 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
             Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
 
             Slice input(dst->data());
-            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice));
+            RETURN_IF_ERROR(compress_codec->compress(input, &compressed_slice));
             _compression_scratch.resize(compressed_slice.size);
         }
 
         double compress_ratio = (static_cast<double>(serialized_size)) / _compression_scratch.size();
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
             dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
-            dst->set_compress_type(_compress_type);
+            dst->set_compress_type(compress_codec->type());
         }
         COUNTER_UPDATE(_compressed_bytes_counter, _compression_scratch.size() * num_receivers);
         VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << _compression_scratch.size();
@@ -740,6 +899,15 @@ int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkPara
         auto chunk = chunk_request->mutable_chunks(i);
         chunk->set_data_size(chunk->data().size());
 
+        if (config::exchange_zero_copy_attachment_min_bytes > 0 &&
+            chunk->data().size() >= config::exchange_zero_copy_attachment_min_bytes) {
+            // The string buffer was allocated on this thread and is now freed wherever the IOBuf is released,
+            // so it is accounted as attachment bytes just like the IOBuf blocks of the copying path.
+            attachment_physical_bytes += ZeroCopyAttachments::instance()->attach(chunk->mutable_data(), &attachment);
+            chunk->clear_data();
+            continue;
+        }
+
         int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
         attachment.append(chunk->data());
         attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
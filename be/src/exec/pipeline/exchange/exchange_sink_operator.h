@@ -22,6 +22,7 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/data_sink.h"
+#include "exec/pipeline/exchange/heavy_hitter_sketch.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exec/pipeline/fragment_context.h"
@@ -79,12 +80,22 @@ public:
 
     // For the first chunk , serialize the chunk data and meta to ChunkPB both.
     // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
+    // If |dest_instance_id| is given and adaptive compression is enabled, the codec is chosen for that destination.
+    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1,
+                           const TUniqueId* dest_instance_id = nullptr);
 
     // Return the physical bytes of attachment.
     int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment);
 
 private:
+    // compress the sampled chunks with every candidate codec to refresh their ratio and speed
+    Status _sample_compression(const std::string& data);
+    // the codec with the lowest estimated compress plus network time to the destination
+    const BlockCompressionCodec* _choose_compress_codec(const TUniqueId& dest_instance_id, size_t size);
+
+    void _observe_skew(size_t num_rows);
+    void _report_skew();
+
     bool _is_large_chunk(size_t sz) const {
         // ref olap_scan_node.cpp release_large_columns
         return sz > runtime_state()->chunk_size() * 512;
@@ -172,6 +183,23 @@ private:
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
     const BlockCompressionCodec* _compress_codec = nullptr;
 
+    // Adaptive compression picks none, LZ4 or ZSTD per destination by the measured compression cost
+    // and the network throughput to the destination.
+    struct CodecCost {
+        CompressionTypePB type = CompressionTypePB::NO_COMPRESSION;
+        const BlockCompressionCodec* codec = nullptr;
+        int64_t raw_bytes = 0;
+        int64_t compressed_bytes = 0;
+        int64_t compress_ns = 0;
+        RuntimeProfile::Counter* chosen_counter = nullptr;
+    };
+    static constexpr size_t kAdaptiveCompressionSampleInterval = 32;
+    bool _adaptive_compression = false;
+    // _codec_costs[0] is NO_COMPRESSION
+    std::vector<CodecCost> _codec_costs;
+    size_t _num_serialized_chunks = 0;
+    raw::RawString _sample_compression_scratch;
+
     RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_hash_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_chunk_append_counter = nullptr;
@@ -209,6 +237,11 @@ private:
 
     std::unique_ptr<Shuffler> _shuffler;
 
+    // Detect the hot partition keys that overload a single receiver, see exchange_skew_detection_sample_interval.
+    static constexpr size_t kMaxSkewSketchCapacity = 64;
+    std::unique_ptr<HeavyHitterSketch> _skew_sketch;
+    size_t _skew_sample_offset = 0;
+
     std::shared_ptr<serde::EncodeContext> _encode_context = nullptr;
 };
 
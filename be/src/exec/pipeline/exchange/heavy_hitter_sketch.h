@@ -0,0 +1,75 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+// Misra-Gries summary over the partition hash values of a shuffle.
+// With `capacity` counters, the count of every value is under-estimated by at most
+// num_observed / (capacity + 1), so any value whose share exceeds 1 / (capacity + 1) is kept.
+class HeavyHitterSketch {
+public:
+    explicit HeavyHitterSketch(size_t capacity) : _capacity(std::max<size_t>(capacity, 1)) {
+        _counters.reserve(_capacity);
+    }
+
+    void update(uint32_t hash) {
+        _num_observed++;
+        for (auto& [value, count] : _counters) {
+            if (value == hash) {
+                count++;
+                return;
+            }
+        }
+        if (_counters.size() < _capacity) {
+            _counters.emplace_back(hash, 1);
+            return;
+        }
+        for (auto& counter : _counters) {
+            counter.second--;
+        }
+        _counters.erase(std::remove_if(_counters.begin(), _counters.end(),
+                                       [](const auto& counter) { return counter.second == 0; }),
+                        _counters.end());
+    }
+
+    // The values whose estimated share of all observed values is at least `min_ratio`,
+    // ordered by the estimated count descending.
+    std::vector<std::pair<uint32_t, int64_t>> heavy_hitters(double min_ratio) const {
+        std::vector<std::pair<uint32_t, int64_t>> result;
+        for (const auto& counter : _counters) {
+            if (counter.second >= min_ratio * _num_observed) {
+                result.emplace_back(counter);
+            }
+        }
+        std::sort(result.begin(), result.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+        return result;
+    }
+
+    int64_t num_observed() const { return _num_observed; }
+
+private:
+    const size_t _capacity;
+    std::vector<std::pair<uint32_t, int64_t>> _counters;
+    int64_t _num_observed = 0;
+};
+
+} // namespace starrocks::pipeline
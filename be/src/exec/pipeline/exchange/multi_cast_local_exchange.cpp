@@ -14,6 +14,9 @@
 
 #include "exec/pipeline/exchange/multi_cast_local_exchange.h"
 
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
+#include "serde/column_array_serde.h"
 #include "util/logging.h"
 
 namespace starrocks::pipeline {
@@ -39,6 +42,16 @@ MultiCastLocalExchanger::MultiCastLocalExchanger(RuntimeState* runtime_state, si
             "PeakMemoryUsage", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
     _peak_buffer_row_size_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakBufferRowSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
+
+    auto* query_ctx = runtime_state->query_ctx();
+    if (runtime_state->enable_spill() && config::multi_cast_local_exchange_spill_bytes > 0 && query_ctx != nullptr &&
+        query_ctx->spill_manager() != nullptr) {
+        _block_manager = query_ctx->spill_manager()->block_manager();
+        _spill_threshold = config::multi_cast_local_exchange_spill_bytes;
+    }
+    _spilled_bytes_counter = ADD_COUNTER(_runtime_profile, "SpilledBytes", TUnit::BYTES);
+    _spilled_chunks_counter = ADD_COUNTER(_runtime_profile, "SpilledChunks", TUnit::UNIT);
+    _restored_chunks_counter = ADD_COUNTER(_runtime_profile, "RestoredChunks", TUnit::UNIT);
 }
 
 MultiCastLocalExchanger::~MultiCastLocalExchanger() {
@@ -69,6 +82,7 @@ Status MultiCastLocalExchanger::push_chunk(const ChunkPtr& chunk, int32_t sink_d
     cell->chunk = chunk;
     cell->memory_usage = chunk->memory_usage();
 
+    bool need_spill = false;
     {
         std::unique_lock l(_mutex);
 
@@ -86,11 +100,121 @@ Status MultiCastLocalExchanger::push_chunk(const ChunkPtr& chunk, int32_t sink_d
         _peak_memory_usage_counter->set(_current_memory_usage);
         _peak_buffer_row_size_counter->set(_current_row_size);
         sink_operator->update_counter(_current_memory_usage, _current_row_size);
+        need_spill = _block_manager != nullptr && _current_memory_usage > _spill_threshold;
     }
 
+    if (need_spill) {
+        RETURN_IF_ERROR(_spill(sink_operator));
+    }
     return Status::OK();
 }
 
+Status MultiCastLocalExchanger::_spill(MultiCastLocalExchangeSinkOperator* sink_operator) {
+    // Pick the oldest chunks under the lock, and write them without it, so that the consumers are not blocked.
+    // The fastest consumers have usually read them, so only the lagging consumers will read them back.
+    std::vector<Cell*> victims;
+    {
+        std::unique_lock l(_mutex);
+        const size_t target = _spill_threshold / 2;
+        size_t remaining = _current_memory_usage;
+        for (Cell* cell = _head; cell != nullptr && remaining > target; cell = cell->next) {
+            if (cell->chunk == nullptr || cell->spilling || cell->used_count == _consumer_number) {
+                continue;
+            }
+            cell->spilling = true;
+            victims.emplace_back(cell);
+            remaining -= std::min(remaining, cell->memory_usage);
+        }
+    }
+
+    Status status;
+    std::vector<spill::BlockPtr> blocks(victims.size());
+    std::vector<uint8_t> buffer;
+    for (size_t i = 0; i < victims.size() && status.ok(); i++) {
+        // The chunk of a cell being spilled is neither released nor modified.
+        const auto& chunk = victims[i]->chunk;
+        size_t max_size = 0;
+        for (const auto& column : chunk->columns()) {
+            max_size += serde::ColumnArraySerde::max_serialized_size(*column);
+        }
+        buffer.resize(max_size);
+        uint8_t* end = buffer.data();
+        for (const auto& column : chunk->columns()) {
+            end = serde::ColumnArraySerde::serialize(*column, end);
+            if (end == nullptr) {
+                status = Status::InternalError("serialize chunk of multicast local exchanger failed");
+                break;
+            }
+        }
+        if (!status.ok()) {
+            break;
+        }
+        const size_t size = end - buffer.data();
+
+        spill::AcquireBlockOptions opts;
+        opts.query_id = _runtime_state->query_id();
+        opts.fragment_instance_id = _runtime_state->fragment_instance_id();
+        opts.plan_node_id = sink_operator->plan_node_id();
+        opts.name = "multi_cast_local_exchange";
+        opts.block_size = size;
+        auto block = _block_manager->acquire_block(opts);
+        status = block.status();
+        if (status.ok()) {
+            status = block.value()->append({Slice(buffer.data(), size)});
+        }
+        if (status.ok()) {
+            status = block.value()->flush();
+        }
+        if (status.ok()) {
+            status = _block_manager->release_block(block.value());
+        }
+        if (status.ok()) {
+            blocks[i] = std::move(block.value());
+        }
+    }
+
+    size_t spilled_bytes = 0;
+    {
+        std::unique_lock l(_mutex);
+        for (size_t i = 0; i < victims.size(); i++) {
+            Cell* cell = victims[i];
+            cell->spilling = false;
+            // The chunk is not needed anymore if all the consumers have read it during the spill.
+            if (blocks[i] == nullptr || cell->used_count == _consumer_number) {
+                continue;
+            }
+            spilled_bytes += blocks[i]->size();
+            cell->spilled_layout = cell->chunk->clone_empty(0);
+            cell->block = std::move(blocks[i]);
+            cell->chunk.reset();
+            _current_memory_usage -= cell->memory_usage;
+            cell->memory_usage = 0;
+            COUNTER_UPDATE(_spilled_chunks_counter, 1);
+        }
+        COUNTER_UPDATE(_spilled_bytes_counter, spilled_bytes);
+        _update_progress();
+    }
+    sink_operator->update_spill_counter(spilled_bytes);
+    return status;
+}
+
+StatusOr<ChunkPtr> MultiCastLocalExchanger::_restore(const spill::BlockPtr& block, const ChunkPtr& layout) {
+    std::vector<uint8_t> buffer(block->size());
+    auto reader = block->get_reader();
+    RETURN_IF_ERROR(reader->read_fully(buffer.data(), buffer.size()));
+
+    ChunkPtr chunk = layout->clone_empty(0);
+    const uint8_t* pos = buffer.data();
+    for (auto& column : chunk->columns()) {
+        pos = serde::ColumnArraySerde::deserialize(pos, column.get());
+        if (pos == nullptr) {
+            return Status::InternalError("deserialize chunk of multicast local exchanger failed");
+        }
+    }
+    COUNTER_UPDATE(_restored_chunks_counter, 1);
+    return chunk;
+}
+
 bool MultiCastLocalExchanger::can_pull_chunk(int32_t mcast_consumer_index) const {
     DCHECK(mcast_consumer_index < _consumer_number);
 
@@ -115,14 +239,23 @@ StatusOr<ChunkPtr> MultiCastLocalExchanger::pull_chunk(RuntimeState* state, int3
         return Status::InternalError("unreachable in multicast local exchanger");
     }
     cell = cell->next;
-    VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
-              << ", row = " << cell->chunk->debug_row(0) << ", size = " << cell->chunk->num_rows();
 
     _progress[mcast_consumer_index] = cell;
     cell->used_count += 1;
+    ChunkPtr chunk = cell->chunk;
+    spill::BlockPtr block = cell->block;
+    ChunkPtr layout = cell->spilled_layout;
 
     _update_progress(cell);
-    return cell->chunk;
+    l.unlock();
+
+    if (chunk == nullptr) {
+        // The cell may have been released, but the block is kept alive by |block|.
+        ASSIGN_OR_RETURN(chunk, _restore(block, layout));
+    }
+    VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
+              << ", row = " << chunk->debug_row(0) << ", size = " << chunk->num_rows();
+    return chunk;
 }
 
 void MultiCastLocalExchanger::open_source_operator(int32_t mcast_consumer_index) {
@@ -174,7 +307,7 @@ void MultiCastLocalExchanger::_update_progress(Cell* fast) {
         }
     }
     // release chunk if no one needs it.
-    while (_head && _head->used_count == _consumer_number) {
+    while (_head && _head->used_count == _consumer_number && !_head->spilling) {
         Cell* t = _head->next;
         if (t == nullptr) break;
         _current_memory_usage -= _head->memory_usage;
@@ -224,6 +357,7 @@ Status MultiCastLocalExchangeSinkOperator::prepare(RuntimeState* state) {
             "ExchangerPeakMemoryUsage", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
     _peak_buffer_row_size_counter = _unique_metrics->AddHighWaterMarkCounter(
             "ExchangerPeakBufferRowSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
+    _spilled_bytes_counter = ADD_COUNTER(_unique_metrics, "ExchangerSpilledBytes", TUnit::BYTES);
     return Status::OK();
 }
 
@@ -252,4 +386,8 @@ void MultiCastLocalExchangeSinkOperator::update_counter(size_t memory_usage, siz
     _peak_buffer_row_size_counter->set(buffer_row_size);
 }
 
+void MultiCastLocalExchangeSinkOperator::update_spill_counter(size_t spilled_bytes) {
+    COUNTER_UPDATE(_spilled_bytes_counter, spilled_bytes);
+}
+
 } // namespace starrocks::pipeline
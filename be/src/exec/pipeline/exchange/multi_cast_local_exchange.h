@@ -16,6 +16,7 @@
 
 #include "column/chunk.h"
 #include "exec/pipeline/source_operator.h"
+#include "exec/spill/block_manager.h"
 
 namespace starrocks::pipeline {
 
@@ -39,6 +40,11 @@ namespace starrocks::pipeline {
 // 1. can accept chunk or not. we don't want to block any consumer. we can accept chunk only when a any consumer needs chunk.
 // 2. can throw chunk or not. we can only throw any chunk when all consumers have consumed that chunk.
 // 3. can pull chiunk. we maintain the progress of consumers.
+//
+// The sink is only throttled by the fastest consumer, so the chunks a slow consumer has not read pile up in the
+// exchanger. When spill is enabled and they take more than config::multi_cast_local_exchange_spill_bytes, the
+// oldest chunks still needed by some consumer are spilled once, and every lagging consumer reads them back from
+// the spilled blocks when it reaches them.
 
 class MultiCastLocalExchangeSinkOperator;
 // ===== exchanger =====
@@ -59,15 +65,24 @@ public:
 
 private:
     struct Cell {
+        // nullptr if the chunk has been spilled into |block|.
         ChunkPtr chunk = nullptr;
         Cell* next = nullptr;
         size_t memory_usage = 0;
         size_t accumulated_row_size = 0;
         // how many consumers have used this chunk
         int32_t used_count = 0;
+        // the spilled chunk and an empty chunk of the same layout to restore it.
+        spill::BlockPtr block;
+        ChunkPtr spilled_layout;
+        // the chunk is being spilled without the lock, so the cell can't be released.
+        bool spilling = false;
     };
     void _update_progress(Cell* fast = nullptr);
     void _closer_consumer(int32_t mcast_consumer_index);
+    // spill the oldest chunks until the memory usage drops to half of the spill threshold.
+    Status _spill(MultiCastLocalExchangeSinkOperator* sink_operator);
+    StatusOr<ChunkPtr> _restore(const spill::BlockPtr& block, const ChunkPtr& layout);
     RuntimeState* _runtime_state;
     mutable std::mutex _mutex;
     size_t _consumer_number;
@@ -85,6 +100,12 @@ private:
     std::unique_ptr<RuntimeProfile> _runtime_profile;
     RuntimeProfile::HighWaterMarkCounter* _peak_memory_usage_counter = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _peak_buffer_row_size_counter = nullptr;
+    // nullptr if spill is disabled.
+    spill::BlockManager* _block_manager = nullptr;
+    size_t _spill_threshold = 0;
+    RuntimeProfile::Counter* _spilled_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _spilled_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _restored_chunks_counter = nullptr;
 };
 
 // ===== source op =====
@@ -158,12 +179,14 @@ public:
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
 
     void update_counter(size_t memory_usage, size_t buffer_row_size);
+    void update_spill_counter(size_t spilled_bytes);
 
 private:
     bool _is_finished = false;
     const std::shared_ptr<MultiCastLocalExchanger> _exchanger;
     RuntimeProfile::HighWaterMarkCounter* _peak_memory_usage_counter = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _peak_buffer_row_size_counter = nullptr;
+    RuntimeProfile::Counter* _spilled_bytes_counter = nullptr;
 };
 
 class MultiCastLocalExchangeSinkOperatorFactory final : public OperatorFactory {
@@ -52,7 +52,7 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _num_finished_rpcs[instance_id.lo] = 0;
             _num_in_flight_rpcs[instance_id.lo] = 0;
             _network_times[instance_id.lo] = TimeTrace{};
-            _mutexes[instance_id.lo] = std::make_unique<Mutex>();
+            _mutexes[instance_id.lo] = std::make_unique<Mutex>(LOCK_SITE("SinkBuffer"));
             _dest_addrs[instance_id.lo] = dest.brpc_server;
 
             PUniqueId finst_id;
@@ -61,6 +61,15 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _instance_id2finst_id[instance_id.lo] = std::move(finst_id);
         }
     }
+
+    for (const auto& [lo, addr] : _dest_addrs) {
+        auto& peers = _host_peers[lo];
+        for (const auto& [peer_lo, peer_addr] : _dest_addrs) {
+            if (peer_lo != lo && peer_addr == addr) {
+                peers.emplace_back(peer_lo);
+            }
+        }
+    }
 }
 
 SinkBuffer::~SinkBuffer() {
@@ -196,10 +205,7 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
 int64_t SinkBuffer::_network_time() {
     int64_t max = 0;
     for (auto& [_, time_trace] : _network_times) {
-        double average_concurrency =
-                static_cast<double>(time_trace.accumulated_concurrency) / std::max(1, time_trace.times);
-        int64_t average_accumulated_time =
-                static_cast<int64_t>(time_trace.accumulated_time / std::max(1.0, average_concurrency));
+        int64_t average_accumulated_time = time_trace.network_time();
         if (average_accumulated_time > max) {
             max = average_accumulated_time;
         }
@@ -246,13 +252,27 @@ void SinkBuffer::cancel_one_sinker(RuntimeState* const state) {
     }
 }
 
+int64_t SinkBuffer::network_bytes_per_second(const TUniqueId& instance_id) {
+    auto it = _mutexes.find(instance_id.lo);
+    if (it == _mutexes.end()) {
+        return -1;
+    }
+    std::lock_guard<Mutex> l(*it->second);
+    const auto& time_trace = _network_times.at(instance_id.lo);
+    const int64_t network_time = time_trace.network_time();
+    if (time_trace.times == 0 || network_time <= 0) {
+        return -1;
+    }
+    return static_cast<int64_t>(static_cast<double>(time_trace.accumulated_bytes) * 1e9 / network_time);
+}
+
 void SinkBuffer::_update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                                      const int64_t receiver_post_process_time) {
+                                      const int64_t receiver_post_process_time, const int64_t attachment_bytes) {
     const int64_t get_response_timestamp = MonotonicNanos();
     _last_receive_time = get_response_timestamp;
     int32_t concurrency = _num_in_flight_rpcs[instance_id.lo];
     int64_t time_usage = get_response_timestamp - send_timestamp - receiver_post_process_time;
-    _network_times[instance_id.lo].update(time_usage, concurrency);
+    _network_times[instance_id.lo].update(time_usage, concurrency, attachment_bytes);
     _rpc_cumulative_time += time_usage;
     _rpc_count++;
 }
@@ -273,6 +293,64 @@ void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_
     }
 }
 
+bool SinkBuffer::_is_busy(int64_t instance_lo) {
+    if (_is_dest_merge) {
+        // discontinuous_acked_window_size means that we are not received all the ack
+        // with sequence from _max_continuous_acked_seqs[x] to _request_seqs[x]
+        // Limit the size of the window to avoid buffering too much out-of-order data at the receiving side
+        int64_t discontinuous_acked_window_size = _request_seqs[instance_lo] - _max_continuous_acked_seqs[instance_lo];
+        return discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop;
+    }
+    return _num_in_flight_rpcs[instance_lo] >= config::pipeline_sink_brpc_dop;
+}
+
+void SinkBuffer::_coalesce_requests(const TUniqueId& instance_id, TransmitChunkInfo& request,
+                                    std::vector<CoalescedRequestContext>* coalesced_requests) {
+    const int64_t max_bytes = config::pipeline_sink_coalesce_rpc_max_bytes;
+    int64_t total_bytes = request.attachment.size();
+    for (int64_t peer : _host_peers[instance_id.lo]) {
+        if (total_bytes >= max_bytes) {
+            break;
+        }
+        std::unique_lock<Mutex> l(*_mutexes[peer], std::try_to_lock);
+        if (!l.owns_lock()) {
+            continue;
+        }
+        auto& buffer = _buffers[peer];
+        if (buffer.empty() || _is_busy(peer)) {
+            continue;
+        }
+        // the first packet must be received first
+        if (_num_finished_rpcs[peer] == 0 && _num_in_flight_rpcs[peer] > 0) {
+            continue;
+        }
+        TransmitChunkInfo& peer_request = buffer.front();
+        // eos is left to the instance itself, which must send it as the last packet exactly-once
+        if (peer_request.params->eos() || total_bytes + peer_request.attachment.size() > max_bytes) {
+            continue;
+        }
+
+        *peer_request.params->mutable_finst_id() = _instance_id2finst_id[peer];
+        peer_request.params->set_sequence(++_request_seqs[peer]);
+        if (!peer_request.attachment.empty()) {
+            _bytes_sent += peer_request.attachment.size();
+            _request_sent++;
+        }
+        ++_num_in_flight_rpcs[peer];
+        _mem_tracker->release(peer_request.attachment_physical_bytes);
+        GlobalEnv::GetInstance()->process_mem_tracker()->consume(peer_request.attachment_physical_bytes);
+
+        total_bytes += peer_request.attachment.size();
+        coalesced_requests->push_back({peer_request.fragment_instance_id, peer_request.params->sequence(),
+                                       static_cast<int64_t>(peer_request.attachment.size())});
+        request.params->add_coalesced_requests()->Swap(peer_request.params.get());
+        request.attachment.append(peer_request.attachment);
+
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+        buffer.pop();
+    }
+}
+
 Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works) {
     std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
     pre_works();
@@ -287,18 +365,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
 
         auto& buffer = _buffers[instance_id.lo];
 
-        bool too_much_brpc_process = false;
-        if (_is_dest_merge) {
-            // discontinuous_acked_window_size means that we are not received all the ack
-            // with sequence from _max_continuous_acked_seqs[x] to _request_seqs[x]
-            // Limit the size of the window to avoid buffering too much out-of-order data at the receiving side
-            int64_t discontinuous_acked_window_size =
-                    _request_seqs[instance_id.lo] - _max_continuous_acked_seqs[instance_id.lo];
-            too_much_brpc_process = discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop;
-        } else {
-            too_much_brpc_process = _num_in_flight_rpcs[instance_id.lo] >= config::pipeline_sink_brpc_dop;
-        }
-        if (buffer.empty() || too_much_brpc_process) {
+        if (buffer.empty() || _is_busy(instance_id.lo)) {
             return Status::OK();
         }
 
@@ -365,8 +432,15 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             _request_sent++;
         }
 
+        const auto attachment_bytes = static_cast<int64_t>(request.attachment.size());
+        std::vector<CoalescedRequestContext> coalesced_requests;
+        if (config::pipeline_sink_enable_rpc_coalescing && !request.params->eos()) {
+            _coalesce_requests(instance_id, request, &coalesced_requests);
+        }
+
         auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
-                {instance_id, request.params->sequence(), MonotonicNanos()});
+                {instance_id, request.params->sequence(), MonotonicNanos(), attachment_bytes,
+                 std::move(coalesced_requests)});
         if (_first_send_time == -1) {
             _first_send_time = MonotonicNanos();
         }
@@ -379,6 +453,11 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
             }
+            for (const auto& coalesced : ctx.coalesced_requests) {
+                std::lock_guard<Mutex> l(*_mutexes[coalesced.instance_id.lo]);
+                ++_num_finished_rpcs[coalesced.instance_id.lo];
+                --_num_in_flight_rpcs[coalesced.instance_id.lo];
+            }
 
             const auto& dest_addr = _dest_addrs[ctx.instance_id.lo];
             std::string err_msg =
@@ -397,6 +476,11 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
             }
+            for (const auto& coalesced : ctx.coalesced_requests) {
+                std::lock_guard<Mutex> l(*_mutexes[coalesced.instance_id.lo]);
+                ++_num_finished_rpcs[coalesced.instance_id.lo];
+                --_num_in_flight_rpcs[coalesced.instance_id.lo];
+            }
             if (!status.ok()) {
                 _is_finishing = true;
                 _fragment_ctx->cancel(status);
@@ -407,9 +491,17 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                                             status.message());
             } else {
                 static_cast<void>(_try_to_send_rpc(ctx.instance_id, [&]() {
-                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time());
+                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time(),
+                                         ctx.attachment_bytes);
                     _process_send_window(ctx.instance_id, ctx.sequence);
                 }));
+                for (const auto& coalesced : ctx.coalesced_requests) {
+                    static_cast<void>(_try_to_send_rpc(coalesced.instance_id, [&]() {
+                        _update_network_time(coalesced.instance_id, ctx.send_timestamp,
+                                             result.receiver_post_process_time(), coalesced.attachment_bytes);
+                        _process_send_window(coalesced.instance_id, coalesced.sequence);
+                    }));
+                }
             }
         });
 
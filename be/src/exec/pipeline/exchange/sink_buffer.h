@@ -33,15 +33,25 @@
 #include "util/brpc_stub_cache.h"
 #include "util/defer_op.h"
 #include "util/disposable_closure.h"
+#include "util/instrumented_mutex.h"
 #include "util/phmap/phmap.h"
 
 namespace starrocks::pipeline {
 
 using PTransmitChunkParamsPtr = std::shared_ptr<PTransmitChunkParams>;
+// A request of another fragment instance on the same host, which is packed into the rpc, see coalesced_requests.
+struct CoalescedRequestContext {
+    TUniqueId instance_id;
+    int64_t sequence;
+    int64_t attachment_bytes;
+};
+
 struct ClosureContext {
     TUniqueId instance_id;
     int64_t sequence;
     int64_t send_timestamp;
+    int64_t attachment_bytes;
+    std::vector<CoalescedRequestContext> coalesced_requests;
 };
 
 struct TransmitChunkInfo {
@@ -68,11 +78,19 @@ struct TimeTrace {
     int32_t times = 0;
     int64_t accumulated_time = 0;
     int32_t accumulated_concurrency = 0;
+    int64_t accumulated_bytes = 0;
 
-    void update(int64_t time, int32_t concurrency) {
+    void update(int64_t time, int32_t concurrency, int64_t bytes) {
         times++;
         accumulated_time += time;
         accumulated_concurrency += concurrency;
+        accumulated_bytes += bytes;
+    }
+
+    // `accumulated_time / average_concurrency`
+    int64_t network_time() const {
+        double average_concurrency = static_cast<double>(accumulated_concurrency) / std::max(1, times);
+        return static_cast<int64_t>(accumulated_time / std::max(1.0, average_concurrency));
     }
 };
 
@@ -98,17 +116,29 @@ public:
 
     void incr_sinker(RuntimeState* state);
 
+    // Estimated network throughput to the destination in bytes per second, measured from the attachment bytes
+    // and the network time of the finished rpcs. Return -1 if no rpc to the destination has finished yet.
+    int64_t network_bytes_per_second(const TUniqueId& instance_id);
+
 private:
-    using Mutex = bthread::Mutex;
+    using Mutex = InstrumentedMutex<bthread::Mutex>;
 
     void _update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                              const int64_t receiver_post_process_time);
+                              const int64_t receiver_post_process_time, const int64_t attachment_bytes);
     // Update the discontinuous acked window, here are the invariants:
     // all acks received with sequence from [0, _max_continuous_acked_seqs[x]]
     // not all the acks received with sequence from [_max_continuous_acked_seqs[x]+1, _request_seqs[x]]
     // _discontinuous_acked_seqs[x] stored the received discontinuous acks
     void _process_send_window(const TUniqueId& instance_id, const int64_t sequence);
 
+    // Whether the number of in-flight rpcs of the instance reaches the limit of flow control
+    bool _is_busy(int64_t instance_lo);
+
+    // Pack the pending requests of the other instances on the same host into |request| to share one rpc.
+    // The other instances are only try-locked, and their own flow control is still respected.
+    void _coalesce_requests(const TUniqueId& instance_id, TransmitChunkInfo& request,
+                            std::vector<CoalescedRequestContext>* coalesced_requests);
+
     // Try to send rpc if buffer is not empty and channel is not busy
     // And we need to put this function and other extra works(pre_works) together as an atomic operation
     [[nodiscard]] Status _try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works);
@@ -157,6 +187,8 @@ private:
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
     phmap::flat_hash_map<int64_t, TNetworkAddress> _dest_addrs;
+    // The other instances on the same host of each instance
+    phmap::flat_hash_map<int64_t, std::vector<int64_t>> _host_peers;
 
     // True means that SinkBuffer needn't input chunk and send chunk anymore,
     // but there may be still in-flight RPC running.
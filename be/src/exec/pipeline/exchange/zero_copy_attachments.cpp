@@ -0,0 +1,64 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/zero_copy_attachments.h"
+
+#include "common/logging.h"
+#include "runtime/current_thread.h"
+
+namespace starrocks::pipeline {
+
+int64_t ZeroCopyAttachments::attach(std::string* data, butil::IOBuf* attachment) {
+    auto owned = std::make_unique<std::string>(std::move(*data));
+    void* ptr = owned->data();
+    const size_t size = owned->size();
+    const auto capacity = static_cast<int64_t>(owned->capacity());
+    {
+        auto& shard = _shard(ptr);
+        std::lock_guard l(shard.mutex);
+        shard.owned.emplace(ptr, std::move(owned));
+    }
+    if (attachment->append_user_data(ptr, size, &ZeroCopyAttachments::_release) != 0) {
+        // fallback to copy, _release frees the string
+        int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+        attachment->append(ptr, size);
+        int64_t copied_bytes = CurrentThread::current().get_consumed_bytes() - before_bytes;
+        _release(ptr);
+        return copied_bytes;
+    }
+    return capacity;
+}
+
+size_t ZeroCopyAttachments::num_attachments() {
+    size_t num = 0;
+    for (auto& shard : _shards) {
+        std::lock_guard l(shard.mutex);
+        num += shard.owned.size();
+    }
+    return num;
+}
+
+void ZeroCopyAttachments::_release(void* ptr) {
+    std::unique_ptr<std::string> owned;
+    auto& shard = instance()->_shard(ptr);
+    std::lock_guard l(shard.mutex);
+    auto it = shard.owned.find(ptr);
+    DCHECK(it != shard.owned.end());
+    if (it != shard.owned.end()) {
+        owned = std::move(it->second);
+        shard.owned.erase(it);
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,65 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <butil/iobuf.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace starrocks::pipeline {
+
+// Owns the serialized chunk data that is attached to a brpc IOBuf without copying.
+// butil::IOBuf only passes the data pointer to the deleter, so the owning string is looked up by it. The strings
+// are spread over shards by their addresses, so that the senders and the brpc threads releasing the blocks rarely
+// contend on the same lock.
+// An owned string lives exactly as long as the last IOBuf referencing its block: it is released when the request
+// is sent and its closure is destroyed, whether the rpc succeeds or fails, and when a queued request is dropped
+// because the query is cancelled.
+class ZeroCopyAttachments {
+public:
+    static ZeroCopyAttachments* instance() {
+        static ZeroCopyAttachments attachments;
+        return &attachments;
+    }
+
+    // move |data| to the heap and attach it to |attachment| as a user-owned block,
+    // return the heap bytes handed over to the attachment.
+    int64_t attach(std::string* data, butil::IOBuf* attachment);
+
+    // the number of strings owned for the IOBufs alive.
+    size_t num_attachments();
+
+private:
+    static constexpr int kNumShardBits = 6;
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<const void*, std::unique_ptr<std::string>> owned;
+    };
+
+    Shard& _shard(const void* ptr) {
+        // Large buffers are page aligned, so the shard is taken from the high bits of a multiplicative hash.
+        return _shards[(reinterpret_cast<uintptr_t>(ptr) * 0x9E3779B97F4A7C15ULL) >> (64 - kNumShardBits)];
+    }
+
+    static void _release(void* ptr);
+
+    Shard _shards[1 << kNumShardBits];
+};
+
+} // namespace starrocks::pipeline
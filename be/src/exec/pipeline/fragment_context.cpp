@@ -23,6 +23,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/stream_load/stream_load_context.h"
 #include "runtime/stream_load/transaction_mgr.h"
+#include "util/thrift_util.h"
 #include "util/time.h"
 
 namespace starrocks::pipeline {
@@ -56,6 +57,19 @@ void FragmentContext::close_all_execution_groups() {
 void FragmentContext::move_tplan(TPlan& tplan) {
     swap(_tplan, tplan);
 }
+
+uint64_t FragmentContext::plan_fingerprint() {
+    std::call_once(_plan_fingerprint_once, [this]() {
+        ThriftSerializer serializer(true, 4096);
+        uint32_t len = 0;
+        uint8_t* buffer = nullptr;
+        if (serializer.serialize(&_tplan, &len, &buffer).ok()) {
+            _plan_fingerprint = HashUtil::xx_hash3_64(buffer, len, 0);
+        }
+    });
+    return _plan_fingerprint;
+}
+
 void FragmentContext::set_data_sink(std::unique_ptr<DataSink> data_sink) {
     _data_sink = std::move(data_sink);
 }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <unordered_map>
 
 #include "exec/exec_node.h"
@@ -69,6 +70,9 @@ public:
 
     void move_tplan(TPlan& tplan);
     const TPlan& tplan() const { return _tplan; }
+    // The fingerprint of tplan, which identifies the same plan across the queries. 0 means unknown.
+    // It is computed by the first call, because it serializes the whole plan.
+    uint64_t plan_fingerprint();
     void set_data_sink(std::unique_ptr<DataSink> data_sink);
 
     size_t total_dop() const;
@@ -180,6 +184,8 @@ private:
     // Hold tplan data datasink from delivery request to create driver lazily
     // after delivery request has been finished.
     TPlan _tplan;
+    std::once_flag _plan_fingerprint_once;
+    uint64_t _plan_fingerprint = 0;
     std::unique_ptr<DataSink> _data_sink;
 
     // promise used to determine whether fragment finished its execution
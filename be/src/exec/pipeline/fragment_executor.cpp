@@ -17,6 +17,7 @@
 #include <unordered_map>
 
 #include "common/config.h"
+#include "exec/aggregate/aggregate_streaming_node.h"
 #include "exec/cross_join_node.h"
 #include "exec/exchange_node.h"
 #include "exec/exec_node.h"
@@ -369,6 +370,24 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
         _fragment_ctx->set_enable_cache(true);
     }
 
+    // The streaming pre-aggregations over colocated scans can aggregate bucket by bucket, the scans must output chunks
+    // by bucket before their morsel queue factories are created. The group execution already runs bucket by bucket.
+    bool group_execution =
+            fragment.__isset.group_execution_param && fragment.group_execution_param.enable_group_execution;
+    if (config::enable_streaming_agg_per_bucket && !_fragment_ctx->enable_cache() && !group_execution) {
+        std::vector<ExecNode*> agg_nodes;
+        plan->collect_nodes(TPlanNodeType::AGGREGATION_NODE, &agg_nodes);
+        for (auto* node : agg_nodes) {
+            auto* agg_node = dynamic_cast<AggregateStreamingNode*>(node);
+            auto* scan_node = agg_node != nullptr ? agg_node->bucket_aligned_scan_node() : nullptr;
+            if (scan_node == nullptr || request.per_driver_seq_scan_ranges_of_node(scan_node->id()).empty()) {
+                continue;
+            }
+            scan_node->set_output_chunk_by_bucket(true);
+            agg_node->enable_per_bucket_optimize();
+        }
+    }
+
     for (auto& i : scan_nodes) {
         auto* scan_node = down_cast<ScanNode*>(i);
         const std::vector<TScanRangeParams>& scan_ranges = request.scan_ranges_of_node(scan_node->id());
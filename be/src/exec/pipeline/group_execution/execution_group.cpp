@@ -14,9 +14,11 @@
 
 #include "exec/pipeline/group_execution/execution_group.h"
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/query_context.h"
 
 namespace starrocks::pipeline {
 // clang-format off
@@ -96,6 +98,12 @@ Status ColocateExecutionGroup::prepare_pipelines(RuntimeState* state) {
         _total_logical_dop = pipeline->degree_of_parallelism();
     }
     _submit_drivers = std::make_unique<std::atomic<int>[]>(_pipelines.size());
+    if (auto* query_ctx = state->query_ctx(); query_ctx != nullptr) {
+        _query_mem_tracker = query_ctx->mem_tracker().get();
+        for (int32_t plan_node_id : _plan_node_ids) {
+            _operator_mem_trackers.emplace_back(query_ctx->operator_mem_tracker(plan_node_id));
+        }
+    }
     return Status::OK();
 }
 
@@ -105,12 +113,14 @@ Status ColocateExecutionGroup::prepare_drivers(RuntimeState* state) {
 
 void ColocateExecutionGroup::submit_active_drivers() {
     VLOG_QUERY << "submit_active_drivers:" << to_string();
+    std::lock_guard<std::mutex> l(_submit_mutex);
     for (size_t i = 0; i < _pipelines.size(); ++i) {
         const auto& pipeline = _pipelines[i];
         DCHECK_EQ(pipeline->drivers().size(), pipeline->degree_of_parallelism());
         const auto& drivers = pipeline->drivers();
         size_t init_submit_drivers = std::min(_physical_dop, drivers.size());
         _submit_drivers[i] = init_submit_drivers;
+        _active_buckets = std::max(_active_buckets, init_submit_drivers);
         for (size_t i = 0; i < init_submit_drivers; ++i) {
             VLOG_QUERY << "submit_active_driver:" << i << ":" << drivers[i]->to_readable_string();
             _executor->submit(drivers[i].get());
@@ -139,6 +149,17 @@ std::string ColocateExecutionGroup::to_string() const {
 }
 
 void ColocateExecutionGroup::submit_next_driver() {
+    std::lock_guard<std::mutex> l(_submit_mutex);
+    const size_t target = _target_active_buckets();
+    _active_buckets = _active_buckets > 0 ? _active_buckets - 1 : 0;
+    // At least one bucket is kept running, so that the group always makes progress.
+    while (_active_buckets < std::max<size_t>(target, 1) && _submit_next_bucket()) {
+        _active_buckets++;
+    }
+}
+
+bool ColocateExecutionGroup::_submit_next_bucket() {
+    bool submitted = false;
     for (size_t i = 0; i < _pipelines.size(); ++i) {
         auto next_driver_idx = _submit_drivers[i].fetch_add(1);
         if (next_driver_idx >= _pipelines[i]->degree_of_parallelism()) {
@@ -148,7 +169,33 @@ void ColocateExecutionGroup::submit_next_driver() {
         VLOG_QUERY << "submit_next_drivers:" << next_driver_idx << ":"
                    << drivers[next_driver_idx]->to_readable_string();
         _executor->submit(drivers[next_driver_idx].get());
+        submitted = true;
     }
+    return submitted;
+}
+
+size_t ColocateExecutionGroup::_target_active_buckets() {
+    const double ratio = config::group_execution_bucket_mem_limit_ratio;
+    if (ratio <= 0 || _query_mem_tracker == nullptr || _query_mem_tracker->limit() <= 0 || _active_buckets == 0) {
+        return _physical_dop;
+    }
+    // The buckets which have just finished may not have released their memory yet, so they are still counted.
+    int64_t group_mem_bytes = 0;
+    for (auto* tracker : _operator_mem_trackers) {
+        group_mem_bytes += tracker->consumption();
+    }
+    _peak_bucket_mem_bytes = std::max(_peak_bucket_mem_bytes, group_mem_bytes / static_cast<int64_t>(_active_buckets));
+    if (_peak_bucket_mem_bytes <= 0) {
+        return _physical_dop;
+    }
+
+    const int64_t other_mem_bytes = _query_mem_tracker->consumption() - group_mem_bytes;
+    const int64_t budget =
+            static_cast<int64_t>(_query_mem_tracker->limit() * ratio) - std::max<int64_t>(other_mem_bytes, 0);
+    const auto target = static_cast<size_t>(std::max<int64_t>(budget / _peak_bucket_mem_bytes, 1));
+    VLOG_QUERY << "colocate execution group bucket memory:" << _peak_bucket_mem_bytes << ", budget:" << budget
+               << ", target active buckets:" << target;
+    return std::min(target, _physical_dop);
 }
 
 } // namespace starrocks::pipeline
\ No newline at end of file
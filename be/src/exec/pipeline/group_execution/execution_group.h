@@ -17,6 +17,7 @@
 #include <atomic>
 #include <cstddef>
 #include <functional>
+#include <mutex>
 #include <unordered_set>
 
 #include "exec/pipeline/fragment_context.h"
@@ -25,6 +26,7 @@
 #include "exec/pipeline/pipeline.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
@@ -118,6 +120,9 @@ public:
 // execution group for colocate pipelines
 // all pipelines in this group should have the same dop
 // There should be no dependencies between the operators of multiple dops
+// The logical dop is the number of buckets, and at most physical dop buckets run concurrently. When a bucket
+// finishes, the next buckets are submitted according to the memory the active buckets are observed to use, so that
+// they don't exceed config::group_execution_bucket_mem_limit_ratio of the query memory limit.
 class ColocateExecutionGroup final : public ExecutionGroup {
 public:
     ColocateExecutionGroup(size_t physical_dop)
@@ -136,9 +141,22 @@ public:
     void add_plan_node_id(int32_t plan_node_id) { _plan_node_ids.insert(plan_node_id); }
 
 private:
+    // submit the drivers of the next bucket, return false if all the buckets have been submitted.
+    bool _submit_next_bucket();
+    // the number of buckets allowed to run concurrently.
+    size_t _target_active_buckets();
+
     size_t _physical_dop;
     // TODO: add Pad to fix false sharing problems
     std::unique_ptr<std::atomic<int>[]> _submit_drivers;
+
+    std::mutex _submit_mutex;
+    size_t _active_buckets = 0;
+    // the max memory used by a bucket observed so far.
+    int64_t _peak_bucket_mem_bytes = 0;
+    MemTracker* _query_mem_tracker = nullptr;
+    // the memory of the operators of this group, shared by all the active buckets.
+    std::vector<MemTracker*> _operator_mem_trackers;
 };
 
 } // namespace starrocks::pipeline
\ No newline at end of file
@@ -0,0 +1,58 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/hashjoin/asof_join_build_operator.h"
+
+#include "column/chunk.h"
+#include "util/defer_op.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks::pipeline {
+
+Status AsofJoinBuildOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(Operator::prepare(state));
+    _asof_join_context->incr_builder();
+    return Status::OK();
+}
+
+void AsofJoinBuildOperator::close(RuntimeState* state) {
+    auto input_rows = ADD_COUNTER(_unique_metrics, "InputRows", TUnit::UNIT);
+    COUNTER_SET(input_rows, (int64_t)_num_input_rows);
+    if (_asof_join_context->is_right_finished()) {
+        auto build_rows = ADD_COUNTER(_unique_metrics, "BuildRows", TUnit::UNIT);
+        COUNTER_SET(build_rows, (int64_t)_asof_join_context->num_build_rows());
+        auto build_groups = ADD_COUNTER(_unique_metrics, "BuildGroups", TUnit::UNIT);
+        COUNTER_SET(build_groups, (int64_t)_asof_join_context->num_groups());
+    }
+    _unique_metrics->add_info_string("NumBuilders", std::to_string(_asof_join_context->num_builders()));
+
+    _asof_join_context->unref(state);
+    Operator::close(state);
+}
+
+StatusOr<ChunkPtr> AsofJoinBuildOperator::pull_chunk(RuntimeState* state) {
+    return Status::InternalError("Shouldn't pull chunk from asof join build operator");
+}
+
+Status AsofJoinBuildOperator::set_finishing(RuntimeState* state) {
+    DeferOp op([this]() { _is_finished = true; });
+    return _asof_join_context->finish_one_right_sinker(_driver_sequence, state);
+}
+
+Status AsofJoinBuildOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    _num_input_rows += chunk->num_rows();
+    return _asof_join_context->append_build_chunk(_driver_sequence, chunk);
+}
+
+} // namespace starrocks::pipeline
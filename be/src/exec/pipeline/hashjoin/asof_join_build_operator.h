@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <utility>
+
+#include "column/vectorized_fwd.h"
+#include "exec/pipeline/hashjoin/asof_join_context.h"
+#include "exec/pipeline/operator.h"
+
+namespace starrocks::pipeline {
+
+// AsofJoinBuildOperator
+// Collect the rows of right table into the AsofJoinContext, the last finished one sorts all of them.
+class AsofJoinBuildOperator final : public Operator {
+public:
+    AsofJoinBuildOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                          const std::shared_ptr<AsofJoinContext>& asof_join_context)
+            : Operator(factory, id, "asof_join_build", plan_node_id, false, driver_sequence),
+              _asof_join_context(asof_join_context) {
+        _asof_join_context->ref();
+    }
+
+    ~AsofJoinBuildOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+    bool has_output() const override { return false; }
+    bool need_input() const override { return !is_finished(); }
+    bool is_finished() const override { return _is_finished || _asof_join_context->is_finished(); }
+
+    Status set_finishing(RuntimeState* state) override;
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
+
+private:
+    std::atomic<bool> _is_finished = false;
+    size_t _num_input_rows = 0;
+
+    const std::shared_ptr<AsofJoinContext>& _asof_join_context;
+};
+
+class AsofJoinBuildOperatorFactory final : public OperatorFactory {
+public:
+    AsofJoinBuildOperatorFactory(int32_t id, int32_t plan_node_id, std::shared_ptr<AsofJoinContext> asof_join_context)
+            : OperatorFactory(id, "asof_join_build", plan_node_id), _asof_join_context(std::move(asof_join_context)) {}
+
+    ~AsofJoinBuildOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<AsofJoinBuildOperator>(this, _id, _plan_node_id, driver_sequence, _asof_join_context);
+    }
+
+private:
+    std::shared_ptr<AsofJoinContext> _asof_join_context;
+};
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,309 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/hashjoin/asof_join_context.h"
+
+#include <algorithm>
+
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "exec/pipeline/runtime_filter_types.h"
+#include "exec/sorting/sorting.h"
+#include "exprs/expr.h"
+#include "simd/simd.h"
+
+namespace starrocks::pipeline {
+
+// Serialize the keys of |row| in the format of nullable columns, so that the keys of both sides are comparable
+// regardless of their nullability.
+static uint32_t serialize_keys(const Columns& keys, size_t row, uint8_t* pos) {
+    uint32_t size = 0;
+    for (const auto& key : keys) {
+        if (!key->is_nullable()) {
+            pos[size] = 0;
+            size += sizeof(bool);
+        }
+        size += key->serialize(row, pos + size);
+    }
+    return size;
+}
+
+static uint32_t max_serialize_size(const Columns& keys) {
+    uint32_t size = 0;
+    for (const auto& key : keys) {
+        size += key->max_one_element_serialize_size() + (key->is_nullable() ? 0 : sizeof(bool));
+    }
+    return size;
+}
+
+static StatusOr<ColumnPtr> evaluate(ExprContext* ctx, Expr* expr, Chunk* chunk) {
+    ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(expr, chunk));
+    return ColumnHelper::unpack_and_duplicate_const_column(chunk->num_rows(), column);
+}
+
+AsofJoinContext::AsofJoinContext(AsofJoinContextParams params)
+        : _plan_node_id(params.plan_node_id),
+          _join_type(params.join_type),
+          _build_expr_ctxs(std::move(params.build_expr_ctxs)),
+          _asof_join_ctx(params.asof_join_ctx),
+          _asof_op(params.asof_join_ctx->root()->op()),
+          _build_row_desc(params.build_row_desc),
+          _rf_hub(params.rf_hub) {}
+
+void AsofJoinContext::close(RuntimeState* state) {
+    _input_chunks.clear();
+    _build_chunk.reset();
+    _build_asof_key.reset();
+    _groups.clear();
+    _key_pool.free_all();
+}
+
+void AsofJoinContext::incr_builder() {
+    ++_num_right_sinkers;
+    _input_chunks.emplace_back();
+}
+
+void AsofJoinContext::incr_prober() {
+    ++_num_left_probers;
+}
+
+void AsofJoinContext::decr_prober(RuntimeState* state) {
+    // AsofJoinProbeOperator may be instantiated lazily, so context is ref for prober
+    // in AsofJoinProbeOperatorFactory::prepare and unref when all the probers are closed here.
+    if (++_num_closed_left_probers == _num_left_probers) {
+        unref(state);
+    }
+}
+
+Status AsofJoinContext::append_build_chunk(int32_t sinker_id, const ChunkPtr& chunk) {
+    if (chunk != nullptr && !chunk->is_empty()) {
+        _input_chunks[sinker_id].emplace_back(chunk);
+    }
+    return Status::OK();
+}
+
+Status AsofJoinContext::finish_one_right_sinker(int32_t sinker_id, RuntimeState* state) {
+    if (_num_right_sinkers - 1 == _num_finished_right_sinkers.fetch_add(1)) {
+        RETURN_IF_ERROR(_build(state));
+        // Notify the operators waiting for the runtime filters of this join, it doesn't build any.
+        _rf_hub->set_collector(_plan_node_id, std::make_unique<RuntimeFilterCollector>(RuntimeInFilterList{},
+                                                                                       RuntimeBloomFilterList{}));
+        _all_right_finished = true;
+    }
+    return Status::OK();
+}
+
+Status AsofJoinContext::finish_one_left_prober(RuntimeState* state) {
+    if (_num_left_probers == _num_finished_left_probers.fetch_add(1) + 1) {
+        // All the probers have finished, so the builders can be short-circuited.
+        RETURN_IF_ERROR(set_finished());
+    }
+    return Status::OK();
+}
+
+Status AsofJoinContext::_build(RuntimeState* state) {
+    std::vector<ChunkPtr> chunks;
+    for (auto& sinker_chunks : _input_chunks) {
+        for (auto& chunk : sinker_chunks) {
+            chunks.emplace_back(std::move(chunk));
+        }
+    }
+    _input_chunks.clear();
+
+    // Concatenate the input chunks, a column is nullable if it is nullable in any chunk, and all the columns are
+    // nullable for left outer join to hold the null row.
+    const bool is_outer_join = _join_type == TJoinOp::ASOF_LEFT_OUTER_JOIN;
+    auto merged = std::make_shared<Chunk>();
+    for (const auto& tuple_desc : _build_row_desc->tuple_descriptors()) {
+        for (const auto& slot : tuple_desc->slots()) {
+            const bool nullable = is_outer_join || slot->is_nullable() ||
+                                  std::any_of(chunks.begin(), chunks.end(), [slot](const ChunkPtr& chunk) {
+                                      return chunk->is_column_nullable(slot->id());
+                                  });
+            merged->append_column(ColumnHelper::create_column(slot->type(), nullable), slot->id());
+        }
+    }
+    for (const auto& chunk : chunks) {
+        for (const auto& [slot_id, index] : merged->get_slot_id_to_index_map()) {
+            merged->get_column_by_slot_id(slot_id)->append(*chunk->get_column_by_slot_id(slot_id));
+        }
+    }
+    chunks.clear();
+
+    Columns keys;
+    for (auto* ctx : _build_expr_ctxs) {
+        ASSIGN_OR_RETURN(auto key, evaluate(ctx, ctx->root(), merged.get()));
+        keys.emplace_back(std::move(key));
+    }
+    ASSIGN_OR_RETURN(ColumnPtr asof_key, evaluate(_asof_join_ctx, _asof_join_ctx->root()->get_child(1), merged.get()));
+    keys.emplace_back(std::move(asof_key));
+
+    // Rows with a null key never match.
+    const auto num_rows = static_cast<uint32_t>(merged->num_rows());
+    Filter selection(num_rows, 1);
+    for (const auto& key : keys) {
+        if (key->has_null()) {
+            const auto& nulls = down_cast<NullableColumn*>(key.get())->immutable_null_column_data();
+            for (uint32_t i = 0; i < num_rows; i++) {
+                selection[i] &= !nulls[i];
+            }
+        }
+    }
+    std::vector<uint32_t> selected;
+    if (SIMD::count_zero(selection) > 0) {
+        selected.reserve(num_rows);
+        for (uint32_t i = 0; i < num_rows; i++) {
+            if (selection[i]) {
+                selected.push_back(i);
+            }
+        }
+        // The keys may be the columns of the merged chunk, so they are copied rather than filtered in place.
+        for (auto& key : keys) {
+            ColumnPtr filtered = key->clone_empty();
+            filtered->append_selective(*key, selected.data(), 0, selected.size());
+            key = std::move(filtered);
+        }
+    }
+
+    // Sort by the equi-join keys and then the asof key, so that every equi-join key owns a range of rows
+    // ordered by the asof key.
+    SmallPermutation perm = create_small_permutation(keys.back()->size());
+    RETURN_IF_ERROR(stable_sort_and_tie_columns(state->cancelled_ref(), keys,
+                                                SortDescs::asc_null_first(keys.size()), &perm));
+
+    _num_build_rows = perm.size();
+    std::vector<uint32_t> order(perm.size());
+    for (size_t i = 0; i < perm.size(); i++) {
+        order[i] = perm[i].index_in_chunk;
+    }
+
+    const Column* asof_data = ColumnHelper::get_data_column(keys.back().get());
+    _build_asof_key = asof_data->clone_empty();
+    _build_asof_key->append_selective(*asof_data, order.data(), 0, order.size());
+    keys.pop_back();
+
+    std::vector<uint8_t> buffer(max_serialize_size(keys));
+    Slice prev_key;
+    for (uint32_t i = 0; i < order.size(); i++) {
+        const uint32_t size = serialize_keys(keys, order[i], buffer.data());
+        if (i > 0 && prev_key == Slice(buffer.data(), size)) {
+            continue;
+        }
+        if (i > 0) {
+            _groups[prev_key].end = i;
+        }
+        uint8_t* key = _key_pool.allocate(size);
+        RETURN_IF_UNLIKELY_NULL(key, Status::MemoryAllocFailed("alloc mem for asof join key failed"));
+        memcpy(key, buffer.data(), size);
+        prev_key = Slice(key, size);
+        [[maybe_unused]] bool inserted = _groups.emplace(prev_key, Range{i, i}).second;
+        DCHECK(inserted);
+    }
+    if (!order.empty()) {
+        _groups[prev_key].end = static_cast<uint32_t>(order.size());
+    }
+
+    if (!selected.empty()) {
+        for (auto& row : order) {
+            row = selected[row];
+        }
+    }
+    _build_chunk = merged->clone_empty(order.size() + is_outer_join);
+    _build_chunk->append_selective(*merged, order.data(), 0, order.size());
+    if (is_outer_join) {
+        for (auto& column : _build_chunk->columns()) {
+            column->append_nulls(1);
+        }
+    }
+    return Status::OK();
+}
+
+void AsofJoinContext::find(const Columns& probe_keys, const ColumnPtr& probe_asof_key,
+                           Buffer<uint32_t>* build_rows) const {
+    const size_t num_rows = probe_asof_key->size();
+    build_rows->assign(num_rows, null_build_row());
+    if (_groups.empty()) {
+        return;
+    }
+
+    std::vector<uint8_t> buffer(max_serialize_size(probe_keys));
+    const Column* probe_data = ColumnHelper::get_data_column(probe_asof_key.get());
+    const Column& build_data = *_build_asof_key;
+    for (size_t row = 0; row < num_rows; row++) {
+        // A null equi-join key is serialized with its null flag, so it doesn't match any group either.
+        if (probe_asof_key->is_null(row)) {
+            continue;
+        }
+        const uint32_t size = serialize_keys(probe_keys, row, buffer.data());
+        auto it = _groups.find(Slice(buffer.data(), size));
+        if (it == _groups.end()) {
+            continue;
+        }
+
+        // The first build row in [lo, range.end) whose asof key is greater than (or not less than, if
+        // |inclusive| is false) the probe row.
+        const Range range = it->second;
+        auto search = [&](bool inclusive) {
+            uint32_t lo = range.begin;
+            uint32_t hi = range.end;
+            while (lo < hi) {
+                const uint32_t mid = lo + (hi - lo) / 2;
+                const int cmp = build_data.compare_at(mid, row, *probe_data, 1);
+                if (cmp < 0 || (inclusive && cmp == 0)) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            return lo;
+        };
+
+        uint32_t pos;
+        switch (_asof_op) {
+        case TExprOpcode::GE:
+            // The last build row whose asof key <= probe.
+            pos = search(true);
+            if (pos > range.begin) {
+                (*build_rows)[row] = pos - 1;
+            }
+            break;
+        case TExprOpcode::GT:
+            // The last build row whose asof key < probe.
+            pos = search(false);
+            if (pos > range.begin) {
+                (*build_rows)[row] = pos - 1;
+            }
+            break;
+        case TExprOpcode::LE:
+            // The first build row whose asof key >= probe.
+            pos = search(false);
+            if (pos < range.end) {
+                (*build_rows)[row] = pos;
+            }
+            break;
+        case TExprOpcode::LT:
+            // The first build row whose asof key > probe.
+            pos = search(true);
+            if (pos < range.end) {
+                (*build_rows)[row] = pos;
+            }
+            break;
+        default:
+            DCHECK(false) << "unsupported asof join operator " << _asof_op;
+            break;
+        }
+    }
+}
+
+} // namespace starrocks::pipeline
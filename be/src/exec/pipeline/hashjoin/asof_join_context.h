@@ -0,0 +1,122 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/column_hash.h"
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "exec/pipeline/context_with_dependency.h"
+#include "exprs/expr_context.h"
+#include "gen_cpp/PlanNodes_types.h"
+#include "runtime/descriptors.h"
+#include "runtime/mem_pool.h"
+#include "runtime/runtime_state.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks::pipeline {
+
+class RuntimeFilterHub;
+
+struct AsofJoinContextParams {
+    int32_t plan_node_id;
+    TJoinOp::type join_type;
+    // The equi-join keys of the build side.
+    std::vector<ExprContext*> build_expr_ctxs;
+    // probe_expr op build_expr, op is one of <, <=, > and >=.
+    ExprContext* asof_join_ctx;
+    const RowDescriptor* build_row_desc;
+    RuntimeFilterHub* rf_hub;
+};
+
+// AsofJoinContext collects the build rows of all the AsofJoinBuildOperators, and sorts them by the equi-join keys
+// and then the build expr of the asof condition, so that every distinct equi-join key owns a range of rows ordered
+// by the asof key. A probe row binary searches the range of its equi-join key for the closest build row.
+//
+// Rows with a null key never match, so they are dropped from the build side. For ASOF_LEFT_OUTER_JOIN, all the
+// build columns are nullable and an extra null row is appended after the sorted rows, which unmatched probe rows
+// refer to.
+class AsofJoinContext final : public ContextWithDependency {
+public:
+    explicit AsofJoinContext(AsofJoinContextParams params);
+    ~AsofJoinContext() override = default;
+
+    void close(RuntimeState* state) override;
+
+    void incr_builder();
+    void incr_prober();
+    void decr_prober(RuntimeState* state);
+
+    Status append_build_chunk(int32_t sinker_id, const ChunkPtr& chunk);
+    Status finish_one_right_sinker(int32_t sinker_id, RuntimeState* state);
+    Status finish_one_left_prober(RuntimeState* state);
+
+    bool is_right_finished() const { return _all_right_finished.load(std::memory_order_acquire); }
+    int32_t num_builders() const { return _num_right_sinkers; }
+    size_t num_build_rows() const { return _num_build_rows; }
+    size_t num_groups() const { return _groups.size(); }
+
+    // The build rows sorted by keys, followed by the null row for ASOF_LEFT_OUTER_JOIN.
+    const ChunkPtr& build_chunk() const { return _build_chunk; }
+    // Index of the null row, referenced by the unmatched probe rows.
+    uint32_t null_build_row() const { return static_cast<uint32_t>(_num_build_rows); }
+
+    // Find the matched build row of each probe row, a probe row without match gets null_build_row().
+    // |probe_keys| are the equi-join keys and |probe_asof_key| is the probe expr of the asof condition,
+    // all of them are not constant.
+    void find(const Columns& probe_keys, const ColumnPtr& probe_asof_key, Buffer<uint32_t>* build_rows) const;
+
+private:
+    struct Range {
+        uint32_t begin;
+        uint32_t end;
+    };
+    using GroupMap = phmap::flat_hash_map<Slice, Range, SliceHash>;
+
+    Status _build(RuntimeState* state);
+
+    const int32_t _plan_node_id;
+    const TJoinOp::type _join_type;
+    const std::vector<ExprContext*> _build_expr_ctxs;
+    ExprContext* const _asof_join_ctx;
+    const TExprOpcode::type _asof_op;
+    const RowDescriptor* _build_row_desc;
+    RuntimeFilterHub* _rf_hub;
+
+    int32_t _num_right_sinkers = 0;
+    int32_t _num_left_probers = 0;
+    std::atomic<int32_t> _num_finished_right_sinkers = 0;
+    std::atomic<int32_t> _num_finished_left_probers = 0;
+    std::atomic<int32_t> _num_closed_left_probers = 0;
+    std::atomic_bool _all_right_finished = false;
+
+    // Input chunks of each builder.
+    std::vector<std::vector<ChunkPtr>> _input_chunks;
+
+    size_t _num_build_rows = 0;
+    ChunkPtr _build_chunk;
+    // The build expr of the asof condition in the order of _build_chunk, without null.
+    ColumnPtr _build_asof_key;
+    // Serialized equi-join keys to their range of rows in _build_chunk.
+    GroupMap _groups;
+    MemPool _key_pool;
+};
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,173 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/hashjoin/asof_join_probe_operator.h"
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "exprs/expr.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks::pipeline {
+
+AsofJoinProbeOperator::AsofJoinProbeOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                                             int32_t driver_sequence, TJoinOp::type join_type,
+                                             const std::vector<ExprContext*>& probe_expr_ctxs,
+                                             ExprContext* asof_join_ctx,
+                                             const std::vector<ExprContext*>& conjunct_ctxs,
+                                             const std::vector<SlotDescriptor*>& probe_slots,
+                                             const std::vector<SlotDescriptor*>& build_slots,
+                                             const std::shared_ptr<AsofJoinContext>& asof_join_context)
+        : OperatorWithDependency(factory, id, "asof_join_probe", plan_node_id, false, driver_sequence),
+          _join_type(join_type),
+          _probe_expr_ctxs(probe_expr_ctxs),
+          _asof_join_ctx(asof_join_ctx),
+          _conjunct_ctxs(conjunct_ctxs),
+          _probe_slots(probe_slots),
+          _build_slots(build_slots),
+          _asof_join_context(asof_join_context) {}
+
+Status AsofJoinProbeOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorWithDependency::prepare(state));
+    _asof_join_context->incr_prober();
+
+    _unique_metrics->add_info_string("JoinType", to_string(_join_type));
+    _search_timer = ADD_TIMER(_unique_metrics, "SearchTime");
+    _output_timer = ADD_TIMER(_unique_metrics, "OutputTime");
+    return Status::OK();
+}
+
+void AsofJoinProbeOperator::close(RuntimeState* state) {
+    _asof_join_context->decr_prober(state);
+    OperatorWithDependency::close(state);
+}
+
+Status AsofJoinProbeOperator::set_finishing(RuntimeState* state) {
+    _input_finished = true;
+    return Status::OK();
+}
+
+Status AsofJoinProbeOperator::set_finished(RuntimeState* state) {
+    return _asof_join_context->finish_one_left_prober(state);
+}
+
+StatusOr<ChunkPtr> AsofJoinProbeOperator::pull_chunk(RuntimeState* state) {
+    return std::move(_output_chunk);
+}
+
+Status AsofJoinProbeOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    const size_t num_rows = chunk->num_rows();
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+
+    {
+        SCOPED_TIMER(_search_timer);
+        Columns probe_keys;
+        for (auto* ctx : _probe_expr_ctxs) {
+            ASSIGN_OR_RETURN(ColumnPtr key, ctx->evaluate(chunk.get()));
+            probe_keys.emplace_back(ColumnHelper::unpack_and_duplicate_const_column(num_rows, key));
+        }
+        Expr* probe_asof_expr = _asof_join_ctx->root()->get_child(0);
+        ASSIGN_OR_RETURN(ColumnPtr asof_key, _asof_join_ctx->evaluate(probe_asof_expr, chunk.get()));
+        asof_key = ColumnHelper::unpack_and_duplicate_const_column(num_rows, asof_key);
+        _asof_join_context->find(probe_keys, asof_key, &_build_rows);
+    }
+
+    SCOPED_TIMER(_output_timer);
+    // Inner join only outputs the matched probe rows.
+    bool filter_probe = false;
+    if (_join_type == TJoinOp::ASOF_INNER_JOIN) {
+        const uint32_t null_build_row = _asof_join_context->null_build_row();
+        _probe_rows.clear();
+        size_t num_matched = 0;
+        for (uint32_t i = 0; i < num_rows; i++) {
+            if (_build_rows[i] != null_build_row) {
+                _probe_rows.push_back(i);
+                _build_rows[num_matched++] = _build_rows[i];
+            }
+        }
+        _build_rows.resize(num_matched);
+        filter_probe = num_matched < num_rows;
+        if (num_matched == 0) {
+            return Status::OK();
+        }
+    }
+
+    const size_t num_output_rows = _build_rows.size();
+    auto output = std::make_shared<Chunk>();
+    for (const auto* slot : _probe_slots) {
+        ColumnPtr column = chunk->get_column_by_slot_id(slot->id());
+        if (filter_probe) {
+            ColumnPtr selected = column->clone_empty();
+            selected->append_selective(*column, _probe_rows.data(), 0, num_output_rows);
+            column = std::move(selected);
+        }
+        output->append_column(std::move(column), slot->id());
+    }
+    const ChunkPtr& build_chunk = _asof_join_context->build_chunk();
+    for (const auto* slot : _build_slots) {
+        const ColumnPtr& src = build_chunk->get_column_by_slot_id(slot->id());
+        ColumnPtr column = src->clone_empty();
+        column->append_selective(*src, _build_rows.data(), 0, num_output_rows);
+        output->append_column(std::move(column), slot->id());
+    }
+
+    RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, output.get(), nullptr));
+    if (!output->is_empty()) {
+        _output_chunk = std::move(output);
+    }
+    return Status::OK();
+}
+
+OperatorPtr AsofJoinProbeOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
+    return std::make_shared<AsofJoinProbeOperator>(this, _id, _plan_node_id, driver_sequence, _join_type,
+                                                   _probe_expr_ctxs, _asof_join_ctx, _conjunct_ctxs, _probe_slots,
+                                                   _build_slots, _asof_join_context);
+}
+
+Status AsofJoinProbeOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorWithDependencyFactory::prepare(state));
+
+    // Unref is called in _asof_join_context->decr_prober, when call probe operators have called decr_prober.
+    _asof_join_context->ref();
+
+    for (const auto& tuple_desc : _probe_row_desc.tuple_descriptors()) {
+        _probe_slots.insert(_probe_slots.end(), tuple_desc->slots().begin(), tuple_desc->slots().end());
+    }
+    for (const auto& tuple_desc : _build_row_desc.tuple_descriptors()) {
+        _build_slots.insert(_build_slots.end(), tuple_desc->slots().begin(), tuple_desc->slots().end());
+    }
+
+    RETURN_IF_ERROR(Expr::prepare(_build_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_build_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::prepare(_probe_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_probe_expr_ctxs, state));
+    RETURN_IF_ERROR(_asof_join_ctx->prepare(state));
+    RETURN_IF_ERROR(_asof_join_ctx->open(state));
+    RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
+    return Status::OK();
+}
+
+void AsofJoinProbeOperatorFactory::close(RuntimeState* state) {
+    Expr::close(_build_expr_ctxs, state);
+    Expr::close(_probe_expr_ctxs, state);
+    _asof_join_ctx->close(state);
+    Expr::close(_conjunct_ctxs, state);
+
+    OperatorWithDependencyFactory::close(state);
+}
+
+} // namespace starrocks::pipeline
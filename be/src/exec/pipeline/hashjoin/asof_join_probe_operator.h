@@ -0,0 +1,118 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <utility>
+
+#include "column/vectorized_fwd.h"
+#include "exec/pipeline/hashjoin/asof_join_context.h"
+#include "exec/pipeline/operator_with_dependency.h"
+#include "exprs/expr_context.h"
+#include "runtime/descriptors.h"
+
+namespace starrocks::pipeline {
+
+// AsofJoinProbeOperator
+// Every probe row is joined with at most one build row: the closest one that has the same equi-join keys and
+// satisfies the asof condition, so the output chunk never has more rows than the input chunk.
+class AsofJoinProbeOperator final : public OperatorWithDependency {
+public:
+    AsofJoinProbeOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                          TJoinOp::type join_type, const std::vector<ExprContext*>& probe_expr_ctxs,
+                          ExprContext* asof_join_ctx, const std::vector<ExprContext*>& conjunct_ctxs,
+                          const std::vector<SlotDescriptor*>& probe_slots,
+                          const std::vector<SlotDescriptor*>& build_slots,
+                          const std::shared_ptr<AsofJoinContext>& asof_join_context);
+
+    ~AsofJoinProbeOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+    bool is_ready() const override { return _asof_join_context->is_right_finished(); }
+    bool is_finished() const override { return (_input_finished || _skip_probe()) && !has_output(); }
+    bool has_output() const override { return _output_chunk != nullptr; }
+    bool need_input() const override { return is_ready() && !_skip_probe() && !has_output(); }
+
+    Status set_finishing(RuntimeState* state) override;
+    Status set_finished(RuntimeState* state) override;
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
+
+private:
+    // An inner join with empty build side has nothing to output.
+    bool _skip_probe() const {
+        return is_ready() && _join_type == TJoinOp::ASOF_INNER_JOIN && _asof_join_context->num_build_rows() == 0;
+    }
+
+    const TJoinOp::type _join_type;
+    const std::vector<ExprContext*>& _probe_expr_ctxs;
+    ExprContext* const _asof_join_ctx;
+    const std::vector<ExprContext*>& _conjunct_ctxs;
+    const std::vector<SlotDescriptor*>& _probe_slots;
+    const std::vector<SlotDescriptor*>& _build_slots;
+    const std::shared_ptr<AsofJoinContext>& _asof_join_context;
+
+    bool _input_finished = false;
+    ChunkPtr _output_chunk;
+    Buffer<uint32_t> _build_rows;
+    Buffer<uint32_t> _probe_rows;
+
+    RuntimeProfile::Counter* _search_timer = nullptr;
+    RuntimeProfile::Counter* _output_timer = nullptr;
+};
+
+class AsofJoinProbeOperatorFactory final : public OperatorWithDependencyFactory {
+public:
+    AsofJoinProbeOperatorFactory(int32_t id, int32_t plan_node_id, TJoinOp::type join_type,
+                                 const RowDescriptor& probe_row_desc, const RowDescriptor& build_row_desc,
+                                 std::vector<ExprContext*> build_expr_ctxs, std::vector<ExprContext*> probe_expr_ctxs,
+                                 ExprContext* asof_join_ctx, std::vector<ExprContext*> conjunct_ctxs,
+                                 std::shared_ptr<AsofJoinContext> asof_join_context)
+            : OperatorWithDependencyFactory(id, "asof_join_probe", plan_node_id),
+              _join_type(join_type),
+              _probe_row_desc(probe_row_desc),
+              _build_row_desc(build_row_desc),
+              _build_expr_ctxs(std::move(build_expr_ctxs)),
+              _probe_expr_ctxs(std::move(probe_expr_ctxs)),
+              _asof_join_ctx(asof_join_ctx),
+              _conjunct_ctxs(std::move(conjunct_ctxs)),
+              _asof_join_context(std::move(asof_join_context)) {}
+
+    ~AsofJoinProbeOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+private:
+    const TJoinOp::type _join_type;
+    const RowDescriptor& _probe_row_desc;
+    const RowDescriptor& _build_row_desc;
+    std::vector<SlotDescriptor*> _probe_slots;
+    std::vector<SlotDescriptor*> _build_slots;
+
+    // The build exprs are evaluated by AsofJoinContext, they are prepared here along with the others.
+    std::vector<ExprContext*> _build_expr_ctxs;
+    std::vector<ExprContext*> _probe_expr_ctxs;
+    ExprContext* _asof_join_ctx;
+    std::vector<ExprContext*> _conjunct_ctxs;
+
+    std::shared_ptr<AsofJoinContext> _asof_join_context;
+};
+
+} // namespace starrocks::pipeline
@@ -32,6 +32,15 @@ HashJoinBuildOperator::HashJoinBuildOperator(OperatorFactory* factory, int32_t i
           _distribution_mode(distribution_mode) {}
 
 Status HashJoinBuildOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_share_broadcast_build) {
+        if (_shared_build == nullptr) {
+            _shared_build = state->query_ctx()->get_broadcast_join_build(_plan_node_id);
+        }
+        // The shared build has all the build rows already.
+        if (_shared_build != nullptr) {
+            return Status::OK();
+        }
+    }
     return _join_builder->append_chunk_to_ht(chunk);
 }
 
@@ -48,12 +57,20 @@ Status HashJoinBuildOperator::prepare(RuntimeState* state) {
     _join_builder->ref();
 
     RETURN_IF_ERROR(_join_builder->prepare_builder(state, _unique_metrics.get()));
+    if (_share_broadcast_build) {
+        // The build may be released by another fragment instance, so it is charged to the query.
+        _join_builder->hash_join_builder()->hash_table().set_mem_tracker(state->query_ctx()->mem_tracker());
+    }
 
     return Status::OK();
 }
 void HashJoinBuildOperator::close(RuntimeState* state) {
     COUNTER_SET(_join_builder->build_metrics().hash_table_memory_usage,
                 _join_builder->hash_join_builder()->hash_table_mem_usage());
+    if (_shared_build != nullptr) {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->query_ctx()->mem_tracker().get());
+        _shared_build.reset();
+    }
     _join_builder->unref(state);
 
     Operator::close(state);
@@ -82,7 +99,19 @@ Status HashJoinBuildOperator::set_finishing(RuntimeState* state) {
     if (state->is_cancelled()) {
         return Status::Cancelled("runtime state is cancelled");
     }
-    RETURN_IF_ERROR(_join_builder->build_ht(state));
+    if (_share_broadcast_build && _shared_build == nullptr) {
+        _shared_build = state->query_ctx()->get_broadcast_join_build(_plan_node_id);
+    }
+    if (_shared_build != nullptr) {
+        _join_builder->share_build_ht(state, std::move(_shared_build));
+    } else {
+        RETURN_IF_ERROR(_join_builder->build_ht(state));
+        auto* hash_join_builder = _join_builder->hash_join_builder();
+        if (_share_broadcast_build && hash_join_builder->ready()) {
+            state->query_ctx()->publish_broadcast_join_build(_plan_node_id,
+                                                             hash_join_builder->hash_table().build_items());
+        }
+    }
 
     size_t merger_index = _driver_sequence;
     // Broadcast Join only has one build operator.
@@ -180,9 +209,11 @@ OperatorPtr HashJoinBuildOperatorFactory::create(int32_t dop, int32_t driver_seq
         _string_key_columns.resize(dop);
     }
 
-    return std::make_shared<HashJoinBuildOperator>(this, _id, _name, _plan_node_id, driver_sequence,
-                                                   _hash_joiner_factory->create_builder(dop, driver_sequence),
-                                                   _partial_rf_merger.get(), _distribution_mode);
+    auto op = std::make_shared<HashJoinBuildOperator>(this, _id, _name, _plan_node_id, driver_sequence,
+                                                      _hash_joiner_factory->create_builder(dop, driver_sequence),
+                                                      _partial_rf_merger.get(), _distribution_mode);
+    op->set_share_broadcast_build(_share_broadcast_build);
+    return op;
 }
 
 void HashJoinBuildOperatorFactory::retain_string_key_columns(int32_t driver_sequence, Columns&& columns) {
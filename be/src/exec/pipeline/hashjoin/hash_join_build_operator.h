@@ -59,6 +59,10 @@ public:
 
     size_t output_amplification_factor() const override;
 
+    // Shares the hash table of the broadcast join built by another fragment instance of the query on this BE, if any,
+    // instead of building one.
+    void set_share_broadcast_build(bool value) { _share_broadcast_build = value; }
+
 protected:
     HashJoinerPtr _join_builder;
     PartialRuntimeFilterMerger* _partial_rf_merger;
@@ -67,6 +71,9 @@ protected:
     DECLARE_ONCE_DETECTOR(_set_finishing_once);
 
     const TJoinDistributionMode::type _distribution_mode;
+
+    bool _share_broadcast_build = false;
+    std::shared_ptr<const JoinHashTableItems> _shared_build;
 };
 
 class HashJoinBuildOperatorFactory : public OperatorFactory {
@@ -83,12 +90,15 @@ public:
 
     const auto& hash_joiner_factory() { return _hash_joiner_factory; }
 
+    void set_share_broadcast_build(bool value) { _share_broadcast_build = value; }
+
 protected:
     HashJoinerFactoryPtr _hash_joiner_factory;
     std::unique_ptr<PartialRuntimeFilterMerger> _partial_rf_merger;
     std::vector<Columns> _string_key_columns;
     const TJoinDistributionMode::type _distribution_mode;
     SpillProcessChannelFactoryPtr _spill_channel_factory;
+    bool _share_broadcast_build = false;
 };
 
 } // namespace starrocks::pipeline
@@ -18,6 +18,7 @@
 #include <memory>
 #include <numeric>
 
+#include "common/config.h"
 #include "exec/cross_join_node.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/spill/executor.h"
@@ -138,6 +139,7 @@ std::unique_ptr<SpillableNLJoinChunkStream> NLJoinBuildChunkStreamBuilder::build
 
 void NLJoinContext::close(RuntimeState* state) {
     _build_chunks.clear();
+    _range_index.reset();
     _build_stream_builder.close();
 }
 
@@ -238,6 +240,13 @@ Status NLJoinContext::finish_one_right_sinker(int32_t sinker_id, RuntimeState* s
         if (!_build_stream_builder.has_spilled()) {
             _build_chunks = _build_stream_builder.build();
             RETURN_IF_ERROR(_init_runtime_filter(state));
+            if (_range_plan != nullptr && config::nljoin_range_index_min_build_rows >= 0 && _num_build_rows > 0 &&
+                _num_build_rows >= config::nljoin_range_index_min_build_rows) {
+                ASSIGN_OR_RETURN(_range_index, NLJoinRangeIndex::build(*_range_plan, _build_chunks));
+                // The probers only read the sorted build rows of the index.
+                _build_chunks.clear();
+                _build_stream_builder.close();
+            }
         } else {
             _notify_runtime_filter_collector(state);
         }
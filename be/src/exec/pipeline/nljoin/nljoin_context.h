@@ -23,6 +23,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
 #include "exec/pipeline/spill_process_channel.h"
 #include "exec/spill/executor.h"
 #include "exec/spill/serde.h"
@@ -181,6 +182,12 @@ public:
 
     const std::vector<uint8_t> get_shared_build_match_flag() const;
 
+    // Index the build rows by the range conditions of |plan| once all of them are received.
+    // It must be called before the build side finishes.
+    void set_range_plan(const NLJoinRangePlan* plan) { _range_plan = plan; }
+    // nullptr if the build rows are not indexed, otherwise the probers read the build rows from the index.
+    const NLJoinRangeIndex* range_index() const { return _range_index.get(); }
+
     const SpillProcessChannelFactoryPtr& spill_channel_factory() { return _spill_process_factory_ptr; }
     NLJoinBuildChunkStreamBuilder& builder() { return _build_stream_builder; }
 
@@ -207,6 +214,8 @@ private:
     int _build_chunk_desired_size = 0;
     int _num_post_probers = 0;
     std::vector<uint8_t> _shared_build_match_flag;
+    const NLJoinRangePlan* _range_plan = nullptr;
+    std::unique_ptr<NLJoinRangeIndex> _range_index;
 
     // conjuncts in cross join, used for generate runtime_filter
     std::vector<ExprContext*> _rf_conjuncts_ctx;
@@ -250,6 +250,7 @@ void NLJoinProbeOperator::_move_build_chunk_index(int index) {
 
 ChunkPtr NLJoinProbeOperator::_init_output_chunk(size_t chunk_size) const {
     ChunkPtr chunk = std::make_shared<Chunk>();
+    const Chunk* build_chunk = _range_index != nullptr ? _range_index->sorted_chunk().get() : _curr_build_chunk;
     bool left_to_nullable = _is_right_join();
     bool right_to_nullable = _is_left_join() || _is_left_anti_join() || _is_left_semi_join();
 
@@ -265,8 +266,8 @@ ChunkPtr NLJoinProbeOperator::_init_output_chunk(size_t chunk_size) const {
     for (size_t i = _probe_column_count; i < _col_types.size(); i++) {
         SlotDescriptor* slot = _col_types[i];
         bool nullable = right_to_nullable | _col_types[i]->is_nullable();
-        if (_curr_build_chunk) {
-            nullable |= _curr_build_chunk->is_column_nullable(slot->id());
+        if (build_chunk) {
+            nullable |= build_chunk->is_column_nullable(slot->id());
         }
         ColumnPtr new_col = ColumnHelper::create_column(slot->type(), nullable);
         chunk->append_column(new_col, slot->id());
@@ -434,6 +435,40 @@ ChunkPtr NLJoinProbeOperator::_permute_chunk_for_inner_join(size_t chunk_size) {
     return result_chunk;
 }
 
+// Permute each probe row with the build rows of its range in the range index, in the order of the probe rows
+ChunkPtr NLJoinProbeOperator::_permute_chunk_for_range_join(size_t chunk_size) {
+    ChunkPtr chunk = _init_output_chunk(chunk_size);
+    const ChunkPtr& build_chunk = _range_index->sorted_chunk();
+
+    while (_probe_row_current < _probe_chunk->num_rows() && chunk->num_rows() < chunk_size) {
+        if (!_range_probe_row_started) {
+            _range_index->find(_range_probe_bounds, _probe_row_current, &_build_row_current, &_range_build_row_end);
+            _range_probe_row_started = true;
+        }
+        size_t count = std::min(_range_build_row_end - _build_row_current, chunk_size - chunk->num_rows());
+        if (count > 0) {
+            COUNTER_UPDATE(_permute_rows_counter, count);
+            for (size_t i = 0; i < _col_types.size(); i++) {
+                SlotId slot_id = _col_types[i]->id();
+                ColumnPtr& dst_col = chunk->get_column_by_slot_id(slot_id);
+                if (i < _probe_column_count) {
+                    const ColumnPtr& src_col = _probe_chunk->get_column_by_slot_id(slot_id);
+                    dst_col->append_value_multiple_times(*src_col, _probe_row_current, count);
+                } else {
+                    const ColumnPtr& src_col = build_chunk->get_column_by_slot_id(slot_id);
+                    dst_col->append(*src_col, _build_row_current, count);
+                }
+            }
+            _build_row_current += count;
+        }
+        if (_build_row_current >= _range_build_row_end) {
+            _probe_row_current++;
+            _range_probe_row_started = false;
+        }
+    }
+    return chunk;
+}
+
 void NLJoinProbeOperator::_permute_chunk_base_left(ChunkPtr* chunk) {
     for (size_t i = 0; i < _probe_column_count; i++) {
         SlotId slot_id = _col_types[i]->id();
@@ -659,7 +694,8 @@ StatusOr<ChunkPtr> NLJoinProbeOperator::_pull_chunk_for_inner_join(size_t chunk_
     }
 
     while (!_is_curr_probe_chunk_finished()) {
-        ChunkPtr chunk = _permute_chunk_for_inner_join(chunk_size);
+        ChunkPtr chunk = _range_index != nullptr ? _permute_chunk_for_range_join(chunk_size)
+                                                 : _permute_chunk_for_inner_join(chunk_size);
         DCHECK(chunk);
         RETURN_IF_ERROR(_probe_for_inner_join(chunk));
         RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
@@ -694,6 +730,15 @@ Status NLJoinProbeOperator::push_chunk(RuntimeState* state, const ChunkPtr& chun
     _probe_row_finished = false;
     _reset_build_chunk_index();
 
+    if (_range_index == nullptr && _cross_join_context->range_index() != nullptr) {
+        _range_index = _cross_join_context->range_index();
+        _unique_metrics->add_info_string("RangeIndex", _range_index->plan().debug_string());
+    }
+    if (_range_index != nullptr) {
+        ASSIGN_OR_RETURN(_range_probe_bounds, _range_index->evaluate_probe(chunk.get()));
+        _range_probe_row_started = false;
+    }
+
     return Status::OK();
 }
 
@@ -730,6 +775,11 @@ Status NLJoinProbeOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
 
+    if (_join_op == TJoinOp::INNER_JOIN) {
+        _range_plan = NLJoinRangePlan::create(_join_conjuncts, _left_row_desc, _right_row_desc);
+        _cross_join_context->set_range_plan(_range_plan.get());
+    }
+
     return Status::OK();
 }
 
@@ -89,6 +89,7 @@ private:
     void _permute_probe_row(const ChunkPtr& chunk);
     ChunkPtr _permute_chunk_for_other_join(size_t chunk_size);
     ChunkPtr _permute_chunk_for_inner_join(size_t chunk_size);
+    ChunkPtr _permute_chunk_for_range_join(size_t chunk_size);
     void _permute_chunk_base_left(ChunkPtr* chunk);
     void _permute_chunk_base_right(ChunkPtr* chunk);
     Status _permute_right_join(size_t chunk_size);
@@ -132,6 +133,12 @@ private:
     size_t _probe_row_start = 0;      // Start index of current chunk
     size_t _probe_row_current = 0;    // End index of current chunk
 
+    // Range join states, only for inner join with an indexed build side
+    const NLJoinRangeIndex* _range_index = nullptr;
+    NLJoinRangeIndex::ProbeBounds _range_probe_bounds;
+    bool _range_probe_row_started = false; // Whether the range of the current probe row has been searched
+    size_t _range_build_row_end = 0;       // End of the range of the current probe row in the sorted build rows
+
     // Counters
     RuntimeProfile::Counter* _permute_rows_counter = nullptr;
     RuntimeProfile::Counter* _permute_left_rows_counter = nullptr;
@@ -176,6 +183,7 @@ private:
     std::vector<ExprContext*> _conjunct_ctxs;
 
     std::shared_ptr<NLJoinContext> _cross_join_context;
+    std::unique_ptr<NLJoinRangePlan> _range_plan;
 };
 
 } // namespace starrocks::pipeline
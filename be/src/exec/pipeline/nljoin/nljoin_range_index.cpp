@@ -0,0 +1,255 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "fmt/format.h"
+#include "runtime/descriptors.h"
+
+namespace starrocks::pipeline {
+
+// Only the types whose column order is the order of the comparison predicates. Floating point types are
+// excluded, because NaN is not ordered.
+static bool is_range_index_type(const TypeDescriptor& type) {
+    return is_integer_type(type.type) || is_decimalv3_field_type(type.type) || type.type == TYPE_DATE ||
+           type.type == TYPE_DATETIME || type.type == TYPE_VARCHAR;
+}
+
+static std::unordered_set<SlotId> slot_ids_of(const RowDescriptor& row_desc) {
+    std::unordered_set<SlotId> slot_ids;
+    for (const auto& tuple_desc : row_desc.tuple_descriptors()) {
+        for (const auto& slot : tuple_desc->slots()) {
+            slot_ids.insert(slot->id());
+        }
+    }
+    return slot_ids;
+}
+
+// Whether |expr| references some slots and all of them are in |slot_ids|.
+static bool only_references(Expr* expr, const std::unordered_set<SlotId>& slot_ids) {
+    std::vector<SlotId> expr_slot_ids;
+    expr->get_slot_ids(&expr_slot_ids);
+    return !expr_slot_ids.empty() && std::all_of(expr_slot_ids.begin(), expr_slot_ids.end(),
+                                                 [&](SlotId id) { return slot_ids.count(id) > 0; });
+}
+
+std::unique_ptr<NLJoinRangePlan> NLJoinRangePlan::create(const std::vector<ExprContext*>& join_conjuncts,
+                                                         const RowDescriptor& probe_row_desc,
+                                                         const RowDescriptor& build_row_desc) {
+    const auto probe_slot_ids = slot_ids_of(probe_row_desc);
+    const auto build_slot_ids = slot_ids_of(build_row_desc);
+
+    auto plan = std::make_unique<NLJoinRangePlan>();
+    for (ExprContext* conjunct : join_conjuncts) {
+        Expr* root = conjunct->root();
+        if (root->node_type() != TExprNodeType::BINARY_PRED || root->get_num_children() != 2) {
+            continue;
+        }
+        const TExprOpcode::type op = root->op();
+        if (op != TExprOpcode::LT && op != TExprOpcode::LE && op != TExprOpcode::GT && op != TExprOpcode::GE) {
+            continue;
+        }
+        Expr* left = root->get_child(0);
+        Expr* right = root->get_child(1);
+        if (!(left->type() == right->type()) || !is_range_index_type(left->type())) {
+            continue;
+        }
+
+        bool left_is_build;
+        if (only_references(left, build_slot_ids) && only_references(right, probe_slot_ids)) {
+            left_is_build = true;
+        } else if (only_references(left, probe_slot_ids) && only_references(right, build_slot_ids)) {
+            left_is_build = false;
+        } else {
+            continue;
+        }
+        NLJoinRangeBound bound{conjunct, left_is_build ? left : right, left_is_build ? right : left};
+        const bool less = op == TExprOpcode::LT || op == TExprOpcode::LE;
+        // build < probe or probe > build is an upper bound of the build value.
+        auto& target = less == left_is_build ? plan->upper : plan->lower;
+        if (!target.has_value()) {
+            target = bound;
+        }
+    }
+    if (!plan->lower.has_value() && !plan->upper.has_value()) {
+        return nullptr;
+    }
+    // Sorting by an upper bound makes the probe of `build.start <= probe.ts AND build.end >= probe.ts` narrower on
+    // both sides, as the running maximum of the ends follows the starts.
+    plan->sort_by_lower = !plan->upper.has_value();
+    return plan;
+}
+
+std::string NLJoinRangePlan::debug_string() const {
+    std::string result;
+    if (lower.has_value()) {
+        result = fmt::format("{} >= {}", lower->build_expr->debug_string(), lower->probe_expr->debug_string());
+    }
+    if (upper.has_value()) {
+        result += fmt::format("{}{} <= {}", result.empty() ? "" : ", ", upper->build_expr->debug_string(),
+                              upper->probe_expr->debug_string());
+    }
+    return result;
+}
+
+// Concatenate |chunks| into one chunk, a column is nullable if it is nullable in any chunk.
+static ChunkPtr merge_chunks(const std::vector<ChunkPtr>& chunks) {
+    size_t num_rows = 0;
+    for (const auto& chunk : chunks) {
+        num_rows += chunk->num_rows();
+    }
+    ChunkPtr merged = chunks[0]->clone_empty(num_rows);
+    for (const auto& [slot_id, index] : merged->get_slot_id_to_index_map()) {
+        ColumnPtr& column = merged->get_column_by_slot_id(slot_id);
+        const bool nullable = std::any_of(chunks.begin(), chunks.end(), [slot_id = slot_id](const ChunkPtr& chunk) {
+            return chunk->is_column_nullable(slot_id);
+        });
+        if (nullable && !column->is_nullable()) {
+            column = NullableColumn::create(column, NullColumn::create());
+        }
+    }
+    for (const auto& chunk : chunks) {
+        merged->append(*chunk);
+    }
+    return merged;
+}
+
+static StatusOr<ColumnPtr> evaluate(ExprContext* conjunct, Expr* expr, Chunk* chunk) {
+    ASSIGN_OR_RETURN(ColumnPtr column, conjunct->evaluate(expr, chunk));
+    return ColumnHelper::unpack_and_duplicate_const_column(chunk->num_rows(), column);
+}
+
+StatusOr<std::unique_ptr<NLJoinRangeIndex>> NLJoinRangeIndex::build(const NLJoinRangePlan& plan,
+                                                                    const std::vector<ChunkPtr>& build_chunks) {
+    DCHECK(plan.lower.has_value() || plan.upper.has_value());
+    DCHECK(!build_chunks.empty());
+    std::unique_ptr<NLJoinRangeIndex> index(new NLJoinRangeIndex(plan));
+    ChunkPtr merged = merge_chunks(build_chunks);
+
+    const NLJoinRangeBound& key_bound = plan.sort_by_lower ? *plan.lower : *plan.upper;
+    const auto& other_bound = plan.sort_by_lower ? plan.upper : plan.lower;
+    ASSIGN_OR_RETURN(ColumnPtr key, evaluate(key_bound.conjunct, key_bound.build_expr, merged.get()));
+    ColumnPtr other;
+    if (other_bound.has_value()) {
+        ASSIGN_OR_RETURN(other, evaluate(other_bound->conjunct, other_bound->build_expr, merged.get()));
+    }
+
+    std::vector<uint32_t> order;
+    order.reserve(merged->num_rows());
+    for (uint32_t i = 0; i < merged->num_rows(); i++) {
+        if (!key->is_null(i) && (other == nullptr || !other->is_null(i))) {
+            order.push_back(i);
+        }
+    }
+    const Column* key_data = ColumnHelper::get_data_column(key.get());
+    std::sort(order.begin(), order.end(),
+              [key_data](uint32_t lhs, uint32_t rhs) { return key_data->compare_at(lhs, rhs, *key_data, 1) < 0; });
+
+    const auto size = static_cast<uint32_t>(order.size());
+    index->_sorted_chunk = merged->clone_empty(size);
+    index->_sorted_chunk->append_selective(*merged, order.data(), 0, size);
+    ColumnPtr key_values = key_data->clone_empty();
+    key_values->append_selective(*key_data, order.data(), 0, size);
+
+    ColumnPtr other_values;
+    if (other != nullptr) {
+        // The running maximum of a lower bound, or the suffix minimum of an upper bound, in the order of the key.
+        const Column* other_data = ColumnHelper::get_data_column(other.get());
+        std::vector<uint32_t> selected(size);
+        const int direction = plan.sort_by_lower ? -1 : 1;
+        for (uint32_t n = 0; n < size; n++) {
+            const uint32_t i = plan.sort_by_lower ? size - 1 - n : n;
+            uint32_t row = order[i];
+            if (n > 0) {
+                const uint32_t prev = selected[plan.sort_by_lower ? i + 1 : i - 1];
+                if (other_data->compare_at(prev, row, *other_data, 1) * direction > 0) {
+                    row = prev;
+                }
+            }
+            selected[i] = row;
+        }
+        other_values = other_data->clone_empty();
+        other_values->append_selective(*other_data, selected.data(), 0, size);
+    }
+
+    if (plan.sort_by_lower) {
+        index->_lower_values = std::move(key_values);
+        index->_upper_values = std::move(other_values);
+    } else {
+        index->_lower_values = std::move(other_values);
+        index->_upper_values = std::move(key_values);
+    }
+    return index;
+}
+
+StatusOr<NLJoinRangeIndex::ProbeBounds> NLJoinRangeIndex::evaluate_probe(Chunk* probe_chunk) const {
+    ProbeBounds bounds;
+    if (_plan.lower.has_value()) {
+        ASSIGN_OR_RETURN(bounds.lower, evaluate(_plan.lower->conjunct, _plan.lower->probe_expr, probe_chunk));
+    }
+    if (_plan.upper.has_value()) {
+        ASSIGN_OR_RETURN(bounds.upper, evaluate(_plan.upper->conjunct, _plan.upper->probe_expr, probe_chunk));
+    }
+    return bounds;
+}
+
+void NLJoinRangeIndex::find(const ProbeBounds& bounds, size_t row, size_t* begin, size_t* end) const {
+    *begin = 0;
+    *end = _sorted_chunk->num_rows();
+    if ((bounds.lower != nullptr && bounds.lower->is_null(row)) ||
+        (bounds.upper != nullptr && bounds.upper->is_null(row))) {
+        *end = 0;
+        return;
+    }
+    if (bounds.lower != nullptr) {
+        // The first build row whose value is not less than the probe value.
+        const Column* probe = ColumnHelper::get_data_column(bounds.lower.get());
+        size_t lo = 0;
+        size_t hi = *end;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (_lower_values->compare_at(mid, row, *probe, 1) < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        *begin = lo;
+    }
+    if (bounds.upper != nullptr) {
+        // The first build row whose value is greater than the probe value.
+        const Column* probe = ColumnHelper::get_data_column(bounds.upper.get());
+        size_t lo = *begin;
+        size_t hi = *end;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (_upper_values->compare_at(mid, row, *probe, 1) <= 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        *end = lo;
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,98 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+
+namespace starrocks {
+class Expr;
+class ExprContext;
+class RowDescriptor;
+} // namespace starrocks
+
+namespace starrocks::pipeline {
+
+// A join conjunct `build_expr <= probe_expr` (an upper bound of the build value) or `build_expr >= probe_expr`
+// (a lower bound), where build_expr only references the build side and probe_expr only the probe side.
+// `<` and `>` are indexed as `<=` and `>=`, since the conjunct itself is still evaluated on the candidates.
+struct NLJoinRangeBound {
+    ExprContext* conjunct = nullptr;
+    Expr* build_expr = nullptr;
+    Expr* probe_expr = nullptr;
+};
+
+struct NLJoinRangePlan {
+    std::optional<NLJoinRangeBound> lower;
+    std::optional<NLJoinRangeBound> upper;
+    // Whether the build rows are sorted by the build expression of |lower|, otherwise by that of |upper|.
+    bool sort_by_lower = false;
+
+    // Return nullptr if none of |join_conjuncts| is a range condition between the two sides.
+    static std::unique_ptr<NLJoinRangePlan> create(const std::vector<ExprContext*>& join_conjuncts,
+                                                   const RowDescriptor& probe_row_desc,
+                                                   const RowDescriptor& build_row_desc);
+
+    std::string debug_string() const;
+};
+
+// NLJoinRangeIndex narrows an inner nested loop join with range conditions, such as
+// `probe.ts BETWEEN build.start AND build.end` or `build.ts BETWEEN probe.start AND probe.end`, from the cross
+// product to the build rows that may satisfy them.
+//
+// The build rows are sorted by the build expression of one bound, the key, so that the bound of a probe row on the
+// key is a binary search. A bound on another build expression becomes a binary search too, by replacing its values
+// with their running maximum (lower bound) or their suffix minimum (upper bound) in the key order, which are
+// non-decreasing and never exclude a matching row. For example, the intervals that may contain a point start
+// before it, and after the last interval ending before it whose end is the maximum so far.
+//
+// Build rows with a null bound never satisfy the conditions and are dropped, which is only valid for inner joins.
+class NLJoinRangeIndex {
+public:
+    // The probe values of the bounds of a probe chunk.
+    struct ProbeBounds {
+        ColumnPtr lower;
+        ColumnPtr upper;
+    };
+
+    static StatusOr<std::unique_ptr<NLJoinRangeIndex>> build(const NLJoinRangePlan& plan,
+                                                             const std::vector<ChunkPtr>& build_chunks);
+
+    StatusOr<ProbeBounds> evaluate_probe(Chunk* probe_chunk) const;
+
+    // Set [*begin, *end) to the rows of sorted_chunk() which may match the row |row| of the probe chunk.
+    void find(const ProbeBounds& bounds, size_t row, size_t* begin, size_t* end) const;
+
+    const NLJoinRangePlan& plan() const { return _plan; }
+    // The build rows ordered by the key.
+    const ChunkPtr& sorted_chunk() const { return _sorted_chunk; }
+
+private:
+    explicit NLJoinRangeIndex(const NLJoinRangePlan& plan) : _plan(plan) {}
+
+    const NLJoinRangePlan _plan;
+    ChunkPtr _sorted_chunk;
+    // The non-decreasing and non-null build values of the bounds in the order of _sorted_chunk,
+    // nullptr if there is no such bound.
+    ColumnPtr _lower_values;
+    ColumnPtr _upper_values;
+};
+
+} // namespace starrocks::pipeline
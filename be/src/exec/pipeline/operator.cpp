@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/query_context.h"
@@ -76,6 +77,15 @@ Status Operator::prepare(RuntimeState* state) {
     _push_row_num_counter = ADD_COUNTER(_common_metrics, "PushRowNum", TUnit::UNIT);
     _pull_chunk_num_counter = ADD_COUNTER(_common_metrics, "PullChunkNum", TUnit::UNIT);
     _pull_row_num_counter = ADD_COUNTER(_common_metrics, "PullRowNum", TUnit::UNIT);
+    if (state->query_options().__isset.enable_profile_hardware_counters &&
+        state->query_options().enable_profile_hardware_counters) {
+        _hw_counters = std::make_unique<HardwareProfileCounters>();
+        for (int i = 0; i < HardwareCounters::NUM_EVENTS; i++) {
+            (*_hw_counters)[i] = ADD_COUNTER(_common_metrics,
+                                             HardwareCounters::event_name(static_cast<HardwareCounters::Event>(i)),
+                                             TUnit::UNIT);
+        }
+    }
     if (state->query_ctx() && state->query_ctx()->spill_manager()) {
         _mem_resource_manager.prepare(this, state->query_ctx()->spill_manager());
     }
@@ -168,14 +178,13 @@ const std::vector<SlotId>& Operator::filter_null_value_columns() const {
 Status Operator::eval_conjuncts_and_in_filters(const std::vector<ExprContext*>& conjuncts, Chunk* chunk,
                                                FilterPtr* filter, bool apply_filter) {
     if (UNLIKELY(!_conjuncts_and_in_filters_is_cached)) {
-        _cached_conjuncts_and_in_filters.insert(_cached_conjuncts_and_in_filters.end(), conjuncts.begin(),
-                                                conjuncts.end());
+        std::vector<ExprContext*> conjuncts_and_in_filters(conjuncts.begin(), conjuncts.end());
         auto& in_filters = runtime_in_filters();
-        _cached_conjuncts_and_in_filters.insert(_cached_conjuncts_and_in_filters.end(), in_filters.begin(),
-                                                in_filters.end());
+        conjuncts_and_in_filters.insert(conjuncts_and_in_filters.end(), in_filters.begin(), in_filters.end());
+        _conjuncts_and_in_filters.init(conjuncts_and_in_filters);
         _conjuncts_and_in_filters_is_cached = true;
     }
-    if (_cached_conjuncts_and_in_filters.empty()) {
+    if (_conjuncts_and_in_filters.empty()) {
         return Status::OK();
     }
     if (chunk == nullptr || chunk->is_empty()) {
@@ -186,8 +195,12 @@ Status Operator::eval_conjuncts_and_in_filters(const std::vector<ExprContext*>&
         SCOPED_TIMER(_conjuncts_timer);
         auto before = chunk->num_rows();
         _conjuncts_input_counter->update(before);
-        RETURN_IF_ERROR(
-                starrocks::ExecNode::eval_conjuncts(_cached_conjuncts_and_in_filters, chunk, filter, apply_filter));
+        if (filter == nullptr && apply_filter && config::pipeline_enable_adaptive_conjuncts_order) {
+            RETURN_IF_ERROR(_conjuncts_and_in_filters.evaluate(chunk));
+        } else {
+            RETURN_IF_ERROR(starrocks::ExecNode::eval_conjuncts(_conjuncts_and_in_filters.conjuncts(), chunk, filter,
+                                                                apply_filter));
+        }
         auto after = chunk->num_rows();
         _conjuncts_output_counter->update(after);
     }
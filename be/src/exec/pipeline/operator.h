@@ -18,11 +18,13 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exec/pipeline/adaptive/adaptive_conjuncts_evaluator.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/spill/operator_mem_resource_manager.h"
 #include "exprs/runtime_filter_bank.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
+#include "util/hardware_counters.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -281,7 +283,8 @@ protected:
     std::shared_ptr<RuntimeProfile> _unique_metrics;
 
     bool _conjuncts_and_in_filters_is_cached = false;
-    std::vector<ExprContext*> _cached_conjuncts_and_in_filters;
+    // The conjuncts and in-filters, evaluated in the order of their measured selectivity and cost.
+    AdaptiveConjunctsEvaluator _conjuncts_and_in_filters;
 
     RuntimeBloomFilterEvalContext _bloom_filter_eval_context;
 
@@ -308,6 +311,8 @@ protected:
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
     RuntimeProfile::Counter* _conjuncts_input_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_output_counter = nullptr;
+    // Only created when the session variable enable_profile_hardware_counters is on.
+    std::unique_ptr<HardwareProfileCounters> _hw_counters;
 
     // only used in spillable operator to record peak revocable memory bytes,
     // each operator should initialize it before use
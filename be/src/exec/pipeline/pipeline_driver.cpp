@@ -29,6 +29,7 @@
 #include "exec/query_cache/lane_arbiter.h"
 #include "exec/query_cache/multilane_operator.h"
 #include "exec/query_cache/ticket_checker.h"
+#include "exec/spill/process_spill_arbitrator.h"
 #include "exec/workgroup/work_group.h"
 #include "gen_cpp/InternalService_types.h"
 #include "gutil/casts.h"
@@ -301,7 +302,9 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 StatusOr<ChunkPtr> maybe_chunk;
                 {
                     SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(curr_op);
+                    SCOPED_SET_SAMPLED_OPERATOR(&curr_op->_name, curr_op->get_plan_node_id());
                     SCOPED_TIMER(curr_op->_pull_timer);
+                    ScopedHardwareCounters hw_counters(curr_op->_hw_counters.get());
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
@@ -332,7 +335,9 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                         total_rows_moved += row_num;
                         {
                             SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(next_op);
+                            SCOPED_SET_SAMPLED_OPERATOR(&next_op->_name, next_op->get_plan_node_id());
                             SCOPED_TIMER(next_op->_push_timer);
+                            ScopedHardwareCounters hw_counters(next_op->_hw_counters.get());
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
                             _adjust_memory_usage(runtime_state, query_mem_tracker.get(), next_op, maybe_chunk.value());
                             RELEASE_RESERVED_GUARD();
@@ -386,6 +391,12 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 COUNTER_UPDATE(_yield_by_time_limit_counter, 1);
                 break;
             }
+            if (_workgroup != nullptr && !_workgroup->is_sq_wg() &&
+                _workgroup->driver_sched_entity()->in_queue()->has_ready_sq_drivers()) {
+                should_yield = true;
+                COUNTER_UPDATE(_yield_by_preempt_counter, 1);
+                break;
+            }
             if (_workgroup != nullptr &&
                 (time_spent >= YIELD_PREEMPT_MAX_TIME_SPENT_NS ||
                  driver_acct().get_accumulated_local_wait_time_spent() > YIELD_PREEMPT_MAX_TIME_SPENT_NS) &&
@@ -585,6 +596,18 @@ void PipelineDriver::_adjust_memory_usage(RuntimeState* state, MemTracker* track
     // try to release buffer if memusage > mid level threhold
     _try_to_release_buffer(state, op);
 
+    // spill before concurrent queries push the process memory to its limit
+    if (auto* process_tracker = GlobalEnv::GetInstance()->process_mem_tracker(); process_tracker != nullptr) {
+        if (spill::ProcessSpillArbitrator::should_spill(process_tracker->consumption(), process_tracker->limit(),
+                                                        op->revocable_mem_bytes(), state->spill_operator_min_bytes())) {
+            TRACE_SPILL_LOG << "spill operator due to process mem pressure, consumption: "
+                            << process_tracker->consumption() << ", limit: " << process_tracker->limit()
+                            << ", revocable: " << op->revocable_mem_bytes();
+            mem_resource_mgr.to_low_memory_mode();
+            return;
+        }
+    }
+
     // force mark operator to low memory mode
     if (state->spill_revocable_max_bytes() > 0 && op->revocable_mem_bytes() > state->spill_revocable_max_bytes()) {
         mem_resource_mgr.to_low_memory_mode();
@@ -759,6 +782,7 @@ Status PipelineDriver::_mark_operator_finishing(OperatorPtr& op, RuntimeState* s
                                     print_id(state->fragment_instance_id()), to_readable_string(), op->get_name());
     {
         SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(op);
+        SCOPED_SET_SAMPLED_OPERATOR(&op->_name, op->get_plan_node_id());
         SCOPED_TIMER(op->_finishing_timer);
         op_state = OperatorStage::FINISHING;
         QUERY_TRACE_SCOPED(op->get_name(), "set_finishing");
@@ -777,6 +801,7 @@ Status PipelineDriver::_mark_operator_finished(OperatorPtr& op, RuntimeState* st
                                     print_id(state->fragment_instance_id()), to_readable_string(), op->get_name());
     {
         SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(op);
+        SCOPED_SET_SAMPLED_OPERATOR(&op->_name, op->get_plan_node_id());
         SCOPED_TIMER(op->_finished_timer);
         op_state = OperatorStage::FINISHED;
         QUERY_TRACE_SCOPED(op->get_name(), "set_finished");
@@ -800,6 +825,7 @@ Status PipelineDriver::_mark_operator_cancelled(OperatorPtr& op, RuntimeState* s
                                     print_id(state->fragment_instance_id()), to_readable_string(), op->get_name());
     {
         SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(op);
+        SCOPED_SET_SAMPLED_OPERATOR(&op->_name, op->get_plan_node_id());
         op_state = OperatorStage::CANCELLED;
         return op->set_cancelled(state);
     }
@@ -822,6 +848,7 @@ Status PipelineDriver::_mark_operator_closed(OperatorPtr& op, RuntimeState* stat
     VLOG_ROW << msg;
     {
         SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(op);
+        SCOPED_SET_SAMPLED_OPERATOR(&op->_name, op->get_plan_node_id());
         SCOPED_TIMER(op->_close_timer);
         op_state = OperatorStage::CLOSED;
         QUERY_TRACE_SCOPED(op->get_name(), "close");
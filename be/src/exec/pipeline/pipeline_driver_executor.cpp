@@ -16,10 +16,12 @@
 
 #include <memory>
 
+#include "exec/pipeline/driver_sampling_profiler.h"
 #include "exec/pipeline/stream_pipeline_driver.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
@@ -28,11 +30,19 @@
 
 namespace starrocks::pipeline {
 
+static std::unique_ptr<DriverQueue> create_driver_queue(bool enable_resource_group, int num_threads) {
+    auto shared_queue = enable_resource_group ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
+                                              : std::make_unique<QuerySharedDriverQueue>();
+    if (!config::pipeline_enable_work_stealing_driver_queue) {
+        return shared_queue;
+    }
+    return std::make_unique<WorkStealingDriverQueue>(std::move(shared_queue), num_threads);
+}
+
 GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_ptr<ThreadPool> thread_pool,
                                            bool enable_resource_group)
         : Base(name),
-          _driver_queue(enable_resource_group ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
-                                              : std::make_unique<QuerySharedDriverQueue>()),
+          _driver_queue(create_driver_queue(enable_resource_group, thread_pool->max_threads())),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()),
@@ -76,7 +86,13 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
 void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
+    if (config::pipeline_enable_numa_aware_thread_binding) {
+        CpuInfo::bind_current_thread_to_numa_node_of_worker(worker_id);
+    }
     std::queue<DriverRawPtr> local_driver_queue;
+    auto* sampling_profiler = DriverSamplingProfiler::instance();
+    sampling_profiler->register_thread();
+    DeferOp unregister_sampling([sampling_profiler]() { sampling_profiler->unregister_thread(); });
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -85,6 +101,8 @@ void GlobalDriverExecutor::_worker_thread() {
         CurrentThread::current().set_query_id({});
         CurrentThread::current().set_fragment_instance_id({});
         CurrentThread::current().set_pipeline_driver_id(0);
+        CurrentThread::current().set_workgroup_id(-1);
+        sampling_profiler->refresh_thread_timer();
 
         if (current_thread != nullptr) {
             current_thread->set_idle(true);
@@ -109,6 +127,9 @@ void GlobalDriverExecutor::_worker_thread() {
         _schedule_count++;
 
         SCOPED_SET_TRACE_INFO(driver->driver_id(), query_ctx->query_id(), fragment_ctx->fragment_instance_id());
+        if (driver->workgroup() != nullptr) {
+            CurrentThread::current().set_workgroup_id(driver->workgroup()->id());
+        }
 
         SET_THREAD_LOCAL_QUERY_TRACE_CONTEXT(query_ctx->query_trace(), fragment_ctx->fragment_instance_id(), driver);
 
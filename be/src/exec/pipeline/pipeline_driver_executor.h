@@ -63,6 +63,11 @@ public:
 
     virtual size_t calculate_parked_driver(const ImmutableDriverPredicateFunc& predicate_func) const = 0;
 
+    // The accumulated time spent by the worker threads on running drivers and the number of the worker threads,
+    // used to estimate how busy the executor is.
+    virtual int64_t driver_execution_ns() const { return 0; }
+    virtual int32_t num_threads() const { return 0; }
+
 protected:
     std::string _name;
 };
@@ -87,6 +92,9 @@ public:
 
     void report_epoch(ExecEnv* exec_env, QueryContext* query_ctx, std::vector<FragmentContext*> fragment_ctxs) override;
 
+    int64_t driver_execution_ns() const override { return _driver_execution_ns.load(); }
+    int32_t num_threads() const override { return _thread_pool->num_threads(); }
+
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
     void _worker_thread();
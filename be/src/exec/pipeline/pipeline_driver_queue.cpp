@@ -332,6 +332,9 @@ bool WorkGroupDriverQueue::should_yield(const DriverRawPtr driver, int64_t unacc
     if (_throttled(driver->workgroup()->driver_sched_entity(), unaccounted_runtime_ns)) {
         return true;
     }
+    if (!driver->workgroup()->is_sq_wg() && has_ready_sq_drivers()) {
+        return true;
+    }
 
     // Return true, if the minimum-vruntime workgroup is not current workgroup anymore.
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
@@ -340,6 +343,10 @@ bool WorkGroupDriverQueue::should_yield(const DriverRawPtr driver, int64_t unacc
            min_entity->vruntime_ns() < wg_entity->vruntime_ns() + unaccounted_runtime_ns / wg_entity->cpu_limit();
 }
 
+bool WorkGroupDriverQueue::has_ready_sq_drivers() const {
+    return config::pipeline_enable_short_query_preemption && _num_ready_sq_wgs.load(std::memory_order_relaxed) > 0;
+}
+
 bool WorkGroupDriverQueue::_throttled(const workgroup::WorkGroupDriverSchedEntity* wg_entity,
                                       int64_t unaccounted_runtime_ns) const {
     if (wg_entity->is_sq_wg()) {
@@ -381,6 +388,14 @@ void WorkGroupDriverQueue::_update_min_wg() {
 }
 
 workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_take_next_wg() {
+    if (has_ready_sq_drivers()) {
+        for (auto* wg_entity : _wg_entities) {
+            if (wg_entity->is_sq_wg()) {
+                return wg_entity;
+            }
+        }
+    }
+
     workgroup::WorkGroupDriverSchedEntity* min_unthrottled_wg_entity = nullptr;
     for (auto* wg_entity : _wg_entities) {
         if (!_throttled(wg_entity)) {
@@ -414,12 +429,18 @@ void WorkGroupDriverQueue::_enqueue_workgroup(workgroup::WorkGroupDriverSchedEnt
     }
 
     _wg_entities.emplace(wg_entity);
+    if (wg_entity->is_sq_wg()) {
+        ++_num_ready_sq_wgs;
+    }
     _update_min_wg();
 }
 
 void WorkGroupDriverQueue::_dequeue_workgroup(workgroup::WorkGroupDriverSchedEntity* wg_entity) {
     _sum_cpu_limit -= wg_entity->cpu_limit();
     _wg_entities.erase(wg_entity);
+    if (wg_entity->is_sq_wg()) {
+        --_num_ready_sq_wgs;
+    }
     _update_min_wg();
 }
 
@@ -448,4 +469,183 @@ int64_t WorkGroupDriverQueue::_bandwidth_quota_ns() const {
     return BANDWIDTH_CONTROL_PERIOD_NS * workgroup::WorkGroupManager::instance()->normal_workgroup_cpu_hard_limit();
 }
 
+/// WorkStealingDriverQueue.
+namespace {
+std::atomic<uint64_t> next_work_stealing_queue_id = 1;
+
+struct LocalQueueBinding {
+    // The id rather than the address of the queue, since a new queue may reuse the address of a destroyed one.
+    uint64_t queue_id = 0;
+    size_t idx = 0;
+    uint32_t num_local_takes = 0;
+};
+thread_local LocalQueueBinding tls_local_queue_binding;
+} // namespace
+
+WorkStealingDriverQueue::WorkStealingDriverQueue(DriverQueuePtr shared_queue, size_t num_local_queues)
+        : _id(next_work_stealing_queue_id++),
+          _shared_queue(std::move(shared_queue)),
+          _num_local_queues(std::max<size_t>(1, num_local_queues)),
+          _local_queues(new LocalQueue[_num_local_queues]) {}
+
+void WorkStealingDriverQueue::close() {
+    {
+        std::lock_guard<std::mutex> lock(_idle_mutex);
+        _is_closed = true;
+        _idle_cv.notify_all();
+    }
+    _shared_queue->close();
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    _shared_queue->put_back(driver);
+    _notify_idle_threads();
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    _shared_queue->put_back(drivers);
+    _notify_idle_threads();
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    // Give the driver back to the shared queue, if the shared queue prefers the other workgroups,
+    // or the driver is cancelled and should be finalized as soon as possible.
+    if (driver->driver_state() == DriverState::CANCELED || _shared_queue->should_yield(driver, 0)) {
+        _shared_queue->put_back_from_executor(driver);
+        _notify_idle_threads();
+        return;
+    }
+
+    auto& local_queue = _local_queues[_local_queue_idx_of_current_thread()];
+    bool is_kept_local = false;
+    {
+        std::lock_guard<SpinLock> lock(local_queue.lock);
+        if (local_queue.drivers.size() < LOCAL_QUEUE_CAPACITY) {
+            local_queue.drivers.emplace_back(driver);
+            ++_num_local_drivers;
+            is_kept_local = true;
+        }
+    }
+    if (!is_kept_local) {
+        _shared_queue->put_back_from_executor(driver);
+    }
+    _notify_idle_threads();
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take(const bool block) {
+    const size_t idx = _local_queue_idx_of_current_thread();
+    auto& binding = tls_local_queue_binding;
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        // Record the number of puts before searching, so any driver put back afterwards wakes up this thread.
+        const uint64_t num_puts = _num_puts.load();
+
+        const bool prefer_shared =
+                binding.num_local_takes >= LOCAL_TAKE_BATCH_SIZE || _shared_queue->has_ready_sq_drivers();
+        if (!prefer_shared) {
+            if (auto* driver = _pop_local(idx); driver != nullptr) {
+                ++binding.num_local_takes;
+                return driver;
+            }
+        }
+
+        binding.num_local_takes = 0;
+        ASSIGN_OR_RETURN(auto* shared_driver, _shared_queue->take(false));
+        if (shared_driver != nullptr) {
+            return shared_driver;
+        }
+        if (prefer_shared) {
+            if (auto* driver = _pop_local(idx); driver != nullptr) {
+                return driver;
+            }
+        }
+        if (auto* driver = _steal(idx); driver != nullptr) {
+            return driver;
+        }
+
+        if (!block) {
+            return nullptr;
+        }
+
+        std::unique_lock<std::mutex> lock(_idle_mutex);
+        ++_num_idle_threads;
+        _idle_cv.wait_for(lock, std::chrono::nanoseconds(IDLE_WAIT_NS),
+                          [this, num_puts] { return _is_closed || _num_puts.load() != num_puts; });
+        --_num_idle_threads;
+    }
+}
+
+void WorkStealingDriverQueue::cancel(DriverRawPtr driver) {
+    _shared_queue->cancel(driver);
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _shared_queue->update_statistics(driver);
+}
+
+size_t WorkStealingDriverQueue::size() const {
+    return _shared_queue->size() + _num_local_drivers.load();
+}
+
+bool WorkStealingDriverQueue::should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const {
+    return _shared_queue->should_yield(driver, unaccounted_runtime_ns);
+}
+
+size_t WorkStealingDriverQueue::_local_queue_idx_of_current_thread() {
+    auto& binding = tls_local_queue_binding;
+    if (binding.queue_id != _id) {
+        binding.queue_id = _id;
+        binding.idx = _next_local_queue_idx++ % _num_local_queues;
+        binding.num_local_takes = 0;
+    }
+    return binding.idx;
+}
+
+DriverRawPtr WorkStealingDriverQueue::_pop_local(size_t idx) {
+    auto& local_queue = _local_queues[idx];
+    std::lock_guard<SpinLock> lock(local_queue.lock);
+    if (local_queue.drivers.empty()) {
+        return nullptr;
+    }
+    auto* driver = local_queue.drivers.front();
+    local_queue.drivers.pop_front();
+    --_num_local_drivers;
+    return driver;
+}
+
+DriverRawPtr WorkStealingDriverQueue::_steal(size_t self_idx) {
+    if (_num_local_drivers.load() == 0) {
+        return nullptr;
+    }
+    for (size_t i = 1; i < _num_local_queues; ++i) {
+        auto& victim = _local_queues[(self_idx + i) % _num_local_queues];
+        // Skip the busy victims rather than waiting for them.
+        if (!victim.lock.try_lock()) {
+            continue;
+        }
+        DriverRawPtr driver = nullptr;
+        if (!victim.drivers.empty()) {
+            driver = victim.drivers.back();
+            victim.drivers.pop_back();
+            --_num_local_drivers;
+        }
+        victim.lock.unlock();
+        if (driver != nullptr) {
+            return driver;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingDriverQueue::_notify_idle_threads() {
+    ++_num_puts;
+    if (_num_idle_threads.load() > 0) {
+        std::lock_guard<std::mutex> lock(_idle_mutex);
+        _idle_cv.notify_one();
+    }
+}
+
 } // namespace starrocks::pipeline
@@ -19,6 +19,7 @@
 #include "exec/pipeline/pipeline_driver.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "util/factory_method.h"
+#include "util/spinlock.h"
 
 namespace starrocks::pipeline {
 
@@ -46,6 +47,10 @@ public:
     bool empty() const { return size() == 0; }
 
     virtual bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const = 0;
+
+    // Return true, if there are ready drivers of the short-query workgroup waiting in the queue,
+    // which the running drivers of the other workgroups should give way to at the next chunk boundary.
+    virtual bool has_ready_sq_drivers() const { return false; }
 };
 
 // SubQuerySharedDriverQueue is used to store the driver waiting to be executed.
@@ -173,6 +178,8 @@ public:
 
     bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override;
 
+    bool has_ready_sq_drivers() const override;
+
 private:
     /// These methods should be guarded by the outside _global_mutex.
     template <bool from_executor>
@@ -219,6 +226,9 @@ private:
 
     // Cache the minimum entity, used to check should_yield() without lock.
     std::atomic<workgroup::WorkGroupDriverSchedEntity*> _min_wg_entity = nullptr;
+    // The number of short-query workgroups in _wg_entities, used to check has_ready_sq_drivers() without lock.
+    // The short-query workgroups are taken with strict priority over the other workgroups.
+    std::atomic<size_t> _num_ready_sq_wgs = 0;
 
     // Hard bandwidth control to non-short-query workgroups.
     // - The control period is 100ms, and the total quota of non-short-query workgroups is 100ms*(vCPUs-rt_wg.cpu_limit).
@@ -234,4 +244,81 @@ private:
     std::atomic<int64_t> _bandwidth_usage_ns = 0;
 };
 
+// WorkStealingDriverQueue puts a local deque per executor thread in front of a shared DriverQueue
+// (QuerySharedDriverQueue or WorkGroupDriverQueue), to avoid that every take and put_back goes
+// through the mutex and condition variable of the shared queue.
+// - A driver yielded by an executor thread is kept in the local deque of this thread, unless the shared
+//   queue wants to run another workgroup instead, which is decided by shared_queue->should_yield().
+// - Drivers from the poller and new drivers are always put to the shared queue.
+// - An executor thread takes a driver from its local deque first, then from the shared queue,
+//   and finally steals from the tail of the local deques of the other threads.
+// - The shared queue is checked first every LOCAL_TAKE_BATCH_SIZE consecutive local takes,
+//   so that the drivers in the shared queue don't starve.
+// The statistics are still updated to the shared queue, so the fair-share accounting
+// of workgroups and the multilevel feedback levels are preserved.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    WorkStealingDriverQueue(DriverQueuePtr shared_queue, size_t num_local_queues);
+    ~WorkStealingDriverQueue() override = default;
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take(const bool block) override;
+
+    // Only the drivers in the shared queue can be cancelled in advance. The drivers in the local deques
+    // will be taken soon by their own threads, which will find the fragment is cancelled.
+    void cancel(DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    size_t size() const override;
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override;
+
+    bool has_ready_sq_drivers() const override { return _shared_queue->has_ready_sq_drivers(); }
+
+    size_t num_local_queues() const { return _num_local_queues; }
+
+    // The maximum number of drivers in a local deque.
+    static constexpr size_t LOCAL_QUEUE_CAPACITY = 8;
+    static constexpr uint32_t LOCAL_TAKE_BATCH_SIZE = 16;
+
+private:
+    struct alignas(64) LocalQueue {
+        SpinLock lock;
+        std::deque<DriverRawPtr> drivers;
+    };
+
+    // Return the local deque bound to the current thread, bind one if the thread hasn't been bound yet.
+    size_t _local_queue_idx_of_current_thread();
+    DriverRawPtr _pop_local(size_t idx);
+    DriverRawPtr _steal(size_t self_idx);
+    void _notify_idle_threads();
+
+private:
+    // The maximum duration that an idle thread waits for a coming driver,
+    // it is also the maximum delay to pick up the throttled drivers of the shared queue.
+    static constexpr int64_t IDLE_WAIT_NS = 10'000'000L;
+
+    const uint64_t _id;
+    DriverQueuePtr _shared_queue;
+    const size_t _num_local_queues;
+    std::unique_ptr<LocalQueue[]> _local_queues;
+    std::atomic<size_t> _next_local_queue_idx = 0;
+    std::atomic<size_t> _num_local_drivers = 0;
+
+    // Idle threads wait on _idle_cv until _num_puts is changed.
+    std::mutex _idle_mutex;
+    std::condition_variable _idle_cv;
+    std::atomic<int> _num_idle_threads = 0;
+    std::atomic<uint64_t> _num_puts = 0;
+    std::atomic<bool> _is_closed = false;
+};
+
 } // namespace starrocks::pipeline
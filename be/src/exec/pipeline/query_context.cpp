@@ -162,6 +162,29 @@ MemTracker* QueryContext::operator_mem_tracker(int32_t plan_node_id) {
     return mem_tracker.get();
 }
 
+std::shared_ptr<const JoinHashTableItems> QueryContext::get_broadcast_join_build(int32_t plan_node_id) {
+    std::lock_guard<std::mutex> l(_broadcast_join_builds_lock);
+    auto it = _broadcast_join_builds.find(plan_node_id);
+    if (it == _broadcast_join_builds.end()) {
+        return nullptr;
+    }
+    auto build = it->second.lock();
+    if (build == nullptr) {
+        _broadcast_join_builds.erase(it);
+    }
+    return build;
+}
+
+void QueryContext::publish_broadcast_join_build(int32_t plan_node_id,
+                                                const std::shared_ptr<const JoinHashTableItems>& build) {
+    std::lock_guard<std::mutex> l(_broadcast_join_builds_lock);
+    auto& published = _broadcast_join_builds[plan_node_id];
+    // Keep the build published by another fragment instance which is still probed.
+    if (published.expired()) {
+        published = build;
+    }
+}
+
 Status QueryContext::init_spill_manager(const TQueryOptions& query_options) {
     Status st;
     std::call_once(_init_spill_manager_once, [this, &st, &query_options]() {
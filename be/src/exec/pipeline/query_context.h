@@ -37,6 +37,7 @@
 namespace starrocks {
 
 class StreamEpochManager;
+struct JoinHashTableItems;
 
 namespace pipeline {
 
@@ -223,6 +224,11 @@ public:
 
     spill::QuerySpillManager* spill_manager() { return _spill_manager.get(); }
 
+    // The fragment instances of the query on this BE receive the same build rows for a broadcast join, the first one
+    // that builds the hash table of the join publishes its build, and the others share it instead of building.
+    std::shared_ptr<const JoinHashTableItems> get_broadcast_join_build(int32_t plan_node_id);
+    void publish_broadcast_join_build(int32_t plan_node_id, const std::shared_ptr<const JoinHashTableItems>& build);
+
     void mark_prepared() { _is_prepared = true; }
     bool is_prepared() { return _is_prepared; }
 
@@ -300,6 +306,10 @@ private:
 
     std::unique_ptr<spill::QuerySpillManager> _spill_manager;
 
+    std::mutex _broadcast_join_builds_lock;
+    // Not owned, a build is released once no fragment instance probes it.
+    std::unordered_map<int32_t, std::weak_ptr<const JoinHashTableItems>> _broadcast_join_builds;
+
     int64_t _static_query_mem_limit = 0;
     ConnectorScanOperatorMemShareArbitrator* _connector_scan_operator_mem_share_arbitrator = nullptr;
 };
@@ -16,11 +16,13 @@
 
 #include <random>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/pipeline/scan/balanced_chunk_buffer.h"
 #include "exec/pipeline/scan/scan_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 namespace starrocks::pipeline {
 
 ChunkSource::ChunkSource(ScanOperator* scan_op, RuntimeProfile* runtime_profile, MorselPtr&& morsel,
@@ -55,6 +57,8 @@ Status ChunkSource::buffer_next_batch_chunks_blocking(RuntimeState* state, size_
 
     int64_t time_spent_ns = 0;
     auto [owner_id, version] = _morsel->get_lane_owner_and_version();
+    io::RemoteIOTrace::Scope trace_scope(config::enable_remote_io_trace ? &_remote_io_trace : nullptr);
+    DeferOp flush_trace([this]() { _flush_remote_io_trace(); });
     for (size_t i = 0; i < batch_size && !state->is_cancelled(); ++i) {
         {
             SCOPED_RAW_TIMER(&time_spent_ns);
@@ -99,4 +103,45 @@ Status ChunkSource::buffer_next_batch_chunks_blocking(RuntimeState* state, size_
     return _status;
 }
 
+void ChunkSource::_flush_remote_io_trace() {
+    if (_remote_io_trace.empty()) {
+        return;
+    }
+    for (int i = 0; i < io::RemoteIOTrace::NUM_SOURCES; i++) {
+        auto source = static_cast<io::RemoteIOTrace::Source>(i);
+        const auto& stats = _remote_io_trace.stats(source);
+        if (stats.requests == 0) {
+            continue;
+        }
+        const std::string parent = std::string("RemoteIO") + io::RemoteIOTrace::source_name(source);
+        ADD_COUNTER(_runtime_profile, parent, TUnit::NONE);
+        COUNTER_UPDATE(ADD_CHILD_COUNTER(_runtime_profile, parent + "Requests", TUnit::UNIT, parent), stats.requests);
+        COUNTER_UPDATE(ADD_CHILD_COUNTER(_runtime_profile, parent + "Bytes", TUnit::BYTES, parent), stats.bytes);
+        COUNTER_UPDATE(ADD_CHILD_TIMER(_runtime_profile, parent + "Time", parent), stats.latency_ns);
+        if (stats.extra_requests > 0) {
+            COUNTER_UPDATE(ADD_CHILD_COUNTER(_runtime_profile, parent + "ExtraRequests", TUnit::UNIT, parent),
+                           stats.extra_requests);
+        }
+        if (stats.failures > 0) {
+            COUNTER_UPDATE(ADD_CHILD_COUNTER(_runtime_profile, parent + "Failures", TUnit::UNIT, parent),
+                           stats.failures);
+        }
+        // Only the non-empty buckets are shown, the counters of the same name are summed when merging the profiles
+        // of drivers.
+        for (int bucket = 0; bucket < io::RemoteIOTrace::kNumBuckets; bucket++) {
+            if (stats.size_histogram[bucket] > 0) {
+                const std::string name = parent + "Size_" + io::RemoteIOTrace::size_bucket_name(bucket);
+                COUNTER_UPDATE(ADD_CHILD_COUNTER(_runtime_profile, name, TUnit::UNIT, parent),
+                               stats.size_histogram[bucket]);
+            }
+            if (stats.latency_histogram[bucket] > 0) {
+                const std::string name = parent + "Latency_" + io::RemoteIOTrace::latency_bucket_name(bucket);
+                COUNTER_UPDATE(ADD_CHILD_COUNTER(_runtime_profile, name, TUnit::UNIT, parent),
+                               stats.latency_histogram[bucket]);
+            }
+        }
+    }
+    _remote_io_trace.reset();
+}
+
 } // namespace starrocks::pipeline
\ No newline at end of file
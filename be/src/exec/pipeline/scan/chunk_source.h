@@ -20,6 +20,7 @@
 #include "common/statusor.h"
 #include "exec/pipeline/scan/morsel.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "io/remote_io_trace.h"
 #include "util/exclusive_ptr.h"
 
 namespace starrocks {
@@ -80,6 +81,9 @@ protected:
     // The schedule entity of this workgroup for resource group.
     virtual const workgroup::WorkGroupScanSchedEntity* _scan_sched_entity(const workgroup::WorkGroup* wg) const = 0;
 
+    // Add the remote requests traced since the last flush to the runtime profile.
+    void _flush_remote_io_trace();
+
     ScanOperator* _scan_op;
     const int32_t _scan_operator_seq;
     RuntimeProfile* _runtime_profile;
@@ -96,6 +100,7 @@ protected:
     Status _status = Status::OK();
     ChunkBufferTokenPtr _chunk_token;
     std::atomic<bool> _reach_limit = false;
+    io::RemoteIOTrace _remote_io_trace;
 
 private:
     // _scan_timer = _io_task_wait_timer + _io_task_exec_timer
@@ -767,6 +767,7 @@ Status ConnectorChunkSource::_open_data_source(RuntimeState* state, bool* mem_al
     } else {
         _ck_acc.set_max_size(state->chunk_size());
     }
+    _ck_acc.set_max_bytes(ChunkHelper::target_chunk_bytes());
 
     _opened = true;
 
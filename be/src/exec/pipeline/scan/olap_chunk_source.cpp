@@ -14,13 +14,16 @@
 
 #include "exec/pipeline/scan/olap_chunk_source.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <string_view>
 #include <unordered_map>
 
 #include "column/column.h"
 #include "column/column_access_path.h"
 #include "column/field.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/olap_scan_node.h"
 #include "exec/olap_scan_prepare.h"
@@ -39,7 +42,9 @@
 #include "storage/olap_runtime_range_pruner.hpp"
 #include "storage/predicate_parser.h"
 #include "storage/projection_iterator.h"
+#include "storage/shared_scan.h"
 #include "storage/storage_engine.h"
+#include "storage/vector_search_option.h"
 #include "types/logical_type.h"
 #include "util/runtime_profile.h"
 
@@ -53,6 +58,26 @@ OlapChunkSource::OlapChunkSource(ScanOperator* op, RuntimeProfile* runtime_profi
           _limit(scan_node->limit()),
           _scan_range(down_cast<ScanMorsel*>(_morsel.get())->get_olap_scan_range()) {}
 
+static StatusOr<VectorSearchOptionPtr> to_vector_search_option(const TVectorSearchOptions& options,
+                                                               const TabletSchema& tablet_schema) {
+    const int32_t index = tablet_schema.field_index(options.vector_column_name);
+    if (index < 0) {
+        return Status::InvalidArgument(fmt::format("vector search column {} not found", options.vector_column_name));
+    }
+    if (options.k <= 0 || options.k > std::numeric_limits<uint32_t>::max()) {
+        return Status::InvalidArgument(fmt::format("invalid k of vector search: {}", options.k));
+    }
+    auto option = std::make_shared<VectorSearchOption>();
+    option->column_uid = tablet_schema.column(index).unique_id();
+    option->query_vector.assign(options.query_vector.begin(), options.query_vector.end());
+    ASSIGN_OR_RETURN(option->metric, vector_metric_from_string(options.metric_type));
+    option->k = static_cast<uint32_t>(options.k);
+    if (options.__isset.ef_search && options.ef_search > 0) {
+        option->ef_search = options.ef_search;
+    }
+    return option;
+}
+
 OlapChunkSource::~OlapChunkSource() {
     _reader.reset();
     _predicate_free_pool.clear();
@@ -68,6 +93,7 @@ void OlapChunkSource::close(RuntimeState* state) {
     if (_reader) {
         _reader.reset();
     }
+    _shared_scan_iter.reset();
     _predicate_free_pool.clear();
 }
 
@@ -132,6 +158,9 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _bf_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BloomFilterFilterRows", TUnit::UNIT, segment_init_name);
     _gin_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "GinFilterRows", TUnit::UNIT, segment_init_name);
     _gin_filtered_timer = ADD_CHILD_TIMER(_runtime_profile, "GinFilter", segment_init_name);
+    _vector_index_filtered_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "VectorIndexFilterRows", TUnit::UNIT, segment_init_name);
+    _vector_index_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "VectorIndexFilter", segment_init_name);
     _seg_zm_filtered_counter =
             ADD_CHILD_COUNTER_SKIP_MIN_MAX(_runtime_profile, "SegmentZoneMapFilterRows", TUnit::UNIT,
                                            _get_counter_min_max_type("SegmentZoneMapFilterRows"), segment_init_name);
@@ -219,6 +248,23 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
 
     ASSIGN_OR_RETURN(auto pred_tree, _scan_ctx->conjuncts_manager().get_predicate_tree(parser, _predicate_free_pool));
     _decide_chunk_size(!pred_tree.empty());
+    // The vector index only finds the nearest rows of the scan if nothing else filters the rows.
+    if (thrift_olap_scan_node.__isset.vector_search_options && pred_tree.empty() &&
+        _scan_ctx->not_push_down_conjuncts().empty() && _scan_node->runtime_filter_collector().empty()) {
+        ASSIGN_OR_RETURN(_params.vector_search,
+                         to_vector_search_option(thrift_olap_scan_node.vector_search_options, *_tablet_schema));
+    }
+    _shared_scan = _can_share_scan(pred_tree, key_ranges);
+    if (_shared_scan) {
+        // The storage read shared with other scans has no predicate, all of them are evaluated on its chunks.
+        for (const auto& [_, col_nodes] : pred_tree.root().col_children_map()) {
+            for (const auto& col_node : col_nodes) {
+                _not_push_down_predicates.add(col_node.col_pred());
+            }
+        }
+        pred_tree = PredicateTree();
+    }
+
     PredicateAndNode pushdown_pred_root;
     PredicateAndNode non_pushdown_pred_root;
     pred_tree.root().partition_copy([parser](const auto& node) { return parser->can_pushdown(node); },
@@ -273,6 +319,61 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     return Status::OK();
 }
 
+bool OlapChunkSource::_can_share_scan(const PredicateTree& pred_tree,
+                                      const std::vector<std::unique_ptr<OlapScanRange>>& key_ranges) const {
+    // Only the scans reading every row of a tablet in any order, without anything the storage must evaluate
+    // by itself, can share the storage read.
+    if (!config::enable_shared_scan || _tablet->keys_type() != DUP_KEYS || _limit != -1 || _params.use_pk_index ||
+        _params.sorted_by_keys_per_tablet || _params.vector_search != nullptr ||
+        _params.rowid_range_option != nullptr || _params.short_key_ranges_option != nullptr ||
+        _morsel->get_olap_scan_range()->__isset.gtid) {
+        return false;
+    }
+    if (!_params.global_dictmaps->empty() || !_unused_output_column_ids.empty() ||
+        !_scan_ctx->column_access_paths()->empty() || !pred_tree.root().compound_children().empty()) {
+        return false;
+    }
+    return std::all_of(key_ranges.begin(), key_ranges.end(), [](const auto& key_range) {
+        return key_range->begin_scan_range.size() == 1 &&
+               key_range->begin_scan_range.get_value(0) == NEGATIVE_INFINITY;
+    });
+}
+
+StatusOr<std::shared_ptr<SharedScanIterator>> OlapChunkSource::_new_shared_scan_iterator(
+        const Schema& schema, const std::vector<RowsetSharedPtr>& rowsets) {
+    const Version version(_morsel->from_version(), _version);
+    // Everything deciding the chunks of the storage read.
+    std::string key = fmt::format("{}:{}:{}:{}:{}:{}:{}", _tablet->tablet_id(), _tablet_schema->schema_version(),
+                                  version.first, version.second, _params.skip_aggregation, _params.use_page_cache,
+                                  _params.chunk_size);
+    for (const auto& field : schema.fields()) {
+        key.append(fmt::format(":{}", field->uid()));
+    }
+    for (const auto& rowset : rowsets) {
+        key.append(":").append(rowset->rowset_id_str());
+    }
+
+    SharedScanPassFactory factory = [tablet = _tablet, version, schema, rowsets, tablet_schema = _tablet_schema,
+                                     skip_aggregation = _params.skip_aggregation,
+                                     use_page_cache = _params.use_page_cache,
+                                     chunk_size = _params.chunk_size]() -> StatusOr<ChunkIteratorPtr> {
+        // Not bound to any query, so neither runtime state nor profile.
+        TabletReaderParams params;
+        params.is_pipeline = true;
+        params.reader_type = READER_QUERY;
+        params.skip_aggregation = skip_aggregation;
+        params.use_page_cache = use_page_cache;
+        params.chunk_size = chunk_size;
+        auto reader = std::make_shared<TabletReader>(tablet, version, schema, rowsets, &tablet_schema);
+        RETURN_IF_ERROR(reader->prepare());
+        RETURN_IF_ERROR(reader->open(params));
+        return reader;
+    };
+    auto stream = SharedScanManager::instance()->get_or_create(key, factory,
+                                                               GlobalEnv::GetInstance()->query_pool_mem_tracker());
+    return std::make_shared<SharedScanIterator>(schema, _params.chunk_size, std::move(stream));
+}
+
 Status OlapChunkSource::_init_scanner_columns(std::vector<uint32_t>& scanner_columns) {
     for (auto slot : *_slots) {
         DCHECK(slot->is_materialized());
@@ -409,6 +510,7 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     std::vector<uint32_t> reader_columns;
 
     RETURN_IF_ERROR(_get_tablet(_scan_range));
+    _tablet->record_query_scan();
 
     auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _scan_range->tablet_id);
 
@@ -436,14 +538,25 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
         rowsets.emplace_back(std::dynamic_pointer_cast<Rowset>(rowset));
     }
 
+    ChunkIteratorPtr storage_iter;
+    if (_shared_scan) {
+        ASSIGN_OR_RETURN(_shared_scan_iter, _new_shared_scan_iterator(child_schema, rowsets));
+        storage_iter = _shared_scan_iter;
+        _shared_scan_rows_counter = ADD_COUNTER(_runtime_profile, "SharedScanRows", TUnit::UNIT);
+        _shared_scan_private_rows_counter = ADD_COUNTER(_runtime_profile, "SharedScanPrivateRows", TUnit::UNIT);
+    }
+    // In a shared scan, |_reader| is only prepared to hold the rowsets and is never opened.
     _reader = std::make_shared<TabletReader>(_tablet, Version(_morsel->from_version(), _version),
                                              std::move(child_schema), std::move(rowsets), &_tablet_schema);
     _reader->set_use_gtid(_morsel->get_olap_scan_range()->__isset.gtid);
+    if (storage_iter == nullptr) {
+        storage_iter = _reader;
+    }
     if (reader_columns.size() == scanner_columns.size()) {
-        _prj_iter = _reader;
+        _prj_iter = storage_iter;
     } else {
         starrocks::Schema output_schema = ChunkHelper::convert_schema(_tablet_schema, scanner_columns);
-        _prj_iter = new_projection_iterator(output_schema, _reader);
+        _prj_iter = new_projection_iterator(output_schema, storage_iter);
     }
 
     if (!_scan_ctx->not_push_down_conjuncts().empty() || !_not_push_down_predicates.empty()) {
@@ -456,7 +569,9 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     _reader->set_is_asc_hint(_scan_op->is_asc());
 
     RETURN_IF_ERROR(_reader->prepare());
-    RETURN_IF_ERROR(_reader->open(_params));
+    if (!_shared_scan) {
+        RETURN_IF_ERROR(_reader->open(_params));
+    }
 
     return Status::OK();
 }
@@ -478,6 +593,8 @@ Status OlapChunkSource::_init_global_dicts(TabletReaderParams* params) {
     const TOlapScanNode& thrift_olap_scan_node = _scan_node->thrift_olap_scan_node();
     const auto& global_dict_map = _runtime_state->get_query_global_dict_map();
     auto global_dict = _obj_pool.add(new ColumnIdToGlobalDictMap());
+    auto global_dict_versions = _obj_pool.add(new ColumnIdToGlobalDictVersion());
+    const auto& query_dict_versions = _runtime_state->query_dict_versions();
     // mapping column id to storage column ids
     const TupleDescriptor* tuple_desc = _runtime_state->desc_tbl().get_tuple_descriptor(thrift_olap_scan_node.tuple_id);
     for (auto slot : tuple_desc->slots()) {
@@ -490,9 +607,13 @@ Status OlapChunkSource::_init_global_dicts(TabletReaderParams* params) {
             int32_t index = _tablet_schema->field_index(slot->col_name());
             DCHECK(index >= 0);
             global_dict->emplace(index, const_cast<GlobalDictMap*>(&dict_map));
+            if (auto version = query_dict_versions.find(slot->id()); version != query_dict_versions.end()) {
+                global_dict_versions->emplace(index, version->second);
+            }
         }
     }
     params->global_dictmaps = global_dict;
+    params->global_dict_versions = global_dict_versions;
 
     return Status::OK();
 }
@@ -558,6 +679,10 @@ void OlapChunkSource::_update_realtime_counter(Chunk* chunk) {
 void OlapChunkSource::_update_counter() {
     COUNTER_UPDATE(_create_seg_iter_timer, _reader->stats().create_segment_iter_ns);
     COUNTER_UPDATE(_rows_read_counter, _num_rows_read);
+    if (_shared_scan_iter != nullptr) {
+        COUNTER_UPDATE(_shared_scan_rows_counter, _shared_scan_iter->shared_rows());
+        COUNTER_UPDATE(_shared_scan_private_rows_counter, _shared_scan_iter->private_rows());
+    }
 
     COUNTER_UPDATE(_io_timer, _reader->stats().io_ns);
     COUNTER_UPDATE(_read_compressed_counter, _reader->stats().compressed_bytes_read_request);
@@ -609,6 +734,8 @@ void OlapChunkSource::_update_counter() {
     COUNTER_UPDATE(_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
     COUNTER_UPDATE(_gin_filtered_counter, _reader->stats().rows_gin_filtered);
     COUNTER_UPDATE(_gin_filtered_timer, _reader->stats().gin_index_filter_ns);
+    COUNTER_UPDATE(_vector_index_filtered_counter, _reader->stats().rows_vector_index_filtered);
+    COUNTER_UPDATE(_vector_index_filter_timer, _reader->stats().vector_index_filter_ns);
     COUNTER_UPDATE(_block_seek_counter, _reader->stats().block_seek_num);
 
     COUNTER_UPDATE(_rowsets_read_count, _reader->stats().rowsets_read_count);
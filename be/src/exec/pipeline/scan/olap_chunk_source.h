@@ -27,6 +27,7 @@
 #include "runtime/runtime_state.h"
 #include "storage/conjunctive_predicates.h"
 #include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/shared_scan.h"
 #include "storage/tablet.h"
 #include "storage/tablet_reader.h"
 #include "util/runtime_profile.h"
@@ -61,6 +62,10 @@ private:
     Status _init_scanner_columns(std::vector<uint32_t>& scanner_columns);
     Status _init_unused_output_columns(const std::vector<std::string>& unused_output_columns);
     Status _init_olap_reader(RuntimeState* state);
+    bool _can_share_scan(const PredicateTree& pred_tree,
+                         const std::vector<std::unique_ptr<OlapScanRange>>& key_ranges) const;
+    StatusOr<std::shared_ptr<SharedScanIterator>> _new_shared_scan_iterator(
+            const Schema& schema, const std::vector<RowsetSharedPtr>& rowsets);
     TCounterMinMaxType::type _get_counter_min_max_type(const std::string& metric_name);
     void _init_counter(RuntimeState* state);
     Status _init_global_dicts(TabletReaderParams* params);
@@ -99,6 +104,9 @@ private:
     std::shared_ptr<TabletReader> _reader;
     // projection iterator, doing the job of choosing |_scanner_columns| from |_reader_columns|.
     std::shared_ptr<ChunkIterator> _prj_iter;
+    // Whether the storage read is shared with the concurrent scans of the same rows, see SharedScanStream.
+    bool _shared_scan = false;
+    std::shared_ptr<SharedScanIterator> _shared_scan_iter;
 
     std::unordered_set<uint32_t> _unused_output_column_ids;
 
@@ -151,6 +159,8 @@ private:
     RuntimeProfile::Counter* _bi_filter_timer = nullptr;
     RuntimeProfile::Counter* _gin_filtered_counter = nullptr;
     RuntimeProfile::Counter* _gin_filtered_timer = nullptr;
+    RuntimeProfile::Counter* _vector_index_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _vector_index_filter_timer = nullptr;
     RuntimeProfile::Counter* _pushdown_predicates_counter = nullptr;
     RuntimeProfile::Counter* _rowsets_read_count = nullptr;
     RuntimeProfile::Counter* _segments_read_count = nullptr;
@@ -160,6 +170,8 @@ private:
     RuntimeProfile::Counter* _json_flatten_timer = nullptr;
     RuntimeProfile::Counter* _access_path_hits_counter = nullptr;
     RuntimeProfile::Counter* _access_path_unhits_counter = nullptr;
+    RuntimeProfile::Counter* _shared_scan_rows_counter = nullptr;
+    RuntimeProfile::Counter* _shared_scan_private_rows_counter = nullptr;
 };
 } // namespace pipeline
 } // namespace starrocks
@@ -282,6 +282,21 @@ int64_t ScanOperator::global_rf_wait_timeout_ns() const {
 
     return 1000'000L * global_rf_collector->scan_wait_timeout_ms();
 }
+int ScanOperator::available_pickup_morsel_count() {
+    if (!config::enable_scan_elastic_io_tasks || _scan_executor == nullptr) {
+        return _io_tasks_per_scan_operator;
+    }
+    // When the scan executor is overloaded, shrink the io tasks of this operator in proportion, and leave
+    // the remaining morsels of the shared morsel queue to the other drivers. The running io tasks beyond
+    // the new count just aren't rescheduled after they finish.
+    const int64_t num_threads = std::max(1, _scan_executor->num_threads());
+    const int64_t num_queued_tasks = _scan_executor->num_queued_tasks();
+    if (num_queued_tasks <= num_threads) {
+        return _io_tasks_per_scan_operator;
+    }
+    return std::max<int64_t>(1, _io_tasks_per_scan_operator * num_threads / num_queued_tasks);
+}
+
 Status ScanOperator::_try_to_trigger_next_scan(RuntimeState* state) {
     // to sure to put it here for updating state.
     // because we want to update state based on raw data.
@@ -364,6 +379,9 @@ void ScanOperator::_finish_chunk_source_task(RuntimeState* state, int chunk_sour
     _last_scan_rows_num += scan_rows;
     _last_scan_bytes += scan_bytes;
     _num_running_io_tasks--;
+    if (_workgroup != nullptr) {
+        _workgroup->incr_io_bytes(scan_bytes);
+    }
 
     DCHECK(_chunk_sources[chunk_source_index] != nullptr);
     {
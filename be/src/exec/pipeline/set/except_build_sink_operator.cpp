@@ -14,6 +14,11 @@
 
 #include "exec/pipeline/set/except_build_sink_operator.h"
 
+#include "exec/spill/executor.h"
+#include "exec/spill/spiller.hpp"
+#include "gen_cpp/InternalService_types.h"
+#include "util/defer_op.h"
+
 namespace starrocks::pipeline {
 
 StatusOr<ChunkPtr> ExceptBuildSinkOperator::pull_chunk(RuntimeState* state) {
@@ -21,14 +26,61 @@ StatusOr<ChunkPtr> ExceptBuildSinkOperator::pull_chunk(RuntimeState* state) {
 }
 
 Status ExceptBuildSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
-    return _except_ctx->append_chunk_to_ht(state, chunk, _dst_exprs, _buffer_state.get());
+    if (_spill_strategy == spill::SpillStrategy::NO_SPILL) {
+        RETURN_IF_ERROR(_except_ctx->append_chunk_to_ht(state, chunk, _dst_exprs, _buffer_state.get()));
+        if (spillable()) {
+            set_revocable_mem_bytes(_except_ctx->hash_set_mem_usage(_buffer_state.get()));
+        }
+        return Status::OK();
+    }
+
+    // need_input() makes sure the spiller has room for the chunk, which is spilled before the hash set is dumped.
+    RETURN_IF_ERROR(_except_ctx->spill_chunk(state, _spiller, chunk, _dst_exprs, 0));
+    return _spill_hash_set_if_needed(state);
+}
+
+Status ExceptBuildSinkOperator::set_finishing(RuntimeState* state) {
+    ONCE_DETECT(_set_finishing_once);
+    auto defer_set_finishing = DeferOp([this]() {
+        if (_spill_channel != nullptr) {
+            _spill_channel->set_finishing();
+        }
+    });
+
+    RETURN_IF_ERROR(_spill_hash_set_if_needed(state));
+    RETURN_IF_ERROR(_build_runtime_filters(state));
+    if (!_except_ctx->is_spilled()) {
+        _except_ctx->finish_build_ht();
+        _is_finished = true;
+        return Status::OK();
+    }
+
+    // The PROBEs start once the rest of the hash set is dumped, without waiting for the flush.
+    SpillProcessTasksBuilder task_builder(state);
+    task_builder.then([this](RuntimeState* state) { return _except_ctx->spiller()->flush(state, _spiller); })
+            .finally([this](RuntimeState* state) {
+                _except_ctx->finish_build_ht();
+                _is_finished = true;
+                return Status::OK();
+            });
+    return _spill_channel->execute(task_builder);
 }
 
 Status ExceptBuildSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
 
     RETURN_IF_ERROR(_except_ctx->prepare(state, _dst_exprs));
+    if (_spiller != nullptr) {
+        _spiller->set_metrics(spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes()));
+        RETURN_IF_ERROR(_spiller->prepare(state));
+    }
     RETURN_IF_ERROR(_buffer_state->init(state));
+    if (_rf_builder != nullptr) {
+        _rf_builder->incr_builder();
+    }
+    if (spillable() && state->spill_mode() == TSpillMode::FORCE) {
+        _spill_strategy = spill::SpillStrategy::SPILL_ALL;
+    }
 
     return Status::OK();
 }
@@ -39,12 +91,57 @@ void ExceptBuildSinkOperator::close(RuntimeState* state) {
     Operator::close(state);
 }
 
+Status ExceptBuildSinkOperator::_spill_hash_set_if_needed(RuntimeState* state) {
+    if (_spill_strategy == spill::SpillStrategy::NO_SPILL || _except_ctx->is_spilled()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_except_ctx->spill_hash_set(state, _spiller, _spill_channel));
+    set_revocable_mem_bytes(0);
+    return Status::OK();
+}
+
+Status ExceptBuildSinkOperator::_build_runtime_filters(RuntimeState* state) {
+    if (_rf_builder == nullptr) {
+        return Status::OK();
+    }
+    // The keys of a spilled partition are unknown until it's restored.
+    if (_except_ctx->is_spilled()) {
+        return _rf_builder->set_always_true(state, runtime_filter_hub());
+    }
+
+    const size_t num_rows = _except_ctx->hash_set_size();
+    Columns key_columns;
+    if (_rf_builder->need_key_columns(num_rows)) {
+        key_columns = _except_ctx->build_key_columns();
+    }
+    return _rf_builder->add_partial_filters(state, runtime_filter_hub(), _driver_sequence, num_rows, key_columns);
+}
+
+OperatorPtr ExceptBuildSinkOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
+    auto except_ctx = _except_partition_ctx_factory->get_or_create(driver_sequence);
+    std::shared_ptr<spill::Spiller> spiller;
+    SpillProcessChannelPtr spill_channel;
+    if (_spill_options != nullptr) {
+        spiller = _spill_factory->create(*_spill_options);
+        spill_channel = _spill_channel_factory->get_or_create(driver_sequence);
+        spill_channel->set_spiller(spiller);
+        auto set_operation_spiller = std::make_shared<SetOperationSpiller>();
+        set_operation_spiller->add_spiller(0, spiller);
+        except_ctx->set_spiller(std::move(set_operation_spiller));
+    }
+    return std::make_shared<ExceptBuildSinkOperator>(this, _id, _plan_node_id, driver_sequence, std::move(except_ctx),
+                                                     _dst_exprs, _rf_builder, std::move(spiller),
+                                                     std::move(spill_channel));
+}
+
 Status ExceptBuildSinkOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorFactory::prepare(state));
 
     RETURN_IF_ERROR(Expr::prepare(_dst_exprs, state));
     RETURN_IF_ERROR(Expr::open(_dst_exprs, state));
 
+    _spill_options = SetOperationSpiller::create_spill_options(state, _plan_node_id, "except-build");
+
     return Status::OK();
 }
 
@@ -16,6 +16,9 @@
 
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/set/except_context.h"
+#include "exec/pipeline/set/set_operation_runtime_filter.h"
+#include "exec/pipeline/spill_process_channel.h"
+#include "exec/spill/spiller_factory.h"
 #include "util/race_detect.h"
 
 namespace starrocks::pipeline {
@@ -36,29 +39,45 @@ namespace starrocks::pipeline {
 // The rows are shuffled to degree of parallelism (DOP) partitions by local shuffle exchange.
 // For each partition, there are a ExceptBuildSinkOperator driver, a ExceptProbeSinkOperator driver
 // for each child, and a ExceptOutputSourceOperator.
+//
+// If spill is enabled, ExceptBuildSinkOperator is spillable. When it's asked to release memory, the hash set of
+// its partition is dumped by the spill process operator, and the following rows of all the children are spilled.
+// See ExceptContext for details.
+//
+// ExceptBuildSinkOperator also builds runtime filters from the keys of the hash set, which are pushed down to
+// the other children, since a row whose keys aren't in the first child can't erase anything.
 class ExceptBuildSinkOperator final : public Operator {
 public:
     ExceptBuildSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-                            std::shared_ptr<ExceptContext> except_ctx, const std::vector<ExprContext*>& dst_exprs)
+                            std::shared_ptr<ExceptContext> except_ctx, const std::vector<ExprContext*>& dst_exprs,
+                            SetOperationRuntimeFilterBuilderPtr rf_builder, std::shared_ptr<spill::Spiller> spiller,
+                            SpillProcessChannelPtr spill_channel)
             : Operator(factory, id, "except_build_sink", plan_node_id, false, driver_sequence),
               _except_ctx(std::move(except_ctx)),
               _buffer_state(std::make_unique<ExceptBufferState>()),
-              _dst_exprs(dst_exprs) {
+              _dst_exprs(dst_exprs),
+              _rf_builder(std::move(rf_builder)),
+              _spiller(std::move(spiller)),
+              _spill_channel(std::move(spill_channel)) {
         _except_ctx->ref();
     }
 
-    bool need_input() const override { return !is_finished(); }
+    bool need_input() const override {
+        if (is_finished()) {
+            return false;
+        }
+        // The spiller mustn't be full when a chunk is spilled, and the hash set is dumped before the following rows.
+        return !_except_ctx->is_spilled() || !(_spiller->is_full() || _spill_channel->has_task());
+    }
 
     bool has_output() const override { return false; }
 
     bool is_finished() const override { return _is_finished || _except_ctx->is_finished(); }
 
-    Status set_finishing(RuntimeState* state) override {
-        ONCE_DETECT(_set_finishing_once);
-        _is_finished = true;
-        _except_ctx->finish_build_ht();
-        return Status::OK();
-    }
+    Status set_finishing(RuntimeState* state) override;
+
+    bool spillable() const override { return _spiller != nullptr; }
+    void set_execute_mode(int performance_level) override { _spill_strategy = spill::SpillStrategy::SPILL_ALL; }
 
     Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
@@ -68,12 +87,21 @@ public:
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
 
 private:
+    Status _spill_hash_set_if_needed(RuntimeState* state);
+    Status _build_runtime_filters(RuntimeState* state);
+
     std::shared_ptr<ExceptContext> _except_ctx;
     std::unique_ptr<ExceptBufferState> _buffer_state;
 
     const std::vector<ExprContext*>& _dst_exprs;
-
-    bool _is_finished = false;
+    SetOperationRuntimeFilterBuilderPtr _rf_builder;
+
+    // Only set if spill is enabled.
+    std::shared_ptr<spill::Spiller> _spiller;
+    SpillProcessChannelPtr _spill_channel;
+    spill::SpillStrategy _spill_strategy = spill::SpillStrategy::NO_SPILL;
+    // Set after the spilled rows are flushed in spill mode.
+    std::atomic<bool> _is_finished{false};
     DECLARE_ONCE_DETECTOR(_set_finishing_once);
 };
 
@@ -81,16 +109,16 @@ class ExceptBuildSinkOperatorFactory final : public OperatorFactory {
 public:
     ExceptBuildSinkOperatorFactory(int32_t id, int32_t plan_node_id,
                                    ExceptPartitionContextFactoryPtr except_partition_ctx_factory,
-                                   const std::vector<ExprContext*>& dst_exprs)
+                                   const std::vector<ExprContext*>& dst_exprs,
+                                   SetOperationRuntimeFilterBuilderPtr rf_builder,
+                                   SpillProcessChannelFactoryPtr spill_channel_factory)
             : OperatorFactory(id, "except_build_sink", plan_node_id),
               _except_partition_ctx_factory(std::move(except_partition_ctx_factory)),
-              _dst_exprs(dst_exprs) {}
+              _dst_exprs(dst_exprs),
+              _rf_builder(std::move(rf_builder)),
+              _spill_channel_factory(std::move(spill_channel_factory)) {}
 
-    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
-        return std::make_shared<ExceptBuildSinkOperator>(this, _id, _plan_node_id, driver_sequence,
-                                                         _except_partition_ctx_factory->get_or_create(driver_sequence),
-                                                         _dst_exprs);
-    }
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
 
     Status prepare(RuntimeState* state) override;
 
@@ -100,6 +128,12 @@ private:
     ExceptPartitionContextFactoryPtr _except_partition_ctx_factory;
 
     const std::vector<ExprContext*>& _dst_exprs;
+    SetOperationRuntimeFilterBuilderPtr _rf_builder;
+    SpillProcessChannelFactoryPtr _spill_channel_factory;
+
+    // Only set if spill is enabled.
+    std::shared_ptr<spill::SpilledOptions> _spill_options;
+    std::shared_ptr<spill::SpillerFactory> _spill_factory = std::make_shared<spill::SpillerFactory>();
 };
 
 } // namespace starrocks::pipeline
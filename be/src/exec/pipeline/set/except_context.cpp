@@ -14,6 +14,8 @@
 
 #include "exec/pipeline/set/except_context.h"
 
+#include "exec/spill/executor.h"
+#include "exec/spill/spiller.hpp"
 #include "runtime/current_thread.h"
 
 namespace starrocks::pipeline {
@@ -29,6 +31,9 @@ Status ExceptContext::prepare(RuntimeState* state, const std::vector<ExprContext
     for (auto build_expr : build_exprs) {
         _dst_nullables.emplace_back(build_expr->root()->is_nullable());
     }
+    if (_spiller != nullptr) {
+        RETURN_IF_ERROR(_spiller->prepare(state, _dst_tuple_desc));
+    }
 
     return Status::OK();
 }
@@ -38,6 +43,10 @@ void ExceptContext::close(RuntimeState* state) {
     if (_build_pool != nullptr) {
         _build_pool->free_all();
     }
+    _restore_buffer_state.reset();
+    if (_spiller != nullptr) {
+        _spiller->close(state);
+    }
 }
 
 void ExceptContext::incr_prober(size_t factory_idx) {
@@ -71,6 +80,13 @@ Status ExceptContext::erase_chunk_from_ht(RuntimeState* state, const ChunkPtr& c
 }
 
 StatusOr<ChunkPtr> ExceptContext::pull_chunk(RuntimeState* state) {
+    if (_is_spilled && _next_processed_iter == _hash_set_end_iter) {
+        ASSIGN_OR_RETURN(bool restored, _restore_next_partition(state));
+        if (!restored) {
+            return std::make_shared<Chunk>();
+        }
+    }
+
     // 1. Get at most *state->chunk_size()* remained keys from ht.
     size_t num_remained_keys = 0;
     _remained_keys.resize(state->chunk_size());
@@ -84,12 +100,7 @@ StatusOr<ChunkPtr> ExceptContext::pull_chunk(RuntimeState* state) {
     ChunkPtr dst_chunk = std::make_shared<Chunk>();
     if (num_remained_keys > 0) {
         // 2. Create dest columns.
-        Columns dst_columns(_dst_nullables.size());
-        for (size_t i = 0; i < _dst_nullables.size(); ++i) {
-            const auto& slot = _dst_tuple_desc->slots()[i];
-            dst_columns[i] = ColumnHelper::create_column(slot->type(), _dst_nullables[i]);
-            dst_columns[i]->reserve(num_remained_keys);
-        }
+        Columns dst_columns = _create_dst_columns(num_remained_keys, false);
 
         // 3. Serialize remained keys to the dest columns.
         _hash_set->deserialize_to_columns(_remained_keys, dst_columns, num_remained_keys);
@@ -103,6 +114,135 @@ StatusOr<ChunkPtr> ExceptContext::pull_chunk(RuntimeState* state) {
     return std::move(dst_chunk);
 }
 
+bool ExceptContext::has_output() const {
+    if (is_output_finished()) {
+        return false;
+    }
+    if (!_is_spilled || _next_processed_iter != _hash_set_end_iter) {
+        return true;
+    }
+    return _spiller->is_flushed() && _spiller->has_restore_data();
+}
+
+Columns ExceptContext::build_key_columns() {
+    ExceptHashSerializeSet::KeyVector keys;
+    keys.reserve(_hash_set->size());
+    for (auto it = _hash_set->begin(); it != _hash_set->end(); ++it) {
+        keys.emplace_back(it->slice);
+    }
+    Columns key_columns = _create_dst_columns(keys.size() + 1, false);
+    for (auto& key_column : key_columns) {
+        key_column->append_default();
+    }
+    _hash_set->deserialize_to_columns(keys, key_columns, keys.size());
+    return key_columns;
+}
+
+int64_t ExceptContext::hash_set_mem_usage(ExceptBufferState* buffer_state) const {
+    return _hash_set->mem_usage(buffer_state) + _build_pool->total_reserved_bytes();
+}
+
+Status ExceptContext::spill_hash_set(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller,
+                                     const SpillProcessChannelPtr& spill_channel) {
+    DCHECK(!_is_spilled);
+    _is_spilled = true;
+    _has_spilled_build_rows |= !_hash_set->empty();
+    _dump_iter = _hash_set->begin();
+
+    while (!spiller->is_full()) {
+        auto chunk_st = _dump_hash_set(state);
+        if (chunk_st.status().is_end_of_file()) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(chunk_st.status());
+        RETURN_IF_ERROR(spiller->spill(state, chunk_st.value(), TRACKER_WITH_SPILLER_GUARD(state, spiller)));
+    }
+    spill_channel->add_spill_task({[this, state]() { return _dump_hash_set(state); }});
+    return Status::OK();
+}
+
+Status ExceptContext::spill_chunk(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller,
+                                  const ChunkPtr& chunk, const std::vector<ExprContext*>& child_exprs,
+                                  const int32_t child_idx) {
+    if (child_idx == 0 && chunk != nullptr && !chunk->is_empty()) {
+        _has_spilled_build_rows = true;
+    }
+    return _spiller->spill(state, spiller, chunk, child_exprs);
+}
+
+StatusOr<ChunkPtr> ExceptContext::_dump_hash_set(RuntimeState* state) {
+    ExceptHashSerializeSet::KeyVector keys;
+    keys.reserve(state->chunk_size());
+    for (; _dump_iter != _hash_set->end() && keys.size() < state->chunk_size(); ++_dump_iter) {
+        if (!_dump_iter->deleted) {
+            keys.emplace_back(_dump_iter->slice);
+        }
+    }
+    if (keys.empty()) {
+        RETURN_IF_ERROR(_reset_hash_set(state));
+        return Status::EndOfFile("eos");
+    }
+    // The serialized keys are always nullable.
+    Columns key_columns = _create_dst_columns(keys.size(), true);
+    _hash_set->deserialize_to_columns(keys, key_columns, keys.size());
+    return _spiller->create_spill_chunk(key_columns);
+}
+
+Columns ExceptContext::_create_dst_columns(size_t num_rows, bool all_nullable) const {
+    Columns dst_columns(_dst_nullables.size());
+    for (size_t i = 0; i < _dst_nullables.size(); ++i) {
+        const auto& slot = _dst_tuple_desc->slots()[i];
+        dst_columns[i] = ColumnHelper::create_column(slot->type(), all_nullable || _dst_nullables[i]);
+        dst_columns[i]->reserve(num_rows);
+    }
+    return dst_columns;
+}
+
+StatusOr<bool> ExceptContext::_restore_next_partition(RuntimeState* state) {
+    // Compute the restored partition in the same way as the in-memory one: build the hash set from the rows of
+    // BUILD, and then erase the rows of all the PROBEs from it.
+    if (!_is_restoring_partition) {
+        if (_restore_buffer_state == nullptr) {
+            _restore_buffer_state = std::make_unique<ExceptBufferState>();
+            RETURN_IF_ERROR(_restore_buffer_state->init(state));
+        }
+        RETURN_IF_ERROR(_reset_hash_set(state));
+        _is_restoring_partition = true;
+    }
+
+    int32_t child_idx = 0;
+    bool is_partition_end = false;
+    ASSIGN_OR_RETURN(auto chunk, _spiller->restore_chunk(state, &child_idx, &is_partition_end));
+    if (is_partition_end) {
+        _is_restoring_partition = false;
+        _next_processed_iter = _hash_set->begin();
+        _hash_set_end_iter = _hash_set->end();
+        return true;
+    }
+    if (chunk == nullptr || chunk->is_empty()) {
+        return false;
+    }
+
+    const auto& exprs = _spiller->restored_key_exprs();
+    auto* buffer_state = _restore_buffer_state.get();
+    RETURN_IF_ERROR(SetOperationSpiller::for_each_batch(state, chunk, [&](const ChunkPtr& batch) {
+        if (child_idx == 0) {
+            return append_chunk_to_ht(state, batch, exprs, buffer_state);
+        }
+        return erase_chunk_from_ht(state, batch, exprs, buffer_state);
+    }));
+    return false;
+}
+
+Status ExceptContext::_reset_hash_set(RuntimeState* state) {
+    _hash_set = std::make_unique<ExceptHashSerializeSet>();
+    RETURN_IF_ERROR(_hash_set->init(state));
+    _build_pool->free_all();
+    _next_processed_iter = _hash_set->begin();
+    _hash_set_end_iter = _hash_set->end();
+    return Status::OK();
+}
+
 /// ExceptPartitionContextFactory.
 ExceptContextPtr ExceptPartitionContextFactory::get(const int partition_id) {
     return _partition_id2ctx[partition_id % _partition_id2ctx.size()];
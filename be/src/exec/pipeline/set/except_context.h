@@ -22,6 +22,8 @@
 #include "exec/except_hash_set.h"
 #include "exec/olap_common.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/pipeline/set/set_operation_spiller.h"
+#include "exec/pipeline/spill_process_channel.h"
 #include "exprs/expr_context.h"
 #include "gutil/casts.h"
 #include "runtime/mem_pool.h"
@@ -49,7 +51,7 @@ public:
     bool is_ht_empty() const { return _is_hash_set_empty; }
 
     void finish_build_ht() {
-        _is_hash_set_empty = _hash_set->empty();
+        _is_hash_set_empty = _is_spilled ? !_has_spilled_build_rows : _hash_set->empty();
         _next_processed_iter = _hash_set->begin();
         _hash_set_end_iter = _hash_set->end();
         _is_build_finished = true;
@@ -59,7 +61,14 @@ public:
 
     bool is_build_finished() const;
     bool is_probe_finished() const;
-    bool is_output_finished() const { return _next_processed_iter == _hash_set_end_iter; }
+    bool is_output_finished() const {
+        if (_is_spilled && !_is_hash_set_empty) {
+            return _spiller->is_restore_finished() && _next_processed_iter == _hash_set_end_iter;
+        }
+        return _next_processed_iter == _hash_set_end_iter;
+    }
+    // Whether pull_chunk() can make progress after all the PROBEs are finished.
+    bool has_output() const;
 
     // Called in the preparation phase of ExceptBuildSinkOperator.
     Status prepare(RuntimeState* state, const std::vector<ExprContext*>& build_exprs);
@@ -73,7 +82,32 @@ public:
                                ExceptBufferState* buffer_state);
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state);
 
+    // The keys of the hash set for building runtime filters, each of which begins with a dummy row.
+    Columns build_key_columns();
+    size_t hash_set_size() const { return _hash_set->size(); }
+
+    // In spill mode, the hash set is dumped to the spiller of BUILD, and the rows of the BUILD and PROBEs are spilled
+    // to their own spillers. After all the spillers are flushed, OUTPUT restores the spilled partitions one by one.
+    void set_spiller(SetOperationSpillerPtr spiller) { _spiller = std::move(spiller); }
+    const SetOperationSpillerPtr& spiller() const { return _spiller; }
+    bool is_spilled() const { return _is_spilled; }
+    int64_t hash_set_mem_usage(ExceptBufferState* buffer_state) const;
+    // Called by BUILD when it switches to spill mode. The keys are spilled until |spiller| is full, and the rest are
+    // spilled by the task added to |spill_channel|.
+    Status spill_hash_set(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller,
+                          const SpillProcessChannelPtr& spill_channel);
+    // The PROBEs of different children call it concurrently, each with its own spiller.
+    Status spill_chunk(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller, const ChunkPtr& chunk,
+                       const std::vector<ExprContext*>& child_exprs, int32_t child_idx);
+
 private:
+    Columns _create_dst_columns(size_t num_rows, bool all_nullable) const;
+    // Return the next chunk of the keys of the hash set to spill, or EOF after all of them.
+    StatusOr<ChunkPtr> _dump_hash_set(RuntimeState* state);
+    // Return true if a spilled partition is restored to the hash set.
+    StatusOr<bool> _restore_next_partition(RuntimeState* state);
+    Status _reset_hash_set(RuntimeState* state);
+
     std::unique_ptr<ExceptHashSerializeSet> _hash_set = std::make_unique<ExceptHashSerializeSet>();
 
     const int _dst_tuple_id;
@@ -95,6 +129,16 @@ private:
     ExceptHashSerializeSet::Iterator _hash_set_end_iter;
     bool _is_hash_set_empty = false;
 
+    SetOperationSpillerPtr _spiller;
+    bool _is_spilled = false;
+    bool _has_spilled_build_rows = false;
+    // The next key of the hash set to dump.
+    ExceptHashSerializeSet::Iterator _dump_iter;
+    // Whether the chunks of a spilled partition are being restored to the hash set.
+    bool _is_restoring_partition = false;
+    // Used to compute the restored partitions by OUTPUT.
+    std::unique_ptr<ExceptBufferState> _restore_buffer_state;
+
     // The BUILD, PROBES, and OUTPUT operators execute sequentially.
     // BUILD -> 1-th PROBE -> 2-th PROBE -> ... -> n-th PROBE -> OUTPUT.
     // _finished_dependency_index will increase by one when a BUILD or PROBE is finished.
@@ -31,7 +31,7 @@ public:
         _except_ctx->ref();
     }
 
-    bool has_output() const override { return _except_ctx->is_probe_finished() && !_except_ctx->is_output_finished(); }
+    bool has_output() const override { return _except_ctx->is_probe_finished() && _except_ctx->has_output(); }
 
     bool is_finished() const override { return _except_ctx->is_probe_finished() && _except_ctx->is_output_finished(); }
 
@@ -14,12 +14,19 @@
 
 #include "exec/pipeline/set/except_probe_sink_operator.h"
 
+#include "exec/spill/executor.h"
+#include "exec/spill/spiller.hpp"
+
 namespace starrocks::pipeline {
 
 Status ExceptProbeSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     _except_ctx->incr_prober(_dependency_index);
     RETURN_IF_ERROR(_buffer_state->init(state));
+    if (_spiller != nullptr) {
+        _spiller->set_metrics(spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes()));
+        RETURN_IF_ERROR(_spiller->prepare(state));
+    }
     return Status::OK();
 }
 
@@ -34,15 +41,29 @@ StatusOr<ChunkPtr> ExceptProbeSinkOperator::pull_chunk(RuntimeState* state) {
 }
 
 Status ExceptProbeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_except_ctx->is_spilled()) {
+        return _except_ctx->spill_chunk(state, _spiller, chunk, _dst_exprs, _dependency_index + 1);
+    }
     return _except_ctx->erase_chunk_from_ht(state, chunk, _dst_exprs, _buffer_state.get());
 }
 
+Status ExceptProbeSinkOperator::set_finishing(RuntimeState* state) {
+    _is_finished = true;
+    if (_except_ctx->is_spilled()) {
+        RETURN_IF_ERROR(_except_ctx->spiller()->flush(state, _spiller));
+    }
+    _except_ctx->finish_probe_ht(_dependency_index);
+    return Status::OK();
+}
+
 Status ExceptProbeSinkOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorFactory::prepare(state));
 
     RETURN_IF_ERROR(Expr::prepare(_dst_exprs, state));
     RETURN_IF_ERROR(Expr::open(_dst_exprs, state));
 
+    _spill_options = SetOperationSpiller::create_spill_options(state, _plan_node_id, "except-probe");
+
     return Status::OK();
 }
 
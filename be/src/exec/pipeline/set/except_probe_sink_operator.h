@@ -16,6 +16,7 @@
 
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/set/except_context.h"
+#include "exec/spill/spiller_factory.h"
 
 namespace starrocks::pipeline {
 
@@ -25,12 +26,13 @@ class ExceptProbeSinkOperator final : public Operator {
 public:
     ExceptProbeSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
                             std::shared_ptr<ExceptContext> except_ctx, const std::vector<ExprContext*>& dst_exprs,
-                            const int32_t dependency_index)
+                            const int32_t dependency_index, std::shared_ptr<spill::Spiller> spiller)
             : Operator(factory, id, "except_probe_sink", plan_node_id, false, driver_sequence),
               _except_ctx(std::move(except_ctx)),
               _buffer_state(std::make_unique<ExceptBufferState>()),
               _dst_exprs(dst_exprs),
-              _dependency_index(dependency_index) {
+              _dependency_index(dependency_index),
+              _spiller(std::move(spiller)) {
         _except_ctx->ref();
     }
 
@@ -38,7 +40,10 @@ public:
     void close(RuntimeState* state) override;
 
     bool need_input() const override {
-        return _except_ctx->is_build_finished() && !(_is_finished || _except_ctx->is_ht_empty());
+        if (!_except_ctx->is_build_finished() || (_is_finished || _except_ctx->is_ht_empty())) {
+            return false;
+        }
+        return !_except_ctx->is_spilled() || !_spiller->is_full();
     }
 
     bool has_output() const override { return false; }
@@ -50,11 +55,7 @@ public:
         return _except_ctx->is_build_finished() && (_is_finished || _except_ctx->is_ht_empty());
     }
 
-    Status set_finishing(RuntimeState* state) override {
-        _is_finished = true;
-        _except_ctx->finish_probe_ht(_dependency_index);
-        return Status::OK();
-    }
+    Status set_finishing(RuntimeState* state) override;
 
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
 
@@ -68,6 +69,8 @@ private:
 
     bool _is_finished = false;
     const int32_t _dependency_index;
+    // Only set if spill is enabled.
+    std::shared_ptr<spill::Spiller> _spiller;
 };
 
 class ExceptProbeSinkOperatorFactory final : public OperatorFactory {
@@ -82,8 +85,15 @@ public:
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         ExceptContextPtr except_ctx = _except_partition_ctx_factory->get(driver_sequence);
+        // Each prober has its own spiller, even if it shares the partition with other probers of the same child.
+        std::shared_ptr<spill::Spiller> spiller;
+        if (_spill_options != nullptr && except_ctx->spiller() != nullptr) {
+            spiller = _spill_factory->create(*_spill_options);
+            except_ctx->spiller()->add_spiller(_dependency_index + 1, spiller);
+        }
         return std::make_shared<ExceptProbeSinkOperator>(this, _id, _plan_node_id, driver_sequence,
-                                                         std::move(except_ctx), _dst_exprs, _dependency_index);
+                                                         std::move(except_ctx), _dst_exprs, _dependency_index,
+                                                         std::move(spiller));
     }
 
     Status prepare(RuntimeState* state) override;
@@ -95,6 +105,10 @@ private:
 
     const std::vector<ExprContext*>& _dst_exprs;
     const int32_t _dependency_index;
+
+    // Only set if spill is enabled.
+    std::shared_ptr<spill::SpilledOptions> _spill_options;
+    std::shared_ptr<spill::SpillerFactory> _spill_factory = std::make_shared<spill::SpillerFactory>();
 };
 
 } // namespace starrocks::pipeline
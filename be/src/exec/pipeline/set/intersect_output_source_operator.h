@@ -34,7 +34,7 @@ public:
     }
 
     bool has_output() const override {
-        return _intersect_ctx->is_dependency_finished(_dependency_index) && !_intersect_ctx->is_output_finished();
+        return _intersect_ctx->is_dependency_finished(_dependency_index) && _intersect_ctx->has_output();
     }
 
     bool is_finished() const override {
@@ -14,8 +14,20 @@
 
 #include "exec/pipeline/set/intersect_probe_sink_operator.h"
 
+#include "exec/spill/executor.h"
+#include "exec/spill/spiller.hpp"
+
 namespace starrocks::pipeline {
 
+Status IntersectProbeSinkOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(Operator::prepare(state));
+    if (_spiller != nullptr) {
+        _spiller->set_metrics(spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes()));
+        RETURN_IF_ERROR(_spiller->prepare(state));
+    }
+    return Status::OK();
+}
+
 void IntersectProbeSinkOperator::close(RuntimeState* state) {
     _intersect_ctx->unref(state);
     Operator::close(state);
@@ -26,15 +38,30 @@ StatusOr<ChunkPtr> IntersectProbeSinkOperator::pull_chunk(RuntimeState* state) {
 }
 
 Status IntersectProbeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_intersect_ctx->is_spilled()) {
+        return _intersect_ctx->spill_chunk(state, _spiller, chunk, _dst_exprs, _dependency_index + 1);
+    }
     return _intersect_ctx->refine_chunk_from_ht(state, chunk, _dst_exprs, _dependency_index + 1);
 }
 
+Status IntersectProbeSinkOperator::set_finishing(RuntimeState* state) {
+    ONCE_DETECT(_set_finishing_once);
+    _is_finished = true;
+    if (_intersect_ctx->is_spilled()) {
+        RETURN_IF_ERROR(_intersect_ctx->spiller()->flush(state, _spiller));
+    }
+    _intersect_ctx->finish_probe_ht();
+    return Status::OK();
+}
+
 Status IntersectProbeSinkOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorFactory::prepare(state));
 
     RETURN_IF_ERROR(Expr::prepare(_dst_exprs, state));
     RETURN_IF_ERROR(Expr::open(_dst_exprs, state));
 
+    _spill_options = SetOperationSpiller::create_spill_options(state, _plan_node_id, "intersect-probe");
+
     return Status::OK();
 }
 
@@ -16,6 +16,7 @@
 
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/set/intersect_context.h"
+#include "exec/spill/spiller_factory.h"
 #include "util/race_detect.h"
 
 namespace starrocks::pipeline {
@@ -27,17 +28,22 @@ class IntersectProbeSinkOperator final : public Operator {
 public:
     IntersectProbeSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
                                std::shared_ptr<IntersectContext> intersect_ctx,
-                               const std::vector<ExprContext*>& dst_exprs, const int32_t dependency_index)
+                               const std::vector<ExprContext*>& dst_exprs, const int32_t dependency_index,
+                               std::shared_ptr<spill::Spiller> spiller)
             : Operator(factory, id, "intersect_probe_sink", plan_node_id, false, driver_sequence),
               _intersect_ctx(std::move(intersect_ctx)),
               _dst_exprs(dst_exprs),
-              _dependency_index(dependency_index) {
+              _dependency_index(dependency_index),
+              _spiller(std::move(spiller)) {
         _intersect_ctx->ref();
     }
 
     bool need_input() const override {
-        return _intersect_ctx->is_dependency_finished(_dependency_index) &&
-               !(_is_finished || _intersect_ctx->is_ht_empty());
+        if (!_intersect_ctx->is_dependency_finished(_dependency_index) ||
+            (_is_finished || _intersect_ctx->is_ht_empty())) {
+            return false;
+        }
+        return !_intersect_ctx->is_spilled() || !_spiller->is_full();
     }
 
     bool has_output() const override { return false; }
@@ -51,13 +57,9 @@ public:
                (_is_finished || _intersect_ctx->is_ht_empty());
     }
 
-    Status set_finishing(RuntimeState* state) override {
-        ONCE_DETECT(_set_finishing_once);
-        _is_finished = true;
-        _intersect_ctx->finish_probe_ht();
-        return Status::OK();
-    }
+    Status set_finishing(RuntimeState* state) override;
 
+    Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
 
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
@@ -71,6 +73,8 @@ private:
 
     bool _is_finished = false;
     const int32_t _dependency_index;
+    // Only set if spill is enabled.
+    std::shared_ptr<spill::Spiller> _spiller;
     DECLARE_ONCE_DETECTOR(_set_finishing_once);
 };
 
@@ -86,8 +90,14 @@ public:
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         IntersectContextPtr intersect_ctx = _intersect_partition_ctx_factory->get_or_create(driver_sequence);
+        std::shared_ptr<spill::Spiller> spiller;
+        if (_spill_options != nullptr && intersect_ctx->spiller() != nullptr) {
+            spiller = _spill_factory->create(*_spill_options);
+            intersect_ctx->spiller()->add_spiller(_dependency_index + 1, spiller);
+        }
         return std::make_shared<IntersectProbeSinkOperator>(this, _id, _plan_node_id, driver_sequence,
-                                                            std::move(intersect_ctx), _dst_exprs, _dependency_index);
+                                                            std::move(intersect_ctx), _dst_exprs, _dependency_index,
+                                                            std::move(spiller));
     }
 
     Status prepare(RuntimeState* state) override;
@@ -99,6 +109,10 @@ private:
 
     const std::vector<ExprContext*>& _dst_exprs;
     const int32_t _dependency_index;
+
+    // Only set if spill is enabled.
+    std::shared_ptr<spill::SpilledOptions> _spill_options;
+    std::shared_ptr<spill::SpillerFactory> _spill_factory = std::make_shared<spill::SpillerFactory>();
 };
 
 } // namespace starrocks::pipeline
@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/set/set_operation_runtime_filter.h"
+
+#include <algorithm>
+
+#include "exprs/runtime_filter_bank.h"
+#include "runtime/runtime_filter_worker.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+std::shared_ptr<SetOperationRuntimeFilterBuilder> SetOperationRuntimeFilterBuilder::create(
+        RuntimeState* state, ObjectPool* pool, int32_t plan_node_id,
+        std::vector<RuntimeFilterBuildDescriptor*> rf_descs, size_t num_partitions) {
+    if (rf_descs.empty()) {
+        return nullptr;
+    }
+
+    const auto& query_options = state->query_options();
+    size_t row_limit = 1024000;
+    if (query_options.__isset.runtime_join_filter_pushdown_limit) {
+        row_limit = query_options.runtime_join_filter_pushdown_limit;
+    }
+    size_t global_runtime_filter_build_max_size = UINT64_MAX;
+    if (query_options.__isset.global_runtime_filter_build_max_size &&
+        query_options.global_runtime_filter_build_max_size > 0) {
+        global_runtime_filter_build_max_size = query_options.global_runtime_filter_build_max_size;
+    }
+    // Every partition builds its own hash set, so the limit of all the partitions is enlarged like hash join.
+    size_t total_row_limit = UINT64_MAX;
+    if (row_limit < UINT64_MAX / num_partitions) {
+        total_row_limit = row_limit * num_partitions;
+    }
+
+    auto merger =
+            std::make_unique<PartialRuntimeFilterMerger>(pool, total_row_limit, global_runtime_filter_build_max_size);
+    return std::make_shared<SetOperationRuntimeFilterBuilder>(plan_node_id, std::move(rf_descs), row_limit,
+                                                              std::move(merger));
+}
+
+bool SetOperationRuntimeFilterBuilder::need_key_columns(size_t num_rows) const {
+    return std::any_of(_rf_descs.begin(), _rf_descs.end(),
+                       [&](const auto* rf_desc) { return _need_build(rf_desc, num_rows); });
+}
+
+bool SetOperationRuntimeFilterBuilder::_need_build(const RuntimeFilterBuildDescriptor* rf_desc,
+                                                   size_t num_rows) const {
+    return rf_desc->has_consumer() && (rf_desc->has_remote_targets() || num_rows <= _row_limit);
+}
+
+Status SetOperationRuntimeFilterBuilder::add_partial_filters(RuntimeState* state, RuntimeFilterHub* rf_hub,
+                                                             int32_t driver_sequence, size_t num_rows,
+                                                             const Columns& key_columns) {
+    OptRuntimeBloomFilterBuildParams params;
+    for (auto* rf_desc : _rf_descs) {
+        const int expr_order = rf_desc->build_expr_order();
+        if (!_need_build(rf_desc, num_rows) || expr_order < 0 || expr_order >= static_cast<int>(key_columns.size())) {
+            params.emplace_back();
+            continue;
+        }
+        // NULL equals to NULL in set operations.
+        const bool eq_null = true;
+        const ColumnPtr& column = key_columns[expr_order];
+        MutableJoinRuntimeFilterPtr filter = nullptr;
+        auto multi_partitioned = rf_desc->layout().pipeline_level_multi_partitioned();
+        multi_partitioned |= rf_desc->num_colocate_partition() > 0;
+        if (multi_partitioned) {
+            LogicalType build_type = rf_desc->build_expr_type();
+            filter = std::shared_ptr<JoinRuntimeFilter>(
+                    RuntimeFilterHelper::create_runtime_bloom_filter(nullptr, build_type));
+            if (filter == nullptr) {
+                params.emplace_back();
+                continue;
+            }
+            filter->set_join_mode(rf_desc->join_mode());
+            filter->init(num_rows);
+            RETURN_IF_ERROR(RuntimeFilterHelper::fill_runtime_bloom_filter(column, build_type, filter.get(),
+                                                                           kHashJoinKeyColumnOffset, eq_null));
+        }
+        params.emplace_back(RuntimeBloomFilterBuildParam(multi_partitioned, eq_null, column, std::move(filter)));
+    }
+
+    RuntimeBloomFilters bloom_filters(_rf_descs.begin(), _rf_descs.end());
+    ASSIGN_OR_RETURN(bool all_merged, _merger->add_partial_filters(driver_sequence, num_rows, RuntimeInFilters{},
+                                                                    std::move(params), std::move(bloom_filters)));
+    if (all_merged) {
+        _publish(state, rf_hub);
+    }
+    return Status::OK();
+}
+
+Status SetOperationRuntimeFilterBuilder::set_always_true(RuntimeState* state, RuntimeFilterHub* rf_hub) {
+    ASSIGN_OR_RETURN(bool all_merged, _merger->set_always_true());
+    if (all_merged) {
+        _publish(state, rf_hub);
+    }
+    return Status::OK();
+}
+
+void SetOperationRuntimeFilterBuilder::_publish(RuntimeState* state, RuntimeFilterHub* rf_hub) {
+    auto&& in_filters = _merger->get_total_in_filters();
+    auto&& bloom_filters = _merger->get_total_bloom_filters();
+    state->runtime_filter_port()->publish_runtime_filters(bloom_filters);
+    // Set operations don't build in-filters, but the collector notifies the operators waiting for this node.
+    rf_hub->set_collector(_plan_node_id, std::make_unique<RuntimeFilterCollector>(std::move(in_filters)));
+}
+
+} // namespace starrocks::pipeline
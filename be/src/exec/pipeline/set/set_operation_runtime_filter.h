@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "exec/pipeline/runtime_filter_types.h"
+
+namespace starrocks::pipeline {
+
+// SetOperationRuntimeFilterBuilder builds the runtime bloom filters of an INTERSECT/EXCEPT node from the keys of its
+// first child. A row of the other children can't affect the result unless its keys are in the first child, so the
+// filters can be pushed down to their scan nodes.
+//
+// Like hash join, every partition contributes the keys of its hash set, and the partial filters are merged by
+// PartialRuntimeFilterMerger when the hash sets of all the partitions are built.
+class SetOperationRuntimeFilterBuilder {
+public:
+    SetOperationRuntimeFilterBuilder(int32_t plan_node_id, std::vector<RuntimeFilterBuildDescriptor*> rf_descs,
+                                     size_t row_limit, std::unique_ptr<PartialRuntimeFilterMerger> merger)
+            : _plan_node_id(plan_node_id),
+              _rf_descs(std::move(rf_descs)),
+              _row_limit(row_limit),
+              _merger(std::move(merger)) {}
+
+    // Return nullptr if there is no runtime filter to build. |num_partitions| is the number of the hash sets.
+    static std::shared_ptr<SetOperationRuntimeFilterBuilder> create(RuntimeState* state, ObjectPool* pool,
+                                                                    int32_t plan_node_id,
+                                                                    std::vector<RuntimeFilterBuildDescriptor*> rf_descs,
+                                                                    size_t num_partitions);
+
+    void incr_builder() { _merger->incr_builder(); }
+
+    // Whether any filter is built from a partition with |num_rows| keys. If not, the keys needn't be materialized.
+    bool need_key_columns(size_t num_rows) const;
+
+    // |key_columns| are the keys of the hash set of the |driver_sequence|-th partition, which begin with a dummy row
+    // like the key columns of the hash table of hash join. They can be empty if need_key_columns() is false.
+    Status add_partial_filters(RuntimeState* state, RuntimeFilterHub* rf_hub, int32_t driver_sequence,
+                               size_t num_rows, const Columns& key_columns);
+
+    // The keys of a partition are unknown, e.g. its hash set is spilled, so the filters can't be built.
+    Status set_always_true(RuntimeState* state, RuntimeFilterHub* rf_hub);
+
+private:
+    bool _need_build(const RuntimeFilterBuildDescriptor* rf_desc, size_t num_rows) const;
+    void _publish(RuntimeState* state, RuntimeFilterHub* rf_hub);
+
+    const int32_t _plan_node_id;
+    const std::vector<RuntimeFilterBuildDescriptor*> _rf_descs;
+    // Like runtime_join_filter_pushdown_limit, a local filter isn't built from a partition with more keys.
+    const size_t _row_limit;
+    std::unique_ptr<PartialRuntimeFilterMerger> _merger;
+};
+
+using SetOperationRuntimeFilterBuilderPtr = std::shared_ptr<SetOperationRuntimeFilterBuilder>;
+
+} // namespace starrocks::pipeline
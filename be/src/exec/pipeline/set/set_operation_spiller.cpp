@@ -0,0 +1,225 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/set/set_operation_spiller.h"
+
+#include <algorithm>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/spill/executor.h"
+#include "exec/spill/spiller.hpp"
+#include "exprs/column_ref.h"
+#include "exprs/expr.h"
+#include "runtime/current_thread.h"
+
+namespace starrocks::pipeline {
+
+std::shared_ptr<spill::SpilledOptions> SetOperationSpiller::create_spill_options(RuntimeState* state,
+                                                                                 int32_t plan_node_id,
+                                                                                 const std::string& name) {
+    if (!state->enable_spill() || !state->enable_set_operation_spill()) {
+        return nullptr;
+    }
+    auto options = std::make_shared<spill::SpilledOptions>(config::spill_init_partition, false);
+    options->spill_mem_table_bytes_size = state->spill_mem_table_size();
+    options->mem_table_pool_size = state->spill_mem_table_num();
+    options->spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+    options->min_spilled_size = state->spill_operator_min_bytes();
+    options->block_manager = state->query_ctx()->spill_manager()->block_manager();
+    options->name = name;
+    options->plan_node_id = plan_node_id;
+    options->encode_level = state->spill_encode_level();
+    options->wg = state->fragment_ctx()->workgroup();
+    return options;
+}
+
+void SetOperationSpiller::add_spiller(int32_t child_idx, std::shared_ptr<spill::Spiller> spiller) {
+    _spillers.push_back({child_idx, std::move(spiller), {}});
+}
+
+Status SetOperationSpiller::prepare(RuntimeState* state, const TupleDescriptor* dst_tuple_desc) {
+    _dst_tuple_desc = dst_tuple_desc;
+    auto* pool = state->obj_pool();
+    for (const auto* slot : _dst_tuple_desc->slots()) {
+        _restored_key_exprs.emplace_back(pool->add(new ExprContext(pool->add(new ColumnRef(slot)))));
+    }
+    RETURN_IF_ERROR(Expr::prepare(_restored_key_exprs, state));
+    RETURN_IF_ERROR(Expr::open(_restored_key_exprs, state));
+    return Status::OK();
+}
+
+void SetOperationSpiller::close(RuntimeState* state) {
+    Expr::close(_restored_key_exprs, state);
+    _reader.reset();
+}
+
+ChunkPtr SetOperationSpiller::create_spill_chunk(const Columns& keys) const {
+    DCHECK_EQ(keys.size(), _dst_tuple_desc->slots().size());
+    const size_t num_rows = keys.empty() ? 0 : keys[0]->size();
+
+    auto spill_chunk = std::make_shared<Chunk>();
+    auto hash_column = spill::SpillHashColumn::create(num_rows);
+    auto& hash_values = hash_column->get_data();
+    for (size_t i = 0; i < keys.size(); i++) {
+        // All the keys are nullable, so that the hash values and the serialized keys of all the children are
+        // consistent, regardless of the nullability of their exprs.
+        auto key = ColumnHelper::unpack_and_duplicate_const_column(num_rows, keys[i]);
+        key = ColumnHelper::cast_to_nullable_column(key);
+        key->fnv_hash(hash_values.data(), 0, num_rows);
+        spill_chunk->append_column(std::move(key), _dst_tuple_desc->slots()[i]->id());
+    }
+    spill_chunk->append_column(std::move(hash_column), kHashSlotId);
+    return spill_chunk;
+}
+
+Status SetOperationSpiller::spill(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller,
+                                  const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs) const {
+    if (chunk == nullptr || chunk->is_empty()) {
+        return Status::OK();
+    }
+    Columns keys;
+    keys.reserve(exprs.size());
+    for (auto* expr : exprs) {
+        ASSIGN_OR_RETURN(auto key, expr->evaluate(chunk.get()));
+        keys.emplace_back(std::move(key));
+    }
+    return spiller->spill(state, create_spill_chunk(keys), TRACKER_WITH_SPILLER_GUARD(state, spiller));
+}
+
+Status SetOperationSpiller::flush(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller) {
+    RETURN_IF_ERROR(spiller->flush(state, TRACKER_WITH_SPILLER_GUARD(state, spiller)));
+    return spiller->set_flush_all_call_back(
+            [this]() {
+                _num_flushed_spillers.fetch_add(1, std::memory_order_release);
+                return Status::OK();
+            },
+            state, TRACKER_WITH_SPILLER_GUARD(state, spiller));
+}
+
+bool SetOperationSpiller::has_restore_data() const {
+    if (!_partitions_acquired || _reader == nullptr || !_reader_spiller->spiller->task_status().ok()) {
+        return true;
+    }
+    return _reader->has_output_data() || !_reader->has_restore_task();
+}
+
+bool SetOperationSpiller::is_restore_finished() const {
+    return _partitions_acquired && _current_partition < 0 && _next_partition >= _num_partitions;
+}
+
+StatusOr<ChunkPtr> SetOperationSpiller::restore_chunk(RuntimeState* state, int32_t* child_idx,
+                                                      bool* is_partition_end) {
+    DCHECK(is_flushed());
+    *is_partition_end = false;
+    if (!_partitions_acquired) {
+        _acquire_partitions();
+    }
+    if (_reader == nullptr) {
+        if (_current_partition < 0) {
+            if (_next_partition >= _num_partitions) {
+                return nullptr;
+            }
+            _current_partition = _next_partition++;
+            _next_spiller = 0;
+        }
+        _next_reader();
+        if (_reader == nullptr) {
+            _current_partition = -1;
+            _skip_empty_partitions();
+            *is_partition_end = true;
+            return nullptr;
+        }
+    }
+
+    const auto& spiller = _reader_spiller->spiller;
+    RETURN_IF_ERROR(spiller->task_status());
+    if (!_reader->has_restore_task()) {
+        RETURN_IF_ERROR(_reader->trigger_restore(state, RESOURCE_TLS_MEMTRACER_GUARD(state, std::weak_ptr(_reader))));
+    }
+    if (!_reader->has_output_data()) {
+        return nullptr;
+    }
+    auto chunk_st = _reader->restore(state, RESOURCE_TLS_MEMTRACER_GUARD(state, std::weak_ptr(_reader)));
+    if (chunk_st.status().is_end_of_file()) {
+        _reader.reset();
+        return nullptr;
+    }
+    RETURN_IF_ERROR(chunk_st.status());
+    *child_idx = _reader_spiller->child_idx;
+    return std::move(chunk_st.value());
+}
+
+Status SetOperationSpiller::for_each_batch(RuntimeState* state, const ChunkPtr& chunk,
+                                           const std::function<Status(const ChunkPtr&)>& func) {
+    const size_t num_rows = chunk->num_rows();
+    if (num_rows <= state->chunk_size()) {
+        return func(chunk);
+    }
+    for (size_t from = 0; from < num_rows; from += state->chunk_size()) {
+        const size_t size = std::min<size_t>(state->chunk_size(), num_rows - from);
+        ChunkPtr batch = chunk->clone_empty(size);
+        batch->append(*chunk, from, size);
+        RETURN_IF_ERROR(func(batch));
+    }
+    return Status::OK();
+}
+
+void SetOperationSpiller::_acquire_partitions() {
+    _partitions_acquired = true;
+    // Restore the rows of each partition child by child.
+    std::stable_sort(_spillers.begin(), _spillers.end(),
+                     [](const ChildSpiller& lhs, const ChildSpiller& rhs) { return lhs.child_idx < rhs.child_idx; });
+    for (auto& child_spiller : _spillers) {
+        if (child_spiller.spiller->spilled()) {
+            child_spiller.spiller->get_all_partitions(&child_spiller.partitions);
+            // The spillers aren't splittable, so they have the same partitions in the same order.
+            DCHECK(_num_partitions == 0 || _num_partitions == child_spiller.partitions.size());
+            _num_partitions = child_spiller.partitions.size();
+        }
+    }
+    _skip_empty_partitions();
+}
+
+void SetOperationSpiller::_skip_empty_partitions() {
+    auto has_first_child_rows = [this](size_t partition_idx) {
+        for (const auto& child_spiller : _spillers) {
+            if (child_spiller.child_idx == 0 && !child_spiller.is_empty_partition(partition_idx)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    while (_next_partition < _num_partitions && !has_first_child_rows(_next_partition)) {
+        ++_next_partition;
+    }
+}
+
+void SetOperationSpiller::_next_reader() {
+    while (_next_spiller < _spillers.size()) {
+        const auto& child_spiller = _spillers[_next_spiller++];
+        if (child_spiller.is_empty_partition(_current_partition)) {
+            continue;
+        }
+        const auto* partition = child_spiller.partitions[_current_partition];
+        _reader_spiller = &child_spiller;
+        _reader = std::move(child_spiller.spiller->get_partition_spill_readers({partition})[0]);
+        return;
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,119 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "exec/spill/options.h"
+#include "exec/spill/spiller.h"
+#include "exprs/expr_context.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+// SetOperationSpiller holds the spillers of the sink operators of an INTERSECT/EXCEPT partition, and restores the
+// spilled partitions one by one, each of which is small enough to be computed by the in-memory hash set.
+//
+// Each sink operator spills its rows into its own spiller, so the sinks never wait for each other, and the EXCEPT
+// probers of a partition, which run concurrently, don't share a spiller. The spillers are never split, and they are
+// created with the same number of partitions, so a key lands in the partition of the same id in all of them.
+//
+// A spilled row consists of the keys, all of which are nullable and identified by the slots of the dest tuple, and
+// the hash of the keys, which the partitioned spiller requires to be the last column.
+class SetOperationSpiller {
+public:
+    // Return nullptr if spill isn't enabled for set operations.
+    static std::shared_ptr<spill::SpilledOptions> create_spill_options(RuntimeState* state, int32_t plan_node_id,
+                                                                       const std::string& name);
+
+    // Called when the sink operators are created, the spiller holds the rows of the |child_idx|-th child.
+    void add_spiller(int32_t child_idx, std::shared_ptr<spill::Spiller> spiller);
+
+    Status prepare(RuntimeState* state, const TupleDescriptor* dst_tuple_desc);
+    void close(RuntimeState* state);
+
+    // Exprs to evaluate the keys of the restored chunks.
+    const std::vector<ExprContext*>& restored_key_exprs() const { return _restored_key_exprs; }
+
+    // Convert the keys to a chunk to spill.
+    ChunkPtr create_spill_chunk(const Columns& keys) const;
+    // Spill the keys of |chunk| evaluated by |exprs| into |spiller|, which mustn't be full.
+    Status spill(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller, const ChunkPtr& chunk,
+                 const std::vector<ExprContext*>& exprs) const;
+
+    // Called by each sink operator after its rows are spilled. The spilled rows can be restored after all the
+    // spillers are flushed.
+    Status flush(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller);
+    bool is_flushed() const { return _num_flushed_spillers.load(std::memory_order_acquire) == _spillers.size(); }
+
+    // Whether restore_chunk() can make progress.
+    bool has_restore_data() const;
+    bool is_restore_finished() const;
+    // Restore the next chunk of the current partition, whose rows come from the |child_idx|-th child.
+    // The chunks of a partition are restored child by child in order, and |is_partition_end| is set after the last
+    // one. Return nullptr if no chunk is restored yet.
+    StatusOr<ChunkPtr> restore_chunk(RuntimeState* state, int32_t* child_idx, bool* is_partition_end);
+
+    // Call |func| with the rows of |chunk|, at most chunk_size rows at a time.
+    static Status for_each_batch(RuntimeState* state, const ChunkPtr& chunk,
+                                 const std::function<Status(const ChunkPtr&)>& func);
+
+private:
+    static constexpr SlotId kHashSlotId = -1;
+
+    struct ChildSpiller {
+        int32_t child_idx;
+        std::shared_ptr<spill::Spiller> spiller;
+        // Empty if nothing is spilled.
+        std::vector<const spill::SpillPartitionInfo*> partitions;
+
+        bool is_empty_partition(size_t partition_idx) const {
+            return partitions.empty() || partitions[partition_idx]->empty();
+        }
+    };
+
+    void _acquire_partitions();
+    // Skip the partitions without rows of the first child, which are empty in the result.
+    void _skip_empty_partitions();
+    // Open the reader of the next child spiller of the current partition, if there is one.
+    void _next_reader();
+
+    std::vector<ChildSpiller> _spillers;
+    const TupleDescriptor* _dst_tuple_desc = nullptr;
+    std::vector<ExprContext*> _restored_key_exprs;
+
+    std::atomic<size_t> _num_flushed_spillers{0};
+
+    // Only accessed by the output operator in the restore phase.
+    bool _partitions_acquired = false;
+    size_t _num_partitions = 0;
+    size_t _next_partition = 0;
+    // The partition being restored, or -1 if none.
+    int64_t _current_partition = -1;
+    size_t _next_spiller = 0;
+    const ChildSpiller* _reader_spiller = nullptr;
+    std::shared_ptr<spill::SpillerReader> _reader;
+};
+
+using SetOperationSpillerPtr = std::shared_ptr<SetOperationSpiller>;
+
+} // namespace starrocks::pipeline
@@ -18,6 +18,7 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "exec/chunks_sorter_topn.h"
 
 namespace starrocks::pipeline {
@@ -34,7 +35,13 @@ LocalPartitionTopnContext::LocalPartitionTopnContext(const std::vector<TExpr>& t
           _sort_keys(std::move(sort_keys)),
           _offset(offset),
           _partition_limit(partition_limit),
-          _topn_type(topn_type) {}
+          _topn_type(topn_type) {
+    if (_topn_type == TTopNType::ROW_NUMBER &&
+        _offset + _partition_limit <= config::local_partition_topn_heap_max_rows) {
+        _topn_heaps = std::make_unique<PartitionTopnHeaps>(&_sort_exprs, _is_asc_order, _is_null_first, _offset,
+                                                           _partition_limit);
+    }
+}
 
 Status LocalPartitionTopnContext::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Expr::create_expr_trees(state->obj_pool(), _t_partition_exprs, &_partition_exprs, state));
@@ -55,11 +62,28 @@ Status LocalPartitionTopnContext::prepare(RuntimeState* state) {
         _has_nullable_key = _has_nullable_key || _partition_types[i].is_nullable;
     }
 
+    _chunk_size = state->chunk_size();
     _chunks_partitioner = std::make_unique<ChunksPartitioner>(_has_nullable_key, _partition_exprs, _partition_types);
     return _chunks_partitioner->prepare(state);
 }
 
 Status LocalPartitionTopnContext::push_one_chunk_to_partitioner(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_topn_heaps != nullptr) {
+        Status update_st;
+        RETURN_IF_ERROR(_chunks_partitioner->offer<true>(
+                chunk, [this](size_t partition_idx) { _topn_heaps->add_partition(); },
+                [this, &update_st](size_t partition_idx, const ChunkPtr& chunk) {
+                    if (update_st.ok()) {
+                        update_st = _topn_heaps->update(partition_idx, chunk);
+                    }
+                }));
+        RETURN_IF_ERROR(update_st);
+        if (_chunks_partitioner->is_passthrough()) {
+            RETURN_IF_ERROR(transfer_all_chunks_from_partitioner_to_sorters(state));
+        }
+        return Status::OK();
+    }
+
     auto st = _chunks_partitioner->offer<true>(
             chunk,
             [this, state](size_t partition_idx) {
@@ -86,6 +110,19 @@ Status LocalPartitionTopnContext::transfer_all_chunks_from_partitioner_to_sorter
     }
 
     _partition_num = _chunks_partitioner->num_partitions();
+    if (_topn_heaps != nullptr) {
+        Status update_st;
+        RETURN_IF_ERROR(_chunks_partitioner->consume_from_hash_map(
+                [this, &update_st](int32_t partition_idx, const ChunkPtr& chunk) {
+                    update_st = _topn_heaps->update(partition_idx, chunk);
+                    return update_st.ok();
+                }));
+        RETURN_IF_ERROR(update_st);
+        _topn_heaps->done();
+        _is_transfered = true;
+        return Status::OK();
+    }
+
     RETURN_IF_ERROR(
             _chunks_partitioner->consume_from_hash_map([this, state](int32_t partition_idx, const ChunkPtr& chunk) {
                 (void)_chunks_sorters[partition_idx]->update(state, chunk);
@@ -100,11 +137,18 @@ Status LocalPartitionTopnContext::transfer_all_chunks_from_partitioner_to_sorter
     return Status::OK();
 }
 
+bool LocalPartitionTopnContext::_has_sorted_output() const {
+    if (_topn_heaps != nullptr) {
+        return _topn_heaps->has_output();
+    }
+    return _sorter_index < _chunks_sorters.size();
+}
+
 bool LocalPartitionTopnContext::has_output() {
     if (_chunks_partitioner->is_passthrough() && _is_transfered) {
-        return _sorter_index < _chunks_sorters.size() || !_chunks_partitioner->is_passthrough_buffer_empty();
+        return _has_sorted_output() || !_chunks_partitioner->is_passthrough_buffer_empty();
     }
-    return _is_sink_complete && _sorter_index < _chunks_sorters.size();
+    return _is_sink_complete && _has_sorted_output();
 }
 
 bool LocalPartitionTopnContext::is_finished() {
@@ -116,7 +160,11 @@ bool LocalPartitionTopnContext::is_finished() {
 
 StatusOr<ChunkPtr> LocalPartitionTopnContext::pull_one_chunk() {
     ChunkPtr chunk = nullptr;
-    if (_sorter_index < _chunks_sorters.size()) {
+    if (_topn_heaps != nullptr) {
+        if (_topn_heaps->has_output()) {
+            return _topn_heaps->get_next(_chunk_size);
+        }
+    } else if (_sorter_index < _chunks_sorters.size()) {
         ASSIGN_OR_RETURN(chunk, pull_one_chunk_from_sorters());
         if (chunk != nullptr) {
             return chunk;
@@ -18,6 +18,7 @@
 
 #include "exec/chunks_sorter.h"
 #include "exec/partition/chunks_partitioner.h"
+#include "exec/partition/partition_topn_heaps.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks {
@@ -72,11 +73,15 @@ public:
 
     size_t num_partitions() const { return _partition_num; }
 
+    bool use_topn_heaps() const { return _topn_heaps != nullptr; }
+
 private:
     // Pull one chunk from one of the sorters
     // The output chunk stream is unordered
     [[nodiscard]] StatusOr<ChunkPtr> pull_one_chunk_from_sorters();
 
+    bool _has_sorted_output() const;
+
     const std::vector<TExpr>& _t_partition_exprs;
     std::vector<ExprContext*> _partition_exprs;
     std::vector<PartitionColumnType> _partition_types;
@@ -91,6 +96,9 @@ private:
 
     // Every partition holds a chunks_sorter
     ChunksSorters _chunks_sorters;
+    // Replace the chunks_sorters if every partition keeps a few rows of ROW_NUMBER
+    std::unique_ptr<PartitionTopnHeaps> _topn_heaps;
+    size_t _chunk_size = 0;
     const std::vector<ExprContext*>& _sort_exprs;
     std::vector<bool> _is_asc_order;
     std::vector<bool> _is_null_first;
@@ -42,6 +42,7 @@ Status LocalPartitionTopnSinkOperator::set_finishing(RuntimeState* state) {
     RETURN_IF_ERROR(_partition_topn_ctx->transfer_all_chunks_from_partitioner_to_sorters(state));
     _partition_topn_ctx->sink_complete();
     _unique_metrics->add_info_string("IsPassThrough", _partition_topn_ctx->is_passthrough() ? "Yes" : "No");
+    _unique_metrics->add_info_string("UseTopnHeaps", _partition_topn_ctx->use_topn_heaps() ? "Yes" : "No");
     auto* partition_num_counter = ADD_COUNTER(_unique_metrics, "PartitionNum", TUnit::UNIT);
     COUNTER_SET(partition_num_counter, static_cast<int64_t>(_partition_topn_ctx->num_partitions()));
     _is_finished = true;
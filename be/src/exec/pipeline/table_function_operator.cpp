@@ -14,6 +14,8 @@
 
 #include "table_function_operator.h"
 
+#include <algorithm>
+
 namespace starrocks::pipeline {
 
 void TableFunctionOperator::close(RuntimeState* state) {
@@ -191,41 +193,25 @@ Status TableFunctionOperator::reset_state(RuntimeState* state, const std::vector
     return Status::OK();
 }
 
-void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns, uint32_t max_output_size) {
+void TableFunctionOperator::_copy_result(std::vector<ColumnPtr>& columns, uint32_t max_output_size) {
     DCHECK_LE(_next_output_row, _table_function_result.first[0]->size());
     DCHECK_LT(_next_output_row_offset, _table_function_result.second->size());
     uint32_t curr_output_size = columns[0]->size();
     const auto& fn_result_cols = _table_function_result.first;
-    const auto& offsets_col = _table_function_result.second;
+    const auto& offsets = _table_function_result.second->get_data();
+
+    // Collect the input row of every output row first, and then build the outer columns by one gather and the
+    // table function results by one range copy, rather than row by row.
+    const uint32_t first_output_row = _next_output_row;
+    _outer_row_indexes.clear();
     while (curr_output_size < max_output_size && _next_output_row < fn_result_cols[0]->size()) {
         uint32_t start = _next_output_row;
-        uint32_t end = offsets_col->get_data()[_next_output_row_offset + 1];
-        DCHECK_GE(start, offsets_col->get_data()[_next_output_row_offset]);
+        uint32_t end = offsets[_next_output_row_offset + 1];
+        DCHECK_GE(start, offsets[_next_output_row_offset]);
         DCHECK_LE(start, end);
         uint32_t copy_rows = std::min(end - start, max_output_size - curr_output_size);
-        VLOG(2) << "_next_output_row=" << _next_output_row << " start=" << start << " end=" << end
-                << " copy_rows=" << copy_rows << " input_size=" << fn_result_cols[0]->size()
-                << " _next_output_row_offset=" << _next_output_row_offset
-                << " _input_index_of_first_result=" << _input_index_of_first_result;
-
-        if (copy_rows > 0) {
-            // Build outer data, repeat multiple times
-            for (size_t i = 0; i < _outer_slots.size(); ++i) {
-                ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-                Datum value = input_column_ptr->get(_input_index_of_first_result + _next_output_row_offset);
-                if (value.is_null()) {
-                    DCHECK(columns[i]->is_nullable());
-                    down_cast<NullableColumn*>(columns[i].get())->append_nulls(copy_rows);
-                } else {
-                    columns[i]->append_value_multiple_times(&value, copy_rows);
-                }
-            }
-
-            // Build table function result
-            for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
-                columns[_outer_slots.size() + i]->append(*(fn_result_cols[i]), start, copy_rows);
-            }
-        }
+        _outer_row_indexes.insert(_outer_row_indexes.end(), copy_rows,
+                                  _input_index_of_first_result + _next_output_row_offset);
 
         curr_output_size += copy_rows;
         _next_output_row += copy_rows;
@@ -234,6 +220,28 @@ void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns,
             _next_output_row_offset++;
         }
     }
+
+    const uint32_t num_rows = _next_output_row - first_output_row;
+    if (num_rows == 0) {
+        return;
+    }
+    for (size_t i = 0; i < _outer_slots.size(); ++i) {
+        const ColumnPtr& input_column = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
+        columns[i]->append_selective(*input_column, _outer_row_indexes.data(), 0, num_rows);
+    }
+    // If all the results of the input chunk fit in this output chunk, they are shared without copy, which are never
+    // accessed by this operator again. For UNNEST without null, they are the elements of the array column.
+    const bool share_results = !_fn_result_slots.empty() && columns[_outer_slots.size()]->empty() &&
+                               first_output_row == 0 && num_rows == fn_result_cols[0]->size() &&
+                               _table_function_state->processed_rows() >= _input_chunk->num_rows();
+    for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
+        ColumnPtr& output_column = columns[_outer_slots.size() + i];
+        if (share_results) {
+            output_column = fn_result_cols[i];
+        } else {
+            output_column->append(*fn_result_cols[i], first_output_row, num_rows);
+        }
+    }
 }
 
 } // namespace starrocks::pipeline
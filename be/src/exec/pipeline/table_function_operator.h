@@ -51,7 +51,7 @@ public:
 private:
     ChunkPtr _build_chunk(const std::vector<ColumnPtr>& output_columns);
     [[nodiscard]] Status _process_table_function(RuntimeState* state);
-    void _copy_result(const std::vector<ColumnPtr>& columns, uint32_t max_column_size);
+    void _copy_result(std::vector<ColumnPtr>& columns, uint32_t max_column_size);
 
     const TPlanNode& _tnode;
     const TableFunction* _table_function = nullptr;
@@ -73,6 +73,8 @@ private:
     size_t _next_output_row_offset = 0;
     // table function result
     std::pair<Columns, UInt32Column::Ptr> _table_function_result;
+    // The input row of each row of the output chunk being built, used to replicate the outer columns.
+    Buffer<uint32_t> _outer_row_indexes;
     // table function param and return offset
     TableFunctionState* _table_function_state = nullptr;
 
@@ -14,24 +14,70 @@
 
 #include "exec/query_cache/cache_manager.h"
 
+#include <fmt/format.h>
+
+#include "block_cache/block_cache.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "serde/column_array_serde.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
 #include "util/defer_op.h"
 namespace starrocks::query_cache {
 
-CacheManager::CacheManager(size_t capacity) : _cache(capacity) {}
+static constexpr uint32_t CACHE_VALUE_FORMAT_VERSION = 1;
+
+CacheManager::CacheManager(size_t capacity) : _cache(capacity) {
+    if (config::query_cache_enable_disk_tier) {
+        auto st = ThreadPoolBuilder("qc_disk")
+                          .set_min_threads(1)
+                          .set_max_threads(2)
+                          .set_max_queue_size(std::max(1, config::query_cache_disk_tier_max_pending_tasks))
+                          .build(&_disk_pool);
+        LOG_IF(WARNING, !st.ok()) << "Fail to create the disk tier of query cache: " << st;
+    }
+}
+
+CacheManager::~CacheManager() {
+    // The pending tasks refer to the members below.
+    if (_disk_pool != nullptr) {
+        _disk_pool->shutdown();
+    }
+}
+
 static void delete_cache_entry(const CacheKey& key, void* value) {
     auto* cache_value = (CacheValue*)value;
     delete cache_value;
 }
 
-void CacheManager::populate(const std::string& key, const CacheValue& value) {
+void CacheManager::_insert_into_memory(const std::string& key, const CacheValue& value) {
     auto* cache_value = new CacheValue(value);
     auto* handle = _cache.insert(key, cache_value, cache_value->size(), &delete_cache_entry, CachePriority::NORMAL);
     _cache.release(handle);
 }
 
+void CacheManager::populate(const std::string& key, const CacheValue& value, const CacheSlotTypes* slot_types) {
+    _insert_into_memory(key, value);
+    if (slot_types == nullptr || !_disk_tier_available()) {
+        return;
+    }
+    // The cached chunks are immutable, so the copy shares them with the memory entry.
+    auto st = _disk_pool->submit_func([this, key, value, types = *slot_types]() {
+        auto data = serialize_cache_value(value, types);
+        auto st = data.ok() ? _write_to_disk(key, data.value()) : data.status();
+        LOG_IF(WARNING, !st.ok() && !st.is_not_supported() && !st.is_resource_busy())
+                << "Fail to write query cache entry to disk: " << st;
+    });
+    // The disk tier is best-effort, drop the entry if too many writes are pending.
+    VLOG_IF(2, !st.ok()) << "Skip writing query cache entry to disk: " << st;
+}
+
 StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
     auto* handle = _cache.lookup(key);
     if (handle == nullptr) {
+        if (_disk_tier_available()) {
+            _load_from_disk_async(key);
+        }
         return Status::NotFound("CacheMiss");
     }
     DeferOp defer([this, handle]() { _cache.release(handle); });
@@ -56,10 +102,197 @@ size_t CacheManager::hit_count() {
 }
 
 void CacheManager::invalidate_all() {
+    _disk_epoch.fetch_add(1);
     auto old_capacity = _cache.get_capacity();
     // set capacity of cache to zero, the cache shall prune all cache entries.
     _cache.set_capacity(0);
     _cache.set_capacity(old_capacity);
 }
 
+bool CacheManager::_disk_tier_available() const {
+    return _disk_pool != nullptr && BlockCache::instance()->is_initialized();
+}
+
+std::string CacheManager::_disk_key(const std::string& key) const {
+    // Cache keys may exceed the key length limit of the block cache, so the hashed key is used, and the full key is
+    // kept in the meta block to detect collisions.
+    return fmt::format("query_cache/{}/{:016x}", _disk_epoch.load(), std::hash<std::string>()(key));
+}
+
+void CacheManager::_load_from_disk_async(const std::string& key) {
+    {
+        std::lock_guard<std::mutex> l(_loading_mutex);
+        if (!_loading_keys.insert(key).second) {
+            return;
+        }
+    }
+    auto st = _disk_pool->submit_func([this, key]() {
+        DeferOp defer([this, &key]() {
+            std::lock_guard<std::mutex> l(_loading_mutex);
+            _loading_keys.erase(key);
+        });
+        auto data = _read_from_disk(key);
+        if (!data.ok()) {
+            return;
+        }
+        auto value = deserialize_cache_value(Slice(data.value()));
+        if (!value.ok()) {
+            LOG(WARNING) << "Fail to load query cache entry from disk: " << value.status();
+            return;
+        }
+        // Do not replace the entry populated while loading, it is at least as fresh as the one on disk.
+        auto* handle = _cache.lookup(key);
+        if (handle != nullptr) {
+            _cache.release(handle);
+            return;
+        }
+        _insert_into_memory(key, value.value());
+    });
+    if (!st.ok()) {
+        std::lock_guard<std::mutex> l(_loading_mutex);
+        _loading_keys.erase(key);
+    }
+}
+
+// The data of an entry is split into blocks of BlockCache::block_size() under the disk key, and the meta block
+// |data length|crc32c of data|cache key| is written under `<disk key>/meta` after all the data blocks, so a
+// readable meta block implies a complete entry.
+Status CacheManager::_write_to_disk(const std::string& key, const std::string& data) {
+    auto* block_cache = BlockCache::instance();
+    const auto disk_key = _disk_key(key);
+    const size_t block_size = block_cache->block_size();
+    for (size_t offset = 0; offset < data.size(); offset += block_size) {
+        size_t size = std::min(block_size, data.size() - offset);
+        auto st = block_cache->write_buffer(disk_key, offset, size, data.data() + offset);
+        if (!st.ok() && !st.is_already_exist()) {
+            return st;
+        }
+    }
+    std::string meta;
+    put_fixed64_le(&meta, data.size());
+    put_fixed32_le(&meta, crc32c::Value(data.data(), data.size()));
+    meta.append(key);
+    auto st = block_cache->write_buffer(disk_key + "/meta", 0, meta.size(), meta.data());
+    return st.is_already_exist() ? Status::OK() : st;
+}
+
+StatusOr<std::string> CacheManager::_read_from_disk(const std::string& key) {
+    auto* block_cache = BlockCache::instance();
+    const auto disk_key = _disk_key(key);
+    std::string meta(sizeof(uint64_t) + sizeof(uint32_t) + key.size(), '\0');
+    ASSIGN_OR_RETURN(auto meta_size, block_cache->read_buffer(disk_key + "/meta", 0, meta.size(), meta.data()));
+    if (meta_size != meta.size() || meta.compare(sizeof(uint64_t) + sizeof(uint32_t), key.size(), key) != 0) {
+        return Status::NotFound("query cache entry is not on disk");
+    }
+    const auto* meta_ptr = reinterpret_cast<const uint8_t*>(meta.data());
+    size_t data_size = decode_fixed64_le(meta_ptr);
+    uint32_t crc = decode_fixed32_le(meta_ptr + sizeof(uint64_t));
+
+    std::string data(data_size, '\0');
+    const size_t block_size = block_cache->block_size();
+    for (size_t offset = 0; offset < data_size; offset += block_size) {
+        size_t size = std::min(block_size, data_size - offset);
+        ASSIGN_OR_RETURN(auto read_size, block_cache->read_buffer(disk_key, offset, size, data.data() + offset));
+        if (read_size != size) {
+            return Status::NotFound("query cache entry is partially evicted from disk");
+        }
+    }
+    if (crc32c::Value(data.data(), data.size()) != crc) {
+        return Status::Corruption("checksum mismatch of query cache entry on disk");
+    }
+    return data;
+}
+
+// Layout: |format version|version|populate time|num chunks|chunk...|, and each chunk is |num columns|column...|,
+// each column is |slot id|PTypeDesc size|PTypeDesc|nullable|column data encoded by ColumnArraySerde|.
+StatusOr<std::string> CacheManager::serialize_cache_value(const CacheValue& value, const CacheSlotTypes& slot_types) {
+    std::string buff;
+    put_fixed32_le(&buff, CACHE_VALUE_FORMAT_VERSION);
+    put_fixed64_le(&buff, value.version);
+    put_fixed64_le(&buff, value.populate_time);
+    put_fixed32_le(&buff, value.result.size());
+    for (const auto& chunk : value.result) {
+        put_fixed32_le(&buff, chunk->get_slot_id_to_index_map().size());
+        for (const auto& [slot_id, index] : chunk->get_slot_id_to_index_map()) {
+            const auto& column = chunk->get_column_by_index(index);
+            auto type_it = slot_types.find(slot_id);
+            if (type_it == slot_types.end() || column->is_constant()) {
+                return Status::NotSupported("query cache entry can not be written to disk");
+            }
+            int64_t max_size = serde::ColumnArraySerde::max_serialized_size(*column);
+            if (max_size == 0) {
+                return Status::NotSupported("query cache entry can not be written to disk");
+            }
+            put_fixed32_le(&buff, slot_id);
+            std::string type_pb;
+            type_it->second.to_protobuf().SerializeToString(&type_pb);
+            put_fixed32_le(&buff, type_pb.size());
+            buff.append(type_pb);
+            buff.push_back(column->is_nullable() ? 1 : 0);
+
+            size_t offset = buff.size();
+            buff.resize(offset + max_size);
+            auto* begin = reinterpret_cast<uint8_t*>(buff.data() + offset);
+            auto* end = serde::ColumnArraySerde::serialize(*column, begin);
+            if (end == nullptr) {
+                return Status::InternalError("fail to serialize query cache entry");
+            }
+            buff.resize(offset + (end - begin));
+        }
+    }
+    return buff;
+}
+
+StatusOr<CacheValue> CacheManager::deserialize_cache_value(const Slice& data) {
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data);
+    const auto* end = ptr + data.size;
+    auto check_remaining = [&](size_t n) {
+        return ptr + n <= end ? Status::OK() : Status::Corruption("truncated query cache entry");
+    };
+
+    RETURN_IF_ERROR(check_remaining(sizeof(uint32_t) * 2 + sizeof(int64_t) * 2));
+    if (decode_fixed32_le(ptr) != CACHE_VALUE_FORMAT_VERSION) {
+        return Status::NotSupported("unknown format of query cache entry");
+    }
+    ptr += sizeof(uint32_t);
+    int64_t version = decode_fixed64_le(ptr);
+    ptr += sizeof(int64_t);
+    int64_t populate_time = decode_fixed64_le(ptr);
+    ptr += sizeof(int64_t);
+    uint32_t num_chunks = decode_fixed32_le(ptr);
+    ptr += sizeof(uint32_t);
+
+    CacheResult result;
+    result.reserve(num_chunks);
+    for (uint32_t i = 0; i < num_chunks; ++i) {
+        RETURN_IF_ERROR(check_remaining(sizeof(uint32_t)));
+        uint32_t num_columns = decode_fixed32_le(ptr);
+        ptr += sizeof(uint32_t);
+        auto chunk = std::make_shared<Chunk>();
+        for (uint32_t j = 0; j < num_columns; ++j) {
+            RETURN_IF_ERROR(check_remaining(sizeof(uint32_t) * 2));
+            auto slot_id = static_cast<SlotId>(decode_fixed32_le(ptr));
+            ptr += sizeof(uint32_t);
+            uint32_t type_size = decode_fixed32_le(ptr);
+            ptr += sizeof(uint32_t);
+            RETURN_IF_ERROR(check_remaining(type_size + 1));
+            PTypeDesc type_pb;
+            if (!type_pb.ParseFromArray(ptr, type_size)) {
+                return Status::Corruption("invalid column type of query cache entry");
+            }
+            ptr += type_size;
+            bool nullable = *ptr++ != 0;
+
+            auto column = ColumnHelper::create_column(TypeDescriptor::from_protobuf(type_pb), nullable);
+            ptr = serde::ColumnArraySerde::deserialize(ptr, column.get());
+            if (ptr == nullptr || ptr > end) {
+                return Status::Corruption("invalid column data of query cache entry");
+            }
+            chunk->append_column(std::move(column), slot_id);
+        }
+        result.push_back(std::move(chunk));
+    }
+    return CacheValue(populate_time, version, std::move(result));
+}
+
 } // namespace starrocks::query_cache
@@ -14,15 +14,21 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "column/chunk.h"
 #include "common/status.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/types.h"
 #include "util/lru_cache.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 
 namespace starrocks::query_cache {
 class CacheManager;
@@ -30,6 +36,8 @@ using CacheManagerRawPtr = CacheManager*;
 using CacheManagerPtr = std::shared_ptr<CacheManager>;
 
 using CacheResult = std::vector<ChunkPtr>;
+// Types of the cached columns keyed by slot id, the disk tier needs them to rebuild the columns of a cache value.
+using CacheSlotTypes = std::unordered_map<int32_t, TypeDescriptor>;
 
 struct CacheValue {
     int64_t latest_hit_time{0};
@@ -63,8 +71,10 @@ struct CacheValue {
 class CacheManager {
 public:
     explicit CacheManager(size_t capacity);
-    ~CacheManager() = default;
-    void populate(const std::string& key, const CacheValue& value);
+    ~CacheManager();
+    // The value is written to the disk tier too in the background if |slot_types| is given.
+    void populate(const std::string& key, const CacheValue& value, const CacheSlotTypes* slot_types = nullptr);
+    // On a memory miss, the entry is loaded from the disk tier in the background, so that the later probes can hit.
     [[nodiscard]] StatusOr<CacheValue> probe(const std::string& key);
     size_t memory_usage();
     size_t capacity();
@@ -73,7 +83,24 @@ public:
     // vacuum cache by invalidate all cache entries
     void invalidate_all();
 
+    // Encode a cache value into a self-described byte string for the disk tier, and decode it back.
+    static StatusOr<std::string> serialize_cache_value(const CacheValue& value, const CacheSlotTypes& slot_types);
+    static StatusOr<CacheValue> deserialize_cache_value(const Slice& data);
+
 private:
+    bool _disk_tier_available() const;
+    std::string _disk_key(const std::string& key) const;
+    void _insert_into_memory(const std::string& key, const CacheValue& value);
+    void _load_from_disk_async(const std::string& key);
+    Status _write_to_disk(const std::string& key, const std::string& data);
+    StatusOr<std::string> _read_from_disk(const std::string& key);
+
     ShardedLRUCache _cache;
+    // Writes and loads of the disk tier, nullptr if the disk tier is disabled.
+    std::unique_ptr<ThreadPool> _disk_pool;
+    std::mutex _loading_mutex;
+    std::unordered_set<std::string> _loading_keys;
+    // Bumped by invalidate_all() to make the entries already on disk unreachable.
+    std::atomic<int64_t> _disk_epoch{0};
 };
 } // namespace starrocks::query_cache
@@ -20,10 +20,13 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "exec/pipeline/pipeline_driver.h"
+#include "runtime/descriptors.h"
 #include "storage/rowset/rowset.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
+#include "storage/tablet_updates.h"
 #include "util/time.h"
 namespace starrocks::query_cache {
 enum PerLaneBufferState {
@@ -183,6 +186,16 @@ Status CacheOperator::prepare(RuntimeState* state) {
     _cache_passthrough_rows_counter = ADD_COUNTER(_unique_metrics, "CachePassthroughRowNum", TUnit::UNIT);
     _cache_passthrough_bytes_counter = ADD_COUNTER(_unique_metrics, "CachePassthroughBytes", TUnit::BYTES);
 
+    if (config::query_cache_enable_disk_tier) {
+        for (const auto& [slot_id, new_slot_id] : _cache_param.slot_remapping) {
+            auto* slot = state->desc_tbl().get_slot_descriptor(slot_id);
+            if (slot == nullptr) {
+                _cache_slot_types.clear();
+                break;
+            }
+            _cache_slot_types.emplace(new_slot_id, slot->type());
+        }
+    }
     return Status::OK();
 }
 
@@ -309,7 +322,13 @@ void CacheOperator::_handle_stale_cache_value_for_pk(int64_t tablet_id, starrock
         can_pickup_delta_rowsets |= rs->start_version() == snapshot_version + 1;
         exists_non_empty_delta_rowsets |= rs->start_version() > snapshot_version && rs->has_data_files();
     }
-    if (exists_non_empty_delta_rowsets || !can_pickup_delta_rowsets) {
+    bool is_unchanged = !exists_non_empty_delta_rowsets && can_pickup_delta_rowsets;
+    // The delta rowsets may have been merged into the other rowsets by compactions, which don't change the data,
+    // so consult the edit version history of the tablet instead.
+    if (!is_unchanged && tablet->updates() != nullptr) {
+        is_unchanged = tablet->updates()->has_no_data_committed_between(snapshot_version, version);
+    }
+    if (!is_unchanged) {
         buffer->state = PLBS_MISS;
         buffer->cached_version = 0;
         return;
@@ -415,7 +434,7 @@ void CacheOperator::populate_cache(int64_t tablet_id) {
     _cache_populate_chunks_counter->update(buffer->chunks.size());
     _cache_populate_rows_counter->update(buffer->num_rows);
     _populate_tablets.insert(tablet_id);
-    _cache_mgr->populate(cache_key, cache_value);
+    _cache_mgr->populate(cache_key, cache_value, _cache_slot_types.empty() ? nullptr : &_cache_slot_types);
     buffer->state = PLBS_POPULATE;
 }
 
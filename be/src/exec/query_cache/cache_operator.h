@@ -78,6 +78,8 @@ private:
     ChunkPtr _pull_chunk_from_per_lane_buffer(PerLaneBufferPtr& buffer);
     CacheManagerRawPtr _cache_mgr;
     const CacheParam& _cache_param;
+    // Types of the remapped slots in the cached chunks, empty if the entries are not written to the disk tier.
+    CacheSlotTypes _cache_slot_types;
     LaneArbiterPtr _lane_arbiter;
     std::unordered_map<int64_t, size_t> _owner_to_lanes;
     PerLaneBuffers _per_lane_buffers;
@@ -0,0 +1,60 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/query_cache/ht_size_hints.h"
+
+#include <cstring>
+
+#include "util/defer_op.h"
+
+namespace starrocks::query_cache {
+
+HashTableSizeHints::HashTableSizeHints(size_t capacity) : _cache(capacity) {}
+
+static void delete_hint_entry(const CacheKey& key, void* value) {
+    delete reinterpret_cast<size_t*>(value);
+}
+
+std::string HashTableSizeHints::_make_key(uint64_t plan_fingerprint, int32_t plan_node_id) {
+    std::string key(sizeof(plan_fingerprint) + sizeof(plan_node_id), '\0');
+    memcpy(key.data(), &plan_fingerprint, sizeof(plan_fingerprint));
+    memcpy(key.data() + sizeof(plan_fingerprint), &plan_node_id, sizeof(plan_node_id));
+    return key;
+}
+
+void HashTableSizeHints::update(uint64_t plan_fingerprint, int32_t plan_node_id, size_t ht_size) {
+    auto key = _make_key(plan_fingerprint, plan_node_id);
+    // each hint is charged 1, so the capacity limits the number of hints.
+    auto* handle = _cache.insert(key, new size_t(ht_size), 1, &delete_hint_entry, CachePriority::NORMAL);
+    _cache.release(handle);
+}
+
+size_t HashTableSizeHints::lookup(uint64_t plan_fingerprint, int32_t plan_node_id) {
+    auto* handle = _cache.lookup(_make_key(plan_fingerprint, plan_node_id));
+    if (handle == nullptr) {
+        return 0;
+    }
+    DeferOp defer([this, handle]() { _cache.release(handle); });
+    return *reinterpret_cast<size_t*>(_cache.value(handle));
+}
+
+size_t HashTableSizeHints::lookup_count() {
+    return _cache.get_lookup_count();
+}
+
+size_t HashTableSizeHints::hit_count() {
+    return _cache.get_hit_count();
+}
+
+} // namespace starrocks::query_cache
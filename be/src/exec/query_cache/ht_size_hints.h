@@ -0,0 +1,49 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "util/lru_cache.h"
+
+namespace starrocks::query_cache {
+class HashTableSizeHints;
+using HashTableSizeHintsRawPtr = HashTableSizeHints*;
+
+// HashTableSizeHints remembers the final sizes of the hash tables built by the plan nodes of the recent queries,
+// keyed by the fingerprint of the fragment plan and the plan node id. The same plan running again reserves its
+// hash tables by the hint at first, and avoids the repeated rehashing during building the hash tables.
+// The hint of a plan node is overwritten by its latest execution, so it follows the changes of the data.
+class HashTableSizeHints {
+public:
+    // capacity is the max number of hints kept, the least recently used ones are evicted.
+    explicit HashTableSizeHints(size_t capacity);
+    ~HashTableSizeHints() = default;
+
+    void update(uint64_t plan_fingerprint, int32_t plan_node_id, size_t ht_size);
+    // Return 0 if there is no hint of this plan node.
+    size_t lookup(uint64_t plan_fingerprint, int32_t plan_node_id);
+
+    size_t lookup_count();
+    size_t hit_count();
+
+private:
+    static std::string _make_key(uint64_t plan_fingerprint, int32_t plan_node_id);
+
+    ShardedLRUCache _cache;
+};
+} // namespace starrocks::query_cache
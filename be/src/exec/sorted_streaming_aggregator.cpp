@@ -28,6 +28,7 @@
 #include "exprs/expr_context.h"
 #include "glog/logging.h"
 #include "runtime/mem_pool.h"
+#include "simd/simd.h"
 
 namespace starrocks {
 
@@ -419,6 +420,21 @@ Status SortedStreamingAggregator::_compute_group_by(size_t chunk_size) {
     return Status::OK();
 }
 
+StatusOr<size_t> SortedStreamingAggregator::count_runs(const Columns& columns, std::vector<uint8_t>* cmp_vector) {
+    if (columns.empty() || columns[0]->empty()) {
+        return 0;
+    }
+    cmp_vector->assign(columns[0]->size(), 0);
+    const std::vector<uint8_t> dummy;
+    for (const auto& column : columns) {
+        // The first row always starts a run, since there is no previous row to compare.
+        ColumnPtr first_column = column->clone_empty();
+        ColumnSelfComparator cmp(first_column, *cmp_vector, dummy);
+        RETURN_IF_ERROR(column->accept(&cmp));
+    }
+    return SIMD::count_nonzero(*cmp_vector);
+}
+
 Status SortedStreamingAggregator::_update_states(size_t chunk_size, bool is_update) {
     // TODO: split the states
     // allocate state stage
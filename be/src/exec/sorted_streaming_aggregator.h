@@ -36,6 +36,9 @@ public:
 
     StatusOr<ChunkPtr> pull_eos_chunk();
 
+    // Count the runs of adjacent rows with equal values of |columns|, |cmp_vector| is used as the buffer.
+    static StatusOr<size_t> count_runs(const Columns& columns, std::vector<uint8_t>* cmp_vector);
+
 private:
     Status _compute_group_by(size_t chunk_size);
 
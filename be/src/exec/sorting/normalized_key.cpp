@@ -0,0 +1,167 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/sorting/normalized_key.h"
+
+#include "column/array_column.h"
+#include "column/binary_column.h"
+#include "column/column_visitor_adapter.h"
+#include "column/const_column.h"
+#include "column/fixed_length_column_base.h"
+#include "column/json_column.h"
+#include "column/map_column.h"
+#include "column/nullable_column.h"
+#include "column/struct_column.h"
+#include "exec/sorting/sort_helper.h"
+#include "exec/sorting/sorting.h"
+
+namespace starrocks {
+
+// Encode the values of a not-null column into |width| bytes per row, the nulls are handled by the caller.
+class NormalizedKeyEncoder final : public ColumnVisitorAdapter<NormalizedKeyEncoder> {
+public:
+    NormalizedKeyEncoder(bool asc, uint8_t* data, size_t key_size, size_t max_width)
+            : ColumnVisitorAdapter(this), _asc(asc), _data(data), _key_size(key_size), _max_width(max_width) {}
+
+    // the number of bytes written for each row
+    size_t width() const { return _width; }
+    // whether the encoding is the complete value, so that equal encodings mean equal values
+    bool exact() const { return _exact; }
+
+    template <typename T>
+    Status do_visit(const FixedLengthColumnBase<T>& column) {
+        if constexpr (RadixSortKey<T>::supported) {
+            using Key = typename RadixSortKey<T>::KeyType;
+            if (sizeof(Key) > _max_width) {
+                return Status::NotSupported("sort key too wide");
+            }
+            const auto& values = column.get_data();
+            for (size_t i = 0; i < values.size(); i++) {
+                Key key = RadixSortKey<T>::encode(values[i]);
+                if (!_asc) {
+                    key = ~key;
+                }
+                uint8_t* dst = _data + i * _key_size;
+                for (size_t b = 0; b < sizeof(Key); b++) {
+                    dst[b] = static_cast<uint8_t>(key >> ((sizeof(Key) - 1 - b) * 8));
+                }
+            }
+            _width = sizeof(Key);
+            return Status::OK();
+        } else {
+            return Status::NotSupported("not a normalizable sort key");
+        }
+    }
+
+    template <typename T>
+    Status do_visit(const BinaryColumnBase<T>& column) {
+        const size_t width = std::min(NormalizedKeys::kBinaryPrefixSize, _max_width);
+        if (width == 0) {
+            return Status::NotSupported("sort key too wide");
+        }
+        for (size_t i = 0; i < column.size(); i++) {
+            Slice value = column.get_slice(i);
+            uint8_t* dst = _data + i * _key_size;
+            size_t len = std::min(width, value.size);
+            memcpy(dst, value.data, len);
+            memset(dst + len, 0, width - len);
+            if (!_asc) {
+                for (size_t b = 0; b < width; b++) {
+                    dst[b] = ~dst[b];
+                }
+            }
+        }
+        _width = width;
+        _exact = false;
+        return Status::OK();
+    }
+
+    Status do_visit(const NullableColumn& column) { return Status::NotSupported("unexpected nullable column"); }
+    Status do_visit(const ConstColumn& column) { return Status::NotSupported("not a normalizable sort key"); }
+    Status do_visit(const ArrayColumn& column) { return Status::NotSupported("not a normalizable sort key"); }
+    Status do_visit(const MapColumn& column) { return Status::NotSupported("not a normalizable sort key"); }
+    Status do_visit(const StructColumn& column) { return Status::NotSupported("not a normalizable sort key"); }
+    Status do_visit(const JsonColumn& column) { return Status::NotSupported("not a normalizable sort key"); }
+
+    template <typename T>
+    Status do_visit(const ObjectColumn<T>& column) {
+        return Status::NotSupported("not a normalizable sort key");
+    }
+
+private:
+    const bool _asc;
+    uint8_t* _data;
+    const size_t _key_size;
+    const size_t _max_width;
+    size_t _width = 0;
+    bool _exact = true;
+};
+
+void build_normalized_keys(const Columns& columns, const SortDescs& sort_desc, size_t max_key_size,
+                           NormalizedKeys* keys) {
+    keys->clear();
+    if (columns.empty() || max_key_size <= 1) {
+        return;
+    }
+    const size_t num_rows = columns[0]->size();
+    // encode into rows of the max size first, and compact them once the used size is known
+    std::vector<uint8_t> data(num_rows * max_key_size, 0);
+    size_t offset = 0;
+    size_t exact_columns = 0;
+    for (size_t col = 0; col < columns.size() && offset + 1 < max_key_size; col++) {
+        const SortDesc desc = sort_desc.get_column_desc(col);
+        const Column* data_column = columns[col].get();
+        const NullData* null_data = nullptr;
+        if (data_column->is_nullable()) {
+            const auto* nullable = down_cast<const NullableColumn*>(data_column);
+            data_column = nullable->data_column().get();
+            null_data = nullable->has_null() ? &nullable->immutable_null_column_data() : nullptr;
+        }
+
+        NormalizedKeyEncoder encoder(desc.asc_order(), data.data() + offset + 1, max_key_size,
+                                     max_key_size - offset - 1);
+        if (!data_column->accept(&encoder).ok()) {
+            break;
+        }
+        // nulls are all equal, so their values are cleared, and their null byte puts them before or after
+        // all the not-null values
+        const uint8_t null_byte = desc.is_null_first() ? 0 : 2;
+        for (size_t i = 0; i < num_rows; i++) {
+            uint8_t* dst = data.data() + i * max_key_size + offset;
+            if (null_data != nullptr && (*null_data)[i]) {
+                dst[0] = null_byte;
+                memset(dst + 1, 0, encoder.width());
+            } else {
+                dst[0] = 1;
+            }
+        }
+        offset += 1 + encoder.width();
+        if (!encoder.exact()) {
+            break;
+        }
+        exact_columns++;
+    }
+    if (offset == 0) {
+        return;
+    }
+
+    keys->key_size = offset;
+    keys->exact_columns = exact_columns;
+    keys->data.resize(num_rows * offset);
+    for (size_t i = 0; i < num_rows; i++) {
+        memcpy(keys->data.data() + i * offset, data.data() + i * max_key_size, offset);
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,88 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+
+namespace starrocks {
+
+struct SortDescs;
+
+// A memcmp-able encoding of the leading sort columns of every row of a chunk, so that comparing
+// two rows is a single memcmp instead of a virtual compare_at per column.
+//
+// Each column is encoded as a null byte followed by its order-preserving value in big endian,
+// inverted for DESC. Binary columns contribute a fixed-size prefix, and encoding stops after
+// them since a prefix cannot break ties. So equal keys only tell that the first |exact_columns|
+// sort columns are equal, and the rest must still be compared.
+struct NormalizedKeys {
+    static constexpr size_t kBinaryPrefixSize = 8;
+
+    size_t key_size = 0;
+    size_t exact_columns = 0;
+    std::vector<uint8_t> data;
+
+    bool empty() const { return key_size == 0; }
+
+    const uint8_t* key(size_t row) const { return data.data() + row * key_size; }
+
+    // keys of the different chunks can be compared only if they encode the same columns
+    bool comparable(const NormalizedKeys& other) const {
+        return !empty() && key_size == other.key_size && exact_columns == other.exact_columns;
+    }
+
+    // keep the keys of the selected rows, as Column::filter does
+    void filter(const uint8_t* selection, size_t num_rows) {
+        size_t kept = 0;
+        for (size_t i = 0; i < num_rows; i++) {
+            if (selection[i]) {
+                memmove(data.data() + kept * key_size, data.data() + i * key_size, key_size);
+                kept++;
+            }
+        }
+        data.resize(kept * key_size);
+    }
+
+    void clear() {
+        key_size = 0;
+        exact_columns = 0;
+        data.clear();
+    }
+};
+
+// Build the keys from as many leading |columns| as fit into |max_key_size| bytes.
+// |keys| is left empty if not even the first column can be encoded.
+void build_normalized_keys(const Columns& columns, const SortDescs& sort_desc, size_t max_key_size,
+                           NormalizedKeys* keys);
+
+// Compare two rows by their keys if the keys are comparable, return 0 otherwise.
+// |first_column| is set to the first sort column that still has to be compared when the result is 0.
+inline int compare_normalized_keys(const NormalizedKeys& lhs, size_t lhs_row, const NormalizedKeys& rhs,
+                                   size_t rhs_row, size_t* first_column) {
+    *first_column = 0;
+    if (!lhs.comparable(rhs)) {
+        return 0;
+    }
+    int res = memcmp(lhs.key(lhs_row), rhs.key(rhs_row), lhs.key_size);
+    if (res == 0) {
+        *first_column = lhs.exact_columns;
+    }
+    return res;
+}
+
+} // namespace starrocks
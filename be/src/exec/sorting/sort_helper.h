@@ -15,6 +15,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <concepts>
 
 #include "column/nullable_column.h"
@@ -22,6 +23,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
+#include "types/date_value.h"
 #include "types/timestamp_value.h"
 #include "util/json.h"
 #include "util/orlp/pdqsort.h"
@@ -205,6 +207,100 @@ static inline Status sort_and_tie_helper_nullable(const std::atomic<bool>& cance
     return Status::OK();
 }
 
+// Normalize a fixed-width sort key into an unsigned integer that has the same order as the key,
+// so that the keys can be radix sorted byte by byte.
+template <class T, class = void>
+struct RadixSortKey {
+    static constexpr bool supported = false;
+};
+
+template <class T>
+struct RadixSortKey<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8>> {
+    static constexpr bool supported = true;
+    using KeyType = std::make_unsigned_t<T>;
+    static KeyType encode(T value) {
+        if constexpr (std::is_signed_v<T>) {
+            // flip the sign bit so that negative values precede the positive ones
+            return static_cast<KeyType>(value) ^ (KeyType(1) << (sizeof(T) * 8 - 1));
+        } else {
+            return value;
+        }
+    }
+};
+
+template <>
+struct RadixSortKey<DateValue> {
+    static constexpr bool supported = true;
+    using KeyType = RadixSortKey<JulianDate>::KeyType;
+    static KeyType encode(const DateValue& value) { return RadixSortKey<JulianDate>::encode(value.julian()); }
+};
+
+template <>
+struct RadixSortKey<TimestampValue> {
+    static constexpr bool supported = true;
+    using KeyType = RadixSortKey<Timestamp>::KeyType;
+    static KeyType encode(const TimestampValue& value) { return RadixSortKey<Timestamp>::encode(value.timestamp()); }
+};
+
+template <class PermutationType>
+struct IsRadixSortable {
+    static constexpr bool value = false;
+};
+
+template <class T>
+struct IsRadixSortable<InlinePermutation<T>> {
+    static constexpr bool value = RadixSortKey<T>::supported;
+};
+
+// Below this size comparison sort is faster than paying for the histograms of the radix sort.
+static constexpr size_t kRadixSortMinRows = 1024;
+
+// Stable LSD radix sort of the inlined values, one byte per pass. The passes in which all the keys
+// have the same byte are skipped, so keys of a narrow value range only pay for the bytes that differ.
+template <class T>
+static inline void radix_sort_inline_permutation(InlinePermuteItem<T>* first, InlinePermuteItem<T>* last,
+                                                 bool is_asc_order) {
+    using Key = typename RadixSortKey<T>::KeyType;
+    constexpr size_t kNumBytes = sizeof(Key);
+    const size_t size = last - first;
+    auto key_of = [is_asc_order](const InlinePermuteItem<T>& item) -> Key {
+        Key key = RadixSortKey<T>::encode(item.inline_value);
+        return is_asc_order ? key : static_cast<Key>(~key);
+    };
+
+    std::array<std::array<uint32_t, 256>, kNumBytes> counts{};
+    for (auto* iter = first; iter < last; iter++) {
+        Key key = key_of(*iter);
+        for (size_t b = 0; b < kNumBytes; b++) {
+            counts[b][(key >> (b * 8)) & 0xff]++;
+        }
+    }
+
+    std::vector<InlinePermuteItem<T>> buffer(size);
+    InlinePermuteItem<T>* src = first;
+    InlinePermuteItem<T>* dst = buffer.data();
+    const Key first_key = key_of(*first);
+    for (size_t b = 0; b < kNumBytes; b++) {
+        auto& count = counts[b];
+        if (count[(first_key >> (b * 8)) & 0xff] == size) {
+            continue;
+        }
+        uint32_t offset = 0;
+        for (auto& c : count) {
+            uint32_t n = c;
+            c = offset;
+            offset += n;
+        }
+        for (size_t i = 0; i < size; i++) {
+            dst[count[(key_of(src[i]) >> (b * 8)) & 0xff]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+    if (src != first) {
+        std::copy(src, src + size, first);
+    }
+}
+
 template <class DataComparator, class PermutationType>
 static inline Status sort_and_tie_helper(const std::atomic<bool>& cancel, const Column* column, bool is_asc_order,
                                          PermutationType& permutation, Tie& tie, DataComparator cmp,
@@ -235,6 +331,15 @@ static inline Status sort_and_tie_helper(const std::atomic<bool>& cancel, const
                 }
             }
             *limited = limit + equal_count;
+        } else if constexpr (IsRadixSortable<PermutationType>::value) {
+            if (last_iter - first_iter >= kRadixSortMinRows) {
+                radix_sort_inline_permutation(permutation.data() + first_iter, permutation.data() + last_iter,
+                                              is_asc_order);
+            } else if (is_asc_order) {
+                ::pdqsort(begin, end, lesser);
+            } else {
+                ::pdqsort(begin, end, greater);
+            }
         } else {
             if (is_asc_order) {
                 ::pdqsort(begin, end, lesser);
@@ -0,0 +1,55 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/block_manager.h"
+
+#include <fmt/format.h>
+
+#include <cstring>
+
+#include "io/input_stream.h"
+
+namespace starrocks::spill {
+
+Status ReadAheadBuffer::read_fully(io::InputStreamWrapper* input, size_t unconsumed, void* data, size_t count) {
+    auto* dst = reinterpret_cast<uint8_t*>(data);
+    const size_t buffered = _buffer.size() - _pos;
+    // bytes of the block still in the stream
+    const size_t stream_remaining = unconsumed - buffered;
+
+    size_t n = std::min(count, buffered);
+    memcpy(dst, _buffer.data() + _pos, n);
+    _pos += n;
+    dst += n;
+    count -= n;
+    if (count == 0) {
+        return Status::OK();
+    }
+    if (count > stream_remaining) {
+        return Status::EndOfFile("no more data in this block");
+    }
+
+    if (count >= _capacity) {
+        return input->read_fully(dst, count);
+    }
+    size_t to_read = std::min(_capacity, stream_remaining);
+    _buffer.resize(to_read);
+    _pos = 0;
+    RETURN_IF_ERROR(input->read_fully(_buffer.data(), to_read));
+    memcpy(dst, _buffer.data(), count);
+    _pos = count;
+    return Status::OK();
+}
+
+} // namespace starrocks::spill
@@ -19,8 +19,13 @@
 #include "common/status.h"
 #include "common/statusor.h"
 #include "gen_cpp/Types_types.h"
+#include "util/raw_container.h"
 #include "util/slice.h"
 
+namespace starrocks::io {
+class InputStreamWrapper;
+}
+
 namespace starrocks::spill {
 
 class BlockReader;
@@ -70,6 +75,23 @@ protected:
     const Block* _block = nullptr;
 };
 
+// ReadAheadBuffer serves the sequential reads of a BlockReader from one large read of the underlying stream,
+// so that a chunk header, its attachment and the chunks after it cost one I/O instead of two per chunk.
+// Reads larger than the buffer go to the stream directly.
+class ReadAheadBuffer {
+public:
+    explicit ReadAheadBuffer(size_t capacity) : _capacity(capacity) {}
+
+    // read exactly |count| bytes from |input|, |unconsumed| is the number of bytes of the block that have not been
+    // returned by this buffer yet.
+    Status read_fully(io::InputStreamWrapper* input, size_t unconsumed, void* data, size_t count);
+
+private:
+    const size_t _capacity;
+    raw::RawString _buffer;
+    size_t _pos = 0;
+};
+
 struct AcquireBlockOptions {
     TUniqueId query_id;
     TUniqueId fragment_instance_id;
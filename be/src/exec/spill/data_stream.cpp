@@ -19,6 +19,7 @@
 #include "exec/spill/input_stream.h"
 #include "exec/spill/serde.h"
 #include "exec/spill/spiller.h"
+#include "exec/workgroup/work_group.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::spill {
@@ -96,6 +97,9 @@ Status BlockSpillOutputDataStream::flush() {
         RETURN_IF_ERROR(_cur_block->flush());
         auto flush_bytes = GET_METRICS(_cur_block->is_remote(), _spiller->metrics(), flush_bytes);
         COUNTER_UPDATE(flush_bytes, block_size);
+        if (const auto& wg = _spiller->options().wg; wg != nullptr) {
+            wg->incr_io_bytes(block_size);
+        }
         TRACE_SPILL_LOG << fmt::format("flush block[{}]", _cur_block->debug_string());
     }
     RETURN_IF_ERROR(_block_manager->release_block(_cur_block));
@@ -14,6 +14,7 @@
 
 #include "exec/spill/dir_manager.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <regex>
 
@@ -102,17 +103,36 @@ Status DirManager::init(const std::string& spill_dirs) {
 }
 
 StatusOr<DirPtr> DirManager::acquire_writable_dir(const AcquireDirOptions& opts) {
-    // for the case of multiple dirs, we randomly select one as the start
-    // and then try one by one until we find the first one that meets the capacity requirements.
+    // Order the dirs by the number of blocks being written and then the free space, the load of dirs is
+    // snapshotted since it changes concurrently. The dirs are visited from a random start, so that the ties are
+    // broken randomly by the stable sort.
+    struct Candidate {
+        size_t idx;
+        int32_t num_writers;
+        int64_t free_size;
+    };
     size_t start_idx = 0;
     if (_dirs.size() > 1) {
         std::lock_guard l(_mutex);
         start_idx = _rand.Next() % _dirs.size();
     }
+    std::vector<Candidate> candidates;
+    candidates.reserve(_dirs.size());
     for (size_t i = 0; i < _dirs.size(); i++) {
         size_t idx = (start_idx + i) % _dirs.size();
-        if (_dirs[idx]->inc_size(opts.data_size)) {
-            return _dirs[idx];
+        const auto& dir = _dirs[idx];
+        candidates.push_back({idx, dir->num_writers(), dir->get_max_size() - dir->get_current_size()});
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs) {
+        if (lhs.num_writers != rhs.num_writers) {
+            return lhs.num_writers < rhs.num_writers;
+        }
+        return lhs.free_size > rhs.free_size;
+    });
+    // try one by one until we find the first one that meets the capacity requirements.
+    for (const auto& candidate : candidates) {
+        if (_dirs[candidate.idx]->inc_size(opts.data_size)) {
+            return _dirs[candidate.idx];
         }
     }
     return Status::CapacityLimitExceed("no writable spill storage directories");
@@ -55,6 +55,11 @@ public:
 
     int64_t get_max_size() const { return _max_size; }
 
+    // The number of blocks being written in this directory, it's used as the queue depth of the disk.
+    int32_t num_writers() const { return _num_writers.load(); }
+    void inc_writers() { _num_writers++; }
+    void dec_writers() { _num_writers--; }
+
     virtual bool is_remote() const { return false; }
 
 protected:
@@ -62,6 +67,7 @@ protected:
     std::shared_ptr<FileSystem> _fs;
     int64_t _max_size;
     std::atomic<int64_t> _current_size = 0;
+    std::atomic<int32_t> _num_writers = 0;
 };
 using DirPtr = std::shared_ptr<Dir>;
 
@@ -85,6 +91,8 @@ struct AcquireDirOptions {
 
 // DirManager is used to manage all spill-available directories,
 // BlockManager should rely on DirManager to decide which directory to put Block in.
+// A Block is put in the directory with the fewest blocks being written and then the most free space, so that
+// the blocks of a large spill are striped across all the disks.
 // DirManager is thread-safe.
 class DirManager {
 public:
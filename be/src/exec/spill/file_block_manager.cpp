@@ -16,6 +16,7 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "exec/spill/common.h"
 #include "fmt/format.h"
 #include "gen_cpp/Types_types.h"
@@ -40,6 +41,7 @@ public:
         TRACE_SPILL_LOG << "delete spill container file: " << path();
         WARN_IF_ERROR(_dir->fs()->delete_file(path()), fmt::format("cannot delete spill container file: {}", path()));
         _dir->dec_size(_acquired_data_size);
+        end_write();
         // try to delete related dir, only the last one can success, we ignore the error
         (void)(_dir->fs()->delete_dir(parent_path()));
     }
@@ -67,6 +69,20 @@ public:
 
     Status flush();
 
+    // A container is being written from acquiring a block in it to releasing the block.
+    void begin_write() {
+        if (!_writing) {
+            _writing = true;
+            _dir->inc_writers();
+        }
+    }
+    void end_write() {
+        if (_writing) {
+            _writing = false;
+            _dir->dec_writers();
+        }
+    }
+
     bool pre_allocate(size_t allocate_size) {
         if (_dir->inc_size(allocate_size)) {
             _acquired_data_size += allocate_size;
@@ -94,6 +110,7 @@ private:
     size_t _data_size = 0;
     // acquired data size from Dir
     size_t _acquired_data_size = 0;
+    bool _writing = false;
 };
 
 Status FileBlockContainer::open() {
@@ -152,6 +169,9 @@ public:
 
 private:
     std::unique_ptr<io::InputStreamWrapper> _readable;
+    std::unique_ptr<ReadAheadBuffer> _read_ahead =
+            config::spill_read_ahead_bytes > 0 ? std::make_unique<ReadAheadBuffer>(config::spill_read_ahead_bytes)
+                                               : nullptr;
     size_t _length = 0;
     size_t _offset = 0;
 };
@@ -202,6 +222,12 @@ Status FileBlockReader::read_fully(void* data, int64_t count) {
         return Status::EndOfFile("no more data in this block");
     }
 
+    if (_read_ahead != nullptr) {
+        RETURN_IF_ERROR(_read_ahead->read_fully(_readable.get(), _length - _offset, data, count));
+        _offset += count;
+        return Status::OK();
+    }
+
     ASSIGN_OR_RETURN(auto read_len, _readable->read(data, count));
     RETURN_IF(read_len == 0, Status::EndOfFile("no more data in this block"));
     RETURN_IF(read_len != count, Status::InternalError(fmt::format(
@@ -231,6 +257,7 @@ StatusOr<BlockPtr> FileBlockManager::acquire_block(const AcquireBlockOptions& op
     ASSIGN_OR_RETURN(auto dir, _dir_mgr->acquire_writable_dir(acquire_dir_opts));
     ASSIGN_OR_RETURN(auto block_container,
                      get_or_create_container(dir, opts.fragment_instance_id, opts.plan_node_id, opts.name));
+    block_container->begin_write();
     auto res = std::make_shared<FileBlock>(block_container);
     res->set_is_remote(dir->is_remote());
     return res;
@@ -240,6 +267,7 @@ Status FileBlockManager::release_block(const BlockPtr& block) {
     auto file_block = down_cast<FileBlock*>(block.get());
     auto container = file_block->container();
     TRACE_SPILL_LOG << "release block: " << block->debug_string();
+    container->end_write();
     RETURN_IF_ERROR(container->close());
     _containers.emplace_back(std::move(container));
     return Status::OK();
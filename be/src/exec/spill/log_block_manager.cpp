@@ -49,6 +49,7 @@ public:
         TRACE_SPILL_LOG << "delete spill container file: " << path();
         WARN_IF_ERROR(_dir->fs()->delete_file(path()), fmt::format("cannot delete spill container file: {}", path()));
         _dir->dec_size(_acquired_data_size);
+        end_write();
         // try to delete related dir, only the last one can success, we ignore the error
         (void)(_dir->fs()->delete_dir(parent_path()));
     }
@@ -72,6 +73,20 @@ public:
     std::string parent_path() const { return fmt::format("{}/{}", _dir->dir(), print_id(_query_id)); }
     uint64_t id() const { return _id; }
 
+    // A container is being written from acquiring a block in it to releasing the block.
+    void begin_write() {
+        if (!_writing) {
+            _writing = true;
+            _dir->inc_writers();
+        }
+    }
+    void end_write() {
+        if (_writing) {
+            _writing = false;
+            _dir->dec_writers();
+        }
+    }
+
     bool pre_allocate(size_t allocate_size) {
         if (_dir->inc_size(allocate_size)) {
             _acquired_data_size += allocate_size;
@@ -105,6 +120,7 @@ private:
     size_t _data_size = 0;
     // acquired data size from Dir
     size_t _acquired_data_size = 0;
+    bool _writing = false;
 };
 
 Status LogBlockContainer::open() {
@@ -172,6 +188,9 @@ public:
 
 private:
     std::unique_ptr<io::InputStreamWrapper> _readable;
+    std::unique_ptr<ReadAheadBuffer> _read_ahead =
+            config::spill_read_ahead_bytes > 0 ? std::make_unique<ReadAheadBuffer>(config::spill_read_ahead_bytes)
+                                               : nullptr;
     size_t _offset = 0;
     size_t _length = 0;
 };
@@ -229,6 +248,12 @@ Status LogBlockReader::read_fully(void* data, int64_t count) {
         return Status::EndOfFile("no more data in this block");
     }
 
+    if (_read_ahead != nullptr) {
+        RETURN_IF_ERROR(_read_ahead->read_fully(_readable.get(), _length - _offset, data, count));
+        _offset += count;
+        return Status::OK();
+    }
+
     ASSIGN_OR_RETURN(auto read_len, _readable->read(data, count));
     RETURN_IF(read_len == 0, Status::EndOfFile("no more data in this block"));
     RETURN_IF(read_len != count, Status::InternalError(fmt::format(
@@ -271,6 +296,7 @@ StatusOr<BlockPtr> LogBlockManager::acquire_block(const AcquireBlockOptions& opt
 
     ASSIGN_OR_RETURN(auto block_container, get_or_create_container(dir, opts.fragment_instance_id, opts.plan_node_id,
                                                                    opts.name, opts.direct_io));
+    block_container->begin_write();
     auto res = std::make_shared<LogBlock>(block_container, block_container->size());
     res->set_is_remote(dir->is_remote());
     return res;
@@ -280,6 +306,7 @@ Status LogBlockManager::release_block(const BlockPtr& block) {
     auto log_block = down_cast<LogBlock*>(block.get());
     auto container = log_block->container();
     TRACE_SPILL_LOG << "release block: " << block->debug_string();
+    container->end_write();
     bool is_full = container->size() >= _max_container_bytes;
     if (is_full) {
         RETURN_IF_ERROR(container->close());
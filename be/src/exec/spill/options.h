@@ -44,7 +44,7 @@ private:
 };
 
 // using ChunkBuilder = std::function<ChunkUniquePtr()>;
-enum class SpillFormaterType { NONE, SPILL_BY_COLUMN };
+enum class SpillFormaterType { NONE, SPILL_BY_COLUMN, SPILL_BY_COLUMN_COMPRESSED };
 
 // spill options
 struct SpilledOptions {
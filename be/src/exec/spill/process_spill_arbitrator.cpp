@@ -0,0 +1,39 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/process_spill_arbitrator.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+
+namespace starrocks::spill {
+
+int64_t ProcessSpillArbitrator::spill_bar_bytes(int64_t process_consumption, int64_t process_limit,
+                                                int64_t min_bytes) {
+    const double soft_ratio = config::spill_process_mem_soft_limit_ratio;
+    if (process_limit <= 0 || soft_ratio <= 0 || soft_ratio >= 1) {
+        return -1;
+    }
+    const auto soft_limit = static_cast<int64_t>(process_limit * soft_ratio);
+    if (process_consumption < soft_limit) {
+        return -1;
+    }
+    // the bar is the memory left before the hard limit: it is the whole headroom at the soft limit and
+    // falls to 0 at the hard limit
+    const int64_t bar = std::max<int64_t>(0, process_limit - process_consumption);
+    return std::max(bar, min_bytes);
+}
+
+} // namespace starrocks::spill
@@ -0,0 +1,41 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace starrocks::spill {
+
+// ProcessSpillArbitrator decides which spillable operators, across all the queries, should spill when the
+// process memory is close to its limit, so that memory pressure from concurrent queries is resolved by
+// spilling instead of cancelling queries.
+// Above the soft limit (config::spill_process_mem_soft_limit_ratio of the process limit), an operator is
+// picked if its revocable memory is at least the bar, which falls linearly from the whole headroom between
+// the soft and the hard limit down to spill_operator_min_bytes as the consumption approaches the hard limit.
+// So the operators that release the most memory spill first, and more of them spill as the pressure grows.
+class ProcessSpillArbitrator {
+public:
+    // the minimum revocable bytes of an operator to spill under the process memory pressure,
+    // or -1 if the process memory is below the soft limit.
+    static int64_t spill_bar_bytes(int64_t process_consumption, int64_t process_limit, int64_t min_bytes);
+
+    static bool should_spill(int64_t process_consumption, int64_t process_limit, int64_t revocable_bytes,
+                             int64_t min_bytes) {
+        int64_t bar = spill_bar_bytes(process_consumption, process_limit, min_bytes);
+        return bar >= 0 && revocable_bytes > 0 && revocable_bytes >= bar;
+    }
+};
+
+} // namespace starrocks::spill
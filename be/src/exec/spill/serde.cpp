@@ -14,15 +14,19 @@
 
 #include "exec/spill/serde.h"
 
+#include <atomic>
 #include <cstring>
 
+#include "common/config.h"
 #include "exec/spill/options.h"
 #include "exec/spill/spiller.h"
+#include "exec/workgroup/work_group.h"
 #include "gen_cpp/types.pb.h"
 #include "gutil/port.h"
 #include "runtime/runtime_state.h"
 #include "serde/column_array_serde.h"
 #include "serde/encode_context.h"
+#include "util/compression/block_compression.h"
 #include "util/raw_container.h"
 
 namespace starrocks::spill {
@@ -47,7 +51,7 @@ public:
     Status serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
                      const SpillOutputDataStreamPtr& output, bool aligned) override;
 
-private:
+protected:
     // data format
     // header|encode levels|attachment...
     // header:
@@ -205,12 +209,257 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
 
     auto restore_bytes = GET_METRICS(is_read_from_remote, _parent->metrics(), restore_bytes);
     COUNTER_UPDATE(restore_bytes, attachment_size);
+    if (const auto& wg = _parent->options().wg; wg != nullptr) {
+        wg->incr_io_bytes(attachment_size);
+    }
     TRACE_SPILL_LOG << "deserialize chunk from block: " << reader->debug_string()
                     << ", encoded size: " << attachment_size << ", original size: " << chunk->bytes_usage();
     return chunk;
 }
 
+// ColumnarSerde with a per-column block codec on top of the column encoding. The codec of each column is
+// picked by measuring the ratio of every candidate on sampled chunks, so low-entropy columns get ZSTD,
+// cheap-to-compress ones LZ4 and incompressible ones are stored as they are.
+class CompressedColumnarSerde final : public ColumnarSerde {
+public:
+    CompressedColumnarSerde(Spiller* parent, ChunkBuilder chunk_builder)
+            : ColumnarSerde(parent, std::move(chunk_builder)) {}
+    ~CompressedColumnarSerde() override = default;
+
+    Status prepare() override;
+
+    StatusOr<ChunkUniquePtr> deserialize(SerdeContext& ctx, BlockReader* reader) override;
+    Status serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
+                     const SpillOutputDataStreamPtr& output, bool aligned) override;
+
+private:
+    // data format
+    // header|column...
+    // header:
+    // i32 sequence_id|i64 attachment size
+    // column:
+    // u32 encode level|u8 codec|u32 encoded size|u32 stored size|column data
+    static constexpr int32_t COMPRESSED_SEQUENCE_MAGIC_ID = 0xfacf;
+    static constexpr size_t COLUMN_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t) * 2;
+    // the first SAMPLING_CHUNKS chunks and then one of every RESAMPLE_INTERVAL chunks try all the codecs
+    static constexpr size_t SAMPLING_CHUNKS = 4;
+    static constexpr size_t RESAMPLE_INTERVAL = 256;
+    // a more expensive codec is only picked if it saves at least this fraction over the cheaper one
+    static constexpr double MIN_SAVING_RATIO = 0.1;
+
+    const BlockCompressionCodec* _get_codec(CompressionTypePB type) const {
+        return type == CompressionTypePB::LZ4 ? _lz4_codec : type == CompressionTypePB::ZSTD ? _zstd_codec : nullptr;
+    }
+
+    // compress |input| by |type| into |ctx.compress_buffer|, return the compressed size, or input.size
+    // when the codec does not apply.
+    StatusOr<size_t> _compress(SerdeContext& ctx, CompressionTypePB type, const Slice& input) const;
+
+    const BlockCompressionCodec* _lz4_codec = nullptr;
+    const BlockCompressionCodec* _zstd_codec = nullptr;
+    std::atomic<size_t> _num_serialized_chunks = 0;
+    // protected by _mutex
+    std::vector<CompressionTypePB> _column_codecs;
+};
+
+Status CompressedColumnarSerde::prepare() {
+    RETURN_IF_ERROR(ColumnarSerde::prepare());
+    RETURN_IF_ERROR(get_block_compression_codec(CompressionTypePB::LZ4, &_lz4_codec));
+    RETURN_IF_ERROR(get_block_compression_codec(CompressionTypePB::ZSTD, &_zstd_codec));
+    std::unique_lock l(_mutex);
+    _column_codecs.assign(_parent->chunk_builder().column_number(), CompressionTypePB::LZ4);
+    return Status::OK();
+}
+
+StatusOr<size_t> CompressedColumnarSerde::_compress(SerdeContext& ctx, CompressionTypePB type,
+                                                    const Slice& input) const {
+    const auto* codec = _get_codec(type);
+    if (codec == nullptr || codec->exceed_max_input_size(input.size)) {
+        return input.size;
+    }
+    ctx.compress_buffer.resize(codec->max_compressed_len(input.size));
+    Slice compressed(ctx.compress_buffer.data(), ctx.compress_buffer.size());
+    RETURN_IF_ERROR(codec->compress(input, &compressed));
+    return compressed.size;
+}
+
+Status CompressedColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
+                                          const SpillOutputDataStreamPtr& output, bool aligned) {
+    raw::RawString& serialize_buffer = ctx.serialize_buffer;
+    {
+        SCOPED_TIMER(_parent->metrics().serialize_timer);
+        const size_t ALIGNED_SIZE = aligned ? AlignedBuffer::PAGE_SIZE : 1;
+        const auto& columns = chunk->columns();
+        const auto encode_levels = _get_encode_levels();
+        std::vector<CompressionTypePB> codecs;
+        {
+            std::shared_lock l(_mutex);
+            codecs = _column_codecs;
+        }
+        const size_t chunk_seq = _num_serialized_chunks.fetch_add(1);
+        const bool sampling = chunk_seq < SAMPLING_CHUNKS || chunk_seq % RESAMPLE_INTERVAL == 0;
+
+        size_t max_size = HEADER_SIZE + serde::EncodeContext::STREAMVBYTE_PADDING_SIZE;
+        for (size_t i = 0; i < columns.size(); i++) {
+            size_t encoded = serde::ColumnArraySerde::max_serialized_size(*columns[i], encode_levels[i]);
+            max_size += COLUMN_HEADER_SIZE + std::max({encoded, _lz4_codec->max_compressed_len(encoded),
+                                                       _zstd_codec->max_compressed_len(encoded)});
+        }
+        serialize_buffer.resize(ALIGN_UP(max_size, ALIGNED_SIZE));
+        uint8_t* buf = reinterpret_cast<uint8_t*>(serialize_buffer.data()) + HEADER_SIZE;
+
+        std::vector<std::pair<uint64_t, uint64_t>> column_stats;
+        column_stats.reserve(columns.size());
+        int padding_size = 0;
+        for (size_t i = 0; i < columns.size(); i++) {
+            ctx.encode_buffer.resize(serde::ColumnArraySerde::max_serialized_size(*columns[i], encode_levels[i]));
+            auto* begin = reinterpret_cast<uint8_t*>(ctx.encode_buffer.data());
+            auto* end = serde::ColumnArraySerde::serialize(*columns[i], begin, false, encode_levels[i]);
+            if (UNLIKELY(end == nullptr)) {
+                return Status::InternalError("unsupported column occurs in spill serialize phase");
+            }
+            const Slice encoded(begin, end - begin);
+            column_stats.emplace_back(columns[i]->byte_size(), encoded.size);
+            if (serde::EncodeContext::enable_encode_integer(encode_levels[i])) {
+                padding_size = serde::EncodeContext::STREAMVBYTE_PADDING_SIZE;
+            }
+
+            if (sampling) {
+                // candidates are ordered from the cheapest to the most expensive
+                CompressionTypePB best = CompressionTypePB::NO_COMPRESSION;
+                size_t best_size = encoded.size;
+                for (auto type : {CompressionTypePB::LZ4, CompressionTypePB::ZSTD}) {
+                    ASSIGN_OR_RETURN(auto size, _compress(ctx, type, encoded));
+                    if (size < best_size * (1 - MIN_SAVING_RATIO)) {
+                        best = type;
+                        best_size = size;
+                    }
+                }
+                codecs[i] = best;
+            }
+
+            size_t stored_size = encoded.size;
+            const uint8_t* stored = begin;
+            if (codecs[i] != CompressionTypePB::NO_COMPRESSION) {
+                ASSIGN_OR_RETURN(stored_size, _compress(ctx, codecs[i], encoded));
+                if (stored_size < encoded.size) {
+                    stored = reinterpret_cast<const uint8_t*>(ctx.compress_buffer.data());
+                } else {
+                    codecs[i] = CompressionTypePB::NO_COMPRESSION;
+                    stored_size = encoded.size;
+                }
+            }
+
+            UNALIGNED_STORE32(buf, encode_levels[i]);
+            buf += sizeof(uint32_t);
+            *buf = static_cast<uint8_t>(codecs[i]);
+            buf += sizeof(uint8_t);
+            UNALIGNED_STORE32(buf, encoded.size);
+            buf += sizeof(uint32_t);
+            UNALIGNED_STORE32(buf, stored_size);
+            buf += sizeof(uint32_t);
+            memcpy(buf, stored, stored_size);
+            buf += stored_size;
+        }
+        _update_encode_stats(column_stats);
+        if (sampling) {
+            std::unique_lock l(_mutex);
+            _column_codecs = codecs;
+        }
+
+        size_t content_length = buf - reinterpret_cast<uint8_t*>(serialize_buffer.data());
+        auto align_size = ALIGN_UP(content_length + padding_size, ALIGNED_SIZE);
+        serialize_buffer.resize(align_size);
+        UNALIGNED_STORE32(serialize_buffer.data() + SEQUENCE_OFFSET, COMPRESSED_SEQUENCE_MAGIC_ID);
+        UNALIGNED_STORE64(serialize_buffer.data() + ATTACHMENT_SIZE_OFFSET, align_size - HEADER_SIZE);
+    }
+    size_t written_bytes = serialize_buffer.size();
+    RETURN_IF_ERROR(output->append(state, {Slice(serialize_buffer.data(), written_bytes)}, written_bytes));
+    return Status::OK();
+}
+
+StatusOr<ChunkUniquePtr> CompressedColumnarSerde::deserialize(SerdeContext& ctx, BlockReader* reader) {
+    char header_buffer[HEADER_SIZE];
+    bool is_read_from_remote = reader->block()->is_remote();
+    auto read_io_timer = GET_METRICS(is_read_from_remote, _parent->metrics(), read_io_timer);
+    auto read_io_count = GET_METRICS(is_read_from_remote, _parent->metrics(), read_io_count);
+
+    {
+        SCOPED_TIMER(read_io_timer);
+        COUNTER_UPDATE(read_io_count, 1);
+        RETURN_IF_ERROR(reader->read_fully(header_buffer, HEADER_SIZE));
+    }
+
+    int32_t sequence_id = UNALIGNED_LOAD32(header_buffer + SEQUENCE_OFFSET);
+    int64_t attachment_size = UNALIGNED_LOAD64(header_buffer + ATTACHMENT_SIZE_OFFSET);
+    if (sequence_id != COMPRESSED_SEQUENCE_MAGIC_ID) {
+        return Status::InternalError(
+                fmt::format("sequence id mismatch {} vs {}", sequence_id, COMPRESSED_SEQUENCE_MAGIC_ID));
+    }
+
+    auto chunk = _chunk_builder();
+    auto& columns = chunk->columns();
+
+    auto& serialize_buffer = ctx.serialize_buffer;
+    serialize_buffer.resize(attachment_size);
+    auto buf = reinterpret_cast<uint8_t*>(serialize_buffer.data());
+    {
+        SCOPED_TIMER(read_io_timer);
+        COUNTER_UPDATE(read_io_count, 1);
+        auto st = reader->read_fully(buf, attachment_size);
+        RETURN_IF(st.is_end_of_file(), Status::InternalError("not found enough data in block"));
+        RETURN_IF_ERROR(st);
+    }
+
+    SCOPED_TIMER(_parent->metrics().deserialize_timer);
+    const uint8_t* read_cursor = buf;
+    for (size_t i = 0; i < columns.size(); i++) {
+        uint32_t encode_level = UNALIGNED_LOAD32(read_cursor);
+        read_cursor += sizeof(uint32_t);
+        auto codec_type = static_cast<CompressionTypePB>(*read_cursor);
+        read_cursor += sizeof(uint8_t);
+        uint32_t encoded_size = UNALIGNED_LOAD32(read_cursor);
+        read_cursor += sizeof(uint32_t);
+        uint32_t stored_size = UNALIGNED_LOAD32(read_cursor);
+        read_cursor += sizeof(uint32_t);
+
+        const uint8_t* column_data = read_cursor;
+        if (codec_type != CompressionTypePB::NO_COMPRESSION) {
+            const auto* codec = _get_codec(codec_type);
+            if (UNLIKELY(codec == nullptr)) {
+                return Status::InternalError(
+                        fmt::format("unknown spill column codec {}", static_cast<int>(codec_type)));
+            }
+            // streamvbyte decoding may read past the end of the encoded data
+            ctx.encode_buffer.resize(encoded_size + serde::EncodeContext::STREAMVBYTE_PADDING_SIZE);
+            Slice decompressed(ctx.encode_buffer.data(), encoded_size);
+            RETURN_IF_ERROR(codec->decompress(Slice(read_cursor, stored_size), &decompressed));
+            if (UNLIKELY(decompressed.size != encoded_size)) {
+                return Status::InternalError(fmt::format("spill column decompressed size mismatch {} vs {}",
+                                                         decompressed.size, encoded_size));
+            }
+            column_data = reinterpret_cast<const uint8_t*>(ctx.encode_buffer.data());
+        }
+        serde::ColumnArraySerde::deserialize(column_data, columns[i].get(), false, encode_level);
+        read_cursor += stored_size;
+    }
+
+    auto restore_bytes = GET_METRICS(is_read_from_remote, _parent->metrics(), restore_bytes);
+    COUNTER_UPDATE(restore_bytes, attachment_size);
+    if (const auto& wg = _parent->options().wg; wg != nullptr) {
+        wg->incr_io_bytes(attachment_size);
+    }
+    TRACE_SPILL_LOG << "deserialize compressed chunk from block: " << reader->debug_string()
+                    << ", encoded size: " << attachment_size << ", original size: " << chunk->bytes_usage();
+    return chunk;
+}
+
 StatusOr<SerdePtr> Serde::create_serde(Spiller* parent) {
+    if (parent->options().spill_type == SpillFormaterType::SPILL_BY_COLUMN_COMPRESSED ||
+        (parent->options().spill_type == SpillFormaterType::SPILL_BY_COLUMN &&
+         config::spill_enable_column_compression)) {
+        return std::make_shared<CompressedColumnarSerde>(parent, parent->chunk_builder());
+    }
     return std::make_shared<ColumnarSerde>(parent, parent->chunk_builder());
 }
 } // namespace starrocks::spill
@@ -32,6 +32,8 @@ class ChunkBuilder;
 
 enum class SerdeType {
     BY_COLUMN,
+    // BY_COLUMN with a block codec chosen for each column by measured compression ratio
+    BY_COLUMN_COMPRESSED,
 };
 
 struct AlignedBuffer {
@@ -86,6 +88,9 @@ private:
 
 struct SerdeContext {
     raw::RawString serialize_buffer;
+    // scratch buffers of BY_COLUMN_COMPRESSED for the encoded and the compressed data of one column
+    raw::RawString encode_buffer;
+    raw::RawString compress_buffer;
 };
 class Spiller;
 // Serde is used to serialize and deserialize spilled data.
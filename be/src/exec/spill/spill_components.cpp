@@ -252,6 +252,7 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
             const auto& mem_table = partition->spill_writer->mem_table();
             // partition not in memory
             if (!partition->in_mem && partition->level < config::spill_max_partition_level &&
+                !partition->single_hash() &&
                 mem_table->mem_usage() + partition->bytes > options().spill_mem_table_bytes_size) {
                 RETURN_IF_ERROR(mem_table->done());
                 partition->in_mem = false;
@@ -421,7 +422,7 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
     auto io_task = std::any_cast<SpillIOTaskContextPtr>(yield_ctx.task_context_data);
     auto& flush_ctx = std::static_pointer_cast<PartitionedFlushContext>(io_task)->split_stage_ctx;
 
-    // TODO: check skew data here
+    // skew: a child whose rows all share one hash value is marked by observe_hashes and never split again
     for (; flush_ctx.spliting_idx < splitting_partitions.size(); flush_ctx.spliting_idx++) {
         // split stage
         auto partition = splitting_partitions[flush_ctx.spliting_idx];
@@ -455,6 +456,12 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
         RETURN_IF(!st.is_ok_or_eof(), st);
         TRACE_SPILL_LOG << "reader:" << flush_ctx.reader.get() << " read rows:" << flush_ctx.reader->read_rows();
         DCHECK_EQ(flush_ctx.left->num_rows + flush_ctx.right->num_rows, partition->num_rows);
+        for (const auto* child : {flush_ctx.left.get(), flush_ctx.right.get()}) {
+            if (child->single_hash()) {
+                TRACE_SPILL_LOG << "partition " << child->debug_string()
+                                << " holds a single hash value and will not be split further";
+            }
+        }
 
         flush_ctx.left->spill_writer->acquire_mem_table();
         flush_ctx.right->spill_writer->acquire_mem_table();
@@ -544,6 +551,9 @@ Status PartitionedSpillerWriter::_split_partition(workgroup::YieldContext& yield
                 }
 #endif
 
+                left_partition->observe_hashes(hash_data.data(), selection.data(), 0, left_channel_size);
+                right_partition->observe_hashes(hash_data.data(), selection.data(), left_channel_size,
+                                                hash_data.size() - left_channel_size);
                 if (left_channel_size > 0) {
                     left_partition->num_rows += left_channel_size;
                     RETURN_IF_ERROR(left_mem_table->append_selective(*chunk, selection.data(), 0, left_channel_size));
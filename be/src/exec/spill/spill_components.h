@@ -206,12 +206,33 @@ struct SpilledPartition : public SpillPartitionInfo {
     }
 
     std::string debug_string() {
-        return fmt::format("[id={},bytes={},mem_size={},num_rows={},in_mem={},is_spliting={}]", partition_id, bytes,
-                           mem_size, num_rows, in_mem, is_spliting);
+        return fmt::format("[id={},bytes={},mem_size={},num_rows={},in_mem={},is_spliting={},single_hash={}]",
+                           partition_id, bytes, mem_size, num_rows, in_mem, is_spliting, single_hash());
     }
 
+    // record the hash values of the rows written to this partition while splitting its parent
+    void observe_hashes(const uint32_t* hashes, const uint32_t* selection, size_t from, size_t size) {
+        for (size_t i = from; i < from + size; ++i) {
+            const uint32_t hash = hashes[selection[i]];
+            if (!_has_hash) {
+                _has_hash = true;
+                _hash = hash;
+            }
+            _all_same_hash &= hash == _hash;
+        }
+    }
+
+    // all the rows of the partition have the same hash value, e.g. they are all of one hot key,
+    // so splitting it again never separates any row.
+    bool single_hash() const { return _has_hash && _all_same_hash; }
+
     bool is_spliting = false;
     std::unique_ptr<RawSpillerWriter> spill_writer;
+
+private:
+    bool _has_hash = false;
+    bool _all_same_hash = true;
+    uint32_t _hash = 0;
 };
 
 class PartitionedSpillerWriter final : public SpillerWriter {
@@ -274,9 +274,11 @@ Status PartitionedSpillerWriter::spill(RuntimeState* state, const ChunkPtr& chun
         SCOPED_TIMER(_spiller->metrics().shuffle_timer);
         std::vector<uint32_t> shuffle_result;
         shuffle(shuffle_result, down_cast<SpillHashColumn*>(hash_column.get()));
+        const auto& hash_data = down_cast<SpillHashColumn*>(hash_column.get())->get_data();
         process_partition_data(chunk, shuffle_result,
-                               [&chunk](SpilledPartition* partition, const std::vector<uint32_t>& selection,
-                                        int32_t from, int32_t size) {
+                               [&chunk, &hash_data](SpilledPartition* partition, const std::vector<uint32_t>& selection,
+                                                    int32_t from, int32_t size) {
+                                   partition->observe_hashes(hash_data.data(), selection.data(), from, size);
                                    auto mem_table = partition->spill_writer->mem_table();
                                    (void)mem_table->append_selective(*chunk, selection.data(), from, size);
                                    partition->mem_size = mem_table->mem_usage();
@@ -17,8 +17,14 @@
 
 #include "exec/stream/aggregate/agg_group_state.h"
 
+#include <atomic>
+
+#include "exec/spill/dir_manager.h"
+#include "exec/stream/state/spillable_state_table.h"
 #include "exprs/agg/stream/stream_detail_state.h"
 #include "fmt/format.h"
+#include "runtime/exec_env.h"
+#include "util/uid_util.h"
 
 namespace starrocks::stream {
 
@@ -56,22 +62,38 @@ Status AggGroupState::prepare(RuntimeState* state) {
         }
     }
 
+    StateTableFactory make_state_table;
     if (_params->is_testing) {
-        RETURN_IF_ERROR(_prepare_mem_state_tables(state, intermediate_agg_states, detail_agg_states));
+        make_state_table = [](std::vector<SlotDescriptor*> slots, size_t k_num) -> StatusOr<StateTablePtr> {
+            return std::make_unique<MemStateTable>(std::move(slots), k_num);
+        };
     } else {
-        RETURN_IF_ERROR(_prepare_imt_state_tables(state, intermediate_agg_states, detail_agg_states));
+        auto* dir_mgr = ExecEnv::GetInstance()->spill_dir_mgr();
+        if (dir_mgr == nullptr) {
+            return Status::InternalError("spill dir is not set for the state tables");
+        }
+        ASSIGN_OR_RETURN(auto dir, dir_mgr->acquire_writable_dir(spill::AcquireDirOptions()));
+        if (dir->is_remote()) {
+            return Status::NotSupported("state tables can only be spilled to the local disk");
+        }
+        auto dir_prefix = fmt::format("{}/stream_state/{}", dir->dir(), print_id(state->fragment_instance_id()));
+        make_state_table = [dir_prefix](std::vector<SlotDescriptor*> slots, size_t k_num) -> StatusOr<StateTablePtr> {
+            static std::atomic<int64_t> s_next_table_id{0};
+            auto table_dir = fmt::format("{}_{}", dir_prefix, s_next_table_id++);
+            return std::make_unique<SpillableStateTable>(std::move(slots), k_num, std::move(table_dir));
+        };
     }
-
-    return Status::OK();
+    return _prepare_state_tables(state, intermediate_agg_states, detail_agg_states, make_state_table);
 }
 
-Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
-                                                const std::vector<AggStateData*>& intermediate_agg_states,
-                                                const std::vector<AggStateData*>& detail_agg_states) {
+Status AggGroupState::_prepare_state_tables(RuntimeState* state,
+                                            const std::vector<AggStateData*>& intermediate_agg_states,
+                                            const std::vector<AggStateData*>& detail_agg_states,
+                                            const StateTableFactory& make_state_table) {
     auto key_size = _params->grouping_exprs.size();
     // result state table must be made!
     auto output_slots = _output_tuple_desc->slots();
-    _result_state_table = std::make_unique<MemStateTable>(output_slots, key_size);
+    ASSIGN_OR_RETURN(_result_state_table, make_state_table(output_slots, key_size));
 
     // intermediate agg_state is created when intermediate/detail agg states are not empty.
     if (!intermediate_agg_states.empty()) {
@@ -84,7 +106,7 @@ Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
             DCHECK_LT(agg_func_id + key_size, _intermediate_tuple_desc->slots().size());
             intermediate_slots.push_back(_intermediate_tuple_desc->slots()[agg_func_id + key_size]);
         }
-        _intermediate_state_table = std::make_unique<MemStateTable>(intermediate_slots, key_size);
+        ASSIGN_OR_RETURN(_intermediate_state_table, make_state_table(intermediate_slots, key_size));
     }
 
     if (!detail_agg_states.empty()) {
@@ -102,19 +124,13 @@ Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
             detail_table_slots.push_back(_output_tuple_desc->slots()[key_size + agg_func_idx]);
             detail_table_slots.push_back(_output_tuple_desc->slots()[key_size + count_agg_idx]);
             DCHECK_EQ(detail_table_slots.size(), key_size + 2);
-            auto detail_state_table = std::make_unique<MemStateTable>(detail_table_slots, key_size + 1);
+            ASSIGN_OR_RETURN(auto detail_state_table, make_state_table(detail_table_slots, key_size + 1));
             _detail_state_tables.emplace_back(std::move(detail_state_table));
         }
     }
     return Status::OK();
 }
 
-Status AggGroupState::_prepare_imt_state_tables(RuntimeState* state,
-                                                const std::vector<AggStateData*>& intermediate_agg_states,
-                                                const std::vector<AggStateData*>& detail_agg_states) {
-    return Status::InternalError("IMT state table is not supported yet.");
-}
-
 Status AggGroupState::open(RuntimeState* state) {
     // Update result table
     DCHECK(_result_state_table);
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "exec/stream/aggregate/agg_state_data.h"
 #include "exec/stream/state/mem_state_table.h"
 
@@ -57,12 +59,12 @@ public:
     [[nodiscard]] Status reset_epoch(RuntimeState* state);
 
 private:
-    [[nodiscard]] Status _prepare_mem_state_tables(RuntimeState* state,
-                                                   const std::vector<AggStateData*>& intermediate_agg_states,
-                                                   const std::vector<AggStateData*>& detail_agg_states);
-    [[nodiscard]] Status _prepare_imt_state_tables(RuntimeState* state,
-                                                   const std::vector<AggStateData*>& intermediate_agg_states,
-                                                   const std::vector<AggStateData*>& detail_agg_states);
+    using StateTablePtr = std::unique_ptr<StateTable>;
+    using StateTableFactory = std::function<StatusOr<StateTablePtr>(std::vector<SlotDescriptor*> slots, size_t k_num)>;
+    [[nodiscard]] Status _prepare_state_tables(RuntimeState* state,
+                                               const std::vector<AggStateData*>& intermediate_agg_states,
+                                               const std::vector<AggStateData*>& detail_agg_states,
+                                               const StateTableFactory& make_state_table);
     StateTable* _find_detail_state_table(const AggStateDataUPtr& agg_state) const;
     ChunkPtr _build_intermediate_chunk(const Columns& group_by_columns, const Columns& agg_intermediate_columns) const;
 
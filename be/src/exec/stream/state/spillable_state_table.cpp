@@ -0,0 +1,610 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/stream/state/spillable_state_table.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "fs/fs.h"
+#include "storage/rowset/bloom_filter.h"
+#include "util/coding.h"
+
+namespace starrocks::stream {
+namespace {
+
+constexpr size_t kBlockSize = 32 * 1024;
+constexpr double kBloomFilterFpp = 0.01;
+// The memory of a mem table entry besides the key and the value.
+constexpr size_t kEntryOverhead = 64;
+
+// The encoded rows are decoded into the columns created from the schema, so the columns are encoded with the
+// nullability of the fields.
+StatusOr<ColumnPtr> normalize_column(const ColumnPtr& column, bool nullable) {
+    ColumnPtr col = column;
+    if (col->is_constant()) {
+        col = ColumnHelper::unpack_and_duplicate_const_column(col->size(), col);
+    }
+    if (nullable && !col->is_nullable()) {
+        return ColumnPtr(NullableColumn::create(col, NullColumn::create(col->size(), 0)));
+    }
+    if (!nullable && col->is_nullable()) {
+        if (col->has_null()) {
+            return Status::InternalError("null value of a non-nullable column of the state table");
+        }
+        return down_cast<NullableColumn*>(col.get())->data_column();
+    }
+    return col;
+}
+
+bool has_prefix(const std::string& key, const std::string& prefix) {
+    return key.compare(0, prefix.size(), prefix) == 0;
+}
+
+// Decode the rows of a prefix scan, the first |key_offset| bytes of the keys are the prefix which is skipped.
+class EncodedRowIterator final : public ChunkIterator {
+public:
+    EncodedRowIterator(Schema schema, std::vector<std::pair<std::string, std::string>>&& rows, size_t key_offset,
+                       size_t num_key_columns)
+            : ChunkIterator(std::move(schema), rows.size()),
+              _rows(std::move(rows)),
+              _key_offset(key_offset),
+              _num_key_columns(num_key_columns) {}
+    void close() override {}
+
+protected:
+    [[nodiscard]] Status do_get_next(Chunk* chunk) override {
+        if (_next_row >= _rows.size()) {
+            return Status::EndOfFile("end of encoded row iterator");
+        }
+        const size_t end = std::min(_rows.size(), _next_row + chunk_size());
+        for (; _next_row < end; ++_next_row) {
+            const auto& [key, value] = _rows[_next_row];
+            const auto* pos = reinterpret_cast<const uint8_t*>(key.data()) + _key_offset;
+            for (size_t i = 0; i < _num_key_columns; ++i) {
+                pos = chunk->get_column_by_index(i)->deserialize_and_append(pos);
+            }
+            pos = reinterpret_cast<const uint8_t*>(value.data());
+            for (size_t i = _num_key_columns; i < chunk->num_columns(); ++i) {
+                pos = chunk->get_column_by_index(i)->deserialize_and_append(pos);
+            }
+        }
+        return Status::OK();
+    }
+
+private:
+    std::vector<std::pair<std::string, std::string>> _rows;
+    size_t _next_row = 0;
+    const size_t _key_offset;
+    const size_t _num_key_columns;
+};
+
+} // namespace
+
+// A sorted run is a file of blocks, a block is a sequence of entries:
+//   key size (fixed32) | key | has value (1 byte) | [value size (fixed32) | value]
+// The runs only live as long as the table, so the index of the blocks is only kept in memory.
+struct SpillableStateTable::SortedRun {
+    std::string path;
+    std::unique_ptr<RandomAccessFile> file;
+    std::vector<std::string> first_keys;
+    std::vector<uint64_t> offsets;
+    std::vector<uint32_t> sizes;
+    std::unique_ptr<BloomFilter> bloom_filter;
+    size_t num_rows = 0;
+
+    size_t num_blocks() const { return first_keys.size(); }
+
+    // The block which may contain |key|, -1 if |key| is less than all the keys of the run.
+    int64_t find_block(std::string_view key) const {
+        auto it = std::upper_bound(first_keys.begin(), first_keys.end(), key,
+                                   [](std::string_view lhs, const std::string& rhs) { return lhs < rhs; });
+        return static_cast<int64_t>(it - first_keys.begin()) - 1;
+    }
+
+    Status read_block(size_t block, std::vector<Entry>* entries) const {
+        std::string data(sizes[block], '\0');
+        RETURN_IF_ERROR(file->read_at_fully(offsets[block], data.data(), data.size()));
+        entries->clear();
+        const auto* pos = reinterpret_cast<const uint8_t*>(data.data());
+        const auto* end = pos + data.size();
+        auto read_string = [&](std::string* str) {
+            if (end - pos < 4) {
+                return false;
+            }
+            uint32_t size = decode_fixed32_le(pos);
+            pos += 4;
+            if (static_cast<size_t>(end - pos) < size) {
+                return false;
+            }
+            str->assign(reinterpret_cast<const char*>(pos), size);
+            pos += size;
+            return true;
+        };
+        while (pos < end) {
+            Entry entry;
+            if (!read_string(&entry.first) || pos >= end) {
+                return Status::Corruption(fmt::format("bad block {} of state table run {}", block, path));
+            }
+            if (*pos++ != 0 && !read_string(&entry.second.emplace())) {
+                return Status::Corruption(fmt::format("bad block {} of state table run {}", block, path));
+            }
+            entries->emplace_back(std::move(entry));
+        }
+        return Status::OK();
+    }
+};
+
+class SpillableStateTable::SortedRunWriter {
+public:
+    Status open(std::string path, size_t num_rows) {
+        _run = std::make_unique<SortedRun>();
+        _run->path = std::move(path);
+        RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &_run->bloom_filter));
+        RETURN_IF_ERROR(_run->bloom_filter->init(std::max<size_t>(num_rows, 1), kBloomFilterFpp, HASH_MURMUR3_X64_64));
+        ASSIGN_OR_RETURN(_file, FileSystem::Default()->new_writable_file(_run->path));
+        return Status::OK();
+    }
+
+    // Keys must be added in ascending order.
+    Status add(const std::string& key, const Value& value) {
+        if (_block.empty()) {
+            _run->first_keys.emplace_back(key);
+        }
+        put_fixed32_le(&_block, key.size());
+        _block.append(key);
+        _block.push_back(value.has_value() ? 1 : 0);
+        if (value.has_value()) {
+            put_fixed32_le(&_block, value->size());
+            _block.append(*value);
+        }
+        _run->bloom_filter->add_bytes(key.data(), key.size());
+        _run->num_rows++;
+        return _block.size() >= kBlockSize ? _flush_block() : Status::OK();
+    }
+
+    StatusOr<std::unique_ptr<SortedRun>> finish() {
+        RETURN_IF_ERROR(_flush_block());
+        RETURN_IF_ERROR(_file->close());
+        ASSIGN_OR_RETURN(_run->file, FileSystem::Default()->new_random_access_file(_run->path));
+        return std::move(_run);
+    }
+
+private:
+    Status _flush_block() {
+        if (_block.empty()) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_file->append(Slice(_block)));
+        _run->offsets.push_back(_offset);
+        _run->sizes.push_back(_block.size());
+        _offset += _block.size();
+        _block.clear();
+        return Status::OK();
+    }
+
+    std::unique_ptr<SortedRun> _run;
+    std::unique_ptr<WritableFile> _file;
+    std::string _block;
+    uint64_t _offset = 0;
+};
+
+class SpillableStateTable::SortedRunCursor {
+public:
+    explicit SortedRunCursor(const SortedRun* run) : _run(run) {}
+
+    // Position at the first entry whose key is not less than |key|.
+    Status seek(const std::string& key) {
+        _block = std::max<int64_t>(_run->find_block(key), 0);
+        if (_block >= _run->num_blocks()) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_run->read_block(_block, &_entries));
+        auto it = std::lower_bound(_entries.begin(), _entries.end(), key,
+                                   [](const Entry& entry, const std::string& k) { return entry.first < k; });
+        _pos = it - _entries.begin();
+        return _pos < _entries.size() ? Status::OK() : _next_block();
+    }
+
+    Status next() {
+        DCHECK(valid());
+        return ++_pos < _entries.size() ? Status::OK() : _next_block();
+    }
+
+    bool valid() const { return _block < _run->num_blocks() && _pos < _entries.size(); }
+    const Entry& entry() const { return _entries[_pos]; }
+
+private:
+    Status _next_block() {
+        _pos = 0;
+        _entries.clear();
+        if (++_block >= _run->num_blocks()) {
+            return Status::OK();
+        }
+        return _run->read_block(_block, &_entries);
+    }
+
+    const SortedRun* _run;
+    size_t _block = 0;
+    size_t _pos = 0;
+    std::vector<Entry> _entries;
+};
+
+SpillableStateTable::SpillableStateTable(std::vector<SlotDescriptor*> slots, size_t k_num, std::string dir)
+        : _slots(std::move(slots)), _k_num(k_num), _dir(std::move(dir)) {
+    DCHECK_LE(_k_num, _slots.size());
+    _k_schema = _make_schema_from_slots(std::vector<SlotDescriptor*>{_slots.begin(), _slots.begin() + _k_num});
+    _v_schema = _make_schema_from_slots(std::vector<SlotDescriptor*>{_slots.begin() + _k_num, _slots.end()});
+}
+
+SpillableStateTable::~SpillableStateTable() {
+    _runs.clear();
+    if (_opened) {
+        auto st = FileSystem::Default()->delete_dir_recursive(_dir);
+        LOG_IF(WARNING, !st.ok()) << "failed to remove state table dir " << _dir << ": " << st;
+    }
+}
+
+Status SpillableStateTable::prepare(RuntimeState* state) {
+    return Status::OK();
+}
+
+Status SpillableStateTable::open(RuntimeState* state) {
+    if (!_opened) {
+        RETURN_IF_ERROR(FileSystem::Default()->create_dir_recursive(_dir));
+        _opened = true;
+    }
+    return Status::OK();
+}
+
+Status SpillableStateTable::commit(RuntimeState* state) {
+    return Status::OK();
+}
+
+Status SpillableStateTable::reset_epoch(RuntimeState* state) {
+    return Status::OK();
+}
+
+Schema SpillableStateTable::_make_schema_from_slots(const std::vector<SlotDescriptor*>& slots) const {
+    Fields fields;
+    for (auto& slot : slots) {
+        auto field = std::make_shared<Field>(slot->id(), slot->col_name(), slot->type().type, slot->is_nullable());
+        fields.emplace_back(std::move(field));
+    }
+    return Schema(std::move(fields), KeysType::PRIMARY_KEYS, {});
+}
+
+Status SpillableStateTable::_encode_rows(const Columns& columns, size_t first_column, size_t num_columns,
+                                         const Schema& schema, size_t start, size_t end,
+                                         std::vector<std::string>* rows) const {
+    DCHECK_LE(first_column + num_columns, columns.size());
+    DCHECK_LE(num_columns, schema.num_fields());
+    rows->assign(end - start, std::string());
+    for (size_t i = 0; i < num_columns; ++i) {
+        ASSIGN_OR_RETURN(auto column, normalize_column(columns[first_column + i], schema.field(i)->is_nullable()));
+        for (size_t row = start; row < end; ++row) {
+            auto& encoded = (*rows)[row - start];
+            const size_t offset = encoded.size();
+            encoded.resize(offset + column->serialize_size(row));
+            column->serialize(row, reinterpret_cast<uint8_t*>(encoded.data() + offset));
+        }
+    }
+    return Status::OK();
+}
+
+Status SpillableStateTable::seek(const Columns& keys, StateTableResult& values) const {
+    return _seek(keys, nullptr, values);
+}
+
+Status SpillableStateTable::seek(const Columns& keys, const std::vector<uint8_t>& selection,
+                                 StateTableResult& values) const {
+    DCHECK(!keys.empty());
+    DCHECK_EQ(selection.size(), keys[0]->size());
+    return _seek(keys, selection.data(), values);
+}
+
+Status SpillableStateTable::seek(const Columns& keys, const std::vector<std::string>& projection_columns,
+                                 StateTableResult& values) const {
+    return Status::NotSupported("Seek with projection columns is not supported yet.");
+}
+
+Status SpillableStateTable::_seek(const Columns& keys, const uint8_t* selection, StateTableResult& values) const {
+    if (keys.size() != _k_num) {
+        return Status::InvalidArgument(fmt::format("seek state table by {} key columns of {}", keys.size(), _k_num));
+    }
+    const size_t num_rows = keys[0]->size();
+    std::vector<std::string> encoded_keys;
+    RETURN_IF_ERROR(_encode_rows(keys, 0, _k_num, _k_schema, 0, num_rows, &encoded_keys));
+
+    std::vector<Value> found_values(num_rows);
+    std::vector<size_t> misses;
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (selection != nullptr && !selection[i]) {
+            continue;
+        }
+        if (auto it = _mem_table.find(encoded_keys[i]); it != _mem_table.end()) {
+            found_values[i] = it->second;
+        } else if (auto* cached = _lookup_cache(encoded_keys[i]); cached != nullptr) {
+            found_values[i] = *cached;
+        } else {
+            misses.push_back(i);
+        }
+    }
+    if (!misses.empty() && !_runs.empty()) {
+        RETURN_IF_ERROR(_seek_sorted_runs(encoded_keys, misses, &found_values));
+        for (auto i : misses) {
+            if (found_values[i].has_value()) {
+                _insert_cache(encoded_keys[i], *found_values[i]);
+            }
+        }
+    }
+
+    values.found.assign(num_rows, false);
+    values.result_chunk = ChunkHelper::new_chunk(_v_schema, num_rows);
+    auto& columns = values.result_chunk->columns();
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (!found_values[i].has_value()) {
+            continue;
+        }
+        values.found[i] = true;
+        const auto* pos = reinterpret_cast<const uint8_t*>(found_values[i]->data());
+        for (auto& column : columns) {
+            pos = column->deserialize_and_append(pos);
+        }
+    }
+    return Status::OK();
+}
+
+Status SpillableStateTable::_seek_sorted_runs(const std::vector<std::string>& keys,
+                                              const std::vector<size_t>& indexes,
+                                              std::vector<Value>* values) const {
+    std::vector<size_t> pending = indexes;
+    std::vector<size_t> remaining;
+    std::vector<std::pair<int64_t, size_t>> probes;
+    std::vector<Entry> entries;
+    for (auto run = _runs.rbegin(); run != _runs.rend() && !pending.empty(); ++run) {
+        remaining.clear();
+        probes.clear();
+        for (auto i : pending) {
+            const auto& key = keys[i];
+            int64_t block = -1;
+            if ((*run)->bloom_filter->test_bytes(key.data(), key.size())) {
+                block = (*run)->find_block(key);
+            }
+            if (block < 0) {
+                remaining.push_back(i);
+            } else {
+                probes.emplace_back(block, i);
+            }
+        }
+        // Read every block once for all the keys in it.
+        std::sort(probes.begin(), probes.end());
+        int64_t loaded_block = -1;
+        for (const auto& [block, i] : probes) {
+            if (block != loaded_block) {
+                RETURN_IF_ERROR((*run)->read_block(block, &entries));
+                loaded_block = block;
+            }
+            auto it = std::lower_bound(entries.begin(), entries.end(), keys[i],
+                                       [](const Entry& entry, const std::string& key) { return entry.first < key; });
+            if (it != entries.end() && it->first == keys[i]) {
+                // A deleted key is found as well, the older runs must not be probed.
+                (*values)[i] = it->second;
+            } else {
+                remaining.push_back(i);
+            }
+        }
+        pending.swap(remaining);
+    }
+    return Status::OK();
+}
+
+ChunkIteratorPtrOr SpillableStateTable::prefix_scan(const Columns& keys, size_t row_idx) const {
+    if (keys.empty() || keys.size() > _k_num) {
+        return Status::InvalidArgument(
+                fmt::format("prefix scan state table by {} key columns of {}", keys.size(), _k_num));
+    }
+    std::vector<std::string> prefixes;
+    RETURN_IF_ERROR(_encode_rows(keys, 0, keys.size(), _k_schema, row_idx, row_idx + 1, &prefixes));
+    const auto& prefix = prefixes[0];
+
+    // The rows of the newer runs and the mem table override the ones of the older runs.
+    std::map<std::string, Value> rows;
+    for (const auto& run : _runs) {
+        SortedRunCursor cursor(run.get());
+        RETURN_IF_ERROR(cursor.seek(prefix));
+        while (cursor.valid() && has_prefix(cursor.entry().first, prefix)) {
+            rows[cursor.entry().first] = cursor.entry().second;
+            RETURN_IF_ERROR(cursor.next());
+        }
+    }
+    for (auto it = _mem_table.lower_bound(prefix); it != _mem_table.end() && has_prefix(it->first, prefix); ++it) {
+        rows[it->first] = it->second;
+    }
+
+    std::vector<std::pair<std::string, std::string>> live_rows;
+    for (auto& [key, value] : rows) {
+        if (value.has_value()) {
+            live_rows.emplace_back(key, std::move(*value));
+        }
+    }
+    if (live_rows.empty()) {
+        return Status::EndOfFile("");
+    }
+    auto schema = _make_schema_from_slots(std::vector<SlotDescriptor*>{_slots.begin() + keys.size(), _slots.end()});
+    return std::make_shared<EncodedRowIterator>(std::move(schema), std::move(live_rows), prefix.size(),
+                                                _k_num - keys.size());
+}
+
+ChunkIteratorPtrOr SpillableStateTable::prefix_scan(const std::vector<std::string>& projection_columns,
+                                                    const Columns& keys, size_t row_idx) const {
+    return Status::NotSupported("PrefixScan with projection columns is not supported yet.");
+}
+
+Status SpillableStateTable::write(RuntimeState* state, const StreamChunkPtr& chunk) {
+    DCHECK(chunk);
+    const size_t num_rows = chunk->num_rows();
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+    const auto& columns = chunk->columns();
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    RETURN_IF_ERROR(_encode_rows(columns, 0, _k_num, _k_schema, 0, num_rows, &keys));
+    RETURN_IF_ERROR(_encode_rows(columns, _k_num, _v_schema.num_fields(), _v_schema, 0, num_rows, &values));
+
+    const StreamRowOp* ops = StreamChunkConverter::has_ops_column(chunk) ? StreamChunkConverter::ops(chunk) : nullptr;
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (ops != nullptr && ops[i] == StreamRowOp::OP_UPDATE_BEFORE) {
+            continue;
+        }
+        _erase_cache(keys[i]);
+        const bool is_delete = ops != nullptr && ops[i] == StreamRowOp::OP_DELETE;
+        auto it = _mem_table.find(keys[i]);
+        if (it != _mem_table.end()) {
+            _mem_table_bytes -= it->second.has_value() ? it->second->size() : 0;
+        } else if (is_delete && _runs.empty()) {
+            continue;
+        } else {
+            _mem_table_bytes += keys[i].size() + kEntryOverhead;
+            it = _mem_table.emplace(std::move(keys[i]), Value()).first;
+        }
+        if (is_delete && _runs.empty()) {
+            _mem_table_bytes -= it->first.size() + kEntryOverhead;
+            _mem_table.erase(it);
+        } else if (is_delete) {
+            it->second.reset();
+        } else {
+            _mem_table_bytes += values[i].size();
+            it->second = std::move(values[i]);
+        }
+    }
+
+    if (static_cast<int64_t>(_mem_table_bytes) > config::stream_state_table_mem_limit_bytes) {
+        RETURN_IF_ERROR(spill());
+    }
+    return Status::OK();
+}
+
+std::string SpillableStateTable::_next_run_path() {
+    return fmt::format("{}/{}.run", _dir, _next_run_id++);
+}
+
+Status SpillableStateTable::spill() {
+    if (_mem_table.empty()) {
+        return Status::OK();
+    }
+    SortedRunWriter writer;
+    RETURN_IF_ERROR(writer.open(_next_run_path(), _mem_table.size()));
+    for (const auto& [key, value] : _mem_table) {
+        // Nothing is deleted if there is no older run.
+        if (value.has_value() || !_runs.empty()) {
+            RETURN_IF_ERROR(writer.add(key, value));
+        }
+    }
+    ASSIGN_OR_RETURN(auto run, writer.finish());
+    _runs.emplace_back(std::move(run));
+    _mem_table.clear();
+    _mem_table_bytes = 0;
+
+    if (_runs.size() > static_cast<size_t>(std::max(1, config::stream_state_table_max_sorted_runs))) {
+        RETURN_IF_ERROR(_merge_sorted_runs());
+    }
+    return Status::OK();
+}
+
+Status SpillableStateTable::_merge_sorted_runs() {
+    size_t num_rows = 0;
+    std::vector<std::unique_ptr<SortedRunCursor>> cursors;
+    for (const auto& run : _runs) {
+        num_rows += run->num_rows;
+        auto& cursor = cursors.emplace_back(std::make_unique<SortedRunCursor>(run.get()));
+        RETURN_IF_ERROR(cursor->seek(std::string()));
+    }
+
+    SortedRunWriter writer;
+    RETURN_IF_ERROR(writer.open(_next_run_path(), num_rows));
+    while (true) {
+        // Of the cursors at the same key, the one of the newest run wins.
+        int64_t newest = -1;
+        for (int64_t i = static_cast<int64_t>(cursors.size()) - 1; i >= 0; --i) {
+            if (cursors[i]->valid() && (newest < 0 || cursors[i]->entry().first < cursors[newest]->entry().first)) {
+                newest = i;
+            }
+        }
+        if (newest < 0) {
+            break;
+        }
+        const std::string key = cursors[newest]->entry().first;
+        // All the runs are merged, so the deleted keys are dropped.
+        if (cursors[newest]->entry().second.has_value()) {
+            RETURN_IF_ERROR(writer.add(key, cursors[newest]->entry().second));
+        }
+        for (auto& cursor : cursors) {
+            if (cursor->valid() && cursor->entry().first == key) {
+                RETURN_IF_ERROR(cursor->next());
+            }
+        }
+    }
+    ASSIGN_OR_RETURN(auto merged, writer.finish());
+
+    for (auto& run : _runs) {
+        run->file.reset();
+        auto st = FileSystem::Default()->delete_file(run->path);
+        LOG_IF(WARNING, !st.ok()) << "failed to delete state table run " << run->path << ": " << st;
+    }
+    _runs.clear();
+    _runs.emplace_back(std::move(merged));
+    return Status::OK();
+}
+
+const std::string* SpillableStateTable::_lookup_cache(std::string_view key) const {
+    auto it = _cache_index.find(key);
+    if (it == _cache_index.end()) {
+        return nullptr;
+    }
+    _cache_lru.splice(_cache_lru.begin(), _cache_lru, it->second);
+    return &it->second->second;
+}
+
+void SpillableStateTable::_insert_cache(const std::string& key, const std::string& value) const {
+    const auto capacity = static_cast<size_t>(std::max<int64_t>(config::stream_state_table_hot_key_cache_bytes, 0));
+    if (key.size() + value.size() > capacity) {
+        return;
+    }
+    _erase_cache(key);
+    _cache_lru.emplace_front(key, value);
+    _cache_index.emplace(_cache_lru.front().first, _cache_lru.begin());
+    _cache_bytes += key.size() + value.size();
+    while (_cache_bytes > capacity) {
+        _erase_cache(_cache_lru.back().first);
+    }
+}
+
+void SpillableStateTable::_erase_cache(std::string_view key) const {
+    auto it = _cache_index.find(key);
+    if (it == _cache_index.end()) {
+        return;
+    }
+    auto lru_it = it->second;
+    _cache_bytes -= lru_it->first.size() + lru_it->second.size();
+    _cache_index.erase(it);
+    _cache_lru.erase(lru_it);
+}
+
+} // namespace starrocks::stream
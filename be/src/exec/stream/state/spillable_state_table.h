@@ -0,0 +1,124 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include "column/schema.h"
+#include "exec/stream/state/state_table.h"
+
+namespace starrocks {
+class BloomFilter;
+class RandomAccessFile;
+} // namespace starrocks
+
+namespace starrocks::stream {
+
+// SpillableStateTable keeps the state of a stateful stream operator in a small LSM tree on the local disk, so that
+// the state of a large-cardinality aggregation does not have to fit in memory.
+//
+// A row is encoded by Column::serialize into a key, made of the key columns, and a value, made of the others.
+// Writes are buffered in a sorted mem table, which is spilled into an immutable sorted run once it is larger than
+// config::stream_state_table_mem_limit_bytes. A sorted run is a file of blocks, of which only the first keys and a
+// bloom filter are kept in memory, and the runs are merged into one when there are more than
+// config::stream_state_table_max_sorted_runs of them. The rows read back from the runs are kept in an LRU cache
+// of hot keys.
+//
+// Keys are looked up by batch: the runs are probed from the newest to the oldest one, and every block is read at
+// most once for all the keys of a batch.
+class SpillableStateTable final : public StateTable {
+public:
+    // The sorted runs are written into |dir|, which is created by open() and removed when the table is destroyed.
+    SpillableStateTable(std::vector<SlotDescriptor*> slots, size_t k_num, std::string dir);
+    ~SpillableStateTable() override;
+
+    [[nodiscard]] Status prepare(RuntimeState* state) override;
+    [[nodiscard]] Status open(RuntimeState* state) override;
+
+    [[nodiscard]] Status seek(const Columns& keys, StateTableResult& values) const override;
+    [[nodiscard]] Status seek(const Columns& keys, const std::vector<uint8_t>& selection,
+                              StateTableResult& values) const override;
+    [[nodiscard]] Status seek(const Columns& keys, const std::vector<std::string>& projection_columns,
+                              StateTableResult& values) const override;
+
+    ChunkIteratorPtrOr prefix_scan(const Columns& keys, size_t row_idx) const override;
+    ChunkIteratorPtrOr prefix_scan(const std::vector<std::string>& projection_columns, const Columns& keys,
+                                   size_t row_idx) const override;
+
+    // The mem table is spilled once it is too large.
+    [[nodiscard]] Status write(RuntimeState* state, const StreamChunkPtr& chunk) override;
+    [[nodiscard]] Status commit(RuntimeState* state) override;
+    [[nodiscard]] Status reset_epoch(RuntimeState* state) override;
+
+    // Spill the mem table into a new sorted run, and merge the sorted runs if there are too many of them.
+    [[nodiscard]] Status spill();
+
+    size_t num_sorted_runs() const { return _runs.size(); }
+    size_t mem_table_bytes() const { return _mem_table_bytes; }
+    size_t hot_key_cache_bytes() const { return _cache_bytes; }
+
+private:
+    // A deleted key is kept as an entry without value until the sorted runs are merged.
+    using Value = std::optional<std::string>;
+    using Entry = std::pair<std::string, Value>;
+
+    struct SortedRun;
+    class SortedRunWriter;
+    class SortedRunCursor;
+
+    Schema _make_schema_from_slots(const std::vector<SlotDescriptor*>& slots) const;
+    // Encode the rows [start, end) of |num_columns| columns of |columns| from |first_column|, the i-th one of
+    // which is of the i-th field of |schema|.
+    [[nodiscard]] Status _encode_rows(const Columns& columns, size_t first_column, size_t num_columns,
+                                      const Schema& schema, size_t start, size_t end,
+                                      std::vector<std::string>* rows) const;
+    // Look up |keys| whose |selection| is not zero into |values|, a null |selection| selects all the keys.
+    [[nodiscard]] Status _seek(const Columns& keys, const uint8_t* selection, StateTableResult& values) const;
+    // Find the values of |keys| in the sorted runs, |values| of the keys which are found are set.
+    [[nodiscard]] Status _seek_sorted_runs(const std::vector<std::string>& keys, const std::vector<size_t>& indexes,
+                                           std::vector<Value>* values) const;
+    [[nodiscard]] Status _merge_sorted_runs();
+    std::string _next_run_path();
+
+    const std::string* _lookup_cache(std::string_view key) const;
+    void _insert_cache(const std::string& key, const std::string& value) const;
+    void _erase_cache(std::string_view key) const;
+
+    std::vector<SlotDescriptor*> _slots;
+    size_t _k_num;
+    std::string _dir;
+    bool _opened = false;
+    Schema _k_schema;
+    Schema _v_schema;
+
+    std::map<std::string, Value, std::less<>> _mem_table;
+    size_t _mem_table_bytes = 0;
+    // From the oldest to the newest.
+    std::vector<std::unique_ptr<SortedRun>> _runs;
+    int64_t _next_run_id = 0;
+
+    // The hot key cache of the rows found in the sorted runs. A key is evicted when it is written, so that the
+    // cached value is never older than the one in the mem table or the sorted runs.
+    mutable std::list<std::pair<std::string, std::string>> _cache_lru;
+    mutable std::unordered_map<std::string_view, std::list<std::pair<std::string, std::string>>::iterator>
+            _cache_index;
+    mutable size_t _cache_bytes = 0;
+};
+
+} // namespace starrocks::stream
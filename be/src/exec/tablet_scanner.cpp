@@ -254,6 +254,8 @@ Status TabletScanner::_init_unused_output_columns(const std::vector<std::string>
 Status TabletScanner::_init_global_dicts() {
     const auto& global_dict_map = _runtime_state->get_query_global_dict_map();
     auto global_dict = _pool.add(new ColumnIdToGlobalDictMap());
+    auto global_dict_versions = _pool.add(new ColumnIdToGlobalDictVersion());
+    const auto& query_dict_versions = _runtime_state->query_dict_versions();
     // mapping column id to storage column ids
     for (auto slot : _parent->_tuple_desc->slots()) {
         if (!slot->is_materialized()) {
@@ -265,9 +267,13 @@ Status TabletScanner::_init_global_dicts() {
             int32_t index = _tablet_schema->field_index(slot->col_name());
             DCHECK(index >= 0);
             global_dict->emplace(index, const_cast<GlobalDictMap*>(&dict_map));
+            if (auto version = query_dict_versions.find(slot->id()); version != query_dict_versions.end()) {
+                global_dict_versions->emplace(index, version->second);
+            }
         }
     }
     _params.global_dictmaps = global_dict;
+    _params.global_dict_versions = global_dict_versions;
 
     return Status::OK();
 }
@@ -410,6 +410,19 @@ bool NodeChannel::is_full() {
     return false;
 }
 
+bool NodeChannel::_is_cur_chunk_full() const {
+    size_t num_rows = _cur_chunk->num_rows();
+    size_t chunk_size = _runtime_state->chunk_size();
+    if (num_rows < chunk_size) {
+        return false;
+    }
+    // Requests of narrow rows are small, keep coalescing them up to the target size to save rpcs,
+    // but bound the number of rows so that a request doesn't stall the receiver for too long.
+    int64_t target_bytes = config::tablet_sink_chunk_target_bytes;
+    return target_bytes <= 0 || num_rows >= chunk_size * kMaxCoalesceChunks ||
+           _cur_chunk->bytes_usage() >= target_bytes;
+}
+
 Status NodeChannel::add_chunk(Chunk* input, const std::vector<int64_t>& tablet_ids,
                               const std::vector<uint32_t>& indexes, uint32_t from, uint32_t size) {
     if (_cancelled || _closed) {
@@ -447,7 +460,7 @@ Status NodeChannel::add_chunk(Chunk* input, const std::vector<int64_t>& tablet_i
         }
     }
 
-    if (_cur_chunk->num_rows() < _runtime_state->chunk_size()) {
+    if (!_is_cur_chunk_full()) {
         // 2. chunk not full
         if (_request_queue.empty()) {
             return Status::OK();
@@ -497,7 +510,7 @@ Status NodeChannel::add_chunks(Chunk* input, const std::vector<std::vector<int64
         }
     }
 
-    if (_cur_chunk->num_rows() < _runtime_state->chunk_size()) {
+    if (!_is_cur_chunk_full()) {
         // 2. chunk not full
         if (_request_queue.empty()) {
             return Status::OK();
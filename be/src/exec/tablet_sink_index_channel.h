@@ -175,6 +175,7 @@ private:
     Status _wait_one_prev_request();
     bool _check_prev_request_done();
     bool _check_all_prev_request_done();
+    bool _is_cur_chunk_full() const;
     Status _serialize_chunk(const Chunk* src, ChunkPB* dst);
     void _open(int64_t index_id, RefCountClosure<PTabletWriterOpenResult>* open_closure,
                std::vector<PTabletWithPartition>& tablets, bool incrmental_open);
@@ -241,6 +242,8 @@ private:
 
     size_t _current_request_index = 0;
     size_t _max_request_queue_size = 8;
+    // the maximum number of chunk_size row batches coalesced into one request
+    static constexpr size_t kMaxCoalesceChunks = 4;
 
     int64_t _actual_consume_ns = 0;
     Status _err_st = Status::OK();
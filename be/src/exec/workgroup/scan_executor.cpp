@@ -14,7 +14,9 @@
 
 #include "exec/workgroup/scan_executor.h"
 
+#include "common/config.h"
 #include "exec/workgroup/scan_task_queue.h"
+#include "util/cpu_info.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks::workgroup {
@@ -51,6 +53,10 @@ void ScanExecutor::change_num_threads(int32_t num_threads) {
 
 void ScanExecutor::worker_thread() {
     auto current_thread = Thread::current_thread();
+    const int worker_id = _next_id++;
+    if (config::pipeline_enable_numa_aware_thread_binding) {
+        CpuInfo::bind_current_thread_to_numa_node_of_worker(worker_id);
+    }
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -93,4 +99,8 @@ void ScanExecutor::force_submit(ScanTask task) {
     _task_queue->force_put(std::move(task));
 }
 
+size_t ScanExecutor::num_queued_tasks() const {
+    return _task_queue->size();
+}
+
 } // namespace starrocks::workgroup
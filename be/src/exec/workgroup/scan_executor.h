@@ -39,6 +39,9 @@ public:
 
     void force_submit(ScanTask task);
 
+    int32_t num_threads() const { return _num_threads_setter.actual_num(); }
+    size_t num_queued_tasks() const;
+
 private:
     void worker_thread();
 
@@ -46,6 +49,8 @@ private:
     std::unique_ptr<ScanTaskQueue> _task_queue;
     // _thread_pool must be placed after _task_queue, because worker threads in _thread_pool use _task_queue.
     std::unique_ptr<ThreadPool> _thread_pool;
+
+    std::atomic<int> _next_id = 0;
 };
 
 } // namespace starrocks::workgroup
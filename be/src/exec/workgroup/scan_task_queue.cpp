@@ -269,7 +269,7 @@ void WorkGroupScanTaskQueue::update_statistics(ScanTask& task, int64_t runtime_n
 }
 
 bool WorkGroupScanTaskQueue::should_yield(const WorkGroup* wg, int64_t unaccounted_runtime_ns) const {
-    if (_throttled(_sched_entity(wg), unaccounted_runtime_ns)) {
+    if (_throttled(_sched_entity(wg), unaccounted_runtime_ns) || wg->is_io_throttled()) {
         return true;
     }
 
@@ -305,7 +305,7 @@ void WorkGroupScanTaskQueue::_update_min_wg() {
 workgroup::WorkGroupScanSchedEntity* WorkGroupScanTaskQueue::_take_next_wg() {
     workgroup::WorkGroupScanSchedEntity* min_unthrottled_wg_entity = nullptr;
     for (const auto& wg_entity : _wg_entities) {
-        if (!_throttled(wg_entity)) {
+        if (!_throttled(wg_entity) && !wg_entity->workgroup()->is_io_throttled()) {
             min_unthrottled_wg_entity = wg_entity;
             break;
         }
@@ -251,6 +251,44 @@ Status WorkGroup::check_big_query(const QueryContext& query_context) {
     return Status::OK();
 }
 
+void WorkGroup::incr_io_bytes(int64_t delta_bytes) {
+    _io_bytes += delta_bytes;
+    if (config::resource_group_io_bytes_per_second_limit > 0) {
+        _io_tokens -= delta_bytes;
+    }
+}
+
+int64_t WorkGroup::io_bytes_per_second_limit() const {
+    int64_t total_limit = config::resource_group_io_bytes_per_second_limit;
+    if (total_limit <= 0) {
+        return 0;
+    }
+    size_t sum_cpu_limit = std::max<size_t>(1, WorkGroupManager::instance()->sum_cpu_limit());
+    double ratio = std::min(1.0, static_cast<double>(_cpu_limit) / sum_cpu_limit);
+    return std::max<int64_t>(1, total_limit * ratio);
+}
+
+bool WorkGroup::is_io_throttled() const {
+    int64_t limit = io_bytes_per_second_limit();
+    if (limit <= 0) {
+        return false;
+    }
+
+    int64_t now_ns = MonotonicNanos();
+    int64_t last_ns = _io_tokens_refill_ns.load();
+    if (now_ns > last_ns && _io_tokens_refill_ns.compare_exchange_strong(last_ns, now_ns)) {
+        // The bucket holds at most one second of tokens, and is filled up the first time.
+        int64_t refill = limit;
+        if (last_ns != 0) {
+            refill = std::min<int128_t>(limit, static_cast<int128_t>(now_ns - last_ns) * limit / NANOS_PER_SEC);
+        }
+        int64_t tokens = _io_tokens.load();
+        while (!_io_tokens.compare_exchange_weak(tokens, std::min(limit, tokens + refill))) {
+        }
+    }
+    return _io_tokens.load() <= 0;
+}
+
 void WorkGroup::copy_metrics(const WorkGroup& rhs) {
     _num_total_queries = rhs.num_total_queries();
     _concurrency_overflow_count = rhs.concurrency_overflow_count();
@@ -205,6 +205,15 @@ public:
     void incr_cpu_runtime_ns(int64_t delta_ns) { _cpu_runtime_ns += delta_ns; }
     int64_t cpu_runtime_ns() const { return _cpu_runtime_ns; }
 
+    // Charge the bytes read or written by the scan and spill I/O tasks of this workgroup.
+    void incr_io_bytes(int64_t delta_bytes);
+    int64_t io_bytes() const { return _io_bytes; }
+    // The share of config::resource_group_io_bytes_per_second_limit owned by this workgroup, which
+    // is proportional to its cpu_limit. Return 0 if the I/O bandwidth is unlimited.
+    int64_t io_bytes_per_second_limit() const;
+    // Return true, if the I/O tasks of this workgroup have used up the I/O bandwidth share.
+    bool is_io_throttled() const;
+
     static constexpr int64 DEFAULT_WG_ID = 0;
     static constexpr int64 DEFAULT_MV_WG_ID = 1;
     static constexpr int64 DEFAULT_VERSION = 0;
@@ -257,6 +266,11 @@ private:
     /// The total CPU runtime cost in nanos unit, including driver execution time, and the cpu execution time of
     /// other threads including Source and Sink threads.
     std::atomic<int64_t> _cpu_runtime_ns = 0;
+    /// The total bytes of scan and spill I/O.
+    std::atomic<int64_t> _io_bytes = 0;
+    /// The token bucket of the I/O bandwidth, which is refilled lazily by is_io_throttled().
+    mutable std::atomic<int64_t> _io_tokens = 0;
+    mutable std::atomic<int64_t> _io_tokens_refill_ns = 0;
 };
 
 // WorkGroupManager is a singleton used to manage WorkGroup instances in BE, it has an io queue and a cpu queues for
@@ -283,6 +297,7 @@ public:
     void decr_num_running_sq_drivers() { _num_running_sq_drivers--; }
     bool is_sq_wg_running() const { return _num_running_sq_drivers > 0; }
     size_t normal_workgroup_cpu_hard_limit() const;
+    size_t sum_cpu_limit() const { return _sum_cpu_limit; }
 
     void update_metrics();
 
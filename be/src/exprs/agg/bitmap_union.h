@@ -22,6 +22,15 @@
 
 namespace starrocks {
 
+// Union the bitmaps of the rows [start, end) of |column| into |bitmap| in one pass.
+inline void union_bitmap_rows(BitmapValue* bitmap, const BitmapColumn* column, size_t start, size_t end) {
+    std::vector<const BitmapValue*> values(end - start);
+    for (size_t i = start; i < end; i++) {
+        values[i - start] = column->get_object(i);
+    }
+    bitmap->union_many(values.size(), values.data());
+}
+
 class BitmapUnionAggregateFunction final
         : public AggregateFunctionBatchHelper<BitmapValue, BitmapUnionAggregateFunction> {
 public:
@@ -36,6 +45,16 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        union_bitmap_rows(&this->data(state), down_cast<const BitmapColumn*>(columns[0]), 0, chunk_size);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
+                                  size_t start, size_t size) const override {
+        union_bitmap_rows(&this->data(state), down_cast<const BitmapColumn*>(column), start, start + size);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         auto* col = down_cast<BitmapColumn*>(to);
         auto& bitmap = const_cast<BitmapValue&>(this->data(state));
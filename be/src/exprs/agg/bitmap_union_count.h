@@ -17,6 +17,7 @@
 #include "column/object_column.h"
 #include "column/vectorized_fwd.h"
 #include "exprs/agg/aggregate.h"
+#include "exprs/agg/bitmap_union.h"
 #include "gutil/casts.h"
 #include "types/bitmap_value.h"
 
@@ -39,13 +40,20 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        union_bitmap_rows(&this->data(state), down_cast<const BitmapColumn*>(columns[0]), 0, chunk_size);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
+                                  size_t start, size_t size) const override {
+        union_bitmap_rows(&this->data(state), down_cast<const BitmapColumn*>(column), start, start + size);
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
-        const auto* col = down_cast<const BitmapColumn*>(columns[0]);
-        for (size_t i = frame_start; i < frame_end; ++i) {
-            this->data(state) |= *(col->get_object(i));
-        }
+        union_bitmap_rows(&this->data(state), down_cast<const BitmapColumn*>(columns[0]), frame_start, frame_end);
     }
 
     void get_values(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* dst, size_t start,
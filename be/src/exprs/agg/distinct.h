@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <string>
 #include <type_traits>
 
@@ -26,6 +27,8 @@
 #include "column/hash_set.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/compiler_util.h"
+#include "common/config.h"
 #include "exprs/agg/aggregate.h"
 #include "exprs/agg/sum.h"
 #include "exprs/function_context.h"
@@ -34,6 +37,7 @@
 #include "gutil/casts.h"
 #include "runtime/mem_pool.h"
 #include "thrift/protocol/TJSONProtocol.h"
+#include "types/bitmap_value_detail.h"
 #include "util/phmap/phmap_dump.h"
 #include "util/slice.h"
 
@@ -196,44 +200,81 @@ struct DistinctAggregateStateV2<LT, SumLT, FixedLengthLTGuard<LT>> {
     using SumType = RunTimeCppType<SumLT>;
     using MyHashSet = HashSet<T>;
     static constexpr size_t item_size = phmap::item_serialize_size<MyHashSet>::value;
+    // Dense integer domains are switched from the hash set to a roaring bitmap, which takes a few bits
+    // per value instead of a hash table slot.
+    static constexpr bool support_bitmap = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+    // A hash set is dense enough to switch if its values span at most this many integers per value.
+    static constexpr uint64_t kMaxBitmapRangePerValue = 16;
 
     size_t update(T key) {
+        if constexpr (support_bitmap) {
+            if (bitmap != nullptr) {
+                bitmap->add(to_bitmap_value(key));
+                return 0;
+            }
+        }
         auto pair = set.insert(key);
+        try_switch_to_bitmap();
         return pair.second * item_size;
     }
 
     size_t update_with_hash([[maybe_unused]] MemPool* mempool, T key, size_t hash) {
+        if constexpr (support_bitmap) {
+            if (bitmap != nullptr) {
+                bitmap->add(to_bitmap_value(key));
+                return 0;
+            }
+        }
         auto pair = set.emplace_with_hash(hash, key);
+        try_switch_to_bitmap();
         return pair.second * item_size;
     }
 
     void prefetch(T key) { set.prefetch(key); }
 
-    int64_t disctint_count() const { return set.size(); }
+    int64_t disctint_count() const {
+        if constexpr (support_bitmap) {
+            if (bitmap != nullptr) {
+                return bitmap->cardinality();
+            }
+        }
+        return set.size();
+    }
 
     size_t serialize_size() const {
-        size_t size = set.size() * sizeof(T) + sizeof(size_t);
+        size_t size = disctint_count() * sizeof(T) + sizeof(size_t);
         size = std::max(size, MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA);
         return size;
     }
 
     void serialize(uint8_t* dst) const {
-        size_t size = set.size();
+        size_t size = disctint_count();
         memcpy(dst, &size, sizeof(size));
         dst += sizeof(size);
-        for (auto& key : set) {
+        for_each_key([&](T key) {
             memcpy(dst, &key, sizeof(key));
             dst += sizeof(T);
-        }
+        });
     }
 
     size_t deserialize_and_merge(const uint8_t* src, size_t len) {
         size_t size = 0;
         memcpy(&size, src, sizeof(size));
+        src += sizeof(size);
+        if constexpr (support_bitmap) {
+            if (bitmap != nullptr) {
+                for (size_t i = 0; i < size; i++) {
+                    T key;
+                    memcpy(&key, src, sizeof(T));
+                    bitmap->add(to_bitmap_value(key));
+                    src += sizeof(T);
+                }
+                return 0;
+            }
+        }
         set.rehash(set.size() + size);
 
         size_t old_size = set.size();
-        src += sizeof(size);
         for (size_t i = 0; i < size; i++) {
             T key;
             memcpy(&key, src, sizeof(T));
@@ -241,6 +282,7 @@ struct DistinctAggregateStateV2<LT, SumLT, FixedLengthLTGuard<LT>> {
             src += sizeof(T);
         }
         size_t new_size = set.size();
+        try_switch_to_bitmap();
         return (new_size - old_size) * item_size;
     }
 
@@ -251,10 +293,23 @@ struct DistinctAggregateStateV2<LT, SumLT, FixedLengthLTGuard<LT>> {
             return sum;
         }
 
+        for_each_key([&](T key) { sum += key; });
+        return sum;
+    }
+
+    template <typename Func>
+    void for_each_key(Func&& func) const {
+        if constexpr (support_bitmap) {
+            if (bitmap != nullptr) {
+                for (auto value : *bitmap) {
+                    func(static_cast<T>(static_cast<int64_t>(value)));
+                }
+                return;
+            }
+        }
         for (auto& key : set) {
-            sum += key;
+            func(key);
         }
-        return sum;
     }
 
     // NOLINTBEGIN
@@ -268,6 +323,41 @@ struct DistinctAggregateStateV2<LT, SumLT, FixedLengthLTGuard<LT>> {
     // NOLINTEND
 
     MyHashSet set;
+    std::unique_ptr<detail::Roaring64Map> bitmap;
+    // the hash set size at which the density is checked next time, 0 means not initialized.
+    size_t next_switch_check_size = 0;
+
+private:
+    // negative values are kept in two's complement, they stay in a few high words as long as the domain is dense.
+    static uint64_t to_bitmap_value(T key) { return static_cast<uint64_t>(static_cast<int64_t>(key)); }
+
+    void try_switch_to_bitmap() {
+        if constexpr (support_bitmap) {
+            if (LIKELY(set.size() < next_switch_check_size)) {
+                return;
+            }
+            const int64_t threshold = config::distinct_agg_bitmap_switch_threshold;
+            if (next_switch_check_size == 0) {
+                next_switch_check_size = threshold > 0 ? threshold : std::numeric_limits<size_t>::max();
+                if (set.size() < next_switch_check_size) {
+                    return;
+                }
+            }
+            // checking the density is linear in the set size, do it again only after the set doubles.
+            next_switch_check_size = set.size() * 2;
+            auto [min_iter, max_iter] = std::minmax_element(set.begin(), set.end());
+            const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(*max_iter)) -
+                                   static_cast<uint64_t>(static_cast<int64_t>(*min_iter));
+            if (range / kMaxBitmapRangePerValue >= set.size()) {
+                return;
+            }
+            bitmap = std::make_unique<detail::Roaring64Map>();
+            for (auto& key : set) {
+                bitmap->add(to_bitmap_value(key));
+            }
+            MyHashSet().swap(set);
+        }
+    }
 };
 
 template <LogicalType LT, LogicalType SumLT>
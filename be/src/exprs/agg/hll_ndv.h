@@ -21,6 +21,7 @@
 #include "exprs/agg/aggregate.h"
 #include "gutil/casts.h"
 #include "types/hll.h"
+#include "util/coding.h"
 
 namespace starrocks {
 
@@ -41,48 +42,23 @@ public:
 
     void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
                 size_t row_num) const override {
-        uint64_t value = 0;
         const auto* column = down_cast<const ColumnType*>(columns[0]);
-
-        if constexpr (lt_is_string<LT>) {
-            Slice s = column->get_slice(row_num);
-            value = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
-        } else {
-            const auto& v = column->get_data();
-            value = HashUtil::murmur_hash64A(&v[row_num], sizeof(v[row_num]), HashUtil::MURMUR_SEED);
-        }
+        uint64_t value = hash_row(column, row_num);
 
         if (value != 0) {
             this->data(state).update(value);
         }
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        update_range(down_cast<const ColumnType*>(columns[0]), 0, chunk_size, this->data(state));
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
-        const auto* column = down_cast<const ColumnType*>(columns[0]);
-
-        if constexpr (lt_is_string<LT>) {
-            uint64_t value = 0;
-            for (size_t i = frame_start; i < frame_end; ++i) {
-                Slice s = column->get_slice(i);
-                value = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
-
-                if (value != 0) {
-                    this->data(state).update(value);
-                }
-            }
-        } else {
-            uint64_t value = 0;
-            const auto& v = column->get_data();
-            for (size_t i = frame_start; i < frame_end; ++i) {
-                value = HashUtil::murmur_hash64A(&v[i], sizeof(v[i]), HashUtil::MURMUR_SEED);
-
-                if (value != 0) {
-                    this->data(state).update(value);
-                }
-            }
-        }
+        update_range(down_cast<const ColumnType*>(columns[0]), frame_start, frame_end, this->data(state));
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
@@ -122,31 +98,31 @@ public:
         auto* result = down_cast<BinaryColumn*>((*dst).get());
 
         Bytes& bytes = result->get_bytes();
-        bytes.reserve(chunk_size * 10);
         result->get_offset().resize(chunk_size + 1);
 
+        // Every row becomes a HyperLogLog holding at most one hash, whose serialized form is either a single
+        // HLL_DATA_EMPTY byte or HLL_DATA_EXPLICIT followed by the count and the hash. Write it out directly
+        // instead of building a HyperLogLog object per row.
         size_t old_size = bytes.size();
-        uint64_t value = 0;
-        for (size_t i = 0; i < chunk_size; ++i) {
-            HyperLogLog hll;
-            if constexpr (lt_is_string<LT>) {
-                Slice s = column->get_slice(i);
-                value = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
-            } else {
-                auto v = column->get_data()[i];
-                value = HashUtil::murmur_hash64A(&v, sizeof(v), HashUtil::MURMUR_SEED);
-            }
-            if (value != 0) {
-                hll.update(value);
+        bytes.resize(old_size + chunk_size * kExplicitSingleSize);
+        uint8_t* ptr = bytes.data() + old_size;
+        uint64_t hashes[kHashBatchSize];
+        for (size_t i = 0; i < chunk_size; i += kHashBatchSize) {
+            size_t n = std::min(kHashBatchSize, chunk_size - i);
+            hash_rows(column, i, i + n, hashes);
+            for (size_t j = 0; j < n; ++j) {
+                if (hashes[j] != 0) {
+                    *ptr++ = HLL_DATA_EXPLICIT;
+                    *ptr++ = 1;
+                    encode_fixed64_le(ptr, hashes[j]);
+                    ptr += sizeof(uint64_t);
+                } else {
+                    *ptr++ = HLL_DATA_EMPTY;
+                }
+                result->get_offset()[i + j + 1] = ptr - bytes.data();
             }
-
-            size_t new_size = old_size + hll.max_serialized_size();
-            bytes.resize(new_size);
-            hll.serialize(bytes.data() + old_size);
-
-            result->get_offset()[i + 1] = new_size;
-            old_size = new_size;
         }
+        bytes.resize(ptr - bytes.data());
     }
 
     void finalize_to_column(FunctionContext* ctx __attribute__((unused)), ConstAggDataPtr __restrict state,
@@ -171,6 +147,48 @@ public:
             return "ndv";
         }
     }
+
+private:
+    static constexpr size_t kHashBatchSize = 256;
+    static constexpr size_t kExplicitSingleSize = 2 + sizeof(uint64_t);
+
+    static uint64_t hash_row(const ColumnType* column, size_t row) {
+        if constexpr (lt_is_string<LT>) {
+            Slice s = column->get_slice(row);
+            return HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
+        } else {
+            const auto& v = column->get_data()[row];
+            return HashUtil::murmur_hash64A(&v, sizeof(v), HashUtil::MURMUR_SEED);
+        }
+    }
+
+    // Hash rows [start, end) into a plain buffer first, so that the hash loop runs without touching the sketch.
+    static void hash_rows(const ColumnType* column, size_t start, size_t end, uint64_t* hashes) {
+        if constexpr (lt_is_string<LT>) {
+            for (size_t i = start; i < end; ++i) {
+                Slice s = column->get_slice(i);
+                hashes[i - start] = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
+            }
+        } else {
+            const auto* data = column->get_data().data();
+            for (size_t i = start; i < end; ++i) {
+                hashes[i - start] = HashUtil::murmur_hash64A(&data[i], sizeof(data[i]), HashUtil::MURMUR_SEED);
+            }
+        }
+    }
+
+    static void update_range(const ColumnType* column, size_t start, size_t end, HyperLogLog& hll) {
+        uint64_t hashes[kHashBatchSize];
+        for (size_t i = start; i < end; i += kHashBatchSize) {
+            size_t n = std::min(kHashBatchSize, end - i);
+            hash_rows(column, i, i + n, hashes);
+            for (size_t j = 0; j < n; ++j) {
+                if (hashes[j] != 0) {
+                    hll.update(hashes[j]);
+                }
+            }
+        }
+    }
 };
 
 } // namespace starrocks
@@ -113,6 +113,45 @@ struct DecimalBinaryFunction {
         return false;
     }
 
+    // The product of two operands fitting in 64 bits never overflows 128 bits, so the overflow of int128
+    // multiplications is checked per batch: a batch whose operands all pass the range test is multiplied
+    // by 64x64->128 bits multiplications without any check, and only a batch failing it falls back to the
+    // checked multiplication per row.
+    template <bool lhs_is_const, bool rhs_is_const, typename BinaryOperator>
+    static inline void mul_int128_in_batches(size_t num_rows, const int128_t* lhs_data, const int128_t* rhs_data,
+                                             int128_t* result_data, NullColumn::ValueType* nulls, bool* has_null) {
+        static constexpr size_t kBatchSize = 64;
+        auto fits_in_int64 = [](int128_t v) { return static_cast<int128_t>(static_cast<int64_t>(v)) == v; };
+        const bool const_fits = (!lhs_is_const || fits_in_int64(lhs_data[0])) &&
+                                (!rhs_is_const || fits_in_int64(rhs_data[0]));
+
+        for (size_t begin = 0; begin < num_rows; begin += kBatchSize) {
+            const size_t end = std::min(num_rows, begin + kBatchSize);
+            // no early exit, so that the range test is vectorized.
+            bool fits = const_fits;
+            for (size_t i = begin; i < end; ++i) {
+                if constexpr (!lhs_is_const) {
+                    fits &= fits_in_int64(lhs_data[i]);
+                }
+                if constexpr (!rhs_is_const) {
+                    fits &= fits_in_int64(rhs_data[i]);
+                }
+            }
+
+            if (fits) {
+                for (size_t i = begin; i < end; ++i) {
+                    const auto l = static_cast<int64_t>(lhs_data[lhs_is_const ? 0 : i]);
+                    const auto r = static_cast<int64_t>(rhs_data[rhs_is_const ? 0 : i]);
+                    result_data[i] = static_cast<int128_t>(l) * r;
+                }
+            } else {
+                adjust_evaluate<lhs_is_const, rhs_is_const, false, BinaryOperator>(
+                        end - begin, lhs_is_const ? lhs_data : lhs_data + begin,
+                        rhs_is_const ? rhs_data : rhs_data + begin, result_data + begin, nulls + begin, has_null, 0);
+            }
+        }
+    }
+
     template <bool lhs_is_const, bool rhs_is_const, LogicalType LhsType, LogicalType RhsType, LogicalType ResultType>
     static inline ColumnPtr evaluate(const ColumnPtr& lhs, const ColumnPtr& rhs) {
         using ResultCppType = RunTimeCppType<ResultType>;
@@ -175,8 +214,14 @@ struct DecimalBinaryFunction {
             }
         } else if constexpr (is_mul_op<Op>) {
             // mul operation, no need to adjust scale
-            all_null = adjust_evaluate<lhs_is_const, rhs_is_const, false, BinaryOperator>(
-                    num_rows, lhs_data, rhs_data, result_data, nulls, &has_null, adjust_scale);
+            if constexpr (check_overflow<overflow_mode> && lt_is_decimal128<LhsType> && lt_is_decimal128<RhsType> &&
+                          lt_is_decimal128<ResultType>) {
+                mul_int128_in_batches<lhs_is_const, rhs_is_const, BinaryOperator>(num_rows, lhs_data, rhs_data,
+                                                                                  result_data, nulls, &has_null);
+            } else {
+                all_null = adjust_evaluate<lhs_is_const, rhs_is_const, false, BinaryOperator>(
+                        num_rows, lhs_data, rhs_data, result_data, nulls, &has_null, adjust_scale);
+            }
         } else if constexpr (is_div_op<Op>) {
             // div operation, scale lhs up by S(rhs)
             if (adjust_scale == 0) {
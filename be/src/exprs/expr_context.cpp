@@ -36,16 +36,21 @@
 
 #include <fmt/format.h>
 
+#include <functional>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exprs/column_ref.h"
 #include "exprs/expr.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/literal.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -156,10 +161,39 @@ std::string ExprContext::get_error_msg() const {
 }
 
 StatusOr<ColumnPtr> ExprContext::evaluate(Chunk* chunk, uint8_t* filter) {
+    if (!_common_sub_exprs_inited) {
+        _init_common_sub_exprs();
+    }
+    if (_common_sub_exprs.empty() || filter != nullptr) {
+        return evaluate(_root, chunk, filter);
+    }
+    _evaluating_root = true;
+    DeferOp defer([this]() {
+        _evaluating_root = false;
+        _common_sub_expr_results.clear();
+    });
     return evaluate(_root, chunk, filter);
 }
 
 StatusOr<ColumnPtr> ExprContext::evaluate(Expr* e, Chunk* chunk, uint8_t* filter) {
+    if (!_evaluating_root || filter != nullptr) {
+        return _evaluate(e, chunk, filter);
+    }
+    auto iter = _common_sub_exprs.find(e);
+    if (iter == _common_sub_exprs.end()) {
+        return _evaluate(e, chunk, filter);
+    }
+    auto& [evaluated_chunk, result] = _common_sub_expr_results[iter->second];
+    if (result != nullptr && evaluated_chunk == chunk) {
+        return result;
+    }
+    ASSIGN_OR_RETURN(auto ptr, _evaluate(e, chunk, filter));
+    evaluated_chunk = chunk;
+    result = ptr;
+    return ptr;
+}
+
+StatusOr<ColumnPtr> ExprContext::_evaluate(Expr* e, Chunk* chunk, uint8_t* filter) {
     DCHECK(_prepared);
     DCHECK(_opened);
     DCHECK(!_closed);
@@ -186,6 +220,63 @@ StatusOr<ColumnPtr> ExprContext::evaluate(Expr* e, Chunk* chunk, uint8_t* filter
     }
 }
 
+void ExprContext::_init_common_sub_exprs() {
+    _common_sub_exprs_inited = true;
+    _common_sub_exprs.clear();
+    if (!config::enable_expr_common_sub_expr_reuse) {
+        return;
+    }
+
+    // Lambda functions evaluate their bodies on temporary chunks, keep away from them.
+    bool has_lambda = false;
+    std::unordered_map<std::string, const Expr*> first_exprs;
+    // Returns a fingerprint that identifies the subtree rooted at |e|, or an empty string if the subtree
+    // may not be shared, e.g. it returns random values or its result depends on state we don't hash.
+    std::function<std::string(const Expr*)> fingerprint = [&](const Expr* e) -> std::string {
+        if (e->node_type() == TExprNodeType::LAMBDA_FUNCTION_EXPR) {
+            has_lambda = true;
+        }
+        std::string children;
+        bool children_ok = true;
+        for (const Expr* child : e->children()) {
+            auto child_fingerprint = fingerprint(child);
+            children_ok &= !child_fingerprint.empty();
+            children.append(child_fingerprint).append(",");
+        }
+        if (dynamic_cast<const ColumnRef*>(e) != nullptr || dynamic_cast<const VectorizedLiteral*>(e) != nullptr) {
+            return e->debug_string();
+        }
+        if (!children_ok) {
+            return {};
+        }
+
+        std::string key;
+        if (auto* fn_call = dynamic_cast<const VectorizedFunctionCallExpr*>(e); fn_call != nullptr) {
+            if (fn_call->is_returning_random_value()) {
+                return {};
+            }
+            key = fmt::format("fn:{}#{}:{}({})", e->fn().name.function_name, e->fn().fid, e->type().debug_string(),
+                              children);
+        } else if (e->node_type() == TExprNodeType::CAST_EXPR) {
+            key = fmt::format("cast:{}({})", e->type().debug_string(), children);
+        } else {
+            return {};
+        }
+        if (!e->is_constant()) {
+            auto [iter, inserted] = first_exprs.emplace(key, e);
+            if (!inserted) {
+                _common_sub_exprs[iter->second] = iter->second;
+                _common_sub_exprs[e] = iter->second;
+            }
+        }
+        return key;
+    };
+    fingerprint(_root);
+    if (has_lambda) {
+        _common_sub_exprs.clear();
+    }
+}
+
 bool ExprContext::ngram_bloom_filter(const BloomFilter* bf, const NgramBloomFilterReaderOptions& reader_options) {
     return _root->ngram_bloom_filter(this, bf, reader_options);
 }
@@ -215,6 +306,7 @@ Status ExprContext::rewrite_jit_expr(ObjectPool* pool) {
     }
     if (replaced) { // only prepare jit_expr
         WARN_IF_ERROR(_root->prepare_jit_expr(_runtime_state, this), "prepare rewritten expr failed");
+        _common_sub_exprs_inited = false;
     }
     return Status::OK();
 }
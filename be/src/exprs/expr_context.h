@@ -36,6 +36,8 @@
 
 #include <atomic>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 
 #include "column/vectorized_fwd.h"
 #include "common/status.h"
@@ -130,6 +132,12 @@ private:
     friend class OlapScanNode;
     friend class EsPredicate;
 
+    [[nodiscard]] StatusOr<ColumnPtr> _evaluate(Expr* expr, Chunk* chunk, uint8_t* filter);
+
+    // Finds the deterministic subtrees that occur more than once in the expression tree, each of them is
+    // evaluated only once per evaluation of the root, i.e. once per chunk.
+    void _init_common_sub_exprs();
+
     /// FunctionContexts for each registered expression. The FunctionContexts are created
     /// and owned by this ExprContext.
     std::vector<FunctionContext*> _fn_contexts;
@@ -148,6 +156,13 @@ private:
     bool _opened{false};
     // In operator, the ExprContext::close method will be called concurrently
     std::atomic<bool> _closed{false};
+
+    bool _common_sub_exprs_inited{false};
+    // each duplicated subtree, including the first one, mapped to the first subtree with the same fingerprint.
+    std::unordered_map<const Expr*, const Expr*> _common_sub_exprs;
+    // results of the common subtrees in the current evaluation of the root, along with the evaluated chunk.
+    std::unordered_map<const Expr*, std::pair<Chunk*, ColumnPtr>> _common_sub_expr_results;
+    bool _evaluating_root{false};
 };
 
 #define RETURN_IF_HAS_ERROR(expr_ctxs)             \
@@ -32,6 +32,8 @@ public:
 
     const FunctionDescriptor* get_function_desc() { return _fn_desc; }
 
+    bool is_returning_random_value() const { return _is_returning_random_value; }
+
     bool support_ngram_bloom_filter(ExprContext* context) const override;
     bool ngram_bloom_filter(ExprContext* context, const BloomFilter* bf,
                             const NgramBloomFilterReaderOptions& reader_options) const override;
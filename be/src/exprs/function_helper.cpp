@@ -26,13 +26,14 @@ NullColumnPtr FunctionHelper::union_nullable_column(const ColumnPtr& v1, const C
     if (v1->is_nullable() && v2->is_nullable()) {
         const auto& n1 = ColumnHelper::as_raw_column<NullableColumn>(v1)->null_column();
         const auto& n2 = ColumnHelper::as_raw_column<NullableColumn>(v2)->null_column();
+        // only one side carries nulls, copy its null column instead of OR-ing both of them
         if (!v1->has_null()) {
             result = n2->clone();
-        }
-        if (!v2->has_null()) {
+        } else if (!v2->has_null()) {
             result = n1->clone();
+        } else {
+            return union_null_column(n1, n2);
         }
-        return union_null_column(n1, n2);
     } else if (v1->is_nullable()) {
         result = ColumnHelper::as_raw_column<NullableColumn>(v1)->null_column()->clone();
     } else if (v2->is_nullable()) {
@@ -45,42 +46,6 @@ NullColumnPtr FunctionHelper::union_nullable_column(const ColumnPtr& v1, const C
     return ColumnHelper::cast_to<TYPE_NULL>(result);
 }
 
-void FunctionHelper::union_produce_nullable_column(const ColumnPtr& v1, const ColumnPtr& v2,
-                                                   NullColumnPtr* produce_null_column) {
-    auto* result = (*produce_null_column)->get_data().data();
-
-    if (v1->has_null()) {
-        auto* null1 = down_cast<NullableColumn*>(v1.get())->null_column()->get_data().data();
-
-        int size = v1->size();
-        for (int i = 0; i < size; ++i) {
-            result[i] = result[i] | null1[i];
-        }
-    }
-
-    if (v2->has_null()) {
-        auto* null2 = down_cast<NullableColumn*>(v2.get())->null_column()->get_data().data();
-
-        int size = v2->size();
-        for (int i = 0; i < size; ++i) {
-            result[i] = result[i] | null2[i];
-        }
-    }
-}
-
-void FunctionHelper::union_produce_nullable_column(const ColumnPtr& v1, NullColumnPtr* produce_null_column) {
-    auto* result = (*produce_null_column)->get_data().data();
-
-    if (v1->has_null()) {
-        auto* null1 = down_cast<NullableColumn*>(v1.get())->null_column()->get_data().data();
-
-        int size = v1->size();
-        for (int i = 0; i < size; ++i) {
-            result[i] = result[i] | null1[i];
-        }
-    }
-}
-
 MFV_AVX512(void union_null_column_impl(uint8_t* dest, const uint8_t* v1, const uint8_t* v2, const size_t bytes) {
     constexpr auto SIMD_SIZE = sizeof(__m512i);
     const auto null1_end = v1 + bytes;
@@ -128,6 +93,23 @@ MFV_DEFAULT(void union_null_column_impl(uint8_t* dest, const uint8_t* v1, const
     }
 })
 
+void FunctionHelper::union_produce_nullable_column(const ColumnPtr& v1, const ColumnPtr& v2,
+                                                   NullColumnPtr* produce_null_column) {
+    union_produce_nullable_column(v1, produce_null_column);
+    union_produce_nullable_column(v2, produce_null_column);
+}
+
+void FunctionHelper::union_produce_nullable_column(const ColumnPtr& v1, NullColumnPtr* produce_null_column) {
+    if (!v1->has_null()) {
+        return;
+    }
+    auto* result = (*produce_null_column)->get_data().data();
+    const auto* null1 = down_cast<NullableColumn*>(v1.get())->null_column()->get_data().data();
+    const size_t bytes_size = sizeof(NullColumn::ValueType) * v1->size();
+    // OR-ing in place is safe, every lane only reads the bytes it writes
+    union_null_column_impl(result, result, null1, bytes_size);
+}
+
 NullColumnPtr FunctionHelper::union_null_column(const NullColumnPtr& v1, const NullColumnPtr& v2) {
     // union null column
     auto null1_begin = (uint8_t*)v1->get_data().data();
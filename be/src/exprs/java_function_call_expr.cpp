@@ -14,12 +14,15 @@
 
 #include "exprs/java_function_call_expr.h"
 
+#include <fmt/format.h>
+
 #include <any>
 #include <memory>
 #include <sstream>
 #include <tuple>
 #include <vector>
 
+#include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column.h"
 #include "column/column_helper.h"
@@ -40,12 +43,32 @@
 
 namespace starrocks {
 
+static bool is_fixed_length_udf_type(LogicalType type) {
+    switch (type) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
 struct UDFFunctionCallHelper {
     JavaUDFContext* fn_desc;
     JavaMethodDescriptor* call_desc;
+    // Whether evaluateBatch of the UDF is called instead of evaluate
+    bool use_evaluate_batch = false;
 
     // Now we don't support logical type function
     ColumnPtr call(FunctionContext* ctx, Columns& columns, size_t size) {
+        if (use_evaluate_batch) {
+            return call_batch(ctx, columns, size);
+        }
         auto& helper = JVMFunctionHelper::getInstance();
         JNIEnv* env = helper.getEnv();
         std::vector<DirectByteBuffer> buffers;
@@ -81,6 +104,74 @@ struct UDFFunctionCallHelper {
         return result_cols;
     }
 
+    // Call evaluateBatch with direct buffers over the memory of the columns, so that neither the arguments
+    // nor the result are boxed, and the UDF is invoked once per chunk rather than once per row.
+    ColumnPtr call_batch(FunctionContext* ctx, Columns& columns, size_t size) {
+        auto& helper = JVMFunctionHelper::getInstance();
+        JNIEnv* env = helper.getEnv();
+        int num_cols = ctx->get_num_args();
+
+        for (int i = 0; i < num_cols; ++i) {
+            auto& column = columns[i];
+            if (column->only_null()) {
+                column = ColumnHelper::create_column(TypeDescriptor(ctx->get_arg_type(i)->type), true);
+                column->append_nulls(size);
+            } else if (column->is_constant()) {
+                column = ColumnHelper::unpack_and_duplicate_const_column(size, column);
+            }
+        }
+
+        auto result = ColumnHelper::create_column(TypeDescriptor(call_desc->method_desc[0].type), true);
+        result->resize(size);
+        if (size == 0) {
+            return result;
+        }
+
+        // three buffers for each argument, the argument array and two buffers for the result
+        env->PushLocalFrame(num_cols * 3 + 3);
+        auto defer = DeferOp([env]() { env->PopLocalFrame(nullptr); });
+        auto new_buffer = [env](const void* data, size_t bytes) {
+            // an empty column may have no memory, but a direct buffer can't be created on a null address.
+            static uint8_t empty = 0;
+            return env->NewDirectByteBuffer(bytes == 0 ? &empty : const_cast<void*>(data), bytes);
+        };
+
+        auto args = static_cast<jobjectArray>(helper.create_direct_buffer_array(num_cols * 3));
+        RETURN_IF_UNLIKELY_NULL(args, ColumnHelper::create_const_null_column(size));
+        for (int i = 0; i < num_cols; ++i) {
+            const Column* data_column = columns[i].get();
+            if (data_column->is_nullable()) {
+                const auto& nulls = down_cast<const NullableColumn*>(data_column)->immutable_null_column_data();
+                env->SetObjectArrayElement(args, i * 3, new_buffer(nulls.data(), nulls.size()));
+                data_column = down_cast<const NullableColumn*>(data_column)->data_column().get();
+            }
+            if (data_column->is_binary()) {
+                const auto& offsets = down_cast<const BinaryColumn*>(data_column)->get_offset();
+                const auto& bytes = down_cast<const BinaryColumn*>(data_column)->get_bytes();
+                env->SetObjectArrayElement(args, i * 3 + 1,
+                                           new_buffer(offsets.data(), offsets.size() * sizeof(offsets[0])));
+                env->SetObjectArrayElement(args, i * 3 + 2, new_buffer(bytes.data(), bytes.size()));
+            } else {
+                env->SetObjectArrayElement(args, i * 3 + 2,
+                                           new_buffer(data_column->raw_data(), size * data_column->type_size()));
+            }
+        }
+
+        auto* nullable_result = down_cast<NullableColumn*>(result.get());
+        auto& result_nulls = nullable_result->null_column_data();
+        auto* result_data = nullable_result->data_column().get();
+        jobject nulls_buffer = new_buffer(result_nulls.data(), result_nulls.size());
+        jobject data_buffer = new_buffer(result_data->mutable_raw_data(), size * result_data->type_size());
+        env->CallVoidMethod(fn_desc->udf_handle.handle(), fn_desc->evaluate_batch->get_method_id(),
+                            static_cast<jint>(size), args, nulls_buffer, data_buffer);
+        if (env->ExceptionCheck()) {
+            CHECK_UDF_CALL_EXCEPTION(env, ctx);
+            return ColumnHelper::create_const_null_column(size);
+        }
+        nullable_result->update_has_null();
+        return result;
+    }
+
     ColumnPtr get_boxed_result(FunctionContext* ctx, jobject result, size_t num_rows) {
         if (result == nullptr) {
             return ColumnHelper::create_const_null_column(num_rows);
@@ -191,6 +282,25 @@ StatusOr<std::shared_ptr<JavaUDFContext>> JavaFunctionCallExpr::_build_udf_func_
     // RETURN_IF_ERROR(add_method("method_close", &desc->close));
     RETURN_IF_ERROR(add_method("evaluate", &desc->evaluate));
 
+    // evaluateBatch takes ByteBuffers rather than the types of the arguments, so its signature is checked as a whole.
+    bool has_evaluate_batch = false;
+    const std::string evaluate_batch_name = JavaUDFContext::evaluate_batch_name;
+    RETURN_IF_ERROR(desc->analyzer->has_method(desc->udf_class.clazz(), evaluate_batch_name, &has_evaluate_batch));
+    if (has_evaluate_batch) {
+        std::string signature;
+        RETURN_IF_ERROR(desc->analyzer->get_signature(desc->udf_class.clazz(), evaluate_batch_name, &signature));
+        if (signature != JavaUDFContext::evaluate_batch_signature) {
+            return Status::InternalError(fmt::format("{}.{} should be declared as {}, but got {}",
+                                                     _fn.scalar_fn.symbol, evaluate_batch_name,
+                                                     JavaUDFContext::evaluate_batch_signature, signature));
+        }
+        desc->evaluate_batch = std::make_unique<JavaMethodDescriptor>();
+        desc->evaluate_batch->name = evaluate_batch_name;
+        desc->evaluate_batch->signature = std::move(signature);
+        ASSIGN_OR_RETURN(desc->evaluate_batch->method,
+                         desc->analyzer->get_method_object(desc->udf_class.clazz(), evaluate_batch_name));
+    }
+
     // create UDF function instance
     ASSIGN_OR_RETURN(desc->udf_handle, desc->udf_class.newInstance());
     // BatchEvaluateStub
@@ -257,6 +367,15 @@ Status JavaFunctionCallExpr::open(RuntimeState* state, ExprContext* context,
         _call_helper = std::make_shared<UDFFunctionCallHelper>();
         _call_helper->fn_desc = _func_desc.get();
         _call_helper->call_desc = _func_desc->evaluate.get();
+        // evaluateBatch is called if the arguments can be passed as buffers and the result can be written in place.
+        auto* fn_ctx = context->fn_context(_fn_context_index);
+        bool use_evaluate_batch = _func_desc->evaluate_batch != nullptr &&
+                                  is_fixed_length_udf_type(_func_desc->evaluate->method_desc[0].type);
+        for (int i = 0; i < fn_ctx->get_num_args() && use_evaluate_batch; ++i) {
+            auto type = fn_ctx->get_arg_type(i)->type;
+            use_evaluate_batch = is_fixed_length_udf_type(type) || type == TYPE_VARCHAR || type == TYPE_CHAR;
+        }
+        _call_helper->use_evaluate_batch = use_evaluate_batch;
     }
     return Status::OK();
 }
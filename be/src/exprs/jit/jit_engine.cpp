@@ -282,6 +282,24 @@ bool JITEngine::lookup_function(JitObjectCache* const obj) {
     return true;
 }
 
+bool JITEngine::count_and_check_hot(const std::string& func_name) {
+    const int64_t threshold = config::jit_compile_hot_threshold;
+    if (threshold <= 1) {
+        return true;
+    }
+    std::lock_guard<std::mutex> l(_hot_counts_lock);
+    // the counters are only a hint, forget all of them instead of tracking an unbounded number of expressions.
+    if (_hot_counts.size() >= kMaxHotCounts && _hot_counts.find(func_name) == _hot_counts.end()) {
+        _hot_counts.clear();
+    }
+    auto& count = _hot_counts[func_name];
+    if (++count < threshold) {
+        return false;
+    }
+    _hot_counts.erase(func_name);
+    return true;
+}
+
 template <typename T>
 StatusOr<T> as_JIT_result(llvm::Expected<T>& expected, const std::string& error_context) {
     if (!expected) {
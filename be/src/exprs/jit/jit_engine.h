@@ -25,6 +25,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "column/vectorized_fwd.h"
 #include "common/status.h"
@@ -92,6 +93,10 @@ public:
 
     bool lookup_function(JitObjectCache* const obj);
 
+    // Count one more preparation of the expression |func_name| and return whether it has been
+    // prepared at least config::jit_compile_hot_threshold times, i.e. it is worth compiling.
+    bool count_and_check_hot(const std::string& func_name);
+
     Cache* get_func_cache() const { return _func_cache; }
 
     static Status generate_scalar_function_ir(ExprContext* context, llvm::Module& module, Expr* expr,
@@ -134,9 +139,14 @@ private:
         std::unique_ptr<llvm::TargetMachine> _target_machine;
     };
 
+    static constexpr size_t kMaxHotCounts = 4096;
+
     bool _initialized = false;
     bool _support_jit = false;
     Cache* _func_cache;
+
+    std::mutex _hot_counts_lock;
+    std::unordered_map<std::string, int64_t> _hot_counts;
 };
 
 } // namespace starrocks
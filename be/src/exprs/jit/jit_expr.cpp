@@ -79,6 +79,11 @@ Status JITExpr::prepare_impl(RuntimeState* state, ExprContext* context) {
         }
         auto expr_name = _expr->jit_func_name(state);
         _jit_obj_cache = std::make_unique<JitObjectCache>(expr_name, JITEngine::get_instance()->get_func_cache());
+        if (state->is_adaptive_jit() && !jit_engine->lookup_function(_jit_obj_cache.get()) &&
+            !jit_engine->count_and_check_hot(expr_name)) {
+            // Interpret the expression until it is seen often enough to be worth compiling.
+            return Status::OK();
+        }
 
         auto st = jit_engine->compile_scalar_function(context, _jit_obj_cache.get(), _expr, _children);
         auto elapsed = MonotonicNanos() - start;
@@ -354,34 +354,6 @@ StatusOr<ColumnPtr> JsonFunctions::json_string(FunctionContext* context, const C
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
-StatusOr<ColumnPtr> _string_json(FunctionContext* context, const Columns& columns) {
-    ColumnViewer<TYPE_VARCHAR> viewer(columns[0]);
-    ColumnBuilder<TYPE_JSON> result(columns[0]->size());
-
-    for (int row = 0; row < columns[0]->size(); row++) {
-        if (viewer.is_null(row)) {
-            result.append_null();
-        } else {
-            auto raw = viewer.value(row);
-            JsonValue json_value;
-            auto st = JsonValue::parse(raw, &json_value);
-            if (!st.ok()) {
-                result.append_null();
-            } else {
-                result.append(std::move(json_value));
-            }
-        }
-    }
-    return result.build(ColumnHelper::is_all_const(columns));
-}
-
-template <LogicalType ResultType>
-StatusOr<ColumnPtr> JsonFunctions::_get_json_value(FunctionContext* context, const Columns& columns) {
-    ASSIGN_OR_RETURN(auto jsons, _string_json(context, columns));
-    const auto& paths = columns[1];
-    return _full_json_query_impl<ResultType>(context, Columns{jsons, paths});
-}
-
 //////////////////////////// User visiable functions /////////////////////////////////
 struct NativeJsonState {
 public:
@@ -416,6 +388,46 @@ static StatusOr<JsonPath*> get_prepared_or_parse(FunctionContext* context, Slice
     return out;
 }
 
+template <LogicalType ResultType>
+StatusOr<ColumnPtr> JsonFunctions::_get_json_value(FunctionContext* context, const Columns& columns) {
+    // Extract the path from each document right after it's parsed, rather than parsing all the documents into an
+    // intermediate json column first, so that every document is only copied once.
+    auto num_rows = columns[0]->size();
+    auto json_viewer = ColumnViewer<TYPE_VARCHAR>(columns[0]);
+    auto path_viewer = ColumnViewer<TYPE_VARCHAR>(columns[1]);
+    ColumnBuilder<ResultType> result(num_rows);
+
+    JsonPath stored_path;
+    JsonValue json_value;
+    vpack::Builder builder;
+    for (int row = 0; row < num_rows; ++row) {
+        if (json_viewer.is_null(row) || path_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+        auto path_value = path_viewer.value(row);
+        auto jsonpath = get_prepared_or_parse(context, path_value, &stored_path);
+        if (!jsonpath.ok()) {
+            VLOG(2) << "parse json path failed: " << path_value;
+            result.append_null();
+            continue;
+        }
+        if (!JsonValue::parse(json_viewer.value(row), &json_value).ok()) {
+            result.append_null();
+            continue;
+        }
+
+        builder.clear();
+        vpack::Slice slice = JsonPath::extract(&json_value, *jsonpath.value(), &builder);
+        Status st = cast_vpjson_to<ResultType, false>(slice, result);
+        if (!st.ok()) {
+            result.append_null();
+            continue;
+        }
+    }
+    return result.build(ColumnHelper::is_all_const(columns));
+}
+
 Status JsonFunctions::native_json_path_prepare(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
     if (scope != FunctionContext::FRAGMENT_LOCAL) {
         return Status::OK();
@@ -15,12 +15,14 @@
 #include "exprs/like_predicate.h"
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
+#include "common/config.h"
 #include "exprs/binary_function.h"
 #include "glog/logging.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/Volnitsky.h"
-#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -44,23 +46,63 @@ static const re2::RE2 LIKE_STARTS_WITH_RE(R"((((\\%)|(\\_)|([^%_]))+)(?:%+))", r
 static const re2::RE2 LIKE_EQUALS_RE(R"((((\\%)|(\\_)|([^%_]))+))", re2::RE2::Quiet);
 static const char* PROMPT_INFO = " so we switch to use re2.";
 
+// Hyperscan databases are immutable once compiled and can be scanned concurrently, each caller only needs
+// its own scratch space. Cache them by pattern so that the fragment instances and queries using the same
+// pattern don't compile it again and again.
+class HyperscanDatabaseCache {
+public:
+    static HyperscanDatabaseCache* instance() {
+        static HyperscanDatabaseCache cache;
+        return &cache;
+    }
+
+    std::shared_ptr<hs_database_t> lookup(const std::string& pattern) {
+        std::lock_guard<std::mutex> l(_lock);
+        auto iter = _databases.find(pattern);
+        return iter == _databases.end() ? nullptr : iter->second;
+    }
+
+    void insert(const std::string& pattern, const std::shared_ptr<hs_database_t>& database) {
+        const int32_t capacity = config::hyperscan_database_cache_capacity;
+        if (capacity <= 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> l(_lock);
+        // evict an arbitrary entry, databases still in use are kept alive by their predicates.
+        while (!_databases.empty() && _databases.size() >= capacity) {
+            _databases.erase(_databases.begin());
+        }
+        _databases.emplace(pattern, database);
+    }
+
+private:
+    std::mutex _lock;
+    std::unordered_map<std::string, std::shared_ptr<hs_database_t>> _databases;
+};
+
 bool LikePredicate::hs_compile_and_alloc_scratch(const std::string& pattern, LikePredicateState* state,
                                                  FunctionContext* context, const Slice& slice) {
-    if (hs_compile(pattern.c_str(), HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH,
-                   HS_MODE_BLOCK, nullptr, &state->database, &state->compile_err) != HS_SUCCESS) {
-        std::stringstream error;
-        error << "Invalid hyperscan expression: " << std::string(slice.data, slice.size) << ": "
-              << state->compile_err->message << PROMPT_INFO;
-        LOG(WARNING) << error.str().c_str();
-        hs_free_compile_error(state->compile_err);
-        return false;
+    state->database = HyperscanDatabaseCache::instance()->lookup(pattern);
+    if (state->database == nullptr) {
+        hs_database_t* database = nullptr;
+        if (hs_compile(pattern.c_str(), HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH,
+                       HS_MODE_BLOCK, nullptr, &database, &state->compile_err) != HS_SUCCESS) {
+            std::stringstream error;
+            error << "Invalid hyperscan expression: " << std::string(slice.data, slice.size) << ": "
+                  << state->compile_err->message << PROMPT_INFO;
+            LOG(WARNING) << error.str().c_str();
+            hs_free_compile_error(state->compile_err);
+            return false;
+        }
+        state->database = std::shared_ptr<hs_database_t>(database, hs_free_database);
+        HyperscanDatabaseCache::instance()->insert(pattern, state->database);
     }
 
-    if (hs_alloc_scratch(state->database, &state->scratch) != HS_SUCCESS) {
+    if (hs_alloc_scratch(state->database.get(), &state->scratch) != HS_SUCCESS) {
         std::stringstream error;
         error << "ERROR: Unable to allocate scratch space," << PROMPT_INFO;
         LOG(WARNING) << error.str().c_str();
-        hs_free_database(state->database);
+        state->database.reset();
         return false;
     }
 
@@ -406,20 +448,8 @@ StatusOr<ColumnPtr> LikePredicate::_predicate_const_regex(FunctionContext* conte
                                                           const ColumnPtr& value_column) {
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
 
-    hs_scratch_t* scratch = nullptr;
-    hs_error_t status;
-    if ((status = hs_clone_scratch(state->scratch, &scratch)) != HS_SUCCESS) {
-        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
-    }
-
-    DeferOp op([&] {
-        if (scratch != nullptr) {
-            hs_error_t st;
-            if ((st = hs_free_scratch(scratch)) != HS_SUCCESS) {
-                LOG(ERROR) << "free scratch space failure. status: " << st;
-            }
-        }
-    });
+    // the state is thread local, so its scratch space can be used directly.
+    hs_scratch_t* scratch = state->scratch;
 
     for (int row = 0; row < value_viewer.size(); ++row) {
         if (value_viewer.is_null(row)) {
@@ -431,7 +461,7 @@ StatusOr<ColumnPtr> LikePredicate::_predicate_const_regex(FunctionContext* conte
         auto value_size = value_viewer.value(row).size;
         [[maybe_unused]] auto status = hs_scan(
                 // Use &_DUMMY_STRING_FOR_EMPTY_PATTERN instead of nullptr to avoid crash.
-                state->database, (value_size) ? value_viewer.value(row).data : &_DUMMY_STRING_FOR_EMPTY_PATTERN,
+                state->database.get(), (value_size) ? value_viewer.value(row).data : &_DUMMY_STRING_FOR_EMPTY_PATTERN,
                 value_size, 0, scratch,
                 [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
                    void* ctx) -> int {
@@ -192,8 +192,9 @@ private:
 
         ColumnPtr _search_string_column;
 
-        // a pointer to the generated database that responsible for parsed expression.
-        hs_database_t* database = nullptr;
+        // the generated database that responsible for parsed expression, it is immutable and shared
+        // with the other predicates that use the same pattern.
+        std::shared_ptr<hs_database_t> database = nullptr;
         // a type containing error details that is returned by the compile calls on failure.
         hs_compile_error_t* compile_err = nullptr;
         // A Hyperscan scratch space, Used to call hs_scan,
@@ -206,10 +207,6 @@ private:
             if (scratch != nullptr) {
                 hs_free_scratch(scratch);
             }
-
-            if (database != nullptr) {
-                hs_free_database(database);
-            }
         }
 
         void set_search_string(const std::string& search_string_arg) {
@@ -12,10 +12,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#ifdef __AVX2__
-#include <immintrin.h>
-#endif
-
 #include <runtime/decimalv3.h>
 #include <types/logical_type.h>
 #include <util/decimal_types.h>
@@ -27,6 +23,7 @@
 #include "column/column_helper.h"
 #include "exprs/expr.h"
 #include "exprs/math_functions.h"
+#include "simd/vector_distance.h"
 #include "util/time.h"
 
 namespace starrocks {
@@ -740,153 +737,191 @@ StatusOr<ColumnPtr> MathFunctions::rand_seed(FunctionContext* context, const Col
     return rand(context, columns);
 }
 
-#ifdef __AVX2__
-static float sum_m256(__m256 v) {
-    __m256 hadd = _mm256_hadd_ps(v, v);
-    __m256 hadd2 = _mm256_hadd_ps(hadd, hadd);
-    __m128 vlow = _mm256_castps256_ps128(hadd2);
-    __m128 vhigh = _mm256_extractf128_ps(hadd2, 1);
-    __m128 result = _mm_add_ss(vlow, vhigh);
-    return _mm_cvtss_f32(result);
-}
-#endif
+namespace {
+
+// The flattened arrays of an argument of the vector functions. A constant argument keeps its single array, which
+// is paired with every row instead of being duplicated.
+template <typename CppType>
+struct VectorArgument {
+    const CppType* data = nullptr;
+    const uint32_t* offsets = nullptr;
+    bool is_constant = false;
+
+    size_t row(size_t i) const { return is_constant ? 0 : i; }
+    size_t dim(size_t i) const { return offsets[row(i) + 1] - offsets[row(i)]; }
+    const CppType* vector(size_t i) const { return data + offsets[row(i)]; }
+};
+
+template <LogicalType TYPE>
+StatusOr<VectorArgument<RunTimeCppType<TYPE>>> to_vector_argument(const char* name, const Column* column) {
+    VectorArgument<RunTimeCppType<TYPE>> arg;
+    if (column->is_constant()) {
+        arg.is_constant = true;
+        column = down_cast<const ConstColumn*>(column)->data_column().get();
+    }
+    if (column->is_nullable()) {
+        column = down_cast<const NullableColumn*>(column)->data_column().get();
+    }
+    const auto* array = down_cast<const ArrayColumn*>(column);
+    const Column* elements = array->elements_column().get();
+    if (elements->has_null()) {
+        return Status::InvalidArgument(fmt::format("{} does not support null values", name));
+    }
+    if (elements->is_nullable()) {
+        elements = down_cast<const NullableColumn*>(elements)->data_column().get();
+    }
+    arg.data = down_cast<const RunTimeColumnType<TYPE>*>(elements)->get_data().data();
+    arg.offsets = array->offsets().get_data().data();
+    return arg;
+}
+
+// The validated arguments of a function over pairs of vectors of the same dimension.
+template <LogicalType TYPE>
+struct VectorPairs {
+    VectorArgument<RunTimeCppType<TYPE>> base;
+    VectorArgument<RunTimeCppType<TYPE>> target;
+    size_t num_rows = 0;
+    // The dimension of all the rows, or 0 if it varies between rows. The vectors of a non-constant argument are
+    // then stored back to back, and the i-th one starts at i * fixed_dim.
+    size_t fixed_dim = 0;
+
+    // Call |fn(row, base_vector, target_vector, dim)| for every row.
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        if (fixed_dim > 0) {
+            const auto* base_data = base.vector(0);
+            const auto* target_data = target.vector(0);
+            const size_t base_stride = base.is_constant ? 0 : fixed_dim;
+            const size_t target_stride = target.is_constant ? 0 : fixed_dim;
+            for (size_t i = 0; i < num_rows; i++) {
+                fn(i, base_data + i * base_stride, target_data + i * target_stride, fixed_dim);
+            }
+        } else {
+            for (size_t i = 0; i < num_rows; i++) {
+                fn(i, base.vector(i), target.vector(i), base.dim(i));
+            }
+        }
+    }
+};
 
-template <LogicalType TYPE, bool isNorm>
-StatusOr<ColumnPtr> MathFunctions::cosine_similarity(FunctionContext* context, const Columns& columns) {
+template <LogicalType TYPE>
+StatusOr<VectorPairs<TYPE>> to_vector_pairs(const char* name, const Columns& columns) {
     DCHECK_EQ(columns.size(), 2);
-
     const Column* base = columns[0].get();
     const Column* target = columns[1].get();
-    size_t target_size = target->size();
-    if (base->size() != target_size) {
-        return Status::InvalidArgument(fmt::format(
-                "cosine_similarity requires equal length arrays. base array size is {} and target array size is {}.",
-                base->size(), target->size()));
-    }
-    if (base->has_null() || target->has_null()) {
+    if (base->size() != target->size()) {
         return Status::InvalidArgument(
-                fmt::format("cosine_similarity does not support null values. {} array has null value.",
-                            base->has_null() ? "base" : "target"));
+                fmt::format("{} requires equal length arrays. base array size is {} and target array size is {}.",
+                            name, base->size(), target->size()));
     }
-    if (base->is_constant()) {
-        auto* const_column = down_cast<const ConstColumn*>(base);
-        const_column->data_column()->assign(base->size(), 0);
-        base = const_column->data_column().get();
-    }
-    if (target->is_constant()) {
-        auto* const_column = down_cast<const ConstColumn*>(target);
-        const_column->data_column()->assign(target->size(), 0);
-        target = const_column->data_column().get();
-    }
-
-    if (base->is_nullable()) {
-        base = down_cast<const NullableColumn*>(base)->data_column().get();
-    }
-    if (target->is_nullable()) {
-        target = down_cast<const NullableColumn*>(target)->data_column().get();
+    if (base->has_null() || target->has_null()) {
+        return Status::InvalidArgument(fmt::format("{} does not support null values. {} array has null value.", name,
+                                                   base->has_null() ? "base" : "target"));
+    }
+
+    VectorPairs<TYPE> pairs;
+    ASSIGN_OR_RETURN(pairs.base, to_vector_argument<TYPE>(name, base));
+    ASSIGN_OR_RETURN(pairs.target, to_vector_argument<TYPE>(name, target));
+    pairs.num_rows = target->size();
+    pairs.fixed_dim = pairs.num_rows > 0 ? pairs.base.dim(0) : 0;
+    for (size_t i = 0; i < pairs.num_rows; i++) {
+        size_t b_dim_size = pairs.base.dim(i);
+        size_t t_dim_size = pairs.target.dim(i);
+        if (t_dim_size != b_dim_size) {
+            return Status::InvalidArgument(
+                    fmt::format("{} requires equal length arrays in each row. base array dimension size "
+                                "is {}, target array dimension size is {}.",
+                                name, b_dim_size, t_dim_size));
+        }
+        if (t_dim_size == 0) {
+            return Status::InvalidArgument(fmt::format("{} requires non-empty arrays in each row", name));
+        }
+        if (b_dim_size != pairs.fixed_dim) {
+            pairs.fixed_dim = 0;
+        }
     }
+    return pairs;
+}
 
-    // check dimension equality.
-    const Column* base_flat = down_cast<const ArrayColumn*>(base)->elements_column().get();
-    const uint32_t* base_offset = down_cast<const ArrayColumn*>(base)->offsets().get_data().data();
-    size_t base_flat_size = base_flat->size();
-
-    const Column* target_flat = down_cast<const ArrayColumn*>(target)->elements_column().get();
-    size_t target_flat_size = target_flat->size();
-    const uint32_t* target_offset = down_cast<const ArrayColumn*>(target)->offsets().get_data().data();
+// Compute |kernel(base_vector, target_vector, dim)| of every row into a column of TYPE.
+template <LogicalType TYPE, typename Kernel>
+StatusOr<ColumnPtr> vector_distance(const char* name, const Columns& columns, Kernel&& kernel) {
+    ASSIGN_OR_RETURN(auto pairs, to_vector_pairs<TYPE>(name, columns));
+    ColumnPtr result = ColumnHelper::create_column(TypeDescriptor{TYPE}, false, false, pairs.num_rows);
+    auto* result_data = down_cast<RunTimeColumnType<TYPE>*>(result.get())->get_data().data();
+    pairs.for_each([&](size_t i, const auto* base, const auto* target, size_t dim) {
+        result_data[i] = kernel(base, target, dim);
+    });
+    return result;
+}
 
-    if (base_flat_size != target_flat_size) {
-        return Status::InvalidArgument("cosine_similarity requires equal length arrays");
+// Compute |kernel(base_vector, target_vector, dim, result_vector)| of every row into an array column of TYPE.
+template <LogicalType TYPE, typename Kernel>
+StatusOr<ColumnPtr> vector_elementwise(const char* name, const Columns& columns, Kernel&& kernel) {
+    ASSIGN_OR_RETURN(auto pairs, to_vector_pairs<TYPE>(name, columns));
+    auto offsets = UInt32Column::create();
+    auto& offsets_data = offsets->get_data();
+    offsets_data.resize(pairs.num_rows + 1);
+    offsets_data[0] = 0;
+    for (size_t i = 0; i < pairs.num_rows; i++) {
+        offsets_data[i + 1] = offsets_data[i] + pairs.base.dim(i);
     }
+    const size_t num_elements = offsets_data[pairs.num_rows];
+    auto elements = RunTimeColumnType<TYPE>::create(num_elements);
+    auto* elements_data = elements->get_data().data();
+    pairs.for_each([&](size_t i, const auto* base, const auto* target, size_t dim) {
+        kernel(base, target, dim, elements_data + offsets_data[i]);
+    });
+    return ArrayColumn::create(NullableColumn::create(std::move(elements), NullColumn::create(num_elements, 0)),
+                               std::move(offsets));
+}
 
-    if (base_flat->has_null() || target_flat->has_null()) {
-        return Status::InvalidArgument("cosine_similarity does not support null values");
-    }
-    if (base_flat->is_nullable()) {
-        base_flat = down_cast<const NullableColumn*>(base_flat)->data_column().get();
-    }
-    if (target_flat->is_nullable()) {
-        target_flat = down_cast<const NullableColumn*>(target_flat)->data_column().get();
-    }
+} // namespace
 
-    using CppType = RunTimeCppType<TYPE>;
-    using ColumnType = RunTimeColumnType<TYPE>;
+template <LogicalType TYPE, bool isNorm>
+StatusOr<ColumnPtr> MathFunctions::cosine_similarity(FunctionContext* context, const Columns& columns) {
+    static_assert(TYPE == TYPE_FLOAT, "vector functions only support float");
+    if constexpr (isNorm) {
+        return vector_distance<TYPE>("cosine_similarity", columns, SIMD::dot_product);
+    } else {
+        return vector_distance<TYPE>("cosine_similarity", columns, [](const float* a, const float* b, size_t dim) {
+            float dot, a_norm, b_norm;
+            SIMD::dot_product_and_norms(a, b, dim, &dot, &a_norm, &b_norm);
+            return dot / (std::sqrt(a_norm) * std::sqrt(b_norm));
+        });
+    }
+}
 
-    const CppType* base_data_head = down_cast<const ColumnType*>(base_flat)->get_data().data();
-    const CppType* target_data_head = down_cast<const ColumnType*>(target_flat)->get_data().data();
+template <LogicalType TYPE>
+StatusOr<ColumnPtr> MathFunctions::l2_distance(FunctionContext* context, const Columns& columns) {
+    static_assert(TYPE == TYPE_FLOAT, "vector functions only support float");
+    return vector_distance<TYPE>("l2_distance", columns, [](const float* a, const float* b, size_t dim) {
+        return std::sqrt(SIMD::l2_distance_squared(a, b, dim));
+    });
+}
 
-    // prepare result with nullable value.
-    ColumnPtr result = ColumnHelper::create_column(TypeDescriptor{TYPE}, false, false, target_size);
-    ColumnType* data_result = down_cast<ColumnType*>(result.get());
-    CppType* result_data = data_result->get_data().data();
+template <LogicalType TYPE>
+StatusOr<ColumnPtr> MathFunctions::inner_product(FunctionContext* context, const Columns& columns) {
+    static_assert(TYPE == TYPE_FLOAT, "vector functions only support float");
+    return vector_distance<TYPE>("inner_product", columns, SIMD::dot_product);
+}
 
-    for (size_t i = 0; i < target_size; i++) {
-        size_t t_dim_size = target_offset[i + 1] - target_offset[i];
-        size_t b_dim_size = base_offset[i + 1] - base_offset[i];
-        if (t_dim_size != b_dim_size) {
-            return Status::InvalidArgument(
-                    fmt::format("cosine_similarity requires equal length arrays in each row. base array dimension size "
-                                "is {}, target array dimension size is {}.",
-                                b_dim_size, t_dim_size));
-        }
-        if (t_dim_size == 0) {
-            return Status::InvalidArgument("cosine_similarity requires non-empty arrays in each row");
-        }
-    }
+template <LogicalType TYPE>
+StatusOr<ColumnPtr> MathFunctions::vector_add(FunctionContext* context, const Columns& columns) {
+    static_assert(TYPE == TYPE_FLOAT, "vector functions only support float");
+    return vector_elementwise<TYPE>("vector_add", columns, SIMD::add);
+}
 
-    const CppType* target_data = target_data_head;
-    const CppType* base_data = base_data_head;
-    for (size_t i = 0; i < target_size; i++) {
-        CppType sum = 0;
-        CppType base_sum = 0;
-        CppType target_sum = 0;
-        size_t dim_size = target_offset[i + 1] - target_offset[i];
-        CppType result_value = 0;
-        size_t j = 0;
-#ifdef __AVX2__
-        if (std::is_same_v<CppType, float>) {
-            __m256 sum_vec = _mm256_setzero_ps();
-            __m256 base_sum_vec = _mm256_setzero_ps();
-            __m256 target_sum_vec = _mm256_setzero_ps();
-            for (; j + 7 < dim_size; j += 8) {
-                __m256 base_data_vec = _mm256_loadu_ps(base_data + j);
-                __m256 target_data_vec = _mm256_loadu_ps(target_data + j);
-
-                __m256 mul_vec = _mm256_mul_ps(base_data_vec, target_data_vec);
-                sum_vec = _mm256_add_ps(sum_vec, mul_vec);
-
-                if constexpr (!isNorm) {
-                    __m256 base_mul_vec = _mm256_mul_ps(base_data_vec, base_data_vec);
-                    base_sum_vec = _mm256_add_ps(base_sum_vec, base_mul_vec);
-                    __m256 target_mul_vec = _mm256_mul_ps(target_data_vec, target_data_vec);
-                    target_sum_vec = _mm256_add_ps(target_sum_vec, target_mul_vec);
-                }
-            }
-            sum += sum_m256(sum_vec);
-            if constexpr (!isNorm) {
-                base_sum += sum_m256(base_sum_vec);
-                target_sum += sum_m256(target_sum_vec);
-            }
-        }
-#endif
-        for (; j < dim_size; j++) {
-            sum += base_data[j] * target_data[j];
-            if constexpr (!isNorm) {
-                base_sum += base_data[j] * base_data[j];
-                target_sum += target_data[j] * target_data[j];
-            }
-        }
+template <LogicalType TYPE>
+StatusOr<ColumnPtr> MathFunctions::vector_subtract(FunctionContext* context, const Columns& columns) {
+    static_assert(TYPE == TYPE_FLOAT, "vector functions only support float");
+    return vector_elementwise<TYPE>("vector_subtract", columns, SIMD::subtract);
+}
 
-        if constexpr (!isNorm) {
-            result_value = sum / (std::sqrt(base_sum) * std::sqrt(target_sum));
-        } else {
-            result_value = sum;
-        }
-        result_data[i] = result_value;
-        target_data += dim_size;
-        base_data += dim_size;
-    }
-    return result;
+template <LogicalType TYPE>
+StatusOr<ColumnPtr> MathFunctions::vector_multiply(FunctionContext* context, const Columns& columns) {
+    static_assert(TYPE == TYPE_FLOAT, "vector functions only support float");
+    return vector_elementwise<TYPE>("vector_multiply", columns, SIMD::multiply);
 }
 
 // explicitly instaniate template function.
@@ -894,5 +929,13 @@ template StatusOr<ColumnPtr> MathFunctions::cosine_similarity<TYPE_FLOAT, true>(
                                                                                 const Columns& columns);
 template StatusOr<ColumnPtr> MathFunctions::cosine_similarity<TYPE_FLOAT, false>(FunctionContext* context,
                                                                                  const Columns& columns);
+template StatusOr<ColumnPtr> MathFunctions::l2_distance<TYPE_FLOAT>(FunctionContext* context, const Columns& columns);
+template StatusOr<ColumnPtr> MathFunctions::inner_product<TYPE_FLOAT>(FunctionContext* context,
+                                                                      const Columns& columns);
+template StatusOr<ColumnPtr> MathFunctions::vector_add<TYPE_FLOAT>(FunctionContext* context, const Columns& columns);
+template StatusOr<ColumnPtr> MathFunctions::vector_subtract<TYPE_FLOAT>(FunctionContext* context,
+                                                                        const Columns& columns);
+template StatusOr<ColumnPtr> MathFunctions::vector_multiply<TYPE_FLOAT>(FunctionContext* context,
+                                                                        const Columns& columns);
 
 } // namespace starrocks
@@ -167,6 +167,34 @@ public:
     template <LogicalType TYPE, bool isNorm>
     DEFINE_VECTORIZED_FN(cosine_similarity);
 
+    /**
+     * Euclidean distance of two vectors of the same dimension.
+     * @param columns: [ArrayColumn, ArrayColumn]
+     * @return FloatColumn
+     */
+    template <LogicalType TYPE>
+    DEFINE_VECTORIZED_FN(l2_distance);
+
+    /**
+     * Dot product of two vectors of the same dimension.
+     * @param columns: [ArrayColumn, ArrayColumn]
+     * @return FloatColumn
+     */
+    template <LogicalType TYPE>
+    DEFINE_VECTORIZED_FN(inner_product);
+
+    /**
+     * Element-wise sum, difference and product of two vectors of the same dimension.
+     * @param columns: [ArrayColumn, ArrayColumn]
+     * @return ArrayColumn
+     */
+    template <LogicalType TYPE>
+    DEFINE_VECTORIZED_FN(vector_add);
+    template <LogicalType TYPE>
+    DEFINE_VECTORIZED_FN(vector_subtract);
+    template <LogicalType TYPE>
+    DEFINE_VECTORIZED_FN(vector_multiply);
+
     /**
     * @param columns: [DoubleColumn]
     * @return BigIntColumn
@@ -113,9 +113,15 @@ void SimdBlockFilter::merge(const SimdBlockFilter& bf) {
         return;
     }
     DCHECK(_log_num_buckets == bf._log_num_buckets);
-    for (int i = 0; i < (1 << _log_num_buckets); i++) {
+    if (num_buckets() > bf.num_buckets()) {
+        fold(bf.num_buckets());
+    }
+    // the buckets of bf with the same low bits go to the same bucket if bf is larger
+    const size_t src_num_buckets = bf.num_buckets();
+    for (size_t i = 0; i < src_num_buckets; i++) {
+        const size_t dst_idx = i & _directory_mask;
 #ifdef __AVX2__
-        auto* const dst = reinterpret_cast<__m256i*>(_directory[i]);
+        auto* const dst = reinterpret_cast<__m256i*>(_directory[dst_idx]);
         auto* const src = reinterpret_cast<__m256i*>(bf._directory[i]);
         const __m256i a = _mm256_load_si256(src);
         const __m256i b = _mm256_load_si256(dst);
@@ -123,12 +129,71 @@ void SimdBlockFilter::merge(const SimdBlockFilter& bf) {
         _mm256_store_si256(dst, c);
 #else
         for (int j = 0; j < BITS_SET_PER_BLOCK; j++) {
-            _directory[i][j] |= bf._directory[i][j];
+            _directory[dst_idx][j] |= bf._directory[i][j];
         }
 #endif
     }
 }
 
+double SimdBlockFilter::fill_ratio() const {
+    const size_t buckets = num_buckets();
+    if (_directory == nullptr || buckets == 0) {
+        return 0;
+    }
+    size_t num_set_bits = 0;
+    for (size_t i = 0; i < buckets; i++) {
+        for (int j = 0; j < BITS_SET_PER_BLOCK; j++) {
+            num_set_bits += __builtin_popcount(_directory[i][j]);
+        }
+    }
+    return static_cast<double>(num_set_bits) / (buckets * sizeof(Bucket) * 8);
+}
+
+void SimdBlockFilter::fold(size_t num_buckets) {
+    const size_t old_num_buckets = this->num_buckets();
+    DCHECK(num_buckets > 0 && (num_buckets & (num_buckets - 1)) == 0);
+    DCHECK_LE(num_buckets, old_num_buckets);
+    if (_directory == nullptr || num_buckets >= old_num_buckets) {
+        return;
+    }
+    Bucket* folded = nullptr;
+    const size_t alloc_size = num_buckets << LOG_BUCKET_BYTE_SIZE;
+    const int malloc_failed = posix_memalign(reinterpret_cast<void**>(&folded), 64, alloc_size);
+    if (malloc_failed) throw ::std::bad_alloc();
+    memcpy(folded, _directory, alloc_size);
+    const uint32_t folded_mask = num_buckets - 1;
+    for (size_t i = num_buckets; i < old_num_buckets; i++) {
+        for (int j = 0; j < BITS_SET_PER_BLOCK; j++) {
+            folded[i & folded_mask][j] |= _directory[i][j];
+        }
+    }
+    free(_directory);
+    _directory = folded;
+    _directory_mask = folded_mask;
+}
+
+int SimdBlockFilter::fold_to_fpp(double max_fpp) {
+    if (_directory == nullptr) {
+        return 0;
+    }
+    // Every hash sets one bit in each of the BITS_SET_PER_BLOCK words of its bucket,
+    // so fpp is about fill ^ BITS_SET_PER_BLOCK, and OR-ing two halves turns fill into 1 - (1 - fill) ^ 2.
+    double fill = fill_ratio();
+    size_t buckets = num_buckets();
+    int num_halvings = 0;
+    while (buckets > 1) {
+        const double folded_fill = 1 - (1 - fill) * (1 - fill);
+        if (std::pow(folded_fill, BITS_SET_PER_BLOCK) > max_fpp) {
+            break;
+        }
+        fill = folded_fill;
+        buckets >>= 1;
+        num_halvings++;
+    }
+    fold(buckets);
+    return num_halvings;
+}
+
 // For scalar version:
 void SimdBlockFilter::make_mask(uint32_t key, uint32_t* masks) const {
     for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
@@ -236,6 +301,16 @@ bool JoinRuntimeFilter::check_equal(const JoinRuntimeFilter& rf) const {
     return true;
 }
 
+void JoinRuntimeFilter::fold_bf(double max_fpp) {
+    if (_hash_partition_bf.empty()) {
+        _bf.fold_to_fpp(max_fpp);
+    } else {
+        for (auto& bf : _hash_partition_bf) {
+            bf.fold_to_fpp(max_fpp);
+        }
+    }
+}
+
 void JoinRuntimeFilter::clear_bf() {
     if (_hash_partition_bf.empty()) {
         _bf.clear();
@@ -170,10 +170,20 @@ public:
     size_t max_serialized_size() const;
     size_t serialize(uint8_t* data) const;
     size_t deserialize(const uint8_t* data);
+    // |bf| may have been folded into a different number of buckets, the larger one is folded to the smaller.
     void merge(const SimdBlockFilter& bf);
     bool check_equal(const SimdBlockFilter& bf) const;
     uint32_t directory_mask() const { return _directory_mask; }
 
+    // The ratio of the set bits in the directory.
+    double fill_ratio() const;
+    // Fold the directory into |num_buckets| buckets, which must be a power of two and not larger than now,
+    // by OR-ing every bucket into the bucket of the same low bits. The filter still answers for all inserted
+    // hashes, and the bits in a bucket are still chosen by `hash >> _log_num_buckets`.
+    void fold(size_t num_buckets);
+    // Fold as long as the estimated false positive rate stays under |max_fpp|, return the number of halvings.
+    int fold_to_fpp(double max_fpp);
+
     void clear();
     // whether this bloom filter can be used
     // if the bloom filter's size of partial rf has exceed the size limit of global rf,
@@ -224,14 +234,16 @@ private:
     // log2(number of bytes in a bucket):
     static constexpr int LOG_BUCKET_BYTE_SIZE = 5;
 
-    size_t get_alloc_size() const {
-        return _log_num_buckets == 0 ? 0 : (1ull << (_log_num_buckets + LOG_BUCKET_BYTE_SIZE));
-    }
+    size_t num_buckets() const { return _log_num_buckets == 0 ? 0 : static_cast<size_t>(_directory_mask) + 1; }
+
+    size_t get_alloc_size() const { return num_buckets() << LOG_BUCKET_BYTE_SIZE; }
 
     // Common:
-    // log_num_buckets_ is the log (base 2) of the number of buckets in the directory:
+    // log_num_buckets_ is the log (base 2) of the number of buckets in the directory when the filter is built,
+    // it's kept after folding since it decides the bits in a bucket of a hash.
     int _log_num_buckets = 0;
-    // directory_mask_ is (1 << log_num_buckets_) - 1
+    // directory_mask_ is (number of buckets in the directory) - 1, which is (1 << log_num_buckets_) - 1
+    // unless the filter has been folded.
     uint32_t _directory_mask = 0;
     Bucket* _directory = nullptr;
 };
@@ -348,6 +360,10 @@ public:
         _bf.merge(rf->_bf);
     }
 
+    // Fold the bloom filters as long as the estimated false positive rate stays under |max_fpp|,
+    // to reduce the size of a sparse filter before it's transmitted.
+    void fold_bf(double max_fpp);
+
     virtual void concat(JoinRuntimeFilter* rf) {
         _has_null |= rf->_has_null;
         if (rf->_hash_partition_bf.empty()) {
@@ -1913,12 +1913,73 @@ StatusOr<ColumnPtr> StringFunctions::length(FunctionContext* context, const Colu
     return VectorizedStrictUnaryFunction<lengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
 }
 
-DEFINE_UNARY_FN_WITH_IMPL(utf8LengthImpl, str) {
-    return utf8_len(str.data, str.data + str.size);
+// Returns a mask whose i-th bit is set if bytes[i] is the first byte of an utf8 char, i.e. it doesn't match
+// the 10xx_xxxx pattern, see utf8_len.
+static inline uint64_t utf8_char_start_mask64(const uint8_t* bytes, size_t n) {
+    uint64_t mask = 0;
+    size_t i = 0;
+#if defined(__SSE2__)
+    if (n == 64) {
+        const auto threshold = _mm_set1_epi8(0xBF);
+        for (; i < 64; i += 16) {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+            mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(v, threshold))))
+                    << i;
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        mask |= static_cast<uint64_t>(static_cast<int8_t>(bytes[i]) > static_cast<int8_t>(0xBF)) << i;
+    }
+    return mask;
 }
 
+// Computes the utf8 length of every row from one pass over the whole bytes buffer of the column instead of
+// scanning each row separately, short strings never reach the SIMD loop of utf8_len.
+struct Utf8LengthFunction {
+    template <LogicalType Type, LogicalType ResultType>
+    static inline ColumnPtr evaluate(const ColumnPtr& column) {
+        auto* src = down_cast<BinaryColumn*>(column.get());
+        const auto& src_bytes = src->get_bytes();
+        const auto& src_offsets = src->get_offset();
+        const size_t num_rows = src->size();
+
+        auto result = RunTimeColumnType<TYPE_INT>::create();
+        auto& lengths = result->get_data();
+        lengths.resize(num_rows);
+
+        if (validate_ascii_fast((const char*)src_bytes.data(), src_bytes.size())) {
+            for (size_t i = 0; i < num_rows; ++i) {
+                lengths[i] = src_offsets[i + 1] - src_offsets[i];
+            }
+            return result;
+        }
+
+        // masks[k] marks the utf8 char starts in bytes [64k, 64k + 64), and prefix[k] counts the
+        // char starts before byte 64k, so the number of chars before any position costs one popcount.
+        const size_t num_bytes = src_bytes.size();
+        const size_t num_blocks = num_bytes / 64 + 1;
+        raw::RawVector<uint64_t> masks(num_blocks);
+        raw::RawVector<uint32_t> prefix(num_blocks);
+        uint32_t count = 0;
+        for (size_t k = 0; k < num_blocks; ++k) {
+            masks[k] = utf8_char_start_mask64(src_bytes.data() + k * 64, std::min<size_t>(64, num_bytes - k * 64));
+            prefix[k] = count;
+            count += __builtin_popcountll(masks[k]);
+        }
+        auto chars_before = [&](size_t pos) -> uint32_t {
+            const size_t k = pos / 64;
+            return prefix[k] + __builtin_popcountll(masks[k] & ((uint64_t(1) << (pos % 64)) - 1));
+        };
+        for (size_t i = 0; i < num_rows; ++i) {
+            lengths[i] = chars_before(src_offsets[i + 1]) - chars_before(src_offsets[i]);
+        }
+        return result;
+    }
+};
+
 StatusOr<ColumnPtr> StringFunctions::utf8_length(FunctionContext* context, const starrocks::Columns& columns) {
-    return VectorizedStrictUnaryFunction<utf8LengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
+    return VectorizedUnaryFunction<Utf8LengthFunction>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
 }
 
 template <char CA, char CZ>
@@ -1942,7 +2003,7 @@ static inline void vectorized_toggle_case(const Bytes* src, Bytes* dst) {
     const auto z_plus1 = _mm_set1_epi8(CZ + 1);
     const auto flips = _mm_set1_epi8(32);
 
-    for (; src_ptr > sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
+    for (; src_ptr < sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
         auto bytes = _mm_loadu_si128((const __m128i*)src_ptr);
         // the i-th byte of masks is set to 0xff if the corresponding byte is
         // between a..z when computing upper function (A..Z when computing lower function),
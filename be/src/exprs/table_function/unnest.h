@@ -39,37 +39,42 @@ public:
         state->set_processed_rows(arg0->size());
         Columns result;
         if (arg0->has_null() || state->get_is_left_join()) {
-            auto offset_column = col_array->offsets_column();
+            const auto& offsets = col_array->offsets().get_data();
+            const auto& elements = col_array->elements_column();
+            const size_t num_rows = arg0->size();
             auto copy_count_column = UInt32Column::create();
-            copy_count_column->append(0);
+            auto& copy_counts = copy_count_column->get_data();
+            copy_counts.reserve(num_rows + 1);
+            copy_counts.push_back(0);
 
-            ColumnPtr unnested_array_elements = col_array->elements_column()->clone_empty();
+            ColumnPtr unnested_array_elements = elements->clone_empty();
+            unnested_array_elements->reserve(elements->size());
 
+            // Copy the elements of consecutive non-empty arrays by one append, a null is only appended for a null
+            // or empty array of left join.
             uint32_t offset = 0;
-            for (int row_idx = 0; row_idx < arg0->size(); ++row_idx) {
-                if (arg0->is_null(row_idx)) {
-                    if (state->get_is_left_join()) {
-                        // to support unnest with null.
-                        unnested_array_elements->append_nulls(1);
-                        offset += 1;
+            uint32_t pending_begin = offsets[0];
+            uint32_t pending_end = offsets[0];
+            for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+                const bool is_null = arg0->is_null(row_idx);
+                const uint32_t length = is_null ? 0 : offsets[row_idx + 1] - offsets[row_idx];
+                if (length > 0) {
+                    if (pending_end != offsets[row_idx]) {
+                        unnested_array_elements->append(*elements, pending_begin, pending_end - pending_begin);
+                        pending_begin = offsets[row_idx];
                     }
-                    copy_count_column->append(offset);
-                } else {
-                    if (offset_column->get(row_idx + 1).get_int32() == offset_column->get(row_idx).get_int32() &&
-                        state->get_is_left_join()) {
-                        // to support unnest with null.
-                        unnested_array_elements->append_nulls(1);
-                        offset += 1;
-                    } else {
-                        auto length =
-                                offset_column->get(row_idx + 1).get_int32() - offset_column->get(row_idx).get_int32();
-                        unnested_array_elements->append(*(col_array->elements_column()),
-                                                        offset_column->get(row_idx).get_int32(), length);
-                        offset += length;
-                    }
-                    copy_count_column->append(offset);
+                    pending_end = offsets[row_idx + 1];
+                    offset += length;
+                } else if (state->get_is_left_join()) {
+                    // to support unnest with null.
+                    unnested_array_elements->append(*elements, pending_begin, pending_end - pending_begin);
+                    pending_begin = pending_end;
+                    unnested_array_elements->append_nulls(1);
+                    offset += 1;
                 }
+                copy_counts.push_back(offset);
             }
+            unnested_array_elements->append(*elements, pending_begin, pending_end - pending_begin);
 
             result.emplace_back(unnested_array_elements);
             return std::make_pair(result, copy_count_column);
@@ -225,6 +225,8 @@ StatusOr<ColumnPtr> TimeFunctions::convert_tz_const(FunctionContext* context, co
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_DATETIME> result(size);
+    TimezoneOffsetCache from_cache(from);
+    TimezoneOffsetCache to_cache(to);
     for (int row = 0; row < size; ++row) {
         if (time_viewer.is_null(row)) {
             result.append_null();
@@ -232,26 +234,10 @@ StatusOr<ColumnPtr> TimeFunctions::convert_tz_const(FunctionContext* context, co
         }
 
         auto datetime_value = time_viewer.value(row);
-
-        int year, month, day, hour, minute, second, usec;
-        datetime_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue ts_value(TIME_DATETIME, year, month, day, hour, minute, second, usec);
-
-        int64_t timestamp;
-        // TODO find a better approach to replace datetime_value.unix_timestamp
-        if (!ts_value.unix_timestamp(&timestamp, from)) {
-            result.append_null();
-            continue;
-        }
-        DateTimeValue ts_value2;
-        // TODO find a better approach to replace datetime_value.from_unixtime
-        if (!ts_value2.from_unixtime(timestamp, ts_value.microsecond(), to)) {
-            result.append_null();
-            continue;
-        }
+        const int64_t usec = timestamp::to_time(datetime_value.timestamp()) % USECS_PER_SEC;
+        const int64_t utc = from_cache.local_to_utc(datetime_value.to_unix_second());
         TimestampValue ts;
-        ts.from_timestamp(ts_value2.year(), ts_value2.month(), ts_value2.day(), ts_value2.hour(), ts_value2.minute(),
-                          ts_value2.second(), ts_value2.microsecond());
+        ts.from_unix_second(to_cache.utc_to_local(utc), usec);
         result.append(ts);
     }
 
@@ -1345,26 +1331,17 @@ StatusOr<ColumnPtr> TimeFunctions::_t_to_unix_from_datetime(FunctionContext* con
 
     auto size = columns[0]->size();
     ColumnBuilder<TIMESTAMP_TYPE> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (date_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
 
-        auto date = date_viewer.value(row);
-
-        int year, month, day, hour, minute, second, usec;
-        date.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue tv(TIME_DATETIME, year, month, day, hour, minute, second, usec);
-
-        int64_t timestamp;
-        if (!tv.unix_timestamp(&timestamp, context->state()->timezone_obj())) {
-            result.append_null();
-        } else {
-            timestamp = timestamp < 0 ? 0 : timestamp;
-            timestamp = timestamp > MAX_UNIX_TIMESTAMP ? 0 : timestamp;
-            result.append(timestamp);
-        }
+        int64_t timestamp = tz_cache.local_to_utc(date_viewer.value(row).to_unix_second());
+        timestamp = timestamp < 0 ? 0 : timestamp;
+        timestamp = timestamp > MAX_UNIX_TIMESTAMP ? 0 : timestamp;
+        result.append(timestamp);
     }
 
     return result.build(ColumnHelper::is_all_const(columns));
@@ -1496,6 +1473,15 @@ StatusOr<ColumnPtr> TimeFunctions::to_unix_for_now_32(FunctionContext* context,
 /*
  * definition for from_unix operators
  */
+// Convert the unix |seconds| into the local time of the time zone cached by |tz_cache|.
+static DateTimeValue to_local_datetime_value(TimezoneOffsetCache& tz_cache, int64_t seconds) {
+    TimestampValue ts;
+    ts.from_unix_second(tz_cache.utc_to_local(seconds));
+    int year, month, day, hour, minute, second, usec;
+    ts.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
+    return DateTimeValue(TIME_DATETIME, year, month, day, hour, minute, second, 0);
+}
+
 template <LogicalType TIMESTAMP_TYPE>
 StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime(FunctionContext* context, const Columns& columns) {
     DCHECK_EQ(columns.size(), 1);
@@ -1506,6 +1492,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime(FunctionContext* con
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -1518,11 +1505,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime(FunctionContext* con
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = to_local_datetime_value(tz_cache, date);
         char buf[64];
         dtv.to_string(buf);
         result.append(Slice(buf));
@@ -1541,6 +1524,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime_ms(FunctionContext*
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -1553,11 +1537,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime_ms(FunctionContext*
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = to_local_datetime_value(tz_cache, date);
         char buf[64];
         dtv.to_string(buf);
         result.append(Slice(buf));
@@ -1648,6 +1628,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_general(FunctionCont
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row) || format_column.is_null(row)) {
             result.append_null();
@@ -1661,11 +1642,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_general(FunctionCont
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = to_local_datetime_value(tz_cache, date);
         // use lambda to avoid adding method for TimeFunctions.
         if (format.size > DEFAULT_DATE_FORMAT_LIMIT) {
             result.append_null();
@@ -1696,6 +1673,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_const(std::string& f
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row) || format_content.empty()) {
             result.append_null();
@@ -1708,11 +1686,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_const(std::string& f
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = to_local_datetime_value(tz_cache, date);
 
         char buf[128];
         if (!dtv.to_format_string((const char*)format_content.c_str(), format_content.size(), buf)) {
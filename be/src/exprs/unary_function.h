@@ -180,6 +180,12 @@ public:
             return v1;
         }
 
+        if (v1->is_nullable() && !v1->has_null()) {
+            // no null rows, evaluate on the data column directly and skip building and merging null columns
+            return FN::template evaluate<Type, ResultType, Args...>(down_cast<NullableColumn*>(v1.get())->data_column(),
+                                                                    std::forward<Args>(args)...);
+        }
+
         if (v1->is_nullable()) {
             auto col = ColumnHelper::as_raw_column<NullableColumn>(v1);
 
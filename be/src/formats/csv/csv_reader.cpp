@@ -15,6 +15,9 @@
 #include "formats/csv/csv_reader.h"
 
 #include <unordered_set>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 namespace starrocks {
 
@@ -36,6 +39,18 @@ static std::pair<const char*, size_t> trim(const char* value, size_t len) {
     return std::make_pair(value + begin, end - begin + 1);
 }
 
+#ifdef __SSE2__
+// Returns a bitmask of the bytes equal to |pattern| in the 64 bytes starting at |data|.
+static inline uint64_t match_mask64(const char* data, __m128i pattern) {
+    const auto* p = reinterpret_cast<const __m128i*>(data);
+    uint64_t m0 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(p), pattern)));
+    uint64_t m1 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(p + 1), pattern)));
+    uint64_t m2 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(p + 2), pattern)));
+    uint64_t m3 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(p + 3), pattern)));
+    return m0 | (m1 << 16) | (m2 << 32) | (m3 << 48);
+}
+#endif
+
 inline bool CSVReader::is_column_delimiter(bool expandBuffer) {
     if (LIKELY(_column_delimiter_length == 1)) {
         if (*(_buff.position()) == _parse_options.column_delimiter[0]) {
@@ -555,17 +570,37 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        const char delimiter = _parse_options.column_delimiter[0];
+        const char* end = record.data + size;
+        auto add_field = [&](const char* field_end) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, field_end - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, field_end - value);
             }
+            value = field_end + 1;
+        };
+#ifdef __SSE2__
+        // Locate the delimiters of 64 bytes at a time and walk the set bits of the mask, csv fields
+        // are usually short so this is much cheaper than comparing byte by byte or calling memchr
+        // once per field.
+        const __m128i pattern = _mm_set1_epi8(delimiter);
+        const char* end64 = record.data + size / 64 * 64;
+        for (; ptr < end64; ptr += 64) {
+            uint64_t mask = match_mask64(ptr, pattern);
+            while (mask != 0) {
+                add_field(ptr + __builtin_ctzll(mask));
+                mask &= mask - 1;
+            }
+        }
+#endif
+        const char* d;
+        while (ptr < end && (d = static_cast<const char*>(memchr(ptr, delimiter, end - ptr))) != nullptr) {
+            add_field(d);
+            ptr = d + 1;
         }
+        ptr = end;
     } else {
         const auto* const base = ptr;
 
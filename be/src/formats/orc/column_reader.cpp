@@ -492,6 +492,44 @@ inline void Decimal32Or64Or128ColumnReader<DecimalType>::_fill_decimal_column_ge
     }
 }
 
+// The not-null values of a direct encoded StringVectorBatch are decompressed back to back into its blob,
+// so they are copied into the column by one memcpy instead of value by value. Returns false without
+// appending anything if the values are not continuous, e.g. dictionary encoded or filtered.
+template <typename BinaryColumnType>
+static bool append_continuous_strings_from_cvb(orc::StringVectorBatch* data, size_t from, size_t size,
+                                               BinaryColumnType* column) {
+    if (size == 0 || data->use_codes) {
+        return false;
+    }
+    const char* const* values = data->data.data();
+    const int64_t* lengths = data->length.data();
+    const char* not_null = data->hasNulls ? data->notNull.data() : nullptr;
+
+    auto& vo = column->get_offset();
+    size_t offset_start = vo.size();
+    auto base = vo[offset_start - 1];
+    raw::stl_vector_resize_uninitialized(&vo, offset_start + size);
+
+    const char* begin = values[from];
+    const char* end = begin;
+    for (size_t i = 0, cvb_pos = from; i < size; ++i, ++cvb_pos) {
+        size_t length = (not_null == nullptr || not_null[cvb_pos]) ? lengths[cvb_pos] : 0;
+        if (UNLIKELY(length > 0 && values[cvb_pos] != end)) {
+            vo.resize(offset_start);
+            return false;
+        }
+        end += length;
+        vo[offset_start + i] = base + (end - begin);
+    }
+
+    auto& vb = column->get_bytes();
+    size_t write_pos = vb.size();
+    // vb is using RawVectorPad16, resize will not initialize vector
+    vb.resize(write_pos + (end - begin));
+    strings::memcpy_inlined(vb.data() + write_pos, begin, end - begin);
+    return true;
+}
+
 Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) {
     auto* data = down_cast<orc::StringVectorBatch*>(cvb);
 
@@ -509,64 +547,67 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
 
     auto* values = ColumnHelper::cast_to_raw<TYPE_VARCHAR>(ColumnHelper::get_data_column(col.get()));
 
-    auto& vb = values->get_bytes();
-    // Need to resize after insert, because of padding char existed
-    vb.reserve(vb.size() + len);
-
-    auto& vo = values->get_offset();
-    // We can resize directly
-    raw::stl_vector_resize_uninitialized(&vo, vo.size() + size);
-
-    size_t write_pos = vb.size();
-    if (cvb->hasNulls) {
-        if (_type.type == TYPE_CHAR) {
-            // Possibly there are some zero padding characters in value, we have to strip them off.
-            for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
-                if (cvb->notNull[cvb_pos]) {
+    // Possibly there are some zero padding characters in CHAR value, we have to strip them off one by one.
+    if (_type.type == TYPE_CHAR || !append_continuous_strings_from_cvb(data, from, size, values)) {
+        auto& vb = values->get_bytes();
+        // Need to resize after insert, because of padding char existed
+        vb.reserve(vb.size() + len);
+
+        auto& vo = values->get_offset();
+        // We can resize directly
+        raw::stl_vector_resize_uninitialized(&vo, vo.size() + size);
+
+        size_t write_pos = vb.size();
+        if (cvb->hasNulls) {
+            if (_type.type == TYPE_CHAR) {
+                // Possibly there are some zero padding characters in value, we have to strip them off.
+                for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
+                    if (cvb->notNull[cvb_pos]) {
+                        size_t str_size = remove_trailing_spaces(data->data[cvb_pos], data->length[cvb_pos]);
+                        strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], str_size);
+                        write_pos += str_size;
+                        // Need plus 1 for offset
+                        vo[i + 1] = write_pos;
+                    } else {
+                        // Need plus 1 for offset
+                        vo[i + 1] = write_pos;
+                    }
+                }
+            } else {
+                for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
+                    if (cvb->notNull[cvb_pos]) {
+                        strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], data->length[cvb_pos]);
+                        write_pos += data->length[cvb_pos];
+                        // Need plus 1 for offset
+                        vo[i + 1] = write_pos;
+                    } else {
+                        // Need plus 1 for offset
+                        vo[i + 1] = write_pos;
+                    }
+                }
+            }
+        } else {
+            if (_type.type == TYPE_CHAR) {
+                // Possibly there are some zero padding characters in value, we have to strip them off.
+                for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
                     size_t str_size = remove_trailing_spaces(data->data[cvb_pos], data->length[cvb_pos]);
                     strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], str_size);
                     write_pos += str_size;
                     // Need plus 1 for offset
                     vo[i + 1] = write_pos;
-                } else {
-                    // Need plus 1 for offset
-                    vo[i + 1] = write_pos;
                 }
-            }
-        } else {
-            for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
-                if (cvb->notNull[cvb_pos]) {
+            } else {
+                for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
                     strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], data->length[cvb_pos]);
                     write_pos += data->length[cvb_pos];
                     // Need plus 1 for offset
                     vo[i + 1] = write_pos;
-                } else {
-                    // Need plus 1 for offset
-                    vo[i + 1] = write_pos;
                 }
             }
         }
-    } else {
-        if (_type.type == TYPE_CHAR) {
-            // Possibly there are some zero padding characters in value, we have to strip them off.
-            for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
-                size_t str_size = remove_trailing_spaces(data->data[cvb_pos], data->length[cvb_pos]);
-                strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], str_size);
-                write_pos += str_size;
-                // Need plus 1 for offset
-                vo[i + 1] = write_pos;
-            }
-        } else {
-            for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
-                strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], data->length[cvb_pos]);
-                write_pos += data->length[cvb_pos];
-                // Need plus 1 for offset
-                vo[i + 1] = write_pos;
-            }
-        }
-    }
 
-    vb.resize(write_pos);
+        vb.resize(write_pos);
+    }
 
     // col_start == 0 and from == 0 means it's at top level of fill chunk, not in the middle of array
     // otherwise `broker_load_filter` does not work.
@@ -645,6 +686,10 @@ Status VarbinaryColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& c
     }
 
     auto* values = ColumnHelper::cast_to_raw<TYPE_VARBINARY>(ColumnHelper::get_data_column(col.get()));
+    if (append_continuous_strings_from_cvb(data, from, size, values)) {
+        return Status::OK();
+    }
+
     auto& vb = values->get_bytes();
     auto& vo = values->get_offset();
 
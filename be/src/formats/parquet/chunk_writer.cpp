@@ -14,36 +14,104 @@
 
 #include "formats/parquet/chunk_writer.h"
 
+#include <fmt/format.h>
 #include <parquet/arrow/writer.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include "column/array_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/map_column.h"
 #include "column/struct_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "formats/parquet/column_chunk_writer.h"
 #include "formats/parquet/level_builder.h"
+#include "runtime/current_thread.h"
 #include "util/defer_op.h"
 
 namespace starrocks::parquet {
 
+static int num_leaf_columns(const ::parquet::schema::NodePtr& node) {
+    if (node->is_primitive()) {
+        return 1;
+    }
+    const auto* group = static_cast<const ::parquet::schema::GroupNode*>(node.get());
+    int num_leaves = 0;
+    for (int i = 0; i < group->field_count(); i++) {
+        num_leaves += num_leaf_columns(group->field(i));
+    }
+    return num_leaves;
+}
+
+struct ChunkWriter::ParallelWriteState {
+    explicit ParallelWriteState(Columns columns) : columns(std::move(columns)) {}
+
+    const Columns columns;
+    std::atomic<size_t> next_field = 0;
+
+    std::mutex mu;
+    std::condition_variable cv;
+    size_t num_finished_fields = 0;
+    size_t num_running_tasks = 0;
+    // Set once all the fields are written and no task is running, the tasks scheduled later do nothing.
+    bool done = false;
+    Status status;
+};
+
 ChunkWriter::ChunkWriter(::parquet::RowGroupWriter* rg_writer, const std::vector<TypeDescriptor>& type_descs,
                          const std::shared_ptr<::parquet::schema::GroupNode>& schema,
-                         const std::function<StatusOr<ColumnPtr>(Chunk*, size_t)>& eval_func)
-        : _rg_writer(rg_writer), _type_descs(type_descs), _schema(schema), _eval_func(eval_func) {
+                         const std::function<StatusOr<ColumnPtr>(Chunk*, size_t)>& eval_func,
+                         PriorityThreadPool* executors, RuntimeState* runtime_state)
+        : _rg_writer(rg_writer),
+          _type_descs(type_descs),
+          _schema(schema),
+          _eval_func(eval_func),
+          _executors(executors),
+          _runtime_state(runtime_state) {
     int num_columns = rg_writer->num_columns();
     _estimated_buffered_bytes.resize(num_columns);
     std::fill(_estimated_buffered_bytes.begin(), _estimated_buffered_bytes.end(), 0);
+
+    int leaf_column_idx = 0;
+    _leaf_column_offsets.reserve(_type_descs.size());
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        _leaf_column_offsets.push_back(leaf_column_idx);
+        leaf_column_idx += num_leaf_columns(_schema->field(i));
+    }
+    DCHECK_EQ(leaf_column_idx, num_columns);
 }
 
 Status ChunkWriter::write(Chunk* chunk) {
-    LevelBuilderContext ctx(chunk->num_rows());
+    // The output columns are evaluated by the sink driver, only the encoding is parallel.
+    Columns columns;
+    columns.reserve(_type_descs.size());
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
+        columns.emplace_back(std::move(col));
+    }
 
-    // Writes out all leaf parquet columns to the RowGroupWriter. Each leaf column is written fully before
-    // the next column is written. Columns are written in DFS order.
-    int leaf_column_idx = 0;
+    const size_t parallelism =
+            std::min<size_t>(std::max(config::parquet_writer_encode_parallelism, 1), columns.size());
+    if (_executors != nullptr && parallelism > 1) {
+        return _write_fields_in_parallel(std::move(columns), chunk->num_rows(), parallelism);
+    }
+    for (size_t i = 0; i < columns.size(); i++) {
+        RETURN_IF_ERROR(_write_field(i, columns[i], chunk->num_rows()));
+    }
+    return Status::OK();
+}
+
+Status ChunkWriter::_write_field(size_t field, const ColumnPtr& column, size_t num_rows) {
+    LevelBuilderContext ctx(num_rows);
+
+    // Writes out all leaf parquet columns of this field to the RowGroupWriter. Each leaf column is written fully
+    // before the next column is written. Columns are written in DFS order.
+    int leaf_column_idx = _leaf_column_offsets[field];
 
     auto write_leaf_column = [&](const LevelBuilderResult& result) {
         auto leaf_column_writer = ColumnChunkWriter(_rg_writer->column(leaf_column_idx));
@@ -52,13 +120,66 @@ Status ChunkWriter::write(Chunk* chunk) {
         ++leaf_column_idx;
     };
 
-    for (size_t i = 0; i < _type_descs.size(); i++) {
-        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
-        auto level_builder = LevelBuilder(_type_descs[i], _schema->field(i));
-        RETURN_IF_ERROR(level_builder.write(ctx, col, write_leaf_column));
+    auto level_builder = LevelBuilder(_type_descs[field], _schema->field(field));
+    return level_builder.write(ctx, column, write_leaf_column);
+}
+
+// The sink driver and at most |parallelism - 1| executor tasks take the fields one by one. The driver only waits
+// for the running tasks rather than the submitted ones, a task scheduled after all the fields are written does
+// nothing, so the driver is never blocked by busy executors.
+Status ChunkWriter::_write_fields_in_parallel(Columns columns, size_t num_rows, size_t parallelism) {
+    auto state = std::make_shared<ParallelWriteState>(std::move(columns));
+    const size_t num_fields = state->columns.size();
+
+    auto run = [this, state, num_rows, num_fields] {
+        size_t field;
+        while ((field = state->next_field.fetch_add(1)) < num_fields) {
+            Status status;
+            try {
+                status = _write_field(field, state->columns[field], num_rows);
+            } catch (const ::parquet::ParquetException& e) {
+                status = Status::IOError(fmt::format("{}: {}", "write column error", e.what()));
+            }
+            std::lock_guard lock(state->mu);
+            state->status.update(status);
+            if (++state->num_finished_fields == num_fields) {
+                state->cv.notify_one();
+            }
+        }
+    };
+
+    for (size_t i = 1; i < parallelism; i++) {
+        auto task = [run, state, runtime_state = _runtime_state] {
+            {
+                std::lock_guard lock(state->mu);
+                if (state->done) {
+                    return;
+                }
+                ++state->num_running_tasks;
+            }
+            {
+#ifndef BE_TEST
+                SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(runtime_state->instance_mem_tracker());
+                CurrentThread::current().set_query_id(runtime_state->query_id());
+                CurrentThread::current().set_fragment_instance_id(runtime_state->fragment_instance_id());
+#endif
+                run();
+            }
+            std::lock_guard lock(state->mu);
+            if (--state->num_running_tasks == 0) {
+                state->cv.notify_one();
+            }
+        };
+        if (!_executors->try_offer(task)) {
+            break;
+        }
     }
+    run();
 
-    return Status::OK();
+    std::unique_lock lock(state->mu);
+    state->cv.wait(lock, [&]() { return state->num_finished_fields == num_fields && state->num_running_tasks == 0; });
+    state->done = true;
+    return state->status;
 }
 
 void ChunkWriter::close() {
@@ -39,11 +39,15 @@ namespace starrocks::parquet {
 
 // Wraps parquet::RowGroupWriter.
 // Write chunks into buffer. Flush on closing.
+//
+// The leaf columns of a buffered row group are encoded into their own buffers, so the top-level columns of a
+// chunk are encoded in parallel by |executors| if given, see config::parquet_writer_encode_parallelism.
 class ChunkWriter {
 public:
     ChunkWriter(::parquet::RowGroupWriter* rg_writer, const std::vector<TypeDescriptor>& type_descs,
                 const std::shared_ptr<::parquet::schema::GroupNode>& schema,
-                const std::function<StatusOr<ColumnPtr>(Chunk*, size_t)>& eval_func);
+                const std::function<StatusOr<ColumnPtr>(Chunk*, size_t)>& eval_func,
+                PriorityThreadPool* executors = nullptr, RuntimeState* runtime_state = nullptr);
 
     Status write(Chunk* chunk);
 
@@ -52,11 +56,21 @@ public:
     int64_t estimated_buffered_bytes() const;
 
 private:
+    struct ParallelWriteState;
+
+    // Write the top-level column |field| into the leaf columns starting from _leaf_column_offsets[field].
+    Status _write_field(size_t field, const ColumnPtr& column, size_t num_rows);
+    Status _write_fields_in_parallel(Columns columns, size_t num_rows, size_t parallelism);
+
     ::parquet::RowGroupWriter* _rg_writer;
     std::vector<TypeDescriptor> _type_descs;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
     std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> _eval_func;
     std::vector<int64_t> _estimated_buffered_bytes;
+    // The index of the first leaf column of each top-level column.
+    std::vector<int> _leaf_column_offsets;
+    PriorityThreadPool* _executors = nullptr;
+    RuntimeState* _runtime_state = nullptr;
 };
 
 } // namespace starrocks::parquet
@@ -23,6 +23,7 @@
 #include "exec/hdfs_scanner.h"
 #include "exprs/expr.h"
 #include "formats/parquet/column_converter.h"
+#include "formats/parquet/metadata.h"
 #include "formats/parquet/stored_column_reader.h"
 #include "formats/parquet/stored_column_reader_with_index.h"
 #include "formats/parquet/utils.h"
@@ -212,19 +213,32 @@ public:
             _offset_index_ctx->rg_first_row = rg_first_row;
             int64_t offset_index_offset = _chunk_metadata->offset_index_offset;
             uint32_t offset_index_length = _chunk_metadata->offset_index_length;
-            std::vector<uint8_t> offset_index_data;
-            offset_index_data.reserve(offset_index_length);
-            RETURN_IF_ERROR(
-                    _opts.file->read_at_fully(offset_index_offset, offset_index_data.data(), offset_index_length));
-
-            RETURN_IF_ERROR(deserialize_thrift_msg(offset_index_data.data(), &offset_index_length,
-                                                   TProtocolType::COMPACT, &_offset_index_ctx->offset_index));
+            auto loader = [&](tparquet::OffsetIndex* offset_index) {
+                std::vector<uint8_t> offset_index_data(offset_index_length);
+                RETURN_IF_ERROR(_opts.file->read_at_fully(offset_index_offset, offset_index_data.data(),
+                                                          offset_index_length));
+                return deserialize_thrift_msg(offset_index_data.data(), &offset_index_length, TProtocolType::COMPACT,
+                                              offset_index);
+            };
+            if (_opts.file_meta_data != nullptr) {
+                ASSIGN_OR_RETURN(auto offset_index,
+                                 _opts.file_meta_data->get_offset_index(offset_index_offset, loader));
+                _offset_index_ctx->offset_index = *offset_index;
+            } else {
+                RETURN_IF_ERROR(loader(&_offset_index_ctx->offset_index));
+            }
         }
         return &_offset_index_ctx->offset_index;
     }
 
     void select_offset_index(const SparseRange<uint64_t>& range, const uint64_t rg_first_row) override;
 
+    void set_skip_unselected_pages() override {
+        if (_offset_index_selected && _field->max_rep_level() == 0) {
+            down_cast<StoredColumnReaderWithIndex*>(_reader.get())->set_skip_unselected_pages(_opts.stats);
+        }
+    }
+
 private:
     // Returns true if all of the data pages in the column chunk are dict encoded
     bool _column_all_pages_dict_encoded();
@@ -238,6 +252,8 @@ private:
     const TypeDescriptor* _col_type = nullptr;
     const tparquet::ColumnChunk* _chunk_metadata = nullptr;
     std::unique_ptr<ColumnOffsetIndexCtx> _offset_index_ctx;
+    // |_reader| is wrapped by StoredColumnReaderWithIndex
+    bool _offset_index_selected = false;
 };
 
 bool ScalarColumnReader::_column_all_pages_dict_encoded() {
@@ -386,6 +402,7 @@ void ScalarColumnReader::select_offset_index(const SparseRange<uint64_t>& range,
     // be compatible with PARQUET-1850
     has_dict_page |= _offset_index_ctx->check_dictionary_page(column_metadata.data_page_offset);
     _reader = std::make_unique<StoredColumnReaderWithIndex>(std::move(_reader), _offset_index_ctx.get(), has_dict_page);
+    _offset_index_selected = true;
 }
 
 Status ColumnDictFilterContext::rewrite_conjunct_ctxs_to_predicate(StoredColumnReader* reader,
@@ -29,6 +29,8 @@ struct HdfsScanStats;
 
 namespace starrocks::parquet {
 
+class FileMetaData;
+
 struct ColumnReaderOptions {
     std::string timezone;
     bool case_sensitive = false;
@@ -37,6 +39,8 @@ struct ColumnReaderOptions {
     RandomAccessFile* file = nullptr;
     const tparquet::RowGroup* row_group_meta = nullptr;
     uint64_t first_row_index = 0;
+    // shares the page indexes between the readers of the file
+    FileMetaData* file_meta_data = nullptr;
 };
 
 class StoredColumnReader;
@@ -129,6 +133,10 @@ public:
 
     virtual void select_offset_index(const SparseRange<uint64_t>& range, const uint64_t rg_first_row) = 0;
 
+    // Skip the pages without any row selected by the filter of read_range(), if the page locations are known
+    // by select_offset_index(). Only for the non-nested columns, whose filtered rows don't need to be read.
+    virtual void set_skip_unselected_pages() {}
+
     std::unique_ptr<ColumnConverter> converter;
 };
 
@@ -16,6 +16,7 @@
 
 #include <memory>
 
+#include "formats/parquet/encoding_delta.h"
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/types.h"
@@ -68,6 +69,42 @@ struct TypeEncodingTraits<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encodi
     }
 };
 
+template <tparquet::Type::type type>
+struct TypeEncodingTraits<type, tparquet::Encoding::DELTA_BINARY_PACKED> {
+    static Status create_decoder(std::unique_ptr<Decoder>* decoder) {
+        *decoder = std::make_unique<DeltaBinaryPackedDecoder<typename PhysicalTypeTraits<type>::CppType>>();
+        return Status::OK();
+    }
+    static Status create_encoder(std::unique_ptr<Encoder>* encoder) {
+        *encoder = std::make_unique<DeltaBinaryPackedEncoder<typename PhysicalTypeTraits<type>::CppType>>();
+        return Status::OK();
+    }
+};
+
+template <tparquet::Type::type type>
+struct TypeEncodingTraits<type, tparquet::Encoding::DELTA_LENGTH_BYTE_ARRAY> {
+    static Status create_decoder(std::unique_ptr<Decoder>* decoder) {
+        *decoder = std::make_unique<DeltaLengthByteArrayDecoder>();
+        return Status::OK();
+    }
+    static Status create_encoder(std::unique_ptr<Encoder>* encoder) {
+        *encoder = std::make_unique<DeltaLengthByteArrayEncoder>();
+        return Status::OK();
+    }
+};
+
+template <tparquet::Type::type type>
+struct TypeEncodingTraits<type, tparquet::Encoding::DELTA_BYTE_ARRAY> {
+    static Status create_decoder(std::unique_ptr<Decoder>* decoder) {
+        *decoder = std::make_unique<DeltaByteArrayDecoder>();
+        return Status::OK();
+    }
+    static Status create_encoder(std::unique_ptr<Encoder>* encoder) {
+        *encoder = std::make_unique<DeltaByteArrayEncoder>();
+        return Status::OK();
+    }
+};
+
 template <tparquet::Type::type type_arg, tparquet::Encoding::type encoding_arg>
 struct EncodingTraits : TypeEncodingTraits<type_arg, encoding_arg> {
     static constexpr tparquet::Type::type type = type_arg;
@@ -104,10 +141,12 @@ EncodingInfoResolver::EncodingInfoResolver() {
     // INT32
     _add_map<tparquet::Type::INT32, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::INT32, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::INT32, tparquet::Encoding::DELTA_BINARY_PACKED>();
 
     // INT64
     _add_map<tparquet::Type::INT64, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::INT64, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::INT64, tparquet::Encoding::DELTA_BINARY_PACKED>();
 
     // INT96
     _add_map<tparquet::Type::INT96, tparquet::Encoding::PLAIN>();
@@ -124,10 +163,13 @@ EncodingInfoResolver::EncodingInfoResolver() {
     // BYTE_ARRAY encoding
     _add_map<tparquet::Type::BYTE_ARRAY, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::BYTE_ARRAY, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::BYTE_ARRAY, tparquet::Encoding::DELTA_LENGTH_BYTE_ARRAY>();
+    _add_map<tparquet::Type::BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY>();
 
     // FIXED_LEN_BYTE_ARRAY encoding
     _add_map<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY>();
 }
 
 EncodingInfoResolver::~EncodingInfoResolver() {
@@ -0,0 +1,466 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "column/column.h"
+#include "common/status.h"
+#include "formats/parquet/encoding.h"
+#include "gutil/strings/substitute.h"
+#include "util/bit_stream_utils.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+
+// DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encodings, which are written by
+// the parquet v2 writers like Spark 3 and Iceberg.
+// more details refer to: https://github.com/apache/parquet-format/blob/master/Encodings.md
+namespace starrocks::parquet {
+
+template <typename T>
+class DeltaBinaryPackedEncoder final : public Encoder {
+public:
+    DeltaBinaryPackedEncoder() = default;
+    ~DeltaBinaryPackedEncoder() override = default;
+
+    Status append(const uint8_t* vals, size_t count) override {
+        const T* values = reinterpret_cast<const T*>(vals);
+        _values.insert(_values.end(), values, values + count);
+        return Status::OK();
+    }
+
+    Slice build() override {
+        _buffer.clear();
+        put_varint32(&_buffer, kBlockSize);
+        put_varint32(&_buffer, kMiniBlocksPerBlock);
+        put_varint32(&_buffer, static_cast<uint32_t>(_values.size()));
+        put_varint64(&_buffer, _zigzag(_values.empty() ? 0 : _values[0]));
+
+        UT deltas[kBlockSize];
+        for (size_t begin = 1; begin < _values.size(); begin += kBlockSize) {
+            size_t num_deltas = std::min(_values.size() - begin, static_cast<size_t>(kBlockSize));
+            T min_delta = std::numeric_limits<T>::max();
+            for (size_t i = 0; i < num_deltas; i++) {
+                deltas[i] = static_cast<UT>(_values[begin + i]) - static_cast<UT>(_values[begin + i - 1]);
+                min_delta = std::min(min_delta, static_cast<T>(deltas[i]));
+            }
+            // the unused values of the last miniblock are padded by zero
+            for (size_t i = 0; i < num_deltas; i++) {
+                deltas[i] -= static_cast<UT>(min_delta);
+            }
+            std::fill(deltas + num_deltas, deltas + kBlockSize, 0);
+            put_varint64(&_buffer, _zigzag(min_delta));
+
+            size_t num_mini_blocks = (num_deltas + kValuesPerMiniBlock - 1) / kValuesPerMiniBlock;
+            uint8_t bit_widths[kMiniBlocksPerBlock] = {0};
+            for (size_t i = 0; i < num_mini_blocks; i++) {
+                UT max_delta = *std::max_element(deltas + i * kValuesPerMiniBlock,
+                                                 deltas + (i + 1) * kValuesPerMiniBlock);
+                bit_widths[i] = max_delta == 0 ? 0 : BitUtil::Log2Floor64(max_delta) + 1;
+            }
+            _buffer.append(bit_widths, kMiniBlocksPerBlock);
+
+            for (size_t i = 0; i < num_mini_blocks; i++) {
+                if (bit_widths[i] == 0) {
+                    continue;
+                }
+                faststring packed;
+                BitWriter writer(&packed);
+                for (size_t j = i * kValuesPerMiniBlock; j < (i + 1) * kValuesPerMiniBlock; j++) {
+                    writer.PutValue(deltas[j], bit_widths[i]);
+                }
+                writer.Flush();
+                _buffer.append(packed.data(), packed.size());
+            }
+        }
+        return {_buffer.data(), _buffer.size()};
+    }
+
+private:
+    using UT = std::make_unsigned_t<T>;
+    static constexpr uint32_t kBlockSize = 128;
+    static constexpr uint32_t kMiniBlocksPerBlock = 4;
+    static constexpr uint32_t kValuesPerMiniBlock = kBlockSize / kMiniBlocksPerBlock;
+
+    static uint64_t _zigzag(int64_t value) { return (static_cast<uint64_t>(value) << 1) ^ (value >> 63); }
+
+    std::vector<T> _values;
+    faststring _buffer;
+};
+
+template <typename T>
+class DeltaBinaryPackedDecoder final : public Decoder {
+public:
+    DeltaBinaryPackedDecoder() = default;
+    ~DeltaBinaryPackedDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        _bit_reader.reset(reinterpret_cast<const uint8_t*>(data.data), data.size);
+
+        uint32_t block_size = 0;
+        uint32_t total_values = 0;
+        uint64_t first_value = 0;
+        if (!_bit_reader.get_lleb_128(&block_size) || !_bit_reader.get_lleb_128(&_mini_blocks_per_block) ||
+            !_bit_reader.get_lleb_128(&total_values) || !_bit_reader.get_lleb_128(&first_value)) {
+            return Status::Corruption("DeltaBinaryPackedDecoder failed to read header");
+        }
+        if (block_size == 0 || block_size % 128 != 0 || _mini_blocks_per_block == 0 ||
+            block_size % _mini_blocks_per_block != 0 || (block_size / _mini_blocks_per_block) % 32 != 0) {
+            return Status::Corruption(strings::Substitute(
+                    "DeltaBinaryPackedDecoder invalid header, block_size=$0, mini_blocks_per_block=$1", block_size,
+                    _mini_blocks_per_block));
+        }
+        _values_per_mini_block = block_size / _mini_blocks_per_block;
+        _total_values = total_values;
+        _values_remaining = total_values;
+        _last_value = static_cast<UT>(_unzigzag(first_value));
+        _first_value_pending = total_values > 0;
+        _bit_widths.resize(_mini_blocks_per_block);
+        _deltas.resize(_values_per_mini_block);
+        _mini_block_idx = _mini_blocks_per_block;
+        _delta_pos = _values_per_mini_block;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        _values.resize(count);
+        RETURN_IF_ERROR(_decode(count, _values.data()));
+        auto n = dst->append_numbers(_values.data(), count * sizeof(T));
+        CHECK_EQ(count, n);
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        _values.resize(values_to_skip);
+        return _decode(values_to_skip, _values.data());
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override { return _decode(count, reinterpret_cast<T*>(dst)); }
+
+    size_t total_values() const { return _total_values; }
+
+    // The position right after the decoded values, only valid after all the values are decoded.
+    const uint8_t* data_end() const { return _bit_reader.buffer_pos(); }
+
+private:
+    using UT = std::make_unsigned_t<T>;
+
+    static int64_t _unzigzag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    Status _decode(size_t count, T* dst) {
+        if (UNLIKELY(count > _values_remaining)) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, count=$0,remaining=$1", count, _values_remaining));
+        }
+        size_t decoded = 0;
+        if (_first_value_pending && count > 0) {
+            dst[decoded++] = static_cast<T>(_last_value);
+            _first_value_pending = false;
+            _values_remaining--;
+        }
+        while (decoded < count) {
+            if (_delta_pos == _values_per_mini_block) {
+                RETURN_IF_ERROR(_load_mini_block());
+            }
+            size_t n = std::min(count - decoded, static_cast<size_t>(_values_per_mini_block - _delta_pos));
+            // prefix sum is carried out on the unsigned type, which wraps around like the writer.
+            UT value = _last_value;
+            const UT* deltas = _deltas.data() + _delta_pos;
+            for (size_t i = 0; i < n; i++) {
+                value += _min_delta + deltas[i];
+                dst[decoded + i] = static_cast<T>(value);
+            }
+            _last_value = value;
+            _delta_pos += n;
+            _values_remaining -= n;
+            decoded += n;
+        }
+        return Status::OK();
+    }
+
+    Status _load_mini_block() {
+        if (_mini_block_idx == _mini_blocks_per_block) {
+            uint64_t min_delta = 0;
+            if (!_bit_reader.get_lleb_128(&min_delta)) {
+                return Status::Corruption("DeltaBinaryPackedDecoder failed to read min delta");
+            }
+            _min_delta = static_cast<UT>(_unzigzag(min_delta));
+            for (uint32_t i = 0; i < _mini_blocks_per_block; i++) {
+                if (!_bit_reader.get_bytes(1, &_bit_widths[i])) {
+                    return Status::Corruption("DeltaBinaryPackedDecoder failed to read bit widths");
+                }
+            }
+            _mini_block_idx = 0;
+        }
+        int bit_width = _bit_widths[_mini_block_idx++];
+        if (UNLIKELY(bit_width > sizeof(T) * 8)) {
+            return Status::Corruption(strings::Substitute("DeltaBinaryPackedDecoder invalid bit width $0", bit_width));
+        }
+        // the last mini block is supposed to be padded, but the truncated one is accepted as long as it
+        // contains all the remaining values.
+        int num_read = _bit_reader.unpack_batch(bit_width, _values_per_mini_block, _deltas.data());
+        if (UNLIKELY(num_read < std::min<size_t>(_values_per_mini_block, _values_remaining))) {
+            return Status::Corruption("DeltaBinaryPackedDecoder mini block is truncated");
+        }
+        _delta_pos = 0;
+        return Status::OK();
+    }
+
+    BatchedBitReader _bit_reader;
+    uint32_t _mini_blocks_per_block = 0;
+    uint32_t _values_per_mini_block = 0;
+    size_t _total_values = 0;
+    size_t _values_remaining = 0;
+    bool _first_value_pending = false;
+
+    UT _last_value = 0;
+    UT _min_delta = 0;
+    std::vector<uint8_t> _bit_widths;
+    uint32_t _mini_block_idx = 0;
+    std::vector<UT> _deltas;
+    uint32_t _delta_pos = 0;
+
+    std::vector<T> _values;
+};
+
+class DeltaLengthByteArrayEncoder final : public Encoder {
+public:
+    DeltaLengthByteArrayEncoder() = default;
+    ~DeltaLengthByteArrayEncoder() override = default;
+
+    Status append(const uint8_t* vals, size_t count) override {
+        const auto* slices = reinterpret_cast<const Slice*>(vals);
+        for (size_t i = 0; i < count; i++) {
+            auto length = static_cast<int32_t>(slices[i].size);
+            RETURN_IF_ERROR(_length_encoder.append(reinterpret_cast<const uint8_t*>(&length), 1));
+            _data.append(slices[i].data, slices[i].size);
+        }
+        return Status::OK();
+    }
+
+    Slice build() override {
+        Slice lengths = _length_encoder.build();
+        _buffer.clear();
+        _buffer.append(lengths.data, lengths.size);
+        _buffer.append(_data.data(), _data.size());
+        return {_buffer.data(), _buffer.size()};
+    }
+
+private:
+    DeltaBinaryPackedEncoder<int32_t> _length_encoder;
+    faststring _data;
+    faststring _buffer;
+};
+
+class DeltaLengthByteArrayDecoder final : public Decoder {
+public:
+    DeltaLengthByteArrayDecoder() = default;
+    ~DeltaLengthByteArrayDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        DeltaBinaryPackedDecoder<int32_t> length_decoder;
+        RETURN_IF_ERROR(length_decoder.set_data(data));
+        size_t num_values = length_decoder.total_values();
+        _lengths.resize(num_values);
+        RETURN_IF_ERROR(length_decoder.next_batch(num_values, reinterpret_cast<uint8_t*>(_lengths.data())));
+
+        const char* begin = reinterpret_cast<const char*>(length_decoder.data_end());
+        const char* end = data.data + data.size;
+        size_t total_length = 0;
+        for (int32_t length : _lengths) {
+            if (UNLIKELY(length < 0)) {
+                return Status::Corruption(strings::Substitute("DeltaLengthByteArrayDecoder invalid length $0", length));
+            }
+            total_length += length;
+        }
+        if (UNLIKELY(begin + total_length > end)) {
+            return Status::Corruption("DeltaLengthByteArrayDecoder data is truncated");
+        }
+        _data = Slice(begin, end - begin);
+        _offset = 0;
+        _index = 0;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        _slices.resize(count);
+        RETURN_IF_ERROR(next_batch(count, reinterpret_cast<uint8_t*>(_slices.data())));
+        // the values of a page are stored continuously
+        auto ret = dst->append_continuous_strings(_slices);
+        if (UNLIKELY(!ret)) {
+            return Status::InternalError("DeltaLengthByteArrayDecoder append strings to column failed");
+        }
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        if (UNLIKELY(_index + values_to_skip > _lengths.size())) {
+            return Status::InternalError(
+                    strings::Substitute("going to skip out-of-bounds data, index=$0,skip=$1,size=$2", _index,
+                                        values_to_skip, _lengths.size()));
+        }
+        for (size_t i = 0; i < values_to_skip; i++) {
+            _offset += _lengths[_index++];
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        if (UNLIKELY(_index + count > _lengths.size())) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, index=$0,count=$1,size=$2", _index, count, _lengths.size()));
+        }
+        auto* slices = reinterpret_cast<Slice*>(dst);
+        for (size_t i = 0; i < count; i++) {
+            int32_t length = _lengths[_index++];
+            slices[i] = Slice(_data.data + _offset, length);
+            _offset += length;
+        }
+        return Status::OK();
+    }
+
+private:
+    std::vector<int32_t> _lengths;
+    std::vector<Slice> _slices;
+    Slice _data;
+    size_t _offset = 0;
+    size_t _index = 0;
+};
+
+class DeltaByteArrayEncoder final : public Encoder {
+public:
+    DeltaByteArrayEncoder() = default;
+    ~DeltaByteArrayEncoder() override = default;
+
+    Status append(const uint8_t* vals, size_t count) override {
+        const auto* slices = reinterpret_cast<const Slice*>(vals);
+        for (size_t i = 0; i < count; i++) {
+            const Slice& value = slices[i];
+            size_t max_prefix = std::min(value.size, _last_value.size());
+            int32_t prefix = 0;
+            while (prefix < max_prefix && value.data[prefix] == _last_value[prefix]) {
+                prefix++;
+            }
+            RETURN_IF_ERROR(_prefix_encoder.append(reinterpret_cast<const uint8_t*>(&prefix), 1));
+            Slice suffix(value.data + prefix, value.size - prefix);
+            RETURN_IF_ERROR(_suffix_encoder.append(reinterpret_cast<const uint8_t*>(&suffix), 1));
+            _last_value.assign(value.data, value.size);
+        }
+        return Status::OK();
+    }
+
+    Slice build() override {
+        Slice prefixes = _prefix_encoder.build();
+        Slice suffixes = _suffix_encoder.build();
+        _buffer.clear();
+        _buffer.append(prefixes.data, prefixes.size);
+        _buffer.append(suffixes.data, suffixes.size);
+        return {_buffer.data(), _buffer.size()};
+    }
+
+private:
+    DeltaBinaryPackedEncoder<int32_t> _prefix_encoder;
+    DeltaLengthByteArrayEncoder _suffix_encoder;
+    std::string _last_value;
+    faststring _buffer;
+};
+
+// The values are rebuilt from the prefix of the previous value and their suffixes batch by batch,
+// the returned slices are valid until the next call.
+class DeltaByteArrayDecoder final : public Decoder {
+public:
+    DeltaByteArrayDecoder() = default;
+    ~DeltaByteArrayDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        DeltaBinaryPackedDecoder<int32_t> prefix_decoder;
+        RETURN_IF_ERROR(prefix_decoder.set_data(data));
+        size_t num_values = prefix_decoder.total_values();
+        _prefix_lengths.resize(num_values);
+        RETURN_IF_ERROR(prefix_decoder.next_batch(num_values, reinterpret_cast<uint8_t*>(_prefix_lengths.data())));
+
+        const char* suffix_begin = reinterpret_cast<const char*>(prefix_decoder.data_end());
+        RETURN_IF_ERROR(_suffix_decoder.set_data(Slice(suffix_begin, data.data + data.size - suffix_begin)));
+        _index = 0;
+        _last_value.clear();
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        _slices.resize(count);
+        RETURN_IF_ERROR(next_batch(count, reinterpret_cast<uint8_t*>(_slices.data())));
+        auto ret = dst->append_continuous_strings(_slices);
+        if (UNLIKELY(!ret)) {
+            return Status::InternalError("DeltaByteArrayDecoder append strings to column failed");
+        }
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        _slices.resize(values_to_skip);
+        return next_batch(values_to_skip, reinterpret_cast<uint8_t*>(_slices.data()));
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        if (UNLIKELY(_index + count > _prefix_lengths.size())) {
+            return Status::InternalError(
+                    strings::Substitute("going to read out-of-bounds data, index=$0,count=$1,size=$2", _index, count,
+                                        _prefix_lengths.size()));
+        }
+        if (count == 0) {
+            return Status::OK();
+        }
+        auto* slices = reinterpret_cast<Slice*>(dst);
+        RETURN_IF_ERROR(_suffix_decoder.next_batch(count, dst));
+
+        size_t total_length = 0;
+        for (size_t i = 0; i < count; i++) {
+            total_length += _prefix_lengths[_index + i] + slices[i].size;
+        }
+        _buffer.resize(total_length);
+        char* pos = _buffer.data();
+        Slice last_value(_last_value);
+        for (size_t i = 0; i < count; i++) {
+            int32_t prefix = _prefix_lengths[_index + i];
+            if (UNLIKELY(prefix < 0 || prefix > last_value.size)) {
+                return Status::Corruption(
+                        strings::Substitute("DeltaByteArrayDecoder invalid prefix length $0", prefix));
+            }
+            const Slice& suffix = slices[i];
+            memcpy(pos, last_value.data, prefix);
+            memcpy(pos + prefix, suffix.data, suffix.size);
+            slices[i] = Slice(pos, prefix + suffix.size);
+            last_value = slices[i];
+            pos += slices[i].size;
+        }
+        _last_value.assign(last_value.data, last_value.size);
+        _index += count;
+        return Status::OK();
+    }
+
+private:
+    std::vector<int32_t> _prefix_lengths;
+    DeltaLengthByteArrayDecoder _suffix_decoder;
+    std::vector<Slice> _slices;
+    std::vector<char> _buffer;
+    std::string _last_value;
+    size_t _index = 0;
+};
+
+} // namespace starrocks::parquet
@@ -90,7 +90,6 @@ public:
     // initialize dictionary
     Status set_dict(int chunk_size, size_t num_values, Decoder* decoder) override {
         _dict.resize(num_values);
-        _indexes.resize(chunk_size);
         RETURN_IF_ERROR(decoder->next_batch(num_values, (uint8_t*)&_dict[0]));
         return Status::OK();
     }
@@ -107,9 +106,10 @@ public:
     }
 
     Status skip(size_t values_to_skip) override {
-        //TODO(Smith) still heavy work load
-        _indexes.reserve(values_to_skip);
-        _rle_batch_reader.GetBatch(&_indexes[0], values_to_skip);
+        auto ret = _rle_batch_reader.SkipBatch(values_to_skip);
+        if (UNLIKELY(static_cast<size_t>(ret) != values_to_skip)) {
+            return Status::InternalError("DictDecoder skip failed");
+        }
         return Status::OK();
     }
 
@@ -140,7 +140,6 @@ private:
 
     RleBatchDecoder<uint32_t> _rle_batch_reader;
     std::vector<T> _dict;
-    std::vector<uint32_t> _indexes;
 };
 
 template <>
@@ -243,9 +242,10 @@ public:
     }
 
     Status skip(size_t values_to_skip) override {
-        //TODO(Smith) still heavy work load
-        _indexes.reserve(values_to_skip);
-        _rle_batch_reader.GetBatch(&_indexes[0], values_to_skip);
+        auto ret = _rle_batch_reader.SkipBatch(values_to_skip);
+        if (UNLIKELY(static_cast<size_t>(ret) != values_to_skip)) {
+            return Status::InternalError("DictDecoder skip failed");
+        }
         return Status::OK();
     }
 
@@ -291,7 +291,6 @@ private:
     RleBatchDecoder<uint32_t> _rle_batch_reader;
     std::vector<uint8_t> _dict_data;
     std::vector<Slice> _dict;
-    std::vector<uint32_t> _indexes;
     std::vector<Slice> _slices;
 
     size_t _max_value_length = 0;
@@ -14,6 +14,7 @@
 
 #include "formats/parquet/file_reader.h"
 
+#include "block_cache/datacache_utils.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "common/config.h"
@@ -88,26 +89,7 @@ FileReader::FileReader(int chunk_size, RandomAccessFile* file, size_t file_size,
 FileReader::~FileReader() {}
 
 std::string FileReader::_build_metacache_key() {
-    auto& filename = _file->filename();
-    std::string metacache_key;
-    metacache_key.resize(14);
-    char* data = metacache_key.data();
-    const std::string footer_suffix = "ft";
-    uint64_t hash_value = HashUtil::hash64(filename.data(), filename.size(), 0);
-    memcpy(data, &hash_value, sizeof(hash_value));
-    memcpy(data + 8, footer_suffix.data(), footer_suffix.length());
-    // The modification time is more appropriate to indicate the different file versions.
-    // While some data source, such as Hudi, have no modification time because their files
-    // cannot be overwritten. So, if the modification time is unsupported, we use file size instead.
-    // Also, to reduce memory usage, we only use the high four bytes to represent the second timestamp.
-    if (_file_mtime > 0) {
-        uint32_t mtime_s = (_file_mtime >> 9) & 0x00000000FFFFFFFF;
-        memcpy(data + 10, &mtime_s, sizeof(mtime_s));
-    } else {
-        uint32_t size = _file_size;
-        memcpy(data + 10, &size, sizeof(size));
-    }
-    return metacache_key;
+    return DataCacheUtils::calc_metacache_key(_file->filename(), _file_size, _file_mtime, "ft");
 }
 
 Status FileReader::init(HdfsScannerContext* ctx) {
@@ -687,23 +669,63 @@ Status FileReader::_prepare_cur_row_group() {
     // 2. collect io ranges of every row group reader.
     // 3. set io ranges to the stream.
     if (config::parquet_coalesce_read_enable && _sb_stream != nullptr) {
-        std::vector<io::SharedBufferedInputStream::IORange> ranges;
-        int64_t end_offset = 0;
-        r->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
-        int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
-        if (counter >= 0 || !config::io_coalesce_adaptive_lazy_active) {
-            _scanner_ctx->stats->group_active_lazy_coalesce_together += 1;
-        } else {
-            _scanner_ctx->stats->group_active_lazy_coalesce_seperately += 1;
+        // The io ranges have been set if this row group has been read ahead.
+        if (_cur_row_group_idx >= _num_row_groups_with_io_ranges) {
+            std::vector<io::SharedBufferedInputStream::IORange> ranges;
+            RETURN_IF_ERROR(_set_row_group_io_ranges(_cur_row_group_idx, &ranges));
         }
-        r->set_end_offset(end_offset);
-        RETURN_IF_ERROR(_sb_stream->set_io_ranges(ranges, counter >= 0));
         _group_reader_param.sb_stream = _sb_stream;
+        RETURN_IF_ERROR(_prefetch_next_row_group());
     }
 
     return Status::OK();
 }
 
+Status FileReader::_set_row_group_io_ranges(size_t idx, std::vector<io::SharedBufferedInputStream::IORange>* ranges) {
+    auto& r = _row_group_readers[idx];
+    int64_t end_offset = 0;
+    r->collect_io_ranges(ranges, &end_offset, ColumnIOType::PAGES);
+    int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
+    if (counter >= 0 || !config::io_coalesce_adaptive_lazy_active) {
+        _scanner_ctx->stats->group_active_lazy_coalesce_together += 1;
+    } else {
+        _scanner_ctx->stats->group_active_lazy_coalesce_seperately += 1;
+    }
+    r->set_end_offset(end_offset);
+    RETURN_IF_ERROR(_sb_stream->set_io_ranges(*ranges, counter >= 0));
+    _num_row_groups_with_io_ranges = idx + 1;
+    return Status::OK();
+}
+
+// The io ranges of the next row group are collected before its page index is applied, so the whole
+// column chunks of its active columns are read ahead, and its lazy columns are read on demand.
+Status FileReader::_prefetch_next_row_group() {
+    size_t next = _cur_row_group_idx + 1;
+    if (!config::parquet_prefetch_next_row_group_enable || next >= _row_group_size ||
+        next < _num_row_groups_with_io_ranges) {
+        return Status::OK();
+    }
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    int64_t end_offset = 0;
+    _row_group_readers[next]->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
+    int64_t active_bytes = 0;
+    for (const auto& range : ranges) {
+        active_bytes += range.is_active ? range.size : 0;
+    }
+    if (active_bytes == 0 || active_bytes > config::parquet_prefetch_max_bytes) {
+        return Status::OK();
+    }
+
+    ranges.clear();
+    RETURN_IF_ERROR(_set_row_group_io_ranges(next, &ranges));
+    for (const auto& range : ranges) {
+        if (range.is_active) {
+            RETURN_IF_ERROR(_sb_stream->prefetch(range.offset, range.size));
+        }
+    }
+    return Status::OK();
+}
+
 Status FileReader::get_next(ChunkPtr* chunk) {
     if (_is_file_filtered) {
         return Status::EndOfFile("");
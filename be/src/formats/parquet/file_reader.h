@@ -100,6 +100,12 @@ private:
 
     Status _prepare_cur_row_group();
 
+    // Collect the io ranges of the row group |idx| to |ranges|, and set them to the shared buffered stream.
+    Status _set_row_group_io_ranges(size_t idx, std::vector<io::SharedBufferedInputStream::IORange>* ranges);
+
+    // Read the active columns of the next row group ahead, while the current one is being decoded.
+    Status _prefetch_next_row_group();
+
     // decode min/max value from row group stats
     Status _decode_min_max_column(const ParquetField& field, const std::string& timezone, const TypeDescriptor& type,
                                   const tparquet::ColumnMetaData& column_meta,
@@ -117,6 +123,8 @@ private:
     std::vector<std::shared_ptr<GroupReader>> _row_group_readers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
+    // the row groups before it have set their io ranges to the shared buffered stream
+    size_t _num_row_groups_with_io_ranges = 0;
 
     size_t _total_row_count = 0;
     size_t _scan_row_count = 0;
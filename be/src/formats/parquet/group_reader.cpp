@@ -52,6 +52,7 @@ Status GroupReader::prepare() {
     RETURN_IF_ERROR(_rewrite_conjunct_ctxs_to_predicates(&_is_group_filtered));
     _init_read_chunk();
     _range = SparseRange<uint64_t>(_row_group_first_row, _row_group_first_row + _row_group_metadata->num_rows);
+    bool offset_index_selected = false;
     if (config::parquet_page_index_enable) {
         SCOPED_RAW_TIMER(&_param.stats->page_index_ns);
         _param.stats->rows_before_page_index += _row_group_metadata->num_rows;
@@ -60,15 +61,39 @@ Status GroupReader::prepare() {
         ASSIGN_OR_RETURN(bool flag, page_index_reader->generate_read_range(_range));
         if (flag && !_is_group_filtered) {
             page_index_reader->select_column_offset_index();
+            offset_index_selected = true;
         }
     }
 
     if (!_is_group_filtered) {
+        if (config::parquet_page_index_enable && config::parquet_lazy_column_page_skip_enable) {
+            _init_lazy_column_page_skip(offset_index_selected);
+        }
         _range_iter = _range.new_iterator();
     }
     return Status::OK();
 }
 
+// The lazy columns are read with the filter of the active columns, the pages of them located by the offset
+// index are skipped if the filter leaves no row in them, so neither their headers nor their values are read.
+void GroupReader::_init_lazy_column_page_skip(bool offset_index_selected) {
+    for (int col_idx : _lazy_column_indices) {
+        const auto& column = _param.read_cols[col_idx];
+        if (column.slot_type().is_complex_type()) {
+            continue;
+        }
+        auto& reader = _column_readers[column.slot_id()];
+        if (!offset_index_selected) {
+            const tparquet::ColumnChunk* chunk_meta = reader->get_chunk_metadata();
+            if (chunk_meta == nullptr || !chunk_meta->__isset.offset_index_offset) {
+                continue;
+            }
+            reader->select_offset_index(_range, _row_group_first_row);
+        }
+        reader->set_skip_unselected_pages();
+    }
+}
+
 Status GroupReader::get_next(ChunkPtr* chunk, size_t* row_count) {
     SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
     if (_is_group_filtered) {
@@ -246,6 +271,7 @@ Status GroupReader::_init_column_readers() {
     opts.file = _param.file;
     opts.row_group_meta = _row_group_metadata;
     opts.first_row_index = _row_group_first_row;
+    opts.file_meta_data = _param.file_metadata;
     for (const auto& column : _param.read_cols) {
         RETURN_IF_ERROR(_create_column_reader(column));
     }
@@ -120,6 +120,7 @@ public:
                                  std::vector<std::string>& sub_field_path, bool is_decode_needed);
 
     void _init_read_chunk();
+    void _init_lazy_column_page_skip(bool offset_index_selected);
 
     Status _read_range(const std::vector<int>& read_columns, const Range<uint64_t>& range, const Filter* filter,
                        ChunkPtr* chunk);
@@ -33,6 +33,34 @@ Status FileMetaData::init(tparquet::FileMetaData& t_metadata, bool case_sensitiv
     return Status::OK();
 }
 
+template <typename T>
+StatusOr<std::shared_ptr<const T>> FileMetaData::_get_page_index(
+        std::unordered_map<int64_t, std::shared_ptr<const T>>* indexes, int64_t offset,
+        const std::function<Status(T*)>& loader) {
+    {
+        std::lock_guard l(_page_index_lock);
+        auto iter = indexes->find(offset);
+        if (iter != indexes->end()) {
+            return iter->second;
+        }
+    }
+    // Load it out of the lock, the concurrent readers may load the same index, and the first one is kept.
+    auto index = std::make_shared<T>();
+    RETURN_IF_ERROR(loader(index.get()));
+    std::lock_guard l(_page_index_lock);
+    return indexes->emplace(offset, std::move(index)).first->second;
+}
+
+StatusOr<std::shared_ptr<const tparquet::ColumnIndex>> FileMetaData::get_column_index(int64_t offset,
+                                                                                    const ColumnIndexLoader& loader) {
+    return _get_page_index(&_column_indexes, offset, loader);
+}
+
+StatusOr<std::shared_ptr<const tparquet::OffsetIndex>> FileMetaData::get_offset_index(int64_t offset,
+                                                                                    const OffsetIndexLoader& loader) {
+    return _get_page_index(&_offset_indexes, offset, loader);
+}
+
 std::string FileMetaData::debug_string() const {
     std::stringstream ss;
     ss << "schema=" << _schema.debug_string();
@@ -14,7 +14,13 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include "common/status.h"
+#include "common/statusor.h"
 #include "formats/parquet/schema.h"
 #include "gen_cpp/parquet_types.h"
 
@@ -87,11 +93,29 @@ public:
 
     const ApplicationVersion& writer_version() const { return _writer_version; }
 
+    // Return the column index or the offset index at |offset| of the file. They are parsed by |loader| on the
+    // first access, and shared by all the readers of this file metadata, which stays in the metacache with
+    // the footer, so the queries on the same file don't read and parse them again.
+    using ColumnIndexLoader = std::function<Status(tparquet::ColumnIndex*)>;
+    using OffsetIndexLoader = std::function<Status(tparquet::OffsetIndex*)>;
+    StatusOr<std::shared_ptr<const tparquet::ColumnIndex>> get_column_index(int64_t offset,
+                                                                            const ColumnIndexLoader& loader);
+    StatusOr<std::shared_ptr<const tparquet::OffsetIndex>> get_offset_index(int64_t offset,
+                                                                            const OffsetIndexLoader& loader);
+
 private:
+    template <typename T>
+    StatusOr<std::shared_ptr<const T>> _get_page_index(std::unordered_map<int64_t, std::shared_ptr<const T>>* indexes,
+                                                       int64_t offset, const std::function<Status(T*)>& loader);
+
     tparquet::FileMetaData _t_metadata;
     uint64_t _num_rows{0};
     SchemaDescriptor _schema;
     ApplicationVersion _writer_version;
+
+    std::mutex _page_index_lock;
+    std::unordered_map<int64_t, std::shared_ptr<const tparquet::ColumnIndex>> _column_indexes;
+    std::unordered_map<int64_t, std::shared_ptr<const tparquet::OffsetIndex>> _offset_indexes;
 };
 
 SortOrder sort_order_of_logical_type(LogicalType type);
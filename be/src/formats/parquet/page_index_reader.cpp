@@ -18,6 +18,7 @@
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
 #include "formats/parquet/encoding_plain.h"
+#include "formats/parquet/metadata.h"
 #include "fs/fs.h"
 #include "gen_cpp/parquet_types.h"
 #include "simd/simd.h"
@@ -81,13 +82,15 @@ StatusOr<bool> PageIndexReader::generate_read_range(SparseRange<uint64_t>& spars
         int64_t column_index_offset = chunk_meta->column_index_offset;
         uint32_t column_index_length = chunk_meta->column_index_length;
 
-        std::vector<uint8_t> page_index_data;
-        page_index_data.reserve(column_index_length);
-        RETURN_IF_ERROR(_file->read_at_fully(column_index_offset, page_index_data.data(), column_index_length));
-
-        tparquet::ColumnIndex column_index;
-        RETURN_IF_ERROR(deserialize_thrift_msg(page_index_data.data(), &column_index_length, TProtocolType::COMPACT,
-                                               &column_index));
+        auto loader = [&](tparquet::ColumnIndex* column_index) {
+            std::vector<uint8_t> page_index_data(column_index_length);
+            RETURN_IF_ERROR(_file->read_at_fully(column_index_offset, page_index_data.data(), column_index_length));
+            return deserialize_thrift_msg(page_index_data.data(), &column_index_length, TProtocolType::COMPACT,
+                                          column_index);
+        };
+        ASSIGN_OR_RETURN(auto column_index_ptr,
+                         _group_reader->_param.file_metadata->get_column_index(column_index_offset, loader));
+        const tparquet::ColumnIndex& column_index = *column_index_ptr;
         auto min_chunk = std::make_unique<Chunk>();
         ColumnPtr min_column = ColumnHelper::create_column(column.slot_type(), true);
         min_chunk->append_column(min_column, slotId);
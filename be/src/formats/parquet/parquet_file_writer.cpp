@@ -43,7 +43,7 @@ namespace starrocks::formats {
 std::future<Status> ParquetFileWriter::write(ChunkPtr chunk) {
     if (_rowgroup_writer == nullptr) {
         _rowgroup_writer = std::make_unique<parquet::ChunkWriter>(_writer->AppendBufferedRowGroup(), _type_descs,
-                                                                  _schema, _eval_func);
+                                                                  _schema, _eval_func, _executors, _runtime_state);
     }
     if (auto status = _rowgroup_writer->write(chunk.get()); !status.ok()) {
         return make_ready_future(std::move(status));
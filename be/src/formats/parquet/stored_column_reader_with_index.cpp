@@ -14,12 +14,62 @@
 
 #include "formats/parquet/stored_column_reader_with_index.h"
 
+#include "column/column.h"
+#include "exec/hdfs_scanner.h"
+#include "simd/simd.h"
 #include "util/defer_op.h"
 
 namespace starrocks::parquet {
 
 Status StoredColumnReaderWithIndex::read_range(const Range<uint64_t>& range, const Filter* filter,
                                                ColumnContentType content_type, Column* dst) {
+    if (filter == nullptr || _skip_unselected_pages_stats == nullptr) {
+        return _read_pages(range, filter, content_type, dst);
+    }
+    // Split |range| into the runs of the pages with and without any selected row, the runs with selected
+    // rows are read with their part of |filter|.
+    uint64_t run_begin = range.begin();
+    bool run_selected = false;
+    size_t run_pages = 0;
+    auto finish_run = [&](uint64_t run_end) -> Status {
+        Range<uint64_t> run(run_begin, run_end);
+        if (run_selected) {
+            if (run.begin() == range.begin() && run.end() == range.end()) {
+                return _read_pages(run, filter, content_type, dst);
+            }
+            auto offset = run.begin() - range.begin();
+            Filter run_filter(filter->begin() + offset, filter->begin() + offset + run.span_size());
+            return _read_pages(run, &run_filter, content_type, dst);
+        }
+        dst->append_default(run.span_size());
+        _skip_unselected_pages_stats->page_skip += run_pages;
+        return Status::OK();
+    };
+
+    size_t page_idx = _cur_page_idx;
+    for (uint64_t begin = range.begin(); begin < range.end();) {
+        while (page_idx < _page_num - 1 && begin >= _page_first_row(page_idx + 1)) {
+            page_idx++;
+        }
+        uint64_t end = range.end();
+        if (page_idx < _page_num - 1) {
+            end = std::min(end, _page_first_row(page_idx + 1));
+        }
+        bool selected = SIMD::contain_nonzero(*filter, begin - range.begin(), end - begin);
+        if (begin != range.begin() && selected != run_selected) {
+            RETURN_IF_ERROR(finish_run(begin));
+            run_begin = begin;
+            run_pages = 0;
+        }
+        run_selected = selected;
+        run_pages++;
+        begin = end;
+    }
+    return finish_run(range.end());
+}
+
+Status StoredColumnReaderWithIndex::_read_pages(const Range<uint64_t>& range, const Filter* filter,
+                                                ColumnContentType content_type, Column* dst) {
     DCHECK(range.begin() >= _offset_index_ctx->offset_index.page_locations[_cur_page_idx].first_row_index +
                                     _offset_index_ctx->rg_first_row);
     size_t stop_page_idx = _cur_page_idx;
@@ -38,6 +38,11 @@ public:
     Status read_range(const Range<uint64_t>& range, const Filter* filter, ColumnContentType content_type,
                       Column* dst) override;
 
+    // Skip the pages without any row selected by the filter of read_range(), instead of reading the page
+    // headers and the values of them. Default values are appended for their rows, which are supposed to be
+    // filtered out by the caller, so it only works for the columns without repetition levels.
+    void set_skip_unselected_pages(HdfsScanStats* stats) { _skip_unselected_pages_stats = stats; }
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
         _inner_reader->get_levels(def_levels, rep_levels, num_levels);
     }
@@ -50,12 +55,21 @@ public:
     }
 
 private:
+    Status _read_pages(const Range<uint64_t>& range, const Filter* filter, ColumnContentType content_type,
+                       Column* dst);
+
+    uint64_t _page_first_row(size_t page_idx) const {
+        return _offset_index_ctx->offset_index.page_locations[page_idx].first_row_index +
+               _offset_index_ctx->rg_first_row;
+    }
+
     std::unique_ptr<StoredColumnReader> _inner_reader;
     ColumnOffsetIndexCtx* _offset_index_ctx;
     size_t _cur_page_idx = 0;
     size_t _page_num = 0;
     bool _dict_page_loaded = false;
     bool _has_dict_page;
+    HdfsScanStats* _skip_unselected_pages_stats = nullptr;
 };
 
 } // namespace starrocks::parquet
@@ -32,12 +32,14 @@
 #include "gutil/strings/util.h"
 #include "io/input_stream.h"
 #include "io/output_stream.h"
+#include "io/remote_io_trace.h"
 #include "io/seekable_input_stream.h"
 #include "io/throttled_output_stream.h"
 #include "io/throttled_seekable_input_stream.h"
 #include "service/staros_worker.h"
 #include "storage/olap_common.h"
 #include "util/string_parser.hpp"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -142,7 +144,10 @@ public:
         if (!stream_st.ok()) {
             return to_status(stream_st.status());
         }
+        int64_t start_ns = MonotonicNanos();
         auto res = (*stream_st)->read(data, count);
+        io::RemoteIOTrace::record(io::RemoteIOTrace::STARLET, res.ok() ? *res : 0, MonotonicNanos() - start_ns, 0,
+                                  !res.ok());
         if (res.ok()) {
             g_starlet_io_num_reads << 1;
             g_starlet_io_read << *res;
@@ -61,6 +61,21 @@ static Status create_hdfs_fs_handle(const std::string& namenode, const std::shar
     }
     hdfsBuilderSetForceNewInstance(hdfs_builder);
 
+    // Set for hdfs client short-circuit local read and DataNode connection reuse, the cloud properties below
+    // take precedence over them.
+    if (config::hdfs_client_enable_short_circuit_read && !config::hdfs_client_domain_socket_path.empty()) {
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.read.shortcircuit", "true");
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.domain.socket.path", config::hdfs_client_domain_socket_path.data());
+    }
+    std::string socket_cache_capacity = std::to_string(config::hdfs_client_socket_cache_capacity);
+    std::string socket_cache_expiry_ms = std::to_string(config::hdfs_client_socket_cache_expiry_ms);
+    if (config::hdfs_client_socket_cache_capacity >= 0) {
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.socketcache.capacity", socket_cache_capacity.data());
+    }
+    if (config::hdfs_client_socket_cache_expiry_ms >= 0) {
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.socketcache.expiryMsec", socket_cache_expiry_ms.data());
+    }
+
     // Insert cloud properties(key-value paired) into Hadoop configuration
     // TODO(SmithCruise): Should remove when using cpp sdk
     const std::map<std::string, std::string> cloud_properties = get_cloud_properties(options);
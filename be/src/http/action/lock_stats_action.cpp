@@ -0,0 +1,77 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "http/action/lock_stats_action.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <string>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/instrumented_mutex.h"
+
+namespace starrocks {
+
+const static std::string HEADER_JSON = "application/json";
+const static size_t DEFAULT_TOP_LOCK_SITES = 20;
+
+void LockStatsAction::handle(HttpRequest* req) {
+    if (req->method() != HttpMethod::GET) {
+        HttpChannel::send_reply(req, HttpStatus::METHOD_NOT_ALLOWED, "Method Not Allowed");
+        return;
+    }
+    int64_t top = DEFAULT_TOP_LOCK_SITES;
+    const auto& top_str = req->param("top");
+    if (!top_str.empty()) {
+        try {
+            top = std::stoll(top_str);
+        } catch (const std::exception& e) {
+            top = -1;
+        }
+        if (top <= 0) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "Invalid param top: " + top_str);
+            return;
+        }
+    }
+
+    rapidjson::Document root;
+    root.SetObject();
+    auto& allocator = root.GetAllocator();
+    rapidjson::Value sites(rapidjson::kArrayType);
+    for (const auto& snapshot : LockStats::instance()->top_contended(top)) {
+        rapidjson::Value site(rapidjson::kObjectType);
+        site.AddMember("name", rapidjson::Value(snapshot.name.c_str(), snapshot.name.size(), allocator), allocator);
+        site.AddMember("contentions", rapidjson::Value(snapshot.contentions), allocator);
+        site.AddMember("shared_contentions", rapidjson::Value(snapshot.shared_contentions), allocator);
+        site.AddMember("total_wait_ns", rapidjson::Value(snapshot.total_wait_ns), allocator);
+        site.AddMember("max_wait_ns", rapidjson::Value(snapshot.max_wait_ns), allocator);
+        site.AddMember("p50_wait_ns", rapidjson::Value(snapshot.wait_ns_percentile(0.5)), allocator);
+        site.AddMember("p99_wait_ns", rapidjson::Value(snapshot.wait_ns_percentile(0.99)), allocator);
+        sites.PushBack(site, allocator);
+    }
+    root.AddMember("lock_sites", sites, allocator);
+
+    rapidjson::StringBuffer strbuf;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+    root.Accept(writer);
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, strbuf.GetString());
+}
+
+} // namespace starrocks
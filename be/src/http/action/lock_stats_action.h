@@ -0,0 +1,43 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+// The most contended lock sites recorded by InstrumentedMutex and InstrumentedSharedMutex.
+//   GET /api/lock_stats?top=20
+// Returns the sites ordered by the total wait time:
+// {
+//     "lock_sites": [{
+//         "name": "str",
+//         "contentions": "int",
+//         "shared_contentions": "int",
+//         "total_wait_ns": "int",
+//         "max_wait_ns": "int",
+//         "p50_wait_ns": "int",
+//         "p99_wait_ns": "int"
+//     }]
+// }
+class LockStatsAction : public HttpHandler {
+public:
+    LockStatsAction() = default;
+    ~LockStatsAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace starrocks
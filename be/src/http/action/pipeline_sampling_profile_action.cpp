@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "http/action/pipeline_sampling_profile_action.h"
+
+#include <string>
+#include <unordered_map>
+
+#include "common/config.h"
+#include "exec/pipeline/driver_sampling_profiler.h"
+#include "exec/workgroup/work_group.h"
+#include "gutil/strings/substitute.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+void PipelineSamplingProfileAction::handle(HttpRequest* req) {
+    if (req->method() != HttpMethod::GET) {
+        HttpChannel::send_reply(req, HttpStatus::METHOD_NOT_ALLOWED, "Method Not Allowed");
+        return;
+    }
+    if (config::pipeline_sampling_profiler_frequency <= 0) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "Sampling is disabled, set pipeline_sampling_profiler_frequency to enable it");
+        return;
+    }
+
+    int64_t seconds = 0;
+    const auto& seconds_str = req->param("seconds");
+    if (!seconds_str.empty()) {
+        try {
+            seconds = std::stoll(seconds_str);
+        } catch (const std::exception& e) {
+            seconds = -1;
+        }
+        if (seconds <= 0) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "Invalid param seconds: " + seconds_str);
+            return;
+        }
+    }
+    using GroupBy = pipeline::DriverSamplingProfiler::GroupBy;
+    GroupBy group_by = GroupBy::DRIVER;
+    const auto& group_by_str = req->param("group_by");
+    if (group_by_str == "workgroup") {
+        group_by = GroupBy::WORKGROUP;
+    } else if (!group_by_str.empty() && group_by_str != "driver") {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "Invalid param group_by: " + group_by_str);
+        return;
+    }
+
+    std::unordered_map<int64_t, std::string> workgroup_names;
+    workgroup::WorkGroupManager::instance()->for_each_workgroup(
+            [&workgroup_names](const workgroup::WorkGroup& wg) { workgroup_names[wg.id()] = wg.name(); });
+
+    const int64_t since_ns = seconds > 0 ? MonotonicNanos() - seconds * NANOS_PER_SEC : 0;
+    auto* profiler = pipeline::DriverSamplingProfiler::instance();
+    auto stacks = pipeline::DriverSamplingProfiler::fold(profiler->collect_samples(since_ns), group_by,
+                                                         workgroup_names);
+
+    std::string result;
+    for (const auto& [stack, count] : stacks) {
+        result.append(strings::Substitute("$0 $1\n", stack, count));
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain");
+    HttpChannel::send_reply(req, HttpStatus::OK, result);
+}
+
+} // namespace starrocks
@@ -0,0 +1,33 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+// Folded stacks of the pipeline driver samples, which can be rendered by flamegraph.pl directly.
+//   GET /api/pipeline_sampling_profile?seconds=10&group_by=workgroup
+// - seconds: only aggregate the samples of the last seconds, all the retained samples by default.
+// - group_by: "driver"(default) for workgroup;query;driver;operator stacks, "workgroup" for workgroup;operator stacks.
+class PipelineSamplingProfileAction : public HttpHandler {
+public:
+    PipelineSamplingProfileAction() = default;
+    ~PipelineSamplingProfileAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace starrocks
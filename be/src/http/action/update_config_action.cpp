@@ -89,6 +89,10 @@ Status UpdateConfigAction::update_config(const std::string& name, const std::str
             cache_limit = GlobalEnv::GetInstance()->check_storage_page_cache_size(cache_limit);
             StoragePageCache::instance()->set_capacity(cache_limit);
         });
+        _config_callback.emplace("storage_page_cache_compressed_limit", [&]() {
+            int64_t cache_limit = GlobalEnv::GetInstance()->get_storage_page_cache_compressed_size();
+            StoragePageCache::instance()->set_compressed_capacity(cache_limit);
+        });
         _config_callback.emplace("disable_storage_page_cache", [&]() {
             if (config::disable_storage_page_cache) {
                 StoragePageCache::instance()->set_capacity(0);
@@ -97,6 +101,8 @@ Status UpdateConfigAction::update_config(const std::string& name, const std::str
                 cache_limit = GlobalEnv::GetInstance()->check_storage_page_cache_size(cache_limit);
                 StoragePageCache::instance()->set_capacity(cache_limit);
             }
+            StoragePageCache::instance()->set_compressed_capacity(
+                    GlobalEnv::GetInstance()->get_storage_page_cache_compressed_size());
         });
         _config_callback.emplace("datacache_mem_size", [&]() {
             int64_t mem_limit = MemInfo::physical_mem();
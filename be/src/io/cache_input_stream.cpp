@@ -18,8 +18,10 @@
 
 #include <utility>
 
+#include "block_cache/datacache_utils.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
-#include "util/hash_util.hpp"
+#include "io/remote_io_trace.h"
 #include "util/runtime_profile.h"
 #include "util/stack_util.h"
 
@@ -40,23 +42,7 @@ CacheInputStream::CacheInputStream(const std::shared_ptr<SharedBufferedInputStre
     _cache = BlockCache::instance();
     _block_size = _cache->block_size();
 
-    _cache_key.resize(12);
-
-    char* data = _cache_key.data();
-    uint64_t hash_value = HashUtil::hash64(filename.data(), filename.size(), 0);
-    memcpy(data, &hash_value, sizeof(hash_value));
-    // The modification time is more appropriate to indicate the different file versions.
-    // While some data source, such as Hudi, have no modification time because their files
-    // cannot be overwritten. So, if the modification time is unsupported, we use file size instead.
-    // Usually the last modification timestamp has 41 bits, to reduce memory usage, we ignore the tail 9
-    // bytes and choose the high 32 bits to represent the second timestamp.
-    if (modification_time > 0) {
-        uint32_t mtime_s = (modification_time >> 9) & 0x00000000FFFFFFFF;
-        memcpy(data + 8, &mtime_s, sizeof(mtime_s));
-    } else {
-        uint32_t file_size = _size;
-        memcpy(data + 8, &file_size, sizeof(file_size));
-    }
+    _cache_key = DataCacheUtils::calc_cache_key(filename, _size, modification_time);
     // default _buffer size is 4MB = (16 * 256KB)
     _buffer_size = 16 * _block_size;
     _buffer.reserve(_buffer_size);
@@ -154,6 +140,7 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
         _stats.read_mem_cache_bytes += options.stats.read_mem_bytes;
         _stats.read_disk_cache_bytes += options.stats.read_disk_bytes;
         _stats.read_cache_ns += read_cache_ns;
+        RemoteIOTrace::record(RemoteIOTrace::DATACACHE, read_size, read_cache_ns);
         if (_enable_cache_io_adaptor) {
             _cache->record_read_cache(read_size, read_cache_ns / 1000);
         }
@@ -237,6 +224,11 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
         WriteCacheOptions options{};
         options.async = _enable_async_populate_mode;
         const int64_t write_size = std::min(_block_size, write_end_offset - write_offset_cursor);
+        if (!_admit_to_cache(write_offset_cursor, write_size)) {
+            src_cursor += write_size;
+            write_offset_cursor += write_size;
+            continue;
+        }
 
         SharedBufferPtr sb = nullptr;
         if (options.async) {
@@ -251,13 +243,16 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
                 options.allow_zero_copy = true;
             }
         }
-        Status r = _cache->write_buffer(_cache_key, write_offset_cursor, write_size, src_cursor, &options);
+        Status r = _write_block_to_cache(write_offset_cursor, write_size, src_cursor, &options);
         if (r.ok()) {
             _stats.write_cache_count += 1;
             _stats.write_cache_bytes += write_size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
             _stats.write_disk_cache_bytes += options.stats.write_disk_bytes;
-        } else if (!r.is_already_exist() && !r.is_resource_busy()) {
+        } else if (r.is_resource_busy()) {
+            _stats.skip_write_cache_count += 1;
+            _stats.skip_write_cache_bytes += write_size;
+        } else if (!r.is_already_exist()) {
             _stats.write_cache_fail_count += 1;
             _stats.write_cache_fail_bytes += write_size;
             LOG(WARNING) << "write block cache failed, errmsg: " << r.message();
@@ -269,6 +264,25 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
     return Status::OK();
 }
 
+bool CacheInputStream::_admit_to_cache(const int64_t offset, const int64_t size) {
+    if (_cache->admit_to_populate(_cache_key, offset)) {
+        return true;
+    }
+    _stats.skip_write_cache_count += 1;
+    _stats.skip_write_cache_bytes += size;
+    return false;
+}
+
+Status CacheInputStream::_write_block_to_cache(const int64_t offset, const int64_t size, const char* src,
+                                               WriteCacheOptions* options) {
+    // The asynchronous mode of the cache engine writes the shared buffer without copying it, otherwise
+    // the block is copied and written by the background threads, unless it is disabled.
+    if (!options->async && config::datacache_background_populate_enable) {
+        return _cache->write_buffer_in_background(_cache_key, offset, size, src);
+    }
+    return _cache->write_buffer(_cache_key, offset, size, src, options);
+}
+
 void CacheInputStream::_deduplicate_shared_buffer(const SharedBufferPtr& sb) {
     if (sb->size == 0 || _block_map.empty()) {
         return;
@@ -423,12 +437,14 @@ StatusOr<std::string_view> CacheInputStream::peek(int64_t count) {
 
 void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count,
                                                              const SharedBufferPtr& sb) {
-    BlockCache* cache = BlockCache::instance();
     int64_t begin = offset / _block_size * _block_size;
     int64_t end = std::min((offset + count + _block_size - 1) / _block_size * _block_size, _size);
     p -= (offset - begin);
-    auto f = [cache, sb, this](const char* buf, size_t offset, size_t size) {
+    auto f = [sb, this](const char* buf, size_t offset, size_t size) {
         SCOPED_RAW_TIMER(&_stats.write_cache_ns);
+        if (!_admit_to_cache(offset, size)) {
+            return;
+        }
         WriteCacheOptions options;
         options.async = _enable_async_populate_mode;
         if (options.async) {
@@ -439,13 +455,13 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
             options.callback = cb;
             options.allow_zero_copy = true;
         }
-        Status r = cache->write_buffer(_cache_key, offset, size, buf, &options);
+        Status r = _write_block_to_cache(offset, size, buf, &options);
         if (r.ok()) {
             _stats.write_cache_count += 1;
             _stats.write_cache_bytes += size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
             _stats.write_disk_cache_bytes += options.stats.write_disk_bytes;
-        } else if (r.is_cancelled()) {
+        } else if (r.is_cancelled() || r.is_resource_busy()) {
             _stats.skip_write_cache_count += 1;
             _stats.skip_write_cache_bytes += size;
         } else if (!r.is_already_exist() && !r.is_resource_busy()) {
@@ -92,6 +92,10 @@ private:
     // Read multiple blocks from remote
     Status _read_blocks_from_remote(const int64_t offset, const int64_t size, char* out);
     Status _populate_to_cache(const int64_t offset, const int64_t size, char* src);
+    // Record the miss of the block at |offset|, and return whether it should be populated to cache.
+    bool _admit_to_cache(const int64_t offset, const int64_t size);
+    Status _write_block_to_cache(const int64_t offset, const int64_t size, const char* src,
+                                 WriteCacheOptions* options);
     void _populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count, const SharedBufferPtr& sb);
     void _deduplicate_shared_buffer(const SharedBufferPtr& sb);
 
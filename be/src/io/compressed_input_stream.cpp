@@ -14,8 +14,11 @@
 
 #include "io/compressed_input_stream.h"
 
+#include <algorithm>
+
 #include "gutil/strings/substitute.h"
 #include "util/compression/stream_compression.h"
+#include "util/thread.h"
 
 namespace starrocks::io {
 
@@ -106,4 +109,127 @@ Status CompressedInputStream::skip(int64_t n) {
     return Status::OK();
 }
 
+AsyncCompressedInputStream::AsyncCompressedInputStream(std::shared_ptr<InputStream> source, int num_buffers)
+        : _source(std::move(source)) {
+    for (int i = 0; i < std::max(num_buffers, 1); i++) {
+        auto buffer = std::make_unique<Buffer>();
+        buffer->data.resize(kBufferSize);
+        _free_buffers.emplace_back(std::move(buffer));
+    }
+}
+
+AsyncCompressedInputStream::~AsyncCompressedInputStream() {
+    {
+        std::lock_guard l(_mutex);
+        _stopped = true;
+    }
+    _cv.notify_all();
+    if (_producer.joinable()) {
+        _producer.join();
+    }
+}
+
+void AsyncCompressedInputStream::_produce() {
+    while (true) {
+        std::unique_ptr<Buffer> buffer;
+        {
+            std::unique_lock l(_mutex);
+            _cv.wait(l, [this] { return _stopped || !_free_buffers.empty(); });
+            if (_stopped) {
+                return;
+            }
+            buffer = std::move(_free_buffers.front());
+            _free_buffers.pop_front();
+        }
+
+        // Fill the whole buffer, so that the consumer is woken up once per buffer.
+        Status st;
+        bool eof = false;
+        buffer->size = 0;
+        while (buffer->size < buffer->data.size()) {
+            auto res = _source->read(buffer->data.data() + buffer->size, buffer->data.size() - buffer->size);
+            if (!res.ok()) {
+                eof = res.status().is_end_of_file();
+                st = eof ? Status::OK() : res.status();
+                break;
+            }
+            if (*res == 0) {
+                eof = true;
+                break;
+            }
+            buffer->size += *res;
+        }
+
+        {
+            std::lock_guard l(_mutex);
+            if (buffer->size > 0) {
+                _filled_buffers.emplace_back(std::move(buffer));
+            } else {
+                _free_buffers.emplace_back(std::move(buffer));
+            }
+            _status = st;
+            _eof = eof;
+        }
+        _cv.notify_all();
+        if (!st.ok() || eof) {
+            return;
+        }
+    }
+}
+
+StatusOr<int64_t> AsyncCompressedInputStream::read(void* data, int64_t size) {
+    if (!_producer.joinable()) {
+        _producer = std::thread([this] { _produce(); });
+        Thread::set_thread_name(_producer, "decompress");
+    }
+
+    auto* output = reinterpret_cast<uint8_t*>(data);
+    int64_t nread = 0;
+    while (nread < size) {
+        if (_current == nullptr) {
+            std::unique_lock l(_mutex);
+            // Return what has been read instead of waiting for the producer.
+            if (nread > 0 && _filled_buffers.empty()) {
+                break;
+            }
+            _cv.wait(l, [this] { return !_filled_buffers.empty() || _eof || !_status.ok(); });
+            if (_filled_buffers.empty()) {
+                if (!_status.ok() && nread == 0) {
+                    return _status;
+                }
+                break;
+            }
+            _current = std::move(_filled_buffers.front());
+            _filled_buffers.pop_front();
+            _current_offset = 0;
+        }
+
+        const size_t n = std::min<size_t>(size - nread, _current->size - _current_offset);
+        memcpy(output + nread, _current->data.data() + _current_offset, n);
+        nread += n;
+        _current_offset += n;
+        if (_current_offset == _current->size) {
+            {
+                std::lock_guard l(_mutex);
+                _free_buffers.emplace_back(std::move(_current));
+            }
+            _cv.notify_all();
+        }
+    }
+    return nread;
+}
+
+Status AsyncCompressedInputStream::skip(int64_t n) {
+    raw::RawVector<uint8_t> buff;
+    buff.resize(std::min<int64_t>(n, kBufferSize));
+    while (n > 0) {
+        ASSIGN_OR_RETURN(auto nread, read(buff.data(), std::min<int64_t>(n, buff.size())));
+        if (nread == 0) {
+            break;
+        }
+        n -= nread;
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks::io
@@ -14,6 +14,11 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include "common/status.h"
@@ -103,4 +108,52 @@ private:
     std::shared_ptr<CompressedInputStream> _source;
 };
 
+// AsyncCompressedInputStream reads |source|, usually a CompressedInputStream, on a dedicated thread into a bounded
+// queue of buffers, so that reading and decompressing the next buffers overlap with the parsing of the current one.
+// A load file is otherwise decompressed on the scanner thread and the scanner is bound by the decompression speed.
+//
+// The buffers are allocated up front by the creating thread, so they are charged to its memory tracker, and are
+// recycled between the producer and the consumer. It must be read by one thread at a time.
+class AsyncCompressedInputStream final : public InputStream {
+public:
+    static constexpr size_t kBufferSize = 1024 * 1024;
+
+    AsyncCompressedInputStream(std::shared_ptr<InputStream> source, int num_buffers);
+
+    ~AsyncCompressedInputStream() override;
+
+    StatusOr<int64_t> read(void* data, int64_t size) override;
+
+    Status skip(int64_t n) override;
+
+    StatusOr<std::unique_ptr<NumericStatistics>> get_numeric_statistics() override {
+        return _source->get_numeric_statistics();
+    }
+
+private:
+    struct Buffer {
+        raw::RawVector<uint8_t> data;
+        size_t size = 0;
+    };
+
+    void _produce();
+
+    std::shared_ptr<InputStream> _source;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    // Guarded by _mutex.
+    std::deque<std::unique_ptr<Buffer>> _free_buffers;
+    std::deque<std::unique_ptr<Buffer>> _filled_buffers;
+    Status _status;
+    bool _eof = false;
+    bool _stopped = false;
+
+    // The buffer being consumed, only accessed by the consumer.
+    std::unique_ptr<Buffer> _current;
+    size_t _current_offset = 0;
+
+    std::thread _producer;
+};
+
 } // namespace starrocks::io
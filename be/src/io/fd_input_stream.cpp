@@ -14,10 +14,14 @@
 
 #include "io/fd_input_stream.h"
 
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "io/io_error.h"
@@ -68,8 +72,38 @@ Status FdInputStream::close() {
     return Status::OK();
 }
 
+void FdInputStream::_maybe_readahead(int64_t count) {
+    const int64_t max_size = config::local_file_readahead_max_bytes;
+    if (max_size <= 0 || count <= 0) {
+        return;
+    }
+    if (_offset != _last_read_end) {
+        _sequential_reads = 0;
+        _readahead_size = 0;
+        _readahead_end = 0;
+        return;
+    }
+    if (++_sequential_reads < kSequentialReadsToReadahead) {
+        return;
+    }
+    // Advise the next window once the reads reach the second half of the advised range, so that the pages are
+    // already in the page cache when they are read.
+    const int64_t end = _offset + count;
+    if (end + _readahead_size / 2 < _readahead_end) {
+        return;
+    }
+    _readahead_size = std::min(std::max({_readahead_size * 2, count, kMinReadaheadSize}), max_size);
+    const int64_t start = std::max(_readahead_end, end);
+    _readahead_end = end + _readahead_size;
+    if (_readahead_end > start) {
+        // It is only a hint, errors are ignored.
+        (void)::posix_fadvise(_fd, start, _readahead_end - start, POSIX_FADV_WILLNEED);
+    }
+}
+
 StatusOr<int64_t> FdInputStream::read(void* data, int64_t count) {
     CHECK_IS_CLOSED(_is_closed);
+    _maybe_readahead(count);
     MonotonicStopWatch watch;
     watch.start();
     ssize_t res;
@@ -85,6 +119,7 @@ StatusOr<int64_t> FdInputStream::read(void* data, int64_t count) {
     s_posixread_iosize.Observe(res);
 #endif
     _offset += res;
+    _last_read_end = _offset;
     IOProfiler::add_read(res, watch.elapsed_time());
     return res;
 }
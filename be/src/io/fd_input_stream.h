@@ -57,12 +57,28 @@ public:
     // Otherwise, this is zero.
     int get_errno() const { return _errno; }
 
+    // The end of the range advised to the kernel for readahead, for testing.
+    int64_t readahead_end() const { return _readahead_end; }
+
 private:
+    static constexpr int64_t kMinReadaheadSize = 128 * 1024;
+    // The number of consecutive sequential reads after which readahead starts.
+    static constexpr int kSequentialReadsToReadahead = 2;
+
+    void _maybe_readahead(int64_t count);
+
     int _fd;
     int _errno;
     int64_t _offset;
     bool _close_on_delete;
     bool _is_closed;
+
+    // The sequential access detector. Readahead is tracked per stream rather than left to the kernel, because the
+    // file descriptors are shared by the streams of FdCache and the kernel sees their reads interleaved.
+    int64_t _last_read_end = -1;
+    int _sequential_reads = 0;
+    int64_t _readahead_size = 0;
+    int64_t _readahead_end = 0;
 };
 
 } // namespace starrocks::io
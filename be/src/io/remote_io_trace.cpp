@@ -0,0 +1,89 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/remote_io_trace.h"
+
+namespace starrocks::io {
+
+static thread_local RemoteIOTrace* tls_remote_io_trace = nullptr;
+
+// The buckets grow by 4 times from |first_bound|.
+static int bucket_of(int64_t value, int64_t first_bound) {
+    int bucket = 0;
+    for (int64_t bound = first_bound; bucket < RemoteIOTrace::kNumBuckets - 1 && value >= bound; bound *= 4) {
+        bucket++;
+    }
+    return bucket;
+}
+
+void RemoteIOTrace::record(Source source, int64_t bytes, int64_t latency_ns, int64_t extra_requests, bool failed) {
+    if (tls_remote_io_trace != nullptr) {
+        tls_remote_io_trace->add(source, bytes, latency_ns, extra_requests, failed);
+    }
+}
+
+void RemoteIOTrace::add(Source source, int64_t bytes, int64_t latency_ns, int64_t extra_requests, bool failed) {
+    Stats& stats = _stats[source];
+    stats.requests++;
+    stats.bytes += bytes;
+    stats.latency_ns += latency_ns;
+    stats.extra_requests += extra_requests;
+    stats.failures += failed;
+    stats.size_histogram[bucket_of(bytes, 4096)]++;
+    stats.latency_histogram[bucket_of(latency_ns, 1000000)]++;
+}
+
+bool RemoteIOTrace::empty() const {
+    for (const auto& stats : _stats) {
+        if (stats.requests > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const char* RemoteIOTrace::source_name(Source source) {
+    switch (source) {
+    case S3:
+        return "S3";
+    case STARLET:
+        return "Starlet";
+    case DATACACHE:
+        return "DataCache";
+    default:
+        return "Unknown";
+    }
+}
+
+const char* RemoteIOTrace::size_bucket_name(int bucket) {
+    static const char* const names[kNumBuckets] = {"0_4KB",     "4KB_16KB", "16KB_64KB", "64KB_256KB",
+                                                   "256KB_1MB", "1MB_4MB",  "4MB_16MB",  "16MB_"};
+    return names[bucket];
+}
+
+const char* RemoteIOTrace::latency_bucket_name(int bucket) {
+    static const char* const names[kNumBuckets] = {"0_1ms",     "1ms_4ms", "4ms_16ms", "16ms_64ms",
+                                                   "64ms_256ms", "256ms_1s", "1s_4s",    "4s_"};
+    return names[bucket];
+}
+
+RemoteIOTrace::Scope::Scope(RemoteIOTrace* trace) : _old(tls_remote_io_trace) {
+    tls_remote_io_trace = trace;
+}
+
+RemoteIOTrace::Scope::~Scope() {
+    tls_remote_io_trace = _old;
+}
+
+} // namespace starrocks::io
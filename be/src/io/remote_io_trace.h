@@ -0,0 +1,75 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace starrocks::io {
+
+// RemoteIOTrace summarizes the remote requests issued by the current thread within a RemoteIOTrace::Scope, by
+// request size and latency, e.g. the ranged GETs of S3InputStream, the reads of starlet files and the reads served
+// by the data cache. A scan sets its own trace, so that the requests of a query can be told apart from the others.
+class RemoteIOTrace {
+public:
+    enum Source { S3 = 0, STARLET, DATACACHE, NUM_SOURCES };
+
+    // Request sizes of [0, 4KB), [4KB, 16KB), ..., [16MB, +inf), and latencies of [0, 1ms), [1ms, 4ms), ...,
+    // [4s, +inf).
+    static constexpr int kNumBuckets = 8;
+
+    struct Stats {
+        int64_t requests = 0;
+        int64_t bytes = 0;
+        int64_t latency_ns = 0;
+        // The additional requests issued for the requests, e.g. the hedged GETs and the GETs of parallel parts.
+        int64_t extra_requests = 0;
+        int64_t failures = 0;
+        std::array<int64_t, kNumBuckets> size_histogram{};
+        std::array<int64_t, kNumBuckets> latency_histogram{};
+    };
+
+    // Record a request to the trace of the current thread, if any.
+    static void record(Source source, int64_t bytes, int64_t latency_ns, int64_t extra_requests = 0,
+                       bool failed = false);
+
+    void add(Source source, int64_t bytes, int64_t latency_ns, int64_t extra_requests, bool failed);
+
+    const Stats& stats(Source source) const { return _stats[source]; }
+    bool empty() const;
+    void reset() { _stats = {}; }
+
+    static const char* source_name(Source source);
+    static const char* size_bucket_name(int bucket);
+    static const char* latency_bucket_name(int bucket);
+
+    // Set |trace| as the trace of the current thread during the scope, nullptr disables the tracing.
+    class Scope {
+    public:
+        explicit Scope(RemoteIOTrace* trace);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        RemoteIOTrace* _old;
+    };
+
+private:
+    std::array<Stats, NUM_SOURCES> _stats{};
+};
+
+} // namespace starrocks::io
@@ -20,6 +20,18 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/config.h"
+#include "io/remote_io_trace.h"
+#include "util/threadpool.h"
+#include "util/time.h"
+
 #ifdef USE_STAROS
 #include "fslib/metric_key.h"
 #include "metrics/metrics.h"
@@ -33,6 +45,179 @@ inline Status make_error_status(const Aws::S3::S3Error& error) {
             static_cast<int>(error.GetResponseCode()), static_cast<int>(error.GetErrorType()), error.GetMessage()));
 }
 
+static StatusOr<int64_t> get_object_range(Aws::S3::S3Client* client, const std::string& bucket,
+                                          const std::string& object, int64_t offset, int64_t count, char* out) {
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(bucket);
+    request.SetKey(object);
+    request.SetRange(fmt::format("bytes={}-{}", offset, offset + count - 1));
+
+    Aws::S3::Model::GetObjectOutcome outcome = client->GetObject(request);
+    if (outcome.IsSuccess()) {
+        Aws::IOStream& body = outcome.GetResult().GetBody();
+        body.read(out, count);
+        return body.gcount();
+    } else {
+        return make_error_status(outcome.GetError());
+    }
+}
+
+// The latencies of the recent GETs of each bucket, to decide when to fire a hedged GET.
+class S3GetLatencies {
+public:
+    static S3GetLatencies& instance() {
+        static S3GetLatencies obj;
+        return obj;
+    }
+
+    void add(const std::string& bucket, int64_t latency_ns) {
+        std::lock_guard l(_mutex);
+        auto& latencies = _buckets[bucket];
+        latencies.samples[latencies.next++ % kMaxSamples] = latency_ns;
+        if (latencies.next % kRefreshInterval == 0 && latencies.next >= kMinSamples) {
+            size_t n = std::min(latencies.next, kMaxSamples);
+            std::vector<int64_t> samples(latencies.samples.begin(), latencies.samples.begin() + n);
+            auto p95 = samples.begin() + n * 95 / 100;
+            std::nth_element(samples.begin(), p95, samples.end());
+            latencies.p95_ns = *p95;
+        }
+    }
+
+    // Return -1 if there are not enough samples.
+    int64_t p95_ns(const std::string& bucket) {
+        std::lock_guard l(_mutex);
+        auto iter = _buckets.find(bucket);
+        return iter != _buckets.end() ? iter->second.p95_ns : -1;
+    }
+
+private:
+    static constexpr size_t kMaxSamples = 1024;
+    static constexpr size_t kMinSamples = 64;
+    static constexpr size_t kRefreshInterval = 16;
+
+    struct Latencies {
+        std::array<int64_t, kMaxSamples> samples;
+        size_t next = 0;
+        int64_t p95_ns = -1;
+    };
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, Latencies> _buckets;
+};
+
+static ThreadPool* s3_read_thread_pool() {
+    static std::unique_ptr<ThreadPool> pool = [] {
+        std::unique_ptr<ThreadPool> p;
+        auto st = ThreadPoolBuilder("s3_read")
+                          .set_min_threads(0)
+                          .set_max_threads(std::max(1, config::s3_read_max_threads))
+                          .set_idle_timeout(MonoDelta::FromMilliseconds(60 * 1000))
+                          .build(&p);
+        LOG_IF(WARNING, !st.ok()) << "failed to create s3 read thread pool: " << st;
+        return p;
+    }();
+    return pool.get();
+}
+
+// A ranged GET executed in the s3 read thread pool, which can be hedged by a duplicate GET of the same range.
+// Each GET reads into its own buffer, because the loser may still be running after the reader returns.
+class S3RangeRead {
+public:
+    S3RangeRead(std::shared_ptr<Aws::S3::S3Client> client, const std::string& bucket, const std::string& object,
+                int64_t offset, int64_t count)
+            : _state(std::make_shared<State>()) {
+        _state->client = std::move(client);
+        _state->bucket = bucket;
+        _state->object = object;
+        _state->offset = offset;
+        _state->count = count;
+    }
+
+    void start() {
+        _start_ns = MonotonicNanos();
+        _submit();
+    }
+
+    // Wait for the first successful GET and copy its data into |out|, a duplicate GET is fired once if none has
+    // finished within |hedge_delay_ns|. |hedge_delay_ns| < 0 means never hedge.
+    StatusOr<int64_t> wait(char* out, int64_t hedge_delay_ns) {
+        std::unique_lock l(_state->mutex);
+        if (hedge_delay_ns >= 0) {
+            int64_t wait_ns = std::max<int64_t>(0, _start_ns + hedge_delay_ns - MonotonicNanos());
+            if (!_state->cv.wait_for(l, std::chrono::nanoseconds(wait_ns), [&] { return _state->finished > 0; })) {
+                l.unlock();
+                _submit();
+                l.lock();
+            }
+        }
+        _state->cv.wait(l, [&] { return _state->done || _state->finished == _state->submitted; });
+        if (!_state->done) {
+            return _state->status;
+        }
+        memcpy(out, _state->data.data(), _state->data.size());
+        return static_cast<int64_t>(_state->data.size());
+    }
+
+    // The number of GETs fired so far, including the hedged one.
+    int submitted() const {
+        std::lock_guard l(_state->mutex);
+        return _state->submitted;
+    }
+
+private:
+    struct State {
+        std::shared_ptr<Aws::S3::S3Client> client;
+        std::string bucket;
+        std::string object;
+        int64_t offset = 0;
+        int64_t count = 0;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        int submitted = 0;
+        int finished = 0;
+        bool done = false;
+        Status status;
+        std::string data;
+    };
+
+    static void _run(const std::shared_ptr<State>& state) {
+        std::string data;
+        data.resize(state->count);
+        int64_t start_ns = MonotonicNanos();
+        auto res = get_object_range(state->client.get(), state->bucket, state->object, state->offset, state->count,
+                                    data.data());
+        if (res.ok()) {
+            S3GetLatencies::instance().add(state->bucket, MonotonicNanos() - start_ns);
+            data.resize(*res);
+        }
+        std::lock_guard l(state->mutex);
+        state->finished++;
+        if (res.ok() && !state->done) {
+            state->done = true;
+            state->data = std::move(data);
+        } else if (!res.ok()) {
+            state->status = res.status();
+        }
+        state->cv.notify_all();
+    }
+
+    void _submit() {
+        {
+            std::lock_guard l(_state->mutex);
+            _state->submitted++;
+        }
+        auto* pool = s3_read_thread_pool();
+        if (pool == nullptr || !pool->submit_func([state = _state] { _run(state); }).ok()) {
+            // run in the current thread if the pool is not available
+            _run(_state);
+        }
+    }
+
+    std::shared_ptr<State> _state;
+    int64_t _start_ns = 0;
+};
+
 StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     if (UNLIKELY(_size == -1)) {
         ASSIGN_OR_RETURN(_size, S3InputStream::get_size());
@@ -40,22 +225,67 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     if (_offset >= _size) {
         return 0;
     }
+    count = std::min<int64_t>(count, _size - _offset);
+    if (count <= 0) {
+        return 0;
+    }
 
-    auto range = fmt::format("bytes={}-{}", _offset, std::min<int64_t>(_offset + count, _size));
-    Aws::S3::Model::GetObjectRequest request;
-    request.SetBucket(_bucket);
-    request.SetKey(_object);
-    request.SetRange(std::move(range));
+    int64_t hedge_delay_ns = -1;
+    if (config::enable_s3_hedged_read) {
+        int64_t p95_ns = S3GetLatencies::instance().p95_ns(_bucket);
+        if (p95_ns >= 0) {
+            hedge_delay_ns = std::max(p95_ns, config::s3_hedged_read_min_delay_ms * 1000 * 1000);
+        }
+    }
+    int64_t part_size = count;
+    if (config::s3_parallel_read_min_size > 0 && count >= config::s3_parallel_read_min_size &&
+        config::s3_read_part_size > 0) {
+        part_size = config::s3_read_part_size;
+    }
 
-    Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
-    if (outcome.IsSuccess()) {
-        Aws::IOStream& body = outcome.GetResult().GetBody();
-        body.read(static_cast<char*>(out), count);
-        _offset += body.gcount();
-        return body.gcount();
-    } else {
-        return make_error_status(outcome.GetError());
+    if (hedge_delay_ns < 0 && part_size >= count) {
+        int64_t start_ns = MonotonicNanos();
+        auto res = get_object_range(_s3client.get(), _bucket, _object, _offset, count, static_cast<char*>(out));
+        int64_t latency_ns = MonotonicNanos() - start_ns;
+        RemoteIOTrace::record(RemoteIOTrace::S3, res.ok() ? *res : 0, latency_ns, 0, !res.ok());
+        ASSIGN_OR_RETURN(auto bytes, res);
+        S3GetLatencies::instance().add(_bucket, latency_ns);
+        _offset += bytes;
+        return bytes;
+    }
+
+    int64_t start_ns = MonotonicNanos();
+
+    std::vector<std::unique_ptr<S3RangeRead>> parts;
+    for (int64_t off = 0; off < count; off += part_size) {
+        parts.emplace_back(std::make_unique<S3RangeRead>(_s3client, _bucket, _object, _offset + off,
+                                                         std::min(part_size, count - off)));
+        parts.back()->start();
+    }
+    // The read is traced as a single request, the GETs beyond the first one are its extra requests.
+    auto trace = [&](int64_t bytes, bool failed) {
+        int64_t extra_requests = -1;
+        for (const auto& part : parts) {
+            extra_requests += part->submitted();
+        }
+        RemoteIOTrace::record(RemoteIOTrace::S3, bytes, MonotonicNanos() - start_ns, extra_requests, failed);
+    };
+    int64_t bytes = 0;
+    for (int64_t i = 0; i < parts.size(); i++) {
+        int64_t part_offset = i * part_size;
+        auto res = parts[i]->wait(static_cast<char*>(out) + part_offset, hedge_delay_ns);
+        if (!res.ok()) {
+            trace(bytes, true);
+            return res.status();
+        }
+        bytes += *res;
+        if (*res < std::min(part_size, count - part_offset)) {
+            break;
+        }
     }
+    trace(bytes, false);
+    _offset += bytes;
+    return bytes;
 }
 
 Status S3InputStream::seek(int64_t offset) {
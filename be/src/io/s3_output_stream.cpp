@@ -14,6 +14,7 @@
 
 #include "io/s3_output_stream.h"
 
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
 #include <aws/s3/model/CreateMultipartUploadRequest.h>
@@ -21,10 +22,95 @@
 #include <aws/s3/model/UploadPartRequest.h>
 #include <fmt/format.h>
 
+#include <condition_variable>
+#include <mutex>
+
+#include "common/config.h"
 #include "common/logging.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
+// A stream over the memory of a buffer without copying it, the buffer must outlive the stream.
+class BufferIOStream : public Aws::IOStream {
+public:
+    explicit BufferIOStream(Aws::String* buffer)
+            : Aws::IOStream(nullptr),
+              _streambuf(reinterpret_cast<unsigned char*>(buffer->data()), buffer->size()) {
+        rdbuf(&_streambuf);
+    }
+
+private:
+    Aws::Utils::Stream::PreallocatedStreamBuf _streambuf;
+};
+
+// The part buffers released by the streams, which are reused by the later ones to avoid allocating
+// and faulting in the large buffers over and over again.
+class S3UploadBufferPool {
+public:
+    static S3UploadBufferPool& instance() {
+        static S3UploadBufferPool obj;
+        return obj;
+    }
+
+    Aws::String acquire(size_t capacity) {
+        Aws::String buffer;
+        {
+            std::lock_guard l(_mutex);
+            if (!_buffers.empty()) {
+                buffer = std::move(_buffers.back());
+                _buffers.pop_back();
+                _cached_bytes -= buffer.capacity();
+            }
+        }
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(GlobalEnv::GetInstance()->s3_upload_buffer_mem_tracker());
+        buffer.reserve(capacity);
+        return buffer;
+    }
+
+    void release(Aws::String&& buffer) {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(GlobalEnv::GetInstance()->s3_upload_buffer_mem_tracker());
+        buffer.clear();
+        std::lock_guard l(_mutex);
+        if (_cached_bytes + buffer.capacity() <= config::s3_upload_buffer_pool_max_bytes) {
+            _cached_bytes += buffer.capacity();
+            _buffers.emplace_back(std::move(buffer));
+        } else {
+            Aws::String().swap(buffer);
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<Aws::String> _buffers;
+    int64_t _cached_bytes = 0;
+};
+
+static ThreadPool* s3_upload_thread_pool() {
+    static std::unique_ptr<ThreadPool> pool = [] {
+        std::unique_ptr<ThreadPool> p;
+        auto st = ThreadPoolBuilder("s3_upload")
+                          .set_min_threads(0)
+                          .set_max_threads(std::max(1, config::s3_upload_max_threads))
+                          .set_idle_timeout(MonoDelta::FromMilliseconds(60 * 1000))
+                          .build(&p);
+        LOG_IF(WARNING, !st.ok()) << "failed to create s3 upload thread pool: " << st;
+        return p;
+    }();
+    return pool.get();
+}
+
+struct S3OutputStream::MultipartUpload {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int inflight_parts = 0;
+    Status status;
+    // indexed by part number - 1
+    std::vector<Aws::String> etags;
+};
+
 S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
                                int64_t max_single_part_size, int64_t min_upload_part_size)
         : _client(std::move(client)),
@@ -34,10 +120,16 @@ S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::s
           _min_upload_part_size(min_upload_part_size),
           _buffer(),
           _upload_id(),
-          _etags() {
+          _multipart_upload() {
     CHECK(_client != nullptr);
 }
 
+S3OutputStream::~S3OutputStream() {
+    if (_multipart_upload != nullptr) {
+        S3UploadBufferPool::instance().release(std::move(_buffer));
+    }
+}
+
 Status S3OutputStream::write(const void* data, int64_t size) {
     _buffer.append(static_cast<const char*>(data), size);
     if (_upload_id.empty() && _buffer.size() > _max_single_part_size) {
@@ -46,7 +138,6 @@ Status S3OutputStream::write(const void* data, int64_t size) {
     }
     if (!_upload_id.empty() && _buffer.size() >= _min_upload_part_size) {
         RETURN_IF_ERROR(multipart_upload());
-        _buffer.clear();
     }
     return Status::OK();
 }
@@ -80,6 +171,7 @@ Status S3OutputStream::close() {
         RETURN_IF_ERROR(singlepart_upload());
     } else {
         RETURN_IF_ERROR(multipart_upload());
+        RETURN_IF_ERROR(wait_for_parts());
         RETURN_IF_ERROR(complete_multipart_upload());
     }
     _client = nullptr;
@@ -93,6 +185,11 @@ Status S3OutputStream::create_multipart_upload() {
     Aws::S3::Model::CreateMultipartUploadOutcome outcome = _client->CreateMultipartUpload(req);
     if (outcome.IsSuccess()) {
         _upload_id = outcome.GetResult().GetUploadId();
+        _multipart_upload = std::make_shared<MultipartUpload>();
+        // the part buffers are taken from the pool from now on
+        auto buffer = S3UploadBufferPool::instance().acquire(std::max<size_t>(_min_upload_part_size, _buffer.size()));
+        buffer.append(_buffer);
+        _buffer.swap(buffer);
         return Status::OK();
     }
     return Status::IOError(fmt::format("S3: Fail to create multipart upload for object {}/{}: {}", _bucket, _object,
@@ -106,7 +203,7 @@ Status S3OutputStream::singlepart_upload() {
     req.SetBucket(_bucket);
     req.SetKey(_object);
     req.SetContentLength(static_cast<int64_t>(_buffer.size()));
-    req.SetBody(std::make_shared<Aws::StringStream>(_buffer));
+    req.SetBody(std::make_shared<BufferIOStream>(&_buffer));
     Aws::S3::Model::PutObjectOutcome outcome = _client->PutObject(req);
     if (!outcome.IsSuccess()) {
         std::string error_msg =
@@ -122,27 +219,65 @@ Status S3OutputStream::multipart_upload() {
     if (_buffer.empty()) {
         return Status::OK();
     }
-    Aws::S3::Model::UploadPartRequest req;
-    req.SetBucket(_bucket);
-    req.SetKey(_object);
-    req.SetPartNumber(static_cast<int>(_etags.size() + 1));
-    req.SetUploadId(_upload_id);
-    req.SetContentLength(static_cast<int64_t>(_buffer.size()));
-    req.SetBody(std::make_shared<Aws::StringStream>(_buffer));
-    auto outcome = _client->UploadPart(req);
-    if (outcome.IsSuccess()) {
-        _etags.push_back(outcome.GetResult().GetETag());
-        return Status::OK();
+    DCHECK(_multipart_upload != nullptr);
+    int max_inflight_parts = std::max(1, config::s3_upload_max_inflight_parts);
+    int part_number = 0;
+    {
+        std::unique_lock l(_multipart_upload->mutex);
+        _multipart_upload->cv.wait(l, [&] { return _multipart_upload->inflight_parts < max_inflight_parts; });
+        RETURN_IF_ERROR(_multipart_upload->status);
+        _multipart_upload->inflight_parts++;
+        _multipart_upload->etags.emplace_back();
+        part_number = static_cast<int>(_multipart_upload->etags.size());
     }
-    return Status::IOError(
-            fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
+
+    auto task = [client = _client, bucket = _bucket, object = _object, upload_id = _upload_id, part_number,
+                 upload = _multipart_upload, buffer = std::make_shared<Aws::String>(std::move(_buffer))]() {
+        Aws::S3::Model::UploadPartRequest req;
+        req.SetBucket(bucket);
+        req.SetKey(object);
+        req.SetPartNumber(part_number);
+        req.SetUploadId(upload_id);
+        req.SetContentLength(static_cast<int64_t>(buffer->size()));
+        req.SetBody(std::make_shared<BufferIOStream>(buffer.get()));
+        auto outcome = client->UploadPart(req);
+        S3UploadBufferPool::instance().release(std::move(*buffer));
+
+        std::lock_guard l(upload->mutex);
+        if (outcome.IsSuccess()) {
+            upload->etags[part_number - 1] = outcome.GetResult().GetETag();
+        } else {
+            upload->status.update(Status::IOError(fmt::format("S3: Fail to upload part {} of {}/{}: {}", part_number,
+                                                              bucket, object, outcome.GetError().GetMessage())));
+        }
+        upload->inflight_parts--;
+        upload->cv.notify_all();
+    };
+    _buffer = S3UploadBufferPool::instance().acquire(_min_upload_part_size);
+
+    auto* pool = max_inflight_parts > 1 ? s3_upload_thread_pool() : nullptr;
+    if (pool == nullptr || !pool->submit_func(task).ok()) {
+        task();
+    }
+    if (max_inflight_parts == 1) {
+        return wait_for_parts();
+    }
+    return Status::OK();
+}
+
+Status S3OutputStream::wait_for_parts() {
+    DCHECK(_multipart_upload != nullptr);
+    std::unique_lock l(_multipart_upload->mutex);
+    _multipart_upload->cv.wait(l, [&] { return _multipart_upload->inflight_parts == 0; });
+    return _multipart_upload->status;
 }
 
 Status S3OutputStream::complete_multipart_upload() {
     VLOG(12) << "Completing multipart upload s3://" << _bucket << "/" << _object;
     DCHECK(!_upload_id.empty());
-    DCHECK(!_etags.empty());
-    if (UNLIKELY(_etags.size() > std::numeric_limits<int>::max())) {
+    const auto& etags = _multipart_upload->etags;
+    DCHECK(!etags.empty());
+    if (UNLIKELY(etags.size() > std::numeric_limits<int>::max())) {
         return Status::NotSupported("Too many S3 upload parts");
     }
     Aws::S3::Model::CompleteMultipartUploadRequest req;
@@ -150,9 +285,9 @@ Status S3OutputStream::complete_multipart_upload() {
     req.SetKey(_object);
     req.SetUploadId(_upload_id);
     Aws::S3::Model::CompletedMultipartUpload multipart_upload;
-    for (int i = 0, sz = static_cast<int>(_etags.size()); i < sz; ++i) {
+    for (int i = 0, sz = static_cast<int>(etags.size()); i < sz; ++i) {
         Aws::S3::Model::CompletedPart part;
-        multipart_upload.AddParts(part.WithETag(_etags[i]).WithPartNumber(i + 1));
+        multipart_upload.AddParts(part.WithETag(etags[i]).WithPartNumber(i + 1));
     }
     req.SetMultipartUpload(multipart_upload);
     auto outcome = _client->CompleteMultipartUpload(req);
@@ -16,6 +16,8 @@
 
 #include <aws/s3/S3Client.h>
 
+#include <memory>
+
 #include "io/output_stream.h"
 
 namespace starrocks::io {
@@ -25,7 +27,7 @@ public:
     explicit S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
                             int64_t max_single_part_size, int64_t min_upload_part_size);
 
-    ~S3OutputStream() override = default;
+    ~S3OutputStream() override;
 
     // Disallow copy and assignment
     S3OutputStream(const S3OutputStream&) = delete;
@@ -50,9 +52,15 @@ public:
     Status close() override;
 
 private:
+    struct MultipartUpload;
+
     Status create_multipart_upload();
+    // Upload |_buffer| as the next part asynchronously, after waiting until the number of the parts in flight is
+    // below s3_upload_max_inflight_parts.
     Status multipart_upload();
     Status singlepart_upload();
+    // Wait for all the parts in flight, and return the first error of them.
+    Status wait_for_parts();
     Status complete_multipart_upload();
 
     std::shared_ptr<Aws::S3::S3Client> _client;
@@ -62,7 +70,8 @@ private:
     const int64_t _min_upload_part_size;
     Aws::String _buffer;
     Aws::String _upload_id;
-    std::vector<Aws::String> _etags;
+    // shared with the part uploading tasks, which may outlive this stream when it is not closed.
+    std::shared_ptr<MultipartUpload> _multipart_upload;
 };
 
 } // namespace starrocks::io
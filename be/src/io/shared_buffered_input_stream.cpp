@@ -20,6 +20,7 @@
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -27,6 +28,13 @@ SharedBufferedInputStream::SharedBufferedInputStream(std::shared_ptr<SeekableInp
                                                      size_t file_size)
         : _stream(std::move(stream)), _filename(std::move(filename)), _file_size(file_size) {}
 
+SharedBufferedInputStream::~SharedBufferedInputStream() {
+    // The prefetching tasks refer to this stream.
+    for (auto& [_, sb] : _map) {
+        _wait_prefetched(sb.get());
+    }
+}
+
 void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t file_size) {
     if (align_size != 0) {
         offset = raw_offset / align_size * align_size;
@@ -215,6 +223,7 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
     }
 
     SharedBuffer& sb = *shared_buffer;
+    _wait_prefetched(&sb);
     if (sb.buffer.capacity() == 0) {
         RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
         SCOPED_RAW_TIMER(&_shared_io_timer);
@@ -226,18 +235,80 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
             _shared_align_io_bytes += sb.size - sb.raw_size;
         }
         sb.buffer.reserve(sb.size);
+        std::lock_guard l(_stream_mutex);
         RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
 }
 
+Status SharedBufferedInputStream::prefetch(int64_t offset, int64_t count) {
+    if (_prefetch_pool == nullptr) {
+        return Status::OK();
+    }
+    for (auto iter = _map.upper_bound(offset); iter != _map.end() && iter->second->offset < offset + count; ++iter) {
+        const SharedBufferPtr& sb = iter->second;
+        if (sb->buffer.capacity() != 0) {
+            // already read or being prefetched
+            continue;
+        }
+        // Allocate the buffer here, so that it is charged to the memory tracker of the caller.
+        RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("prefetch into shared buffer"));
+        sb->buffer.reserve(sb->size);
+        auto promise = std::make_shared<std::promise<Status>>();
+        sb->prefetched = promise->get_future();
+        auto st = _prefetch_pool->submit_func([this, sb, promise]() {
+            std::lock_guard l(_stream_mutex);
+            promise->set_value(_stream->read_at_fully(sb->offset, sb->buffer.data(), sb->size));
+        });
+        if (!st.ok()) {
+            // The pool is busy, leave the rest to the synchronous reads.
+            sb->prefetched = std::future<Status>();
+            std::vector<uint8_t>().swap(sb->buffer);
+            break;
+        }
+        _prefetch_count += 1;
+        _prefetch_bytes += sb->size;
+        _shared_io_count += 1;
+        _shared_io_bytes += sb->size;
+        if (sb->size > sb->raw_size) {
+            _shared_align_io_bytes += sb->size - sb->raw_size;
+        }
+    }
+    return Status::OK();
+}
+
+void SharedBufferedInputStream::_wait_prefetched(SharedBuffer* sb) {
+    if (!sb->prefetched.valid()) {
+        return;
+    }
+    SCOPED_RAW_TIMER(&_prefetch_wait_timer);
+    Status st;
+    try {
+        st = sb->prefetched.get();
+    } catch (const std::future_error& e) {
+        // the task is dropped by the pool
+        st = Status::InternalError(e.what());
+    }
+    if (!st.ok()) {
+        // Read it again synchronously, to return the error if any to the reader.
+        VLOG(2) << "failed to prefetch " << sb->debug_string() << " of " << _filename << ": " << st;
+        std::vector<uint8_t>().swap(sb->buffer);
+    }
+}
+
 void SharedBufferedInputStream::release() {
+    for (auto& [_, sb] : _map) {
+        _wait_prefetched(sb.get());
+    }
     _map.clear();
 }
 
 void SharedBufferedInputStream::release_to_offset(int64_t offset) {
     auto it = _map.upper_bound(offset);
+    for (auto iter = _map.begin(); iter != it; ++iter) {
+        _wait_prefetched(iter->second.get());
+    }
     _map.erase(_map.begin(), it);
 }
 
@@ -247,6 +318,7 @@ Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64
         SCOPED_RAW_TIMER(&_direct_io_timer);
         _direct_io_count += 1;
         _direct_io_bytes += count;
+        std::lock_guard l(_stream_mutex);
         RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
         return Status::OK();
     }
@@ -261,6 +333,7 @@ StatusOr<int64_t> SharedBufferedInputStream::get_size() {
 }
 
 StatusOr<int64_t> SharedBufferedInputStream::read(void* data, int64_t count) {
+    std::lock_guard l(_stream_mutex);
     auto n = _stream->read_at(_offset, data, count);
     RETURN_IF_ERROR(n);
     _offset += n.value();
@@ -269,6 +342,7 @@ StatusOr<int64_t> SharedBufferedInputStream::read(void* data, int64_t count) {
 
 StatusOr<std::string_view> SharedBufferedInputStream::peek(int64_t count) {
     ASSIGN_OR_RETURN(auto ret, find_shared_buffer(_offset, count));
+    _wait_prefetched(ret.get());
     if (ret->buffer.capacity() == 0) return Status::NotSupported("peek shared buffer empty");
     const uint8_t* buf = nullptr;
     RETURN_IF_ERROR(get_bytes(&buf, _offset, count, ret));
@@ -278,6 +352,7 @@ StatusOr<std::string_view> SharedBufferedInputStream::peek(int64_t count) {
 StatusOr<std::string_view> SharedBufferedInputStream::peek_shared_buffer(int64_t count,
                                                                          SharedBufferPtr* shared_buffer) {
     ASSIGN_OR_RETURN(auto ret, find_shared_buffer(_offset, count));
+    _wait_prefetched(ret.get());
     if (ret->buffer.capacity() == 0) return Status::NotSupported("peek shared buffer empty");
     const uint8_t* buf = ret->buffer.data() + _offset - ret->offset;
     if (shared_buffer) {
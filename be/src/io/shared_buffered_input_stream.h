@@ -16,11 +16,17 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/seekable_input_stream.h"
 
+namespace starrocks {
+class ThreadPool;
+}
+
 namespace starrocks::io {
 
 class SharedBufferedInputStream : public SeekableInputStream {
@@ -47,16 +53,19 @@ public:
         int64_t size;
         int64_t ref_count;
         std::vector<uint8_t> buffer;
+        // valid while the buffer is being read by prefetch().
+        std::future<Status> prefetched;
         void align(int64_t align_size, int64_t file_size);
         std::string debug_string() const;
     };
     using SharedBufferPtr = std::shared_ptr<SharedBuffer>;
 
     SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename, size_t file_size);
-    ~SharedBufferedInputStream() override = default;
+    ~SharedBufferedInputStream() override;
 
     Status seek(int64_t position) override {
         _offset = position;
+        std::lock_guard l(_stream_mutex);
         return _stream->seek(position);
     }
     StatusOr<int64_t> position() override { return _offset; }
@@ -65,6 +74,7 @@ public:
     StatusOr<int64_t> get_size() override;
     Status skip(int64_t count) override {
         _offset += count;
+        std::lock_guard l(_stream_mutex);
         return _stream->skip(count);
     }
 
@@ -74,6 +84,7 @@ public:
     Status get_bytes(const uint8_t** buffer, size_t offset, size_t count, SharedBufferPtr shared_buffer);
 
     StatusOr<std::unique_ptr<NumericStatistics>> get_numeric_statistics() override {
+        std::lock_guard l(_stream_mutex);
         return _stream->get_numeric_statistics();
     }
 
@@ -82,6 +93,11 @@ public:
     void release();
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
     void set_align_size(int64_t size) { _align_size = size; }
+    void set_prefetch_pool(ThreadPool* pool) { _prefetch_pool = pool; }
+
+    // Read the shared buffers overlapping [offset, offset + count) in the prefetch pool, the later
+    // reads of them wait for the prefetching instead of issuing I/O. A no-op without prefetch pool.
+    Status prefetch(int64_t offset, int64_t count);
 
     int64_t shared_io_count() const { return _shared_io_count; }
     int64_t shared_io_bytes() const { return _shared_io_bytes; }
@@ -91,6 +107,9 @@ public:
     int64_t direct_io_bytes() const { return _direct_io_bytes; }
     int64_t direct_io_timer() const { return _direct_io_timer; }
     int64_t estimated_mem_usage() const { return _estimated_mem_usage; }
+    int64_t prefetch_count() const { return _prefetch_count; }
+    int64_t prefetch_bytes() const { return _prefetch_bytes; }
+    int64_t prefetch_wait_timer() const { return _prefetch_wait_timer; }
 
     StatusOr<std::string_view> peek(int64_t count) override;
     const std::string& filename() const override { return _filename; }
@@ -99,11 +118,15 @@ public:
 
 private:
     void _update_estimated_mem_usage();
+    void _wait_prefetched(SharedBuffer* sb);
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
     Status _set_io_ranges_active_and_lazy_columns(const std::vector<IORange>& ranges);
     const std::shared_ptr<SeekableInputStream> _stream;
+    // Serializes the reads of |_stream| by the prefetch pool and the caller.
+    std::mutex _stream_mutex;
+    ThreadPool* _prefetch_pool = nullptr;
     const std::string _filename;
     std::map<int64_t, SharedBufferPtr> _map;
     CoalesceOptions _options;
@@ -118,6 +141,9 @@ private:
     int64_t _direct_io_timer = 0;
     int64_t _align_size = 0;
     int64_t _estimated_mem_usage = 0;
+    int64_t _prefetch_count = 0;
+    int64_t _prefetch_bytes = 0;
+    int64_t _prefetch_wait_timer = 0;
 };
 
 } // namespace starrocks::io
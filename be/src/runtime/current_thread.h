@@ -53,6 +53,19 @@ inline thread_local MemTracker* tls_operator_mem_tracker = nullptr;
 inline thread_local MemTracker* tls_exceed_mem_tracker = nullptr;
 inline thread_local bool tls_is_thread_status_init = false;
 
+// What the current pipeline worker thread is executing. It is read by DriverSamplingProfiler from a signal
+// handler running on the same thread, so it only holds plain values and must not need dynamic initialization.
+struct DriverSampleContext {
+    int64_t query_id_hi;
+    int64_t query_id_lo;
+    int64_t workgroup_id;
+    int32_t driver_id;
+    int32_t plan_node_id;
+    // Points to the name owned by the running operator, valid until the operator returns.
+    const std::string* operator_name;
+};
+inline thread_local DriverSampleContext tls_driver_sample_ctx{0, 0, -1, 0, -1, nullptr};
+
 class CurrentThread {
 private:
     class MemCacheManager {
@@ -136,7 +149,10 @@ private:
         void release(int64_t size) {
             _cache_size -= size;
             _deallocated_cache_size += size;
-            if (_cache_size <= -BATCH_SIZE) {
+            _total_released_bytes += size;
+            // The released bytes are kept as the credit of the following allocations, so that allocating and
+            // releasing a large block repeatedly doesn't walk the tracker hierarchy every time.
+            if (_cache_size <= -RELEASE_BATCH_SIZE) {
                 commit(false);
             }
         }
@@ -166,6 +182,8 @@ private:
 
         int64_t get_consumed_bytes() const { return _total_consumed_bytes; }
 
+        int64_t get_released_bytes() const { return _total_released_bytes; }
+
     private:
         int64_t _consume_from_reserved(int64_t size) {
             if (_reserved_bytes > size) {
@@ -178,7 +196,10 @@ private:
             return size;
         }
 
+        // The uncommitted allocations are committed once they reach BATCH_SIZE, and the uncommitted releases once
+        // they reach RELEASE_BATCH_SIZE, both are committed exactly on the context shift.
         const static int64_t BATCH_SIZE = 2 * 1024 * 1024;
+        const static int64_t RELEASE_BATCH_SIZE = 4 * BATCH_SIZE;
 
         std::function<MemTracker*()> _loader;
 
@@ -191,6 +212,7 @@ private:
         // Deallocated but not committed memory bytes, always positive
         int64_t _deallocated_cache_size = 0;
         int64_t _total_consumed_bytes = 0; // Totally consumed memory bytes
+        int64_t _total_released_bytes = 0; // Totally released memory bytes
         int64_t _try_consume_mem_size = 0; // Last time tried to consumed bytes
     };
 
@@ -203,14 +225,22 @@ public:
     void mem_tracker_ctx_shift() { _mem_cache_manager.commit(true); }
     void operator_mem_tracker_ctx_shift() { _operator_mem_cache_manager.commit(true); }
 
-    void set_query_id(const starrocks::TUniqueId& query_id) { _query_id = query_id; }
+    void set_query_id(const starrocks::TUniqueId& query_id) {
+        _query_id = query_id;
+        tls_driver_sample_ctx.query_id_hi = query_id.hi;
+        tls_driver_sample_ctx.query_id_lo = query_id.lo;
+    }
     const starrocks::TUniqueId& query_id() { return _query_id; }
 
     void set_fragment_instance_id(const starrocks::TUniqueId& fragment_instance_id) {
         _fragment_instance_id = fragment_instance_id;
     }
     const starrocks::TUniqueId& fragment_instance_id() { return _fragment_instance_id; }
-    void set_pipeline_driver_id(int32_t driver_id) { _driver_id = driver_id; }
+    void set_pipeline_driver_id(int32_t driver_id) {
+        _driver_id = driver_id;
+        tls_driver_sample_ctx.driver_id = driver_id;
+    }
+    void set_workgroup_id(int64_t workgroup_id) { tls_driver_sample_ctx.workgroup_id = workgroup_id; }
     int32_t get_driver_id() const { return _driver_id; }
 
     void set_custom_coredump_msg(const std::string& custom_coredump_msg) { _custom_coredump_msg = custom_coredump_msg; }
@@ -316,6 +346,8 @@ public:
 
     int64_t get_consumed_bytes() const { return _mem_cache_manager.get_consumed_bytes(); }
 
+    int64_t get_released_bytes() const { return _mem_cache_manager.get_released_bytes(); }
+
 private:
     // In order to record operator level memory trace while keep up high performance, we need to
     // record the normal MemTracker's tree and operator's isolated MemTracker independently.
@@ -406,6 +438,30 @@ private:
     bool _prev_check;
 };
 
+class CurrentThreadSampledOperatorSetter {
+public:
+    CurrentThreadSampledOperatorSetter(const std::string* operator_name, int32_t plan_node_id) {
+        _prev_operator_name = tls_driver_sample_ctx.operator_name;
+        _prev_plan_node_id = tls_driver_sample_ctx.plan_node_id;
+        tls_driver_sample_ctx.plan_node_id = plan_node_id;
+        tls_driver_sample_ctx.operator_name = operator_name;
+    }
+
+    ~CurrentThreadSampledOperatorSetter() {
+        tls_driver_sample_ctx.operator_name = _prev_operator_name;
+        tls_driver_sample_ctx.plan_node_id = _prev_plan_node_id;
+    }
+
+    CurrentThreadSampledOperatorSetter(const CurrentThreadSampledOperatorSetter&) = delete;
+    void operator=(const CurrentThreadSampledOperatorSetter&) = delete;
+    CurrentThreadSampledOperatorSetter(CurrentThreadSampledOperatorSetter&&) = delete;
+    void operator=(CurrentThreadSampledOperatorSetter&&) = delete;
+
+private:
+    const std::string* _prev_operator_name;
+    int32_t _prev_plan_node_id;
+};
+
 class CurrentThreadCatchSetter {
 public:
     explicit CurrentThreadCatchSetter(bool catched) { _prev_catched = tls_thread_status.set_is_catched(catched); }
@@ -421,6 +477,9 @@ private:
     bool _prev_catched;
 };
 
+#define SCOPED_SET_SAMPLED_OPERATOR(operator_name, plan_node_id) \
+    auto VARNAME_LINENUM(sampled_operator_setter) = CurrentThreadSampledOperatorSetter(operator_name, plan_node_id)
+
 #define SCOPED_SET_CATCHED(catched) auto VARNAME_LINENUM(catched_setter) = CurrentThreadCatchSetter(catched)
 
 #define RELEASE_RESERVED_GUARD() \
@@ -34,6 +34,7 @@
 
 #include "runtime/data_stream_mgr.h"
 
+#include <atomic>
 #include <iostream>
 #include <utility>
 
@@ -170,6 +171,50 @@ Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::goog
     return Status::OK();
 }
 
+namespace {
+// Runs the closure of a coalesced rpc after all the requests packed into it have released it.
+class CountDownClosure : public google::protobuf::Closure {
+public:
+    CountDownClosure(google::protobuf::Closure* done, int count) : _done(done), _count(count) {}
+    ~CountDownClosure() override = default;
+    void Run() override {
+        if (_count.fetch_sub(1) == 1) {
+            std::unique_ptr<CountDownClosure> self_guard(this);
+            _done->Run();
+        }
+    }
+
+private:
+    google::protobuf::Closure* _done;
+    std::atomic<int> _count;
+};
+} // namespace
+
+Status DataStreamMgr::transmit_coalesced_chunks(const PTransmitChunkParams& request,
+                                                ::google::protobuf::Closure** done) {
+    DCHECK(done != nullptr && *done != nullptr);
+    // One count for each request, and one more for the caller.
+    auto* count_down = new CountDownClosure(*done, request.coalesced_requests_size() + 2);
+    *done = count_down;
+
+    Status st;
+    auto transmit = [&](const PTransmitChunkParams& params) {
+        google::protobuf::Closure* transmit_done = count_down;
+        auto transmit_st = transmit_chunk(params, &transmit_done);
+        if (transmit_done != nullptr) {
+            transmit_done->Run();
+        }
+        if (st.ok() && !transmit_st.ok()) {
+            st = transmit_st;
+        }
+    };
+    transmit(request);
+    for (const auto& coalesced_request : request.coalesced_requests()) {
+        transmit(coalesced_request);
+    }
+    return st;
+}
+
 void DataStreamMgr::deregister_recvr(const TUniqueId& fragment_instance_id, PlanNodeId node_id) {
     std::shared_ptr<DataStreamRecvr> target_recvr;
     VLOG_QUERY << "deregister_recvr(): fragment_instance_id=" << fragment_instance_id << ", node=" << node_id;
@@ -99,6 +99,11 @@ public:
                                                   bool is_pipeline, int32_t degree_of_parallelism, bool keep_order);
 
     Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
+    // Transmit a request and its coalesced_requests, i.e. the requests of the other fragment instances on
+    // the same host that share one rpc. The receivers may hold the closure for back pressure, so *done is
+    // replaced with a closure that the caller must run as usual, and the original one runs only after the
+    // caller and all the receivers have run it. The first error of the requests is returned.
+    Status transmit_coalesced_chunks(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
     // Closes all receivers registered for fragment_instance_id immediately.
     void cancel(const TUniqueId& fragment_instance_id);
     void close();
@@ -170,7 +170,8 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
           _sub_plan_query_statistics_recvr(std::move(sub_plan_query_statistics_recvr)),
           _is_pipeline(is_pipeline),
           _keep_order(keep_order),
-          _pass_through_context(pass_through_chunk_buffer, fragment_instance_id, dest_node_id) {
+          _pass_through_context(pass_through_chunk_buffer, fragment_instance_id, dest_node_id),
+          _chunk_size(runtime_state->chunk_size()) {
     // Create one queue per sender if is_merging is true.
     int num_queues = is_merging ? num_senders : 1;
     _sender_queues.reserve(num_queues);
@@ -211,6 +212,8 @@ void DataStreamRecvr::bind_profile(int32_t driver_sequence, const std::shared_pt
     statistics.decompress_chunk_timer = ADD_TIMER(profile, "DecompressChunkTime");
     statistics.process_total_timer = ADD_TIMER(profile, "ReceiverProcessTotalTime");
     statistics.wait_lock_timer = ADD_TIMER(profile, "WaitLockTime");
+    statistics.queue_wait_timer = ADD_TIMER(profile, "QueueWaitTime");
+    statistics.merged_chunk_counter = ADD_COUNTER(profile, "MergedChunkCount", TUnit::UNIT);
     statistics.buffer_unplug_counter = ADD_COUNTER(profile, "BufferUnplugCount", TUnit::UNIT);
     statistics.peak_buffer_mem_bytes = profile->AddHighWaterMarkCounter(
             "PeakBufferMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
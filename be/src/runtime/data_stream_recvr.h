@@ -221,6 +221,10 @@ private:
 
         // Total spent for senders putting data in the queue
         RuntimeProfile::Counter* wait_lock_timer = nullptr;
+        // Total time the chunks stay in the queue before they are consumed
+        RuntimeProfile::Counter* queue_wait_timer = nullptr;
+        // Number of received chunks merged into the previous chunk of the same request
+        RuntimeProfile::Counter* merged_chunk_counter = nullptr;
 
         RuntimeProfile::Counter* buffer_unplug_counter = nullptr;
         RuntimeProfile::HighWaterMarkCounter* peak_buffer_mem_bytes = nullptr;
@@ -247,6 +251,8 @@ private:
     PassThroughContext _pass_through_context;
 
     int _encode_level;
+    // Target number of rows of the chunks merged on receiving.
+    int _chunk_size;
     bool _closed = false;
 };
 
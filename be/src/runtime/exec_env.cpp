@@ -83,6 +83,7 @@
 #include "storage/lake/tablet_manager.h"
 #include "storage/lake/update_manager.h"
 #include "storage/page_cache.h"
+#include "storage/row_cache.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_schema_map.h"
 #include "storage/update_manager.h"
@@ -228,6 +229,7 @@ Status GlobalEnv::_init_mem_tracker() {
     _schema_change_mem_tracker = regist_tracker(-1, "schema_change", _process_mem_tracker.get());
     _column_pool_mem_tracker = regist_tracker(-1, "column_pool", _process_mem_tracker.get());
     _page_cache_mem_tracker = regist_tracker(-1, "page_cache", _process_mem_tracker.get());
+    _row_cache_mem_tracker = regist_tracker(-1, "row_cache", _process_mem_tracker.get());
     _jit_cache_mem_tracker = regist_tracker(-1, "jit_cache", _process_mem_tracker.get());
     int32_t update_mem_percent = std::max(std::min(100, config::update_memory_limit_percent), 0);
     _update_mem_tracker = regist_tracker(bytes_limit * update_mem_percent / 100, "update", nullptr);
@@ -237,12 +239,14 @@ Status GlobalEnv::_init_mem_tracker() {
     _consistency_mem_tracker = regist_tracker(consistency_mem_limit, "consistency", _process_mem_tracker.get());
     _datacache_mem_tracker = regist_tracker(-1, "datacache", _process_mem_tracker.get());
     _replication_mem_tracker = regist_tracker(-1, "replication", _process_mem_tracker.get());
+    _s3_upload_buffer_mem_tracker = regist_tracker(-1, "s3_upload_buffer", _process_mem_tracker.get());
 
     MemChunkAllocator::init_instance(_chunk_allocator_mem_tracker.get(), config::chunk_reserved_bytes_limit);
 
     SetMemTrackerForColumnPool op(_column_pool_mem_tracker);
     ForEach<ColumnPoolList>(op);
     _init_storage_page_cache(); // TODO: move to StorageEngine
+    RowCache::create_global_cache(row_cache_mem_tracker(), std::max<int64_t>(config::row_cache_capacity, 0));
     return Status::OK();
 }
 
@@ -255,7 +259,8 @@ void GlobalEnv::_reset_tracker() {
 void GlobalEnv::_init_storage_page_cache() {
     int64_t storage_cache_limit = get_storage_page_cache_size();
     storage_cache_limit = check_storage_page_cache_size(storage_cache_limit);
-    StoragePageCache::create_global_cache(page_cache_mem_tracker(), storage_cache_limit);
+    StoragePageCache::create_global_cache(page_cache_mem_tracker(), storage_cache_limit,
+                                          get_storage_page_cache_compressed_size());
 }
 
 int64_t GlobalEnv::get_storage_page_cache_size() {
@@ -266,6 +271,18 @@ int64_t GlobalEnv::get_storage_page_cache_size() {
     return ParseUtil::parse_mem_spec(config::storage_page_cache_limit.value(), mem_limit);
 }
 
+int64_t GlobalEnv::get_storage_page_cache_compressed_size() {
+    if (config::disable_storage_page_cache) {
+        return 0;
+    }
+    int64_t mem_limit = MemInfo::physical_mem();
+    if (process_mem_tracker()->has_limit()) {
+        mem_limit = process_mem_tracker()->limit();
+    }
+    int64_t limit = ParseUtil::parse_mem_spec(config::storage_page_cache_compressed_limit.value(), mem_limit);
+    return limit > 0 ? limit : 0;
+}
+
 int64_t GlobalEnv::check_storage_page_cache_size(int64_t storage_cache_limit) {
     if (storage_cache_limit > MemInfo::physical_mem()) {
         LOG(WARNING) << "Config storage_page_cache_limit is greater than memory size, config="
@@ -391,6 +408,24 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_dictionary_cache_pool));
 
+    RETURN_IF_ERROR(ThreadPoolBuilder("lake_read_prefetch") // thread pool for reading segments ahead
+                            .set_min_threads(0)
+                            .set_max_threads(config::io_coalesce_lake_read_prefetch_thread_num)
+                            .set_max_queue_size(1000)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_lake_read_prefetch_pool));
+
+    int hash_join_build_threads = config::hash_join_build_thread_num;
+    if (hash_join_build_threads <= 0) {
+        hash_join_build_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("hash_join_build") // thread pool for building partitioned hash tables
+                            .set_min_threads(0)
+                            .set_max_threads(hash_join_build_threads)
+                            .set_max_queue_size(1000)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_hash_join_build_pool));
+
     std::unique_ptr<ThreadPool> driver_executor_thread_pool;
     _max_executor_threads = CpuInfo::num_cores();
     if (config::pipeline_exec_thread_pool_thread_num > 0) {
@@ -548,6 +583,7 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
     _heartbeat_flags = new HeartbeatFlags();
     auto capacity = std::max<size_t>(config::query_cache_capacity, 4L * 1024 * 1024);
     _cache_mgr = new query_cache::CacheManager(capacity);
+    _ht_size_hints = new query_cache::HashTableSizeHints(std::max<size_t>(config::hash_table_size_hints_capacity, 1));
 
     _block_cache = BlockCache::instance();
 
@@ -657,6 +693,14 @@ void ExecEnv::stop() {
         _dictionary_cache_pool->shutdown();
     }
 
+    if (_lake_read_prefetch_pool) {
+        _lake_read_prefetch_pool->shutdown();
+    }
+
+    if (_hash_join_build_pool) {
+        _hash_join_build_pool->shutdown();
+    }
+
 #ifndef BE_TEST
     close_s3_clients();
 #endif
@@ -713,7 +757,10 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_lake_update_manager);
     SAFE_DELETE(_lake_replication_txn_manager);
     SAFE_DELETE(_cache_mgr);
+    SAFE_DELETE(_ht_size_hints);
     _dictionary_cache_pool.reset();
+    _lake_read_prefetch_pool.reset();
+    _hash_join_build_pool.reset();
     _automatic_partition_pool.reset();
     _metrics = nullptr;
 }
@@ -40,6 +40,7 @@
 
 #include "common/status.h"
 #include "exec/query_cache/cache_manager.h"
+#include "exec/query_cache/ht_size_hints.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "runtime/base_load_path_mgr.h"
 #include "storage/options.h"
@@ -141,6 +142,7 @@ public:
     MemTracker* schema_change_mem_tracker() { return _schema_change_mem_tracker.get(); }
     MemTracker* column_pool_mem_tracker() { return _column_pool_mem_tracker.get(); }
     MemTracker* page_cache_mem_tracker() { return _page_cache_mem_tracker.get(); }
+    MemTracker* row_cache_mem_tracker() { return _row_cache_mem_tracker.get(); }
     MemTracker* jit_cache_mem_tracker() { return _jit_cache_mem_tracker.get(); }
     MemTracker* update_mem_tracker() { return _update_mem_tracker.get(); }
     MemTracker* chunk_allocator_mem_tracker() { return _chunk_allocator_mem_tracker.get(); }
@@ -148,10 +150,12 @@ public:
     MemTracker* consistency_mem_tracker() { return _consistency_mem_tracker.get(); }
     MemTracker* replication_mem_tracker() { return _replication_mem_tracker.get(); }
     MemTracker* datacache_mem_tracker() { return _datacache_mem_tracker.get(); }
+    MemTracker* s3_upload_buffer_mem_tracker() { return _s3_upload_buffer_mem_tracker.get(); }
     std::vector<std::shared_ptr<MemTracker>>& mem_trackers() { return _mem_trackers; }
 
     int64_t get_storage_page_cache_size();
     int64_t check_storage_page_cache_size(int64_t storage_cache_limit);
+    int64_t get_storage_page_cache_compressed_size();
     static int64_t calc_max_query_memory(int64_t process_mem_limit, int64_t percent);
 
 private:
@@ -205,6 +209,9 @@ private:
     // The memory used for page cache
     std::shared_ptr<MemTracker> _page_cache_mem_tracker;
 
+    // The memory used for row cache
+    std::shared_ptr<MemTracker> _row_cache_mem_tracker;
+
     // The memory used for jit cache
     std::shared_ptr<MemTracker> _jit_cache_mem_tracker;
 
@@ -222,6 +229,9 @@ private:
     // The memory used for datacache
     std::shared_ptr<MemTracker> _datacache_mem_tracker;
 
+    // The memory of the part buffers of S3OutputStream, both in use and cached for reuse
+    std::shared_ptr<MemTracker> _s3_upload_buffer_mem_tracker;
+
     std::vector<std::shared_ptr<MemTracker>> _mem_trackers;
 };
 
@@ -279,6 +289,8 @@ public:
     PriorityThreadPool* query_rpc_pool() { return _query_rpc_pool; }
     ThreadPool* load_rpc_pool() { return _load_rpc_pool.get(); }
     ThreadPool* dictionary_cache_pool() { return _dictionary_cache_pool.get(); }
+    ThreadPool* lake_read_prefetch_pool() { return _lake_read_prefetch_pool.get(); }
+    ThreadPool* hash_join_build_pool() { return _hash_join_build_pool.get(); }
     FragmentMgr* fragment_mgr() { return _fragment_mgr; }
     starrocks::pipeline::DriverExecutor* wg_driver_executor() { return _wg_driver_executor; }
     BaseLoadPathMgr* load_path_mgr() { return _load_path_mgr; }
@@ -329,6 +341,8 @@ public:
 
     query_cache::CacheManagerRawPtr cache_mgr() const { return _cache_mgr; }
 
+    query_cache::HashTableSizeHintsRawPtr ht_size_hints() const { return _ht_size_hints; }
+
     BlockCache* block_cache() const { return _block_cache; }
 
     spill::DirManager* spill_dir_mgr() const { return _spill_dir_mgr.get(); }
@@ -364,6 +378,8 @@ private:
     PriorityThreadPool* _query_rpc_pool = nullptr;
     std::unique_ptr<ThreadPool> _load_rpc_pool;
     std::unique_ptr<ThreadPool> _dictionary_cache_pool;
+    std::unique_ptr<ThreadPool> _lake_read_prefetch_pool;
+    std::unique_ptr<ThreadPool> _hash_join_build_pool;
     FragmentMgr* _fragment_mgr = nullptr;
     pipeline::QueryContextManager* _query_context_mgr = nullptr;
     pipeline::DriverExecutor* _wg_driver_executor = nullptr;
@@ -401,6 +417,7 @@ private:
 
     AgentServer* _agent_server = nullptr;
     query_cache::CacheManagerRawPtr _cache_mgr;
+    query_cache::HashTableSizeHintsRawPtr _ht_size_hints = nullptr;
     BlockCache* _block_cache = nullptr;
     std::shared_ptr<spill::DirManager> _spill_dir_mgr;
 };
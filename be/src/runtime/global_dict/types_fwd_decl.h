@@ -46,4 +46,7 @@ using DictColumnsValidMap = phmap::flat_hash_map<std::string, bool, SliceHashWit
 
 using ColumnIdToGlobalDictMap = phmap::flat_hash_map<uint32_t, GlobalDictMap*>;
 
+// column-id -> version of GlobalDictMap
+using ColumnIdToGlobalDictVersion = phmap::flat_hash_map<uint32_t, int64_t>;
+
 } // namespace starrocks
@@ -40,12 +40,15 @@ public:
         DCHECK_GE(physical_bytes, 0);
         CurrentThread::current().mem_release(physical_bytes);
 
-        std::unique_lock lock(_mutex);
-        _buffer.emplace_back(std::make_pair(std::move(clone), driver_sequence));
-        _bytes.push_back(chunk_size);
-        _physical_bytes += physical_bytes;
-        _total_bytes += physical_bytes;
+        _append(std::move(clone), chunk_size, physical_bytes, driver_sequence);
     }
+
+    void append_chunk(ChunkUniquePtr chunk, size_t chunk_size, int64_t physical_bytes, int32_t driver_sequence) {
+        // The chunk was allocated in current MemTracker, transfer it to the MemTracker of the receiver
+        CurrentThread::current().mem_release(physical_bytes);
+        _append(std::move(chunk), chunk_size, physical_bytes, driver_sequence);
+    }
+
     void pull_chunks(ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes) {
         std::unique_lock lock(_mutex);
         chunks->swap(_buffer);
@@ -58,6 +61,14 @@ public:
     }
 
 private:
+    void _append(ChunkUniquePtr chunk, size_t chunk_size, int64_t physical_bytes, int32_t driver_sequence) {
+        std::unique_lock lock(_mutex);
+        _buffer.emplace_back(std::make_pair(std::move(chunk), driver_sequence));
+        _bytes.push_back(chunk_size);
+        _physical_bytes += physical_bytes;
+        _total_bytes += physical_bytes;
+    }
+
     std::mutex _mutex; // lock-step to push/pull chunks
     ChunkUniquePtrVector _buffer;
     std::vector<size_t> _bytes;
@@ -128,6 +139,11 @@ void PassThroughContext::append_chunk(int sender_id, const Chunk* chunk, size_t
     PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
     sender_channel->append_chunk(chunk, chunk_size, driver_sequence);
 }
+void PassThroughContext::append_chunk(int sender_id, ChunkUniquePtr chunk, size_t chunk_size, int64_t physical_bytes,
+                                      int32_t driver_sequence) {
+    PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
+    sender_channel->append_chunk(std::move(chunk), chunk_size, physical_bytes, driver_sequence);
+}
 void PassThroughContext::pull_chunks(int sender_id, ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes) {
     PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
     sender_channel->pull_chunks(chunks, bytes);
@@ -61,6 +61,10 @@ public:
             : _chunk_buffer(chunk_buffer), _fragment_instance_id(fragment_instance_id), _node_id(node_id) {}
     void init();
     void append_chunk(int sender_id, const Chunk* chunk, size_t chunk_size, int32_t driver_sequence);
+    // The chunk is handed over to the receiver without being cloned, together with the |physical_bytes|
+    // allocated for it in the current MemTracker.
+    void append_chunk(int sender_id, ChunkUniquePtr chunk, size_t chunk_size, int64_t physical_bytes,
+                      int32_t driver_sequence);
     void pull_chunks(int sender_id, ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes);
     int64_t total_bytes() const;
 
@@ -16,6 +16,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <unordered_map>
@@ -449,10 +450,34 @@ void LocalTabletsChannel::_flush_stale_memtables() {
         }
     }
 
+    // when full mem usage, the bytes to flush to bring the memory usage back to the high watermark
+    int64_t full_mem_reduce_bytes = 0;
+    if (full_mem_usage) {
+        for (MemTracker* tracker : {_mem_tracker, _mem_tracker->parent()}) {
+            if (tracker != nullptr && tracker->has_limit()) {
+                full_mem_reduce_bytes =
+                        std::max(full_mem_reduce_bytes, tracker->consumption() - tracker->limit() * 70 / 100);
+            }
+        }
+    }
+
     int64_t now = butil::gettimeofday_s();
     int64_t total_flush_bytes = 0;
     int64_t total_flush_writer = 0;
     int64_t total_active_writer = 0;
+    // memtables large enough to be flushed when full mem usage
+    std::vector<std::pair<int64_t, AsyncDeltaWriter*>> flush_candidates;
+    auto flush_writer = [&](int64_t tablet_id, AsyncDeltaWriter* writer, int64_t last_write_ts) {
+        VLOG(1) << "Flush stale memtable tablet_id: " << tablet_id << " txn_id: " << _txn_id
+                << " partition_id: " << writer->partition_id() << " is_immutable: " << writer->is_immutable()
+                << " write_buffer_size: " << writer->write_buffer_size() << " stale_time: " << now - last_write_ts
+                << " job_mem_usage: " << _mem_tracker->consumption() << " job_mem_limit: " << _mem_tracker->limit()
+                << " load_mem_usage: " << _mem_tracker->parent()->consumption()
+                << " load_mem_limit: " << _mem_tracker->parent()->limit();
+        total_flush_bytes += writer->write_buffer_size();
+        ++total_flush_writer;
+        writer->flush();
+    };
     for (auto& [tablet_id, writer] : _delta_writers) {
         bool need_flush = false;
         auto last_write_ts = writer->last_write_ts();
@@ -472,27 +497,30 @@ void LocalTabletsChannel::_flush_stale_memtables() {
                 if (high_mem_usage && now - last_write_ts > config::stale_memtable_flush_time_sec) {
                     need_flush = true;
                 }
-                // when full mem usage, flush all memtable which size is larger than 1/4 of write_buffer_size
-                if (full_mem_usage && writer->write_buffer_size() > config::write_buffer_size / 4) {
-                    need_flush = true;
+                // when full mem usage, memtable which size is larger than 1/4 of write_buffer_size may be flushed
+                if (!need_flush && full_mem_usage && writer->write_buffer_size() > config::write_buffer_size / 4) {
+                    flush_candidates.emplace_back(tablet_id, writer.get());
                 }
             }
             // has write means active writer
             ++total_active_writer;
             if (need_flush) {
-                VLOG(1) << "Flush stale memtable tablet_id: " << tablet_id << " txn_id: " << _txn_id
-                        << " partition_id: " << writer->partition_id() << " is_immutable: " << writer->is_immutable()
-                        << " write_buffer_size: " << writer->write_buffer_size()
-                        << " stale_time: " << now - last_write_ts << " job_mem_usage: " << _mem_tracker->consumption()
-                        << " job_mem_limit: " << _mem_tracker->limit()
-                        << " load_mem_usage: " << _mem_tracker->parent()->consumption()
-                        << " load_mem_limit: " << _mem_tracker->parent()->limit();
-                total_flush_bytes += writer->write_buffer_size();
-                ++total_flush_writer;
-                writer->flush();
+                flush_writer(tablet_id, writer.get(), last_write_ts);
             }
         }
     }
+    // flush the largest memtables first and only as many as needed, rather than all the candidates,
+    // so that the memory is released by fewer and larger segments
+    std::sort(flush_candidates.begin(), flush_candidates.end(),
+              [](const auto& lhs, const auto& rhs) {
+                  return lhs.second->write_buffer_size() > rhs.second->write_buffer_size();
+              });
+    for (auto& [tablet_id, writer] : flush_candidates) {
+        if (total_flush_bytes >= full_mem_reduce_bytes) {
+            break;
+        }
+        flush_writer(tablet_id, writer, writer->last_write_ts());
+    }
 
     if (total_flush_bytes > 0 || total_flush_writer > 0) {
         LOG(INFO) << "Flush stale memtable txn_id: " << _txn_id << " total_flush_bytes: " << total_flush_bytes
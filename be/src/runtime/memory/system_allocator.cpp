@@ -36,6 +36,7 @@
 
 #include <sys/mman.h>
 
+#include <cerrno>
 #include <cstdlib>
 
 #include "common/config.h"
@@ -44,7 +45,8 @@
 
 namespace starrocks {
 
-#define PAGE_SIZE (4 * 1024) // 4K
+#define PAGE_SIZE (4 * 1024)              // 4K
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024) // 2M
 
 uint8_t* SystemAllocator::allocate(MemTracker* mem_tracker, size_t length) {
     if (config::use_mmap_allocate_chunk) {
@@ -68,6 +70,24 @@ void SystemAllocator::free(MemTracker* mem_tracker, uint8_t* ptr, size_t length)
     }
 }
 
+size_t SystemAllocator::advise_huge_pages(void* ptr, size_t length) {
+    if (!config::madvise_huge_pages || length < HUGE_PAGE_SIZE) {
+        return 0;
+    }
+    auto begin = reinterpret_cast<uintptr_t>(ptr);
+    uintptr_t aligned_begin = (begin + HUGE_PAGE_SIZE - 1) & ~static_cast<uintptr_t>(HUGE_PAGE_SIZE - 1);
+    uintptr_t aligned_end = (begin + length) & ~static_cast<uintptr_t>(HUGE_PAGE_SIZE - 1);
+    if (aligned_end <= aligned_begin) {
+        return 0;
+    }
+    size_t advised = aligned_end - aligned_begin;
+    if (madvise(reinterpret_cast<void*>(aligned_begin), advised, MADV_HUGEPAGE) != 0) {
+        VLOG(2) << "fail to madvise huge pages, errno=" << errno;
+        return 0;
+    }
+    return advised;
+}
+
 uint8_t* SystemAllocator::allocate_via_malloc(size_t length) {
     void* ptr = nullptr;
     // try to use a whole page instead of parts of one page
@@ -85,6 +105,7 @@ uint8_t* SystemAllocator::allocate_via_mmap(MemTracker* mem_tracker, size_t leng
         PLOG(ERROR) << "fail to allocate memory via mmap";
         return nullptr;
     }
+    advise_huge_pages(ptr, length);
     if (mem_tracker != nullptr) {
         mem_tracker->consume(length);
     }
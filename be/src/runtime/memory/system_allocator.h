@@ -49,6 +49,12 @@ public:
 
     static void free(MemTracker* mem_tracker, uint8_t* ptr, size_t length);
 
+    // Advise the kernel to back the 2MB aligned part of [ptr, ptr + length) with transparent huge pages when
+    // config::madvise_huge_pages is enabled. It should be called before the memory is touched. Returns the
+    // number of bytes advised, 0 if the range is too small or the advice is rejected, in which case the memory
+    // just stays on normal pages.
+    static size_t advise_huge_pages(void* ptr, size_t length);
+
 private:
     static uint8_t* allocate_via_mmap(MemTracker* mem_tracker, size_t length);
     static uint8_t* allocate_via_malloc(size_t length);
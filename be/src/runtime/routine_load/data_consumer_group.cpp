@@ -137,6 +137,16 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
         }
     }
 
+    // Messages are taken from the queue in batches to save lock handoffs with the consumer threads,
+    // the ones left when the group stops are not committed and will be consumed by the next task.
+    std::vector<RdKafka::Message*> msgs;
+    size_t msg_idx = 0;
+    DeferOp release_msgs([&] {
+        for (size_t i = msg_idx; i < msgs.size(); ++i) {
+            delete msgs[i];
+        }
+    });
+
     MonotonicStopWatch watch;
     watch.start();
     bool eos = false;
@@ -192,9 +202,13 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
             }
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
-        if (res) {
+        if (msg_idx == msgs.size()) {
+            msgs.clear();
+            msg_idx = 0;
+            _queue.blocking_get_batch(&msgs, kMaxMessageBatchSize);
+        }
+        if (msg_idx < msgs.size()) {
+            RdKafka::Message* msg = msgs[msg_idx++];
             VLOG(3) << "get kafka message"
                     << ", partition: " << msg->partition() << ", offset: " << msg->offset() << ", len: " << msg->len();
             DeferOp msgDeleter([&] { delete msg; });
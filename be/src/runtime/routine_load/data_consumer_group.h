@@ -94,6 +94,9 @@ private:
                         int64_t max_running_time_ms, const ConsumeFinishCallback& cb);
 
 private:
+    // the maximum number of msgs taken from the queue at a time
+    static constexpr size_t kMaxMessageBatchSize = 64;
+
     // blocking queue to receive msgs from all consumers
     TimedBlockingQueue<RdKafka::Message*> _queue;
 };
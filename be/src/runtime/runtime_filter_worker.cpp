@@ -280,6 +280,7 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
         // something wrong with deserialization.
         return;
     }
+    const bool could_use_bf = status->can_use_bf;
     if (!rf->can_use_bf()) {
         VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. some partial rf's size exceeds "
                      "global_runtime_filter_build_max_size, stop building bf and only reserve min/max filter";
@@ -295,6 +296,18 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
         status->can_use_bf = false;
     }
 
+    // The total rf only keeps min/max filter once it can't use bf, so release the bf of the partial rfs as soon as
+    // possible rather than holding all of them until the last one arrives.
+    if (!status->can_use_bf) {
+        if (could_use_bf) {
+            VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter, clear bf in all filters";
+            for (auto& [_, arrived_rf] : status->filters) {
+                arrived_rf->clear_bf();
+            }
+        }
+        rf->clear_bf();
+    }
+
     VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. assembled filter_id = " << filter_id
               << ", be_number = " << be_number;
     status->arrives.insert(be_number);
@@ -302,12 +315,6 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
 
     // not ready. still have to wait more filters.
     if (status->filters.size() < status->expect_number) return;
-    if (!status->can_use_bf) {
-        VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter, clear bf in all filters";
-        for (auto& [be_number, rf] : status->filters) {
-            rf->clear_bf();
-        }
-    }
     _send_total_runtime_filter(rf_version, filter_id);
 }
 
@@ -365,6 +372,9 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
     for (auto it : status->filters) {
         out->concat(it.second);
     }
+    if (config::runtime_filter_bloom_fold_max_fpp > 0 && out->can_use_bf()) {
+        out->fold_bf(config::runtime_filter_bloom_fold_max_fpp);
+    }
     // if well enough, then we send it out.
 
     PTransmitRuntimeFilterParams request;
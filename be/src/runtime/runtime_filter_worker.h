@@ -71,6 +71,7 @@ public:
               current_size(other.current_size),
               max_size(other.max_size),
               stop(other.stop),
+              can_use_bf(other.can_use_bf),
               recv_first_filter_ts(other.recv_first_filter_ts),
               recv_last_filter_ts(other.recv_last_filter_ts),
               broadcast_filter_ts(other.broadcast_filter_ts) {}
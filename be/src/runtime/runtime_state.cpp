@@ -465,6 +465,11 @@ DictOptimizeParser* RuntimeState::mutable_dict_optimize_parser() {
 
 Status RuntimeState::init_query_global_dict(const GlobalDictLists& global_dict_list) {
     RETURN_IF_ERROR(_build_global_dict(global_dict_list, &_query_global_dicts, nullptr));
+    for (const auto& global_dict : global_dict_list) {
+        if (global_dict.__isset.version) {
+            _query_dict_versions.emplace(uint32_t(global_dict.columnId), global_dict.version);
+        }
+    }
     _dict_optimize_parser.set_mutable_dict_maps(this, &_query_global_dicts);
     return Status::OK();
 }
@@ -381,6 +381,9 @@ public:
     bool enable_nl_join_spill() const {
         return _query_options.spillable_operator_mask & (1LL << TSpillableOperatorType::NL_JOIN);
     }
+    bool enable_set_operation_spill() const {
+        return _query_options.spillable_operator_mask & (1LL << TSpillableOperatorType::SET_OPERATION);
+    }
 
     int32_t spill_mem_table_size() const { return _query_options.spill_mem_table_size; }
 
@@ -451,6 +454,9 @@ public:
 
     const phmap::flat_hash_map<uint32_t, int64_t>& load_dict_versions() { return _load_dict_versions; }
 
+    // slot id -> version of the query global dict, only for the dicts with a version
+    const phmap::flat_hash_map<uint32_t, int64_t>& query_dict_versions() const { return _query_dict_versions; }
+
     using GlobalDictLists = std::vector<TGlobalDict>;
     [[nodiscard]] Status init_query_global_dict(const GlobalDictLists& global_dict_list);
     [[nodiscard]] Status init_load_global_dict(const GlobalDictLists& global_dict_list);
@@ -635,6 +641,7 @@ private:
     GlobalDictMaps _query_global_dicts;
     GlobalDictMaps _load_global_dicts;
     phmap::flat_hash_map<uint32_t, int64_t> _load_dict_versions;
+    phmap::flat_hash_map<uint32_t, int64_t> _query_dict_versions;
     DictOptimizeParser _dict_optimize_parser;
 
     pipeline::QueryContext* _query_ctx = nullptr;
@@ -17,6 +17,7 @@
 #include <atomic>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "gen_cpp/data.pb.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "runtime/current_thread.h"
@@ -470,6 +471,7 @@ Status DataStreamRecvr::PipelineSenderQueue::get_chunk(Chunk** chunk, const int3
         }
     });
 
+    COUNTER_UPDATE(metrics.queue_wait_timer, MonotonicNanos() - item.receive_time);
     if (item.chunk_ptr == nullptr) {
         ChunkUniquePtr chunk_ptr = std::make_unique<Chunk>();
         faststring uncompressed_buffer;
@@ -508,6 +510,7 @@ bool DataStreamRecvr::PipelineSenderQueue::try_get_chunk(Chunk** chunk) {
         return false;
     }
     DCHECK(item.chunk_ptr != nullptr);
+    COUNTER_UPDATE(metrics.queue_wait_timer, MonotonicNanos() - item.receive_time);
     *chunk = item.chunk_ptr.release();
     VLOG_ROW << "DataStreamRecvr fetched #rows=" << (*chunk)->num_rows();
     auto* closure = item.closure;
@@ -690,6 +693,22 @@ StatusOr<DataStreamRecvr::PipelineSenderQueue::ChunkList> DataStreamRecvr::Pipel
     return chunks;
 }
 
+void DataStreamRecvr::PipelineSenderQueue::merge_small_chunks(ChunkList& chunks, Metrics& metrics) {
+    const size_t chunk_size = _recvr->_chunk_size;
+    auto prev = chunks.end();
+    for (auto iter = chunks.begin(); iter != chunks.end();) {
+        if (prev != chunks.end() && prev->driver_sequence == iter->driver_sequence &&
+            prev->chunk_ptr->num_rows() + iter->chunk_ptr->num_rows() <= chunk_size) {
+            prev->chunk_ptr->append(*iter->chunk_ptr);
+            prev->chunk_bytes += iter->chunk_bytes;
+            COUNTER_UPDATE(metrics.merged_chunk_counter, 1);
+            chunks.erase(iter++);
+            continue;
+        }
+        prev = iter++;
+    }
+}
+
 template <bool keep_order>
 Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkParams& request, Metrics& metrics,
                                                         ::google::protobuf::Closure** done) {
@@ -713,12 +732,31 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
     // NOTE: in the merge scenario, chunk is obtained through try_get_chunk and its return type is not Status.
     // there is no chance to handle deserialize error, so the lazy deserialization is not supported now,
     // we can change related interface's defination to do this later.
+    // Otherwise, the chunks are deserialized here on the brpc thread as long as the buffer has room for them,
+    // so that the consumer drivers don't have to, and the small ones are merged.
+    bool eager_deserialization = false;
+    if (!keep_order && !use_pass_through && config::exchange_receiver_eager_deserialize) {
+        size_t request_bytes = 0;
+        for (const auto& pchunk : request.chunks()) {
+            request_bytes += pchunk.data().size();
+        }
+        eager_deserialization = !_recvr->exceeds_limit(request_bytes);
+    }
     ChunkList chunks;
-    ASSIGN_OR_RETURN(chunks,
-                     use_pass_through
-                             ? get_chunks_from_pass_through(request.sender_id(), total_chunk_bytes)
-                             : (keep_order ? get_chunks_from_request<true>(request, metrics, total_chunk_bytes)
-                                           : get_chunks_from_request<false>(request, metrics, total_chunk_bytes)));
+    if (use_pass_through) {
+        ASSIGN_OR_RETURN(chunks, get_chunks_from_pass_through(request.sender_id(), total_chunk_bytes));
+    } else if (keep_order || eager_deserialization) {
+        ASSIGN_OR_RETURN(chunks, get_chunks_from_request<true>(request, metrics, total_chunk_bytes));
+    } else {
+        ASSIGN_OR_RETURN(chunks, get_chunks_from_request<false>(request, metrics, total_chunk_bytes));
+    }
+    if (eager_deserialization) {
+        merge_small_chunks(chunks, metrics);
+    }
+    const int64_t receive_time = MonotonicNanos();
+    for (auto& item : chunks) {
+        item.receive_time = receive_time;
+    }
     COUNTER_UPDATE(use_pass_through ? metrics.bytes_pass_through_counter : metrics.bytes_received_counter,
                    total_chunk_bytes);
 
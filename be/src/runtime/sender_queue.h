@@ -20,6 +20,7 @@
 #include "column/vectorized_fwd.h"
 #include "runtime/data_stream_recvr.h"
 #include "serde/protobuf_serde.h"
+#include "util/instrumented_mutex.h"
 #include "util/moodycamel/concurrentqueue.h"
 #include "util/spinlock.h"
 
@@ -192,6 +193,8 @@ private:
         ChunkPB pchunk;
         // Time in nano of saving closure
         int64_t queue_enter_time = -1;
+        // Time in nano of receiving the chunk
+        int64_t receive_time = 0;
 
         ChunkItem() = default;
 
@@ -221,6 +224,10 @@ private:
     StatusOr<ChunkList> get_chunks_from_request(const PTransmitChunkParams& request, Metrics& metrics,
                                                 size_t& total_chunk_bytes);
 
+    // Append the deserialized chunks of a request to the previous chunk of the same driver sequence,
+    // as long as the result has at most chunk_size rows.
+    void merge_small_chunks(ChunkList& chunks, Metrics& metrics);
+
     Status try_to_build_chunk_meta(const PTransmitChunkParams& request, Metrics& metrics);
 
     template <bool keep_order>
@@ -231,8 +238,8 @@ private:
     std::atomic<bool> _is_cancelled{false};
     std::atomic<int> _num_remaining_senders;
 
-    typedef SpinLock Mutex;
-    Mutex _lock;
+    typedef InstrumentedMutex<SpinLock> Mutex;
+    Mutex _lock{LOCK_SITE("DataStreamRecvr::PipelineSenderQueue")};
 
     // if _is_pipeline_level_shuffle=true, we will create a queue for each driver sequence to avoid competition
     // otherwise, we will only use the first item
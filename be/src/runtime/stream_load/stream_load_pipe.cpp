@@ -153,15 +153,15 @@ Status StreamLoadPipe::read(uint8_t* data, size_t* data_size, bool* eof) {
             }
             _read_buf = _buf_queue.front();
             _buf_queue.pop_front();
+            // The buffer leaves the queue now, release its bytes under the lock so that the producer can
+            // refill the pipe while the buffer is being copied out.
+            _buffered_bytes -= _read_buf->remaining();
+            _put_cond.notify_one();
         }
 
         size_t copy_size = std::min(*data_size - bytes_read, _read_buf->remaining());
         _read_buf->get_bytes((char*)data + bytes_read, copy_size);
         bytes_read += copy_size;
-        if (!_read_buf->has_remaining()) {
-            _buffered_bytes -= _read_buf->limit;
-            _put_cond.notify_one();
-        }
     }
     DCHECK(bytes_read == *data_size) << "bytes_read=" << bytes_read << ", *data_size=" << *data_size;
     *eof = false;
@@ -205,15 +205,15 @@ Status StreamLoadPipe::no_block_read(uint8_t* data, size_t* data_size, bool* eof
             }
             _read_buf = _buf_queue.front();
             _buf_queue.pop_front();
+            // The buffer leaves the queue now, release its bytes under the lock so that the producer can
+            // refill the pipe while the buffer is being copied out.
+            _buffered_bytes -= _read_buf->remaining();
+            _put_cond.notify_one();
         }
 
         size_t copy_size = std::min(*data_size - bytes_read, _read_buf->remaining());
         _read_buf->get_bytes((char*)data + bytes_read, copy_size);
         bytes_read += copy_size;
-        if (!_read_buf->has_remaining()) {
-            _buffered_bytes -= _read_buf->limit;
-            _put_cond.notify_one();
-        }
     }
     DCHECK(bytes_read == *data_size) << "bytes_read=" << bytes_read << ", *data_size=" << *data_size;
     *eof = false;
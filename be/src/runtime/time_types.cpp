@@ -14,6 +14,7 @@
 
 #include "runtime/time_types.h"
 
+#include <cstring>
 #include <string>
 
 #include "gutil/strings/substitute.h"
@@ -306,21 +307,46 @@ bool date::from_string(const char* date_str, size_t len, int* year, int* month,
 // Get date base on format "%Y-%m-%d", where '-' means any char.
 // compare every char.
 // Note that this method does not check whether the parsed year, month, and day are in valid range.
+// The fixed "%Y-%m-%d" and "%H:%i:%s" parts are validated and parsed 8 bytes at a time (SWAR), the bytes are
+// loaded in little endian, so that the i-th char is the i-th byte. |mask| selects the digit bytes by 0xFF.
+static constexpr uint64_t kDateDigitsMask = 0x00FFFF00FFFFFFFFULL; // "YYYY-MM-"
+static constexpr uint64_t kTimeDigitsMask = 0xFFFF00FFFF00FFFFULL; // "HH:MM:SS"
+
+static inline uint64_t load_8_chars(const char* ptr) {
+    uint64_t v;
+    memcpy(&v, ptr, sizeof(v));
+    return v;
+}
+
+// A byte is a digit iff its high nibble is 3 and adding 6 to it doesn't carry into the high nibble.
+static inline bool are_digits(uint64_t v, uint64_t mask) {
+    const uint64_t high_nibbles = mask & 0xF0F0F0F0F0F0F0F0ULL;
+    const uint64_t expected = mask & 0x3030303030303030ULL;
+    return ((v & high_nibbles) == expected) & (((v + (mask & 0x0606060606060606ULL)) & high_nibbles) == expected);
+}
+
+// The i-th byte of the result is the 2-digit number of the i-th and (i+1)-th chars, if both are digits.
+static inline uint64_t to_2_digit_numbers(uint64_t v, uint64_t mask) {
+    const uint64_t digits = v & mask & 0x0F0F0F0F0F0F0F0FULL;
+    return digits * 10 + (digits >> 8);
+}
+
+static inline int byte_at(uint64_t v, int i) {
+    return static_cast<int>((v >> (i * 8)) & 0xFF);
+}
+
 bool date::from_string_to_date_internal(const char* ptr, int* pyear, int* pmonth, int* pday) {
-    const bool is_valid = isdigit(ptr[0]) && isdigit(ptr[1]) && isdigit(ptr[2]) && isdigit(ptr[3]) &&
-                          !isdigit(ptr[4]) && isdigit(ptr[5]) && isdigit(ptr[6]) && !isdigit(ptr[7]) &&
-                          isdigit(ptr[8]) && isdigit(ptr[9]);
+    const uint64_t v = load_8_chars(ptr);
+    const bool is_valid = are_digits(v, kDateDigitsMask) & !isdigit(ptr[4]) & !isdigit(ptr[7]) &
+                          (isdigit(ptr[8]) != 0) & (isdigit(ptr[9]) != 0);
     if (!is_valid) {
         return false;
     }
 
-    const int year = ptr[0] * 1000 + ptr[1] * 100 + ptr[2] * 10 + ptr[3] - static_cast<int>('0') * 1111;
-    const int month = ptr[5] * 10 + ptr[6] - static_cast<int>('0') * 11;
-    const int day = ptr[8] * 10 + ptr[9] - static_cast<int>('0') * 11;
-
-    *pyear = year;
-    *pmonth = month;
-    *pday = day;
+    const uint64_t numbers = to_2_digit_numbers(v, kDateDigitsMask);
+    *pyear = byte_at(numbers, 0) * 100 + byte_at(numbers, 2);
+    *pmonth = byte_at(numbers, 5);
+    *pday = ptr[8] * 10 + ptr[9] - static_cast<int>('0') * 11;
 
     return true;
 }
@@ -385,37 +411,18 @@ bool date::is_standard_datetime_format(const char* ptr, int length, const char**
 // else return false;
 bool date::from_string_to_datetime_internal(const char* ptr_date, const char* ptr_time, int* year, int* month, int* day,
                                             int* hour, int* minute, int* second, int* microsecond) {
-    uint8_t year1;
-    uint8_t year2;
-    uint8_t year3;
-    uint8_t year4;
-    uint8_t month1;
-    uint8_t month2;
-    uint8_t day1;
-    uint8_t day2;
-
-    uint8_t hour1;
-    uint8_t hour2;
-    uint8_t minute1;
-    uint8_t minute2;
-    uint8_t second1;
-    uint8_t second2;
-    if (char_to_digit(ptr_date, 0, &year1) || char_to_digit(ptr_date, 1, &year2) ||
-        char_to_digit(ptr_date, 2, &year3) || char_to_digit(ptr_date, 3, &year4) || isdigit(ptr_date[4]) ||
-        char_to_digit(ptr_date, 5, &month1) || char_to_digit(ptr_date, 6, &month2) || isdigit(ptr_date[7]) ||
-        char_to_digit(ptr_date, 8, &day1) || char_to_digit(ptr_date, 9, &day2) || char_to_digit(ptr_time, 0, &hour1) ||
-        char_to_digit(ptr_time, 1, &hour2) || isdigit(ptr_time[2]) || char_to_digit(ptr_time, 3, &minute1) ||
-        char_to_digit(ptr_time, 4, &minute2) || isdigit(ptr_time[5]) || char_to_digit(ptr_time, 6, &second1) ||
-        char_to_digit(ptr_time, 7, &second2)) {
+    if (!from_string_to_date_internal(ptr_date, year, month, day)) {
+        return false;
+    }
+    const uint64_t time_chars = load_8_chars(ptr_time);
+    if (!are_digits(time_chars, kTimeDigitsMask) || isdigit(ptr_time[2]) || isdigit(ptr_time[5])) {
         return false;
     }
 
-    *year = year1 * 1000 + year2 * 100 + year3 * 10 + year4;
-    *month = month1 * 10 + month2;
-    *day = day1 * 10 + day2;
-    *hour = hour1 * 10 + hour2;
-    *minute = minute1 * 10 + minute2;
-    *second = second1 * 10 + second2;
+    const uint64_t numbers = to_2_digit_numbers(time_chars, kTimeDigitsMask);
+    *hour = byte_at(numbers, 0);
+    *minute = byte_at(numbers, 3);
+    *second = byte_at(numbers, 6);
     *microsecond = 0;
     if (*month > 12 || (*day > DAYS_IN_MONTH[is_leap(*year)][*month]) || *hour > 23 || *minute > 59 || *second > 59) {
         return false;
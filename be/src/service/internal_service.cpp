@@ -178,26 +178,38 @@ void PInternalServiceImplBase<T>::_transmit_chunk(google::protobuf::RpcControlle
     });
     if (cntl->request_attachment().size() > 0) {
         butil::IOBuf& io_buf = cntl->request_attachment();
-        for (size_t i = 0; i < req->chunks().size(); ++i) {
-            auto chunk = req->mutable_chunks(i);
-            if (UNLIKELY(io_buf.size() < chunk->data_size())) {
-                auto msg = fmt::format("iobuf's size {} < {}", io_buf.size(), chunk->data_size());
-                LOG(WARNING) << msg;
-                st = Status::InternalError(msg);
-                return;
-            }
-            // also with copying due to the discontinuous memory in chunk
-            auto size = io_buf.cutn(chunk->mutable_data(), chunk->data_size());
-            if (UNLIKELY(size != chunk->data_size())) {
-                auto msg = fmt::format("iobuf read {} != expected {}.", size, chunk->data_size());
-                LOG(WARNING) << msg;
-                st = Status::InternalError(msg);
-                return;
+        auto cut_chunks = [&io_buf](PTransmitChunkParams* params) -> Status {
+            for (size_t i = 0; i < params->chunks().size(); ++i) {
+                auto chunk = params->mutable_chunks(i);
+                if (UNLIKELY(io_buf.size() < chunk->data_size())) {
+                    auto msg = fmt::format("iobuf's size {} < {}", io_buf.size(), chunk->data_size());
+                    LOG(WARNING) << msg;
+                    return Status::InternalError(msg);
+                }
+                // also with copying due to the discontinuous memory in chunk
+                auto size = io_buf.cutn(chunk->mutable_data(), chunk->data_size());
+                if (UNLIKELY(size != chunk->data_size())) {
+                    auto msg = fmt::format("iobuf read {} != expected {}.", size, chunk->data_size());
+                    LOG(WARNING) << msg;
+                    return Status::InternalError(msg);
+                }
             }
+            return Status::OK();
+        };
+        st = cut_chunks(req);
+        for (size_t i = 0; st.ok() && i < req->coalesced_requests_size(); ++i) {
+            st = cut_chunks(req->mutable_coalesced_requests(i));
+        }
+        if (!st.ok()) {
+            return;
         }
     }
 
-    st = _exec_env->stream_mgr()->transmit_chunk(*request, &wrapped_done);
+    if (request->coalesced_requests_size() == 0) {
+        st = _exec_env->stream_mgr()->transmit_chunk(*request, &wrapped_done);
+    } else {
+        st = _exec_env->stream_mgr()->transmit_coalesced_chunks(*request, &wrapped_done);
+    }
 }
 
 template <typename T>
@@ -43,10 +43,12 @@
 #include "http/action/greplog_action.h"
 #include "http/action/health_action.h"
 #include "http/action/lake/dump_tablet_metadata_action.h"
+#include "http/action/lock_stats_action.h"
 #include "http/action/memory_metrics_action.h"
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pipeline_blocking_drivers_action.h"
+#include "http/action/pipeline_sampling_profile_action.h"
 #include "http/action/pprof_actions.h"
 #include "http/action/query_cache_action.h"
 #include "http/action/reload_tablet_action.h"
@@ -271,6 +273,15 @@ Status HttpServiceBE::start() {
                                       pipeline_driver_poller_action);
     _http_handlers.emplace_back(pipeline_driver_poller_action);
 
+    auto* pipeline_sampling_profile_action = new PipelineSamplingProfileAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/pipeline_sampling_profile",
+                                      pipeline_sampling_profile_action);
+    _http_handlers.emplace_back(pipeline_sampling_profile_action);
+
+    auto* lock_stats_action = new LockStatsAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/lock_stats", lock_stats_action);
+    _http_handlers.emplace_back(lock_stats_action);
+
     auto* greplog_action = new GrepLogAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/greplog", greplog_action);
     _http_handlers.emplace_back(greplog_action);
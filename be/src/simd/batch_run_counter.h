@@ -22,6 +22,8 @@
 
 #ifdef __SSE2__
 #include <emmintrin.h>
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
 #include <cstdint>
@@ -95,6 +97,23 @@ public:
                 return BatchCount(16, 0, false);
             }
         }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+        if (batch_size >= 16 && _left >= 16) {
+            const uint8x16_t f = vld1q_u8(_filter + _offset);
+            const uint64_t mask = SIMD::get_nibble_mask(vtstq_u8(f, f));
+            _offset += 16;
+            _left -= 16;
+
+            if (mask == 0) {
+                // all zero
+                return BatchCount(16, 0, true);
+            } else if (mask == 0xffffffffffffffffULL) {
+                // all one
+                return BatchCount(16, 16, true);
+            } else {
+                return BatchCount(16, 0, false);
+            }
+        }
 #endif
 
         if (_left >= 8) {
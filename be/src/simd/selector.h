@@ -17,9 +17,12 @@
 #ifdef __AVX2__
 #include <emmintrin.h>
 #include <immintrin.h>
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 #include "column/type_traits.h"
@@ -216,6 +219,89 @@ inline void avx2_select_if_common_implement(uint8_t*& selector, T*& dst, const T
         }
     }
 }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+template <class T>
+constexpr bool could_use_neon_select_if() {
+    return sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8;
+}
+
+template <class T>
+inline uint8x16_t neon_set_data(T data) {
+    uint8_t buf[16];
+    for (int i = 0; i < 16; i += sizeof(T)) {
+        memcpy(buf + i, &data, sizeof(T));
+    }
+    return vld1q_u8(buf);
+}
+
+// implement int8/int16/int32/float/int64/double SIMD select_if, 16 rows per loop.
+// The byte mask of the selector is sign extended to the width of T, so that one
+// mask vector lines up with every 16-byte vector of data.
+template <typename T, bool left_const = false, bool right_const = false>
+inline void neon_select_if(uint8_t*& selector, T*& dst, const T*& a, const T*& b, int size) {
+    const T* dst_end = dst + size;
+    constexpr int data_size = sizeof(T);
+
+    [[maybe_unused]] uint8x16_t const_a;
+    [[maybe_unused]] uint8x16_t const_b;
+    if constexpr (left_const) {
+        const_a = neon_set_data(*a);
+    }
+    if constexpr (right_const) {
+        const_b = neon_set_data(*b);
+    }
+
+    while (dst + 16 <= dst_end) {
+        const uint8x16_t loaded = vld1q_u8(selector);
+        int8x16_t masks[data_size];
+        masks[0] = vreinterpretq_s8_u8(vtstq_u8(loaded, loaded));
+        // In addition, since data_size is constexpr, the loops here will be expanded by the compiler
+        for (int width = 1; width < data_size; width *= 2) {
+            for (int i = width - 1; i >= 0; --i) {
+                int8x16_t lo;
+                int8x16_t hi;
+                if (width == 1) {
+                    lo = vreinterpretq_s8_s16(vmovl_s8(vget_low_s8(masks[i])));
+                    hi = vreinterpretq_s8_s16(vmovl_high_s8(masks[i]));
+                } else if (width == 2) {
+                    lo = vreinterpretq_s8_s32(vmovl_s16(vget_low_s16(vreinterpretq_s16_s8(masks[i]))));
+                    hi = vreinterpretq_s8_s32(vmovl_high_s16(vreinterpretq_s16_s8(masks[i])));
+                } else {
+                    lo = vreinterpretq_s8_s64(vmovl_s32(vget_low_s32(vreinterpretq_s32_s8(masks[i]))));
+                    hi = vreinterpretq_s8_s64(vmovl_high_s32(vreinterpretq_s32_s8(masks[i])));
+                }
+                masks[2 * i] = lo;
+                masks[2 * i + 1] = hi;
+            }
+        }
+
+        for (int i = 0; i < data_size; ++i) {
+            uint8x16_t vec_a;
+            uint8x16_t vec_b;
+            if constexpr (!left_const) {
+                vec_a = vld1q_u8(reinterpret_cast<const uint8_t*>(a) + i * 16);
+            } else {
+                vec_a = const_a;
+            }
+            if constexpr (!right_const) {
+                vec_b = vld1q_u8(reinterpret_cast<const uint8_t*>(b) + i * 16);
+            } else {
+                vec_b = const_b;
+            }
+            vst1q_u8(reinterpret_cast<uint8_t*>(dst) + i * 16,
+                     vbslq_u8(vreinterpretq_u8_s8(masks[i]), vec_a, vec_b));
+        }
+
+        dst += 16;
+        selector += 16;
+        if (!left_const) {
+            a += 16;
+        }
+        if (!right_const) {
+            b += 16;
+        }
+    }
+}
 #endif
 
 // SIMD selector
@@ -245,6 +331,10 @@ public:
         } else if constexpr (could_use_common_select_if<CppType>()) {
             avx2_select_if_common_implement(select_vec, start_dst, start_a, start_b, size);
         }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+        if constexpr (could_use_neon_select_if<CppType>()) {
+            neon_select_if(select_vec, start_dst, start_a, start_b, size);
+        }
 #endif
 
         while (start_dst < end_dst) {
@@ -272,6 +362,10 @@ public:
         } else if constexpr (could_use_common_select_if<CppType>()) {
             avx2_select_if_common_implement<CppType, true, false>(select_vec, start_dst, start_a, start_b, size);
         }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+        if constexpr (could_use_neon_select_if<CppType>()) {
+            neon_select_if<CppType, true, false>(select_vec, start_dst, start_a, start_b, size);
+        }
 #endif
 
         while (start_dst < end_dst) {
@@ -298,6 +392,10 @@ public:
         } else if constexpr (could_use_common_select_if<CppType>()) {
             avx2_select_if_common_implement<CppType, false, true>(select_vec, start_dst, start_a, start_b, size);
         }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+        if constexpr (could_use_neon_select_if<CppType>()) {
+            neon_select_if<CppType, false, true>(select_vec, start_dst, start_a, start_b, size);
+        }
 #endif
 
         while (start_dst < end_dst) {
@@ -324,6 +422,10 @@ public:
         } else if constexpr (could_use_common_select_if<CppType>()) {
             avx2_select_if_common_implement<CppType, true, true>(select_vec, start_dst, start_a, start_b, size);
         }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+        if constexpr (could_use_neon_select_if<CppType>()) {
+            neon_select_if<CppType, true, true>(select_vec, start_dst, start_a, start_b, size);
+        }
 #endif
         while (start_dst < end_dst) {
             *start_dst = *select_vec ? a : b;
@@ -48,6 +48,18 @@ inline size_t count_zero(const int8_t* data, size_t size) {
                                                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), zero16)))
                                        << 48u));
     }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+    const uint8x16_t one16 = vdupq_n_u8(1);
+    const int8_t* end64 = data + (size / 64 * 64);
+
+    for (; data < end64; data += 64) {
+        // each lane counts at most 4 zeros, so the horizontal sum of 64 bytes never overflows uint8
+        uint8x16_t sum = vandq_u8(vceqzq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data))), one16);
+        sum = vaddq_u8(sum, vandq_u8(vceqzq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data + 16))), one16));
+        sum = vaddq_u8(sum, vandq_u8(vceqzq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data + 32))), one16));
+        sum = vaddq_u8(sum, vandq_u8(vceqzq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data + 48))), one16));
+        count += vaddvq_u8(sum);
+    }
 #endif
 
     for (; data < end; ++data) {
@@ -78,6 +90,17 @@ inline size_t count_zero(const uint32_t* data, size_t size) {
                                                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 12)), zero16))))
                                        << 12u));
     }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+    const uint32_t* end16 = data + (size / 16 * 16);
+
+    for (; data < end16; data += 16) {
+        // vceqzq_u32 returns all ones (-1) for a zero, so subtracting the masks counts the zeros
+        uint32x4_t sum = vsubq_u32(vdupq_n_u32(0), vceqzq_u32(vld1q_u32(data)));
+        sum = vsubq_u32(sum, vceqzq_u32(vld1q_u32(data + 4)));
+        sum = vsubq_u32(sum, vceqzq_u32(vld1q_u32(data + 8)));
+        sum = vsubq_u32(sum, vceqzq_u32(vld1q_u32(data + 12)));
+        count += vaddvq_u32(sum);
+    }
 #endif
 
     for (; data < end; ++data) {
@@ -207,4 +230,39 @@ inline uint64_t get_nibble_mask(uint8x16_t values) {
 
 #endif
 
+// Write the positions of the nonzeros of |data| to |indexes| in order, and return the number of them.
+// |indexes| must be large enough to hold all the positions. The blocks of zeros are skipped as a whole,
+// so it is cheap for the sparse data.
+inline size_t to_index(const uint8_t* data, size_t size, uint32_t* indexes) {
+    size_t count = 0;
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero16 = _mm_setzero_si128();
+    for (; i + 16 <= size; i += 16) {
+        uint32_t mask = ~_mm_movemask_epi8(
+                                _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), zero16)) &
+                        0xffff;
+        for (; mask != 0; mask &= mask - 1) {
+            indexes[count++] = i + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+    for (; i + 16 <= size; i += 16) {
+        // keep one bit of each nibble, so that a set bit at 4 * k means data[i + k] is nonzero
+        const uint8x16_t values = vld1q_u8(data + i);
+        uint64_t mask = get_nibble_mask(vtstq_u8(values, values)) & 0x8888888888888888ULL;
+        for (; mask != 0; mask &= mask - 1) {
+            indexes[count++] = i + (__builtin_ctzll(mask) >> 2);
+        }
+    }
+#endif
+    for (; i < size; i++) {
+        if (data[i] != 0) {
+            indexes[count++] = i;
+        }
+    }
+    return count;
+}
+
+
 } // namespace SIMD
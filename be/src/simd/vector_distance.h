@@ -0,0 +1,199 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace SIMD {
+
+// Kernels over float vectors of |dim| elements, shared by the vector distance functions and the vector index.
+//
+// The reductions are written with intrinsics because the compiler keeps the sequential order of float additions
+// and never vectorizes them without -ffast-math. The lanes accumulate independently, so the results may differ
+// from the sequential sum in the last bits.
+
+#if defined(__AVX2__)
+inline float reduce_add_m256(__m256 v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    return _mm_cvtss_f32(sum);
+}
+
+// acc + a * b
+inline __m256 madd_m256(__m256 a, __m256 b, __m256 acc) {
+#ifdef __FMA__
+    return _mm256_fmadd_ps(a, b, acc);
+#else
+    return _mm256_add_ps(acc, _mm256_mul_ps(a, b));
+#endif
+}
+#endif
+
+// sum(a[i] * b[i])
+inline float dot_product(const float* a, const float* b, size_t dim) {
+    size_t i = 0;
+    float sum = 0;
+#if defined(__AVX512F__)
+    __m512 acc = _mm512_setzero_ps();
+    for (; i + 16 <= dim; i += 16) {
+        acc = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc);
+    }
+    sum = _mm512_reduce_add_ps(acc);
+#elif defined(__AVX2__)
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= dim; i += 8) {
+        acc = madd_m256(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc);
+    }
+    sum = reduce_add_m256(acc);
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+    float32x4_t acc = vdupq_n_f32(0);
+    for (; i + 4 <= dim; i += 4) {
+        acc = vfmaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+    }
+    sum = vaddvq_f32(acc);
+#endif
+    for (; i < dim; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+// sum((a[i] - b[i])^2)
+inline float l2_distance_squared(const float* a, const float* b, size_t dim) {
+    size_t i = 0;
+    float sum = 0;
+#if defined(__AVX512F__)
+    __m512 acc = _mm512_setzero_ps();
+    for (; i + 16 <= dim; i += 16) {
+        __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i));
+        acc = _mm512_fmadd_ps(diff, diff, acc);
+    }
+    sum = _mm512_reduce_add_ps(acc);
+#elif defined(__AVX2__)
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= dim; i += 8) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        acc = madd_m256(diff, diff, acc);
+    }
+    sum = reduce_add_m256(acc);
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+    float32x4_t acc = vdupq_n_f32(0);
+    for (; i + 4 <= dim; i += 4) {
+        float32x4_t diff = vsubq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+        acc = vfmaq_f32(acc, diff, diff);
+    }
+    sum = vaddvq_f32(acc);
+#endif
+    for (; i < dim; i++) {
+        float diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+// The dot product and the squared norms of |a| and |b| in a single pass, the parts of the cosine similarity.
+inline void dot_product_and_norms(const float* a, const float* b, size_t dim, float* dot, float* a_norm,
+                                  float* b_norm) {
+    size_t i = 0;
+    float ab = 0;
+    float aa = 0;
+    float bb = 0;
+#if defined(__AVX512F__)
+    __m512 ab_acc = _mm512_setzero_ps();
+    __m512 aa_acc = _mm512_setzero_ps();
+    __m512 bb_acc = _mm512_setzero_ps();
+    for (; i + 16 <= dim; i += 16) {
+        __m512 va = _mm512_loadu_ps(a + i);
+        __m512 vb = _mm512_loadu_ps(b + i);
+        ab_acc = _mm512_fmadd_ps(va, vb, ab_acc);
+        aa_acc = _mm512_fmadd_ps(va, va, aa_acc);
+        bb_acc = _mm512_fmadd_ps(vb, vb, bb_acc);
+    }
+    ab = _mm512_reduce_add_ps(ab_acc);
+    aa = _mm512_reduce_add_ps(aa_acc);
+    bb = _mm512_reduce_add_ps(bb_acc);
+#elif defined(__AVX2__)
+    __m256 ab_acc = _mm256_setzero_ps();
+    __m256 aa_acc = _mm256_setzero_ps();
+    __m256 bb_acc = _mm256_setzero_ps();
+    for (; i + 8 <= dim; i += 8) {
+        __m256 va = _mm256_loadu_ps(a + i);
+        __m256 vb = _mm256_loadu_ps(b + i);
+        ab_acc = madd_m256(va, vb, ab_acc);
+        aa_acc = madd_m256(va, va, aa_acc);
+        bb_acc = madd_m256(vb, vb, bb_acc);
+    }
+    ab = reduce_add_m256(ab_acc);
+    aa = reduce_add_m256(aa_acc);
+    bb = reduce_add_m256(bb_acc);
+#elif defined(__ARM_NEON__) && defined(__aarch64__)
+    float32x4_t ab_acc = vdupq_n_f32(0);
+    float32x4_t aa_acc = vdupq_n_f32(0);
+    float32x4_t bb_acc = vdupq_n_f32(0);
+    for (; i + 4 <= dim; i += 4) {
+        float32x4_t va = vld1q_f32(a + i);
+        float32x4_t vb = vld1q_f32(b + i);
+        ab_acc = vfmaq_f32(ab_acc, va, vb);
+        aa_acc = vfmaq_f32(aa_acc, va, va);
+        bb_acc = vfmaq_f32(bb_acc, vb, vb);
+    }
+    ab = vaddvq_f32(ab_acc);
+    aa = vaddvq_f32(aa_acc);
+    bb = vaddvq_f32(bb_acc);
+#endif
+    for (; i < dim; i++) {
+        ab += a[i] * b[i];
+        aa += a[i] * a[i];
+        bb += b[i] * b[i];
+    }
+    *dot = ab;
+    *a_norm = aa;
+    *b_norm = bb;
+}
+
+// Element-wise kernels, out[i] = a[i] op b[i]. |out| may alias |a| or |b|.
+// They have no dependency between iterations and are left to the auto-vectorizer.
+inline void add(const float* a, const float* b, size_t dim, float* out) {
+    for (size_t i = 0; i < dim; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+inline void subtract(const float* a, const float* b, size_t dim, float* out) {
+    for (size_t i = 0; i < dim; i++) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+inline void multiply(const float* a, const float* b, size_t dim, float* out) {
+    for (size_t i = 0; i < dim; i++) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+// out[i] = a[i] * scale
+inline void scale(const float* a, float scale, size_t dim, float* out) {
+    for (size_t i = 0; i < dim; i++) {
+        out[i] = a[i] * scale;
+    }
+}
+
+} // namespace SIMD
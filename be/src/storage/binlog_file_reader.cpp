@@ -14,6 +14,8 @@
 
 #include "storage/binlog_file_reader.h"
 
+#include <algorithm>
+
 #include "fs/fs.h"
 #include "storage/binlog_file_writer.h"
 #include "storage/binlog_util.h"
@@ -24,9 +26,39 @@
 
 namespace starrocks {
 
-BinlogFileReader::BinlogFileReader(std::string file_name, std::shared_ptr<BinlogFileMetaPB> file_meta)
+bool BinlogPageIndex::find(int64_t version, int64_t seq_id, int64_t num_pages, int64_t* page_index,
+                           int64_t* file_pos) const {
+    BinlogLsn lsn(version, seq_id);
+    std::lock_guard l(_mutex);
+    auto end = _pages.begin() + std::min<int64_t>(num_pages, _pages.size());
+    auto it = std::upper_bound(_pages.begin(), end, lsn,
+                               [](const BinlogLsn& lsn, const PageLocation& page) { return lsn < page.start_lsn; });
+    if (it == _pages.begin()) {
+        return false;
+    }
+    --it;
+    *page_index = it - _pages.begin();
+    *file_pos = it->file_pos;
+    return true;
+}
+
+void BinlogPageIndex::add(int64_t page_index, int64_t file_pos, int64_t version, int64_t start_seq_id) {
+    std::lock_guard l(_mutex);
+    if (page_index == static_cast<int64_t>(_pages.size())) {
+        _pages.push_back({BinlogLsn(version, start_seq_id), file_pos});
+    }
+}
+
+int64_t BinlogPageIndex::num_pages() const {
+    std::lock_guard l(_mutex);
+    return _pages.size();
+}
+
+BinlogFileReader::BinlogFileReader(std::string file_name, std::shared_ptr<BinlogFileMetaPB> file_meta,
+                                   std::shared_ptr<BinlogPageIndex> page_index)
         : _file_path(std::move(file_name)),
           _file_meta(std::move(file_meta)),
+          _page_index(std::move(page_index)),
           _file_size(0),
           _current_file_pos(0),
           _next_page_index(0) {}
@@ -71,10 +103,23 @@ Status BinlogFileReader::_seek(int64_t version, int64_t seq_id) {
 }
 
 Status BinlogFileReader::_seek_to_page(int64_t version, int64_t seq_id) {
+    int64_t page_index;
+    int64_t file_pos;
+    // skip the pages before the one which may contain the change event
+    if (_page_index != nullptr &&
+        _page_index->find(version, seq_id, _file_meta->num_pages(), &page_index, &file_pos)) {
+        _next_page_index = page_index;
+        _current_file_pos = file_pos;
+    }
     do {
         _reset_current_page_context();
         PageHeaderPB& page_header_pb = _current_page_context->page_header;
+        int64_t page_header_pos = _current_file_pos;
         RETURN_IF_ERROR(_read_page_header(_next_page_index, &page_header_pb));
+        if (_page_index != nullptr) {
+            _page_index->add(_next_page_index, page_header_pos, page_header_pb.version(),
+                             page_header_pb.start_seq_id());
+        }
         if (page_header_pb.version() > version) {
             return Status::NotFound(strings::Substitute("Can't find version $0", version));
         }
@@ -120,7 +165,11 @@ Status BinlogFileReader::_read_next_page() {
 
     _reset_current_page_context();
     PageHeaderPB& page_header_pb = _current_page_context->page_header;
+    int64_t page_header_pos = _current_file_pos;
     RETURN_IF_ERROR(_read_page_header(_next_page_index, &page_header_pb));
+    if (_page_index != nullptr) {
+        _page_index->add(_next_page_index, page_header_pos, page_header_pb.version(), page_header_pb.start_seq_id());
+    }
     RETURN_IF_ERROR(_read_page_content(_next_page_index, &page_header_pb, &(_current_page_context->page_content)));
     _next_page_index++;
     _init_current_log_entry();
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <vector>
+
 #include "common/status.h"
 #include "fs/fs.h"
 #include "gen_cpp/binlog.pb.h"
@@ -49,6 +52,31 @@ struct PageContext {
     PageContentPB page_content;
 };
 
+// Locations of the pages of a binlog file, which are shared by the readers of the file, so that seeking
+// to a change event does not have to scan the page headers from the beginning of the file. Pages are only
+// appended to a binlog file, and the index covers the pages that have been read, from the first one.
+class BinlogPageIndex {
+public:
+    // Find the last indexed page among the first |num_pages| pages whose first change event is not after
+    // <version, seq_id>. Return false if there is no such page.
+    bool find(int64_t version, int64_t seq_id, int64_t num_pages, int64_t* page_index, int64_t* file_pos) const;
+
+    // Record the location of the header of the page |page_index|. It's ignored if the previous pages
+    // are not indexed yet.
+    void add(int64_t page_index, int64_t file_pos, int64_t version, int64_t start_seq_id);
+
+    int64_t num_pages() const;
+
+private:
+    struct PageLocation {
+        BinlogLsn start_lsn;
+        int64_t file_pos;
+    };
+
+    mutable std::mutex _mutex;
+    std::vector<PageLocation> _pages;
+};
+
 // Read log entries in the binlog file.
 //
 // How to use
@@ -61,7 +89,9 @@ struct PageContext {
 //  }
 class BinlogFileReader {
 public:
-    BinlogFileReader(std::string file_name, std::shared_ptr<BinlogFileMetaPB> file_meta);
+    // |page_index| is optional, and is used to seek to the page and updated with the pages read.
+    BinlogFileReader(std::string file_name, std::shared_ptr<BinlogFileMetaPB> file_meta,
+                     std::shared_ptr<BinlogPageIndex> page_index = nullptr);
 
     // Seek to the log entry containing the <version, seq_id>. This method
     // only can be called once for a file reader. Return Status::Ok() if find
@@ -151,6 +181,7 @@ private:
 
     std::string _file_path;
     std::shared_ptr<BinlogFileMetaPB> _file_meta;
+    std::shared_ptr<BinlogPageIndex> _page_index;
     std::unique_ptr<RandomAccessFile> _file;
     int64_t _file_size;
     int64_t _current_file_pos;
@@ -128,8 +128,9 @@ private:
 // automatically in the destructor
 class BinlogFileReadHolder {
 public:
-    BinlogFileReadHolder(std::shared_ptr<std::atomic<int64_t>> _reader_count, BinlogFileMetaPBPtr file_meta)
-            : _reader_count(_reader_count), _file_meta(file_meta) {
+    BinlogFileReadHolder(std::shared_ptr<std::atomic<int64_t>> _reader_count, BinlogFileMetaPBPtr file_meta,
+                         std::shared_ptr<BinlogPageIndex> page_index)
+            : _reader_count(_reader_count), _file_meta(file_meta), _page_index(std::move(page_index)) {
         _reader_count->fetch_add(1);
     }
 
@@ -137,9 +138,12 @@ public:
 
     BinlogFileMetaPBPtr& file_meta() { return _file_meta; }
 
+    const std::shared_ptr<BinlogPageIndex>& page_index() { return _page_index; }
+
 private:
     std::shared_ptr<std::atomic<int64_t>> _reader_count;
     BinlogFileMetaPBPtr _file_meta;
+    std::shared_ptr<BinlogPageIndex> _page_index;
 };
 
 using BinlogFileReadHolderPtr = std::shared_ptr<BinlogFileReadHolder>;
@@ -150,6 +154,7 @@ class BinlogFile {
 public:
     BinlogFile(BinlogFileMetaPBPtr file_meta) : _file_meta(file_meta) {
         _reader_count = std::make_shared<std::atomic<int64_t>>();
+        _page_index = std::make_shared<BinlogPageIndex>();
     }
 
     BinlogFileMetaPBPtr& file_meta() { return _file_meta; }
@@ -157,7 +162,7 @@ public:
     void update_file_meta(BinlogFileMetaPBPtr& file_meta) { _file_meta = file_meta; }
 
     BinlogFileReadHolderPtr new_read_holder() {
-        return std::make_shared<BinlogFileReadHolder>(_reader_count, _file_meta);
+        return std::make_shared<BinlogFileReadHolder>(_reader_count, _file_meta, _page_index);
     }
 
     int64_t reader_count() { return _reader_count->load(); }
@@ -165,6 +170,8 @@ public:
 private:
     BinlogFileMetaPBPtr _file_meta;
     std::shared_ptr<std::atomic<int64_t>> _reader_count;
+    // Locations of the pages read by the readers of this file
+    std::shared_ptr<BinlogPageIndex> _page_index;
 };
 using BinlogFilePtr = std::shared_ptr<BinlogFile>;
 
@@ -14,6 +14,7 @@
 
 #include "storage/binlog_reader.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "column/datum.h"
@@ -68,7 +69,7 @@ Status BinlogReader::init() {
 }
 
 Status BinlogReader::seek(int64_t version, int64_t seq_id) {
-    if (_next_version == version && _next_seq_id == seq_id) {
+    if (_next_version == version && _next_seq_id == seq_id && _pending_status.ok()) {
         return Status::OK();
     }
     _reset();
@@ -85,6 +86,39 @@ Status BinlogReader::seek(int64_t version, int64_t seq_id) {
 }
 
 Status BinlogReader::get_next(ChunkPtr* chunk, int64_t max_version_exclusive) {
+    if (!_pending_status.ok()) {
+        Status status = _pending_status;
+        _pending_status = Status::OK();
+        return status;
+    }
+    RETURN_IF_ERROR(_next_log_entry(max_version_exclusive));
+    int64_t version = _next_version;
+    RETURN_IF_ERROR(_read_log_entry(chunk->get()));
+    // Pack the following log entries of the same version into the chunk as long as they fit, so that
+    // small segments do not produce small chunks. A chunk never spans versions, because the consumer
+    // may stop at the end of any version.
+    const int64_t chunk_size = _reader_params.chunk_size;
+    while (_next_version == version && static_cast<int64_t>((*chunk)->num_rows()) < chunk_size) {
+        Status status = _next_log_entry(max_version_exclusive);
+        if (status.ok()) {
+            int64_t num_rows = std::min(chunk_size, _log_entry_info->end_seq_id - _next_seq_id + 1);
+            if (_next_version != version || static_cast<int64_t>((*chunk)->num_rows()) + num_rows > chunk_size) {
+                break;
+            }
+            status = _read_log_entry(chunk->get());
+        }
+        if (!status.ok()) {
+            // the change events already in the chunk are valid, and report the error in the next call
+            if (!status.is_end_of_file()) {
+                _pending_status = status;
+            }
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+Status BinlogReader::_next_log_entry(int64_t max_version_exclusive) {
     // Invariant: if _log_entry_info is not nullptr, change event with
     // <_next_version, _next_seq_id> must be in this log entry, otherwise
     // need to find the log entry first
@@ -139,12 +173,30 @@ Status BinlogReader::get_next(ChunkPtr* chunk, int64_t max_version_exclusive) {
     if (_next_version >= max_version_exclusive) {
         return Status::EndOfFile(fmt::format("End of max version {}", max_version_exclusive));
     }
+    return Status::OK();
+}
 
+Status BinlogReader::_read_log_entry(Chunk* output_chunk) {
     LogEntryInfo* log_entry_info = _log_entry_info;
-    _swap_output_and_data_chunk(chunk->get());
-    status = _segment_iterator->get_next(_data_chunk.get());
-    int32_t num_rows = _data_chunk->num_rows();
-    _swap_output_and_data_chunk(chunk->get());
+    Status status;
+    int32_t num_rows;
+    if (output_chunk->num_rows() == 0) {
+        _swap_output_and_data_chunk(output_chunk);
+        status = _segment_iterator->get_next(_data_chunk.get());
+        num_rows = _data_chunk->num_rows();
+        _swap_output_and_data_chunk(output_chunk);
+    } else {
+        // the segment iterator only reads into an empty chunk
+        status = _segment_iterator->get_next(_data_chunk.get());
+        num_rows = _data_chunk->num_rows();
+        if (status.ok()) {
+            Columns& output_columns = output_chunk->columns();
+            for (size_t i = 0; i < _data_column_index.size(); i++) {
+                output_columns[_data_column_index[i]]->append(*_data_chunk->get_column_by_index(i));
+            }
+        }
+        _data_chunk->reset();
+    }
     // sanity check: should not meet the end of file
     if (status.is_end_of_file()) {
         std::string err_msg = fmt::format(
@@ -158,7 +210,7 @@ Status BinlogReader::get_next(ChunkPtr* chunk, int64_t max_version_exclusive) {
     if (!status.ok()) {
         return status;
     }
-    _append_meta_column(chunk->get(), num_rows, log_entry_info->version, log_entry_info->timestamp_in_us, _next_seq_id);
+    _append_meta_column(output_chunk, num_rows, log_entry_info->version, log_entry_info->timestamp_in_us, _next_seq_id);
     _next_seq_id += num_rows;
     // read all change events in this log entry
     if (_next_seq_id > log_entry_info->end_seq_id) {
@@ -226,7 +278,8 @@ Status BinlogReader::_seek_binlog_file_reader(int64_t version, int64_t seq_id) {
     _binlog_file_holder = status_or.value();
     BinlogFileMetaPBPtr& file_meta = _binlog_file_holder->file_meta();
     std::string file_path = _binlog_manager->get_binlog_file_path(file_meta->id());
-    _binlog_file_reader = std::make_shared<BinlogFileReader>(file_path, file_meta);
+    _binlog_file_reader =
+            std::make_shared<BinlogFileReader>(file_path, file_meta, _binlog_file_holder->page_index());
     RETURN_IF_ERROR(_binlog_file_reader->seek(version, seq_id));
     return Status::OK();
 }
@@ -302,6 +355,7 @@ void BinlogReader::_reset() {
     _release_segment_iterator(true);
     _release_binlog_file();
     _log_entry_info = nullptr;
+    _pending_status = Status::OK();
 }
 
 void BinlogReader::close() {
@@ -88,6 +88,8 @@ public:
 
     // Get a chunk of change events less than the *max_version_exclusive*.
     // The schema of chunk should be the same with BinlogReaderParams#schema.
+    // The change events in a chunk may come from multiple log entries, but
+    // always belong to the same version.
     // Return Status::OK() if there is at least one change event in the chunk
     // Return Status::EndOfFile() if there is no more change events, or the
     // version of left change events are no less than *max_version_exclusive*.
@@ -109,6 +111,10 @@ public:
 
 private:
     Status _seek_binlog_file_reader(int64_t version, int64_t seq_id);
+    // Locate the log entry containing the change event <_next_version, _next_seq_id>
+    Status _next_log_entry(int64_t max_version_exclusive);
+    // Read change events from the current log entry, and append them to the output chunk
+    Status _read_log_entry(Chunk* output_chunk);
     Status _init_segment_iterator();
     void _release_segment_iterator(bool release_rowset);
     void _release_binlog_file();
@@ -145,6 +151,8 @@ private:
     ChunkIteratorPtr _segment_iterator;
     // the chunk delivered to the segment iterator for get_next()
     ChunkPtr _data_chunk;
+    // error met after some change events are packed into a chunk, returned by the next get_next()
+    Status _pending_status;
 
     bool _initialized = false;
     bool _closed = false;
@@ -22,6 +22,7 @@
 #include "column/schema.h"
 #include "column/struct_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -31,6 +32,7 @@
 #include "storage/type_traits.h"
 #include "storage/type_utils.h"
 #include "storage/types.h"
+#include "util/cpu_info.h"
 #include "util/metrics.h"
 #include "util/percentile_value.h"
 
@@ -256,6 +258,9 @@ inline std::shared_ptr<DecimalColumnType<T>> get_decimal_column_ptr(int precisio
     return column;
 }
 
+template <bool force>
+ColumnPtr column_from_pool(const Field& field, size_t chunk_size);
+
 template <bool force>
 struct ColumnPtrBuilder {
     template <LogicalType ftype>
@@ -282,7 +287,9 @@ struct ColumnPtrBuilder {
             std::vector<ColumnPtr> fields;
             for (auto& sub_field : field.sub_fields()) {
                 names.template emplace_back(sub_field.name());
-                fields.template emplace_back(sub_field.create_column());
+                // struct fields have one row per struct row, so they are recycled through the pool like
+                // top-level columns.
+                fields.template emplace_back(column_from_pool<force>(sub_field, chunk_size));
             }
             auto struct_column = StructColumn::create(std::move(fields), std::move(names));
             return NullableIfNeed(struct_column);
@@ -476,6 +483,16 @@ void ChunkHelper::reorder_chunk(const std::vector<SlotDescriptor*>& slots, Chunk
     original_chunk.swap_chunk(reordered_chunk);
 }
 
+size_t ChunkHelper::target_chunk_bytes() {
+    const int64_t target_bytes = config::chunk_target_bytes;
+    if (target_bytes >= 0) {
+        return target_bytes;
+    }
+    const long l2_cache_size = CpuInfo::get_cache_size(CpuInfo::L2_CACHE);
+    // Fall back to 1MB L2 cache if it cannot be detected.
+    return 4 * (l2_cache_size > 0 ? l2_cache_size : 1024 * 1024);
+}
+
 ChunkAccumulator::ChunkAccumulator(size_t desired_size) : _desired_size(desired_size) {}
 
 void ChunkAccumulator::set_desired_size(size_t desired_size) {
@@ -541,21 +558,24 @@ void ChunkAccumulator::finalize() {
 void ChunkPipelineAccumulator::push(const ChunkPtr& chunk) {
     chunk->check_or_die();
     DCHECK(_out_chunk == nullptr);
+    const size_t chunk_bytes = chunk->bytes_usage();
     if (_in_chunk == nullptr) {
         _in_chunk = chunk;
-        _mem_usage = chunk->bytes_usage();
+        _mem_usage = chunk_bytes;
     } else if (_in_chunk->num_rows() + chunk->num_rows() > _max_size ||
+               (_max_bytes > 0 && _mem_usage + chunk_bytes > _max_bytes) ||
                _in_chunk->owner_info() != chunk->owner_info()) {
         _out_chunk = std::move(_in_chunk);
         _in_chunk = chunk;
-        _mem_usage = chunk->bytes_usage();
+        _mem_usage = chunk_bytes;
     } else {
         _in_chunk->append(*chunk);
-        _mem_usage += chunk->bytes_usage();
+        _mem_usage += chunk_bytes;
     }
 
-    if (_out_chunk == nullptr && (_in_chunk->num_rows() >= _max_size * LOW_WATERMARK_ROWS_RATE ||
-                                  _mem_usage >= LOW_WATERMARK_BYTES || _in_chunk->owner_info().is_last_chunk())) {
+    if (_out_chunk == nullptr &&
+        (_in_chunk->num_rows() >= _max_size * LOW_WATERMARK_ROWS_RATE || _mem_usage >= LOW_WATERMARK_BYTES ||
+         (_max_bytes > 0 && _mem_usage >= _max_bytes) || _in_chunk->owner_info().is_last_chunk())) {
         _out_chunk = std::move(_in_chunk);
         _mem_usage = 0;
     }
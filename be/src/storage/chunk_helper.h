@@ -89,6 +89,10 @@ public:
     static void reorder_chunk(const TupleDescriptor& tuple_desc, Chunk* chunk);
     // Reorder columns of `chunk` according to the order of |slots|.
     static void reorder_chunk(const std::vector<SlotDescriptor*>& slots, Chunk* chunk);
+
+    // The bytes a chunk should be cut at before it reaches chunk_size rows, see config::chunk_target_bytes.
+    // 0 means unlimited.
+    static size_t target_chunk_bytes();
 };
 
 // Accumulate small chunk into desired size
@@ -118,6 +122,8 @@ class ChunkPipelineAccumulator {
 public:
     ChunkPipelineAccumulator() = default;
     void set_max_size(size_t max_size) { _max_size = max_size; }
+    // A chunk is emitted once it reaches |max_bytes| even if it has fewer than max_size rows, 0 means unlimited.
+    void set_max_bytes(size_t max_bytes) { _max_bytes = max_bytes; }
     void push(const ChunkPtr& chunk);
     ChunkPtr& pull();
     void finalize();
@@ -138,6 +144,7 @@ private:
     ChunkPtr _in_chunk = nullptr;
     ChunkPtr _out_chunk = nullptr;
     size_t _max_size = 4096;
+    size_t _max_bytes = 0;
     // For bitmap columns, the cost of calculating mem_usage is relatively high,
     // so incremental calculation is used to avoid becoming a performance bottleneck.
     size_t _mem_usage = 0;
@@ -140,6 +140,13 @@ public:
         return false;
     }
 
+    bool bloom_filter_hashes(const BloomFilter* bf, std::vector<uint64_t>* hashes) const override {
+        for (const ValueType& v : _values) {
+            hashes->push_back(bf->hash(reinterpret_cast<const char*>(&v), sizeof(v)));
+        }
+        return true;
+    }
+
     PredicateType type() const override { return PredicateType::kInList; }
 
     bool can_vectorized() const override { return false; }
@@ -322,6 +329,13 @@ public:
         return false;
     }
 
+    bool bloom_filter_hashes(const BloomFilter* bf, std::vector<uint64_t>* hashes) const override {
+        for (const auto& str : _zero_padded_strs) {
+            hashes->push_back(bf->hash(str.data(), str.size()));
+        }
+        return true;
+    }
+
     bool can_vectorized() const override { return false; }
 
     PredicateType type() const override { return PredicateType::kInList; }
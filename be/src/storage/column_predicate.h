@@ -166,6 +166,12 @@ public:
     // Return false to filter out a data page.
     virtual bool bloom_filter(const BloomFilter* bf) const { return true; }
 
+    // Append to |hashes| the hashes by |bf| of the values this predicate may match, a data page is
+    // filtered out iff its bloom filter hits none of them. So that many bloom filters of one index
+    // can be probed with the values hashed only once. Return false if not supported, then use
+    // bloom_filter() for each page instead.
+    virtual bool bloom_filter_hashes(const BloomFilter* bf, std::vector<uint64_t>* hashes) const { return false; }
+
     // Return false to filter out a data page.
     virtual bool ngram_bloom_filter(const BloomFilter* bf, const NgramBloomFilterReaderOptions& reader_options) const {
         return true;
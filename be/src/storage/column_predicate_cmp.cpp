@@ -477,6 +477,11 @@ public:
         return bf->test_bytes(reinterpret_cast<const char*>(&this->_value), sizeof(this->_value));
     }
 
+    bool bloom_filter_hashes(const BloomFilter* bf, std::vector<uint64_t>* hashes) const override {
+        hashes->push_back(bf->hash(reinterpret_cast<const char*>(&this->_value), sizeof(this->_value)));
+        return true;
+    }
+
     Status convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
                       ObjectPool* obj_pool) const override {
         return predicate_convert_to<field_type>(*this, this->_value, new_column_eq_predicate, output, target_type_info,
@@ -657,6 +662,12 @@ public:
         return bf->test_bytes(padded.data, padded.size);
     }
 
+    bool bloom_filter_hashes(const BloomFilter* bf, std::vector<uint64_t>* hashes) const override {
+        Slice padded(Base::_zero_padded_str);
+        hashes->push_back(bf->hash(padded.data, padded.size));
+        return true;
+    }
+
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
         // see the comment in `predicate_parser.cpp`.
         Slice padded_value(Base::_zero_padded_str);
@@ -14,12 +14,16 @@
 
 #include "storage/compaction_manager.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
+#include "exec/pipeline/pipeline_driver_executor.h"
+#include "runtime/exec_env.h"
 #include "storage/data_dir.h"
 #include "util/starrocks_metrics.h"
 #include "util/thread.h"
+#include "util/time.h"
 
 using namespace std::chrono_literals;
 
@@ -213,6 +217,8 @@ bool CompactionManager::_check_precondition(const CompactionCandidate& candidate
 
     int64_t last_failure_ts = 0;
     DataDir* data_dir = tablet->data_dir();
+    // let more tasks run on each disk when there are few queries
+    int disk_limit_factor = query_load() < config::compaction_idle_query_load_ratio ? 2 : 1;
     if (candidate.type == CUMULATIVE_COMPACTION) {
         std::shared_lock lk(tablet->get_cumulative_lock(), std::try_to_lock);
         if (!lk.owns_lock()) {
@@ -223,7 +229,7 @@ bool CompactionManager::_check_precondition(const CompactionCandidate& candidate
         // allow overruns up to twice the configured limit
         uint16_t num = running_cumulative_tasks_num_for_dir(data_dir);
         if (config::cumulative_compaction_num_threads_per_disk > 0 &&
-            num >= config::cumulative_compaction_num_threads_per_disk * 2) {
+            num >= config::cumulative_compaction_num_threads_per_disk * 2 * disk_limit_factor) {
             VLOG(2) << "skip tablet:" << tablet->tablet_id()
                     << " for limit of cumulative compaction task per disk. disk path:" << data_dir->path()
                     << ", running num:" << num;
@@ -237,7 +243,8 @@ bool CompactionManager::_check_precondition(const CompactionCandidate& candidate
             return false;
         }
         uint16_t num = running_base_tasks_num_for_dir(data_dir);
-        if (config::base_compaction_num_threads_per_disk > 0 && num >= config::base_compaction_num_threads_per_disk) {
+        if (config::base_compaction_num_threads_per_disk > 0 &&
+            num >= config::base_compaction_num_threads_per_disk * disk_limit_factor) {
             VLOG(2) << "skip tablet:" << tablet->tablet_id()
                     << " for limit of base compaction task per disk. disk path:" << data_dir->path()
                     << ", running num:" << num;
@@ -346,6 +353,9 @@ void CompactionManager::update_tablet(const TabletSharedPtr& tablet) {
         candidate.tablet = tablet;
         candidate.score = tablet->compaction_score();
         candidate.type = tablet->compaction_type();
+        if (config::enable_compaction_query_cost_score) {
+            candidate.score = _query_cost_score(tablet, candidate.type, candidate.score);
+        }
         update_candidates({candidate});
     }
 }
@@ -528,6 +538,10 @@ void CompactionManager::get_running_status(std::string* json_result) {
     candidate_num_value.SetInt64(candidate_num);
     root.AddMember("candidate_num", candidate_num_value, root.GetAllocator());
 
+    rapidjson::Value query_load_value;
+    query_load_value.SetDouble(query_load());
+    root.AddMember("query_load", query_load_value, root.GetAllocator());
+
     // to json string
     rapidjson::StringBuffer strbuf;
     rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
@@ -597,4 +611,56 @@ int CompactionManager::get_waiting_task_num() {
     return _compaction_candidates.size();
 }
 
+double CompactionManager::query_load() {
+    auto* executor = ExecEnv::GetInstance()->wg_driver_executor();
+    if (executor == nullptr) {
+        return 0;
+    }
+    std::lock_guard lg(_query_load_mutex);
+    int64_t now_ns = MonotonicNanos();
+    int64_t elapsed_ns = now_ns - _last_query_load_sample_ns;
+    if (elapsed_ns < NANOS_PER_SEC) {
+        return _query_load;
+    }
+    int64_t execution_ns = executor->driver_execution_ns();
+    int32_t num_threads = executor->num_threads();
+    if (_last_query_load_sample_ns > 0 && num_threads > 0) {
+        double load = static_cast<double>(execution_ns - _last_driver_execution_ns) / elapsed_ns / num_threads;
+        _query_load = std::clamp(load, 0.0, 1.0);
+    }
+    _last_query_load_sample_ns = now_ns;
+    _last_driver_execution_ns = execution_ns;
+    return _query_load;
+}
+
+int32_t CompactionManager::_max_task_num_by_query_load() {
+    double busy_ratio = config::compaction_busy_query_load_ratio;
+    double load = query_load();
+    if (busy_ratio >= 1 || load <= busy_ratio) {
+        return _max_task_num;
+    }
+    // keep at least one task running, otherwise the versions may pile up when the node is always busy
+    return std::max<int32_t>(1, _max_task_num * (1 - load) / (1 - busy_ratio));
+}
+
+double CompactionManager::calc_query_cost_score(double compaction_score, double scan_frequency, int64_t input_bytes) {
+    double input_mbytes = std::max(1.0, static_cast<double>(input_bytes) / (1024 * 1024));
+    return compaction_score * (1 + std::max(0.0, scan_frequency)) / input_mbytes;
+}
+
+double CompactionManager::_query_cost_score(const TabletSharedPtr& tablet, CompactionType type,
+                                            double compaction_score) {
+    std::vector<RowsetSharedPtr> rowsets;
+    if (type == BASE_COMPACTION) {
+        tablet->pick_candicate_rowsets_to_base_compaction(&rowsets);
+    } else {
+        tablet->pick_candicate_rowsets_to_cumulative_compaction(&rowsets);
+    }
+    int64_t input_bytes = 0;
+    for (const auto& rowset : rowsets) {
+        input_bytes += rowset->data_disk_size();
+    }
+    return calc_query_cost_score(compaction_score, tablet->query_scan_frequency(), input_bytes);
+}
+
 } // namespace starrocks
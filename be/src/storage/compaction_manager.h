@@ -82,13 +82,15 @@ public:
             LOG_ONCE(WARNING) << "register compaction task failed for compaction is disabled";
             exceed = true;
         }
+        int32_t max_task_num = _max_task_num_by_query_load();
         std::lock_guard lg(_tasks_mutex);
         size_t running_tasks_num = 0;
         for (const auto& it : _running_tasks) {
             running_tasks_num += it.second.size();
         }
-        if (running_tasks_num >= _max_task_num) {
-            VLOG(2) << "register compaction task failed for running tasks reach max limit:" << _max_task_num;
+        if (running_tasks_num >= max_task_num) {
+            VLOG(2) << "register compaction task failed for running tasks reach max limit:" << max_task_num
+                    << ", query load:" << query_load();
             exceed = true;
         }
         return exceed;
@@ -128,6 +130,13 @@ public:
 
     int get_waiting_task_num();
 
+    // The utilization of the pipeline driver executor in [0, 1], sampled at most once per second.
+    double query_load();
+
+    // The expected reduction of query cost per MB compacted. The compaction score, which is roughly the number
+    // of segments merged away, is weighed by the scans per minute of the tablet and divided by the input size.
+    static double calc_query_cost_score(double compaction_score, double scan_frequency, int64_t input_bytes);
+
 private:
     CompactionManager(const CompactionManager& compaction_manager) = delete;
     CompactionManager(CompactionManager&& compaction_manager) = delete;
@@ -141,6 +150,9 @@ private:
     // wait until current running tasks are below max_concurrent_num
     void _wait_to_run();
     bool _can_schedule_next();
+    // _max_task_num lowered linearly when the query load is above compaction_busy_query_load_ratio
+    int32_t _max_task_num_by_query_load();
+    double _query_cost_score(const TabletSharedPtr& tablet, CompactionType type, double compaction_score);
     std::shared_ptr<CompactionTask> _try_get_next_compaction_task();
 
     std::mutex _candidates_mutex;
@@ -165,6 +177,12 @@ private:
     int64_t _cumulative_compaction_concurrency = 0;
     double _last_score = 0;
 
+    std::mutex _query_load_mutex;
+    // protected by _query_load_mutex
+    int64_t _last_query_load_sample_ns = 0;
+    int64_t _last_driver_execution_ns = 0;
+    double _query_load = 0;
+
     bool _disable_update_tablet = false;
 
     std::atomic<bool> _bg_worker_stopped{false};
@@ -16,12 +16,18 @@
 
 #include <sstream>
 
+#include "column/datum_convert.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "storage/compaction_manager.h"
+#include "storage/delta_column_group.h"
+#include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
+#include "storage/rowset/segment.h"
 #include "storage/storage_engine.h"
+#include "storage/tablet_meta_manager.h"
+#include "storage/types.h"
 #include "util/scoped_cleanup.h"
 #include "util/starrocks_metrics.h"
 #include "util/time.h"
@@ -214,9 +220,10 @@ Status CompactionTask::_shortcut_compact(Statistics* statistics) {
         }
     }
 
-    if (data_rowsets.size() == 1 && !data_rowsets.back()->rowset_meta()->is_segments_overlapping() &&
-        _tablet->enable_shortcut_compaction()) {
-        TRACE("[Compaction] start shortcut comapction data");
+    bool can_shortcut = (data_rowsets.size() == 1 && !data_rowsets.back()->rowset_meta()->is_segments_overlapping()) ||
+                        (data_rowsets.size() > 1 && _can_link_rowsets(data_rowsets));
+    if (can_shortcut && _tablet->enable_shortcut_compaction()) {
+        TRACE("[Compaction] start shortcut comapction data, rowsets:$0", data_rowsets.size());
         int64_t max_rows_per_segment = CompactionUtils::get_segment_max_rows(
                 config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
 
@@ -224,11 +231,13 @@ Status CompactionTask::_shortcut_compact(Statistics* statistics) {
         RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
                 _tablet.get(), max_rows_per_segment, _task_info.algorithm, _task_info.output_version,
                 data_rowsets.back()->rowset_meta()->gtid(), &output_rs_writer, _tablet_schema));
-        Status status = output_rs_writer->add_rowset(data_rowsets.back());
-        if (!status.ok()) {
-            LOG(WARNING) << "fail to compact rowset."
-                         << ", tablet=" << _tablet->full_name() << ", version=" << output_rs_writer->version();
-            return status;
+        for (const auto& rowset : data_rowsets) {
+            Status status = output_rs_writer->add_rowset(rowset);
+            if (!status.ok()) {
+                LOG(WARNING) << "fail to compact rowset."
+                             << ", tablet=" << _tablet->full_name() << ", version=" << output_rs_writer->version();
+                return status;
+            }
         }
         StatusOr<RowsetSharedPtr> build_res = output_rs_writer->build();
         if (!build_res.ok()) {
@@ -257,4 +266,71 @@ Status CompactionTask::_shortcut_compact(Statistics* statistics) {
     return Status::OK();
 }
 
+bool CompactionTask::_can_link_rowsets(const std::vector<RowsetSharedPtr>& rowsets) const {
+    if (!config::enable_compaction_link_disjoint_rowsets || _tablet_schema->sort_key_idxes().empty()) {
+        return false;
+    }
+    const TabletColumn& column = _tablet_schema->column(_tablet_schema->sort_key_idxes()[0]);
+    // the zone map of string columns may be truncated, which can not tell the exact bounds
+    if (is_string_type(column.type()) || !is_scalar_field_type(column.type())) {
+        return false;
+    }
+    TypeInfoPtr type_info = get_type_info(delegate_type(column.type()));
+    KVStore* meta = _tablet->data_dir()->get_meta();
+    Datum prev_max;
+    bool has_prev = false;
+    for (const auto& rowset : rowsets) {
+        if (rowset->rowset_meta()->is_segments_overlapping() || rowset->num_delete_files() > 0 ||
+            rowset->schema()->schema_version() != rowsets[0]->schema()->schema_version()) {
+            return false;
+        }
+        Datum rowset_min;
+        Datum rowset_max;
+        bool has_bounds = false;
+        for (const auto& segment : rowset->segments()) {
+            DeltaColumnGroupList dcgs;
+            if (!TabletMetaManager::scan_delta_column_group(meta, _tablet->tablet_id(), rowset->rowset_id(),
+                                                            static_cast<uint32_t>(segment->id()), 0, INT64_MAX, &dcgs)
+                         .ok() ||
+                !dcgs.empty()) {
+                return false;
+            }
+            if (segment->num_rows() == 0) {
+                continue;
+            }
+            const auto* column_reader = segment->column_with_uid(column.unique_id());
+            if (column_reader == nullptr || column_reader->segment_zone_map() == nullptr) {
+                return false;
+            }
+            // nulls are sorted first, so a segment with nulls is never disjoint from the rows before it
+            const ZoneMapPB& zone_map = *column_reader->segment_zone_map();
+            if (zone_map.has_null() || !zone_map.has_not_null()) {
+                return false;
+            }
+            Datum min_value;
+            Datum max_value;
+            if (!datum_from_string(type_info.get(), &min_value, zone_map.min(), nullptr).ok() ||
+                !datum_from_string(type_info.get(), &max_value, zone_map.max(), nullptr).ok()) {
+                return false;
+            }
+            if (!has_bounds || type_info->cmp(min_value, rowset_min) < 0) {
+                rowset_min = min_value;
+            }
+            if (!has_bounds || type_info->cmp(max_value, rowset_max) > 0) {
+                rowset_max = max_value;
+            }
+            has_bounds = true;
+        }
+        if (!has_bounds) {
+            continue;
+        }
+        if (has_prev && type_info->cmp(prev_max, rowset_min) >= 0) {
+            return false;
+        }
+        prev_max = rowset_max;
+        has_prev = true;
+    }
+    return true;
+}
+
 } // namespace starrocks
@@ -299,6 +299,10 @@ protected:
 
     Status _shortcut_compact(Statistics* statistics);
 
+    // Whether |rowsets| can be concatenated by linking their segment files in order, i.e. they are all
+    // non-overlapping, and the ranges of the leading sort key of them are disjoint and ascending.
+    bool _can_link_rowsets(const std::vector<RowsetSharedPtr>& rowsets) const;
+
 protected:
     CompactionTaskInfo _task_info;
     RuntimeProfile _runtime_profile;
@@ -112,6 +112,77 @@ void CompactionUtils::split_column_into_groups(size_t num_columns, const std::ve
     }
 }
 
+void CompactionUtils::split_column_into_groups(size_t num_columns, const std::vector<ColumnId>& sort_key_idxes,
+                                               int64_t min_columns_per_group, int64_t max_columns_per_group,
+                                               const std::vector<int64_t>& column_mem_footprints,
+                                               int64_t max_group_mem_footprint,
+                                               std::vector<std::vector<uint32_t>>* column_groups) {
+    DCHECK_EQ(num_columns, column_mem_footprints.size());
+    max_columns_per_group = std::max(min_columns_per_group, max_columns_per_group);
+    column_groups->emplace_back(sort_key_idxes);
+    std::vector<ColumnId> tmp_sort_key_idxes(sort_key_idxes.begin(), sort_key_idxes.end());
+    std::sort(tmp_sort_key_idxes.begin(), tmp_sort_key_idxes.end());
+    int64_t group_mem_footprint = 0;
+    bool new_group = true;
+    for (ColumnId i = 0; i < num_columns; ++i) {
+        if (std::binary_search(tmp_sort_key_idxes.begin(), tmp_sort_key_idxes.end(), i)) {
+            continue;
+        }
+        if (!new_group) {
+            auto group_size = static_cast<int64_t>(column_groups->back().size());
+            new_group = group_size >= max_columns_per_group ||
+                        (group_size >= min_columns_per_group &&
+                         group_mem_footprint + column_mem_footprints[i] > max_group_mem_footprint);
+        }
+        if (new_group) {
+            column_groups->emplace_back();
+            group_mem_footprint = 0;
+            new_group = false;
+        }
+        column_groups->back().emplace_back(i);
+        group_mem_footprint += column_mem_footprints[i];
+    }
+}
+
+void CompactionUtils::split_column_into_groups_by_access(size_t num_columns,
+                                                         const std::vector<ColumnId>& sort_key_idxes,
+                                                         int64_t max_columns_per_group,
+                                                         const std::vector<std::vector<ColumnId>>& column_sets,
+                                                         std::vector<std::vector<uint32_t>>* column_groups) {
+    max_columns_per_group = std::max<int64_t>(max_columns_per_group, 1);
+    column_groups->emplace_back(sort_key_idxes);
+    std::vector<bool> assigned(num_columns, false);
+    for (auto cid : sort_key_idxes) {
+        assigned[cid] = true;
+    }
+    auto add_groups = [&](const std::vector<ColumnId>& columns) {
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (i % max_columns_per_group == 0) {
+                column_groups->emplace_back();
+            }
+            column_groups->back().emplace_back(columns[i]);
+        }
+    };
+    for (const auto& column_set : column_sets) {
+        std::vector<ColumnId> columns;
+        for (auto cid : column_set) {
+            if (cid < num_columns && !assigned[cid]) {
+                assigned[cid] = true;
+                columns.emplace_back(cid);
+            }
+        }
+        std::sort(columns.begin(), columns.end());
+        add_groups(columns);
+    }
+    std::vector<ColumnId> rest_columns;
+    for (ColumnId cid = 0; cid < num_columns; ++cid) {
+        if (!assigned[cid]) {
+            rest_columns.emplace_back(cid);
+        }
+    }
+    add_groups(rest_columns);
+}
+
 CompactionAlgorithm CompactionUtils::choose_compaction_algorithm(size_t num_columns, int64_t max_columns_per_group,
                                                                  size_t source_num) {
     // if the number of columns in the schema is less than or equal to max_columns_per_group, use HORIZONTAL_COMPACTION.
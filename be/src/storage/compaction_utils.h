@@ -63,6 +63,23 @@ public:
                                          int64_t max_columns_per_group,
                                          std::vector<std::vector<uint32_t>>* column_groups);
 
+    // Like above, but a non-key group keeps taking columns past |min_columns_per_group|, up to
+    // |max_columns_per_group|, while the sum of |column_mem_footprints| of its columns does not
+    // exceed |max_group_mem_footprint|.
+    static void split_column_into_groups(size_t num_columns, const std::vector<ColumnId>& sort_key_idxes,
+                                         int64_t min_columns_per_group, int64_t max_columns_per_group,
+                                         const std::vector<int64_t>& column_mem_footprints,
+                                         int64_t max_group_mem_footprint,
+                                         std::vector<std::vector<uint32_t>>* column_groups);
+
+    // Like above, but the columns of every set of |column_sets| are put into groups of their own, the earlier
+    // sets first, so that the columns usually read together are contiguous in the output segments. The columns of
+    // no set are grouped in the order of schema.
+    static void split_column_into_groups_by_access(size_t num_columns, const std::vector<ColumnId>& sort_key_idxes,
+                                                   int64_t max_columns_per_group,
+                                                   const std::vector<std::vector<ColumnId>>& column_sets,
+                                                   std::vector<std::vector<uint32_t>>* column_groups);
+
     // choose compaction algorithm according to tablet schema, max columns per group and segment iterator num.
     // 1. if the number of columns in the schema is less than or equal to max_columns_per_group, use HORIZONTAL_COMPACTION.
     // 2. if source_num is less than or equal to 1, or is more than MAX_SOURCES, use HORIZONTAL_COMPACTION.
@@ -34,9 +34,12 @@
 
 #include "storage/data_dir.h"
 
+#include <atomic>
 #include <filesystem>
+#include <functional>
 #include <set>
 #include <sstream>
+#include <unordered_map>
 #include <utility>
 
 #include "common/config.h"
@@ -59,6 +62,7 @@
 #include "util/errno.h"
 #include "util/monotime.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 
 using strings::Substitute;
 
@@ -271,34 +275,142 @@ std::string DataDir::get_root_path_from_schema_hash_path_in_trash(const std::str
 }
 
 // TODO(ygl): deal with rowsets and tablets when load failed
+namespace {
+
+// The number of metas handed over to a loading thread at a time.
+constexpr size_t kLoadMetaBatchSize = 64;
+
+// MetaLoadExecutor loads the metas handed over by the iteration of RocksDB on a thread pool, or on the calling
+// thread if there is no pool. Tasks submitted with the same key run serially in submission order. The submitter
+// blocks when too many tasks are queued, so the metas of a data dir are not all buffered in memory when the
+// loading threads fall behind the iteration.
+class MetaLoadExecutor {
+public:
+    MetaLoadExecutor(ThreadPool* pool, size_t num_keys) : _max_pending(num_keys * 2) {
+        if (pool != nullptr) {
+            for (size_t i = 0; i < num_keys; i++) {
+                _tokens.emplace_back(pool->new_token(ThreadPool::ExecutionMode::SERIAL));
+            }
+        }
+    }
+
+    ~MetaLoadExecutor() { wait(); }
+
+    void submit(int64_t key, std::function<void()> task) {
+        if (_tokens.empty()) {
+            task();
+            return;
+        }
+        {
+            std::unique_lock l(_mutex);
+            _cv.wait(l, [this] { return _pending < _max_pending; });
+            _pending++;
+        }
+        std::function<void()> run = [this, task = std::move(task)]() {
+            task();
+            std::lock_guard l(_mutex);
+            _pending--;
+            _cv.notify_one();
+        };
+        auto& token = _tokens[static_cast<uint64_t>(key) % _tokens.size()];
+        if (!token->submit_func(run).ok()) {
+            run();
+        }
+    }
+
+    void wait() {
+        for (auto& token : _tokens) {
+            token->wait();
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<ThreadPoolToken>> _tokens;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    size_t _pending = 0;
+    const size_t _max_pending;
+};
+
+} // namespace
+
 Status DataDir::load() {
+    // Tablet metas and rowset metas are iterated from RocksDB on this thread, and parsed, initialized and
+    // registered by a thread pool, which dominates the startup time of BEs with many tablets.
+    std::unique_ptr<ThreadPool> load_pool;
+    if (config::load_tablet_meta_threads_per_data_dir > 1) {
+        auto st = ThreadPoolBuilder("load_tablet_meta")
+                          .set_min_threads(0)
+                          .set_max_threads(config::load_tablet_meta_threads_per_data_dir)
+                          .build(&load_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "create thread pool to load tablet meta failed, load serially. path: " << _path
+                         << ", error: " << st;
+            load_pool.reset();
+        }
+    }
+    MetaLoadExecutor executor(load_pool.get(), std::max(config::load_tablet_meta_threads_per_data_dir, 1));
+
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     int64_t load_tablet_start = MonotonicMillis();
     LOG(INFO) << "begin loading tablet from meta " << _path;
+    struct TabletMetaEntry {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string meta;
+    };
+    std::mutex tablet_ids_mutex;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
-        Status st =
-                _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
-        if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
-            // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
-            // This may happen when the tablet was just deleted before the BE restarted,
-            // but it has not been cleared from rocksdb. At this time, restarting the BE
-            // will read the tablet in the DELETE state from rocksdb. These tablets have been
-            // added to the garbage collection queue and will be automatically deleted afterwards.
-            // Therefore, we believe that this situation is not a failure.
-            LOG(WARNING) << "load tablet from header failed. status:" << st.to_string() << ", tablet=" << tablet_id
-                         << "." << schema_hash;
-            failed_tablet_ids.insert(tablet_id);
-        } else {
-            tablet_ids.insert(tablet_id);
+    auto load_tablets = [this, &tablet_ids_mutex, &tablet_ids,
+                         &failed_tablet_ids](const std::vector<TabletMetaEntry>& entries) {
+        for (const auto& entry : entries) {
+            Status st = _tablet_manager->load_tablet_from_meta(this, entry.tablet_id, entry.schema_hash, entry.meta,
+                                                               false, false, false, false);
+            std::lock_guard l(tablet_ids_mutex);
+            if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
+                // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
+                // This may happen when the tablet was just deleted before the BE restarted,
+                // but it has not been cleared from rocksdb. At this time, restarting the BE
+                // will read the tablet in the DELETE state from rocksdb. These tablets have been
+                // added to the garbage collection queue and will be automatically deleted afterwards.
+                // Therefore, we believe that this situation is not a failure.
+                LOG(WARNING) << "load tablet from header failed. status:" << st.to_string()
+                             << ", tablet=" << entry.tablet_id << "." << entry.schema_hash;
+                failed_tablet_ids.insert(entry.tablet_id);
+            } else {
+                tablet_ids.insert(entry.tablet_id);
+            }
+        }
+    };
+    // Batches are grouped by tablet map shard, so that the loading threads do not contend on the shard locks.
+    std::unordered_map<int64_t, std::vector<TabletMetaEntry>> pending_tablets;
+    auto submit_tablets = [&executor, &load_tablets](int64_t shard_idx, std::vector<TabletMetaEntry>* batch) {
+        executor.submit(shard_idx, [&load_tablets, entries = std::move(*batch)]() { load_tablets(entries); });
+        batch->clear();
+    };
+    auto load_tablet_func = [this, &pending_tablets, &submit_tablets](int64_t tablet_id, int32_t schema_hash,
+                                                                      std::string_view value) -> bool {
+        const int64_t shard_idx = _tablet_manager->tablets_shard_idx(tablet_id);
+        auto& batch = pending_tablets[shard_idx];
+        batch.push_back(TabletMetaEntry{tablet_id, schema_hash, std::string(value)});
+        if (batch.size() >= kLoadMetaBatchSize) {
+            submit_tablets(shard_idx, &batch);
         }
         return true;
     };
+    auto finish_load_tablets = [&]() {
+        for (auto& [shard_idx, batch] : pending_tablets) {
+            if (!batch.empty()) {
+                submit_tablets(shard_idx, &batch);
+            }
+        }
+        executor.wait();
+    };
     Status load_tablet_status =
             TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, config::load_tablet_timeout_seconds);
+    finish_load_tablets();
     if (load_tablet_status.is_time_out()) {
         LOG(WARNING) << "load tablets from rocksdb timeout, try to compact meta and retry. path: " << _path;
         Status s = _kv_store->compact();
@@ -317,6 +429,7 @@ Status DataDir::load() {
         tablet_ids.clear();
         failed_tablet_ids.clear();
         load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+        finish_load_tablets();
     }
 
     if (failed_tablet_ids.size() != 0) {
@@ -364,18 +477,21 @@ Status DataDir::load() {
     // VISIBLE: add to tablet
     // if one rowset load failed, then the total data dir will not be loaded
     int64_t load_rowset_start = MonotonicMillis();
-    size_t error_rowset_count = 0;
+    std::atomic<size_t> error_rowset_count{0};
     size_t total_rowset_count = 0;
     LOG(INFO) << "begin loading rowset from meta " << _path;
-    auto load_rowset_func = [&](const TabletUid& tablet_uid, RowsetId rowset_id, std::string_view meta_str) -> bool {
-        total_rowset_count++;
+    struct RowsetMetaEntry {
+        RowsetId rowset_id;
+        std::string meta;
+    };
+    auto load_rowset = [&](const RowsetMetaEntry& entry) {
         bool parsed = false;
-        auto rowset_meta = std::make_shared<RowsetMeta>(meta_str, &parsed);
+        auto rowset_meta = std::make_shared<RowsetMeta>(entry.meta, &parsed);
         if (!parsed) {
-            LOG(WARNING) << "parse rowset meta string failed for rowset_id:" << rowset_id;
-            // return false will break meta iterator, return true to skip this error
+            LOG(WARNING) << "parse rowset meta string failed for rowset_id:" << entry.rowset_id;
+            // skip this error and go on loading the other rowsets
             error_rowset_count++;
-            return true;
+            return;
         }
         TabletSharedPtr tablet = _tablet_manager->get_tablet(rowset_meta->tablet_id(), false);
         // tablet maybe dropped, but not drop related rowset meta
@@ -384,7 +500,7 @@ Status DataDir::load() {
             LOG_EVERY_SECOND(WARNING) << "could not find tablet id: " << rowset_meta->tablet_id()
                                       << " for rowset: " << rowset_meta->rowset_id() << ", skip loading this rowset";
             error_rowset_count++;
-            return true;
+            return;
         }
         RowsetSharedPtr rowset;
         Status create_status =
@@ -393,7 +509,7 @@ Status DataDir::load() {
             LOG(WARNING) << "Fail to create rowset from rowsetmeta,"
                          << " rowset=" << rowset_meta->rowset_id() << " state=" << rowset_meta->rowset_state();
             error_rowset_count++;
-            return true;
+            return;
         }
         if (rowset_meta->rowset_state() == RowsetStatePB::COMMITTED &&
             rowset_meta->tablet_uid() == tablet->tablet_uid()) {
@@ -407,7 +523,7 @@ Status DataDir::load() {
                     LOG(WARNING) << "Failed to save rowset meta, rowset=" << rowset_meta->rowset_id()
                                  << " tablet=" << rowset_meta->tablet_id() << " txn_id: " << rowset_meta->txn_id();
                     error_rowset_count++;
-                    return true;
+                    return;
                 }
             }
             Status commit_txn_status = _txn_manager->commit_txn(
@@ -434,7 +550,7 @@ Status DataDir::load() {
                     LOG(WARNING) << "Failed to save rowset meta, rowset=" << rowset_meta->rowset_id()
                                  << " tablet=" << rowset_meta->tablet_id() << " txn_id: " << rowset_meta->txn_id();
                     error_rowset_count++;
-                    return true;
+                    return;
                 }
             }
             if (!publish_status.ok() && !publish_status.is_already_exist()) {
@@ -451,17 +567,44 @@ Status DataDir::load() {
                          << " current valid tablet uid=" << tablet->tablet_uid();
             error_rowset_count++;
         }
+    };
+    // The rowset metas are ordered by tablet uid. A batch only ends at a tablet boundary, so the rowsets of a tablet
+    // are loaded by one thread.
+    std::vector<RowsetMetaEntry> pending_rowsets;
+    TabletUid pending_tablet_uid(0, 0);
+    int64_t num_rowset_batches = 0;
+    auto submit_rowsets = [&]() {
+        executor.submit(num_rowset_batches++, [&load_rowset, entries = std::move(pending_rowsets)]() {
+            for (const auto& entry : entries) {
+                load_rowset(entry);
+            }
+        });
+        pending_rowsets.clear();
+    };
+    auto load_rowset_func = [&](const TabletUid& tablet_uid, RowsetId rowset_id, std::string_view meta_str) -> bool {
+        total_rowset_count++;
+        if (pending_rowsets.size() >= kLoadMetaBatchSize && !(tablet_uid == pending_tablet_uid)) {
+            submit_rowsets();
+        }
+        pending_tablet_uid = tablet_uid;
+        pending_rowsets.push_back(RowsetMetaEntry{rowset_id, std::string(meta_str)});
         return true;
     };
     Status load_rowset_status = RowsetMetaManager::traverse_rowset_metas(_kv_store, load_rowset_func);
+    if (!pending_rowsets.empty()) {
+        submit_rowsets();
+    }
+    executor.wait();
 
     if (!load_rowset_status.ok()) {
-        LOG(WARNING) << "load rowset from meta finished, data dir: " << _path << " error/total: " << error_rowset_count
-                     << "/" << total_rowset_count << " error: " << load_rowset_status.message()
+        LOG(WARNING) << "load rowset from meta finished, data dir: " << _path
+                     << " error/total: " << error_rowset_count.load() << "/" << total_rowset_count
+                     << " error: " << load_rowset_status.message()
                      << " duration: " << (MonotonicMillis() - load_rowset_start) << "ms";
     } else {
-        LOG(INFO) << "load rowset from meta finished, data dir: " << _path << " error/total: " << error_rowset_count
-                  << "/" << total_rowset_count << " duration: " << (MonotonicMillis() - load_rowset_start) << "ms";
+        LOG(INFO) << "load rowset from meta finished, data dir: " << _path
+                  << " error/total: " << error_rowset_count.load() << "/" << total_rowset_count
+                  << " duration: " << (MonotonicMillis() - load_rowset_start) << "ms";
     }
 
     for (int64_t tablet_id : tablet_ids) {
@@ -475,11 +618,15 @@ Status DataDir::load() {
         // should deal with the case. For example, realtime MV can initialize with the newest full data
         // to skip the lost binlog, and process the new binlog after that. The situation is similar with
         // that the binlog is expired and deleted before the application processes it.
-        Status st = tablet->finish_load_rowsets();
-        if (!st.ok()) {
-            LOG(WARNING) << "Fail to finish loading rowsets, tablet id=" << tablet_id << ", status: " << st.to_string();
-        }
+        executor.submit(tablet_id, [tablet]() {
+            Status st = tablet->finish_load_rowsets();
+            if (!st.ok()) {
+                LOG(WARNING) << "Fail to finish loading rowsets, tablet id=" << tablet->tablet_id()
+                             << ", status: " << st.to_string();
+            }
+        });
     }
+    executor.wait();
 
     return Status::OK();
 }
@@ -0,0 +1,100 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/delete_predicate_bitmap_cache.h"
+
+#include "common/config.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+static void bitmap_deleter(const CacheKey& key, void* value) {
+    delete static_cast<DeletePredicateBitmapCache::BitmapPtr*>(value);
+}
+
+DeletePredicateBitmapCache* DeletePredicateBitmapCache::instance() {
+    static DeletePredicateBitmapCache cache(std::max<int64_t>(config::delete_predicate_bitmap_cache_capacity, 0));
+    return &cache;
+}
+
+DeletePredicateBitmapCache::DeletePredicateBitmapCache(size_t capacity) {
+    if (capacity > 0) {
+        _cache.reset(new_lru_cache(capacity));
+    }
+}
+
+DeletePredicateBitmapCache::~DeletePredicateBitmapCache() = default;
+
+StatusOr<DeletePredicateBitmapCache::BitmapPtr> DeletePredicateBitmapCache::get_or_build(const std::string& key,
+                                                                                        const Builder& builder) {
+    DCHECK(enabled());
+    if (auto bitmap = _lookup(key); bitmap != nullptr) {
+        return bitmap;
+    }
+
+    std::shared_future<StatusOr<BitmapPtr>> building;
+    std::promise<StatusOr<BitmapPtr>> promise;
+    {
+        std::lock_guard l(_mutex);
+        if (auto it = _building.find(key); it != _building.end()) {
+            building = it->second;
+        } else if (auto bitmap = _lookup(key); bitmap != nullptr) {
+            // Built by another caller between the lookup and the lock.
+            return bitmap;
+        } else {
+            _building.emplace(key, promise.get_future().share());
+        }
+    }
+    if (building.valid()) {
+        return building.get();
+    }
+
+    auto bitmap = std::make_shared<Roaring>();
+    Status status = builder(bitmap.get());
+    if (status.ok()) {
+        bitmap->runOptimize();
+        bitmap->shrinkToFit();
+        _insert(key, bitmap);
+    }
+    StatusOr<BitmapPtr> result = status.ok() ? StatusOr<BitmapPtr>(std::move(bitmap)) : StatusOr<BitmapPtr>(status);
+    promise.set_value(result);
+    std::lock_guard l(_mutex);
+    _building.erase(key);
+    return result;
+}
+
+size_t DeletePredicateBitmapCache::memory_usage() const {
+    return _cache != nullptr ? _cache->get_memory_usage() : 0;
+}
+
+DeletePredicateBitmapCache::BitmapPtr DeletePredicateBitmapCache::_lookup(const std::string& key) {
+    Cache::Handle* handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    BitmapPtr bitmap = *static_cast<BitmapPtr*>(_cache->value(handle));
+    _cache->release(handle);
+    return bitmap;
+}
+
+void DeletePredicateBitmapCache::_insert(const std::string& key, const BitmapPtr& bitmap) {
+    auto* value = new BitmapPtr(bitmap);
+    const size_t charge = key.size() + sizeof(Roaring) + bitmap->getSizeInBytes(false);
+    Cache::Handle* handle = _cache->insert(CacheKey(key), value, charge, bitmap_deleter);
+    if (handle != nullptr) {
+        _cache->release(handle);
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,69 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/statusor.h"
+#include "gutil/macros.h"
+#include "storage/del_vector.h"
+
+namespace starrocks {
+
+class Cache;
+
+// DeletePredicateBitmapCache keeps the rows of segments deleted by the delete predicates of duplicate and aggregate
+// key tables. Those tables store `DELETE FROM ... WHERE` as delete predicates, which every scan of the older rowsets
+// evaluates row by row until a base compaction rewrites them. A segment evaluates them once into a bitmap instead,
+// the same way as the delete vectors of primary key tables, and the following scans subtract the bitmap from their
+// row ranges.
+//
+// Segment files are immutable, so an entry keyed by the segment file and the delete predicates never goes stale.
+// Concurrent builds of the same entry are merged, the later callers wait for the first one.
+class DeletePredicateBitmapCache {
+public:
+    using BitmapPtr = std::shared_ptr<const Roaring>;
+    using Builder = std::function<Status(Roaring*)>;
+
+    static DeletePredicateBitmapCache* instance();
+
+    ~DeletePredicateBitmapCache();
+
+    bool enabled() const { return _cache != nullptr; }
+
+    // Return the deleted rows of |key|, they are built by |builder| on miss.
+    StatusOr<BitmapPtr> get_or_build(const std::string& key, const Builder& builder);
+
+    size_t memory_usage() const;
+
+private:
+    explicit DeletePredicateBitmapCache(size_t capacity);
+    DISALLOW_COPY_AND_MOVE(DeletePredicateBitmapCache);
+
+    BitmapPtr _lookup(const std::string& key);
+    void _insert(const std::string& key, const BitmapPtr& bitmap);
+
+    std::unique_ptr<Cache> _cache;
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::shared_future<StatusOr<BitmapPtr>>> _building;
+};
+
+} // namespace starrocks
@@ -0,0 +1,245 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/inverted/builtin/builtin_inverted_format.h"
+
+#include <algorithm>
+
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+
+namespace starrocks::builtin_inverted {
+
+void Footer::encode_to(faststring* dst) const {
+    put_fixed64_le(dst, dictionary_offset);
+    put_fixed64_le(dst, term_index_offset);
+    put_fixed64_le(dst, null_bitmap_offset);
+    put_fixed32_le(dst, num_docs);
+    put_fixed32_le(dst, num_terms);
+    put_fixed32_le(dst, tokenized);
+    put_fixed32_le(dst, kFormatVersion);
+    put_fixed32_le(dst, kMagic);
+}
+
+Status Footer::decode_from(const Slice& src) {
+    if (src.size != kFooterSize) {
+        return Status::Corruption("bad builtin inverted index footer size");
+    }
+    const auto* p = reinterpret_cast<const uint8_t*>(src.data);
+    if (decode_fixed32_le(p + 40) != kMagic) {
+        return Status::Corruption("bad builtin inverted index magic");
+    }
+    if (decode_fixed32_le(p + 36) != kFormatVersion) {
+        return Status::NotSupported("unknown builtin inverted index format version");
+    }
+    dictionary_offset = decode_fixed64_le(p);
+    term_index_offset = decode_fixed64_le(p + 8);
+    null_bitmap_offset = decode_fixed64_le(p + 16);
+    num_docs = decode_fixed32_le(p + 24);
+    num_terms = decode_fixed32_le(p + 28);
+    tokenized = decode_fixed32_le(p + 32);
+    if (dictionary_offset > term_index_offset || term_index_offset > null_bitmap_offset) {
+        return Status::Corruption("bad builtin inverted index section offsets");
+    }
+    return Status::OK();
+}
+
+bool wildcard_match(std::string_view pattern, std::string_view text) {
+    size_t p = 0;
+    size_t t = 0;
+    // the position after the last '*' in the pattern, and the text position it's matched to
+    size_t star_p = std::string_view::npos;
+    size_t star_t = 0;
+    while (t < text.size()) {
+        if (p < pattern.size() && (pattern[p] == '*' || pattern[p] == '%')) {
+            star_p = ++p;
+            star_t = t;
+        } else if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == text[t])) {
+            p++;
+            t++;
+        } else if (star_p != std::string_view::npos) {
+            p = star_p;
+            t = ++star_t;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && (pattern[p] == '*' || pattern[p] == '%')) {
+        p++;
+    }
+    return p == pattern.size();
+}
+
+static int required_bits(uint32_t value) {
+    return value == 0 ? 0 : 32 - __builtin_clz(value);
+}
+
+// A full block is the bit width followed by kDocsPerBlock bit-packed deltas, and the last partial
+// block is varint deltas. A delta is the distance to the previous doc id minus one.
+static size_t packed_doc_ids_size(const std::vector<uint32_t>& doc_ids) {
+    size_t size = 1;
+    uint32_t prev = 0;
+    for (size_t i = 0; i < doc_ids.size(); i += kDocsPerBlock) {
+        size_t n = std::min<size_t>(kDocsPerBlock, doc_ids.size() - i);
+        uint32_t max_delta = 0;
+        for (size_t j = i; j < i + n; j++) {
+            uint32_t delta = doc_ids[j] - prev - (j > 0);
+            max_delta |= delta;
+            size += n < kDocsPerBlock ? varint_length(delta) : 0;
+            prev = doc_ids[j];
+        }
+        size += n < kDocsPerBlock ? 0 : 1 + kDocsPerBlock * required_bits(max_delta) / 8;
+    }
+    return size;
+}
+
+void encode_doc_ids(const std::vector<uint32_t>& doc_ids, faststring* dst) {
+    if (doc_ids.size() >= kDocsPerBlock) {
+        roaring::Roaring bitmap(doc_ids.size(), doc_ids.data());
+        bitmap.runOptimize();
+        size_t roaring_size = bitmap.getSizeInBytes(true);
+        if (roaring_size + 1 < packed_doc_ids_size(doc_ids)) {
+            dst->push_back(ROARING);
+            size_t offset = dst->size();
+            dst->resize(offset + roaring_size);
+            bitmap.write(reinterpret_cast<char*>(dst->data() + offset), true);
+            return;
+        }
+    }
+
+    dst->push_back(PACKED);
+    uint32_t deltas[kDocsPerBlock];
+    faststring packed;
+    uint32_t prev = 0;
+    for (size_t i = 0; i < doc_ids.size(); i += kDocsPerBlock) {
+        size_t n = std::min<size_t>(kDocsPerBlock, doc_ids.size() - i);
+        uint32_t max_delta = 0;
+        for (size_t j = 0; j < n; j++) {
+            deltas[j] = doc_ids[i + j] - prev - (i + j > 0);
+            max_delta |= deltas[j];
+            prev = doc_ids[i + j];
+        }
+        if (n < kDocsPerBlock) {
+            for (size_t j = 0; j < n; j++) {
+                put_varint32(dst, deltas[j]);
+            }
+            break;
+        }
+        int bit_width = required_bits(max_delta);
+        dst->push_back(static_cast<char>(bit_width));
+        if (bit_width == 0) {
+            continue;
+        }
+        BitWriter writer(&packed);
+        for (uint32_t delta : deltas) {
+            writer.PutValue(delta, bit_width);
+        }
+        writer.Flush();
+        dst->append(packed.data(), packed.size());
+    }
+}
+
+void encode_positions(const std::vector<uint32_t>& freqs, const std::vector<uint32_t>& positions, faststring* dst) {
+    size_t next = 0;
+    for (uint32_t freq : freqs) {
+        put_varint32(dst, freq);
+        uint32_t prev = 0;
+        for (uint32_t i = 0; i < freq; i++, next++) {
+            put_varint32(dst, positions[next] - prev);
+            prev = positions[next];
+        }
+    }
+}
+
+template <typename Consumer>
+static Status decode_packed_doc_ids(const Slice& src, uint32_t doc_freq, Consumer&& consumer) {
+    const auto* p = reinterpret_cast<const uint8_t*>(src.data);
+    const auto* limit = p + src.size;
+    uint32_t docs[kDocsPerBlock];
+    uint32_t prev = 0;
+    bool first = true;
+    uint32_t remaining = doc_freq;
+    while (remaining >= kDocsPerBlock) {
+        if (p >= limit) {
+            return Status::Corruption("truncated builtin inverted index postings");
+        }
+        int bit_width = *p++;
+        size_t packed_size = kDocsPerBlock * bit_width / 8;
+        if (bit_width > 32 || p + packed_size > limit) {
+            return Status::Corruption("bad builtin inverted index postings block");
+        }
+        if (bit_width == 0) {
+            std::fill(docs, docs + kDocsPerBlock, 0);
+        } else {
+            BitPacking::UnpackValues(bit_width, p, packed_size, kDocsPerBlock, docs);
+        }
+        p += packed_size;
+        // prefix sum of the deltas
+        docs[0] += prev + !first;
+        for (uint32_t i = 1; i < kDocsPerBlock; i++) {
+            docs[i] += docs[i - 1] + 1;
+        }
+        prev = docs[kDocsPerBlock - 1];
+        first = false;
+        consumer(docs, kDocsPerBlock);
+        remaining -= kDocsPerBlock;
+    }
+    for (uint32_t i = 0; i < remaining; i++) {
+        uint32_t delta;
+        p = decode_varint32_ptr(p, limit, &delta);
+        if (p == nullptr) {
+            return Status::Corruption("truncated builtin inverted index postings");
+        }
+        docs[i] = prev + delta + !first;
+        prev = docs[i];
+        first = false;
+    }
+    if (remaining > 0) {
+        consumer(docs, remaining);
+    }
+    return Status::OK();
+}
+
+Status decode_doc_ids(const Slice& src, uint32_t doc_freq, roaring::Roaring* result) {
+    if (src.size == 0) {
+        return Status::Corruption("empty builtin inverted index postings");
+    }
+    Slice body(src.data + 1, src.size - 1);
+    if (src.data[0] == ROARING) {
+        *result |= roaring::Roaring::readSafe(body.data, body.size);
+        return Status::OK();
+    }
+    return decode_packed_doc_ids(body, doc_freq, [&](const uint32_t* docs, size_t n) { result->addMany(n, docs); });
+}
+
+Status decode_doc_ids(const Slice& src, uint32_t doc_freq, std::vector<uint32_t>* doc_ids) {
+    if (src.size == 0) {
+        return Status::Corruption("empty builtin inverted index postings");
+    }
+    Slice body(src.data + 1, src.size - 1);
+    doc_ids->clear();
+    doc_ids->reserve(doc_freq);
+    if (src.data[0] == ROARING) {
+        auto bitmap = roaring::Roaring::readSafe(body.data, body.size);
+        doc_ids->resize(bitmap.cardinality());
+        bitmap.toUint32Array(doc_ids->data());
+        return Status::OK();
+    }
+    return decode_packed_doc_ids(body, doc_freq, [&](const uint32_t* docs, size_t n) {
+        doc_ids->insert(doc_ids->end(), docs, docs + n);
+    });
+}
+
+} // namespace starrocks::builtin_inverted
@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/status.h"
+#include "roaring/roaring.hh"
+#include "storage/inverted/inverted_index_common.hpp"
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace starrocks::builtin_inverted {
+
+// The builtin inverted index of a segment column is a single file in the index directory of the segment, so
+// it's linked, copied, cloned and deleted together with the segment like the CLucene index.
+//
+//   +-------------+--------------------------------------------------------------------+
+//   | postings    | the doc ids, and the positions for a tokenized index, of each term |
+//   +-------------+--------------------------------------------------------------------+
+//   | dictionary  | blocks of up to kTermsPerBlock sorted and front coded terms        |
+//   +-------------+--------------------------------------------------------------------+
+//   | term index  | the first term, offset and size of each dictionary block           |
+//   +-------------+--------------------------------------------------------------------+
+//   | null bitmap | the portable serialized roaring bitmap of null rows                |
+//   +-------------+--------------------------------------------------------------------+
+//   | footer      | the offsets of the sections and the counters, kFooterSize bytes    |
+//   +-------------+--------------------------------------------------------------------+
+//
+// The doc ids of a term are either bit-packed in blocks of kDocsPerBlock deltas, which are decoded with the
+// unrolled BitPacking kernels, or a serialized roaring bitmap if it's smaller, which is the case for the
+// common terms, so that a term query never decodes more than one integer per row.
+inline const std::string kIndexFileName = "builtin.idx";
+constexpr uint32_t kMagic = 0x42494458; // "BIDX"
+constexpr uint32_t kFormatVersion = 1;
+constexpr size_t kFooterSize = 8 * 3 + 4 * 5;
+constexpr uint32_t kTermsPerBlock = 64;
+constexpr uint32_t kDocsPerBlock = 128;
+
+enum DocIdsEncoding : uint8_t {
+    PACKED = 0,
+    ROARING = 1,
+};
+
+struct Footer {
+    uint64_t dictionary_offset = 0;
+    uint64_t term_index_offset = 0;
+    uint64_t null_bitmap_offset = 0;
+    uint32_t num_docs = 0;
+    uint32_t num_terms = 0;
+    uint32_t tokenized = 0;
+
+    void encode_to(faststring* dst) const;
+    Status decode_from(const Slice& src);
+};
+
+// The location of the postings of a term.
+struct TermInfo {
+    uint32_t doc_freq = 0;
+    uint64_t postings_offset = 0;
+    uint32_t doc_ids_size = 0;
+    uint32_t positions_size = 0;
+};
+
+// Split |text| into terms with the parser of the index, and call |fn(term, position)| for each term.
+// PARSER_NONE indexes the whole value as a single term. PARSER_STANDARD splits at characters other than
+// letters and digits, and PARSER_ENGLISH at characters other than letters, and both lower the ASCII
+// letters. Non-ASCII bytes are kept in terms, so that UTF-8 words are not broken.
+template <typename Fn>
+void tokenize(InvertedIndexParserType parser_type, const Slice& text, std::string* buffer, Fn&& fn) {
+    if (parser_type == InvertedIndexParserType::PARSER_NONE) {
+        fn(std::string_view(text.data, text.size), 0);
+        return;
+    }
+    const bool keep_digits = parser_type == InvertedIndexParserType::PARSER_STANDARD;
+    uint32_t position = 0;
+    buffer->clear();
+    for (size_t i = 0; i <= text.size; i++) {
+        const uint8_t c = i < text.size ? static_cast<uint8_t>(text.data[i]) : ' ';
+        if (c >= 'A' && c <= 'Z') {
+            buffer->push_back(c - 'A' + 'a');
+        } else if ((c >= 'a' && c <= 'z') || c >= 0x80 || (keep_digits && c >= '0' && c <= '9')) {
+            buffer->push_back(c);
+        } else if (!buffer->empty()) {
+            fn(std::string_view(*buffer), position++);
+            buffer->clear();
+        }
+    }
+}
+
+// Match |text| with a wildcard |pattern|, in which '*' and '%' match any bytes, and '?' matches one byte.
+bool wildcard_match(std::string_view pattern, std::string_view text);
+
+// Encode the ascending |doc_ids| of a term.
+void encode_doc_ids(const std::vector<uint32_t>& doc_ids, faststring* dst);
+
+// Encode the positions of a term, |freqs| is the number of positions in each doc.
+void encode_positions(const std::vector<uint32_t>& freqs, const std::vector<uint32_t>& positions, faststring* dst);
+
+// Add the |doc_freq| doc ids encoded in |src| to |result|.
+Status decode_doc_ids(const Slice& src, uint32_t doc_freq, roaring::Roaring* result);
+
+// Decode the |doc_freq| doc ids encoded in |src| into |doc_ids| in ascending order.
+Status decode_doc_ids(const Slice& src, uint32_t doc_freq, std::vector<uint32_t>* doc_ids);
+
+} // namespace starrocks::builtin_inverted
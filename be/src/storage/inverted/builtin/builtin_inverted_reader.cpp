@@ -0,0 +1,383 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/inverted/builtin/builtin_inverted_reader.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "fs/fs.h"
+#include "storage/inverted/inverted_index_iterator.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+#include "util/raw_container.h"
+
+namespace starrocks {
+
+using namespace builtin_inverted;
+
+// Iterate the front coded terms of a dictionary block.
+class TermBlockCursor {
+public:
+    explicit TermBlockCursor(const Slice& block) : _data(block) {}
+
+    // Return false at the end of the block.
+    StatusOr<bool> next() {
+        if (_data.size == 0) {
+            return false;
+        }
+        uint32_t shared;
+        uint32_t suffix_size;
+        if (!get_varint32(&_data, &shared) || !get_varint32(&_data, &suffix_size) || shared > _term.size() ||
+            suffix_size > _data.size) {
+            return Status::Corruption("bad builtin inverted index dictionary block");
+        }
+        _term.resize(shared);
+        _term.append(_data.data, suffix_size);
+        _data.remove_prefix(suffix_size);
+        if (!get_varint32(&_data, &_info.doc_freq) || !get_varint64(&_data, &_info.postings_offset) ||
+            !get_varint32(&_data, &_info.doc_ids_size) || !get_varint32(&_data, &_info.positions_size)) {
+            return Status::Corruption("bad builtin inverted index dictionary block");
+        }
+        return true;
+    }
+
+    const std::string& term() const { return _term; }
+
+    const TermInfo& info() const { return _info; }
+
+private:
+    Slice _data;
+    std::string _term;
+    TermInfo _info;
+};
+
+BuiltinInvertedReader::BuiltinInvertedReader(std::string path, uint32_t index_id,
+                                             InvertedIndexParserType parser_type)
+        : InvertedReader(std::move(path), index_id), _parser_type(parser_type) {}
+
+BuiltinInvertedReader::~BuiltinInvertedReader() = default;
+
+Status BuiltinInvertedReader::create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                                     LogicalType field_type, std::unique_ptr<InvertedReader>* res) {
+    if (!is_string_type(field_type)) {
+        return Status::InvalidArgument(fmt::format("Not supported type {}", field_type));
+    }
+    InvertedIndexParserType parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(tablet_index->index_properties()));
+    *res = std::make_unique<BuiltinInvertedReader>(path, tablet_index->index_id(), parser_type);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::new_iterator(const std::shared_ptr<TabletIndex> index_meta,
+                                           InvertedIndexIterator** iterator) {
+    *iterator = new InvertedIndexIterator(index_meta, this);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_load() {
+    return success_once(_load_once,
+                        [&]() -> Status {
+                            std::string file_path = _index_path + "/" + kIndexFileName;
+                            ASSIGN_OR_RETURN(_file, FileSystem::Default()->new_random_access_file(file_path));
+                            ASSIGN_OR_RETURN(int64_t file_size, _file->get_size());
+                            if (file_size < static_cast<int64_t>(kFooterSize)) {
+                                return Status::Corruption(fmt::format("bad inverted index file {}", file_path));
+                            }
+                            char footer_buf[kFooterSize];
+                            RETURN_IF_ERROR(_file->read_at_fully(file_size - kFooterSize, footer_buf, kFooterSize));
+                            RETURN_IF_ERROR(_footer.decode_from(Slice(footer_buf, kFooterSize)));
+                            uint64_t footer_offset = file_size - kFooterSize;
+                            if (_footer.null_bitmap_offset > footer_offset) {
+                                return Status::Corruption(fmt::format("bad inverted index file {}", file_path));
+                            }
+
+                            std::string buf;
+                            raw::stl_string_resize_uninitialized(&buf, footer_offset - _footer.term_index_offset);
+                            RETURN_IF_ERROR(_file->read_at_fully(_footer.term_index_offset, buf.data(), buf.size()));
+                            size_t term_index_size = _footer.null_bitmap_offset - _footer.term_index_offset;
+                            Slice term_index(buf.data(), term_index_size);
+                            while (term_index.size > 0) {
+                                Slice first_term;
+                                uint64_t offset;
+                                uint32_t size;
+                                if (!get_length_prefixed_slice(&term_index, &first_term) ||
+                                    !get_varint64(&term_index, &offset) || !get_varint32(&term_index, &size)) {
+                                    return Status::Corruption(fmt::format("bad inverted index file {}", file_path));
+                                }
+                                _block_first_terms.emplace_back(first_term.data, first_term.size);
+                                _block_offsets.push_back(offset);
+                                _block_sizes.push_back(size);
+                            }
+                            _null_bitmap = roaring::Roaring::readSafe(buf.data() + term_index_size,
+                                                                      buf.size() - term_index_size);
+                            return Status::OK();
+                        })
+            .status();
+}
+
+template <typename Fn>
+Status BuiltinInvertedReader::_scan_terms(std::string_view from, Fn&& fn) {
+    // the last block whose first term is not greater than |from|
+    auto it = std::upper_bound(_block_first_terms.begin(), _block_first_terms.end(), from);
+    size_t block = it == _block_first_terms.begin() ? 0 : it - _block_first_terms.begin() - 1;
+    std::string buf;
+    for (; block < _block_first_terms.size(); block++) {
+        raw::stl_string_resize_uninitialized(&buf, _block_sizes[block]);
+        RETURN_IF_ERROR(_file->read_at_fully(_block_offsets[block], buf.data(), buf.size()));
+        TermBlockCursor cursor(Slice(buf.data(), buf.size()));
+        while (true) {
+            ASSIGN_OR_RETURN(bool has_next, cursor.next());
+            if (!has_next) {
+                break;
+            }
+            if (cursor.term() < from) {
+                continue;
+            }
+            ASSIGN_OR_RETURN(bool more, fn(cursor.term(), cursor.info()));
+            if (!more) {
+                return Status::OK();
+            }
+        }
+    }
+    return Status::OK();
+}
+
+StatusOr<bool> BuiltinInvertedReader::_find_term(std::string_view term, TermInfo* info) {
+    bool found = false;
+    RETURN_IF_ERROR(_scan_terms(term, [&](const std::string& current, const TermInfo& current_info) -> StatusOr<bool> {
+        if (current == term) {
+            found = true;
+            *info = current_info;
+        }
+        return false;
+    }));
+    return found;
+}
+
+Status BuiltinInvertedReader::_read_doc_ids(const TermInfo& info, roaring::Roaring* result) {
+    std::string buf;
+    raw::stl_string_resize_uninitialized(&buf, info.doc_ids_size);
+    RETURN_IF_ERROR(_file->read_at_fully(info.postings_offset, buf.data(), buf.size()));
+    return decode_doc_ids(Slice(buf.data(), buf.size()), info.doc_freq, result);
+}
+
+std::vector<std::string> BuiltinInvertedReader::_analyze(const Slice& query) const {
+    std::vector<std::string> terms;
+    std::string buffer;
+    tokenize(_parser_type, query, &buffer, [&](std::string_view term, uint32_t) { terms.emplace_back(term); });
+    return terms;
+}
+
+StatusOr<bool> BuiltinInvertedReader::_find_terms(const std::vector<std::string>& terms,
+                                                  std::vector<TermInfo>* infos) {
+    infos->resize(terms.size());
+    for (size_t i = 0; i < terms.size(); i++) {
+        ASSIGN_OR_RETURN(bool found, _find_term(terms[i], &(*infos)[i]));
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Status BuiltinInvertedReader::_intersect(std::vector<TermInfo> infos, roaring::Roaring* result) {
+    // intersect from the rarest term
+    std::sort(infos.begin(), infos.end(), [](const auto& a, const auto& b) { return a.doc_freq < b.doc_freq; });
+    roaring::Roaring docs;
+    for (size_t i = 0; i < infos.size(); i++) {
+        roaring::Roaring term_docs;
+        RETURN_IF_ERROR(_read_doc_ids(infos[i], &term_docs));
+        if (i == 0) {
+            docs.swap(term_docs);
+        } else {
+            docs &= term_docs;
+        }
+        if (docs.isEmpty()) {
+            break;
+        }
+    }
+    result->swap(docs);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_query_terms(const std::vector<std::string>& terms, roaring::Roaring* result) {
+    std::vector<TermInfo> infos;
+    ASSIGN_OR_RETURN(bool found, _find_terms(terms, &infos));
+    if (!found) {
+        return Status::OK();
+    }
+    return _intersect(std::move(infos), result);
+}
+
+// Decode the positions of a term in the docs |targets|, which are a subset of the docs of the term.
+static Status read_positions(const Slice& postings, const TermInfo& info, const std::vector<uint32_t>& targets,
+                             std::vector<std::vector<uint32_t>>* positions) {
+    std::vector<uint32_t> doc_ids;
+    RETURN_IF_ERROR(decode_doc_ids(Slice(postings.data, info.doc_ids_size), info.doc_freq, &doc_ids));
+    const auto* p = reinterpret_cast<const uint8_t*>(postings.data) + info.doc_ids_size;
+    const auto* limit = reinterpret_cast<const uint8_t*>(postings.data) + postings.size;
+    positions->assign(targets.size(), {});
+    size_t next_target = 0;
+    for (uint32_t doc_id : doc_ids) {
+        if (next_target == targets.size()) {
+            break;
+        }
+        uint32_t freq;
+        if ((p = decode_varint32_ptr(p, limit, &freq)) == nullptr) {
+            return Status::Corruption("truncated builtin inverted index positions");
+        }
+        bool is_target = doc_id == targets[next_target];
+        uint32_t position = 0;
+        for (uint32_t i = 0; i < freq; i++) {
+            uint32_t delta;
+            if ((p = decode_varint32_ptr(p, limit, &delta)) == nullptr) {
+                return Status::Corruption("truncated builtin inverted index positions");
+            }
+            position += delta;
+            if (is_target) {
+                (*positions)[next_target].push_back(position);
+            }
+        }
+        next_target += is_target;
+    }
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_query_phrase(const std::vector<std::string>& terms, roaring::Roaring* result) {
+    std::vector<TermInfo> infos;
+    ASSIGN_OR_RETURN(bool found, _find_terms(terms, &infos));
+    if (!found) {
+        return Status::OK();
+    }
+    roaring::Roaring candidates;
+    RETURN_IF_ERROR(_intersect(infos, &candidates));
+    if (candidates.isEmpty()) {
+        return Status::OK();
+    }
+    std::vector<uint32_t> targets(candidates.cardinality());
+    candidates.toUint32Array(targets.data());
+
+    // positions[i][j] is the positions of terms[i] in targets[j]
+    std::vector<std::vector<std::vector<uint32_t>>> positions(terms.size());
+    std::string buf;
+    for (size_t i = 0; i < terms.size(); i++) {
+        raw::stl_string_resize_uninitialized(&buf, infos[i].doc_ids_size + infos[i].positions_size);
+        RETURN_IF_ERROR(_file->read_at_fully(infos[i].postings_offset, buf.data(), buf.size()));
+        RETURN_IF_ERROR(read_positions(Slice(buf.data(), buf.size()), infos[i], targets, &positions[i]));
+    }
+    for (size_t j = 0; j < targets.size(); j++) {
+        for (uint32_t start : positions[0][j]) {
+            bool matched = true;
+            for (size_t i = 1; i < terms.size() && matched; i++) {
+                matched = std::binary_search(positions[i][j].begin(), positions[i][j].end(), start + i);
+            }
+            if (matched) {
+                result->add(targets[j]);
+                break;
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_query_wildcard(const std::string& pattern, roaring::Roaring* result) {
+    std::string prefix = pattern.substr(0, pattern.find_first_of("*%?"));
+    return _scan_terms(prefix, [&](const std::string& term, const TermInfo& info) -> StatusOr<bool> {
+        if (term.compare(0, prefix.size(), prefix) != 0) {
+            return false;
+        }
+        if (wildcard_match(pattern, term)) {
+            RETURN_IF_ERROR(_read_doc_ids(info, result));
+        }
+        return true;
+    });
+}
+
+Status BuiltinInvertedReader::_query_range(const std::string& bound, bool less, bool inclusive,
+                                           roaring::Roaring* result) {
+    return _scan_terms(less ? std::string_view() : std::string_view(bound),
+                       [&](const std::string& term, const TermInfo& info) -> StatusOr<bool> {
+                           int cmp = term.compare(bound);
+                           if (less && (cmp > 0 || (cmp == 0 && !inclusive))) {
+                               return false;
+                           }
+                           if (less || cmp > 0 || inclusive) {
+                               RETURN_IF_ERROR(_read_doc_ids(info, result));
+                           }
+                           return true;
+                       });
+}
+
+Status BuiltinInvertedReader::query(OlapReaderStatistics* stats, const std::string& column_name,
+                                    const void* query_value, InvertedIndexQueryType query_type,
+                                    roaring::Roaring* bit_map) {
+    RETURN_IF_ERROR(_load());
+    const auto* search_query = reinterpret_cast<const Slice*>(query_value);
+    Slice query(search_query->data, strnlen(search_query->data, search_query->size));
+    const bool tokenized = _footer.tokenized;
+
+    roaring::Roaring result;
+    switch (query_type) {
+    case InvertedIndexQueryType::MATCH_ALL_QUERY:
+    case InvertedIndexQueryType::EQUAL_QUERY:
+        RETURN_IF_ERROR(_query_terms(_analyze(query), &result));
+        break;
+    case InvertedIndexQueryType::MATCH_PHRASE_QUERY: {
+        auto terms = _analyze(query);
+        if (tokenized && terms.size() > 1) {
+            RETURN_IF_ERROR(_query_phrase(terms, &result));
+        } else {
+            RETURN_IF_ERROR(_query_terms(terms, &result));
+        }
+        break;
+    }
+    case InvertedIndexQueryType::LESS_THAN_QUERY:
+        RETURN_IF_ERROR(_query_range(query.to_string(), true, false, &result));
+        break;
+    case InvertedIndexQueryType::LESS_EQUAL_QUERY:
+        RETURN_IF_ERROR(_query_range(query.to_string(), true, true, &result));
+        break;
+    case InvertedIndexQueryType::GREATER_THAN_QUERY:
+        RETURN_IF_ERROR(_query_range(query.to_string(), false, false, &result));
+        break;
+    case InvertedIndexQueryType::GREATER_EQUAL_QUERY:
+        RETURN_IF_ERROR(_query_range(query.to_string(), false, true, &result));
+        break;
+    case InvertedIndexQueryType::MATCH_WILDCARD_QUERY: {
+        std::string pattern = query.to_string();
+        if (tokenized) {
+            std::transform(pattern.begin(), pattern.end(), pattern.begin(),
+                           [](char c) { return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c; });
+        }
+        RETURN_IF_ERROR(_query_wildcard(pattern, &result));
+        break;
+    }
+    default:
+        return Status::InvalidArgument("Unknown query type");
+    }
+    bit_map->swap(result);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::query_null(OlapReaderStatistics* stats, const std::string& column_name,
+                                         roaring::Roaring* bit_map) {
+    RETURN_IF_ERROR(_load());
+    *bit_map = _null_bitmap;
+    return Status::OK();
+}
+
+} // namespace starrocks
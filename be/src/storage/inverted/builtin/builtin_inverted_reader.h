@@ -0,0 +1,91 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/inverted/builtin/builtin_inverted_format.h"
+#include "storage/inverted/inverted_reader.h"
+#include "util/once.h"
+
+namespace starrocks {
+
+class RandomAccessFile;
+
+// Query the builtin inverted index of a segment column. The term index and the null bitmap are loaded on the
+// first query, and the dictionary blocks and postings are read on demand.
+class BuiltinInvertedReader final : public InvertedReader {
+public:
+    BuiltinInvertedReader(std::string path, uint32_t index_id, InvertedIndexParserType parser_type);
+
+    ~BuiltinInvertedReader() override;
+
+    static Status create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                         LogicalType field_type, std::unique_ptr<InvertedReader>* res);
+
+    Status new_iterator(const std::shared_ptr<TabletIndex> index_meta, InvertedIndexIterator** iterator) override;
+
+    Status query(OlapReaderStatistics* stats, const std::string& column_name, const void* query_value,
+                 InvertedIndexQueryType query_type, roaring::Roaring* bit_map) override;
+
+    Status query_null(OlapReaderStatistics* stats, const std::string& column_name, roaring::Roaring* bit_map) override;
+
+    InvertedIndexReaderType get_inverted_index_reader_type() override { return InvertedIndexReaderType::TEXT; }
+
+private:
+    Status _load();
+
+    // Call |fn(term, term_info)| for the terms not less than |from| in order until it returns false.
+    template <typename Fn>
+    Status _scan_terms(std::string_view from, Fn&& fn);
+
+    StatusOr<bool> _find_term(std::string_view term, builtin_inverted::TermInfo* info);
+
+    // Return false if any of the |terms| does not exist
+    StatusOr<bool> _find_terms(const std::vector<std::string>& terms, std::vector<builtin_inverted::TermInfo>* infos);
+
+    Status _read_doc_ids(const builtin_inverted::TermInfo& info, roaring::Roaring* result);
+
+    Status _intersect(std::vector<builtin_inverted::TermInfo> infos, roaring::Roaring* result);
+
+    // Rows containing all the |terms|
+    Status _query_terms(const std::vector<std::string>& terms, roaring::Roaring* result);
+
+    // Rows containing the |terms| at consecutive positions
+    Status _query_phrase(const std::vector<std::string>& terms, roaring::Roaring* result);
+
+    // Rows containing a term matching the wildcard |pattern|
+    Status _query_wildcard(const std::string& pattern, roaring::Roaring* result);
+
+    // Rows containing a term in the range
+    Status _query_range(const std::string& bound, bool less, bool inclusive, roaring::Roaring* result);
+
+    std::vector<std::string> _analyze(const Slice& query) const;
+
+    InvertedIndexParserType _parser_type;
+
+    OnceFlag _load_once;
+    std::unique_ptr<RandomAccessFile> _file;
+    builtin_inverted::Footer _footer;
+    // the first term, offset and size of each dictionary block
+    std::vector<std::string> _block_first_terms;
+    std::vector<uint64_t> _block_offsets;
+    std::vector<uint32_t> _block_sizes;
+    roaring::Roaring _null_bitmap;
+};
+
+} // namespace starrocks
@@ -0,0 +1,185 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/inverted/builtin/builtin_inverted_writer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "fs/fs.h"
+#include "fs/fs_util.h"
+#include "gutil/strings/substitute.h"
+#include "storage/inverted/builtin/builtin_inverted_format.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+
+namespace starrocks {
+
+using namespace builtin_inverted;
+
+BuiltinInvertedWriter::BuiltinInvertedWriter(std::string directory, InvertedIndexParserType parser_type,
+                                             bool is_char)
+        : _directory(std::move(directory)),
+          _parser_type(parser_type),
+          _tokenized(parser_type != InvertedIndexParserType::PARSER_NONE),
+          _is_char(is_char) {}
+
+Status BuiltinInvertedWriter::create(const TypeInfoPtr& typeinfo, const std::string& directory,
+                                     TabletIndex* tablet_index, std::unique_ptr<InvertedWriter>* res) {
+    LogicalType type = typeinfo->type();
+    if (type != LogicalType::TYPE_CHAR && type != LogicalType::TYPE_VARCHAR) {
+        return Status::NotSupported(
+                strings::Substitute("Unsupported type for builtin inverted index: $0", type_to_string_v2(type)));
+    }
+    auto parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(tablet_index->index_properties()));
+    if (parser_type != InvertedIndexParserType::PARSER_NONE &&
+        parser_type != InvertedIndexParserType::PARSER_STANDARD &&
+        parser_type != InvertedIndexParserType::PARSER_ENGLISH) {
+        return Status::NotSupported(strings::Substitute("Unsupported parser for builtin inverted index: $0",
+                                                        inverted_index_parser_type_to_string(parser_type)));
+    }
+    *res = std::make_unique<BuiltinInvertedWriter>(directory, parser_type, type == LogicalType::TYPE_CHAR);
+    return Status::OK();
+}
+
+Status BuiltinInvertedWriter::init() {
+    return fs::create_directories(_directory);
+}
+
+void BuiltinInvertedWriter::_add_term(std::string_view term, uint32_t position) {
+    auto it = _term_ids.find(term);
+    if (it == _term_ids.end()) {
+        it = _term_ids.emplace(std::string(term), _postings.size()).first;
+        _postings.emplace_back();
+        _mem_bytes += term.size() + sizeof(Postings) + 32;
+    }
+    Postings& postings = _postings[it->second];
+    if (postings.doc_ids.empty() || postings.doc_ids.back() != _rid) {
+        postings.doc_ids.push_back(_rid);
+        _mem_bytes += sizeof(uint32_t);
+        if (_tokenized) {
+            postings.freqs.push_back(0);
+            _mem_bytes += sizeof(uint32_t);
+        }
+    }
+    if (_tokenized) {
+        postings.freqs.back()++;
+        postings.positions.push_back(position);
+        _mem_bytes += sizeof(uint32_t);
+    }
+}
+
+void BuiltinInvertedWriter::add_values(const void* values, size_t count) {
+    const auto* slices = reinterpret_cast<const Slice*>(values);
+    for (size_t i = 0; i < count; i++, _rid++) {
+        Slice value = slices[i];
+        if (_is_char) {
+            value.size = strnlen(value.data, value.size);
+        }
+        tokenize(_parser_type, value, &_term_buffer,
+                 [this](std::string_view term, uint32_t position) { _add_term(term, position); });
+    }
+}
+
+void BuiltinInvertedWriter::add_nulls(uint32_t count) {
+    _null_bitmap.addRange(_rid, _rid + count);
+    _rid += count;
+}
+
+Status BuiltinInvertedWriter::finish() {
+    ASSIGN_OR_RETURN(auto file, FileSystem::Default()->new_writable_file(_directory + "/" + kIndexFileName));
+
+    std::vector<std::pair<std::string_view, uint32_t>> terms;
+    terms.reserve(_term_ids.size());
+    for (const auto& [term, id] : _term_ids) {
+        terms.emplace_back(term, id);
+    }
+    std::sort(terms.begin(), terms.end());
+
+    // postings, in the order of terms
+    uint64_t offset = 0;
+    std::vector<TermInfo> term_infos(terms.size());
+    faststring buffer;
+    for (size_t i = 0; i < terms.size(); i++) {
+        Postings& postings = _postings[terms[i].second];
+        buffer.clear();
+        encode_doc_ids(postings.doc_ids, &buffer);
+        TermInfo& info = term_infos[i];
+        info.doc_freq = postings.doc_ids.size();
+        info.postings_offset = offset;
+        info.doc_ids_size = buffer.size();
+        if (_tokenized) {
+            encode_positions(postings.freqs, postings.positions, &buffer);
+        }
+        info.positions_size = buffer.size() - info.doc_ids_size;
+        RETURN_IF_ERROR(file->append(Slice(buffer.data(), buffer.size())));
+        offset += buffer.size();
+        postings = Postings();
+    }
+
+    // dictionary and term index
+    Footer footer;
+    footer.dictionary_offset = offset;
+    faststring dictionary;
+    faststring term_index;
+    for (size_t begin = 0; begin < terms.size(); begin += kTermsPerBlock) {
+        size_t end = std::min<size_t>(begin + kTermsPerBlock, terms.size());
+        size_t block_offset = dictionary.size();
+        std::string_view prev;
+        for (size_t i = begin; i < end; i++) {
+            std::string_view term = terms[i].first;
+            size_t shared = 0;
+            size_t max_shared = std::min(prev.size(), term.size());
+            while (shared < max_shared && prev[shared] == term[shared]) {
+                shared++;
+            }
+            put_varint32(&dictionary, shared);
+            put_varint32(&dictionary, term.size() - shared);
+            dictionary.append(term.data() + shared, term.size() - shared);
+            const TermInfo& info = term_infos[i];
+            put_varint32(&dictionary, info.doc_freq);
+            put_varint64(&dictionary, info.postings_offset);
+            put_varint32(&dictionary, info.doc_ids_size);
+            put_varint32(&dictionary, info.positions_size);
+            prev = term;
+        }
+        put_length_prefixed_slice(&term_index, Slice(terms[begin].first.data(), terms[begin].first.size()));
+        put_varint64(&term_index, footer.dictionary_offset + block_offset);
+        put_varint32(&term_index, dictionary.size() - block_offset);
+    }
+    footer.term_index_offset = footer.dictionary_offset + dictionary.size();
+    footer.null_bitmap_offset = footer.term_index_offset + term_index.size();
+    footer.num_docs = _rid;
+    footer.num_terms = terms.size();
+    footer.tokenized = _tokenized;
+
+    faststring tail;
+    _null_bitmap.runOptimize();
+    tail.resize(_null_bitmap.getSizeInBytes(true));
+    _null_bitmap.write(reinterpret_cast<char*>(tail.data()), true);
+    footer.encode_to(&tail);
+
+    Slice slices[] = {Slice(dictionary.data(), dictionary.size()), Slice(term_index.data(), term_index.size()),
+                      Slice(tail.data(), tail.size())};
+    RETURN_IF_ERROR(file->appendv(slices, 3));
+    RETURN_IF_ERROR(file->close());
+
+    _term_ids.clear();
+    _postings.clear();
+    _mem_bytes = 0;
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,79 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <roaring/roaring.hh>
+#include <string>
+#include <vector>
+
+#include "storage/inverted/inverted_index_option.h"
+#include "storage/inverted/inverted_writer.h"
+#include "storage/rowset/common.h"
+#include "storage/tablet_schema.h"
+#include "storage/types.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+// Build the builtin inverted index of a segment column in memory, and write it to a single file in
+// |directory| on finish(). See builtin_inverted_format.h for the file layout.
+class BuiltinInvertedWriter final : public InvertedWriter {
+public:
+    BuiltinInvertedWriter(std::string directory, InvertedIndexParserType parser_type, bool is_char);
+
+    ~BuiltinInvertedWriter() override = default;
+
+    static Status create(const TypeInfoPtr& typeinfo, const std::string& directory, TabletIndex* tablet_index,
+                         std::unique_ptr<InvertedWriter>* res);
+
+    Status init() override;
+
+    void add_values(const void* values, size_t count) override;
+
+    void add_nulls(uint32_t count) override;
+
+    Status finish() override;
+
+    uint64_t size() const override { return _rid; }
+
+    uint64_t estimate_buffer_size() const override { return _mem_bytes; }
+
+    uint64_t total_mem_footprint() const override { return _mem_bytes; }
+
+private:
+    struct Postings {
+        std::vector<uint32_t> doc_ids;
+        // the number of positions in each doc, only for a tokenized index
+        std::vector<uint32_t> freqs;
+        std::vector<uint32_t> positions;
+    };
+
+    void _add_term(std::string_view term, uint32_t position);
+
+    std::string _directory;
+    InvertedIndexParserType _parser_type;
+    bool _tokenized;
+    // CHAR values are padded with zeros
+    bool _is_char;
+
+    rowid_t _rid = 0;
+    roaring::Roaring _null_bitmap;
+    phmap::flat_hash_map<std::string, uint32_t> _term_ids;
+    std::vector<Postings> _postings;
+    std::string _term_buffer;
+    uint64_t _mem_bytes = 0;
+};
+
+} // namespace starrocks
@@ -0,0 +1,95 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/lake/column_access_stats.h"
+
+#include <algorithm>
+
+namespace starrocks::lake {
+
+ColumnAccessStats* ColumnAccessStats::instance() {
+    static ColumnAccessStats stats;
+    return &stats;
+}
+
+ColumnAccessStats::ColumnAccessStats(size_t max_schemas, size_t max_sets_per_schema)
+        : _max_schemas(std::max<size_t>(max_schemas, 1)),
+          _max_sets_per_schema(std::max<size_t>(max_sets_per_schema, 1)) {}
+
+void ColumnAccessStats::record(int64_t schema_id, size_t num_columns, std::vector<ColumnUID> column_uids) {
+    if (column_uids.empty() || column_uids.size() * 2 > num_columns) {
+        return;
+    }
+    std::sort(column_uids.begin(), column_uids.end());
+    column_uids.erase(std::unique(column_uids.begin(), column_uids.end()), column_uids.end());
+
+    std::lock_guard<std::mutex> l(_mutex);
+    auto it = _schemas.find(schema_id);
+    if (it == _schemas.end()) {
+        if (_schemas.size() >= _max_schemas) {
+            auto oldest = std::min_element(_schemas.begin(), _schemas.end(), [](const auto& a, const auto& b) {
+                return a.second.last_record < b.second.last_record;
+            });
+            _schemas.erase(oldest);
+        }
+        it = _schemas.emplace(schema_id, SchemaStats()).first;
+    }
+    auto& stats = it->second;
+    stats.num_scans++;
+    stats.last_record = ++_clock;
+
+    auto set = std::find_if(stats.sets.begin(), stats.sets.end(),
+                            [&](const ColumnSet& s) { return s.column_uids == column_uids; });
+    if (set != stats.sets.end()) {
+        set->count++;
+    } else if (stats.sets.size() < _max_sets_per_schema) {
+        stats.sets.emplace_back(ColumnSet{std::move(column_uids), 1});
+    } else {
+        auto least = std::min_element(stats.sets.begin(), stats.sets.end(),
+                                      [](const ColumnSet& a, const ColumnSet& b) { return a.count < b.count; });
+        least->column_uids = std::move(column_uids);
+        least->count++;
+    }
+}
+
+std::vector<std::vector<ColumnUID>> ColumnAccessStats::hot_column_sets(int64_t schema_id, double min_ratio) const {
+    std::vector<ColumnSet> sets;
+    int64_t num_scans = 0;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto it = _schemas.find(schema_id);
+        if (it == _schemas.end()) {
+            return {};
+        }
+        sets = it->second.sets;
+        num_scans = it->second.num_scans;
+    }
+    std::stable_sort(sets.begin(), sets.end(),
+                     [](const ColumnSet& a, const ColumnSet& b) { return a.count > b.count; });
+    std::vector<std::vector<ColumnUID>> result;
+    for (auto& set : sets) {
+        if (set.count < min_ratio * num_scans) {
+            break;
+        }
+        result.emplace_back(std::move(set.column_uids));
+    }
+    return result;
+}
+
+size_t ColumnAccessStats::num_schemas() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _schemas.size();
+}
+
+} // namespace starrocks::lake
@@ -0,0 +1,75 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/olap_common.h"
+
+namespace starrocks::lake {
+
+// ColumnAccessStats records which columns of a lake table are read together by scans, so that the vertical
+// compaction can put them into the same column groups. The columns of a group are contiguous in the output
+// segments, and a scan reading a few columns of a wide table fetches fewer, larger ranges from the remote storage.
+//
+// The statistics are kept in memory per tablet schema id, which is shared by all the tablets of an index. Every
+// schema keeps a bounded summary of its most frequent column sets, in the way of the Space-Saving algorithm: a new
+// set replaces the least frequent one and inherits its count, so the frequent sets are never missed.
+class ColumnAccessStats {
+public:
+    static constexpr size_t kDefaultMaxSchemas = 4096;
+    static constexpr size_t kDefaultMaxSetsPerSchema = 16;
+
+    static ColumnAccessStats* instance();
+
+    explicit ColumnAccessStats(size_t max_schemas = kDefaultMaxSchemas,
+                               size_t max_sets_per_schema = kDefaultMaxSetsPerSchema);
+
+    // Records a scan of |schema_id| reading the columns of |column_uids|, out of |num_columns| columns. Scans
+    // reading more than half of the columns are ignored, laying their columns out together gains nothing.
+    void record(int64_t schema_id, size_t num_columns, std::vector<ColumnUID> column_uids);
+
+    // Returns the column sets read by at least |min_ratio| of the scans recorded for |schema_id|, the most
+    // frequent first. The unique ids of every set are sorted.
+    std::vector<std::vector<ColumnUID>> hot_column_sets(int64_t schema_id, double min_ratio) const;
+
+    size_t num_schemas() const;
+
+private:
+    struct ColumnSet {
+        std::vector<ColumnUID> column_uids;
+        int64_t count = 0;
+    };
+
+    struct SchemaStats {
+        std::vector<ColumnSet> sets;
+        int64_t num_scans = 0;
+        int64_t last_record = 0;
+    };
+
+    const size_t _max_schemas;
+    const size_t _max_sets_per_schema;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<int64_t, SchemaStats> _schemas;
+    // Logical clock to find the least recently recorded schema.
+    int64_t _clock = 0;
+};
+
+} // namespace starrocks::lake
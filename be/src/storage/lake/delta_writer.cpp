@@ -430,6 +430,9 @@ StatusOr<TxnLogPtr> DeltaWriterImpl::finish(DeltaWriterFinishMode mode) {
             return Status::InternalError(fmt::format("unknown file {}", f.path));
         }
     }
+    for (auto& zone_map : _tablet_writer->segment_zone_maps()) {
+        op_write->mutable_rowset()->add_segment_zone_maps()->CopyFrom(zone_map);
+    }
     op_write->mutable_rowset()->set_num_rows(_tablet_writer->num_rows());
     op_write->mutable_rowset()->set_data_size(_tablet_writer->data_size());
     op_write->mutable_rowset()->set_overlapped(op_write->rowset().segments_size() > 1);
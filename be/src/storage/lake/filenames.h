@@ -28,6 +28,7 @@ namespace starrocks::lake {
 constexpr static const int kTabletMetadataFilenameLength = 38;
 constexpr static const int kTxnLogFilenameLength = 37;
 constexpr static const int kTabletMetadataLockFilenameLength = 55;
+constexpr static const int kVacuumWatermarkFilenameLength = 23;
 
 constexpr static const char* const kGCFileName = "GC.json";
 
@@ -63,6 +64,10 @@ inline bool is_tablet_metadata_lock(std::string_view file_name) {
     return HasSuffixString(file_name, ".lock");
 }
 
+inline bool is_vacuum_watermark(std::string_view file_name) {
+    return HasSuffixString(file_name, ".vacuum");
+}
+
 inline std::string tablet_metadata_filename(int64_t tablet_id, int64_t version) {
     return fmt::format("{:016X}_{:016X}.meta", tablet_id, version);
 }
@@ -100,6 +105,10 @@ inline int64_t parse_combined_txn_log_filename(std::string_view file_name) {
     return txn_id;
 }
 
+inline std::string vacuum_watermark_filename(int64_t tablet_id) {
+    return fmt::format("{:016X}.vacuum", tablet_id);
+}
+
 inline std::string tablet_metadata_lock_filename(int64_t tablet_id, int64_t version, int64_t expire_time) {
     return fmt::format("{:016X}_{:016X}_{:016X}.lock", tablet_id, version, expire_time);
 }
@@ -178,6 +187,16 @@ inline std::pair<int64_t, int64_t> parse_txn_vlog_filename(std::string_view file
     return {tablet_id, version};
 }
 
+// Return value: tablet id
+inline int64_t parse_vacuum_watermark_filename(std::string_view file_name) {
+    constexpr static int kBase = 16;
+    CHECK_EQ(kVacuumWatermarkFilenameLength, file_name.size()) << file_name;
+    StringParser::ParseResult res;
+    auto tablet_id = StringParser::string_to_int<int64_t>(file_name.data(), 16, kBase, &res);
+    CHECK_EQ(StringParser::PARSE_SUCCESS, res) << file_name;
+    return tablet_id;
+}
+
 // Return value: <tablet id, version, expire time>
 inline std::tuple<int64_t, int64_t, int64_t> parse_tablet_metadata_lock_filename(std::string_view file_name) {
     constexpr static int kBase = 16;
@@ -75,6 +75,7 @@ void HorizontalGeneralTabletWriter::close() {
         delete_files_async(std::move(full_paths_to_delete));
     }
     _files.clear();
+    _segment_zone_maps.clear();
 }
 
 Status HorizontalGeneralTabletWriter::reset_segment_writer() {
@@ -98,6 +99,9 @@ Status HorizontalGeneralTabletWriter::flush_segment_writer(SegmentPB* segment) {
         std::string segment_name = std::string(basename(segment_path));
         _files.emplace_back(FileInfo{segment_name, segment_size});
         _data_size += segment_size;
+        if (config::lake_enable_rowset_segment_zone_map) {
+            _seg_writer->get_segment_zone_map(&_segment_zone_maps.emplace_back());
+        }
         if (segment) {
             segment->set_data_size(segment_size);
             segment->set_index_size(index_size);
@@ -232,6 +236,9 @@ Status VerticalGeneralTabletWriter::finish(SegmentPB* segment) {
         std::string segment_name = std::string(basename(segment_path));
         _files.emplace_back(FileInfo{segment_name, segment_size});
         _data_size += segment_size;
+        if (config::lake_enable_rowset_segment_zone_map) {
+            segment_writer->get_segment_zone_map(&_segment_zone_maps.emplace_back());
+        }
         segment_writer.reset();
     }
     _segment_writers.clear();
@@ -252,6 +259,7 @@ void VerticalGeneralTabletWriter::close() {
         delete_files_async(std::move(full_paths_to_delete));
     }
     _files.clear();
+    _segment_zone_maps.clear();
 }
 
 StatusOr<std::shared_ptr<SegmentWriter>> VerticalGeneralTabletWriter::create_segment_writer(
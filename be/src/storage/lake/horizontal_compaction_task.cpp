@@ -128,6 +128,9 @@ Status HorizontalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flu
         op_compaction->mutable_output_rowset()->add_segments(file.path);
         op_compaction->mutable_output_rowset()->add_segment_size(file.size.value());
     }
+    for (auto& zone_map : writer->segment_zone_maps()) {
+        op_compaction->mutable_output_rowset()->add_segment_zone_maps()->CopyFrom(zone_map);
+    }
 
     op_compaction->mutable_output_rowset()->set_num_rows(writer->num_rows());
     op_compaction->mutable_output_rowset()->set_data_size(writer->data_size());
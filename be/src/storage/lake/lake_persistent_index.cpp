@@ -18,6 +18,7 @@
 #include "storage/chunk_helper.h"
 #include "storage/lake/filenames.h"
 #include "storage/lake/meta_file.h"
+#include "storage/lake/metacache.h"
 #include "storage/lake/persistent_index_memtable.h"
 #include "storage/lake/persistent_index_sstable.h"
 #include "storage/lake/rowset.h"
@@ -88,19 +89,35 @@ LakePersistentIndex::~LakePersistentIndex() {
 
 Status LakePersistentIndex::init(const PersistentIndexSstableMetaPB& sstable_meta) {
     for (auto& sstable_pb : sstable_meta.sstables()) {
-        ASSIGN_OR_RETURN(auto rf,
-                         fs::new_random_access_file(_tablet_mgr->sst_location(_tablet_id, sstable_pb.filename())));
-        auto* block_cache = _tablet_mgr->update_mgr()->block_cache();
-        if (block_cache == nullptr) {
-            return Status::InternalError("Block cache is null.");
-        }
-        auto sstable = std::make_unique<PersistentIndexSstable>();
-        RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+        ASSIGN_OR_RETURN(auto sstable, open_sstable(sstable_pb));
         _sstables.emplace_back(std::move(sstable));
     }
     return Status::OK();
 }
 
+StatusOr<std::shared_ptr<PersistentIndexSstable>> LakePersistentIndex::open_sstable(
+        const PersistentIndexSstablePB& sstable_pb) {
+    auto location = _tablet_mgr->sst_location(_tablet_id, sstable_pb.filename());
+    auto* metacache = _tablet_mgr->metacache();
+    if (metacache != nullptr) {
+        auto sstable = metacache->lookup_sstable(location);
+        if (sstable != nullptr && sstable->sstable_pb().version() == sstable_pb.version()) {
+            return sstable;
+        }
+    }
+    auto* block_cache = _tablet_mgr->update_mgr()->block_cache();
+    if (block_cache == nullptr) {
+        return Status::InternalError("Block cache is null.");
+    }
+    ASSIGN_OR_RETURN(auto rf, fs::new_random_access_file(location));
+    auto sstable = std::make_shared<PersistentIndexSstable>();
+    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+    if (metacache != nullptr) {
+        metacache->cache_sstable(location, sstable);
+    }
+    return sstable;
+}
+
 void LakePersistentIndex::set_difference(KeyIndexSet* key_indexes, const KeyIndexSet& found_key_indexes) {
     if (!found_key_indexes.empty()) {
         KeyIndexSet t;
@@ -123,17 +140,11 @@ Status LakePersistentIndex::minor_compact() {
     RETURN_IF_ERROR(_immutable_memtable->flush(wf.get(), &filesize));
     RETURN_IF_ERROR(wf->close());
 
-    auto sstable = std::make_unique<PersistentIndexSstable>();
-    ASSIGN_OR_RETURN(auto rf, fs::new_random_access_file(location));
     PersistentIndexSstablePB sstable_pb;
     sstable_pb.set_filename(filename);
     sstable_pb.set_filesize(filesize);
     sstable_pb.set_version(_version.major_number());
-    auto* block_cache = _tablet_mgr->update_mgr()->block_cache();
-    if (block_cache == nullptr) {
-        return Status::InternalError("Block cache is null.");
-    }
-    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+    ASSIGN_OR_RETURN(auto sstable, open_sstable(sstable_pb));
     _sstables.emplace_back(std::move(sstable));
     return Status::OK();
 }
@@ -331,7 +342,8 @@ Status LakePersistentIndex::major_compact(const TabletMetadata& metadata, int64_
     ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(location));
     sstable::Options options;
     std::unique_ptr<sstable::FilterPolicy> filter_policy;
-    filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+    filter_policy.reset(const_cast<sstable::FilterPolicy*>(
+            sstable::NewBloomFilterPolicy(config::lake_pk_index_sst_bloom_filter_bits_per_key)));
     options.filter_policy = filter_policy.get();
     sstable::TableBuilder builder(options, wf.get());
     RETURN_IF_ERROR(merge_sstables(std::move(merging_iter_ptr), &builder));
@@ -351,20 +363,14 @@ Status LakePersistentIndex::apply_opcompaction(const TxnLogPB_OpCompaction& op_c
     PersistentIndexSstablePB sstable_pb;
     sstable_pb.CopyFrom(op_compaction.output_sstable());
     sstable_pb.set_version(op_compaction.input_sstables(op_compaction.input_sstables().size() - 1).version());
-    auto sstable = std::make_unique<PersistentIndexSstable>();
-    ASSIGN_OR_RETURN(auto rf, fs::new_random_access_file(_tablet_mgr->sst_location(_tablet_id, sstable_pb.filename())));
-    auto* block_cache = _tablet_mgr->update_mgr()->block_cache();
-    if (block_cache == nullptr) {
-        return Status::InternalError("Block cache is null.");
-    }
-    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+    ASSIGN_OR_RETURN(auto sstable, open_sstable(sstable_pb));
 
     std::unordered_set<std::string> filenames;
     for (const auto& input_sstable : op_compaction.input_sstables()) {
         filenames.insert(input_sstable.filename());
     }
     _sstables.erase(std::remove_if(_sstables.begin(), _sstables.end(),
-                                   [&](const std::unique_ptr<PersistentIndexSstable>& sstable) {
+                                   [&](const std::shared_ptr<PersistentIndexSstable>& sstable) {
                                        return filenames.contains(sstable->sstable_pb().filename());
                                    }),
                     _sstables.end());
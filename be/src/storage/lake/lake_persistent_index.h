@@ -150,6 +150,10 @@ private:
 
     static void set_difference(KeyIndexSet* key_indexes, const KeyIndexSet& found_key_indexes);
 
+    // Open the sstable of |sstable_pb|, or reuse the one kept in metacache, so that its index block and
+    // filter block are not read from the remote storage again.
+    StatusOr<std::shared_ptr<PersistentIndexSstable>> open_sstable(const PersistentIndexSstablePB& sstable_pb);
+
     // get sstable's iterator that need to compact and modify txn_log
     Status prepare_merging_iterator(const TabletMetadata& metadata, TxnLogPB* txn_log,
                                     std::vector<std::shared_ptr<PersistentIndexSstable>>* merging_sstables,
@@ -165,7 +169,7 @@ private:
     // The size of sstables is not expected to be too large.
     // In major compaction, some sstables will be picked to be merged into one.
     // sstables are ordered with the smaller version on the left.
-    std::vector<std::unique_ptr<PersistentIndexSstable>> _sstables;
+    std::vector<std::shared_ptr<PersistentIndexSstable>> _sstables;
 };
 
 } // namespace lake
@@ -18,6 +18,7 @@
 
 #include "gen_cpp/lake_types.pb.h"
 #include "storage/del_vector.h"
+#include "storage/lake/persistent_index_sstable.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/rowset/segment.h"
 #include "util/lru_cache.h"
@@ -64,6 +65,14 @@ static bvar::Adder<uint64_t> g_segment_cache_miss;
 static bvar::Window<bvar::Adder<uint64_t>> g_segment_cache_miss_minute("lake", "segment_cache_miss_minute",
                                                                        &g_segment_cache_miss, 60);
 
+static bvar::Adder<uint64_t> g_sstable_cache_hit;
+static bvar::Window<bvar::Adder<uint64_t>> g_sstable_cache_hit_minute("lake", "pk_index_sstable_cache_hit_minute",
+                                                                      &g_sstable_cache_hit, 60);
+
+static bvar::Adder<uint64_t> g_sstable_cache_miss;
+static bvar::Window<bvar::Adder<uint64_t>> g_sstable_cache_miss_minute("lake", "pk_index_sstable_cache_miss_minute",
+                                                                       &g_sstable_cache_miss, 60);
+
 #ifndef BE_TEST
 static Metacache* get_metacache() {
     auto mgr = ExecEnv::GetInstance()->lake_tablet_manager();
@@ -206,6 +215,24 @@ std::shared_ptr<const DelVector> Metacache::lookup_delvec(std::string_view key)
     }
 }
 
+std::shared_ptr<PersistentIndexSstable> Metacache::lookup_sstable(std::string_view key) {
+    auto handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        g_sstable_cache_miss << 1;
+        return nullptr;
+    }
+    DeferOp defer([this, handle]() { _cache->release(handle); });
+
+    try {
+        auto value = static_cast<CacheValue*>(_cache->value(handle));
+        auto sstable = std::get<std::shared_ptr<PersistentIndexSstable>>(*value);
+        g_sstable_cache_hit << 1;
+        return sstable;
+    } catch (const std::bad_variant_access& e) {
+        return nullptr;
+    }
+}
+
 void Metacache::cache_segment(std::string_view key, std::shared_ptr<Segment> segment) {
     std::lock_guard<std::mutex> lock(_mutex);
     _cache_segment_no_lock(key, std::move(segment));
@@ -235,6 +262,12 @@ void Metacache::cache_delvec(std::string_view key, std::shared_ptr<const DelVect
     insert(key, value.release(), mem_cost);
 }
 
+void Metacache::cache_sstable(std::string_view key, std::shared_ptr<PersistentIndexSstable> sstable) {
+    auto mem_cost = sstable->memory_usage();
+    auto value = std::make_unique<CacheValue>(std::move(sstable));
+    insert(key, value.release(), mem_cost);
+}
+
 void Metacache::cache_tablet_metadata(std::string_view key, std::shared_ptr<const TabletMetadataPB> metadata) {
     auto value_ptr = std::make_unique<CacheValue>(metadata);
     insert(key, value_ptr.release(), metadata->SpaceUsedLong());
@@ -34,9 +34,12 @@ class CombinedTxnLogPB;
 
 namespace starrocks::lake {
 
+class PersistentIndexSstable;
+
 using CacheValue = std::variant<std::shared_ptr<const TabletMetadataPB>, std::shared_ptr<const TxnLogPB>,
                                 std::shared_ptr<const TabletSchema>, std::shared_ptr<const DelVector>,
-                                std::shared_ptr<Segment>, std::shared_ptr<const CombinedTxnLogPB>>;
+                                std::shared_ptr<Segment>, std::shared_ptr<const CombinedTxnLogPB>,
+                                std::shared_ptr<PersistentIndexSstable>>;
 
 class Metacache {
 public:
@@ -58,6 +61,8 @@ public:
 
     std::shared_ptr<const DelVector> lookup_delvec(std::string_view key);
 
+    std::shared_ptr<PersistentIndexSstable> lookup_sstable(std::string_view key);
+
     void cache_tablet_metadata(std::string_view key, std::shared_ptr<const TabletMetadataPB> metadata);
 
     void cache_tablet_schema(std::string_view key, std::shared_ptr<const TabletSchema> schema, size_t size);
@@ -73,6 +78,9 @@ public:
 
     void cache_delvec(std::string_view key, std::shared_ptr<const DelVector> delvec);
 
+    // cache an opened persistent index sstable, charged by its index block and filter block
+    void cache_sstable(std::string_view key, std::shared_ptr<PersistentIndexSstable> sstable);
+
     void erase(std::string_view key);
 
     void update_capacity(size_t new_capacity);
@@ -16,6 +16,7 @@
 
 #include <butil/time.h> // NOLINT
 
+#include "common/config.h"
 #include "fs/fs.h"
 #include "storage/sstable/table_builder.h"
 #include "util/trace.h"
@@ -42,7 +43,8 @@ Status PersistentIndexSstable::build_sstable(
         const phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>>& map, WritableFile* wf,
         uint64_t* filesz) {
     std::unique_ptr<sstable::FilterPolicy> filter_policy;
-    filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+    filter_policy.reset(const_cast<sstable::FilterPolicy*>(
+            sstable::NewBloomFilterPolicy(config::lake_pk_index_sst_bloom_filter_bits_per_key)));
     sstable::Options options;
     options.filter_policy = filter_policy.get();
     sstable::TableBuilder builder(options, wf);
@@ -59,6 +61,10 @@ Status PersistentIndexSstable::build_sstable(
     return Status::OK();
 }
 
+size_t PersistentIndexSstable::memory_usage() const {
+    return (_sst != nullptr ? _sst->MemoryUsage() : 0) + _sstable_pb.SpaceUsedLong();
+}
+
 Status PersistentIndexSstable::multi_get(const Slice* keys, const KeyIndexSet& key_indexes, int64_t version,
                                          IndexValue* values, KeyIndexSet* found_key_indexes) const {
     std::vector<std::string> index_value_with_vers(key_indexes.size());
@@ -58,6 +58,9 @@ public:
 
     const PersistentIndexSstablePB& sstable_pb() const { return _sstable_pb; }
 
+    // the memory of the index block and the filter block kept by the opened sstable
+    size_t memory_usage() const;
+
 private:
     std::unique_ptr<sstable::Table> _sst{nullptr};
     std::unique_ptr<sstable::FilterPolicy> _filter_policy{nullptr};
@@ -17,6 +17,7 @@
 #include <fmt/format.h>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "runtime/exec_env.h"
 #include "serde/column_array_serde.h"
@@ -80,6 +81,9 @@ Status HorizontalPkTabletWriter::flush_segment_writer(SegmentPB* segment) {
         std::string segment_name = std::string(basename(segment_path));
         _files.emplace_back(FileInfo{segment_name, segment_size});
         _data_size += segment_size;
+        if (config::lake_enable_rowset_segment_zone_map) {
+            _seg_writer->get_segment_zone_map(&_segment_zone_maps.emplace_back());
+        }
         if (segment) {
             segment->set_data_size(segment_size);
             segment->set_index_size(index_size);
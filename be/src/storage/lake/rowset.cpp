@@ -14,9 +14,13 @@
 
 #include "storage/lake/rowset.h"
 
+#include <algorithm>
 #include <future>
 
+#include "column/datum_convert.h"
+#include "common/config.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/delete_predicates.h"
 #include "storage/lake/tablet.h"
 #include "storage/lake/update_manager.h"
@@ -27,7 +31,9 @@
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/short_key_range_option.h"
 #include "storage/tablet_schema_map.h"
+#include "storage/types.h"
 #include "storage/union_iterator.h"
+#include "storage/zone_map_detail.h"
 
 namespace starrocks::lake {
 
@@ -69,6 +75,7 @@ StatusOr<std::vector<ChunkIteratorPtr>> Rowset::read(const Schema& schema, const
     seg_options.reader_type = options.reader_type;
     seg_options.chunk_size = options.chunk_size;
     seg_options.global_dictmaps = options.global_dictmaps;
+    seg_options.global_dict_versions = options.global_dict_versions;
     seg_options.unused_output_column_ids = options.unused_output_column_ids;
     seg_options.runtime_range_pruner = options.runtime_range_pruner;
     seg_options.tablet_schema = options.tablet_schema;
@@ -113,8 +120,19 @@ StatusOr<std::vector<ChunkIteratorPtr>> Rowset::read(const Schema& schema, const
         options.stats->segments_read_count += num_segments();
     }
 
+    // Prune the segments by the zone maps in rowset metadata before opening them.
+    std::vector<bool> pruned_segments;
+    if (config::enable_index_segment_level_zonemap_filter && !options.predicates_for_zone_map.empty() &&
+        metadata().segment_zone_maps_size() == metadata().segments_size()) {
+        pruned_segments.resize(metadata().segments_size());
+        for (int i = 0; i < metadata().segments_size(); i++) {
+            pruned_segments[i] = _pruned_by_segment_zone_map(i, options);
+        }
+    }
+
     std::vector<SegmentPtr> segments;
-    RETURN_IF_ERROR(load_segments(&segments, options.lake_io_opts.fill_data_cache, options.lake_io_opts.buffer_size));
+    RETURN_IF_ERROR(load_segments(&segments, options.lake_io_opts, options.lake_io_opts.fill_data_cache,
+                                  pruned_segments.empty() ? nullptr : &pruned_segments));
     for (auto& seg_ptr : segments) {
         if (seg_ptr->num_rows() == 0) {
             continue;
@@ -258,13 +276,49 @@ StatusOr<std::vector<SegmentPtr>> Rowset::segments(const LakeIOOptions& lake_io_
     return segments;
 }
 
+bool Rowset::_pruned_by_segment_zone_map(int seg_idx, const RowsetReadOptions& options) const {
+    const auto& zone_maps = metadata().segment_zone_maps(seg_idx).columns();
+    for (const auto& [column_id, predicates] : options.predicates_for_zone_map) {
+        if (predicates.empty()) {
+            continue;
+        }
+        const auto& tablet_column = options.tablet_schema->column(column_id);
+        // The values of the non-key columns of a primary key table may be changed by partial updates
+        // in column mode, which are not reflected by the zone maps.
+        if (options.is_primary_keys && !tablet_column.is_key()) {
+            continue;
+        }
+        auto iter = std::find_if(zone_maps.begin(), zone_maps.end(), [&](const ColumnZoneMapPB& zm) {
+            return zm.column_unique_id() == tablet_column.unique_id();
+        });
+        if (iter == zone_maps.end()) {
+            continue;
+        }
+        // DECIMAL32/DECIMAL64/DECIMAL128 stored as INT32/INT64/INT128
+        TypeInfoPtr type_info = get_type_info(delegate_type(predicates[0]->type_info()->type()));
+        ZoneMapDetail detail;
+        detail.set_has_null(iter->has_null());
+        detail.set_num_rows(0);
+        if (iter->has_not_null() &&
+            (!datum_from_string(type_info.get(), &detail.min_value(), iter->min(), nullptr).ok() ||
+             !datum_from_string(type_info.get(), &detail.max_value(), iter->max(), nullptr).ok())) {
+            continue;
+        }
+        auto filter = [&](const ColumnPredicate* pred) { return pred->zone_map_filter(detail); };
+        if (!std::all_of(predicates.begin(), predicates.end(), filter)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 Status Rowset::load_segments(std::vector<SegmentPtr>* segments, bool fill_cache, int64_t buffer_size) {
     LakeIOOptions lake_io_opts{.fill_data_cache = fill_cache, .buffer_size = buffer_size};
     return load_segments(segments, lake_io_opts, fill_cache);
 }
 
 Status Rowset::load_segments(std::vector<SegmentPtr>* segments, const LakeIOOptions& lake_io_opts,
-                             bool fill_metadata_cache) {
+                             bool fill_metadata_cache, const std::vector<bool>* pruned_segments) {
 #ifndef BE_TEST
     RETURN_IF_ERROR(tls_thread_status.mem_tracker()->check_mem_limit("LoadSegments"));
 #endif
@@ -299,6 +353,11 @@ Status Rowset::load_segments(std::vector<SegmentPtr>* segments, const LakeIOOpti
     };
 
     for (const auto& seg_name : metadata().segments()) {
+        if (pruned_segments != nullptr && (*pruned_segments)[index]) {
+            index++;
+            seg_id++;
+            continue;
+        }
         auto segment_path = _tablet_mgr->segment_location(tablet_id(), seg_name);
         auto segment_info = FileInfo{.path = segment_path};
         if (LIKELY(has_segment_size)) {
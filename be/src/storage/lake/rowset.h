@@ -101,14 +101,19 @@ public:
     // `fill_cache` controls `fill_data_cache` and `fill_meta_cache`
     [[nodiscard]] Status load_segments(std::vector<SegmentPtr>* segments, bool fill_cache, int64_t buffer_size = -1);
 
+    // The segments marked in |pruned_segments|, if not null, are skipped without being opened.
     [[nodiscard]] Status load_segments(std::vector<SegmentPtr>* segments, const LakeIOOptions& lake_io_opts,
-                                       bool fill_metadata_cache);
+                                       bool fill_metadata_cache, const std::vector<bool>* pruned_segments = nullptr);
 
     int64_t tablet_id() const { return _tablet_id; }
 
     [[nodiscard]] int64_t version() const { return metadata().version(); }
 
 private:
+    // Return true if the |seg_idx|-th segment can not satisfy the zone map predicates of |options|,
+    // judged by the segment zone maps kept in the rowset metadata.
+    bool _pruned_by_segment_zone_map(int seg_idx, const RowsetReadOptions& options) const;
+
     TabletManager* _tablet_mgr;
     int64_t _tablet_id;
     const RowsetMetadataPB* _metadata;
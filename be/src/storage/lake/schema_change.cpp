@@ -209,6 +209,9 @@ Status DirectSchemaChange::process(RowsetPtr rowset, RowsetMetadata* new_rowset_
         new_rowset_metadata->add_segments(std::move(f.path));
         new_rowset_metadata->add_segment_size(f.size.value());
     }
+    for (auto& zone_map : writer->segment_zone_maps()) {
+        new_rowset_metadata->add_segment_zone_maps()->CopyFrom(zone_map);
+    }
 
     new_rowset_metadata->set_id(_next_rowset_id);
     new_rowset_metadata->set_num_rows(writer->num_rows());
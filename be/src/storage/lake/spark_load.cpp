@@ -119,6 +119,9 @@ Status SparkLoadHandler::_load_convert(Tablet& cur_tablet) {
             return Status::InternalError(fmt::format("unknown file {}", f.path));
         }
     }
+    for (auto& zone_map : writer->segment_zone_maps()) {
+        op_write->mutable_rowset()->add_segment_zone_maps()->CopyFrom(zone_map);
+    }
     op_write->mutable_rowset()->set_num_rows(writer->num_rows());
     op_write->mutable_rowset()->set_data_size(writer->data_size());
     op_write->mutable_rowset()->set_overlapped(false);
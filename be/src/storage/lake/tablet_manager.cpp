@@ -18,10 +18,12 @@
 #include <bvar/bvar.h>
 
 #include <atomic>
+#include <climits>
 #include <utility>
 
 #include "agent/master_info.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "fmt/format.h"
 #include "fs/fs.h"
 #include "fs/fs_util.h"
@@ -46,6 +48,7 @@
 #include "storage/tablet_schema_map.h"
 #include "testutil/sync_point.h"
 #include "util/raw_container.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 // TODO: Eliminate the explicit dependency on staros worker
@@ -59,6 +62,7 @@ static bvar::LatencyRecorder g_put_tablet_metadata_latency("lake", "put_tablet_m
 static bvar::LatencyRecorder g_get_txn_log_latency("lake", "get_txn_log");
 static bvar::LatencyRecorder g_put_txn_log_latency("lake", "put_txn_log");
 static bvar::LatencyRecorder g_del_txn_log_latency("lake", "del_txn_log");
+static bvar::Adder<int64_t> g_prefetch_tablet_metadata_count("lake", "prefetch_tablet_metadata_count");
 
 TabletManager::TabletManager(LocationProvider* location_provider, UpdateManager* update_mgr, int64_t cache_capacity)
         : _location_provider(location_provider),
@@ -66,9 +70,22 @@ TabletManager::TabletManager(LocationProvider* location_provider, UpdateManager*
           _compaction_scheduler(std::make_unique<CompactionScheduler>(this)),
           _update_mgr(update_mgr) {
     _update_mgr->set_tablet_mgr(this);
+    if (config::lake_metadata_fetch_thread_num > 0) {
+        auto st = ThreadPoolBuilder("lake_meta_fetch")
+                          .set_min_threads(0)
+                          .set_max_threads(config::lake_metadata_fetch_thread_num)
+                          .set_max_queue_size(INT_MAX)
+                          .build(&_metadata_fetch_pool);
+        CHECK(st.ok()) << st;
+    }
 }
 
-TabletManager::~TabletManager() = default;
+TabletManager::~TabletManager() {
+    // The pending fetches access the metacache, wait for them before destroying it.
+    if (_metadata_fetch_pool != nullptr) {
+        _metadata_fetch_pool->shutdown();
+    }
+}
 
 std::string TabletManager::tablet_root_location(int64_t tablet_id) const {
     return _location_provider->root_location(tablet_id);
@@ -251,6 +268,85 @@ StatusOr<TabletMetadataPtr> TabletManager::get_tablet_metadata(const string& pat
     return ptr;
 }
 
+StatusOr<std::vector<TabletMetadataPtr>> TabletManager::get_tablet_metadatas(
+        const std::vector<std::pair<int64_t, int64_t>>& tablet_versions) {
+    std::vector<TabletMetadataPtr> metadatas(tablet_versions.size());
+    std::vector<std::string> paths(tablet_versions.size());
+    std::vector<size_t> missed;
+    for (size_t i = 0; i < tablet_versions.size(); i++) {
+        paths[i] = tablet_metadata_location(tablet_versions[i].first, tablet_versions[i].second);
+        metadatas[i] = _metacache->lookup_tablet_metadata(paths[i]);
+        if (metadatas[i] == nullptr) {
+            missed.emplace_back(i);
+        }
+    }
+    if (missed.empty()) {
+        return metadatas;
+    }
+
+    std::vector<Status> statuses(tablet_versions.size());
+    run_metadata_fetches(missed.size(), [&](size_t n) {
+        auto i = missed[n];
+        auto res = get_tablet_metadata(paths[i]);
+        if (res.ok()) {
+            metadatas[i] = std::move(res).value();
+        } else {
+            statuses[i] = res.status();
+        }
+    });
+    for (auto i : missed) {
+        RETURN_IF_ERROR(statuses[i]);
+    }
+    return metadatas;
+}
+
+void TabletManager::run_metadata_fetches(size_t n, const std::function<void(size_t)>& fetch) {
+    if (_metadata_fetch_pool == nullptr || n <= 1) {
+        for (size_t i = 0; i < n; i++) {
+            fetch(i);
+        }
+        return;
+    }
+    // The token only waits for the fetches of this call, the pool bounds the concurrency of all the callers.
+    auto token = _metadata_fetch_pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    for (size_t i = 0; i < n; i++) {
+        if (!token->submit_func([&fetch, i]() { fetch(i); }).ok()) {
+            fetch(i);
+        }
+    }
+    token->wait();
+}
+
+void TabletManager::prefetch_tablet_metadata(int64_t tablet_id, int64_t version) {
+    if (_metadata_fetch_pool == nullptr) {
+        return;
+    }
+    auto path = tablet_metadata_location(tablet_id, version);
+    if (_metacache->lookup_tablet_metadata(path) != nullptr) {
+        return;
+    }
+    {
+        std::lock_guard l(_prefetch_lock);
+        if (static_cast<int64_t>(_prefetching_metadatas.size()) >= config::lake_metadata_max_pending_prefetches ||
+            !_prefetching_metadatas.insert(path).second) {
+            return;
+        }
+    }
+    auto st = _metadata_fetch_pool->submit_func([this, path]() {
+        auto res = get_tablet_metadata(path);
+        LOG_IF(WARNING, !res.ok() && !res.status().is_not_found())
+                << "Fail to prefetch tablet metadata " << path << ": " << res.status();
+        std::lock_guard l(_prefetch_lock);
+        _prefetching_metadatas.erase(path);
+    });
+    if (st.ok()) {
+        g_prefetch_tablet_metadata_count << 1;
+    } else {
+        std::lock_guard l(_prefetch_lock);
+        _prefetching_metadatas.erase(path);
+    }
+}
+
 Status TabletManager::delete_tablet_metadata(int64_t tablet_id, int64_t version) {
     auto location = tablet_metadata_location(tablet_id, version);
     _metacache->erase(location);
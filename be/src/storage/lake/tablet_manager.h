@@ -16,8 +16,12 @@
 
 #include <bthread/types.h>
 
+#include <functional>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_set>
 #include <variant>
+#include <vector>
 
 #include "common/statusor.h"
 #include "compaction_task_context.h"
@@ -33,6 +37,7 @@ struct FileInfo;
 class Segment;
 class TabletSchemaPB;
 class TCreateTabletReq;
+class ThreadPool;
 } // namespace starrocks
 
 namespace starrocks::lake {
@@ -78,6 +83,23 @@ public:
 
     StatusOr<TabletMetadataPtr> get_tablet_metadata(const std::string& path, bool fill_cache = true);
 
+    // Get the metadata of a batch of (tablet_id, version), in the same order as |tablet_versions|.
+    // The ones missed in the metacache are loaded in parallel by the metadata fetch thread pool, at
+    // most config::lake_metadata_fetch_thread_num at a time, and are cached.
+    // Return the first error if any of them failed.
+    StatusOr<std::vector<TabletMetadataPtr>> get_tablet_metadatas(
+            const std::vector<std::pair<int64_t, int64_t>>& tablet_versions);
+
+    // Load the metadata of |tablet_id| at |version| into the metacache in background, if it's not cached
+    // and not being prefetched. The prefetch is dropped when there are already
+    // config::lake_metadata_max_pending_prefetches in flight, and its failure is ignored.
+    void prefetch_tablet_metadata(int64_t tablet_id, int64_t version);
+
+    // Run |fetch|(0), ..., |fetch|(n - 1) on the metadata fetch thread pool and wait for all of them, or run
+    // them in the calling thread if the pool is disabled. Used to overlap the remote reads of small objects
+    // like metadata, txn logs and delvecs, |fetch| must be thread safe.
+    void run_metadata_fetches(size_t n, const std::function<void(size_t)>& fetch);
+
     TabletMetadataPtr get_latest_cached_tablet_metadata(int64_t tablet_id);
 
     StatusOr<TabletMetadataIter> list_tablet_metadata(int64_t tablet_id, bool filter_tablet);
@@ -208,6 +230,12 @@ private:
 
     std::shared_mutex _meta_lock;
     std::unordered_map<int64_t, int64_t> _tablet_in_writing_size;
+
+    // Null if config::lake_metadata_fetch_thread_num <= 0.
+    std::unique_ptr<ThreadPool> _metadata_fetch_pool;
+    std::mutex _prefetch_lock;
+    // Paths of the tablet metadata being prefetched.
+    std::unordered_set<std::string> _prefetching_metadatas;
 };
 
 } // namespace starrocks::lake
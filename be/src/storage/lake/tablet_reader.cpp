@@ -236,6 +236,7 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.use_page_cache = params.use_page_cache;
     rs_opts.tablet_schema = _tablet_schema;
     rs_opts.global_dictmaps = params.global_dictmaps;
+    rs_opts.global_dict_versions = params.global_dict_versions;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
     rs_opts.runtime_range_pruner = params.runtime_range_pruner;
     rs_opts.lake_io_opts = params.lake_io_opts;
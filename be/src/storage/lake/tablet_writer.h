@@ -62,6 +62,12 @@ public:
     // PREREQUISITES: the writer has successfully `finish()`ed but not yet `close()`ed.
     std::vector<FileInfo> files() const { return _files; }
 
+    // Return the segment-level zone maps of the segments generated by this writer, in the same
+    // order as the segment files in `files()`. Empty if `lake_enable_rowset_segment_zone_map` is off.
+    //
+    // PREREQUISITES: the writer has successfully `finish()`ed but not yet `close()`ed.
+    const std::vector<SegmentZoneMapPB>& segment_zone_maps() const { return _segment_zone_maps; }
+
     // The sum of all segment file sizes, in bytes.
     int64_t data_size() const { return _data_size; }
 
@@ -136,6 +142,7 @@ protected:
     int64_t _txn_id;
     ThreadPool* _flush_pool;
     std::vector<FileInfo> _files;
+    std::vector<SegmentZoneMapPB> _segment_zone_maps;
     int64_t _num_rows = 0;
     int64_t _data_size = 0;
     uint32_t _seg_id = 0;
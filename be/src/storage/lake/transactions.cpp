@@ -215,8 +215,14 @@ StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t t
     // 5. txn4 will be published in later publish task, but we can't judge what's the latest_version in BE and we can not reapply txn_log if
     // txn logs have been deleted.
     int txn_offset = base_version - ori_base_version;
+    // Read the txn logs of a batch publish in parallel, they are applied one by one in the order of txns below.
+    std::vector<StatusOr<TxnLogPtr>> txn_logs(txns.size(), Status::Uninitialized(""));
+    size_t num_txn_logs = std::max<int64_t>(0, static_cast<int64_t>(txns.size()) - txn_offset);
+    tablet_mgr->run_metadata_fetches(num_txn_logs, [&](size_t n) {
+        txn_logs[txn_offset + n] = load_txn_log(tablet_mgr, tablet_id, txns[txn_offset + n]);
+    });
     for (size_t i = txn_offset, sz = txns.size(); i < sz; i++) {
-        auto txn_log_st = load_txn_log(tablet_mgr, tablet_id, txns[i]);
+        auto& txn_log_st = txn_logs[i];
 
         if (txn_log_st.status().is_not_found()) {
             if (i == 0) {
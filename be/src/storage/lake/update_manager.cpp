@@ -201,9 +201,31 @@ Status UpdateManager::publish_primary_key_tablet(const TxnLogPB_OpWrite& op_writ
     size_t new_del = 0;
     size_t total_del = 0;
     std::map<uint32_t, size_t> segment_id_to_add_dels;
+    auto is_new_segment = [&](uint32_t rssid) {
+        return rssid >= rowset_id && rssid < rowset_id + op_write.rowset().segments_size();
+    };
+    // The delvecs of the old segments may be read from remote storage, read them in parallel.
+    std::vector<uint32_t> old_rssids;
+    for (auto& new_delete : new_deletes) {
+        if (!is_new_segment(new_delete.first)) {
+            old_rssids.emplace_back(new_delete.first);
+        }
+    }
+    std::vector<DelVectorPtr> old_del_vecs(old_rssids.size());
+    std::vector<Status> old_del_vec_statuses(old_rssids.size());
+    _tablet_mgr->run_metadata_fetches(old_rssids.size(), [&](size_t i) {
+        TabletSegmentId tsid;
+        tsid.tablet_id = tablet->id();
+        tsid.segment_id = old_rssids[i];
+        old_del_vec_statuses[i] = get_del_vec(tsid, base_version, builder, &old_del_vecs[i]);
+    });
+    for (const auto& st : old_del_vec_statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    size_t old_idx = 0;
     for (auto& new_delete : new_deletes) {
         uint32_t rssid = new_delete.first;
-        if (rssid >= rowset_id && rssid < rowset_id + op_write.rowset().segments_size()) {
+        if (is_new_segment(rssid)) {
             // it's newly added rowset's segment, do not have latest delvec yet
             new_del_vecs[idx].first = rssid;
             new_del_vecs[idx].second = std::make_shared<DelVector>();
@@ -213,11 +235,8 @@ Status UpdateManager::publish_primary_key_tablet(const TxnLogPB_OpWrite& op_writ
             total_del += del_ids.size();
             segment_id_to_add_dels[rssid] += del_ids.size();
         } else {
-            TabletSegmentId tsid;
-            tsid.tablet_id = tablet->id();
-            tsid.segment_id = rssid;
-            DelVectorPtr old_del_vec;
-            RETURN_IF_ERROR(get_del_vec(tsid, base_version, builder, &old_del_vec));
+            DCHECK_EQ(rssid, old_rssids[old_idx]);
+            const auto& old_del_vec = old_del_vecs[old_idx++];
             new_del_vecs[idx].first = rssid;
             old_del_vec->add_dels_as_new_version(new_delete.second, metadata.version(), &(new_del_vecs[idx].second));
             size_t cur_old = old_del_vec->cardinality();
@@ -17,6 +17,7 @@
 #include <butil/time.h>
 #include <bvar/bvar.h>
 
+#include <deque>
 #include <set>
 #include <string_view>
 #include <unordered_map>
@@ -25,6 +26,7 @@
 #include "common/status.h"
 #include "fs/fs.h"
 #include "gutil/stl_util.h"
+#include "gutil/strings/numbers.h"
 #include "gutil/strings/util.h"
 #include "storage/lake/filenames.h"
 #include "storage/lake/join_path.h"
@@ -156,6 +158,7 @@ Status do_delete_files(FileSystem* fs, const std::vector<std::string>& paths) {
 //
 // The AsyncFileDeleter class provides a mechanism to delete files in batches in an asynchronous manner.
 // It allows specifying the batch size, which determines the number of files to be deleted in each batch.
+// At most config::lake_vacuum_max_concurrent_delete_batches batches are being deleted at the same time.
 class AsyncFileDeleter {
 public:
     using DeleteCallback = std::function<void(const std::vector<std::string>&)>;
@@ -183,30 +186,39 @@ public:
 private:
     // Wait for all submitted deletion tasks to finish and return task execution results.
     Status wait() {
-        if (_prev_task_status.valid()) {
-            return _prev_task_status.get();
-        } else {
-            return Status::OK();
+        Status ret;
+        while (!_pending_tasks.empty()) {
+            ret.update(_pending_tasks.front().get());
+            _pending_tasks.pop_front();
         }
+        return ret;
     }
 
     Status submit(std::vector<std::string>* files_to_delete) {
-        // Await previous task completion before submitting a new deletion.
-        RETURN_IF_ERROR(wait());
+        // Await the completion of the oldest task if there are too many tasks in flight.
+        while (static_cast<int64_t>(_pending_tasks.size()) >=
+               std::max<int64_t>(1, config::lake_vacuum_max_concurrent_delete_batches)) {
+            auto st = _pending_tasks.front().get();
+            _pending_tasks.pop_front();
+            if (!st.ok()) {
+                (void)wait();
+                return st;
+            }
+        }
         _delete_count += files_to_delete->size();
         if (_cb) {
             _cb(*files_to_delete);
         }
-        _prev_task_status = delete_files_callable(std::move(*files_to_delete));
+        _pending_tasks.emplace_back(delete_files_callable(std::move(*files_to_delete)));
         files_to_delete->clear();
-        DCHECK(_prev_task_status.valid());
+        DCHECK(_pending_tasks.back().valid());
         return Status::OK();
     }
 
     int64_t _batch_size;
     int64_t _delete_count = 0;
     std::vector<std::string> _batch;
-    std::future<Status> _prev_task_status;
+    std::deque<std::future<Status>> _pending_tasks;
     DeleteCallback _cb;
 };
 
@@ -252,25 +264,62 @@ void run_clear_task_async(std::function<void()> task) {
     LOG_IF(ERROR, !st.ok()) << st;
 }
 
-static Status collect_garbage_files(const TabletMetadataPB& metadata, const std::string& base_dir,
-                                    AsyncFileDeleter* deleter, int64_t* garbage_data_size) {
+static void collect_garbage_files(const TabletMetadataPB& metadata, const std::string& base_dir,
+                                  std::vector<std::string>* garbage_files, int64_t* garbage_data_size) {
     for (const auto& rowset : metadata.compaction_inputs()) {
         for (const auto& segment : rowset.segments()) {
-            RETURN_IF_ERROR(deleter->delete_file(join_path(base_dir, segment)));
+            garbage_files->emplace_back(join_path(base_dir, segment));
         }
         *garbage_data_size += rowset.data_size();
     }
     for (const auto& file : metadata.orphan_files()) {
-        RETURN_IF_ERROR(deleter->delete_file(join_path(base_dir, file.name())));
+        garbage_files->emplace_back(join_path(base_dir, file.name()));
         *garbage_data_size += file.size();
     }
-    return Status::OK();
 }
 
+// The vacuum watermark of a tablet is the |final_retain_version| of its last successful vacuum: the garbage
+// files recorded in the metadata of versions <= watermark have been deleted, so have the metadata files of
+// versions < watermark. The next vacuum only travels the metadata after the watermark.
+// It is persisted as a decimal string in a file next to the tablet metadata files, 0 means no watermark.
+static StatusOr<int64_t> load_vacuum_watermark(FileSystem* fs, const std::string& path) {
+    auto file_or = fs->new_random_access_file(path);
+    if (file_or.status().is_not_found()) {
+        return 0;
+    }
+    ASSIGN_OR_RETURN(auto file, std::move(file_or));
+    auto content_or = file->read_all();
+    if (content_or.status().is_not_found()) {
+        return 0;
+    }
+    ASSIGN_OR_RETURN(auto content, std::move(content_or));
+    int64_t watermark = 0;
+    if (!safe_strto64(content, &watermark) || watermark < 0) {
+        LOG(WARNING) << "Ignored invalid vacuum watermark " << path << ": " << content;
+        return 0;
+    }
+    return watermark;
+}
+
+static Status save_vacuum_watermark(FileSystem* fs, const std::string& path, int64_t watermark) {
+    WritableFileOptions opts{.sync_on_close = true, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
+    ASSIGN_OR_RETURN(auto file, fs->new_writable_file(opts, path));
+    RETURN_IF_ERROR(file->append(std::to_string(watermark)));
+    return file->close();
+}
+
+// The files to delete of a tablet found by collect_files_to_vacuum.
+struct TabletVacuumFiles {
+    std::vector<std::string> datafiles;
+    std::vector<std::string> metafiles;
+    int64_t datafile_size = 0;
+    // The new vacuum watermark of the tablet, 0 if it's unchanged.
+    int64_t watermark = 0;
+};
+
 static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_view root_dir, int64_t tablet_id,
                                       int64_t grace_timestamp, int64_t min_retain_version,
-                                      AsyncFileDeleter* datafile_deleter, AsyncFileDeleter* metafile_deleter,
-                                      int64_t* total_datafile_size) {
+                                      TabletVacuumFiles* vacuum_files) {
     auto t0 = butil::gettimeofday_ms();
     auto meta_dir = join_path(root_dir, kMetadataDirectoryName);
     auto data_dir = join_path(root_dir, kSegmentDirectoryName);
@@ -279,9 +328,11 @@ static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_vie
     // grace_timestamp <= 0 means no grace timestamp
     auto skip_check_grace_timestamp = grace_timestamp <= 0;
     ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(root_dir));
-    // Starting at |*final_retain_version|, read the tablet metadata forward along
-    // the |prev_garbage_version| pointer until the tablet metadata does not exist.
-    while (version > 0) {
+    ASSIGN_OR_RETURN(auto watermark,
+                     load_vacuum_watermark(fs.get(), join_path(meta_dir, vacuum_watermark_filename(tablet_id))));
+    // Starting at |*final_retain_version|, read the tablet metadata forward along the |prev_garbage_version|
+    // pointer until the tablet metadata does not exist or has been vacuumed.
+    while (version > watermark) {
         auto path = join_path(meta_dir, tablet_metadata_filename(tablet_id, version));
         auto res = tablet_mgr->get_tablet_metadata(path, false);
         TEST_SYNC_POINT_CALLBACK("collect_files_to_vacuum:get_tablet_metadata", &res);
@@ -293,7 +344,7 @@ static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_vie
             auto metadata = std::move(res).value();
             if (skip_check_grace_timestamp) {
                 DCHECK_LE(version, final_retain_version);
-                RETURN_IF_ERROR(collect_garbage_files(*metadata, data_dir, datafile_deleter, total_datafile_size));
+                collect_garbage_files(*metadata, data_dir, &vacuum_files->datafiles, &vacuum_files->datafile_size);
             } else {
                 int64_t compare_time = 0;
                 if (metadata->has_commit_time() && metadata->commit_time() > 0) {
@@ -320,7 +371,8 @@ static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_vie
                     skip_check_grace_timestamp = true;
 
                     // The metadata will be retained, but garbage files recorded in it can be deleted.
-                    RETURN_IF_ERROR(collect_garbage_files(*metadata, data_dir, datafile_deleter, total_datafile_size));
+                    collect_garbage_files(*metadata, data_dir, &vacuum_files->datafiles,
+                                          &vacuum_files->datafile_size);
                 } else {
                     DCHECK_LE(version, final_retain_version);
                     final_retain_version = version;
@@ -339,8 +391,14 @@ static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_vie
         return Status::OK();
     }
     DCHECK_LE(version, final_retain_version);
-    for (auto v = version + 1; v < final_retain_version; v++) {
-        RETURN_IF_ERROR(metafile_deleter->delete_file(join_path(meta_dir, tablet_metadata_filename(tablet_id, v))));
+    // The metadata files of versions < watermark have been deleted by the previous vacuum, and the one of
+    // the watermark version was retained by it.
+    auto first_version = (watermark > 0 && version <= watermark) ? watermark : version + 1;
+    for (auto v = first_version; v < final_retain_version; v++) {
+        vacuum_files->metafiles.emplace_back(join_path(meta_dir, tablet_metadata_filename(tablet_id, v)));
+    }
+    if (final_retain_version > watermark) {
+        vacuum_files->watermark = final_retain_version;
     }
     return Status::OK();
 }
@@ -365,20 +423,52 @@ static Status vacuum_tablet_metadata(TabletManager* tablet_mgr, std::string_view
     DCHECK(vacuumed_files != nullptr);
     DCHECK(vacuumed_file_size != nullptr);
 
+    // Travel the metadata of the tablets in parallel.
+    std::vector<TabletVacuumFiles> tablet_files(tablet_ids.size());
+    std::vector<Status> statuses(tablet_ids.size());
+    tablet_mgr->run_metadata_fetches(tablet_ids.size(), [&](size_t i) {
+        statuses[i] = collect_files_to_vacuum(tablet_mgr, root_dir, tablet_ids[i], grace_timestamp,
+                                              min_retain_version, &tablet_files[i]);
+    });
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+
+    // Delete the files of all the tablets in shared batches, the data files must be deleted before the
+    // metadata files recording them.
+    AsyncFileDeleter datafile_deleter(config::lake_vacuum_min_batch_delete_size);
+    for (auto& files : tablet_files) {
+        for (auto& path : files.datafiles) {
+            RETURN_IF_ERROR(datafile_deleter.delete_file(std::move(path)));
+        }
+        (*vacuumed_file_size) += files.datafile_size;
+    }
+    RETURN_IF_ERROR(datafile_deleter.finish());
+
     auto metafile_delete_cb = [=](const std::vector<std::string>& files) {
         erase_tablet_metadata_from_metacache(tablet_mgr, files);
     };
-
-    for (auto tablet_id : tablet_ids) {
-        AsyncFileDeleter datafile_deleter(config::lake_vacuum_min_batch_delete_size);
-        AsyncFileDeleter metafile_deleter(INT64_MAX, metafile_delete_cb);
-        RETURN_IF_ERROR(collect_files_to_vacuum(tablet_mgr, root_dir, tablet_id, grace_timestamp, min_retain_version,
-                                                &datafile_deleter, &metafile_deleter, vacuumed_file_size));
-        RETURN_IF_ERROR(datafile_deleter.finish());
-        RETURN_IF_ERROR(metafile_deleter.finish());
-        (*vacuumed_files) += datafile_deleter.delete_count();
-        (*vacuumed_files) += metafile_deleter.delete_count();
+    AsyncFileDeleter metafile_deleter(config::lake_vacuum_min_batch_delete_size, metafile_delete_cb);
+    for (auto& files : tablet_files) {
+        for (auto& path : files.metafiles) {
+            RETURN_IF_ERROR(metafile_deleter.delete_file(std::move(path)));
+        }
     }
+    RETURN_IF_ERROR(metafile_deleter.finish());
+    (*vacuumed_files) += datafile_deleter.delete_count();
+    (*vacuumed_files) += metafile_deleter.delete_count();
+
+    // The watermark only saves the work of the next vacuum, failing to save it is not an error.
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(root_dir));
+    auto meta_dir = join_path(root_dir, kMetadataDirectoryName);
+    tablet_mgr->run_metadata_fetches(tablet_ids.size(), [&](size_t i) {
+        if (tablet_files[i].watermark <= 0) {
+            return;
+        }
+        auto path = join_path(meta_dir, vacuum_watermark_filename(tablet_ids[i]));
+        auto st = save_vacuum_watermark(fs.get(), path, tablet_files[i].watermark);
+        LOG_IF(WARNING, !st.ok()) << "Fail to save vacuum watermark " << path << ": " << st;
+    });
     return Status::OK();
 }
 
@@ -559,7 +649,15 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
         }
     }
 
+    std::vector<std::string> watermarks;
     RETURN_IF_ERROR(ignore_not_found(fs->iterate_dir(meta_dir, [&](std::string_view name) {
+        if (is_vacuum_watermark(name)) {
+            auto tablet_id = parse_vacuum_watermark_filename(name);
+            if (std::binary_search(tablet_ids.begin(), tablet_ids.end(), tablet_id)) {
+                watermarks.emplace_back(join_path(meta_dir, name));
+            }
+            return true;
+        }
         if (!is_tablet_metadata(name)) {
             return true;
         }
@@ -592,7 +690,11 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
                     latest_metadata = metadata;
                 }
                 int64_t dummy_file_size = 0;
-                RETURN_IF_ERROR(collect_garbage_files(*metadata, data_dir, &deleter, &dummy_file_size));
+                std::vector<std::string> garbage_files;
+                collect_garbage_files(*metadata, data_dir, &garbage_files, &dummy_file_size);
+                for (auto& path : garbage_files) {
+                    RETURN_IF_ERROR(deleter.delete_file(std::move(path)));
+                }
                 if (metadata->has_prev_garbage_version()) {
                     garbage_version = metadata->prev_garbage_version();
                 } else {
@@ -619,6 +721,9 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
             RETURN_IF_ERROR(deleter.delete_file(std::move(path)));
         }
     }
+    for (auto& path : watermarks) {
+        RETURN_IF_ERROR(deleter.delete_file(std::move(path)));
+    }
 
     return deleter.finish();
 }
@@ -17,6 +17,7 @@
 #include "runtime/runtime_state.h"
 #include "storage/chunk_helper.h"
 #include "storage/compaction_utils.h"
+#include "storage/lake/column_access_stats.h"
 #include "storage/lake/rowset.h"
 #include "storage/lake/tablet_metadata.h"
 #include "storage/lake/tablet_reader.h"
@@ -54,8 +55,15 @@ Status VerticalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flush
     DeferOp defer([&]() { writer->close(); });
 
     std::vector<std::vector<uint32_t>> column_groups;
-    CompactionUtils::split_column_into_groups(_tablet_schema->num_columns(), _tablet_schema->sort_key_idxes(),
-                                              config::vertical_compaction_max_columns_per_group, &column_groups);
+    std::vector<std::vector<ColumnId>> column_sets = hot_column_sets();
+    if (column_sets.empty()) {
+        CompactionUtils::split_column_into_groups(_tablet_schema->num_columns(), _tablet_schema->sort_key_idxes(),
+                                                  config::vertical_compaction_max_columns_per_group, &column_groups);
+    } else {
+        CompactionUtils::split_column_into_groups_by_access(
+                _tablet_schema->num_columns(), _tablet_schema->sort_key_idxes(),
+                config::vertical_compaction_max_columns_per_group, column_sets, &column_groups);
+    }
     auto column_group_size = column_groups.size();
 
     VLOG(3) << "Start vertical compaction. tablet: " << _tablet.id()
@@ -96,6 +104,9 @@ Status VerticalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flush
         op_compaction->mutable_output_rowset()->add_segments(std::move(file.path));
         op_compaction->mutable_output_rowset()->add_segment_size(file.size.value());
     }
+    for (auto& zone_map : writer->segment_zone_maps()) {
+        op_compaction->mutable_output_rowset()->add_segment_zone_maps()->CopyFrom(zone_map);
+    }
 
     op_compaction->mutable_output_rowset()->set_num_rows(writer->num_rows());
     op_compaction->mutable_output_rowset()->set_data_size(writer->data_size());
@@ -114,6 +125,28 @@ Status VerticalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flush
     return Status::OK();
 }
 
+std::vector<std::vector<ColumnId>> VerticalCompactionTask::hot_column_sets() const {
+    std::vector<std::vector<ColumnId>> column_sets;
+    if (!config::enable_lake_column_access_layout || _tablet_schema->id() == TabletSchema::invalid_id()) {
+        return column_sets;
+    }
+    auto column_uid_sets = ColumnAccessStats::instance()->hot_column_sets(
+            _tablet_schema->id(), config::lake_column_access_hot_set_min_ratio);
+    for (const auto& column_uids : column_uid_sets) {
+        std::vector<ColumnId> columns;
+        for (auto uid : column_uids) {
+            int32_t index = _tablet_schema->field_index(uid);
+            if (index >= 0) {
+                columns.emplace_back(index);
+            }
+        }
+        if (!columns.empty()) {
+            column_sets.emplace_back(std::move(columns));
+        }
+    }
+    return column_sets;
+}
+
 StatusOr<int32_t> VerticalCompactionTask::calculate_chunk_size_for_column_group(
         const std::vector<uint32_t>& column_group) {
     int64_t total_mem_footprint = 0;
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "storage/lake/compaction_task.h"
+#include "storage/olap_common.h"
 
 namespace starrocks {
 class Chunk;
@@ -44,6 +45,9 @@ public:
 private:
     StatusOr<int32_t> calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
 
+    // The sets of column indexes usually read together by scans, see ColumnAccessStats.
+    std::vector<std::vector<ColumnId>> hot_column_sets() const;
+
     Status compact_column_group(bool is_key, int column_group_index, size_t num_column_groups,
                                 const std::vector<uint32_t>& column_group, std::unique_ptr<TabletWriter>& writer,
                                 RowSourceMaskBuffer* mask_buffer, std::vector<RowSourceMask>* source_masks,
@@ -14,12 +14,19 @@
 
 #include "storage/local_tablet_reader.h"
 
+#include <bthread/bthread.h>
+#include <bthread/condition_variable.h>
+#include <bthread/mutex.h>
+
+#include "common/config.h"
 #include "gen_cpp/internal_service.pb.h"
+#include "gutil/strings/join.h"
 #include "serde/protobuf_serde.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_index.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/projection_iterator.h"
+#include "storage/row_cache.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
 #include "storage/tablet_reader.h"
@@ -99,8 +106,132 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<std::st
     return multi_get(keys, value_column_ids, found, values);
 }
 
+// Coalesces the concurrent multi_gets on the same tablet version and value columns. The first request of a batch
+// becomes the leader, it waits for `short_circuit_multi_get_batch_window_us` to collect the keys of the followers,
+// then performs one multi_get over all the keys and hands the results back to each request.
+class MultiGetCoalescer {
+public:
+    using MultiGetFunc = std::function<Status(const Chunk&, std::vector<bool>&, Chunk&)>;
+
+    static MultiGetCoalescer* instance() {
+        static MultiGetCoalescer coalescer;
+        return &coalescer;
+    }
+
+    Status multi_get(const std::string& batch_key, const Chunk& keys, std::vector<bool>& found, Chunk& values,
+                     const MultiGetFunc& func);
+
+private:
+    struct Request {
+        const Chunk* keys;
+        std::vector<bool>* found;
+        Chunk* values;
+    };
+
+    struct Batch {
+        std::vector<Request> requests;
+        size_t num_keys{0};
+        bool done{false};
+        Status status;
+        bthread::ConditionVariable cv;
+    };
+
+    static Status _execute(std::vector<Request>& requests, const MultiGetFunc& func);
+
+    bthread::Mutex _mutex;
+    std::unordered_map<std::string, std::shared_ptr<Batch>> _open_batches;
+};
+
+Status MultiGetCoalescer::multi_get(const std::string& batch_key, const Chunk& keys, std::vector<bool>& found,
+                                    Chunk& values, const MultiGetFunc& func) {
+    const size_t max_keys = std::max(1, config::short_circuit_multi_get_batch_max_keys);
+    std::shared_ptr<Batch> batch;
+    {
+        std::unique_lock l(_mutex);
+        auto it = _open_batches.find(batch_key);
+        if (it != _open_batches.end() && it->second->num_keys + keys.num_rows() <= max_keys) {
+            // join the open batch and wait for its leader
+            batch = it->second;
+            batch->requests.push_back({&keys, &found, &values});
+            batch->num_keys += keys.num_rows();
+            while (!batch->done) {
+                batch->cv.wait(l);
+            }
+            return batch->status;
+        }
+        batch = std::make_shared<Batch>();
+        batch->requests.push_back({&keys, &found, &values});
+        batch->num_keys = keys.num_rows();
+        _open_batches[batch_key] = batch;
+    }
+
+    bthread_usleep(config::short_circuit_multi_get_batch_window_us);
+
+    std::vector<Request> requests;
+    {
+        std::lock_guard l(_mutex);
+        auto it = _open_batches.find(batch_key);
+        if (it != _open_batches.end() && it->second == batch) {
+            _open_batches.erase(it);
+        }
+        requests.swap(batch->requests);
+    }
+    auto st = _execute(requests, func);
+    {
+        std::lock_guard l(_mutex);
+        batch->status = st;
+        batch->done = true;
+    }
+    batch->cv.notify_all();
+    return st;
+}
+
+Status MultiGetCoalescer::_execute(std::vector<Request>& requests, const MultiGetFunc& func) {
+    if (requests.size() == 1) {
+        return func(*requests[0].keys, *requests[0].found, *requests[0].values);
+    }
+    auto all_keys = requests[0].keys->clone_empty();
+    for (const auto& request : requests) {
+        all_keys->append(*request.keys);
+    }
+    std::vector<bool> all_found;
+    auto all_values = requests[0].values->clone_empty();
+    RETURN_IF_ERROR(func(*all_keys, all_found, *all_values));
+
+    // the values of the found keys are in the order of the keys
+    size_t key_offset = 0;
+    size_t value_offset = 0;
+    for (const auto& request : requests) {
+        size_t num_keys = request.keys->num_rows();
+        size_t num_found = 0;
+        request.found->assign(all_found.begin() + key_offset, all_found.begin() + key_offset + num_keys);
+        for (bool f : *request.found) {
+            num_found += f;
+        }
+        request.values->reset();
+        request.values->append(*all_values, value_offset, num_found);
+        key_offset += num_keys;
+        value_offset += num_found;
+    }
+    return Status::OK();
+}
+
 Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_t>& value_column_ids,
                                     std::vector<bool>& found, Chunk& values) {
+    if (config::short_circuit_multi_get_batch_window_us <= 0 ||
+        keys.num_rows() >= config::short_circuit_multi_get_batch_max_keys) {
+        return _multi_get(keys, value_column_ids, found, values);
+    }
+    std::string batch_key = strings::Substitute("$0:$1:$2", _tablet->tablet_id(), _version,
+                                                JoinInts(value_column_ids, ","));
+    return MultiGetCoalescer::instance()->multi_get(
+            batch_key, keys, found, values, [this, &value_column_ids](const Chunk& k, std::vector<bool>& f, Chunk& v) {
+                return _multi_get(k, value_column_ids, f, v);
+            });
+}
+
+Status LocalTabletReader::_multi_get(const Chunk& keys, const std::vector<uint32_t>& value_column_ids,
+                                     std::vector<bool>& found, Chunk& values) {
     int64_t t_start = MonotonicMillis();
     size_t n = keys.num_rows();
     if (n > UINT32_MAX) {
@@ -118,42 +249,130 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
     RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(*tablet_schema->schema(), &pk_column));
     PrimaryKeyEncoder::encode(*tablet_schema->schema(), keys, 0, keys.num_rows(), pk_column.get());
 
+    // serve the keys from the row cache at first, see TabletUpdates::row_cache_seq() for the population protocol
+    auto* row_cache = RowCache::instance();
+    auto* updates = _tablet->updates();
+    uint64_t row_cache_seq = 0;
+    std::string row_cache_prefix;
+    std::vector<uint8_t> cached(n, 0);
+    size_t num_cached = 0;
+    auto read_column_schema = ChunkHelper::convert_schema(tablet_schema, value_column_ids);
+    std::vector<std::unique_ptr<Column>> cached_columns;
+    if (row_cache != nullptr) {
+        row_cache_seq = updates->row_cache_seq();
+        row_cache_prefix = RowCache::key_prefix(_tablet->tablet_id(), updates->row_cache_generation());
+        std::vector<Column*> dest_columns;
+        for (uint32_t i = 0; i < value_column_ids.size(); ++i) {
+            auto column = ChunkHelper::column_from_field(*read_column_schema.field(i).get())->clone_empty();
+            dest_columns.push_back(column.get());
+            cached_columns.emplace_back(std::move(column));
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (row_cache->lookup(RowCache::key(row_cache_prefix, *pk_column, i), _version, value_column_ids,
+                                  dest_columns)) {
+                cached[i] = 1;
+                num_cached++;
+            }
+        }
+    }
+    if (num_cached > 0 && num_cached == n) {
+        found.assign(n, true);
+        values.reset();
+        for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
+            values.get_column_by_index(col_idx)->append(*cached_columns[col_idx]);
+        }
+        return Status::OK();
+    }
+    if (num_cached > 0) {
+        std::vector<uint32_t> miss_idxes;
+        for (uint32_t i = 0; i < n; i++) {
+            if (!cached[i]) {
+                miss_idxes.push_back(i);
+            }
+        }
+        auto miss_pk_column = pk_column->clone_empty();
+        miss_pk_column->append_selective(*pk_column, miss_idxes.data(), 0, miss_idxes.size());
+        pk_column = std::move(miss_pk_column);
+    }
+    size_t num_miss = pk_column->size();
+
     // search pks in pk index to get rowids
     EditVersion edit_version;
-    std::vector<uint64_t> rowids(n);
-    RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &edit_version, &rowids));
+    std::vector<uint64_t> rowids(num_miss);
+    RETURN_IF_ERROR(updates->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &edit_version, &rowids));
     if (edit_version.major_number() != _version) {
         return Status::InternalError(
                 strings::Substitute("multi_get version not match tablet:$0 current_version:$1 read_version:$2",
                                     _tablet->tablet_id(), edit_version.to_string(), _version));
     }
-    if (rowids.size() != n) {
+    if (rowids.size() != num_miss) {
         return Status::InternalError(strings::Substitute("multi_get rowid size not match tablet:$0 $1 != $2",
-                                                         _tablet->tablet_id(), rowids.size(), n));
+                                                         _tablet->tablet_id(), rowids.size(), num_miss));
     }
 
     // sort rowids by rssid, so we can plan&perform read operations by rowset/segment
     std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
     vector<uint32_t> idxes;
-    plan_read_by_rssid(rowids, found, rowids_by_rssid, idxes);
+    std::vector<bool> miss_found;
+    plan_read_by_rssid(rowids, miss_found, rowids_by_rssid, idxes);
 
-    auto read_column_schema = ChunkHelper::convert_schema(tablet_schema, value_column_ids);
     std::vector<std::unique_ptr<Column>> read_columns(value_column_ids.size());
     for (uint32_t i = 0; i < read_columns.size(); ++i) {
         read_columns[i] = ChunkHelper::column_from_field(*read_column_schema.field(i).get())->clone_empty();
     }
-    RETURN_IF_ERROR(_tablet->updates()->get_column_values(value_column_ids, _version, false, rowids_by_rssid,
-                                                          &read_columns, nullptr, tablet_schema));
+    RETURN_IF_ERROR(updates->get_column_values(value_column_ids, _version, false, rowids_by_rssid, &read_columns,
+                                               nullptr, tablet_schema));
 
     // reorder read values to input keys' order and put into values output parameter
     values.reset();
-    for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
-        values.get_column_by_index(col_idx)->append_selective(*read_columns[col_idx], idxes.data(), 0, idxes.size());
+    if (num_cached == 0) {
+        found = miss_found;
+        for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
+            values.get_column_by_index(col_idx)->append_selective(*read_columns[col_idx], idxes.data(), 0,
+                                                                  idxes.size());
+        }
+    } else {
+        found.assign(n, false);
+        size_t cached_row = 0;
+        size_t miss_idx = 0;
+        size_t read_idx = 0;
+        for (size_t i = 0; i < n; i++) {
+            size_t src_row = 0;
+            if (cached[i]) {
+                found[i] = true;
+                src_row = cached_row++;
+            } else if (miss_found[miss_idx++]) {
+                found[i] = true;
+                src_row = idxes[read_idx++];
+            } else {
+                continue;
+            }
+            for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
+                const auto& src = cached[i] ? cached_columns[col_idx] : read_columns[col_idx];
+                values.get_column_by_index(col_idx)->append(*src, src_row, 1);
+            }
+        }
+    }
+
+    // populate the rows read from the tablet, unless a rowset commit was being applied meanwhile
+    if (row_cache != nullptr && (row_cache_seq & 1) == 0) {
+        std::vector<std::string> populated_keys;
+        for (size_t i = 0, read_idx = 0; i < num_miss; i++) {
+            if (miss_found[i]) {
+                populated_keys.emplace_back(RowCache::key(row_cache_prefix, *pk_column, i));
+                row_cache->insert(populated_keys.back(), _version, value_column_ids, read_columns, idxes[read_idx++]);
+            }
+        }
+        if (updates->row_cache_seq() != row_cache_seq) {
+            for (const auto& key : populated_keys) {
+                row_cache->erase(key);
+            }
+        }
     }
     int64_t t_end = MonotonicMillis();
-    LOG(INFO) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 time:$5ms",
-                                     _tablet->tablet_id(), _version, value_column_ids.size(), n, idxes.size(),
-                                     t_end - t_start);
+    VLOG(2) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 cached:$4 found:$5 time:$6ms",
+                                   _tablet->tablet_id(), _version, value_column_ids.size(), n, num_cached,
+                                   num_cached + idxes.size(), t_end - t_start);
     return Status::OK();
 }
 
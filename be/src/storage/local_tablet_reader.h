@@ -46,6 +46,9 @@ public:
                                     const std::vector<const ColumnPredicate*>& predicates);
 
 private:
+    Status _multi_get(const Chunk& keys, const std::vector<uint32_t>& value_column_ids, std::vector<bool>& found,
+                      Chunk& values);
+
     TabletSharedPtr _tablet;
     int64_t _version{0};
 };
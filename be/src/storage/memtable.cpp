@@ -19,6 +19,7 @@
 #include "column/binary_column.h"
 #include "column/json_column.h"
 #include "common/logging.h"
+#include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
@@ -135,8 +136,8 @@ size_t MemTable::memory_usage() const {
         size += _result_chunk->memory_usage();
     }
 
-    // _aggregator_memory_usage is 0 if keys type is DUP_KEYS
-    return size + _chunk_memory_usage + _aggregator_memory_usage;
+    // _aggregator_memory_usage and _sorted_runs_memory_usage are 0 if keys type is DUP_KEYS
+    return size + _chunk_memory_usage + _aggregator_memory_usage + _sorted_runs_memory_usage;
 }
 
 size_t MemTable::write_buffer_size() const {
@@ -144,8 +145,8 @@ size_t MemTable::write_buffer_size() const {
         return 0;
     }
 
-    // _aggregator_bytes_usage is 0 if keys type is DUP_KEYS
-    return _chunk_bytes_usage + _aggregator_bytes_usage;
+    // _aggregator_bytes_usage and _sorted_runs_bytes_usage are 0 if keys type is DUP_KEYS
+    return _chunk_bytes_usage + _aggregator_bytes_usage + _sorted_runs_bytes_usage;
 }
 
 size_t MemTable::write_buffer_rows() const {
@@ -258,26 +259,29 @@ Status MemTable::finalize() {
                 RETURN_IF_ERROR(_merge());
             }
 
-            if (_merge_count > 1) {
-                _chunk = _aggregator->aggregate_result();
-                _aggregator->aggregate_reset();
-
+            _chunk.reset();
+            if (_sorted_runs.size() > 1) {
                 int64_t t1 = MonotonicMicros();
-                RETURN_IF_ERROR(_sort(true));
+                RETURN_IF_ERROR(_merge_sorted_runs());
                 int64_t t2 = MonotonicMicros();
                 _aggregate(true);
                 int64_t t3 = MonotonicMicros();
-                VLOG(1) << strings::Substitute("memtable final sort:$0 agg:$1 total:$2", t2 - t1, t3 - t2, t3 - t1);
-            } else {
+                VLOG(1) << strings::Substitute("memtable final merge:$0 agg:$1 total:$2 runs:$3", t2 - t1, t3 - t2,
+                                               t3 - t1, _merge_count);
+                _result_chunk = _aggregator->aggregate_result();
+            } else if (_sorted_runs.size() == 1) {
                 // if there is only one data chunk and merge once,
                 // no need to perform an additional merge.
-                _chunk.reset();
-                _result_chunk.reset();
+                _result_chunk = std::move(_sorted_runs[0]);
+            } else {
+                _result_chunk = _aggregator->aggregate_result();
             }
+            _sorted_runs.clear();
+            _sorted_runs_memory_usage = 0;
+            _sorted_runs_bytes_usage = 0;
             _chunk_memory_usage = 0;
             _chunk_bytes_usage = 0;
 
-            _result_chunk = _aggregator->aggregate_result();
             if (_keys_type == PRIMARY_KEYS &&
                 PrimaryKeyEncoder::encode_exceed_limit(*_vectorized_schema, *_result_chunk.get(), 0,
                                                        _result_chunk->num_rows(), config::primary_key_limit_size)) {
@@ -381,8 +385,6 @@ void MemTable::_aggregate(bool is_final) {
     DCHECK(_aggregator->is_do_aggregate());
 
     _aggregator->aggregate();
-    _aggregator_memory_usage = _aggregator->memory_usage();
-    _aggregator_bytes_usage = _aggregator->bytes_usage();
 
     // impossible finish
     DCHECK(!_aggregator->is_finish());
@@ -390,12 +392,98 @@ void MemTable::_aggregate(bool is_final) {
     _merged_rows = _aggregator->merged_rows();
 
     if (is_final) {
+        _aggregator_memory_usage = _aggregator->memory_usage();
+        _aggregator_bytes_usage = _aggregator->bytes_usage();
         _result_chunk.reset();
     } else {
+        // keep the aggregated rows as a sorted run, the runs are merged at finalize
+        ChunkPtr run = _aggregator->aggregate_result();
+        _aggregator->aggregate_reset();
+        _sorted_runs_memory_usage += run->memory_usage();
+        _sorted_runs_bytes_usage += run->bytes_usage();
+        _sorted_runs.emplace_back(std::move(run));
         _result_chunk->reset();
     }
 }
 
+Status MemTable::_merge_sorted_runs() {
+    // the runs are sorted by the same columns as _sort(false)
+    bool by_sort_key = _keys_type != KeysType::PRIMARY_KEYS;
+    // each item is the sort columns of a merged range of runs, along with the
+    // <run index, row index> of each of its rows.
+    struct MergeItem {
+        SortedRun run;
+        Permutation rows;
+    };
+    SortDescs sort_descs;
+    std::vector<MergeItem> items;
+    for (uint32_t i = 0; i < _sorted_runs.size(); i++) {
+        const ChunkPtr& chunk = _sorted_runs[i];
+        if (chunk->num_rows() == 0) {
+            continue;
+        }
+        Columns columns;
+        sort_descs = SortDescs();
+        RETURN_IF_ERROR(_get_sort_columns(*chunk, by_sort_key, &columns, &sort_descs));
+        auto& item = items.emplace_back(MergeItem{SortedRun(chunk, std::move(columns)), Permutation()});
+        item.rows.reserve(chunk->num_rows());
+        for (uint32_t j = 0; j < chunk->num_rows(); j++) {
+            item.rows.emplace_back(i, j);
+        }
+    }
+    // merge the adjacent items level by level, the left item goes first on ties which keeps the insertion order
+    Permutation perm;
+    while (items.size() > 1) {
+        std::vector<MergeItem> next_items;
+        next_items.reserve((items.size() + 1) / 2);
+        for (size_t i = 0; i + 1 < items.size(); i += 2) {
+            auto& left = items[i];
+            auto& right = items[i + 1];
+            RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_descs, left.run, right.run, &perm));
+            Columns columns;
+            for (size_t col = 0; col < left.run.num_columns(); col++) {
+                auto column = left.run.orderby[col]->clone_empty();
+                materialize_column_by_permutation(column.get(), {left.run.orderby[col], right.run.orderby[col]},
+                                                  perm);
+                columns.emplace_back(std::move(column));
+            }
+            Permutation rows;
+            rows.reserve(perm.size());
+            for (const auto& p : perm) {
+                rows.emplace_back(p.chunk_index == 0 ? left.rows[p.index_in_chunk] : right.rows[p.index_in_chunk]);
+            }
+            auto chunk = std::make_shared<Chunk>(columns, Chunk::SlotHashMap());
+            next_items.emplace_back(MergeItem{SortedRun(chunk, std::move(columns)), std::move(rows)});
+            left = MergeItem();
+            right = MergeItem();
+        }
+        if (items.size() % 2 == 1) {
+            next_items.emplace_back(std::move(items.back()));
+        }
+        items.swap(next_items);
+    }
+    if (items.empty()) {
+        _result_chunk = _sorted_runs[0]->clone_empty_with_schema(0);
+        return Status::OK();
+    }
+    Permutation rows = std::move(items[0].rows);
+    items.clear();
+    // materialize column by column, and release the column of the runs as soon as possible to lower the peak memory
+    _result_chunk = _sorted_runs[0]->clone_empty_with_schema(0);
+    for (size_t col = 0; col < _result_chunk->num_columns(); col++) {
+        Columns columns;
+        columns.reserve(_sorted_runs.size());
+        for (auto& run : _sorted_runs) {
+            columns.emplace_back(std::move(run->get_column_by_index(col)));
+        }
+        materialize_column_by_permutation(_result_chunk->get_column_by_index(col).get(), columns, rows);
+    }
+    _sorted_runs.clear();
+    _sorted_runs_memory_usage = 0;
+    _sorted_runs_bytes_usage = 0;
+    return Status::OK();
+}
+
 Status MemTable::_sort(bool is_final, bool by_sort_key) {
     SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(_chunk->num_rows()));
     std::swap(perm, _permutations);
@@ -488,6 +576,13 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
 
 Status MemTable::_sort_column_inc(bool by_sort_key) {
     Columns columns;
+    SortDescs sort_descs;
+    RETURN_IF_ERROR(_get_sort_columns(*_chunk, by_sort_key, &columns, &sort_descs));
+    Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
+    return st;
+}
+
+Status MemTable::_get_sort_columns(const Chunk& chunk, bool by_sort_key, Columns* columns, SortDescs* sort_descs) {
     std::vector<ColumnId> sort_key_idxes;
     if (by_sort_key) {
         sort_key_idxes = _vectorized_schema->sort_key_idxes();
@@ -517,22 +612,20 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
     }
 
     for (auto sort_key_idx : sort_key_idxes) {
-        columns.push_back(_chunk->get_column_by_index(sort_key_idx));
+        columns->push_back(chunk.get_column_by_index(sort_key_idx));
     }
 
-    auto sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
+    *sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
     if (!_merge_condition.empty()) {
         for (int i = 0; i < _vectorized_schema->num_fields(); ++i) {
             if (_vectorized_schema->field(i)->name() == _merge_condition) {
-                columns.push_back(_chunk->get_column_by_index(i));
-                sort_descs.descs.emplace_back(1, -1);
+                columns->push_back(chunk.get_column_by_index(i));
+                sort_descs->descs.emplace_back(1, -1);
                 break;
             }
         }
     }
-
-    Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
-    return st;
+    return Status::OK();
 }
 
 } // namespace starrocks
@@ -76,6 +76,11 @@ private:
 
     Status _sort(bool is_final, bool by_sort_key = false);
     Status _sort_column_inc(bool by_sort_key = false);
+    // Collect the columns of |chunk| to sort by, and their sort orders.
+    Status _get_sort_columns(const Chunk& chunk, bool by_sort_key, Columns* columns, SortDescs* sort_descs);
+    // k-way merge `_sorted_runs` into `_result_chunk`, the rows with equal sort columns are kept in their
+    // insertion order, the same as a stable sort of all the rows.
+    Status _merge_sorted_runs();
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     void _init_aggregator_if_needed();
@@ -101,6 +106,9 @@ private:
 
     // aggregate
     std::unique_ptr<ChunkAggregator> _aggregator;
+    // the sorted and aggregated rows of each intermediate merge, merged
+    // into one chunk at finalize instead of sorting all the rows again.
+    std::vector<ChunkPtr> _sorted_runs;
 
     uint64_t _merge_count = 0;
 
@@ -123,6 +131,8 @@ private:
     size_t _chunk_bytes_usage = 0;
     size_t _aggregator_memory_usage = 0;
     size_t _aggregator_bytes_usage = 0;
+    size_t _sorted_runs_memory_usage = 0;
+    size_t _sorted_runs_bytes_usage = 0;
 };
 
 inline std::ostream& operator<<(std::ostream& os, const MemTable& table) {
@@ -268,6 +268,9 @@ struct OlapReaderStatistics {
     int64_t rows_gin_filtered = 0;
     int64_t gin_index_filter_ns = 0;
 
+    int64_t rows_vector_index_filtered = 0;
+    int64_t vector_index_filter_ns = 0;
+
     int64_t rowsets_read_count = 0;
     int64_t segments_read_count = 0;
     int64_t total_columns_data_page_count = 0;
@@ -51,6 +51,7 @@
 #include "storage/lake/update_manager.h"
 #include "storage/olap_common.h"
 #include "storage/olap_define.h"
+#include "storage/page_cache_warmer.h"
 #include "storage/persistent_index_compaction_manager.h"
 #include "storage/publish_version_manager.h"
 #include "storage/replication_txn_manager.h"
@@ -252,6 +253,17 @@ Status StorageEngine::start_bg_threads() {
     if (!config::disable_storage_page_cache) {
         _adjust_cache_thread = std::thread([this] { _adjust_pagecache_callback(nullptr); });
         Thread::set_thread_name(_adjust_cache_thread, "adjust_cache");
+
+        if (!get_stores().empty()) {
+            _page_cache_warmup_thread = std::thread([this] { _page_cache_warmup_callback(nullptr); });
+            Thread::set_thread_name(_page_cache_warmup_thread, "pagecache_warmup");
+        }
+    }
+
+    if (config::pindex_preload_tablet_num > 0) {
+        auto tablets = _tablet_manager->pick_tablets_to_preload_primary_index(config::pindex_preload_tablet_num);
+        auto st = _update_manager->preload_primary_indexes(tablets);
+        LOG_IF(WARNING, !st.ok()) << "preload primary index failed: " << st;
     }
 
     LOG(INFO) << "All backgroud threads of storage engine have started.";
@@ -275,6 +287,35 @@ void evict_pagecache(StoragePageCache* cache, int64_t bytes_to_dec, std::atomic<
     }
 }
 
+void* StorageEngine::_page_cache_warmup_callback(void* arg) {
+    const std::string path = get_stores()[0]->path() + "/page_cache_hot_list";
+    auto* warmer = PageCacheWarmer::instance();
+    if (config::page_cache_hot_list_capacity > 0) {
+        auto stats = warmer->warm_up(path, config::page_cache_warmup_bytes_per_second, _bg_worker_stopped);
+        if (stats.ok()) {
+            LOG(INFO) << "page cache warmed up from " << path << ", pages: " << stats->pages
+                      << ", bytes: " << stats->bytes << ", skipped pages: " << stats->skipped_pages;
+        } else {
+            LOG(WARNING) << "warm up page cache from " << path << " failed: " << stats.status();
+        }
+    }
+
+    auto save_hot_list = [&]() {
+        const int32_t capacity = config::page_cache_hot_list_capacity;
+        if (capacity > 0) {
+            auto st = warmer->save_hot_list(path, capacity);
+            LOG_IF(WARNING, !st.ok()) << "save page cache hot list to " << path << " failed: " << st;
+        }
+    };
+    while (!_bg_worker_stopped.load(std::memory_order_consume)) {
+        SLEEP_IN_BG_WORKER(config::page_cache_hot_list_save_interval_seconds);
+        save_hot_list();
+    }
+    // Save it at shutdown too, so that a restarted BE warms up with the latest hot pages.
+    save_hot_list();
+    return nullptr;
+}
+
 void* StorageEngine::_adjust_pagecache_callback(void* arg_this) {
 #ifdef GOOGLE_PROFILER
     ProfilerRegisterThread();
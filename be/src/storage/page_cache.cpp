@@ -36,6 +36,7 @@
 
 #include <malloc.h>
 
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
@@ -48,12 +49,15 @@ namespace starrocks {
 METRIC_DEFINE_UINT_GAUGE(page_cache_lookup_count, MetricUnit::OPERATIONS);
 METRIC_DEFINE_UINT_GAUGE(page_cache_hit_count, MetricUnit::OPERATIONS);
 METRIC_DEFINE_UINT_GAUGE(page_cache_capacity, MetricUnit::BYTES);
+METRIC_DEFINE_UINT_GAUGE(page_cache_compressed_lookup_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(page_cache_compressed_hit_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(page_cache_compressed_capacity, MetricUnit::BYTES);
 
 StoragePageCache* StoragePageCache::_s_instance = nullptr;
 
-void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity, size_t compressed_capacity) {
     if (_s_instance == nullptr) {
-        _s_instance = new StoragePageCache(mem_tracker, capacity);
+        _s_instance = new StoragePageCache(mem_tracker, capacity, compressed_capacity);
     }
 }
 
@@ -83,10 +87,34 @@ static void init_metrics() {
     StarRocksMetrics::instance()->metrics()->register_hook("page_cache_capacity", []() {
         page_cache_capacity.set_value(StoragePageCache::instance()->get_capacity());
     });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("page_cache_compressed_lookup_count",
+                                                             &page_cache_compressed_lookup_count);
+    StarRocksMetrics::instance()->metrics()->register_hook("page_cache_compressed_lookup_count", []() {
+        page_cache_compressed_lookup_count.set_value(StoragePageCache::instance()->get_compressed_lookup_count());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("page_cache_compressed_hit_count",
+                                                             &page_cache_compressed_hit_count);
+    StarRocksMetrics::instance()->metrics()->register_hook("page_cache_compressed_hit_count", []() {
+        page_cache_compressed_hit_count.set_value(StoragePageCache::instance()->get_compressed_hit_count());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("page_cache_compressed_capacity",
+                                                             &page_cache_compressed_capacity);
+    StarRocksMetrics::instance()->metrics()->register_hook("page_cache_compressed_capacity", []() {
+        page_cache_compressed_capacity.set_value(StoragePageCache::instance()->get_compressed_capacity());
+    });
+}
+
+static EvictionPolicy page_cache_eviction_policy() {
+    return config::enable_storage_page_cache_tiny_lfu ? EvictionPolicy::TINY_LFU : EvictionPolicy::LRU;
 }
 
-StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE)) {
+StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity, size_t compressed_capacity)
+        : _mem_tracker(mem_tracker),
+          _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE, page_cache_eviction_policy())),
+          _compressed_cache(new_lru_cache(compressed_capacity, ChargeMode::MEMSIZE, page_cache_eviction_policy())) {
     init_metrics();
 }
 
@@ -128,6 +156,51 @@ bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle) {
 }
 
 void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory) {
+    _insert(_cache.get(), key, data, handle, in_memory);
+}
+
+void StoragePageCache::set_compressed_capacity(size_t capacity) {
+#ifndef BE_TEST
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+    _compressed_cache->set_capacity(capacity);
+}
+
+size_t StoragePageCache::get_compressed_capacity() {
+    return _compressed_cache->get_capacity();
+}
+
+uint64_t StoragePageCache::get_compressed_lookup_count() {
+    return _compressed_cache->get_lookup_count();
+}
+
+uint64_t StoragePageCache::get_compressed_hit_count() {
+    return _compressed_cache->get_hit_count();
+}
+
+bool StoragePageCache::lookup_compressed(const CacheKey& key, PageCacheHandle* handle) {
+    auto* lru_handle = _compressed_cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *handle = PageCacheHandle(_compressed_cache.get(), lru_handle);
+    return true;
+}
+
+void StoragePageCache::insert_compressed(const CacheKey& key, const Slice& data, bool in_memory) {
+    PageCacheHandle handle;
+    _insert(_compressed_cache.get(), key, data, &handle, in_memory);
+}
+
+void StoragePageCache::erase_compressed(const CacheKey& key) {
+#ifndef BE_TEST
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+    _compressed_cache->erase(key.encode());
+}
+
+void StoragePageCache::_insert(Cache* cache, const CacheKey& key, const Slice& data, PageCacheHandle* handle,
+                               bool in_memory) {
     // mem size should equals to data size when running UT
     int64_t mem_size = data.size;
 #ifndef BE_TEST
@@ -145,8 +218,8 @@ void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheH
     }
     // Use mem size managed by memory allocator as this record charge size. At the same time, we should record this record size
     // for data fetching when lookup.
-    auto* lru_handle = _cache->insert(key.encode(), data.data, mem_size, deleter, priority, data.size);
-    *handle = PageCacheHandle(_cache.get(), lru_handle);
+    auto* lru_handle = cache->insert(key.encode(), data.data, mem_size, deleter, priority, data.size);
+    *handle = PageCacheHandle(cache, lru_handle);
 }
 
 } // namespace starrocks
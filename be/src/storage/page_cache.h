@@ -78,7 +78,7 @@ public:
     };
 
     // Create global instance of this class
-    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity, size_t compressed_capacity = 0);
 
     static void release_global_cache();
 
@@ -86,7 +86,7 @@ public:
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return _s_instance; }
 
-    StoragePageCache(MemTracker* mem_tracker, size_t capacity);
+    StoragePageCache(MemTracker* mem_tracker, size_t capacity, size_t compressed_capacity = 0);
 
     // Lookup the given page in the cache.
     //
@@ -118,11 +118,36 @@ public:
 
     void prune();
 
+    // The compressed tier keeps the raw bytes of compressed pages, which are several times
+    // smaller than the decompressed ones. Pages read from disk go to the compressed tier
+    // when it is enabled, and are promoted to the decompressed tier when they are hit again.
+    bool compressed_tier_enabled() { return _compressed_cache->get_capacity() > 0; }
+
+    // Same as lookup() and insert(), but for the compressed tier.
+    bool lookup_compressed(const CacheKey& key, PageCacheHandle* handle);
+
+    void insert_compressed(const CacheKey& key, const Slice& data, bool in_memory = false);
+
+    void erase_compressed(const CacheKey& key);
+
+    size_t compressed_memory_usage() const { return _compressed_cache->get_memory_usage(); }
+
+    void set_compressed_capacity(size_t capacity);
+
+    size_t get_compressed_capacity();
+
+    uint64_t get_compressed_lookup_count();
+
+    uint64_t get_compressed_hit_count();
+
 private:
+    void _insert(Cache* cache, const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory);
+
     static StoragePageCache* _s_instance;
 
     MemTracker* _mem_tracker = nullptr;
     std::unique_ptr<Cache> _cache = nullptr;
+    std::unique_ptr<Cache> _compressed_cache = nullptr;
 };
 
 // A handle for StoragePageCache entry. This class make it easy to handle
@@ -0,0 +1,227 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/page_cache_warmer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "column/column.h"
+#include "common/config.h"
+#include "fs/fs.h"
+#include "gen_cpp/segment.pb.h"
+#include "gutil/strings/substitute.h"
+#include "storage/page_cache.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+PageCacheWarmer* PageCacheWarmer::instance() {
+    static PageCacheWarmer warmer;
+    return &warmer;
+}
+
+void PageCacheWarmer::record_access(const std::string& fname, int64_t offset, uint32_t size) {
+    const int32_t capacity = config::page_cache_hot_list_capacity;
+    if (capacity <= 0) {
+        return;
+    }
+    std::string key = StoragePageCache::CacheKey(fname, offset).encode();
+    auto& shard = _shards[phmap::Hash<std::string>()(key) % kNumShards];
+    const size_t shard_capacity = std::max<size_t>(capacity / kNumShards, 1);
+
+    std::lock_guard<std::mutex> l(shard.mutex);
+    if (auto it = shard.pages.find(key); it != shard.pages.end()) {
+        if (it->second.hits < UINT32_MAX) {
+            it->second.hits++;
+        }
+        return;
+    }
+    if (shard.pages.size() >= shard_capacity) {
+        // Age the pages, so that the pages no longer accessed make room for the new ones.
+        for (auto& [_, entry] : shard.pages) {
+            entry.hits /= 2;
+        }
+        phmap::erase_if(shard.pages, [](const auto& kv) { return kv.second.hits == 0; });
+        if (shard.pages.size() >= shard_capacity) {
+            return;
+        }
+    }
+    shard.pages.emplace(std::move(key), Entry{size, 1});
+}
+
+std::vector<PageCacheWarmer::HotPage> PageCacheWarmer::hot_pages(size_t max_pages) const {
+    std::vector<HotPage> pages;
+    for (const auto& shard : _shards) {
+        std::lock_guard<std::mutex> l(shard.mutex);
+        for (const auto& [key, entry] : shard.pages) {
+            // Decode StoragePageCache::CacheKey, the file name followed by the offset.
+            HotPage& page = pages.emplace_back();
+            page.fname = key.substr(0, key.size() - sizeof(int64_t));
+            memcpy(&page.offset, key.data() + page.fname.size(), sizeof(int64_t));
+            page.size = entry.size;
+            page.hits = entry.hits;
+        }
+    }
+    auto by_hits = [](const HotPage& lhs, const HotPage& rhs) { return lhs.hits > rhs.hits; };
+    if (pages.size() > max_pages) {
+        std::nth_element(pages.begin(), pages.begin() + max_pages, pages.end(), by_hits);
+        pages.resize(max_pages);
+    }
+    std::sort(pages.begin(), pages.end(), by_hits);
+    return pages;
+}
+
+// One page per line: "<offset> <size> <hits> <file name>", the file name is the last as it may contain spaces.
+Status PageCacheWarmer::save_hot_list(const std::string& path, size_t max_pages) const {
+    const std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::out | std::ios::trunc);
+        if (!out.is_open()) {
+            return Status::IOError(strings::Substitute("open $0 failed: $1", tmp_path, std::strerror(errno)));
+        }
+        for (const auto& page : hot_pages(max_pages)) {
+            out << page.offset << ' ' << page.size << ' ' << page.hits << ' ' << page.fname << '\n';
+        }
+        out.close();
+        if (out.fail()) {
+            return Status::IOError(strings::Substitute("write $0 failed", tmp_path));
+        }
+    }
+    return FileSystem::Default()->rename_file(tmp_path, path);
+}
+
+StatusOr<std::vector<PageCacheWarmer::HotPage>> PageCacheWarmer::load_hot_list(const std::string& path) {
+    std::vector<HotPage> pages;
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        // Nothing to warm up before the first save.
+        return pages;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        HotPage page;
+        if (!(fields >> page.offset >> page.size >> page.hits) || fields.get() != ' ' ||
+            !std::getline(fields, page.fname) || page.fname.empty()) {
+            return Status::Corruption(strings::Substitute("bad line in page cache hot list $0: $1", path, line));
+        }
+        pages.emplace_back(std::move(page));
+    }
+    return pages;
+}
+
+// Read the page, and keep it in the compressed tier of |cache| if it's compressed and |cache| is not null.
+static Status read_page(RandomAccessFile* file, const PageCacheWarmer::HotPage& page, StoragePageCache* cache) {
+    // The same layout as PageIO::read_and_decompress_page reads: body, footer, footer size and checksum.
+    if (page.size < 8) {
+        return Status::Corruption(strings::Substitute("bad page size $0", page.size));
+    }
+    std::unique_ptr<char[]> data(new char[page.size + Column::APPEND_OVERFLOW_MAX_SIZE]);
+    RETURN_IF_ERROR(file->read_at_fully(page.offset, data.get(), page.size));
+    if (cache == nullptr) {
+        return Status::OK();
+    }
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data.get());
+    if (crc32c::Value(data.get(), page.size - 4) != decode_fixed32_le(bytes + page.size - 4)) {
+        return Status::Corruption("checksum mismatch");
+    }
+    const uint32_t footer_size = decode_fixed32_le(bytes + page.size - 8);
+    PageFooterPB footer;
+    if (footer_size > page.size - 8 || !footer.ParseFromArray(data.get() + page.size - 8 - footer_size, footer_size)) {
+        return Status::Corruption("invalid footer");
+    }
+    // Only compressed pages are kept in the compressed tier.
+    if (page.size - 8 - footer_size == footer.uncompressed_size()) {
+        return Status::OK();
+    }
+    StoragePageCache::CacheKey key(page.fname, page.offset);
+    PageCacheHandle handle;
+    if (!cache->lookup(key, &handle) && !cache->lookup_compressed(key, &handle)) {
+        cache->insert_compressed(key, Slice(data.release(), page.size));
+    }
+    return Status::OK();
+}
+
+StatusOr<PageCacheWarmer::WarmUpStats> PageCacheWarmer::warm_up(const std::string& path, int64_t bytes_per_second,
+                                                                 const std::atomic<bool>& stopped) {
+    ASSIGN_OR_RETURN(auto pages, load_hot_list(path));
+    // Read the pages of a file together and in order.
+    std::sort(pages.begin(), pages.end(), [](const HotPage& lhs, const HotPage& rhs) {
+        return lhs.fname != rhs.fname ? lhs.fname < rhs.fname : lhs.offset < rhs.offset;
+    });
+
+    StoragePageCache* cache = StoragePageCache::instance();
+    if (cache != nullptr && !cache->compressed_tier_enabled()) {
+        cache = nullptr;
+    }
+    WarmUpStats stats;
+    const int64_t start_ns = MonotonicNanos();
+    std::string fname;
+    std::unique_ptr<RandomAccessFile> file;
+    for (const auto& page : pages) {
+        if (stopped.load(std::memory_order_acquire)) {
+            break;
+        }
+        if (page.fname != fname) {
+            fname = page.fname;
+            file.reset();
+            auto fs = FileSystem::CreateSharedFromString(fname);
+            if (fs.ok()) {
+                auto res = (*fs)->new_random_access_file(fname);
+                if (res.ok()) {
+                    file = std::move(res).value();
+                }
+            }
+        }
+        if (file == nullptr || !read_page(file.get(), page, cache).ok()) {
+            stats.skipped_pages++;
+            continue;
+        }
+        stats.pages++;
+        stats.bytes += page.size;
+
+        if (bytes_per_second > 0) {
+            const auto expected_ns = static_cast<int64_t>(static_cast<double>(stats.bytes) / bytes_per_second * 1e9);
+            int64_t wait_ns;
+            while ((wait_ns = expected_ns - (MonotonicNanos() - start_ns)) > 0 &&
+                   !stopped.load(std::memory_order_acquire)) {
+                SleepForMs(std::min<int64_t>(wait_ns / 1000000 + 1, 100));
+            }
+        }
+    }
+    return stats;
+}
+
+size_t PageCacheWarmer::num_pages() const {
+    size_t num_pages = 0;
+    for (const auto& shard : _shards) {
+        std::lock_guard<std::mutex> l(shard.mutex);
+        num_pages += shard.pages.size();
+    }
+    return num_pages;
+}
+
+void PageCacheWarmer::clear() {
+    for (auto& shard : _shards) {
+        std::lock_guard<std::mutex> l(shard.mutex);
+        shard.pages.clear();
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,89 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/statusor.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+// PageCacheWarmer keeps a bounded list of the most accessed pages of the segment files, and warms up the caches of
+// a restarted BE from the list saved before.
+//
+// Warming up reads the pages from their files at bounded bandwidth, which fills the OS page cache for local files
+// and the block cache for remote files, and keeps the compressed pages in the compressed tier of StoragePageCache
+// if it's enabled. The decompressed tier is filled by the queries as usual, since decoding a page needs the meta of
+// its column.
+class PageCacheWarmer {
+public:
+    struct HotPage {
+        std::string fname;
+        int64_t offset = 0;
+        uint32_t size = 0;
+        uint32_t hits = 0;
+    };
+
+    struct WarmUpStats {
+        int64_t pages = 0;
+        int64_t bytes = 0;
+        // Pages skipped as their files are gone, e.g. compacted and deleted, or unreadable.
+        int64_t skipped_pages = 0;
+    };
+
+    static PageCacheWarmer* instance();
+
+    // Record an access to the page of |size| bytes on disk at |offset| of |fname|.
+    void record_access(const std::string& fname, int64_t offset, uint32_t size);
+
+    // The recorded pages in descending order of hits, at most |max_pages|.
+    std::vector<HotPage> hot_pages(size_t max_pages) const;
+
+    // Write the hot pages to |path|, at most |max_pages|.
+    Status save_hot_list(const std::string& path, size_t max_pages) const;
+    static StatusOr<std::vector<HotPage>> load_hot_list(const std::string& path);
+
+    // Read the pages of the hot list at |path| at most |bytes_per_second| (<= 0 means unlimited), it returns
+    // early once |stopped| is set.
+    static StatusOr<WarmUpStats> warm_up(const std::string& path, int64_t bytes_per_second,
+                                         const std::atomic<bool>& stopped);
+
+    size_t num_pages() const;
+
+    void clear();
+
+private:
+    static constexpr size_t kNumShards = 16;
+
+    struct Entry {
+        uint32_t size;
+        uint32_t hits;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        // Encoded StoragePageCache::CacheKey to entry.
+        phmap::flat_hash_map<std::string, Entry> pages;
+    };
+
+    Shard _shards[kNumShards];
+};
+
+} // namespace starrocks
@@ -16,12 +16,14 @@
 
 #include <cstring>
 #include <numeric>
+#include <set>
 #include <utility>
 
 #include "fs/fs.h"
 #include "gutil/strings/escaping.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
+#include "runtime/mem_pool.h"
 #include "storage/chunk_helper.h"
 #include "storage/chunk_iterator.h"
 #include "storage/persistent_index_tablet_loader.h"
@@ -771,6 +773,7 @@ template <size_t KeySize>
 class FixedMutableIndex : public MutableIndex {
 public:
     using KeyType = FixedKey<KeySize>;
+    static_assert(sizeof(std::pair<const KeyType, IndexValue>) == KeySize + sizeof(IndexValue));
     FixedMutableIndex() = default;
     ~FixedMutableIndex() override = default;
 
@@ -1006,7 +1009,8 @@ public:
 
     void clear() override { _map.clear(); }
 
-    size_t memory_usage() override { return _map.capacity() * (1 + (KeySize + 3) / 4 * 4 + kIndexValueSize); }
+    // one control byte and one slot per bucket, the slot keeps the key and the value inline without padding
+    size_t memory_usage() override { return _map.capacity() * (1 + sizeof(KeyType) + sizeof(IndexValue)); }
 
 private:
     phmap::flat_hash_map<KeyType, IndexValue, FixedKeyHash<KeySize>> _map;
@@ -1044,20 +1048,35 @@ size_t MutableIndex::estimate_nbucket(size_t key_size, size_t size, size_t nshar
     return kBucketPerPage;
 }
 
-struct StringHasher2 {
-    uint64_t operator()(const std::string& s) const { return key_index_hash(s.data(), s.length() - kIndexValueSize); }
+// A key-value pair of SliceMutableIndex: the key bytes followed by the 8-byte value, stored
+// contiguously in the arena of the index. A slot of the hash set only keeps the pointer and the
+// size, so a long key costs neither a std::string object nor a heap allocation of its own.
+struct SliceKV {
+    uint8_t* data;
+    uint32_t size;
+
+    Slice key() const { return {data, size - kIndexValueSize}; }
+    uint64_t value() const { return UNALIGNED_LOAD64(data + size - kIndexValueSize); }
+    // the value is not hashed or compared, so it can be updated in place
+    void set_value(uint64_t value) const { UNALIGNED_STORE64(data + size - kIndexValueSize, value); }
 };
 
-class EqualOnStringWithHash {
-public:
-    bool operator()(const std::string& lhs, const std::string& rhs) const {
-        return memequal_padded(lhs.data(), lhs.size() - kIndexValueSize, rhs.data(), rhs.size() - kIndexValueSize);
-    }
+struct SliceKVHash {
+    using is_transparent = void;
+    uint64_t operator()(const SliceKV& kv) const { return key_index_hash(kv.data, kv.size - kIndexValueSize); }
+    uint64_t operator()(const Slice& key) const { return key_index_hash(key.data, key.size); }
+};
+
+struct SliceKVEq {
+    using is_transparent = void;
+    bool operator()(const SliceKV& lhs, const SliceKV& rhs) const { return lhs.key() == rhs.key(); }
+    bool operator()(const SliceKV& lhs, const Slice& rhs) const { return lhs.key() == rhs; }
+    bool operator()(const Slice& lhs, const SliceKV& rhs) const { return lhs == rhs.key(); }
 };
 
 class SliceMutableIndex : public MutableIndex {
 public:
-    using KeyType = std::string;
+    using KeyType = SliceKV;
 
     using WALKVSizeType = uint32_t;
     static constexpr size_t kWALKVSize = 4;
@@ -1071,20 +1090,14 @@ public:
                const std::vector<size_t>& idxes) const override {
         size_t nfound = 0;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            auto iter = _set.find(composite_key, hash);
+            uint64_t hash = SliceKVHash()(skey);
+            auto iter = _set.find(skey, hash);
             if (iter == _set.end()) {
                 values[idx] = NullIndexValue;
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
             } else {
-                const auto& composite_key = *iter;
-                auto value = UNALIGNED_LOAD64(composite_key.data() + composite_key.size() - kIndexValueSize);
+                auto value = iter->value();
                 values[idx] = IndexValue(value);
                 nfound += value != NullIndexValue;
             }
@@ -1097,23 +1110,16 @@ public:
                   size_t* num_found, const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
+            const auto value = values[idx].get_value();
+            uint64_t hash = SliceKVHash()(skey);
+            if (auto [it, inserted] = _emplace(skey, hash, value); inserted) {
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
-                _total_kv_pairs_usage += composite_key.size();
             } else {
-                const auto& old_compose_key = *it;
-                auto old_value = UNALIGNED_LOAD64(old_compose_key.data() + old_compose_key.size() - kIndexValueSize);
+                auto old_value = it->value();
                 old_values[idx] = old_value;
                 nfound += old_value != NullIndexValue;
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
+                it->set_value(value);
             }
         }
         *num_found = nfound;
@@ -1124,24 +1130,14 @@ public:
                   const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
+            const auto value = values[idx].get_value();
+            uint64_t hash = SliceKVHash()(skey);
+            if (auto [it, inserted] = _emplace(skey, hash, value); inserted) {
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
-                _total_kv_pairs_usage += composite_key.size();
             } else {
-                const auto& old_compose_key = *it;
-                const auto old_value =
-                        UNALIGNED_LOAD64(old_compose_key.data() + old_compose_key.size() - kIndexValueSize);
-                nfound += old_value != NullIndexValue;
-                // TODO: find a way to modify iterator directly, currently just erase then re-insert
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
+                nfound += it->value() != NullIndexValue;
+                it->set_value(value);
             }
         }
         *num_found = nfound;
@@ -1150,26 +1146,18 @@ public:
 
     Status insert(const Slice* keys, const IndexValue* values, const std::vector<size_t>& idxes) override {
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
-                _total_kv_pairs_usage += composite_key.size();
-            } else {
-                auto& old_compose_key = *it;
-                auto old_value = UNALIGNED_LOAD64(old_compose_key.data() + old_compose_key.size() - kIndexValueSize);
+            const auto value = values[idx].get_value();
+            uint64_t hash = SliceKVHash()(skey);
+            if (auto [it, inserted] = _emplace(skey, hash, value); !inserted) {
+                auto old_value = it->value();
                 auto old_rssid = (uint32_t)(old_value >> 32);
                 auto old_rowid = (uint32_t)(old_value & ROWID_MASK);
-                auto new_value = reinterpret_cast<uint64_t*>(const_cast<IndexValue*>(&value));
                 std::string msg = strings::Substitute(
                         "SliceMutableIndex key_size=$0 insert found duplicate key $1, "
                         "new(rssid=$2 rowid=$3), old(rssid=$4 rowid=$5)",
-                        skey.size, hexdump((const char*)skey.data, skey.size), (uint32_t)((*new_value) >> 32),
-                        (uint32_t)((*new_value) & ROWID_MASK), old_rssid, old_rowid);
+                        skey.size, hexdump((const char*)skey.data, skey.size), (uint32_t)(value >> 32),
+                        (uint32_t)(value & ROWID_MASK), old_rssid, old_rowid);
                 LOG(WARNING) << msg;
                 return Status::AlreadyExist(msg);
             }
@@ -1181,25 +1169,16 @@ public:
                  const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
-            const auto value = NullIndexValue;
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value);
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
+            uint64_t hash = SliceKVHash()(skey);
+            if (auto [it, inserted] = _emplace(skey, hash, NullIndexValue); inserted) {
                 old_values[idx] = NullIndexValue;
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
-                _total_kv_pairs_usage += composite_key.size();
             } else {
-                auto& old_compose_key = *it;
-                auto old_value = UNALIGNED_LOAD64(old_compose_key.data() + old_compose_key.size() - kIndexValueSize);
+                auto old_value = it->value();
                 old_values[idx] = old_value;
                 nfound += old_value != NullIndexValue;
-                // TODO: find a way to modify iterator directly, currently just erase then re-insert
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
+                it->set_value(NullIndexValue);
             }
         }
         *num_found = nfound;
@@ -1208,19 +1187,11 @@ public:
 
     Status replace(const Slice* keys, const IndexValue* values, const std::vector<size_t>& idxes) override {
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
-                _total_kv_pairs_usage += composite_key.size();
-            } else {
-                // TODO: find a way to modify iterator directly, currently just erase then re-insert
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
+            const auto value = values[idx].get_value();
+            uint64_t hash = SliceKVHash()(skey);
+            if (auto [it, inserted] = _emplace(skey, hash, value); !inserted) {
+                it->set_value(value);
             }
         }
         return Status::OK();
@@ -1254,19 +1225,11 @@ public:
 
     Status load_wals(size_t n, const Slice* keys, const IndexValue* values) override {
         for (size_t i = 0; i < n; i++) {
-            std::string composite_key;
             const auto& skey = keys[i];
-            const auto value = values[i];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
-                _total_kv_pairs_usage += composite_key.size();
-            } else {
-                // TODO: find a way to modify iterator directly, currently just erase then re-insert
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
+            const auto value = values[i].get_value();
+            uint64_t hash = SliceKVHash()(skey);
+            if (auto [it, inserted] = _emplace(skey, hash, value); !inserted) {
+                it->set_value(value);
             }
         }
         return Status::OK();
@@ -1286,15 +1249,12 @@ public:
         if (size() == 0) {
             return true;
         }
-        for (const auto& composite_key : _set) {
-            if (!ar.dump(static_cast<size_t>(composite_key.size()))) {
+        for (const auto& kv : _set) {
+            if (!ar.dump(static_cast<size_t>(kv.size))) {
                 LOG(ERROR) << "Failed to dump compose_key_size";
                 return false;
             }
-            if (composite_key.size() == 0) {
-                continue;
-            }
-            if (!ar.dump(composite_key.data(), composite_key.size())) {
+            if (!ar.dump((const char*)kv.data, kv.size)) {
                 LOG(ERROR) << "Failed to dump composite_key";
                 return false;
             }
@@ -1302,15 +1262,12 @@ public:
         return true;
 
         // TODO: construct a large buffer and write instead of one by one.
-        // TODO: dive in phmap internal detail and implement dump of std::string type inside, use ctrl_&slot_ directly to improve performance
-        // return _set.dump(ar);
     }
 
     Status pk_dump(PrimaryKeyDump* dump, PrimaryIndexDumpPB* dump_pb) override {
-        for (const auto& composite_key : _set) {
-            auto value = UNALIGNED_LOAD64(composite_key.data() + composite_key.size() - kIndexValueSize);
+        for (const auto& kv : _set) {
             RETURN_IF_ERROR(dump->add_pindex_kvs(
-                    std::string_view(composite_key.data(), composite_key.size() - kIndexValueSize), value, dump_pb));
+                    std::string_view((const char*)kv.data, kv.size - kIndexValueSize), kv.value(), dump_pb));
         }
         return dump->finish_pindex_kvs(dump_pb);
     }
@@ -1325,6 +1282,7 @@ public:
             return true;
         }
         reserve(size);
+        std::string composite_key;
         for (auto i = 0; i < size; ++i) {
             size_t compose_key_size = 0;
             if (!ar.load(&compose_key_size)) {
@@ -1334,25 +1292,21 @@ public:
             if (compose_key_size == 0) {
                 continue;
             }
-            std::string composite_key;
             raw::stl_string_resize_uninitialized(&composite_key, compose_key_size);
             if (!ar.load(composite_key.data(), composite_key.size())) {
                 LOG(ERROR) << "Failed to load composite_key";
                 return false;
             }
-            auto [it, inserted] = _set.emplace(composite_key);
-            if (inserted) {
-                _total_kv_pairs_usage += composite_key.size();
-            } else {
-                _set.erase(it);
-                _set.emplace(composite_key);
+            Slice skey(composite_key.data(), compose_key_size - kIndexValueSize);
+            const auto value = UNALIGNED_LOAD64(composite_key.data() + skey.size);
+            uint64_t hash = SliceKVHash()(skey);
+            if (auto [it, inserted] = _emplace(skey, hash, value); !inserted) {
+                it->set_value(value);
             }
         }
         return true;
 
         // TODO: read a large buffer and parse instead of one by one.
-        // TODO: dive in phmap internal detail and implement load of std::string type inside, use ctrl_&slot_ directly to improve performance
-        // return _set.load(ar);
     }
 
     // TODO: read data in less batch, not one by one.
@@ -1396,13 +1350,12 @@ public:
         for (auto i = 0; i < nshard; ++i) {
             ret[i].reserve(num_entry / nshard * 100 / 85);
         }
-        for (const auto& composite_key : _set) {
-            const auto value = UNALIGNED_LOAD64(composite_key.data() + composite_key.size() - kIndexValueSize);
-            IndexHash h(StringHasher2()(composite_key));
-            if (!with_null && value == NullIndexValue) {
+        for (const auto& kv : _set) {
+            if (!with_null && kv.value() == NullIndexValue) {
                 continue;
             }
-            ret[h.shard(shard_bits)].emplace_back((uint8_t*)(composite_key.data()), h.hash, composite_key.size());
+            IndexHash h(SliceKVHash()(kv));
+            ret[h.shard(shard_bits)].emplace_back(kv.data, h.hash, kv.size);
         }
         return ret;
     }
@@ -1428,25 +1381,40 @@ public:
 
     void clear() override {
         _set.clear();
+        _arena.free_all();
         _total_kv_pairs_usage = 0;
     }
 
-    // TODO: more accurate estimation for phmap::flat_hash_set<std::string, ...
-    size_t memory_usage() override {
-        auto ret = capacity() * (1 + 32);
-        if (size() > 0 && _total_kv_pairs_usage / size() > 15) {
-            // std::string with size > 15 will alloc new memory for storage
-            ret += _total_kv_pairs_usage;
-            // an malloc extra cost estimation
-            ret += size() * 8;
-        }
-        return ret;
-    }
+    // one control byte and one slot per bucket, plus the arena holding the key-value pairs
+    size_t memory_usage() override { return capacity() * (1 + sizeof(SliceKV)) + _arena.total_reserved_bytes(); }
 
 private:
+    // Find |key| in the set, or insert it with |value| copied into the arena if absent.
+    std::pair<phmap::flat_hash_set<SliceKV, SliceKVHash, SliceKVEq>::iterator, bool> _emplace(const Slice& key,
+                                                                                               size_t hash,
+                                                                                               uint64_t value) {
+        bool inserted = false;
+        auto it = _set.lazy_emplace_with_hash(key, hash, [&](const auto& ctor) {
+            const uint32_t kv_size = key.size + kIndexValueSize;
+            uint8_t* data = _arena.allocate_aligned(kv_size, 1);
+            if (UNLIKELY(data == nullptr)) {
+                throw std::bad_alloc();
+            }
+            memcpy(data, key.data, key.size);
+            UNALIGNED_STORE64(data + key.size, value);
+            ctor(SliceKV{data, kv_size});
+            _total_kv_pairs_usage += kv_size;
+            inserted = true;
+        });
+        return {it, inserted};
+    }
+
     friend ShardByLengthMutableIndex;
     friend PersistentIndex;
-    phmap::flat_hash_set<KeyType, StringHasher2, EqualOnStringWithHash> _set;
+    phmap::flat_hash_set<SliceKV, SliceKVHash, SliceKVEq> _set;
+    // owns the key-value pairs referenced by |_set|, pairs are never freed one by one since an
+    // erased key is kept with a NullIndexValue
+    MemPool _arena;
     size_t _total_kv_pairs_usage = 0;
 };
 
@@ -2446,7 +2414,7 @@ Status ImmutableIndex::_get_in_fixlen_shard_by_page(size_t shard_idx, size_t n,
                                                     std::map<size_t, LargeIndexPage>& pages) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (auto [_, keys_info] : keys_info_by_page) {
+    for (const auto& [_, keys_info] : keys_info_by_page) {
         for (size_t i = 0; i < keys_info.size(); i++) {
             IndexHash h(keys_info[i].second);
             auto pageid = h.page() % shard_info.npage;
@@ -2495,7 +2463,7 @@ Status ImmutableIndex::_get_in_varlen_shard_by_page(size_t shard_idx, size_t n,
                                                     std::map<size_t, LargeIndexPage>& pages) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (auto [_, keys_info] : keys_info_by_page) {
+    for (const auto& [_, keys_info] : keys_info_by_page) {
         for (size_t i = 0; i < keys_info.size(); i++) {
             IndexHash h(keys_info[i].second);
             auto pageid = h.page() % shard_info.npage;
@@ -2545,22 +2513,72 @@ Status ImmutableIndex::_get_in_varlen_shard_by_page(size_t shard_idx, size_t n,
     return Status::OK();
 }
 
+Status ImmutableIndex::_read_pages(size_t shard_idx, const std::vector<size_t>& pageids,
+                                   std::map<size_t, LargeIndexPage>& pages, IOStat* stat) const {
+    const auto& shard_info = _shards[shard_idx];
+    const size_t page_size = shard_info.page_size;
+    const size_t max_merge_pages = std::max<size_t>(1, config::pindex_read_by_page_max_merge_bytes / page_size);
+    std::string buff;
+    size_t begin = 0;
+    while (begin < pageids.size()) {
+        size_t end = begin + 1;
+        while (end < pageids.size() && pageids[end] == pageids[end - 1] + 1 && end - begin < max_merge_pages) {
+            end++;
+        }
+        const size_t offset = shard_info.offset + page_size * pageids[begin];
+        const size_t num_pages = end - begin;
+        if (num_pages == 1) {
+            LargeIndexPage page(page_size / kPageSize);
+            RETURN_IF_ERROR(_file->read_at_fully(offset, page.data(), page_size));
+            pages.emplace(pageids[begin], std::move(page));
+        } else {
+            raw::stl_string_resize_uninitialized(&buff, num_pages * page_size);
+            RETURN_IF_ERROR(_file->read_at_fully(offset, buff.data(), buff.size()));
+            for (size_t i = 0; i < num_pages; i++) {
+                LargeIndexPage page(page_size / kPageSize);
+                memcpy(page.data(), buff.data() + i * page_size, page_size);
+                pages.emplace(pageids[begin + i], std::move(page));
+            }
+        }
+        if (stat != nullptr) {
+            stat->read_iops++;
+            stat->read_io_bytes += num_pages * page_size;
+        }
+        begin = end;
+    }
+    return Status::OK();
+}
+
 Status ImmutableIndex::_get_in_shard_by_page(size_t shard_idx, size_t n, const Slice* keys, IndexValue* values,
                                              KeysInfo* found_keys_info,
                                              std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                              IOStat* stat) const {
     const auto& shard_info = _shards[shard_idx];
     std::map<size_t, LargeIndexPage> pages;
-    for (auto [pageid, keys_info] : keys_info_by_page) {
-        LargeIndexPage page(shard_info.page_size / kPageSize);
-        RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset + shard_info.page_size * pageid, page.data(),
-                                             shard_info.page_size));
-        if (stat != nullptr) {
-            stat->read_iops++;
-            stat->read_io_bytes += shard_info.page_size;
+    std::vector<size_t> pageids;
+    pageids.reserve(keys_info_by_page.size());
+    for (const auto& [pageid, _] : keys_info_by_page) {
+        pageids.emplace_back(pageid);
+    }
+    RETURN_IF_ERROR(_read_pages(shard_idx, pageids, pages, stat));
+
+    // the bucket of a key may be moved to another page, read all of these pages once before probing
+    std::set<size_t> moved_pageids;
+    for (const auto& [pageid, keys_info] : keys_info_by_page) {
+        auto& header = pages[pageid].header();
+        for (const auto& key_info : keys_info) {
+            auto bucketid = IndexHash(key_info.second).bucket() % shard_info.nbucket;
+            auto bucket_pageid = header.buckets[bucketid].pageid;
+            if (pages.find(bucket_pageid) == pages.end()) {
+                moved_pageids.insert(bucket_pageid);
+            }
         }
-        pages.emplace(pageid, std::move(page));
     }
+    if (!moved_pageids.empty()) {
+        pageids.assign(moved_pageids.begin(), moved_pageids.end());
+        RETURN_IF_ERROR(_read_pages(shard_idx, pageids, pages, stat));
+    }
+
     if (shard_info.key_size != 0) {
         return _get_in_fixlen_shard_by_page(shard_idx, n, keys, values, found_keys_info, keys_info_by_page, pages);
     } else {
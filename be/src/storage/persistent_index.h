@@ -549,6 +549,11 @@ private:
                                  KeysInfo* found_keys_info, std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                  IOStat* stat) const;
 
+    // Read the pages |pageids| of shard |shard_idx| into |pages|, |pageids| must be ascending and unique.
+    // Consecutive pages are read together.
+    Status _read_pages(size_t shard_idx, const std::vector<size_t>& pageids, std::map<size_t, LargeIndexPage>& pages,
+                       IOStat* stat) const;
+
     Status _get_in_shard(size_t shard_idx, size_t n, const Slice* keys, std::vector<KeyInfo>& keys_info,
                          IndexValue* values, KeysInfo* found_keys_info, IOStat* stat) const;
 
@@ -14,6 +14,9 @@
 
 #include "storage/primary_key_compaction_conflict_resolver.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "storage/chunk_helper.h"
 #include "storage/del_vector.h"
 #include "storage/primary_index.h"
@@ -40,11 +43,32 @@ Status PrimaryKeyCompactionConflictResolver::execute() {
             [&](const CompactConflictResolveParams& params, const std::vector<ChunkIteratorPtr>& segment_iters,
                 const std::function<void(uint32_t, const DelVectorPtr&, uint32_t)>& handle_delvec_result_func) {
                 std::map<uint32_t, DelVectorPtr> rssid_to_delvec;
+                // The rows of an input rowset segment are mostly contiguous in the output, so remember the last one.
+                uint32_t last_rssid = UINT32_MAX;
+                DelVector* last_delvec = nullptr;
+                const size_t batch_rows = std::max<int32_t>(config::pk_compaction_index_replace_batch_rows, 1);
                 for (size_t segment_id = 0; segment_id < segment_iters.size(); segment_id++) {
                     // only hold pkey, so can use larger chunk size
                     auto chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, config::vector_chunk_size);
                     auto chunk = chunk_shared_ptr.get();
+                    // The primary keys of a batch of chunks, they are replaced in the index at once, so that the
+                    // index pays its per-call cost, e.g. the WAL append of the persistent index, once per batch.
                     auto col = pk_column->clone();
+                    std::vector<uint32_t> replace_indexes;
+                    uint32_t batch_rowid_start = 0;
+                    auto flush_batch = [&]() -> Status {
+                        if (col->empty()) {
+                            return Status::OK();
+                        }
+                        // 6. replace pk index
+                        TRACE_COUNTER_SCOPE_LATENCY_US("compaction_replace_index_latency_us");
+                        RETURN_IF_ERROR(params.index->replace(params.rowset_id + segment_id, batch_rowid_start,
+                                                              replace_indexes, *col));
+                        batch_rowid_start += col->size();
+                        col->reset_column();
+                        replace_indexes.clear();
+                        return Status::OK();
+                    };
                     vector<uint32_t> tmp_deletes;
                     uint32_t current_rowid = 0;
 
@@ -52,7 +76,6 @@ Status PrimaryKeyCompactionConflictResolver::execute() {
                     if (itr != nullptr) {
                         while (true) {
                             chunk->reset();
-                            col->reset_column();
                             auto st = Status::OK();
                             // 4. get chunk
                             {
@@ -67,39 +90,43 @@ Status PrimaryKeyCompactionConflictResolver::execute() {
                             } else {
                                 // 5. get input rssid & rowids, so we can generate delvec
                                 std::vector<uint64_t> rssid_rowids;
-                                std::vector<uint32_t> replace_indexes;
                                 RETURN_IF_ERROR(mapper_iter.next_values(chunk->num_rows(), &rssid_rowids));
                                 DCHECK(chunk->num_rows() == rssid_rowids.size());
+                                const uint32_t batch_offset = current_rowid - batch_rowid_start;
                                 for (int i = 0; i < rssid_rowids.size(); i++) {
                                     const uint32_t rssid = rssid_rowids[i] >> 32;
                                     const uint32_t rowid = rssid_rowids[i] & 0xffffffff;
-                                    if (rssid_to_delvec.count(rssid) == 0) {
-                                        // get delvec by loader
-                                        DelVectorPtr delvec_ptr;
-                                        {
-                                            TRACE_COUNTER_SCOPE_LATENCY_US("compaction_delvec_loader_latency_us");
-                                            RETURN_IF_ERROR(params.delvec_loader->load(
-                                                    {params.tablet_id, rssid}, params.base_version, &delvec_ptr));
+                                    if (rssid != last_rssid) {
+                                        auto iter = rssid_to_delvec.find(rssid);
+                                        if (iter == rssid_to_delvec.end()) {
+                                            // get delvec by loader
+                                            DelVectorPtr delvec_ptr;
+                                            {
+                                                TRACE_COUNTER_SCOPE_LATENCY_US("compaction_delvec_loader_latency_us");
+                                                RETURN_IF_ERROR(params.delvec_loader->load(
+                                                        {params.tablet_id, rssid}, params.base_version, &delvec_ptr));
+                                            }
+                                            iter = rssid_to_delvec.emplace(rssid, std::move(delvec_ptr)).first;
                                         }
-                                        rssid_to_delvec[rssid] = delvec_ptr;
+                                        last_rssid = rssid;
+                                        last_delvec = iter->second.get();
                                     }
-                                    if (!rssid_to_delvec[rssid]->empty() &&
-                                        rssid_to_delvec[rssid]->roaring()->contains(rowid)) {
+                                    if (!last_delvec->empty() && last_delvec->roaring()->contains(rowid)) {
                                         // Input row had been deleted, so we need to delete it from output rowset
                                         tmp_deletes.push_back(current_rowid + i);
                                     } else {
                                         // replace pk index
-                                        replace_indexes.push_back(i);
+                                        replace_indexes.push_back(batch_offset + i);
                                     }
                                 }
-                                // 6. replace pk index
-                                TRACE_COUNTER_SCOPE_LATENCY_US("compaction_replace_index_latency_us");
                                 PrimaryKeyEncoder::encode(pkey_schema, *chunk, 0, chunk->num_rows(), col.get());
-                                RETURN_IF_ERROR(params.index->replace(params.rowset_id + segment_id, current_rowid,
-                                                                      replace_indexes, *col));
                                 current_rowid += chunk->num_rows();
+                                if (col->size() >= batch_rows) {
+                                    RETURN_IF_ERROR(flush_batch());
+                                }
                             }
                         }
+                        RETURN_IF_ERROR(flush_batch());
                         itr->close();
                         // 7. generate final delvec
                         DelVectorPtr dv = std::make_shared<DelVector>();
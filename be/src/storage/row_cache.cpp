@@ -0,0 +1,116 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "storage/row_cache.h"
+
+#include "column/binary_column.h"
+#include "gutil/casts.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+#include "util/coding.h"
+
+namespace starrocks {
+
+RowCache* RowCache::_s_instance = nullptr;
+std::atomic<int64_t> RowCache::_s_next_generation{0};
+
+struct RowCacheValue {
+    int64_t version;
+    std::vector<uint32_t> column_ids;
+    std::string row;
+};
+
+void RowCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+    if (_s_instance == nullptr && capacity > 0) {
+        _s_instance = new RowCache(mem_tracker, capacity);
+    }
+}
+
+void RowCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+RowCache::RowCache(MemTracker* mem_tracker, size_t capacity)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE)) {}
+
+RowCache::~RowCache() = default;
+
+std::string RowCache::key_prefix(int64_t tablet_id, int64_t generation) {
+    std::string prefix;
+    put_fixed64_le(&prefix, tablet_id);
+    put_fixed64_le(&prefix, generation);
+    return prefix;
+}
+
+std::string RowCache::key(const std::string& prefix, const Column& pks, size_t idx) {
+    std::string key(prefix);
+    if (pks.is_binary()) {
+        Slice pk = down_cast<const BinaryColumn&>(pks).get_slice(idx);
+        key.append(pk.data, pk.size);
+    } else {
+        key.append(reinterpret_cast<const char*>(pks.raw_data()) + idx * pks.type_size(), pks.type_size());
+    }
+    return key;
+}
+
+bool RowCache::lookup(const std::string& key, int64_t version, const std::vector<uint32_t>& column_ids,
+                      std::vector<Column*>& columns) {
+    auto* handle = _cache->lookup(key);
+    if (handle == nullptr) {
+        return false;
+    }
+    auto* value = reinterpret_cast<RowCacheValue*>(_cache->value(handle));
+    bool hit = value->version <= version && value->column_ids == column_ids;
+    if (hit) {
+        const auto* pos = reinterpret_cast<const uint8_t*>(value->row.data());
+        for (auto* column : columns) {
+            pos = column->deserialize_and_append(pos);
+        }
+    }
+    _cache->release(handle);
+    return hit;
+}
+
+void RowCache::insert(const std::string& key, int64_t version, const std::vector<uint32_t>& column_ids,
+                      const std::vector<std::unique_ptr<Column>>& columns, size_t row) {
+#ifndef BE_TEST
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+    size_t row_size = 0;
+    for (const auto& column : columns) {
+        row_size += column->serialize_size(row);
+    }
+    auto* value = new RowCacheValue{version, column_ids, std::string(row_size, '\0')};
+    auto* pos = reinterpret_cast<uint8_t*>(value->row.data());
+    for (const auto& column : columns) {
+        pos += column->serialize(row, pos);
+    }
+    auto deleter = [](const CacheKey& key, void* value) { delete reinterpret_cast<RowCacheValue*>(value); };
+    size_t charge = sizeof(RowCacheValue) + key.size() + row_size + column_ids.size() * sizeof(uint32_t);
+    auto* handle = _cache->insert(key, value, charge, deleter);
+    _cache->release(handle);
+}
+
+void RowCache::erase(const std::string& key) {
+#ifndef BE_TEST
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+    _cache->erase(key);
+}
+
+} // namespace starrocks
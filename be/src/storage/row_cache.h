@@ -0,0 +1,80 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/column.h"
+#include "util/lru_cache.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+// A cache of the rows of primary key tablets for point lookups, keyed by |tablet id|generation|encoded primary key|.
+// A cached row is the value columns of the key read at some version, encoded by Column::serialize.
+//
+// TabletUpdates keeps the cache consistent with the tablet:
+//  - the apply of a rowset commit erases the upserted and deleted keys, and bumps the tablet's row cache sequence
+//    before and after the apply, so that a reader can tell whether an apply ran while it read the rows;
+//  - other changes of the tablet data, e.g. column mode partial updates or clones, switch the tablet to a new
+//    generation, so that all the rows cached before are unreachable.
+class RowCache {
+public:
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+    static void release_global_cache();
+    // nullptr if the row cache is disabled
+    static RowCache* instance() { return _s_instance; }
+
+    // Generations are unique in the process, so a tablet recreated with the same id never sees the rows of the
+    // dropped one.
+    static int64_t next_generation() { return _s_next_generation.fetch_add(1) + 1; }
+
+    RowCache(MemTracker* mem_tracker, size_t capacity);
+    ~RowCache();
+
+    static std::string key_prefix(int64_t tablet_id, int64_t generation);
+    // |pks| is the primary key column encoded by PrimaryKeyEncoder.
+    static std::string key(const std::string& prefix, const Column& pks, size_t idx);
+
+    // Lookup the row of |key| cached for |column_ids|, and append it to |columns| on hit.
+    // A row cached at a version newer than |version| is a miss.
+    bool lookup(const std::string& key, int64_t version, const std::vector<uint32_t>& column_ids,
+                std::vector<Column*>& columns);
+
+    void insert(const std::string& key, int64_t version, const std::vector<uint32_t>& column_ids,
+                const std::vector<std::unique_ptr<Column>>& columns, size_t row);
+
+    void erase(const std::string& key);
+
+    size_t memory_usage() const { return _cache->get_memory_usage(); }
+    size_t get_capacity() const { return _cache->get_capacity(); }
+    uint64_t get_lookup_count() const { return _cache->get_lookup_count(); }
+    uint64_t get_hit_count() const { return _cache->get_hit_count(); }
+
+private:
+    static RowCache* _s_instance;
+    static std::atomic<int64_t> _s_next_generation;
+
+    MemTracker* _mem_tracker = nullptr;
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace starrocks
@@ -0,0 +1,393 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "column/column.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "storage/type_traits.h"
+#include "util/coding.h"
+#include "util/frame_of_reference_coding.h"
+
+namespace starrocks {
+
+// ALP (Adaptive Lossless floating-Point) style encoding for FLOAT/DOUBLE pages.
+// Floating-point metrics usually come from decimals with a few fractional digits, so every value `v` of a page
+// is encoded as an integer `d = round(v * 10^e)` with an exponent `e` chosen per page, as long as `d / 10^e`
+// gives back exactly the same bits as `v`. The integers are stored with frame-of-reference coding, and the
+// values which could not be encoded (NaN, infinity, -0.0, too many digits) are stored as exceptions.
+//
+// The page format is as follows:
+//
+//      32 bit ValuesNum
+//       8 bit Exponent
+//      32 bit ExceptionsNum
+//      32 bit DigitsSize
+//      ForEncoder<int64_t> encoded digits (DigitsSize bytes)
+//      32 bit ExceptionPosition * ExceptionsNum
+//      CppType ExceptionValue * ExceptionsNum
+//
+// If Exponent is ALP_RAW_EXPONENT, the page is not compressible, and the body is the plain values instead.
+namespace alp {
+
+static constexpr size_t ALP_PAGE_HEADER_SIZE = 13;
+static constexpr uint8_t ALP_RAW_EXPONENT = 0xFF;
+// The number of values sampled from a page to choose the exponent.
+static constexpr size_t ALP_SAMPLE_SIZE = 256;
+
+template <typename T>
+struct AlpTraits {};
+
+template <>
+struct AlpTraits<float> {
+    using Bits = uint32_t;
+    static constexpr int kMaxExponent = 10;
+};
+
+template <>
+struct AlpTraits<double> {
+    using Bits = uint64_t;
+    static constexpr int kMaxExponent = 18;
+};
+
+inline double power_of_ten(int exponent) {
+    static constexpr double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
+                                        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+    return kPow10[exponent];
+}
+
+// The encoder checks each value with this very function, so the decoded values are always bit-identical.
+template <typename T>
+inline T decode_digit(int64_t digit, double divisor) {
+    return static_cast<T>(static_cast<double>(digit) / divisor);
+}
+
+template <typename T>
+inline bool encode_digit(T value, int exponent, int64_t* digit) {
+    // Keep the digits far away from the limit of int64_t, so that the frame-of-reference coding never overflows.
+    static constexpr double kMaxDigit = 4611686018427387904.0; // 2^62
+    const double scaled = static_cast<double>(value) * power_of_ten(exponent);
+    if (!(std::abs(scaled) < kMaxDigit)) {
+        return false;
+    }
+    *digit = std::llround(scaled);
+    const T decoded = decode_digit<T>(*digit, power_of_ten(exponent));
+    typename AlpTraits<T>::Bits lhs, rhs;
+    memcpy(&lhs, &decoded, sizeof(T));
+    memcpy(&rhs, &value, sizeof(T));
+    return lhs == rhs;
+}
+
+} // namespace alp
+
+template <LogicalType Type>
+class AlpPageBuilder final : public PageBuilder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    static_assert(std::is_same_v<CppType, float> || std::is_same_v<CppType, double>, "unexpected field type");
+
+public:
+    explicit AlpPageBuilder(const PageBuilderOptions& options)
+            : _max_count(std::max<uint32_t>(1, options.data_page_size / sizeof(CppType))) {
+        _values.reserve(_max_count);
+    }
+
+    ~AlpPageBuilder() override = default;
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override {
+        DCHECK(!_finished);
+        uint32_t to_add = std::min<uint32_t>(_max_count - _values.size(), count);
+        size_t old_sz = _values.size();
+        _values.resize(old_sz + to_add);
+        memcpy(_values.data() + old_sz, vals, to_add * sizeof(CppType));
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        _buf.clear();
+        const uint32_t count = _values.size();
+        if (count == 0) {
+            _put_header(0, alp::ALP_RAW_EXPONENT, 0, 0);
+            return &_buf;
+        }
+        _first_value = _values.front();
+        _last_value = _values.back();
+
+        int exponent = _choose_exponent();
+        if (exponent != alp::ALP_RAW_EXPONENT) {
+            _encode(exponent);
+        }
+        // Fall back to the plain values if the encoding does not pay off.
+        if (exponent == alp::ALP_RAW_EXPONENT || _buf.size() >= alp::ALP_PAGE_HEADER_SIZE + count * sizeof(CppType)) {
+            _buf.clear();
+            _put_header(count, alp::ALP_RAW_EXPONENT, 0, 0);
+            _buf.append(_values.data(), count * sizeof(CppType));
+        }
+        return &_buf;
+    }
+
+    void reset() override {
+        _values.clear();
+        _buf.clear();
+        _finished = false;
+    }
+
+    uint32_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _values.size() * sizeof(CppType); }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_first_value, sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_last_value, sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    // Choose the smallest exponent with the fewest exceptions on a sample of the page.
+    int _choose_exponent() const {
+        const size_t step = std::max<size_t>(1, _values.size() / alp::ALP_SAMPLE_SIZE);
+        size_t sample_size = 0;
+        size_t best_exceptions = SIZE_MAX;
+        int best_exponent = alp::ALP_RAW_EXPONENT;
+        for (int exponent = 0; exponent <= alp::AlpTraits<CppType>::kMaxExponent; exponent++) {
+            size_t exceptions = 0;
+            sample_size = 0;
+            int64_t digit;
+            for (size_t i = 0; i < _values.size(); i += step, sample_size++) {
+                exceptions += !alp::encode_digit(_values[i], exponent, &digit);
+            }
+            if (exceptions < best_exceptions) {
+                best_exceptions = exceptions;
+                best_exponent = exponent;
+                if (exceptions == 0) {
+                    break;
+                }
+            }
+        }
+        // Most values are not decimals, e.g. the results of some computation.
+        if (best_exceptions * 2 > sample_size) {
+            return alp::ALP_RAW_EXPONENT;
+        }
+        return best_exponent;
+    }
+
+    void _encode(int exponent) {
+        const uint32_t count = _values.size();
+        std::vector<int64_t> digits(count);
+        std::vector<uint32_t> exception_positions;
+        std::vector<CppType> exception_values;
+        // Exceptions take the digit of the previous value, which keeps the frame of reference tight.
+        int64_t last_digit = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            int64_t digit;
+            if (alp::encode_digit(_values[i], exponent, &digit)) {
+                last_digit = digit;
+            } else {
+                exception_positions.push_back(i);
+                exception_values.push_back(_values[i]);
+            }
+            digits[i] = last_digit;
+        }
+
+        faststring digits_buf;
+        ForEncoder<int64_t> encoder(&digits_buf);
+        encoder.put_batch(digits.data(), count);
+        encoder.flush();
+
+        _put_header(count, exponent, exception_positions.size(), digits_buf.size());
+        _buf.append(digits_buf.data(), digits_buf.size());
+        for (uint32_t position : exception_positions) {
+            put_fixed32_le(&_buf, position);
+        }
+        _buf.append(exception_values.data(), exception_values.size() * sizeof(CppType));
+    }
+
+    void _put_header(uint32_t count, uint8_t exponent, uint32_t exceptions, uint32_t digits_size) {
+        put_fixed32_le(&_buf, count);
+        _buf.push_back(exponent);
+        put_fixed32_le(&_buf, exceptions);
+        put_fixed32_le(&_buf, digits_size);
+    }
+
+    const uint32_t _max_count;
+    bool _finished = false;
+    std::vector<CppType> _values;
+    faststring _buf;
+    CppType _first_value{};
+    CppType _last_value{};
+};
+
+template <LogicalType Type>
+class AlpPageDecoder final : public PageDecoder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    static_assert(std::is_same_v<CppType, float> || std::is_same_v<CppType, double>, "unexpected field type");
+
+public:
+    explicit AlpPageDecoder(Slice data) : _data(data) {}
+
+    ~AlpPageDecoder() override = default;
+
+    [[nodiscard]] Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < alp::ALP_PAGE_HEADER_SIZE) {
+            return Status::Corruption("The alp page header maybe broken");
+        }
+        const auto* header = reinterpret_cast<const uint8_t*>(_data.data);
+        _num_elements = decode_fixed32_le(header);
+        _exponent = header[4];
+        const uint32_t num_exceptions = decode_fixed32_le(header + 5);
+        const uint32_t digits_size = decode_fixed32_le(header + 9);
+        const uint8_t* body = header + alp::ALP_PAGE_HEADER_SIZE;
+        const size_t body_size = _data.size - alp::ALP_PAGE_HEADER_SIZE;
+
+        if (_exponent == alp::ALP_RAW_EXPONENT) {
+            if (body_size < static_cast<size_t>(_num_elements) * sizeof(CppType)) {
+                return Status::Corruption("The alp page data maybe broken");
+            }
+            _raw_values = body;
+            _parsed = true;
+            return Status::OK();
+        }
+
+        const size_t exceptions_size = static_cast<size_t>(num_exceptions) * (sizeof(uint32_t) + sizeof(CppType));
+        if (_exponent > alp::AlpTraits<CppType>::kMaxExponent || body_size < digits_size + exceptions_size) {
+            return Status::Corruption("The alp page data maybe broken");
+        }
+        _divisor = alp::power_of_ten(_exponent);
+        _decoder = std::make_unique<ForDecoder<int64_t>>(body, digits_size);
+        if (!_decoder->init() || _decoder->count() != _num_elements) {
+            return Status::Corruption("The alp page digits maybe broken");
+        }
+        _exception_positions.resize(num_exceptions);
+        _exception_values.resize(num_exceptions);
+        const uint8_t* exceptions = body + digits_size;
+        for (uint32_t i = 0; i < num_exceptions; i++) {
+            _exception_positions[i] = decode_fixed32_le(exceptions + i * sizeof(uint32_t));
+        }
+        memcpy(_exception_values.data(), exceptions + num_exceptions * sizeof(uint32_t),
+               num_exceptions * sizeof(CppType));
+        _parsed = true;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _num_elements) << "Tried to seek to " << pos << " which is > number of elements ("
+                                      << _num_elements << ") in the block!";
+        // If the block is empty (e.g. the column is filled with nulls), there is no data to seek.
+        if (PREDICT_FALSE(_num_elements == 0)) {
+            return Status::OK();
+        }
+        if (_decoder != nullptr && pos != _cur_index) {
+            _decoder->skip(static_cast<int32_t>(pos) - static_cast<int32_t>(_cur_index));
+        }
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(size_t* n, Column* dst) override {
+        SparseRange<> read_range;
+        uint32_t begin = current_index();
+        read_range.add(Range<>(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(range.span_size() == 0 || _cur_index >= _num_elements)) {
+            return Status::OK();
+        }
+
+        size_t to_read =
+                std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elements - _cur_index));
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (to_read > 0 && _cur_index < _num_elements) {
+            RETURN_IF_ERROR(seek_to_position_in_page(iter.begin()));
+            Range<> r = iter.next(to_read);
+            const size_t ori_size = dst->size();
+            dst->resize(ori_size + r.span_size());
+            auto* p = reinterpret_cast<CppType*>(dst->mutable_raw_data()) + ori_size;
+            _decode(p, r.span_size());
+            _cur_index += r.span_size();
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    uint32_t count() const override { return _num_elements; }
+
+    uint32_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return ALP_ENCODING; }
+
+private:
+    void _decode(CppType* output, size_t n) {
+        if (_raw_values != nullptr) {
+            memcpy(output, _raw_values + _cur_index * sizeof(CppType), n * sizeof(CppType));
+            return;
+        }
+        _digits.resize(n);
+        bool res = _decoder->get_batch(_digits.data(), n);
+        DCHECK(res);
+        // A simple loop without branches, so that the compiler could vectorize it.
+        const int64_t* digits = _digits.data();
+        const double divisor = _divisor;
+        for (size_t i = 0; i < n; i++) {
+            output[i] = alp::decode_digit<CppType>(digits[i], divisor);
+        }
+        auto it = std::lower_bound(_exception_positions.begin(), _exception_positions.end(), _cur_index);
+        for (; it != _exception_positions.end() && *it < _cur_index + n; ++it) {
+            output[*it - _cur_index] = _exception_values[it - _exception_positions.begin()];
+        }
+    }
+
+    Slice _data;
+    bool _parsed = false;
+    uint32_t _num_elements = 0;
+    uint32_t _cur_index = 0;
+    uint8_t _exponent = 0;
+    double _divisor = 1;
+    const uint8_t* _raw_values = nullptr;
+    std::unique_ptr<ForDecoder<int64_t>> _decoder;
+    std::vector<uint32_t> _exception_positions;
+    std::vector<CppType> _exception_values;
+    std::vector<int64_t> _digits;
+};
+
+} // namespace starrocks
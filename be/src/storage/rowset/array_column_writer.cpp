@@ -17,6 +17,7 @@
 #include "common/status.h"
 #include "gutil/casts.h"
 #include "storage/rowset/column_writer.h"
+#include "storage/rowset/vector_index_writer.h"
 
 namespace starrocks {
 
@@ -25,7 +26,8 @@ public:
     explicit ArrayColumnWriter(const ColumnWriterOptions& opts, TypeInfoPtr type_info,
                                std::unique_ptr<ScalarColumnWriter> null_writer,
                                std::unique_ptr<ScalarColumnWriter> offset_writer,
-                               std::unique_ptr<ColumnWriter> element_writer);
+                               std::unique_ptr<ColumnWriter> element_writer,
+                               std::unique_ptr<VectorIndexWriter> vector_index_writer, WritableFile* wfile);
     ~ArrayColumnWriter() override = default;
 
     Status init() override;
@@ -46,6 +48,8 @@ public:
 
     Status write_bloom_filter_index() override { return Status::OK(); }
 
+    Status write_vector_index() override;
+
     ordinal_t get_next_rowid() const override { return _array_size_writer->get_next_rowid(); }
 
     uint64_t total_mem_footprint() const override;
@@ -56,6 +60,8 @@ private:
     std::unique_ptr<ScalarColumnWriter> _null_writer;
     std::unique_ptr<ScalarColumnWriter> _array_size_writer;
     std::unique_ptr<ColumnWriter> _element_writer;
+    std::unique_ptr<VectorIndexWriter> _vector_index_writer;
+    WritableFile* _wfile;
 };
 
 StatusOr<std::unique_ptr<ColumnWriter>> create_array_column_writer(const ColumnWriterOptions& opts,
@@ -79,6 +85,14 @@ StatusOr<std::unique_ptr<ColumnWriter>> create_array_column_writer(const ColumnW
 
     ASSIGN_OR_RETURN(auto element_writer, ColumnWriter::create(element_options, &element_column, wfile));
 
+    std::unique_ptr<VectorIndexWriter> vector_index_writer;
+    if (opts.need_vector_index) {
+        if (element_column.type() != LogicalType::TYPE_FLOAT) {
+            return Status::NotSupported("Vector index only supports array<float> type");
+        }
+        ASSIGN_OR_RETURN(vector_index_writer, VectorIndexWriter::create(opts.tablet_index.at(VECTOR)));
+    }
+
     std::unique_ptr<ScalarColumnWriter> null_writer = nullptr;
     if (opts.meta->is_nullable()) {
         ColumnWriterOptions null_options;
@@ -111,18 +125,22 @@ StatusOr<std::unique_ptr<ColumnWriter>> create_array_column_writer(const ColumnW
     std::unique_ptr<ScalarColumnWriter> offset_writer =
             std::make_unique<ScalarColumnWriter>(array_size_options, std::move(int_type_info), wfile);
     return std::make_unique<ArrayColumnWriter>(opts, std::move(type_info), std::move(null_writer),
-                                               std::move(offset_writer), std::move(element_writer));
+                                               std::move(offset_writer), std::move(element_writer),
+                                               std::move(vector_index_writer), wfile);
 }
 
 ArrayColumnWriter::ArrayColumnWriter(const ColumnWriterOptions& opts, TypeInfoPtr type_info,
                                      std::unique_ptr<ScalarColumnWriter> null_writer,
                                      std::unique_ptr<ScalarColumnWriter> offset_writer,
-                                     std::unique_ptr<ColumnWriter> element_writer)
+                                     std::unique_ptr<ColumnWriter> element_writer,
+                                     std::unique_ptr<VectorIndexWriter> vector_index_writer, WritableFile* wfile)
         : ColumnWriter(std::move(type_info), opts.meta->length(), opts.meta->is_nullable()),
           _opts(opts),
           _null_writer(std::move(null_writer)),
           _array_size_writer(std::move(offset_writer)),
-          _element_writer(std::move(element_writer)) {}
+          _element_writer(std::move(element_writer)),
+          _vector_index_writer(std::move(vector_index_writer)),
+          _wfile(wfile) {}
 
 Status ArrayColumnWriter::init() {
     if (is_nullable()) {
@@ -145,6 +163,10 @@ Status ArrayColumnWriter::append(const Column& column) {
         array_column = down_cast<const ArrayColumn*>(&column);
     }
 
+    if (_vector_index_writer != nullptr) {
+        RETURN_IF_ERROR(_vector_index_writer->append(column, get_next_rowid()));
+    }
+
     // 1. Write null column when necessary
     if (is_nullable()) {
         RETURN_IF_ERROR(_null_writer->append(*null_column));
@@ -207,6 +229,15 @@ Status ArrayColumnWriter::write_ordinal_index() {
     return Status::OK();
 }
 
+Status ArrayColumnWriter::write_vector_index() {
+    if (_vector_index_writer == nullptr) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_vector_index_writer->finish(_wfile, _opts.meta->add_indexes()));
+    _vector_index_writer.reset();
+    return Status::OK();
+}
+
 Status ArrayColumnWriter::finish_current_page() {
     if (is_nullable()) {
         RETURN_IF_ERROR(_null_writer->finish_current_page());
@@ -175,6 +175,19 @@ bool BinaryDictPageBuilder::is_valid_global_dict(const GlobalDictMap* global_dic
     return true;
 }
 
+bool BinaryDictPageBuilder::get_global_dict_codes(const GlobalDictMap* global_dict,
+                                                  std::vector<int32_t>* codes) const {
+    codes->resize(_dictionary.size());
+    for (const auto& it : _dictionary) {
+        auto iter = global_dict->find(it.first);
+        if (iter == global_dict->end()) {
+            return false;
+        }
+        (*codes)[it.second] = iter->second;
+    }
+    return true;
+}
+
 template <LogicalType Type>
 BinaryDictPageDecoder<Type>::BinaryDictPageDecoder(Slice data)
         : _data(data), _data_page_decoder(nullptr), _parsed(false), _encoding_type(UNKNOWN_ENCODING) {}
@@ -85,6 +85,8 @@ public:
 
     bool is_valid_global_dict(const GlobalDictMap* global_dict) const override;
 
+    bool get_global_dict_codes(const GlobalDictMap* global_dict, std::vector<int32_t>* codes) const override;
+
     // Return true iff all pages so far are encoded by dictionary encoding.
     // this method normally should be called after all data pages finish
     // write, i.e, after `finish` has been called.
@@ -34,6 +34,10 @@
 
 #include "storage/rowset/block_split_bloom_filter.h"
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #include "util/debug_util.h"
 
 namespace starrocks {
@@ -59,21 +63,43 @@ void BlockSplitBloomFilter::add_hash(uint64_t hash) {
 }
 
 bool BlockSplitBloomFilter::test_hash(uint64_t hash) const {
-    // most significant 32 bit mod block size as block index(BTW:block size is
-    // power of 2)
-    uint32_t block_size = _num_bytes / BYTES_PER_BLOCK;
-    uint32_t block_index = (uint32_t)(hash >> 32) & (block_size - 1);
-    auto key = (uint32_t)hash;
-    // Calculate masks for bucket.
-    uint32_t masks[BITS_SET_PER_BLOCK];
-    _set_masks(key, masks);
-    auto* block_offset = (uint32_t*)(_data + BYTES_PER_BLOCK * block_index);
-    for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
-        if ((*(block_offset + i) & masks[i]) == 0) {
-            return false;
+    return test_any_hash(&hash, 1);
+}
+
+bool BlockSplitBloomFilter::test_any_hash(const uint64_t* hashes, size_t n) const {
+#ifdef __AVX2__
+    // Compute the 8 masks of a key at once, and test them against the 32-byte block.
+    const __m256i salt = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SALT));
+    const __m256i ones = _mm256_set1_epi32(1);
+    for (size_t i = 0; i < n; i++) {
+        __m256i masks = _mm256_mullo_epi32(_mm256_set1_epi32((uint32_t)hashes[i]), salt);
+        masks = _mm256_sllv_epi32(ones, _mm256_srli_epi32(masks, 27));
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_block(hashes[i])));
+        // every bit of masks is set in block
+        if (_mm256_testc_si256(block, masks)) {
+            return true;
+        }
+    }
+    return false;
+#else
+    for (size_t i = 0; i < n; i++) {
+        // Calculate masks for bucket.
+        uint32_t masks[BITS_SET_PER_BLOCK];
+        _set_masks((uint32_t)hashes[i], masks);
+        const uint32_t* block_offset = _block(hashes[i]);
+        bool hit = true;
+        for (int j = 0; j < BITS_SET_PER_BLOCK; ++j) {
+            if ((*(block_offset + j) & masks[j]) == 0) {
+                hit = false;
+                break;
+            }
+        }
+        if (hit) {
+            return true;
         }
     }
-    return true;
+    return false;
+#endif
 }
 
 } // namespace starrocks
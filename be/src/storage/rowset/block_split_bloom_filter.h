@@ -49,7 +49,17 @@ public:
 
     bool test_hash(uint64_t hash) const override;
 
+    bool test_any_hash(const uint64_t* hashes, size_t n) const override;
+
 private:
+    const uint32_t* _block(uint64_t hash) const {
+        // most significant 32 bit mod block size as block index(BTW:block size is
+        // power of 2)
+        uint32_t block_size = _num_bytes / BYTES_PER_BLOCK;
+        uint32_t block_index = (uint32_t)(hash >> 32) & (block_size - 1);
+        return (const uint32_t*)(_data + BYTES_PER_BLOCK * block_index);
+    }
+
     void _set_masks(uint32_t key, uint32_t* masks) const {
         for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
             // add some salt to key
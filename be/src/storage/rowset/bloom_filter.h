@@ -174,6 +174,14 @@ public:
     virtual void add_hash(uint64_t hash) = 0;
     virtual bool test_hash(uint64_t hash) const = 0;
 
+    // Return true if any of the |n| hashes may be in the filter.
+    virtual bool test_any_hash(const uint64_t* hashes, size_t n) const {
+        for (size_t i = 0; i < n; i++) {
+            RETURN_IF(test_hash(hashes[i]), true);
+        }
+        return false;
+    }
+
 private:
     // Compute the optimal bit number according to the following rule:
     //     m = -n * ln(fpp) / (ln(2) ^ 2)
@@ -110,4 +110,36 @@ Status BloomFilterIndexIterator::read_bloom_filter(rowid_t ordinal, std::unique_
     return Status::OK();
 }
 
+Status BloomFilterIndexIterator::read_bloom_filters(const std::vector<rowid_t>& ordinals,
+                                                    std::vector<std::unique_ptr<BloomFilter>>* bfs) {
+    bfs->clear();
+    bfs->reserve(ordinals.size());
+    auto column = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+    size_t i = 0;
+    while (i < ordinals.size()) {
+        DCHECK(i == 0 || ordinals[i - 1] < ordinals[i]);
+        size_t run_end = i + 1;
+        while (run_end < ordinals.size() && ordinals[run_end] == ordinals[run_end - 1] + 1) {
+            run_end++;
+        }
+        column->resize(0);
+        RETURN_IF_ERROR(_bloom_filter_iter->seek_to_ordinal(ordinals[i]));
+        size_t num_to_read = run_end - i;
+        size_t num_read = num_to_read;
+        RETURN_IF_ERROR(_bloom_filter_iter->next_batch(&num_read, column.get()));
+        DCHECK(num_to_read == num_read);
+
+        ColumnViewer<TYPE_VARCHAR> viewer(column);
+        for (size_t j = 0; j < num_read; j++) {
+            auto value = viewer.value(j);
+            std::unique_ptr<BloomFilter> bf;
+            RETURN_IF_ERROR(BloomFilter::create(_reader->_algorithm, &bf));
+            RETURN_IF_ERROR(bf->init(value.data, value.size, _reader->_hash_strategy));
+            bfs->emplace_back(std::move(bf));
+        }
+        i = run_end;
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -103,6 +103,10 @@ public:
     // Read bloom filter at the given ordinal into `bf`.
     Status read_bloom_filter(rowid_t ordinal, std::unique_ptr<BloomFilter>* bf);
 
+    // Read bloom filters at the given ascending ordinals into `bfs`, the consecutive ones are read
+    // in one batch.
+    Status read_bloom_filters(const std::vector<rowid_t>& ordinals, std::vector<std::unique_ptr<BloomFilter>>* bfs);
+
 private:
     BloomFilterIndexIterator(BloomFilterIndexReader* reader, std::unique_ptr<IndexedColumnIterator> bf_iter)
             : _reader(reader), _bloom_filter_iter(std::move(bf_iter)) {}
@@ -44,12 +44,23 @@ public:
 
     Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, Column* values) override;
 
+    // Disable zone map in CastColumnIterator, the zone maps are of the source type while the predicates are
+    // of the target type.
+    Status get_row_ranges_by_zone_map(const std::vector<const ColumnPredicate*>& predicates,
+                                      const ColumnPredicate* del_predicate, SparseRange<>* row_ranges) override {
+        row_ranges->add({0, static_cast<rowid_t>(num_rows())});
+        return Status::OK();
+    }
+
     // Disable bloom filter in CastColumnIterator
     Status get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
                                           SparseRange<>* row_ranges) override {
         return Status::OK();
     }
 
+    // The dictionary codes are of the source values.
+    bool all_page_dict_encoded() const override { return false; }
+
 private:
     void do_cast(Column* target);
 
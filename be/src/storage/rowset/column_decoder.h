@@ -43,6 +43,7 @@ public:
 
     void set_all_page_dict_encoded(bool all_page_dict_encoded) { _all_page_dict_encoded = all_page_dict_encoded; }
     void set_global_dict(GlobalDictMap* global_dict) { _global_dict = global_dict; }
+    void set_global_dict_version(int64_t version) { _global_dict_version = version; }
     // check global dict is superset of local dict
     void check_global_dict();
 
@@ -64,6 +65,7 @@ private:
     std::optional<std::vector<int16_t>> _code_convert_map;
     ColumnIterator* _iter = nullptr;
     GlobalDictMap* _global_dict = nullptr;
+    int64_t _global_dict_version = -1;
     bool _all_page_dict_encoded = false;
 };
 
@@ -56,7 +56,6 @@ class RandomAccessFile;
 struct ColumnIteratorOptions {
     //RandomAccessFile* read_file = nullptr;
     io::SeekableInputStream* read_file = nullptr;
-    bool is_io_coalesce = false;
     // reader statistics
     OlapReaderStatistics* stats = nullptr;
     bool use_page_cache = false;
@@ -104,12 +103,8 @@ public:
 
     virtual Status next_batch(const SparseRange<>& range, Column* dst);
 
-    Status convert_sparse_range_to_io_range(const SparseRange<>& range) {
-        if (auto sharedBufferStream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
-            sharedBufferStream == nullptr) {
-            return Status::OK();
-        }
-
+    // Append to |result| the io ranges of the pages covering |range|, the adjacent pages are merged.
+    Status get_io_ranges(const SparseRange<>& range, std::vector<io::SharedBufferedInputStream::IORange>* result) {
         auto reader = get_column_reader();
         if (reader == nullptr) {
             // should't happen
@@ -117,7 +112,6 @@ public:
             return Status::OK();
         }
 
-        std::vector<io::SharedBufferedInputStream::IORange> result;
         std::vector<std::pair<int, int>> page_index;
         int prev_page_index = -1;
         for (auto index = 0; index < range.size(); index++) {
@@ -145,11 +139,33 @@ public:
             RETURN_IF_ERROR(reader->seek_by_page_index(pair.second, &iter_end));
             auto offset = iter_start.page().offset;
             auto size = iter_end.page().offset - offset + iter_end.page().size;
-            io::SharedBufferedInputStream::IORange io_range(offset, size);
-            result.emplace_back(io_range);
+            result->emplace_back(offset, size);
+        }
+        return Status::OK();
+    }
+
+    // Read the pages of |range| ahead asynchronously, which must be in the io ranges got by
+    // get_io_ranges() and set to the stream.
+    Status prefetch_range(const SparseRange<>& range) {
+        auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
+        auto reader = get_column_reader();
+        if (shared_buffer_stream == nullptr || reader == nullptr || range.empty()) {
+            return Status::OK();
         }
+        OrdinalPageIndexIterator iter_start;
+        OrdinalPageIndexIterator iter_end;
+        RETURN_IF_ERROR(reader->seek_at_or_before(range.begin(), &iter_start));
+        RETURN_IF_ERROR(reader->seek_at_or_before(range.end() - 1, &iter_end));
+        auto offset = iter_start.page().offset;
+        auto size = iter_end.page().offset - offset + iter_end.page().size;
+        return shared_buffer_stream->prefetch(offset, size);
+    }
 
-        return dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file)->set_io_ranges(result);
+    // Return the global dict codes of the dictionary words indexed by their local codes, if the column
+    // was written with the global dictionary of |version| covering all the words, otherwise nullptr.
+    const std::vector<int16_t>* global_dict_codes(int64_t version) {
+        auto reader = get_column_reader();
+        return reader != nullptr ? reader->global_dict_codes(version) : nullptr;
     }
 
     virtual ordinal_t get_current_ordinal() const = 0;
@@ -160,6 +176,12 @@ public:
         return Status::OK();
     }
 
+    // Remove from |range| the rows of the current page which can not satisfy all of |predicates|,
+    // judged by the value bounds the page encoding keeps, without decoding the page. Rows outside
+    // of the current page are kept.
+    virtual void prune_range_by_page_bounds(const std::vector<const ColumnPredicate*>& predicates,
+                                            SparseRange<>* range) {}
+
     virtual Status get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
                                                   SparseRange<>* row_ranges) {
         return Status::OK();
@@ -67,6 +67,7 @@
 #include "storage/types.h"
 #include "types/logical_type.h"
 #include "util/compression/block_compression.h"
+#include "util/json_flattener.h"
 #include "util/rle_encoding.h"
 
 namespace starrocks {
@@ -120,6 +121,11 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
     if (meta->is_nullable()) _flags |= kIsNullableMask;
     if (meta->has_all_dict_encoded()) _flags |= kHasAllDictEncodedMask;
     if (meta->all_dict_encoded()) _flags |= kAllDictEncodedMask;
+    if (meta->has_global_dict_version()) {
+        _global_dict_version = meta->global_dict_version();
+        _global_dict_codes.assign(meta->global_dict_codes().begin(), meta->global_dict_codes().end());
+        _meta_mem_usage.fetch_add(_global_dict_codes.capacity() * sizeof(int16_t), std::memory_order_relaxed);
+    }
 
     if (_column_type == TYPE_JSON && meta->has_json_meta()) {
         // TODO(mofei) store format_version in ColumnReader
@@ -197,6 +203,16 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
         }
         return Status::OK();
     } else if (_column_type == LogicalType::TYPE_ARRAY) {
+        for (int i = 0; i < meta->indexes_size(); i++) {
+            auto* index_meta = meta->mutable_indexes(i);
+            if (index_meta->type() != VECTOR_INDEX) {
+                return Status::Corruption(fmt::format("Bad file {}: unexpected index type {} of array column",
+                                                      file_name(), index_meta->type()));
+            }
+            _vector_index_meta.reset(index_meta->release_vector_index());
+            _meta_mem_usage.fetch_add(_vector_index_meta->SpaceUsedLong(), std::memory_order_relaxed);
+            _vector_index = std::make_unique<VectorIndexReader>();
+        }
         _sub_readers = std::make_unique<SubReaderList>();
         if (meta->is_nullable()) {
             if (meta->children_columns_size() != 3) {
@@ -363,16 +379,38 @@ Status ColumnReader::bloom_filter(const std::vector<const ColumnPredicate*>& pre
         }
     }
 
-    for (const auto& pid : page_ids) {
-        std::unique_ptr<BloomFilter> bf;
-        RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
-        for (const auto* pred : predicates) {
-            if ((pred->support_bloom_filter() && pred->bloom_filter(bf.get())) ||
-                (pred->support_ngram_bloom_filter() &&
-                 pred->ngram_bloom_filter(bf.get(), _get_reader_options_for_ngram()))) {
-                bf_row_ranges.add(
-                        Range<>(_ordinal_index->get_first_ordinal(pid), _ordinal_index->get_last_ordinal(pid) + 1));
+    std::vector<rowid_t> pids(page_ids.begin(), page_ids.end());
+    std::vector<std::unique_ptr<BloomFilter>> bfs;
+    RETURN_IF_ERROR(bf_iter->read_bloom_filters(pids, &bfs));
+    DCHECK_EQ(pids.size(), bfs.size());
+
+    // Whether each page may match any of the predicates.
+    std::vector<uint8_t> page_hits(pids.size(), 0);
+    std::vector<uint64_t> hashes;
+    for (const auto* pred : predicates) {
+        // Hash the values of the predicate once for all pages if possible.
+        hashes.clear();
+        const bool hashed = pred->support_bloom_filter() && !bfs.empty() &&
+                            pred->bloom_filter_hashes(bfs[0].get(), &hashes);
+        for (size_t i = 0; i < bfs.size(); i++) {
+            if (page_hits[i]) {
+                continue;
             }
+            const BloomFilter* bf = bfs[i].get();
+            if (hashed) {
+                page_hits[i] = bf->test_any_hash(hashes.data(), hashes.size());
+            } else {
+                page_hits[i] = pred->support_bloom_filter() && pred->bloom_filter(bf);
+            }
+            if (!page_hits[i] && pred->support_ngram_bloom_filter()) {
+                page_hits[i] = pred->ngram_bloom_filter(bf, _get_reader_options_for_ngram());
+            }
+        }
+    }
+    for (size_t i = 0; i < pids.size(); i++) {
+        if (page_hits[i]) {
+            bf_row_ranges.add(
+                    Range<>(_ordinal_index->get_first_ordinal(pids[i]), _ordinal_index->get_last_ordinal(pids[i]) + 1));
         }
     }
     *row_ranges = row_ranges->intersection(bf_row_ranges);
@@ -443,6 +481,26 @@ Status ColumnReader::_load_bloom_filter_index(const IndexReadOptions& opts) {
     return Status::OK();
 }
 
+Status ColumnReader::_load_vector_index(const IndexReadOptions& opts) {
+    if (_vector_index == nullptr || _vector_index->loaded()) return Status::OK();
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    ASSIGN_OR_RETURN(auto first_load, _vector_index->load(opts, *_vector_index_meta));
+    if (UNLIKELY(first_load)) {
+        _meta_mem_usage.fetch_sub(_vector_index_meta->SpaceUsedLong(), std::memory_order_relaxed);
+        _meta_mem_usage.fetch_add(_vector_index->mem_usage(), std::memory_order_relaxed);
+        _vector_index_meta.reset();
+        _segment->update_cache_size();
+    }
+    return Status::OK();
+}
+
+Status ColumnReader::vector_search(const IndexReadOptions& opts, const VectorSearchOption& option,
+                                   const roaring::Roaring& filter, roaring::Roaring* result) {
+    DCHECK(has_vector_index());
+    RETURN_IF_ERROR(_load_vector_index(opts));
+    return _vector_index->search(option, filter, result);
+}
+
 Status ColumnReader::new_inverted_index_iterator(const std::shared_ptr<TabletIndex>& index_meta,
                                                  InvertedIndexIterator** iterator, const SegmentReadOptions& opts) {
     RETURN_IF_ERROR(_load_inverted_index(index_meta, opts));
@@ -588,6 +646,7 @@ StatusOr<std::unique_ptr<ColumnIterator>> ColumnReader::new_iterator(ColumnAcces
                 }
                 flat_paths.emplace_back(p->path());
                 target_types.emplace_back(p->value_type().type);
+                JsonPathAccessStats::instance()->record(p->path());
             }
         }
 
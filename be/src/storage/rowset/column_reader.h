@@ -55,6 +55,7 @@
 #include "storage/rowset/ordinal_page_index.h"
 #include "storage/rowset/page_handle.h"
 #include "storage/rowset/segment.h"
+#include "storage/rowset/vector_index_reader.h"
 #include "storage/rowset/zone_map_index.h"
 #include "util/once.h"
 
@@ -126,6 +127,7 @@ public:
     bool has_zone_map() const { return _zonemap_index != nullptr; }
     bool has_bitmap_index() const { return _bitmap_index != nullptr; }
     bool has_bloom_filter_index() const { return _bloom_filter_index != nullptr; }
+    bool has_vector_index() const { return _vector_index != nullptr; }
 
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
@@ -136,6 +138,12 @@ public:
 
     uint64_t total_mem_footprint() const { return _total_mem_footprint; }
 
+    // Return the global dict codes of the dictionary words indexed by their local codes, if the segment
+    // is written with the global dictionary of |version| covering all the words, otherwise nullptr.
+    const std::vector<int16_t>* global_dict_codes(int64_t version) const {
+        return (version >= 0 && version == _global_dict_version) ? &_global_dict_codes : nullptr;
+    }
+
     int32_t num_data_pages() { return _ordinal_index ? _ordinal_index->num_data_pages() : 0; }
 
     // page-level zone map filter.
@@ -155,6 +163,11 @@ public:
 
     Status load_ordinal_index(const IndexReadOptions& opts);
 
+    // Return the candidates of the nearest rows of |option| among |filter|, see VectorIndexReader::search.
+    // prerequisite: has_vector_index()
+    Status vector_search(const IndexReadOptions& opts, const VectorSearchOption& option,
+                         const roaring::Roaring& filter, roaring::Roaring* result);
+
     Status new_inverted_index_iterator(const std::shared_ptr<TabletIndex>& index_meta, InvertedIndexIterator** iterator,
                                        const SegmentReadOptions& opts);
 
@@ -184,6 +197,7 @@ private:
     Status _load_zonemap_index(const IndexReadOptions& opts);
     Status _load_bitmap_index(const IndexReadOptions& opts);
     Status _load_bloom_filter_index(const IndexReadOptions& opts);
+    Status _load_vector_index(const IndexReadOptions& opts);
 
     Status _parse_zone_map(LogicalType type, const ZoneMapPB& zm, ZoneMapDetail* detail) const;
 
@@ -206,6 +220,8 @@ private:
     PagePointer _dict_page_pointer;
     uint64_t _total_mem_footprint = 0;
     uint32 _column_unique_id = std::numeric_limits<uint32_t>::max();
+    int64_t _global_dict_version = -1;
+    std::vector<int16_t> _global_dict_codes;
 
     // initialized in init(), used for create PageDecoder
     const EncodingInfo* _encoding_info = nullptr;
@@ -215,11 +231,13 @@ private:
     std::unique_ptr<OrdinalIndexPB> _ordinal_index_meta;
     std::unique_ptr<BitmapIndexPB> _bitmap_index_meta;
     std::unique_ptr<BloomFilterIndexPB> _bloom_filter_index_meta;
+    std::unique_ptr<VectorIndexPB> _vector_index_meta;
 
     std::unique_ptr<ZoneMapIndexReader> _zonemap_index;
     std::unique_ptr<OrdinalIndexReader> _ordinal_index;
     std::unique_ptr<BitmapIndexReader> _bitmap_index;
     std::unique_ptr<BloomFilterIndexReader> _bloom_filter_index;
+    std::unique_ptr<VectorIndexReader> _vector_index;
     std::unique_ptr<InvertedReader> _inverted_index;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
@@ -307,13 +307,15 @@ StatusOr<std::unique_ptr<ColumnWriter>> ColumnWriter::create(const ColumnWriterO
                                                              const TabletColumn* column, WritableFile* wfile) {
     TypeInfoPtr type_info = get_type_info(*column);
     DCHECK(type_info.get() != nullptr);
-    if (is_string_type(delegate_type(column->type()))) {
+    // An explicitly chosen encoding is written as is, without speculating on the data.
+    const bool speculate_encoding = opts.meta->encoding() == DEFAULT_ENCODING;
+    if (speculate_encoding && is_string_type(delegate_type(column->type()))) {
         ColumnWriterOptions str_opts = opts;
         str_opts.need_speculate_encoding = true;
         str_opts.field_name = column->name();
         auto column_writer = std::make_unique<ScalarColumnWriter>(str_opts, type_info, wfile);
         return std::make_unique<StringColumnWriter>(str_opts, std::move(type_info), std::move(column_writer));
-    } else if (enable_non_string_column_dict_encoding() &&
+    } else if (speculate_encoding && enable_non_string_column_dict_encoding() &&
                numeric_types_support_dict_encoding(delegate_type(column->type()))) {
         DCHECK(column->type() != TYPE_VARCHAR);
         DCHECK(column->type() != TYPE_CHAR);
@@ -470,6 +472,14 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
 Status ScalarColumnWriter::finish() {
     if (_encoding_info->encoding() == DICT_ENCODING && _opts.global_dict != nullptr) {
         _is_global_dict_valid = _page_builder->is_valid_global_dict(_opts.global_dict);
+        if (_is_global_dict_valid && config::enable_segment_global_dict_codes && _opts.global_dict_version >= 0 &&
+            _page_builder->all_dict_encoded()) {
+            std::vector<int32_t> codes;
+            if (_page_builder->get_global_dict_codes(_opts.global_dict, &codes)) {
+                _opts.meta->set_global_dict_version(_opts.global_dict_version);
+                _opts.meta->mutable_global_dict_codes()->Add(codes.begin(), codes.end());
+            }
+        }
     } else {
         _is_global_dict_valid = false;
     }
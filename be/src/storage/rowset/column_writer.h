@@ -73,6 +73,7 @@ struct ColumnWriterOptions {
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
     bool need_inverted_index = false;
+    bool need_vector_index = false;
     std::unordered_map<IndexType, std::string> standalone_index_file_paths;
     std::unordered_map<IndexType, TabletIndex> tablet_index;
 
@@ -83,6 +84,9 @@ struct ColumnWriterOptions {
     // when column data is encoding by dict
     // if global_dict is not nullptr, will checkout whether global_dict can cover all data
     GlobalDictMap* global_dict = nullptr;
+    // version of |global_dict|, kept in the column meta together with the global dict codes of the
+    // dictionary words when |global_dict| covers all data.
+    int64_t global_dict_version = -1;
 
     bool need_flat = false;
 
@@ -132,6 +136,8 @@ public:
 
     virtual Status write_inverted_index() { return Status::OK(); }
 
+    virtual Status write_vector_index() { return Status::OK(); }
+
     virtual ordinal_t get_next_rowid() const = 0;
 
     // only invalid in the case of global_dict is not nullptr
@@ -94,12 +94,20 @@ Status GlobalDictCodeColumnIterator::decode_string_dict_codes(const Column& code
 }
 
 Status GlobalDictCodeColumnIterator::build_code_convert_map(ColumnIterator* file_column_iter,
-                                                            GlobalDictMap* global_dict,
+                                                            GlobalDictMap* global_dict, int64_t global_dict_version,
                                                             std::vector<int16_t>* code_convert_map) {
     DCHECK(file_column_iter->all_page_dict_encoded());
 
     int dict_size = file_column_iter->dict_size();
 
+    if (const auto* codes = file_column_iter->global_dict_codes(global_dict_version);
+        codes != nullptr && codes->size() == static_cast<size_t>(dict_size)) {
+        code_convert_map->resize(dict_size + 2);
+        std::fill(code_convert_map->begin(), code_convert_map->end(), 0);
+        std::copy(codes->begin(), codes->end(), code_convert_map->data() + 1);
+        return Status::OK();
+    }
+
     auto column = BinaryColumn::create();
 
     int dict_codes[dict_size];
@@ -87,8 +87,10 @@ public:
         return Status::NotSupported("unsupport decode_dict_codes in GlobalDictCodeColumnIterator");
     }
 
+    // Build the map from the local dict codes of |file_column_iter| to the codes in |global_dict|.
+    // The words are not looked up if the segment keeps their codes in the global dict of |global_dict_version|.
     static Status build_code_convert_map(ColumnIterator* file_column_iter, GlobalDictMap* global_dict,
-                                         std::vector<int16_t>* code_convert_map);
+                                         int64_t global_dict_version, std::vector<int16_t>* code_convert_map);
 
 private:
     Status decode_array_dict_codes(const Column& codes, Column* words);
@@ -210,6 +210,19 @@ public:
 
     EncodingTypePB encoding_type() const override { return FOR_ENCODING; }
 
+    bool value_bounds(uint32_t pos, uint32_t* end, void* lower, void* upper) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (pos >= _num_elements) {
+            return false;
+        }
+        uint32_t frame_index = pos / _decoder.max_frame_size();
+        if (!_decoder.frame_bounds(frame_index, static_cast<CppType*>(lower), static_cast<CppType*>(upper))) {
+            return false;
+        }
+        *end = std::min(_num_elements, (frame_index + 1) * _decoder.max_frame_size());
+        return true;
+    }
+
 private:
     typedef typename TypeTraits<Type>::CppType CppType;
 
@@ -0,0 +1,354 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/hnsw_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <queue>
+
+#include "fmt/format.h"
+#include "simd/vector_distance.h"
+#include "util/coding.h"
+
+namespace starrocks {
+
+static constexpr uint32_t kHnswFormatVersion = 1;
+// The probability of a node on level l is m^-l, nodes higher than this do not make the search any faster.
+static constexpr int kHnswMaxLevel = 16;
+
+static void normalize(float* vector, uint32_t dim) {
+    const float sum = SIMD::dot_product(vector, vector, dim);
+    if (sum > 0) {
+        SIMD::scale(vector, 1 / std::sqrt(sum), dim, vector);
+    }
+}
+
+HnswIndex::HnswIndex(const Options& options)
+        : _opts(options), _rng(options.seed), _level_mult(1.0 / std::log(std::max<uint32_t>(options.m, 2))) {}
+
+int HnswIndex::_random_level() {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    // 1 - uniform is in (0, 1], so the log is finite.
+    const double level = -std::log(1.0 - uniform(_rng)) * _level_mult;
+    return std::min(static_cast<int>(level), kHnswMaxLevel);
+}
+
+float HnswIndex::_distance(const float* query, uint32_t node) const {
+    return SIMD::l2_distance_squared(query, _vector(node), _opts.dim);
+}
+
+void HnswIndex::add(rowid_t rowid, const float* vector) {
+    DCHECK(_rowids.empty() || _rowids.back() < rowid);
+    const auto node = static_cast<uint32_t>(_rowids.size());
+    _rowids.push_back(rowid);
+    const size_t offset = _vectors.size();
+    _vectors.insert(_vectors.end(), vector, vector + _opts.dim);
+    if (_opts.metric == COSINE_SIMILARITY) {
+        normalize(_vectors.data() + offset, _opts.dim);
+    }
+
+    const int level = _random_level();
+    _links.emplace_back(level + 1);
+    if (_max_level < 0) {
+        _entry_point = node;
+        _max_level = level;
+        return;
+    }
+
+    const float* query = _vector(node);
+    uint32_t entry = _entry_point;
+    for (int l = _max_level; l > level; l--) {
+        entry = _greedy_search(query, entry, l);
+    }
+    for (int l = std::min(level, _max_level); l >= 0; l--) {
+        auto candidates = _search_layer(query, entry, _opts.ef_construction, l, nullptr);
+        DCHECK(!candidates.empty());
+        _links[node][l] = _select_neighbors(candidates, _opts.m);
+        for (uint32_t neighbor : _links[node][l]) {
+            _connect(neighbor, node, l);
+        }
+        entry = candidates[0].second;
+    }
+    if (level > _max_level) {
+        _entry_point = node;
+        _max_level = level;
+    }
+}
+
+uint32_t HnswIndex::_greedy_search(const float* query, uint32_t entry, int level) const {
+    uint32_t best = entry;
+    float best_distance = _distance(query, entry);
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint32_t neighbor : _links[best][level]) {
+            const float distance = _distance(query, neighbor);
+            if (distance < best_distance) {
+                best = neighbor;
+                best_distance = distance;
+                changed = true;
+            }
+        }
+    }
+    return best;
+}
+
+std::vector<HnswIndex::Candidate> HnswIndex::_search_layer(const float* query, uint32_t entry, uint32_t ef,
+                                                           int level, const roaring::Roaring* filter) const {
+    auto accept = [&](uint32_t node) { return filter == nullptr || filter->contains(_rowids[node]); };
+
+    std::vector<bool> visited(_rowids.size(), false);
+    // nearest first
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> candidates;
+    // farthest first
+    std::priority_queue<Candidate> results;
+
+    const float entry_distance = _distance(query, entry);
+    visited[entry] = true;
+    candidates.emplace(entry_distance, entry);
+    if (accept(entry)) {
+        results.emplace(entry_distance, entry);
+    }
+    while (!candidates.empty()) {
+        const auto [distance, node] = candidates.top();
+        if (results.size() >= ef && distance > results.top().first) {
+            break;
+        }
+        candidates.pop();
+        for (uint32_t neighbor : _links[node][level]) {
+            if (visited[neighbor]) {
+                continue;
+            }
+            visited[neighbor] = true;
+            const float neighbor_distance = _distance(query, neighbor);
+            if (results.size() < ef || neighbor_distance < results.top().first) {
+                // Rows out of |filter| are still expanded, they may lead to the accepted ones.
+                candidates.emplace(neighbor_distance, neighbor);
+                if (accept(neighbor)) {
+                    results.emplace(neighbor_distance, neighbor);
+                    if (results.size() > ef) {
+                        results.pop();
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<Candidate> nearest(results.size());
+    for (size_t i = nearest.size(); i > 0; i--) {
+        nearest[i - 1] = results.top();
+        results.pop();
+    }
+    return nearest;
+}
+
+HnswIndex::Neighbors HnswIndex::_select_neighbors(const std::vector<Candidate>& candidates,
+                                                  uint32_t max_neighbors) const {
+    Neighbors selected;
+    selected.reserve(max_neighbors);
+    for (const auto& [distance, node] : candidates) {
+        if (selected.size() >= max_neighbors) {
+            break;
+        }
+        // Skip the candidates closer to a selected neighbor than to the query, they are reachable through it.
+        bool diverse = true;
+        for (uint32_t neighbor : selected) {
+            if (_distance(_vector(node), neighbor) < distance) {
+                diverse = false;
+                break;
+            }
+        }
+        if (diverse) {
+            selected.push_back(node);
+        }
+    }
+    return selected;
+}
+
+void HnswIndex::_connect(uint32_t node, uint32_t neighbor, int level) {
+    auto& links = _links[node][level];
+    links.push_back(neighbor);
+    const uint32_t max_neighbors = _max_neighbors(level);
+    if (links.size() <= max_neighbors) {
+        return;
+    }
+    std::vector<Candidate> candidates;
+    candidates.reserve(links.size());
+    for (uint32_t n : links) {
+        candidates.emplace_back(_distance(_vector(node), n), n);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    links = _select_neighbors(candidates, max_neighbors);
+}
+
+std::vector<rowid_t> HnswIndex::search(const float* query, uint32_t k, uint32_t ef,
+                                       const roaring::Roaring* filter) const {
+    std::vector<rowid_t> rowids;
+    if (_max_level < 0 || k == 0) {
+        return rowids;
+    }
+    std::vector<float> normalized;
+    if (_opts.metric == COSINE_SIMILARITY) {
+        normalized.assign(query, query + _opts.dim);
+        normalize(normalized.data(), _opts.dim);
+        query = normalized.data();
+    }
+
+    uint32_t entry = _entry_point;
+    for (int l = _max_level; l > 0; l--) {
+        entry = _greedy_search(query, entry, l);
+    }
+    auto nearest = _search_layer(query, entry, std::max(ef, k), 0, filter);
+    const size_t num_results = std::min<size_t>(k, nearest.size());
+    rowids.reserve(num_results);
+    for (size_t i = 0; i < num_results; i++) {
+        rowids.push_back(_rowids[nearest[i].second]);
+    }
+    return rowids;
+}
+
+size_t HnswIndex::mem_usage() const {
+    size_t size = sizeof(HnswIndex) + _vectors.capacity() * sizeof(float) + _rowids.capacity() * sizeof(rowid_t);
+    for (const auto& node_links : _links) {
+        size += node_links.capacity() * sizeof(Neighbors);
+        for (const auto& links : node_links) {
+            size += links.capacity() * sizeof(uint32_t);
+        }
+    }
+    return size;
+}
+
+// Format:
+//   version, dim, metric, m, num_nodes, entry_point, max_level + 1: fixed32
+//   rowids: fixed32 * num_nodes
+//   vectors: float * dim * num_nodes
+//   links of each node: varint num_levels, then varint num_neighbors and varint neighbors of each level
+void HnswIndex::serialize(std::string* buf) const {
+    const auto num_nodes = static_cast<uint32_t>(_rowids.size());
+    put_fixed32_le(buf, kHnswFormatVersion);
+    put_fixed32_le(buf, _opts.dim);
+    put_fixed32_le(buf, static_cast<uint32_t>(_opts.metric));
+    put_fixed32_le(buf, _opts.m);
+    put_fixed32_le(buf, num_nodes);
+    put_fixed32_le(buf, _entry_point);
+    put_fixed32_le(buf, static_cast<uint32_t>(_max_level + 1));
+    for (rowid_t rowid : _rowids) {
+        put_fixed32_le(buf, rowid);
+    }
+    buf->append(reinterpret_cast<const char*>(_vectors.data()), _vectors.size() * sizeof(float));
+    for (const auto& node_links : _links) {
+        put_varint32(buf, static_cast<uint32_t>(node_links.size()));
+        for (const auto& links : node_links) {
+            put_varint32(buf, static_cast<uint32_t>(links.size()));
+            for (uint32_t neighbor : links) {
+                put_varint32(buf, neighbor);
+            }
+        }
+    }
+}
+
+StatusOr<std::unique_ptr<HnswIndex>> HnswIndex::deserialize(const Slice& data) {
+    constexpr size_t kHeaderSize = 7 * sizeof(uint32_t);
+    if (data.size < kHeaderSize) {
+        return Status::Corruption(fmt::format("bad hnsw index size: {}", data.size));
+    }
+    auto p = reinterpret_cast<const uint8_t*>(data.data);
+    const uint8_t* limit = p + data.size;
+    auto next_fixed32 = [&p]() {
+        uint32_t value = decode_fixed32_le(p);
+        p += sizeof(uint32_t);
+        return value;
+    };
+    const uint32_t version = next_fixed32();
+    if (version != kHnswFormatVersion) {
+        return Status::Corruption(fmt::format("unknown hnsw index version: {}", version));
+    }
+    Options opts;
+    opts.dim = next_fixed32();
+    const uint32_t metric = next_fixed32();
+    if (!VectorIndexMetricPB_IsValid(static_cast<int>(metric))) {
+        return Status::Corruption(fmt::format("unknown hnsw index metric: {}", metric));
+    }
+    opts.metric = static_cast<VectorIndexMetricPB>(metric);
+    opts.m = next_fixed32();
+    const uint32_t num_nodes = next_fixed32();
+    const uint32_t entry_point = next_fixed32();
+    const int max_level = static_cast<int>(next_fixed32()) - 1;
+
+    const size_t fixed_size = static_cast<size_t>(num_nodes) * sizeof(rowid_t) +
+                              static_cast<size_t>(num_nodes) * opts.dim * sizeof(float);
+    if (static_cast<size_t>(limit - p) < fixed_size || (num_nodes > 0 && entry_point >= num_nodes) ||
+        max_level > kHnswMaxLevel || (num_nodes == 0) != (max_level < 0)) {
+        return Status::Corruption("bad hnsw index header");
+    }
+
+    auto index = std::make_unique<HnswIndex>(opts);
+    index->_entry_point = entry_point;
+    index->_max_level = max_level;
+    index->_rowids.resize(num_nodes);
+    for (uint32_t i = 0; i < num_nodes; i++) {
+        index->_rowids[i] = next_fixed32();
+    }
+    index->_vectors.resize(static_cast<size_t>(num_nodes) * opts.dim);
+    memcpy(index->_vectors.data(), p, index->_vectors.size() * sizeof(float));
+    p += index->_vectors.size() * sizeof(float);
+
+    auto next_varint32 = [&p, limit](uint32_t* value) {
+        p = decode_varint32_ptr(p, limit, value);
+        return p != nullptr;
+    };
+    index->_links.resize(num_nodes);
+    for (uint32_t node = 0; node < num_nodes; node++) {
+        uint32_t num_levels = 0;
+        if (!next_varint32(&num_levels) || num_levels == 0 || num_levels > static_cast<uint32_t>(max_level) + 1) {
+            return Status::Corruption(fmt::format("bad hnsw index levels of node {}", node));
+        }
+        auto& node_links = index->_links[node];
+        node_links.resize(num_levels);
+        for (auto& links : node_links) {
+            uint32_t num_neighbors = 0;
+            if (!next_varint32(&num_neighbors) || num_neighbors > num_nodes) {
+                return Status::Corruption(fmt::format("bad hnsw index neighbors of node {}", node));
+            }
+            links.resize(num_neighbors);
+            for (auto& neighbor : links) {
+                if (!next_varint32(&neighbor) || neighbor >= num_nodes) {
+                    return Status::Corruption(fmt::format("bad hnsw index neighbors of node {}", node));
+                }
+            }
+        }
+    }
+    // The neighbors on a level must reach that level too, the search indexes their links by it.
+    for (uint32_t node = 0; node < num_nodes; node++) {
+        const auto& node_links = index->_links[node];
+        for (size_t level = 1; level < node_links.size(); level++) {
+            for (uint32_t neighbor : node_links[level]) {
+                if (index->_links[neighbor].size() <= level) {
+                    return Status::Corruption(fmt::format("bad hnsw index neighbors of node {}", node));
+                }
+            }
+        }
+    }
+    if (num_nodes > 0 && index->_links[entry_point].size() != static_cast<size_t>(max_level) + 1) {
+        return Status::Corruption("bad hnsw index entry point");
+    }
+    if (p != limit) {
+        return Status::Corruption(fmt::format("bad hnsw index size: {}", data.size));
+    }
+    return index;
+}
+
+} // namespace starrocks
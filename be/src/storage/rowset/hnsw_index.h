@@ -0,0 +1,101 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/statusor.h"
+#include "gen_cpp/segment.pb.h"
+#include "roaring/roaring.hh"
+#include "storage/rowset/common.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// HnswIndex is a Hierarchical Navigable Small World graph over the vectors of a segment, answering the
+// approximate k nearest neighbors of a query vector in O(log(n)) distance computations.
+//
+// Every vector is a node of layer 0 and of each layer up to a level drawn from an exponential distribution, the
+// search descends greedily from the single entry point of the top layer and runs a best-first search of width
+// `ef` on layer 0. Nodes keep at most `m` neighbors on the upper layers and `2 * m` on layer 0, chosen by the
+// heuristic of the paper which prefers diverse directions over the closest ones.
+//
+// Vectors of COSINE_SIMILARITY are normalized when added, so that both metrics are compared by squared L2 distance.
+class HnswIndex {
+public:
+    struct Options {
+        uint32_t dim = 0;
+        VectorIndexMetricPB metric = L2_DISTANCE;
+        uint32_t m = 16;
+        uint32_t ef_construction = 64;
+        uint32_t seed = 42;
+    };
+
+    static constexpr uint32_t kDefaultEfSearch = 64;
+
+    explicit HnswIndex(const Options& options);
+
+    // |vector| has |dim| elements. Row ids must be added in ascending order.
+    void add(rowid_t rowid, const float* vector);
+
+    // Return the row ids of at most |k| approximate nearest vectors of |query|, ordered by distance.
+    // Only the rows in |filter| are returned if it is not null, the others are still traversed.
+    std::vector<rowid_t> search(const float* query, uint32_t k, uint32_t ef, const roaring::Roaring* filter) const;
+
+    void serialize(std::string* buf) const;
+    static StatusOr<std::unique_ptr<HnswIndex>> deserialize(const Slice& data);
+
+    uint32_t dim() const { return _opts.dim; }
+    VectorIndexMetricPB metric() const { return _opts.metric; }
+    size_t size() const { return _rowids.size(); }
+    const std::vector<rowid_t>& rowids() const { return _rowids; }
+    size_t mem_usage() const;
+
+private:
+    using Neighbors = std::vector<uint32_t>;
+    // (distance, node)
+    using Candidate = std::pair<float, uint32_t>;
+
+    const float* _vector(uint32_t node) const { return _vectors.data() + static_cast<size_t>(node) * _opts.dim; }
+    float _distance(const float* query, uint32_t node) const;
+    uint32_t _max_neighbors(int level) const { return level == 0 ? 2 * _opts.m : _opts.m; }
+    int _random_level();
+
+    uint32_t _greedy_search(const float* query, uint32_t entry, int level) const;
+    // Return at most |ef| nearest nodes in ascending order of distance.
+    std::vector<Candidate> _search_layer(const float* query, uint32_t entry, uint32_t ef, int level,
+                                         const roaring::Roaring* filter) const;
+    // Pick at most |max_neighbors| of |candidates| sorted by distance with the HNSW heuristic.
+    Neighbors _select_neighbors(const std::vector<Candidate>& candidates, uint32_t max_neighbors) const;
+    void _connect(uint32_t node, uint32_t neighbor, int level);
+
+    Options _opts;
+    std::mt19937 _rng;
+    double _level_mult;
+
+    std::vector<float> _vectors;
+    std::vector<rowid_t> _rowids;
+    // _links[node][level]
+    std::vector<std::vector<Neighbors>> _links;
+    uint32_t _entry_point = 0;
+    int _max_level = -1;
+};
+
+} // namespace starrocks
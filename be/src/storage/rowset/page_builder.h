@@ -86,6 +86,12 @@ public:
     // check global dict valid for dictionary encoding mode column.
     virtual bool is_valid_global_dict(const GlobalDictMap* global_dict) const { return true; }
 
+    // Fill |codes| with the codes in |global_dict| of the dictionary words, indexed by their codes in
+    // the dictionary page. Return false if not a dictionary encoding mode column or some word is missing.
+    virtual bool get_global_dict_codes(const GlobalDictMap* global_dict, std::vector<int32_t>* codes) const {
+        return false;
+    }
+
     // Reset the internal state of the page builder.
     //
     // Any data previously returned by finish may be invalidated by this call.
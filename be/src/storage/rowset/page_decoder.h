@@ -114,6 +114,13 @@ public:
 
     virtual const PageDecoder* dict_page_decoder() const { return nullptr; }
 
+    // Get the bounds of a group of values starting at or before the positional index |pos|,
+    // for encodings that keep such bounds in the page, without decoding the values.
+    // On success, |*end| is set to the position after the last value of the group, and
+    // |lower| and |upper| point to values of the page's cpp type.
+    // Return false if the encoding keeps no bounds for |pos|.
+    virtual bool value_bounds(uint32_t pos, uint32_t* end, void* lower, void* upper) { return false; }
+
 private:
     PageDecoder(const PageDecoder&) = delete;
     const PageDecoder& operator=(const PageDecoder&) = delete;
@@ -42,6 +42,7 @@
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
 #include "storage/page_cache.h"
+#include "storage/page_cache_warmer.h"
 #include "storage/rowset/storage_page_decoder.h"
 #include "util/coding.h"
 #include "util/compression/block_compression.h"
@@ -140,6 +141,9 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     auto cache = StoragePageCache::instance();
     PageCacheHandle cache_handle;
     StoragePageCache::CacheKey cache_key(opts.read_file->filename(), opts.page_pointer.offset);
+    if (opts.use_page_cache) {
+        PageCacheWarmer::instance()->record_access(cache_key.fname, cache_key.offset, opts.page_pointer.size);
+    }
     if (opts.use_page_cache && cache->lookup(cache_key, &cache_handle)) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
@@ -164,30 +168,45 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
                 strings::Substitute("Bad page: too small size ($0), file($1)", page_size, opts.read_file->filename()));
     }
 
+    // Only compressed pages are kept in the compressed tier, which are decompressed from the
+    // cached bytes directly.
+    const bool use_compressed_tier = opts.use_page_cache && cache->compressed_tier_enabled();
+    PageCacheHandle compressed_handle;
+    const bool compressed_hit = use_compressed_tier && cache->lookup_compressed(cache_key, &compressed_handle);
+
     // hold compressed page at first, reset to decompressed page later
-    // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
-    std::unique_ptr<char[]> page(new char[page_size + Column::APPEND_OVERFLOW_MAX_SIZE]);
-    Slice page_slice(page.get(), page_size);
-    {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        // todo override is_cache_hit
-        if (opts.read_file->is_cache_hit()) {
-            RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
-            ++opts.stats->pages_from_local_disk;
-        } else {
-            RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
+    std::unique_ptr<char[]> page;
+    Slice page_slice;
+    if (compressed_hit) {
+        page_slice = compressed_handle.data();
+        DCHECK_EQ(page_size, page_slice.size);
+    } else {
+        // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
+        page.reset(new char[page_size + Column::APPEND_OVERFLOW_MAX_SIZE]);
+        page_slice = Slice(page.get(), page_size);
+        {
+            SCOPED_RAW_TIMER(&opts.stats->io_ns);
+            // todo override is_cache_hit
+            if (opts.read_file->is_cache_hit()) {
+                RETURN_IF_ERROR(
+                        opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
+                ++opts.stats->pages_from_local_disk;
+            } else {
+                RETURN_IF_ERROR(
+                        opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
+            }
+            opts.stats->compressed_bytes_read_request += page_size;
+            ++opts.stats->io_count_request;
         }
-        opts.stats->compressed_bytes_read_request += page_size;
-        ++opts.stats->io_count_request;
-    }
 
-    if (opts.verify_checksum) {
-        uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
-        uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
-        if (expect != actual) {
-            return Status::Corruption(
-                    strings::Substitute("Bad page: checksum mismatch (actual=$0 vs expect=$1), file=$2", actual, expect,
-                                        opts.read_file->filename()));
+        if (opts.verify_checksum) {
+            uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
+            uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
+            if (expect != actual) {
+                return Status::Corruption(
+                        strings::Substitute("Bad page: checksum mismatch (actual=$0 vs expect=$1), file=$2", actual,
+                                            expect, opts.read_file->filename()));
+            }
         }
     }
 
@@ -202,7 +221,12 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     }
 
     uint32_t body_size = page_slice.size - 4 - footer_size;
-    if (body_size != footer->uncompressed_size()) { // need decompress body
+    const bool is_compressed = body_size != footer->uncompressed_size();
+    if (compressed_hit && !is_compressed) {
+        return Status::Corruption(strings::Substitute("Bad page: uncompressed page in compressed page cache, file=$0",
+                                                      opts.read_file->filename()));
+    }
+    if (is_compressed) { // need decompress body
         if (opts.codec == nullptr) {
             return Status::Corruption(strings::Substitute(
                     "Bad page: page is compressed but codec is NO_COMPRESSION, file=$0", opts.read_file->filename()));
@@ -223,6 +247,10 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         }
         // append footer and footer size
         memcpy(decompressed_body.data + decompressed_body.size, page_slice.data + body_size, footer_size + 4);
+        if (use_compressed_tier && !compressed_hit) {
+            // keep the compressed page in the compressed tier, and the cache owns its memory
+            cache->insert_compressed(cache_key, Slice(page.release(), page_size), opts.kept_in_memory);
+        }
         // free memory of compressed page
         page = std::move(decompressed_page);
         page_slice = Slice(page.get(), footer->uncompressed_size() + footer_size + 4);
@@ -234,10 +262,17 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     RETURN_IF_ERROR(StoragePageDecoder::decode_page(footer, footer_size + 4, opts.encoding_type, &page, &page_slice));
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
-    if (opts.use_page_cache) {
+    if (use_compressed_tier && is_compressed && !compressed_hit) {
+        // the page is read for the first time, it is kept in the compressed tier only
+        *handle = PageHandle(page_slice);
+    } else if (opts.use_page_cache) {
         // insert this page into cache and return the cache handle
         cache->insert(cache_key, page_slice, &cache_handle, opts.kept_in_memory);
         *handle = PageHandle(std::move(cache_handle));
+        if (compressed_hit) {
+            // promoted to the decompressed tier
+            cache->erase_compressed(cache_key);
+        }
     } else {
         *handle = PageHandle(page_slice);
     }
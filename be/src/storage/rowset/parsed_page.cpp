@@ -208,6 +208,20 @@ public:
         return Status::OK();
     }
 
+    bool value_bounds(ordinal_t offset, ordinal_t* end, void* lower, void* upper, bool* has_null) override {
+        // The positions in the data differ from the offsets of records when there are nulls.
+        if (_has_null) {
+            return false;
+        }
+        uint32_t group_end = 0;
+        if (!_data_decoder->value_bounds(offset, &group_end, lower, upper)) {
+            return false;
+        }
+        *end = group_end;
+        *has_null = false;
+        return true;
+    }
+
 private:
     friend Status parse_page_v1(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                                 const DataPageFooterPB& footer, const EncodingInfo* encoding,
@@ -302,6 +316,18 @@ public:
         return Status::OK();
     }
 
+    bool value_bounds(ordinal_t offset, ordinal_t* end, void* lower, void* upper, bool* has_null) override {
+        // The data keeps a value for every record, so the bounds cover the nulls' values too,
+        // which only makes them wider.
+        uint32_t group_end = 0;
+        if (!_data_decoder->value_bounds(offset, &group_end, lower, upper)) {
+            return false;
+        }
+        *end = group_end;
+        *has_null = _null_flags.size() > 0;
+        return true;
+    }
+
 private:
     friend Status parse_page_v2(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                                 const DataPageFooterPB& footer, const EncodingInfo* encoding,
@@ -112,6 +112,15 @@ public:
 
     virtual Status read_dict_codes(Column* column, const SparseRange<>& range) = 0;
 
+    // Get the bounds of the values of a group of records starting at or before |offset|, from the
+    // encoded data without decoding it. See `PageDecoder::value_bounds`.
+    // On success, |*end| is set to the offset after the last record of the group, and |*has_null|
+    // tells whether some records of this page may be null.
+    // Return false if the bounds are unknown.
+    virtual bool value_bounds(ordinal_t offset, ordinal_t* end, void* lower, void* upper, bool* has_null) {
+        return false;
+    }
+
 protected:
     uint32_t _page_index{0};
     uint64_t _num_rows{0};
@@ -383,9 +383,13 @@ Status Rowset::_remove_delta_column_group_files(const std::shared_ptr<FileSystem
     return Status::OK();
 }
 
-Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version) {
+Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version,
+                             uint32_t segment_id_offset) {
+    if (segment_id_offset > 0 && (num_delete_files() > 0 || num_update_files() > 0)) {
+        return Status::NotSupported("link rowset with delete or update files to non-zero segment id");
+    }
     for (int i = 0; i < num_segments(); ++i) {
-        std::string dst_link_path = segment_file_path(dir, new_rowset_id, i);
+        std::string dst_link_path = segment_file_path(dir, new_rowset_id, i + segment_id_offset);
         std::string src_file_path = segment_file_path(_rowset_path, rowset_id(), i);
         if (link(src_file_path.c_str(), dst_link_path.c_str()) != 0) {
             PLOG(WARNING) << "Fail to link " << src_file_path << " to " << dst_link_path;
@@ -400,7 +404,7 @@ Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId
                 const auto& index = (*(_schema->indexes()))[index_id];
                 if (index.index_type() == GIN) {
                     std::string dst_inverted_link_path = IndexDescriptor::inverted_index_file_path(
-                            dir, new_rowset_id.to_string(), segment_n, index_id);
+                            dir, new_rowset_id.to_string(), segment_n + segment_id_offset, index_id);
                     std::string src_inverted_file_path = IndexDescriptor::inverted_index_file_path(
                             _rowset_path, rowset_id().to_string(), segment_n, index_id);
 
@@ -666,6 +670,7 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
     seg_options.reader_type = options.reader_type;
     seg_options.chunk_size = options.chunk_size;
     seg_options.global_dictmaps = options.global_dictmaps;
+    seg_options.global_dict_versions = options.global_dict_versions;
     seg_options.unused_output_column_ids = options.unused_output_column_ids;
     seg_options.runtime_range_pruner = options.runtime_range_pruner;
     seg_options.column_access_paths = options.column_access_paths;
@@ -691,6 +696,7 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
         seg_options.is_cancelled = &options.runtime_state->cancelled_ref();
     }
     seg_options.prune_column_after_index_filter = options.prune_column_after_index_filter;
+    seg_options.vector_search = options.vector_search;
 
     auto segment_schema = schema;
     // Append the columns with delete condition to segment schema.
@@ -286,7 +286,10 @@ public:
 
     // hard link all files in this rowset to `dir` to form a new rowset with id `new_rowset_id`.
     // `version` is used for link col files, default using INT64_MAX means link all col files
-    Status link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version = INT64_MAX);
+    // `segment_id_offset` is added to the segment ids in the new rowset, to link the segments of several
+    // rowsets into one. It's not supported for rowsets with delete or update files.
+    Status link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version = INT64_MAX,
+                         uint32_t segment_id_offset = 0);
 
     // copy all files to `dir`
     Status copy_files_to(KVStore* kvstore, const std::string& dir);
@@ -319,6 +322,12 @@ public:
     // this function is called by reader to increase reference of rowset
     void acquire() { ++_refs_by_reader; }
 
+    // Whether the segments have been loaded, they are not closed until the rowset is released if it's acquired.
+    bool is_loaded() {
+        std::lock_guard<std::mutex> l(_lock);
+        return _rowset_state_machine.rowset_state() == ROWSET_LOADED;
+    }
+
     void release() {
         // if the refs by reader is 0 and the rowset is closed, should release the resouce
         uint64_t current_refs = --_refs_by_reader;
@@ -43,6 +43,7 @@
 #include "common/status.h"
 #include "gutil/strings/split.h"
 #include "storage/kv_store.h"
+#include "storage/rocksdb_status_adapter.h"
 
 namespace starrocks {
 
@@ -75,6 +76,21 @@ Status RowsetMetaManager::remove(KVStore* meta, const TabletUid& tablet_uid, con
     return meta->remove(META_COLUMN_FAMILY_INDEX, key);
 }
 
+Status RowsetMetaManager::remove_batch(KVStore* meta, const std::vector<std::pair<TabletUid, RowsetId>>& rowsets) {
+    if (rowsets.empty()) {
+        return Status::OK();
+    }
+    WriteBatch batch;
+    ColumnFamilyHandle* cf = meta->handle(META_COLUMN_FAMILY_INDEX);
+    for (const auto& [tablet_uid, rowset_id] : rowsets) {
+        rocksdb::Status st = batch.Delete(cf, get_rowset_meta_key(tablet_uid, rowset_id));
+        if (!st.ok()) {
+            return to_status(st);
+        }
+    }
+    return meta->write_batch(&batch);
+}
+
 string RowsetMetaManager::get_rowset_meta_key(const TabletUid& tablet_uid, const RowsetId& rowset_id) {
     return fmt::format("{}{}_{}", ROWSET_PREFIX, tablet_uid.to_string(), rowset_id.to_string());
 }
@@ -36,6 +36,8 @@
 
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "storage/rowset/rowset_meta.h"
 
@@ -54,6 +56,9 @@ public:
 
     static Status remove(KVStore* meta, const TabletUid& tablet_uid, const RowsetId& rowset_id);
 
+    // Remove the metas of |rowsets| in a single write.
+    static Status remove_batch(KVStore* meta, const std::vector<std::pair<TabletUid, RowsetId>>& rowsets);
+
     static std::string get_rowset_meta_key(const TabletUid& tablet_uid, const RowsetId& rowset_id);
 
     static Status traverse_rowset_metas(
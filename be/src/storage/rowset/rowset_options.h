@@ -26,6 +26,7 @@
 #include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/seek_range.h"
 #include "storage/tablet_schema.h"
+#include "storage/vector_search_option.h"
 
 namespace starrocks {
 class Conditions;
@@ -74,6 +75,7 @@ public:
     LakeIOOptions lake_io_opts;
 
     ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
+    const ColumnIdToGlobalDictVersion* global_dict_versions = nullptr;
     const std::unordered_set<uint32_t>* unused_output_column_ids = nullptr;
 
     RowidRangeOptionPtr rowid_range_option = nullptr;
@@ -86,6 +88,8 @@ public:
     bool asc_hint = true;
 
     bool prune_column_after_index_filter = false;
+
+    VectorSearchOptionPtr vector_search;
 };
 
 } // namespace starrocks
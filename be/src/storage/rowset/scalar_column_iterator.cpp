@@ -206,13 +206,6 @@ Status ScalarColumnIterator::next_batch(size_t* n, Column* dst) {
             bool eos = false;
             RETURN_IF_ERROR(_load_next_page(&eos));
             if (eos) {
-                // release shareBufferStream
-                if (config::io_coalesce_lake_read_enable && _opts.is_io_coalesce) {
-                    auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
-                    if (shared_buffer_stream != nullptr) {
-                        shared_buffer_stream->release();
-                    }
-                }
                 break;
             }
         }
@@ -250,13 +243,6 @@ Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst)
             bool eos = false;
             RETURN_IF_ERROR(_load_next_page(&eos));
             if (eos) {
-                // release shareBufferStream
-                if (config::io_coalesce_lake_read_enable && _opts.is_io_coalesce) {
-                    auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
-                    if (shared_buffer_stream != nullptr) {
-                        shared_buffer_stream->release();
-                    }
-                }
                 break;
             }
             end_ord = _page->first_ordinal() + _page->num_rows();
@@ -414,6 +400,78 @@ Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(const std::vector<co
     return Status::OK();
 }
 
+void ScalarColumnIterator::prune_range_by_page_bounds(const std::vector<const ColumnPredicate*>& predicates,
+                                                      SparseRange<>* range) {
+    if (_page == nullptr || range->empty() || predicates.empty() || _page->encoding_type() != FOR_ENCODING) {
+        return;
+    }
+    // The bounds are parsed as the type of column, like the page zone maps.
+    const LogicalType type = _reader->column_type();
+    for (const auto* pred : predicates) {
+        if (pred->type_info()->type() != type) {
+            return;
+        }
+    }
+    switch (type) {
+    case TYPE_TINYINT:
+        return _do_prune_range_by_page_bounds<TYPE_TINYINT>(predicates, range);
+    case TYPE_SMALLINT:
+        return _do_prune_range_by_page_bounds<TYPE_SMALLINT>(predicates, range);
+    case TYPE_INT:
+        return _do_prune_range_by_page_bounds<TYPE_INT>(predicates, range);
+    case TYPE_BIGINT:
+        return _do_prune_range_by_page_bounds<TYPE_BIGINT>(predicates, range);
+    default:
+        return;
+    }
+}
+
+template <LogicalType Type>
+void ScalarColumnIterator::_do_prune_range_by_page_bounds(const std::vector<const ColumnPredicate*>& predicates,
+                                                          SparseRange<>* range) {
+    using CppType = typename CppTypeTraits<Type>::CppType;
+    const ordinal_t page_begin = _page->first_ordinal();
+    const ordinal_t page_end = page_begin + _page->num_rows();
+    const ordinal_t begin = std::max<ordinal_t>(range->begin(), page_begin);
+    const ordinal_t end = std::min<ordinal_t>(range->end(), page_end);
+
+    SparseRange<> pruned;
+    ordinal_t offset = begin - page_begin;
+    while (page_begin + offset < end) {
+        ordinal_t group_end = 0;
+        CppType lower;
+        CppType upper;
+        bool has_null = false;
+        if (!_page->value_bounds(offset, &group_end, &lower, &upper, &has_null)) {
+            break;
+        }
+        ZoneMapDetail detail(Datum(lower), Datum(upper), has_null);
+        for (const auto* pred : predicates) {
+            if (!pred->zone_map_filter(detail)) {
+                pruned.add(Range<>(page_begin + offset, page_begin + group_end));
+                break;
+            }
+        }
+        offset = group_end;
+    }
+    if (pruned.empty()) {
+        return;
+    }
+
+    SparseRange<> kept;
+    rowid_t kept_begin = range->begin();
+    for (size_t i = 0; i < pruned.size(); i++) {
+        if (pruned[i].begin() > kept_begin) {
+            kept.add(Range<>(kept_begin, pruned[i].begin()));
+        }
+        kept_begin = std::max(kept_begin, pruned[i].end());
+    }
+    if (kept_begin < range->end()) {
+        kept.add(Range<>(kept_begin, range->end()));
+    }
+    *range &= kept;
+}
+
 int ScalarColumnIterator::dict_lookup(const Slice& word) {
     DCHECK(all_page_dict_encoded());
     return (this->*_dict_lookup_func)(word);
@@ -72,6 +72,9 @@ public:
     [[nodiscard]] Status get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
                                                         SparseRange<>* range) override;
 
+    void prune_range_by_page_bounds(const std::vector<const ColumnPredicate*>& predicates,
+                                    SparseRange<>* range) override;
+
     bool all_page_dict_encoded() const override { return _all_dict_encoded; }
 
     [[nodiscard]] Status fetch_all_dict_words(std::vector<Slice>* words) const override;
@@ -105,6 +108,9 @@ private:
     Status _load_next_page(bool* eos);
     Status _read_data_page(const OrdinalPageIndexIterator& iter);
 
+    template <LogicalType Type>
+    void _do_prune_range_by_page_bounds(const std::vector<const ColumnPredicate*>& predicates, SparseRange<>* range);
+
     template <LogicalType Type>
     int _do_dict_lookup(const Slice& word);
 
@@ -275,6 +275,10 @@ StatusOr<ChunkIteratorPtr> Segment::_new_iterator(const Schema& schema, const Se
             if (_column_readers.count(column_unique_id) < 1 || !_column_readers.at(column_unique_id)->has_zone_map()) {
                 continue;
             }
+            // The zone map of a column written before its type was changed is of the old type.
+            if (_column_readers.at(column_unique_id)->column_type() != tablet_column.type()) {
+                continue;
+            }
             if (!_column_readers.at(column_unique_id)->segment_zone_map_filter(pair.second)) {
                 // skip segment zonemap filter when this segment has column files link to it.
                 if (tablet_column.is_key() || _use_segment_zone_map_filter(read_options)) {
@@ -438,6 +442,15 @@ Status Segment::new_bitmap_index_iterator(ColumnUID id, const IndexReadOptions&
     return Status::OK();
 }
 
+Status Segment::vector_search(ColumnUID id, const IndexReadOptions& options, const VectorSearchOption& option,
+                              const roaring::Roaring& filter, roaring::Roaring* result) {
+    auto iter = _column_readers.find(id);
+    if (iter == _column_readers.end() || !iter->second->has_vector_index()) {
+        return Status::NotFound(fmt::format("no vector index of column {}", id));
+    }
+    return iter->second->vector_search(options, option, filter, result);
+}
+
 StatusOr<std::shared_ptr<Segment>> Segment::new_dcg_segment(const DeltaColumnGroup& dcg, uint32_t idx,
                                                             const TabletSchemaCSPtr& read_tablet_schema) {
     std::shared_ptr<TabletSchema> tablet_schema;
@@ -44,6 +44,7 @@
 #include "gen_cpp/olap_file.pb.h"
 #include "gen_cpp/segment.pb.h"
 #include "gutil/macros.h"
+#include "roaring/roaring.hh"
 #include "storage/delta_column_group.h"
 #include "storage/inverted/inverted_index_iterator.h"
 #include "storage/rowset/page_handle.h"
@@ -64,6 +65,7 @@ class IndexReadOptions;
 class Schema;
 class SegmentIterator;
 class SegmentReadOptions;
+struct VectorSearchOption;
 
 class BitmapIndexIterator;
 class ColumnReader;
@@ -144,6 +146,11 @@ public:
 
     Status new_bitmap_index_iterator(ColumnUID id, const IndexReadOptions& options, BitmapIndexIterator** iter);
 
+    // Search the vector index of column |id| for the candidates of |option| among |filter|.
+    // Return NotFound if the column has no vector index.
+    Status vector_search(ColumnUID id, const IndexReadOptions& options, const VectorSearchOption& option,
+                         const roaring::Roaring& filter, roaring::Roaring* result);
+
     size_t num_short_keys() const { return _tablet_schema->num_short_key_columns(); }
 
     uint32_t num_rows_per_block() const {
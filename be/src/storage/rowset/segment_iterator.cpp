@@ -16,12 +16,16 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
+#include <sstream>
 #include <stack>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "column/datum_convert.h"
 #include "column/datum_tuple.h"
 #include "common/config.h"
 #include "common/status.h"
@@ -30,6 +34,7 @@
 #include "gutil/casts.h"
 #include "gutil/stl_util.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/exec_env.h"
 #include "segment_options.h"
 #include "simd/simd.h"
 #include "storage/chunk_helper.h"
@@ -39,6 +44,7 @@
 #include "storage/column_predicate.h"
 #include "storage/column_predicate_rewriter.h"
 #include "storage/del_vector.h"
+#include "storage/delete_predicate_bitmap_cache.h"
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/lake/update_manager.h"
 #include "storage/olap_runtime_range_pruner.hpp"
@@ -60,6 +66,7 @@
 #include "storage/update_manager.h"
 #include "types/array_type_info.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks {
@@ -200,8 +207,14 @@ private:
 
     Status _init();
     Status _try_to_update_ranges_by_runtime_filter();
+    // Prune _scan_range by the zone maps with the runtime filters that have arrived before the segment is opened,
+    // so that the pruned pages are not read by the later index stages and IO coalescing.
+    Status _get_row_ranges_by_runtime_filter();
+    Status _get_row_ranges_by_runtime_predicates(int cid, const PredicateList& predicates, SparseRange<>* range);
     Status _do_get_next(Chunk* result, vector<rowid_t>* rowid);
 
+    void _adapt_chunk_rows_limit(const Chunk& chunk);
+
     template <bool check_global_dict>
     Status _init_column_iterators(const Schema& schema);
     Status _get_row_ranges_by_keys();
@@ -259,19 +272,28 @@ private:
 
     Status _apply_del_vector();
 
+    Status _apply_delete_predicate_bitmap();
+
+    Status _build_delete_predicate_bitmap(Roaring* deleted);
+
     Status _init_inverted_index_iterators();
 
     Status _apply_inverted_index();
 
+    Status _apply_vector_index();
+
     Status _read(Chunk* chunk, vector<rowid_t>* rowid, size_t n);
+    Status _prune_range_by_page_bounds(SparseRange<>* range);
+    Status _prefetch_columns(size_t n);
+    Status _set_io_coalesce_ranges();
 
     void _init_column_access_paths();
 
     // search delta column group by column uniqueid, if this column exist in delta column group,
     // then return column iterator and delta column's fillname.
     // Or just return null
-    StatusOr<std::unique_ptr<ColumnIterator>> _new_dcg_column_iterator(uint32_t ucid, std::string* filename,
-                                                                       ColumnAccessPath* path);
+    StatusOr<std::unique_ptr<ColumnIterator>> _new_dcg_column_iterator(uint32_t ucid, const TabletColumn& column,
+                                                                       std::string* filename, ColumnAccessPath* path);
 
     // This function is a unified entry for creating column iterators.
     // `ucid` means unique column id, use it for searching delta column group.
@@ -303,7 +325,9 @@ private:
     DeltaColumnGroupList _dcgs;
     roaring::api::roaring_uint32_iterator_t _roaring_iter;
 
-    std::unordered_map<ColumnId, std::unique_ptr<io::SeekableInputStream>> _column_files;
+    std::unordered_map<ColumnId, std::shared_ptr<io::SeekableInputStream>> _column_files;
+    // The coalesced stream of the segment file, shared by the columns in |_io_coalesce_column_index|.
+    std::shared_ptr<io::SharedBufferedInputStream> _shared_buffered_stream;
 
     SparseRange<> _scan_range;
     SparseRangeIterator<> _range_iter;
@@ -339,6 +363,9 @@ private:
     int _late_materialization_ratio = 0;
 
     int _reserve_chunk_size = 0;
+    // The max rows read into a chunk, it's less than |_reserve_chunk_size| for wide rows so that a chunk doesn't
+    // grow far beyond ChunkHelper::target_chunk_bytes(). 0 means it's not sampled yet.
+    uint32_t _chunk_rows_limit = 0;
 
     bool _inited = false;
     bool _has_bitmap_index = false;
@@ -442,11 +469,14 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_get_row_ranges_by_rowid_range());
     RETURN_IF_ERROR(_get_row_ranges_by_keys());
     RETURN_IF_ERROR(_apply_del_vector());
+    RETURN_IF_ERROR(_apply_delete_predicate_bitmap());
     // Support prefilter for now
     RETURN_IF_ERROR(_apply_bitmap_index());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
+    RETURN_IF_ERROR(_get_row_ranges_by_runtime_filter());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
     RETURN_IF_ERROR(_apply_inverted_index());
+    RETURN_IF_ERROR(_apply_vector_index());
     // rewrite stage
     // Rewriting predicates using segment dictionary codes
     RETURN_IF_ERROR(_rewrite_predicates());
@@ -460,22 +490,53 @@ Status SegmentIterator::_init() {
 
     _range_iter = _scan_range.new_iterator();
 
+    RETURN_IF_ERROR(_set_io_coalesce_ranges());
+
+    return Status::OK();
+}
+
+// Plan the reads of all the coalesced columns together, so that the pages of small columns close
+// to each other in the segment file are fetched by one read instead of one read per column.
+Status SegmentIterator::_set_io_coalesce_ranges() {
+    if (_shared_buffered_stream == nullptr) {
+        return Status::OK();
+    }
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
     for (auto column_index : _io_coalesce_column_index) {
-        RETURN_IF_ERROR(_column_iterators[column_index]->convert_sparse_range_to_io_range(_scan_range));
+        RETURN_IF_ERROR(_column_iterators[column_index]->get_io_ranges(_scan_range, &ranges));
     }
+    return _shared_buffered_stream->set_io_ranges(ranges);
+}
 
-    return Status::OK();
+Status SegmentIterator::_get_row_ranges_by_runtime_predicates(int cid, const PredicateList& predicates,
+                                                              SparseRange<>* range) {
+    const ColumnPredicate* del_pred;
+    auto iter = _del_predicates.find(cid);
+    del_pred = iter != _del_predicates.end() ? &(iter->second) : nullptr;
+    return _column_iterators[cid]->get_row_ranges_by_zone_map(predicates, del_pred, range);
+}
+
+Status SegmentIterator::_get_row_ranges_by_runtime_filter() {
+    RETURN_IF(_scan_range.empty(), Status::OK());
+    return _opts.runtime_range_pruner.update_range_if_arrived(
+            _opts.global_dictmaps,
+            [this](auto cid, const PredicateList& predicates) {
+                SparseRange<> r;
+                RETURN_IF_ERROR(_get_row_ranges_by_runtime_predicates(cid, predicates, &r));
+                size_t prev_size = _scan_range.span_size();
+                _scan_range = _scan_range.intersection(r);
+                _opts.stats->runtime_stats_filtered += (prev_size - _scan_range.span_size());
+                return Status::OK();
+            },
+            _opts.stats->raw_rows_read);
 }
 
 Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
     return _opts.runtime_range_pruner.update_range_if_arrived(
             _opts.global_dictmaps,
             [this](auto cid, const PredicateList& predicates) {
-                const ColumnPredicate* del_pred;
-                auto iter = _del_predicates.find(cid);
-                del_pred = iter != _del_predicates.end() ? &(iter->second) : nullptr;
                 SparseRange<> r;
-                RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(predicates, del_pred, &r));
+                RETURN_IF_ERROR(_get_row_ranges_by_runtime_predicates(cid, predicates, &r));
                 size_t prev_size = _scan_range.span_size();
                 SparseRange<> res;
                 res.set_sorted(_scan_range.is_sorted());
@@ -507,6 +568,7 @@ StatusOr<std::shared_ptr<Segment>> SegmentIterator::_get_dcg_segment(uint32_t uc
 }
 
 StatusOr<std::unique_ptr<ColumnIterator>> SegmentIterator::_new_dcg_column_iterator(uint32_t ucid,
+                                                                                    const TabletColumn& column,
                                                                                     std::string* filename,
                                                                                     ColumnAccessPath* path) {
     // build column iter from delta column group
@@ -515,6 +577,10 @@ StatusOr<std::unique_ptr<ColumnIterator>> SegmentIterator::_new_dcg_column_itera
         if (filename != nullptr) {
             *filename = dcg_segment->file_name();
         }
+        if (static_cast<uint32_t>(column.unique_id()) == ucid) {
+            // The column file may be written before a lazy schema change of the column type.
+            return dcg_segment->new_column_iterator_or_default(column, path);
+        }
         return dcg_segment->new_column_iterator(ucid, path);
     }
     return nullptr;
@@ -557,27 +623,33 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
         LOG(ERROR) << "invalid unique columnid in segment iterator, ucid: " << ucid
                    << ", segment: " << _segment->file_name();
     }
-    ASSIGN_OR_RETURN(auto col_iter, _new_dcg_column_iterator((uint32_t)ucid, &dcg_filename, access_path));
+    auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
+    const auto& col = tablet_schema->column(cid);
+    ASSIGN_OR_RETURN(auto col_iter, _new_dcg_column_iterator((uint32_t)ucid, col, &dcg_filename, access_path));
     if (col_iter == nullptr) {
         // not found in delta column group, create normal column iterator
-        auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
-        const auto& col = tablet_schema->column(cid);
         ASSIGN_OR_RETURN(_column_iterators[cid], _segment->new_column_iterator_or_default(col, access_path));
-        ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
-        if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
-            _segment->lake_tablet_manager() != nullptr) {
-            ASSIGN_OR_RETURN(auto file_size, _segment->get_data_size());
-            auto shared_buffered_input_stream =
-                    std::make_unique<io::SharedBufferedInputStream>(rfile->stream(), _segment->file_name(), file_size);
-            auto options = io::SharedBufferedInputStream::CoalesceOptions{
-                    .max_dist_size = config::io_coalesce_read_max_distance_size,
-                    .max_buffer_size = config::io_coalesce_read_max_buffer_size};
-            shared_buffered_input_stream->set_coalesce_options(options);
-            iter_opts.read_file = shared_buffered_input_stream.get();
-            iter_opts.is_io_coalesce = true;
-            _column_files[cid] = std::move(shared_buffered_input_stream);
+        bool io_coalesce = _segment->lake_tablet_manager() != nullptr ? config::io_coalesce_lake_read_enable
+                                                                       : config::io_coalesce_local_read_enable;
+        if (io_coalesce && !_segment->is_default_column(col)) {
+            if (_shared_buffered_stream == nullptr) {
+                ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
+                ASSIGN_OR_RETURN(auto file_size, _segment->get_data_size());
+                _shared_buffered_stream = std::make_shared<io::SharedBufferedInputStream>(
+                        rfile->stream(), _segment->file_name(), file_size);
+                auto options = io::SharedBufferedInputStream::CoalesceOptions{
+                        .max_dist_size = config::io_coalesce_read_max_distance_size,
+                        .max_buffer_size = config::io_coalesce_read_max_buffer_size};
+                _shared_buffered_stream->set_coalesce_options(options);
+                if (config::io_coalesce_lake_read_prefetch_enable) {
+                    _shared_buffered_stream->set_prefetch_pool(ExecEnv::GetInstance()->lake_read_prefetch_pool());
+                }
+            }
+            iter_opts.read_file = _shared_buffered_stream.get();
+            _column_files[cid] = _shared_buffered_stream;
             _io_coalesce_column_index.emplace_back(cid);
         } else {
+            ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
             iter_opts.read_file = rfile.get();
             _column_files[cid] = std::move(rfile);
         }
@@ -629,6 +701,12 @@ Status SegmentIterator::_init_column_iterators(const Schema& schema) {
                 _column_decoders[cid].set_all_page_dict_encoded(_column_iterators[cid]->all_page_dict_encoded());
                 if (_opts.global_dictmaps->count(cid)) {
                     _column_decoders[cid].set_global_dict(_opts.global_dictmaps->find(cid)->second);
+                    if (_opts.global_dict_versions != nullptr) {
+                        if (auto iter = _opts.global_dict_versions->find(cid);
+                            iter != _opts.global_dict_versions->end()) {
+                            _column_decoders[cid].set_global_dict_version(iter->second);
+                        }
+                    }
                     _column_decoders[cid].check_global_dict();
                 }
             }
@@ -990,6 +1068,52 @@ Status SegmentIterator::_read_columns(const Schema& schema, Chunk* chunk, size_t
     return Status::OK();
 }
 
+// Drop the rows whose predicate columns are known to mismatch by the value bounds of their
+// encoded pages, so that no column of them is decoded.
+Status SegmentIterator::_prune_range_by_page_bounds(SparseRange<>* range) {
+    if (!config::enable_index_page_bounds_filter || _cid_to_predicates.empty()) {
+        return Status::OK();
+    }
+    const rowid_t begin = range->begin();
+    const size_t prev_size = range->span_size();
+    for (const auto& [cid, preds] : _cid_to_predicates) {
+        if (_column_iterators[cid] == nullptr) {
+            continue;
+        }
+        _column_iterators[cid]->prune_range_by_page_bounds(preds, range);
+        if (range->empty()) {
+            break;
+        }
+    }
+    _opts.stats->rows_stats_filtered += (prev_size - range->span_size());
+    if (!range->empty() && range->begin() != begin) {
+        // The columns were seeked to |begin|, seek them to the first row left.
+        _cur_rowid = range->begin();
+        _opts.stats->block_seek_num += 1;
+        SCOPED_RAW_TIMER(&_opts.stats->block_seek_ns);
+        RETURN_IF_ERROR(_context->seek_columns(_cur_rowid));
+    }
+    return Status::OK();
+}
+
+// Read the pages of the coalesced columns for the next chunks ahead, so that the I/O of them
+// overlaps with the decoding of the current ones.
+Status SegmentIterator::_prefetch_columns(size_t n) {
+    if (_io_coalesce_column_index.empty() || !config::io_coalesce_lake_read_prefetch_enable) {
+        return Status::OK();
+    }
+    SparseRange<> ahead;
+    SparseRangeIterator<> iter = _range_iter;
+    iter.next_range(n * std::max(config::io_coalesce_lake_read_prefetch_chunks, 1), &ahead);
+    if (ahead.empty()) {
+        return Status::OK();
+    }
+    for (auto column_index : _io_coalesce_column_index) {
+        RETURN_IF_ERROR(_column_iterators[column_index]->prefetch_range(ahead));
+    }
+    return Status::OK();
+}
+
 inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size_t n) {
     size_t read_num = 0;
     SparseRange<> range;
@@ -1002,7 +1126,12 @@ inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size
     }
 
     _range_iter.next_range(n, &range);
+    RETURN_IF_ERROR(_prefetch_columns(n));
+    RETURN_IF_ERROR(_prune_range_by_page_bounds(&range));
     read_num += range.span_size();
+    if (range.empty()) {
+        return Status::OK();
+    }
 
     {
         _opts.stats->blocks_load += 1;
@@ -1092,7 +1221,7 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
     MonotonicStopWatch sw;
     sw.start();
 
-    const uint32_t chunk_capacity = _reserve_chunk_size;
+    const uint32_t chunk_capacity = _chunk_rows_limit > 0 ? _chunk_rows_limit : _reserve_chunk_size;
     const uint32_t return_chunk_threshold = std::max<uint32_t>(chunk_capacity - chunk_capacity / 4, 1);
     const bool has_predicate = !_cid_to_predicates.empty();
     const bool scan_range_normalized = _scan_range.is_sorted();
@@ -1135,9 +1264,16 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
         // Return directly if chunk_start is zero, i.e, chunk is empty.
         // Otherwise, chunk will be swapped with result, which is incorrect
         // because the chunk is a pointer to _read_chunk instead of _final_chunk.
+        if (_shared_buffered_stream != nullptr) {
+            _shared_buffered_stream->release();
+        }
         return Status::EndOfFile("no more data in segment");
     }
 
+    if (UNLIKELY(_chunk_rows_limit == 0)) {
+        _adapt_chunk_rows_limit(*chunk);
+    }
+
     if (_context->_has_dict_column) {
         chunk = _context->_dict_chunk.get();
         SCOPED_RAW_TIMER(&_opts.stats->decode_dict_ns);
@@ -1201,6 +1337,22 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
     return Status::OK();
 }
 
+// Sample the row width on the first chunk read, and read fewer rows per chunk if the rows are so wide that
+// a chunk of |_reserve_chunk_size| rows exceeds the target bytes. The buffers are still reserved with
+// |_reserve_chunk_size| rows, the chunk is never larger than it.
+void SegmentIterator::_adapt_chunk_rows_limit(const Chunk& chunk) {
+    // Don't cut the chunks too small, or the per-chunk overhead dominates.
+    constexpr uint32_t kMinChunkRowsLimit = 256;
+    _chunk_rows_limit = _reserve_chunk_size;
+    const size_t target_bytes = ChunkHelper::target_chunk_bytes();
+    if (target_bytes == 0 || chunk.num_rows() == 0) {
+        return;
+    }
+    const size_t row_bytes = std::max<size_t>(chunk.bytes_usage() / chunk.num_rows(), 1);
+    const size_t rows = std::max<size_t>(target_bytes / row_bytes, kMinChunkRowsLimit);
+    _chunk_rows_limit = std::min<size_t>(rows, _reserve_chunk_size);
+}
+
 Status SegmentIterator::_switch_context(ScanContext* to) {
     if (_context != nullptr) {
         const ordinal_t ordinal = _context->_column_iterators[0]->get_current_ordinal();
@@ -1906,6 +2058,116 @@ Status SegmentIterator::_apply_del_vector() {
     return Status::OK();
 }
 
+// The key of the rows of |segment| deleted by |delete_predicates| in DeletePredicateBitmapCache. The predicates are
+// identified by the unique ids of their columns, their types and their operands, so the key is independent of the
+// column ids of the read schema. Return an empty string if any predicate cannot be identified.
+static std::string delete_predicate_bitmap_key(const Segment& segment, const TabletSchema& tablet_schema,
+                                               DisjunctivePredicates& delete_predicates) {
+    std::stringstream ss;
+    ss << segment.file_name() << ':' << segment.num_rows();
+    for (auto& conjunct_predicate : delete_predicates.predicate_list()) {
+        ss << '|';
+        for (auto* preds : {&conjunct_predicate.vec_preds(), &conjunct_predicate.non_vec_preds()}) {
+            for (const ColumnPredicate* pred : *preds) {
+                const PredicateType type = pred->type();
+                if (type < PredicateType::kEQ || type > PredicateType::kNotNull) {
+                    return {};
+                }
+                ss << tablet_schema.column(pred->column_id()).unique_id() << ':' << static_cast<int>(type);
+                for (const Datum& value : pred->values()) {
+                    if (value.is_null()) {
+                        ss << ",N";
+                    } else {
+                        auto str = datum_to_string(const_cast<TypeInfo*>(pred->type_info()), value);
+                        ss << ",V" << str.size() << ':' << str;
+                    }
+                }
+                ss << ';';
+            }
+        }
+    }
+    return ss.str();
+}
+
+Status SegmentIterator::_build_delete_predicate_bitmap(Roaring* deleted) {
+    auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
+    std::set<ColumnId> delete_columns;
+    _opts.delete_predicates.get_column_ids(&delete_columns);
+    Schema schema;
+    for (ColumnId cid : delete_columns) {
+        auto f = ChunkHelper::convert_field(cid, tablet_schema->column(cid));
+        schema.append(std::make_shared<Field>(std::move(f)));
+    }
+
+    // Read the columns of the delete predicates of the whole segment, regardless of the ranges of this iterator.
+    SegmentReadOptions opts;
+    opts.fs = _opts.fs;
+    opts.stats = _opts.stats;
+    opts.use_page_cache = _opts.use_page_cache;
+    opts.lake_io_opts = _opts.lake_io_opts;
+    opts.reader_type = _opts.reader_type;
+    opts.chunk_size = _opts.chunk_size;
+    opts.tablet_id = _opts.tablet_id;
+    opts.rowsetid = _opts.rowsetid;
+    opts.rowset_path = _opts.rowset_path;
+    opts.tablet_schema = tablet_schema;
+    opts.is_cancelled = _opts.is_cancelled;
+    auto res = _segment->new_iterator(schema, opts);
+    if (res.status().is_end_of_file()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(res.status());
+    auto iter = std::move(res).value();
+    DeferOp close_iter([&] { iter->close(); });
+
+    auto chunk = ChunkHelper::new_chunk(schema, _opts.chunk_size);
+    std::vector<rowid_t> rowids;
+    std::vector<uint8_t> selection;
+    while (true) {
+        chunk->reset();
+        rowids.clear();
+        Status st = iter->get_next(chunk.get(), &rowids);
+        if (st.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        selection.resize(chunk->num_rows());
+        RETURN_IF_ERROR(_opts.delete_predicates.evaluate(chunk.get(), selection.data()));
+        for (size_t i = 0; i < rowids.size(); i++) {
+            if (selection[i]) {
+                deleted->add(rowids[i]);
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status SegmentIterator::_apply_delete_predicate_bitmap() {
+    RETURN_IF(_opts.delete_predicates.empty() || _opts.is_primary_keys || !is_query(_opts.reader_type), Status::OK());
+    // The columns of the delete predicates may be updated by the delta column groups.
+    RETURN_IF(!_dcgs.empty(), Status::OK());
+    auto* cache = DeletePredicateBitmapCache::instance();
+    RETURN_IF(!cache->enabled(), Status::OK());
+
+    auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
+    const std::string key = delete_predicate_bitmap_key(*_segment, *tablet_schema, _opts.delete_predicates);
+    RETURN_IF(key.empty(), Status::OK());
+
+    SCOPED_RAW_TIMER(&_opts.stats->del_filter_ns);
+    auto build = [this](Roaring* deleted) { return _build_delete_predicate_bitmap(deleted); };
+    ASSIGN_OR_RETURN(auto deleted, cache->get_or_build(key, build));
+    if (!_scan_range.empty() && !deleted->isEmpty()) {
+        Roaring row_bitmap = range2roaring(_scan_range);
+        const size_t input_rows = row_bitmap.cardinality();
+        row_bitmap -= *deleted;
+        _scan_range = roaring2range(row_bitmap);
+        _opts.stats->rows_del_filtered += input_rows - row_bitmap.cardinality();
+    }
+    // The deleted rows have been excluded from the scan range, the predicates are not evaluated any more.
+    _opts.delete_predicates = DisjunctivePredicates();
+    return Status::OK();
+}
+
 Status SegmentIterator::_init_inverted_index_iterators() {
     _inverted_index_iterators.resize(ChunkHelper::max_column_id(_schema) + 1, nullptr);
     std::unordered_map<ColumnId, ColumnUID> cid_2_ucid;
@@ -1983,6 +2245,48 @@ Status SegmentIterator::_apply_inverted_index() {
     return Status::OK();
 }
 
+Status SegmentIterator::_apply_vector_index() {
+    RETURN_IF(_opts.vector_search == nullptr || _scan_range.empty(), Status::OK());
+    // The nearest rows of the index are only the nearest rows of the scan if no predicate filters the rows
+    // after the index stage, the rows filtered before are excluded from the search.
+    RETURN_IF(!_opts.pred_tree.empty() || !_opts.delete_predicates.empty(), Status::OK());
+    const VectorSearchOption& option = *_opts.vector_search;
+    RETURN_IF(_scan_range.span_size() <= option.k, Status::OK());
+
+    const ColumnUID ucid = option.column_uid;
+    std::optional<ColumnId> cid;
+    for (const auto& field : _schema.fields()) {
+        if (field->uid() == ucid) {
+            cid = field->id();
+            break;
+        }
+    }
+    RETURN_IF(!cid.has_value(), Status::OK());
+    // The index of the segment does not cover the column rewritten by a delta column group.
+    ASSIGN_OR_RETURN(auto dcg_segment, _get_dcg_segment(ucid));
+    RETURN_IF(dcg_segment != nullptr, Status::OK());
+    SCOPED_RAW_TIMER(&_opts.stats->vector_index_filter_ns);
+
+    IndexReadOptions opts;
+    opts.use_page_cache = false;
+    opts.lake_io_opts = _opts.lake_io_opts;
+    opts.read_file = _column_files[*cid].get();
+    opts.stats = _opts.stats;
+
+    roaring::Roaring row_bitmap = range2roaring(_scan_range);
+    roaring::Roaring candidates;
+    Status st = _segment->vector_search(ucid, opts, option, row_bitmap, &candidates);
+    if (st.is_not_found() || st.is_not_supported()) {
+        // Segments written before the index is created, or an index built with another metric.
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(st);
+    DCHECK_LE(candidates.cardinality(), row_bitmap.cardinality());
+    _opts.stats->rows_vector_index_filtered += row_bitmap.cardinality() - candidates.cardinality();
+    _scan_range = roaring2range(candidates);
+    return Status::OK();
+}
+
 Status SegmentIterator::_get_row_ranges_by_bloom_filter() {
     RETURN_IF(!config::enable_index_bloom_filter, Status::OK());
     RETURN_IF(_scan_range.empty(), Status::OK());
@@ -2095,11 +2399,15 @@ void SegmentIterator::close() {
     _dcg_segments.clear();
     _column_decoders.clear();
 
+    std::unordered_set<io::SeekableInputStream*> updated_files;
     for (auto& [cid, rfile] : _column_files) {
-        // update statistics before reset column file
-        _update_stats(rfile.get());
+        // update statistics before reset column file, once for the file shared by columns
+        if (updated_files.insert(rfile.get()).second) {
+            _update_stats(rfile.get());
+        }
         rfile.reset();
     }
+    _shared_buffered_stream.reset();
 
     STLClearObject(&_selection);
     STLClearObject(&_selected_idx);
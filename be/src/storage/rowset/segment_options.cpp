@@ -65,6 +65,7 @@ Status SegmentReadOptions::convert_to(SegmentReadOptions* dst, const std::vector
     dst->use_page_cache = use_page_cache;
     dst->profile = profile;
     dst->global_dictmaps = global_dictmaps;
+    dst->global_dict_versions = global_dict_versions;
     dst->rowid_range_option = rowid_range_option;
     dst->short_key_ranges = short_key_ranges;
     dst->is_first_split_of_segment = is_first_split_of_segment;
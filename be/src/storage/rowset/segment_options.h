@@ -28,6 +28,7 @@
 #include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/seek_range.h"
 #include "storage/tablet_schema.h"
+#include "storage/vector_search_option.h"
 
 namespace starrocks {
 class Condition;
@@ -79,6 +80,7 @@ public:
     int chunk_size = DEFAULT_CHUNK_SIZE;
 
     const ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
+    const ColumnIdToGlobalDictVersion* global_dict_versions = nullptr;
     const std::unordered_set<uint32_t>* unused_output_column_ids = nullptr;
 
     bool has_delete_pred = false;
@@ -103,6 +105,8 @@ public:
 
     bool prune_column_after_index_filter = false;
 
+    VectorSearchOptionPtr vector_search;
+
 public:
     Status convert_to(SegmentReadOptions* dst, const std::vector<LogicalType>& new_types, ObjectPool* obj_pool) const;
 
@@ -48,6 +48,7 @@
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
+#include "storage/rowset/encoding_info.h"
 #include "storage/rowset/page_io.h"
 #include "storage/seek_tuple.h"
 #include "storage/short_key_index.h"
@@ -154,6 +155,11 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         } else {
             _init_column_meta(opts.meta, column_index, column);
         }
+        if (auto iter = _opts.column_encodings.find(column.unique_id()); iter != _opts.column_encodings.end()) {
+            const EncodingInfo* encoding_info = nullptr;
+            RETURN_IF_ERROR(EncodingInfo::get(column.type(), iter->second, &encoding_info));
+            opts.meta->set_encoding(iter->second);
+        }
 
         // now we create zone map for key columns
         // and not support zone map for array type.
@@ -170,6 +176,7 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         opts.need_bloom_filter = column.is_bf_column();
         opts.need_bitmap_index = column.has_bitmap_index();
         opts.need_inverted_index = _tablet_schema->has_index(column.unique_id(), GIN);
+        opts.need_vector_index = _tablet_schema->has_index(column.unique_id(), VECTOR);
 
         RETURN_IF_ERROR(_tablet_schema->get_indexes_for_column(column.unique_id(), &opts.tablet_index));
         if (opts.need_inverted_index) {
@@ -192,6 +199,7 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
             auto iter = _opts.global_dicts->find(column.name().data());
             if (iter != _opts.global_dicts->end()) {
                 opts.global_dict = &iter->second.dict;
+                opts.global_dict_version = iter->second.version;
                 _global_dict_columns_valid_info[iter->first] = true;
             }
         }
@@ -291,6 +299,7 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
         RETURN_IF_ERROR(column_writer->write_bitmap_index());
         RETURN_IF_ERROR(column_writer->write_bloom_filter_index());
         RETURN_IF_ERROR(column_writer->write_inverted_index());
+        RETURN_IF_ERROR(column_writer->write_vector_index());
         *index_size += _wfile->size() - index_offset;
 
         // check global dict valid
@@ -324,6 +333,25 @@ Status SegmentWriter::finalize_footer(uint64_t* segment_file_size, uint64_t* foo
     return _wfile->close();
 }
 
+void SegmentWriter::get_segment_zone_map(SegmentZoneMapPB* zone_maps) const {
+    for (const auto& column_meta : _footer.columns()) {
+        for (const auto& index_meta : column_meta.indexes()) {
+            if (index_meta.type() != ZONE_MAP_INDEX || !index_meta.zone_map_index().has_segment_zone_map()) {
+                continue;
+            }
+            const auto& zm = index_meta.zone_map_index().segment_zone_map();
+            auto* column_zm = zone_maps->add_columns();
+            column_zm->set_column_unique_id(column_meta.unique_id());
+            column_zm->set_has_null(zm.has_null());
+            column_zm->set_has_not_null(zm.has_not_null());
+            if (zm.has_not_null()) {
+                column_zm->set_min(zm.min());
+                column_zm->set_max(zm.max());
+            }
+        }
+    }
+}
+
 Status SegmentWriter::_write_short_key_index() {
     std::vector<Slice> body;
     PageFooterPB footer;
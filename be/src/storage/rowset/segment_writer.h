@@ -37,9 +37,11 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
+#include "gen_cpp/olap_file.pb.h"
 #include "gen_cpp/segment.pb.h"
 #include "gutil/macros.h"
 #include "runtime/global_dict/types.h"
@@ -76,6 +78,10 @@ struct SegmentWriterOptions {
     GlobalDictByNameMaps* global_dicts = nullptr;
     std::vector<int32_t> referenced_column_ids;
     SegmentFileMark segment_file_mark;
+    // Force the encoding of top-level columns, keyed by column unique id. Columns not listed here use
+    // DEFAULT_ENCODING, and string/numeric columns keep speculating between dictionary and plain encoding.
+    // Mainly used by benchmarks and tests to compare the encodings on the same data.
+    std::unordered_map<int32_t, EncodingTypePB> column_encodings;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
@@ -143,6 +149,10 @@ public:
 
     uint64_t current_filesz() const;
 
+    // Fill |zone_maps| with the segment-level zone maps of the columns which have a zone map index.
+    // Must be called after the footer is finalized.
+    void get_segment_zone_map(SegmentZoneMapPB* zone_maps) const;
+
 private:
     Status _write_short_key_index();
     Status _write_footer();
@@ -133,6 +133,7 @@ DataDecoder* DataDecoder::get_data_decoder(EncodingTypePB encoding) {
         return &g_binary_dict_decoder;
     }
     case FOR_ENCODING:
+    case ALP_ENCODING:
     case PLAIN_ENCODING:
     case PREFIX_ENCODING:
     case RLE: {
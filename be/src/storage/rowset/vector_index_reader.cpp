@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/vector_index_reader.h"
+
+#include "fmt/format.h"
+#include "storage/rowset/page_io.h"
+#include "storage/vector_search_option.h"
+
+namespace starrocks {
+
+StatusOr<bool> VectorIndexReader::load(const IndexReadOptions& opts, const VectorIndexPB& meta) {
+    return success_once(_load_once, [&]() {
+        Status st = _do_load(opts, meta);
+        if (!st.ok()) {
+            _index.reset();
+            _indexed_rows = roaring::Roaring();
+        }
+        return st;
+    });
+}
+
+Status VectorIndexReader::_do_load(const IndexReadOptions& opts, const VectorIndexPB& meta) {
+    PageReadOptions page_opts;
+    page_opts.read_file = opts.read_file;
+    page_opts.page_pointer = PagePointer(meta.graph_page());
+    page_opts.codec = nullptr;
+    page_opts.stats = opts.stats;
+    // The graph is kept deserialized by the reader.
+    page_opts.use_page_cache = false;
+
+    PageHandle handle;
+    Slice body;
+    PageFooterPB footer;
+    RETURN_IF_ERROR(PageIO::read_and_decompress_page(page_opts, &handle, &body, &footer));
+    ASSIGN_OR_RETURN(_index, HnswIndex::deserialize(body));
+    if (_index->dim() != meta.dim() || _index->metric() != meta.metric() || _index->size() != meta.num_vectors()) {
+        return Status::Corruption(
+                fmt::format("vector index of {} does not match its meta", opts.read_file->filename()));
+    }
+    _indexed_rows.addMany(_index->rowids().size(), _index->rowids().data());
+    _indexed_rows.runOptimize();
+    return Status::OK();
+}
+
+Status VectorIndexReader::search(const VectorSearchOption& option, const roaring::Roaring& filter,
+                                 roaring::Roaring* result) const {
+    DCHECK(loaded());
+    if (option.metric != _index->metric()) {
+        return Status::NotSupported("vector index is built with another metric");
+    }
+    if (_index->size() > 0 && option.query_vector.size() != _index->dim()) {
+        return Status::InvalidArgument(fmt::format("query vector of dimension {} does not match the index of {}",
+                                                   option.query_vector.size(), _index->dim()));
+    }
+    const uint32_t ef = option.ef_search > 0 ? option.ef_search : HnswIndex::kDefaultEfSearch;
+    auto nearest = _index->search(option.query_vector.data(), option.k, ef, &filter);
+
+    *result = filter - _indexed_rows;
+    result->addMany(nearest.size(), nearest.data());
+    return Status::OK();
+}
+
+size_t VectorIndexReader::mem_usage() const {
+    size_t size = sizeof(VectorIndexReader);
+    if (_index != nullptr) {
+        size += _index->mem_usage() + _indexed_rows.getSizeInBytes();
+    }
+    return size;
+}
+
+} // namespace starrocks
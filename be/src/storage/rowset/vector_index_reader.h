@@ -0,0 +1,57 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "common/statusor.h"
+#include "gen_cpp/segment.pb.h"
+#include "roaring/roaring.hh"
+#include "storage/rowset/hnsw_index.h"
+#include "storage/rowset/options.h"
+#include "util/once.h"
+
+namespace starrocks {
+
+struct VectorSearchOption;
+
+class VectorIndexReader {
+public:
+    // Multiple callers may call this method concurrently, but only the first one
+    // can load the data, the others will wait until the first one finished loading
+    // data.
+    //
+    // Return true if the index data was successfully loaded by the caller, false if
+    // the data was loaded by another caller.
+    StatusOr<bool> load(const IndexReadOptions& opts, const VectorIndexPB& meta);
+
+    bool loaded() const { return invoked(_load_once); }
+
+    // Return the candidates among |filter| of the |option.k| nearest rows: the rows found by the index and the
+    // rows not indexed, whose distance is null.
+    // REQUIRES: the index data has been successfully `load()`ed into memory.
+    Status search(const VectorSearchOption& option, const roaring::Roaring& filter, roaring::Roaring* result) const;
+
+    size_t mem_usage() const;
+
+private:
+    Status _do_load(const IndexReadOptions& opts, const VectorIndexPB& meta);
+
+    OnceFlag _load_once;
+    std::unique_ptr<HnswIndex> _index;
+    roaring::Roaring _indexed_rows;
+};
+
+} // namespace starrocks
@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/vector_index_writer.h"
+
+#include "column/array_column.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "fmt/format.h"
+#include "gutil/strings/numbers.h"
+#include "storage/rowset/page_io.h"
+#include "storage/rowset/page_pointer.h"
+#include "storage/tablet_index.h"
+#include "storage/vector_search_option.h"
+
+namespace starrocks {
+
+static Status parse_uint32_property(const std::map<std::string, std::string>& properties, const char* name,
+                                    uint32_t min_value, uint32_t* value) {
+    auto it = properties.find(name);
+    if (it == properties.end()) {
+        return Status::OK();
+    }
+    if (!safe_strtou32(it->second, value) || *value < min_value) {
+        return Status::InvalidArgument(fmt::format("invalid vector index property {}: {}", name, it->second));
+    }
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<VectorIndexWriter>> VectorIndexWriter::create(const TabletIndex& tablet_index) {
+    const auto& properties = tablet_index.index_properties();
+    HnswIndex::Options opts;
+    RETURN_IF_ERROR(parse_uint32_property(properties, kDimProperty, 1, &opts.dim));
+    RETURN_IF_ERROR(parse_uint32_property(properties, kMProperty, 2, &opts.m));
+    RETURN_IF_ERROR(parse_uint32_property(properties, kEfConstructionProperty, 1, &opts.ef_construction));
+    if (auto it = properties.find(kMetricTypeProperty); it != properties.end()) {
+        ASSIGN_OR_RETURN(opts.metric, vector_metric_from_string(it->second));
+    }
+    return std::unique_ptr<VectorIndexWriter>(new VectorIndexWriter(opts));
+}
+
+Status VectorIndexWriter::append(const Column& column, rowid_t first_rowid) {
+    const ArrayColumn* array_column = nullptr;
+    const uint8_t* is_null = nullptr;
+    if (column.is_nullable()) {
+        const auto& nullable_column = down_cast<const NullableColumn&>(column);
+        array_column = down_cast<const ArrayColumn*>(nullable_column.data_column().get());
+        if (nullable_column.has_null()) {
+            is_null = nullable_column.null_column()->get_data().data();
+        }
+    } else {
+        array_column = down_cast<const ArrayColumn*>(&column);
+    }
+
+    const Column* elements = &array_column->elements();
+    if (elements->is_nullable()) {
+        if (elements->has_null()) {
+            return Status::InvalidArgument("vector index does not support null elements");
+        }
+        elements = down_cast<const NullableColumn*>(elements)->data_column().get();
+    }
+    const float* data = down_cast<const FloatColumn*>(elements)->get_data().data();
+    const auto& offsets = array_column->offsets().get_data();
+
+    for (size_t i = 0; i < array_column->size(); i++) {
+        const uint32_t dim = offsets[i + 1] - offsets[i];
+        if ((is_null != nullptr && is_null[i]) || dim == 0) {
+            continue;
+        }
+        if (_index == nullptr) {
+            if (_opts.dim == 0) {
+                _opts.dim = dim;
+            }
+            _index = std::make_unique<HnswIndex>(_opts);
+        }
+        if (dim != _opts.dim) {
+            return Status::InvalidArgument(
+                    fmt::format("vector index requires arrays of dimension {}, but got {}", _opts.dim, dim));
+        }
+        _index->add(first_rowid + i, data + offsets[i]);
+    }
+    return Status::OK();
+}
+
+Status VectorIndexWriter::finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) {
+    if (_index == nullptr) {
+        _index = std::make_unique<HnswIndex>(_opts);
+    }
+    std::string buf;
+    _index->serialize(&buf);
+
+    PageFooterPB footer;
+    footer.set_type(INDEX_PAGE);
+    footer.set_uncompressed_size(buf.size());
+    footer.mutable_index_page_footer()->set_num_entries(_index->size());
+    footer.mutable_index_page_footer()->set_type(IndexPageFooterPB::LEAF);
+    PagePointer pp;
+    RETURN_IF_ERROR(PageIO::write_page(wfile, {Slice(buf)}, footer, &pp));
+
+    index_meta->set_type(VECTOR_INDEX);
+    auto* meta = index_meta->mutable_vector_index();
+    meta->set_metric(_opts.metric);
+    meta->set_dim(_opts.dim);
+    meta->set_num_vectors(_index->size());
+    pp.to_proto(meta->mutable_graph_page());
+    _index.reset();
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,58 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "common/statusor.h"
+#include "gen_cpp/segment.pb.h"
+#include "storage/rowset/common.h"
+#include "storage/rowset/hnsw_index.h"
+
+namespace starrocks {
+
+class Column;
+class TabletIndex;
+class WritableFile;
+
+// VectorIndexWriter builds the HNSW graph of an ARRAY<FLOAT> column while the rows are appended and writes it
+// into a page of the segment file. Rows of null or empty arrays are not indexed, the other arrays must have
+// the same dimension.
+class VectorIndexWriter {
+public:
+    // index properties
+    static constexpr const char* kDimProperty = "dim";
+    static constexpr const char* kMetricTypeProperty = "metric_type";
+    static constexpr const char* kMProperty = "m";
+    static constexpr const char* kEfConstructionProperty = "ef_construction";
+
+    static StatusOr<std::unique_ptr<VectorIndexWriter>> create(const TabletIndex& tablet_index);
+
+    // Add the arrays of |column|, whose first row is |first_rowid| in the segment.
+    Status append(const Column& column, rowid_t first_rowid);
+
+    Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta);
+
+    uint64_t size() const { return _index == nullptr ? 0 : _index->mem_usage(); }
+
+private:
+    explicit VectorIndexWriter(const HnswIndex::Options& opts) : _opts(opts) {}
+
+    HnswIndex::Options _opts;
+    // Created by the first indexed row if the dimension is not given by the index properties.
+    std::unique_ptr<HnswIndex> _index;
+};
+
+} // namespace starrocks
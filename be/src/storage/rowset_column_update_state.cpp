@@ -14,6 +14,8 @@
 
 #include "rowset_column_update_state.h"
 
+#include <set>
+
 #include "common/tracer.h"
 #include "fs/fs_util.h"
 #include "gutil/strings/substitute.h"
@@ -27,6 +29,7 @@
 #include "storage/rowset/rowset_options.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/segment_rewriter.h"
+#include "storage/storage_engine.h"
 #include "storage/tablet.h"
 #include "storage/tablet_meta_manager.h"
 #include "storage/update_manager.h"
@@ -608,6 +611,76 @@ static std::vector<T> append_fixed_batch(const std::vector<T>& base_array, size_
     return new_array;
 }
 
+Status RowsetColumnUpdateState::_merge_delta_column_groups(Tablet* tablet, Rowset* rowset, uint32_t rssid,
+                                                           int64_t version,
+                                                           const std::vector<uint32_t>& unique_update_column_ids,
+                                                           int idx, OlapReaderStatistics* stats, MemTracker* tracker,
+                                                           std::vector<std::vector<uint32_t>>* dcg_column_ids,
+                                                           std::vector<std::string>* dcg_column_files) {
+    DeltaColumnGroupList dcgs;
+    RETURN_IF_ERROR(StorageEngine::instance()->update_manager()->get_delta_column_group(
+            tablet->data_dir()->get_meta(), TabletSegmentId(tablet->tablet_id(), rssid), version, &dcgs));
+    if (dcgs.size() < (size_t)config::partial_update_merge_delta_column_group_threshold) {
+        return Status::OK();
+    }
+    // collect the columns of the older delta column groups which are not overwritten by this update
+    const auto& tschema = rowset->schema();
+    std::set<uint32_t> visited_uids(unique_update_column_ids.begin(), unique_update_column_ids.end());
+    std::vector<int32_t> merge_column_ids;
+    std::vector<uint32_t> merge_column_uids;
+    std::vector<uint32_t> unique_merge_column_ids;
+    for (const auto& dcg : dcgs) {
+        for (const auto& column_ids : dcg->column_ids()) {
+            for (uint32_t uid : column_ids) {
+                if (!visited_uids.insert(uid).second) {
+                    continue;
+                }
+                auto cid = tschema->field_index(uid);
+                if (cid == -1) {
+                    // column has been dropped
+                    continue;
+                }
+                merge_column_ids.push_back(cid);
+                merge_column_uids.push_back((uint32_t)cid);
+                unique_merge_column_ids.push_back(uid);
+            }
+        }
+    }
+    ASSIGN_OR_RETURN(auto rowsetid_segid, _find_rowset_seg_id(rssid));
+    const std::string seg_path = Rowset::segment_file_path(rowset->rowset_path(), rowsetid_segid.unique_rowset_id,
+                                                           rowsetid_segid.segment_id);
+    const size_t BATCH_HANDLE_COLUMN_CNT = config::vertical_compaction_max_columns_per_group;
+    for (uint32_t col_index = 0; col_index < merge_column_ids.size(); col_index += BATCH_HANDLE_COLUMN_CNT) {
+        std::vector<int32_t> selective_merge_column_ids =
+                append_fixed_batch(merge_column_ids, col_index, BATCH_HANDLE_COLUMN_CNT);
+        std::vector<uint32_t> selective_merge_column_uids =
+                append_fixed_batch(merge_column_uids, col_index, BATCH_HANDLE_COLUMN_CNT);
+        std::vector<uint32_t> selective_unique_merge_column_ids =
+                append_fixed_batch(unique_merge_column_ids, col_index, BATCH_HANDLE_COLUMN_CNT);
+        auto partial_tschema = TabletSchema::create(tschema, selective_merge_column_ids);
+        Schema partial_schema = ChunkHelper::convert_schema(tschema, selective_merge_column_uids);
+        // the columns read at |version| have already been merged with all the delta column groups
+        ASSIGN_OR_RETURN(auto source_chunk_ptr, read_from_source_segment(rowset, partial_schema, tablet, stats,
+                                                                         version, rowsetid_segid, seg_path));
+        const size_t source_chunk_size = source_chunk_ptr->memory_usage();
+        tracker->consume(source_chunk_size);
+        DeferOp tracker_defer([&]() { tracker->release(source_chunk_size); });
+        uint64_t segment_file_size = 0;
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        padding_char_columns(partial_schema, partial_tschema, source_chunk_ptr.get());
+        ASSIGN_OR_RETURN(auto delta_column_group_writer,
+                         _prepare_delta_column_group_writer(rowset, partial_tschema, rssid, version + 1, idx++));
+        RETURN_IF_ERROR(delta_column_group_writer->append_chunk(*source_chunk_ptr));
+        RETURN_IF_ERROR(delta_column_group_writer->finalize(&segment_file_size, &index_size, &footer_position));
+        dcg_column_ids->push_back(selective_unique_merge_column_ids);
+        dcg_column_files->push_back(file_name(delta_column_group_writer->segment_path()));
+    }
+    VLOG(1) << "merge " << dcgs.size() << " delta column groups of tablet " << tablet->tablet_id() << " rssid "
+            << rssid << " into version " << version + 1 << ", merge column cnt: " << merge_column_ids.size();
+    return Status::OK();
+}
+
 Status RowsetColumnUpdateState::finalize(Tablet* tablet, Rowset* rowset, uint32_t rowset_id,
                                          PersistentIndexMetaPB& index_meta, MemTracker* tracker,
                                          vector<std::pair<uint32_t, DelVectorPtr>>& delvecs, PrimaryIndex& index) {
@@ -759,6 +832,13 @@ Status RowsetColumnUpdateState::finalize(Tablet* tablet, Rowset* rowset, uint32_
     // 4 generate delta columngroup
     for (const auto& each : rss_rowid_to_update_rowid) {
         update_rows += each.second.size();
+        if (config::partial_update_merge_delta_column_group_threshold > 0) {
+            // fold the columns of older delta column groups into this one, to bound the .cols files per segment
+            RETURN_IF_ERROR(_merge_delta_column_groups(tablet, rowset, each.first,
+                                                       latest_applied_version.major_number(),
+                                                       unique_update_column_ids, idx, &stats, tracker,
+                                                       &dcg_column_ids[each.first], &dcg_column_files[each.first]));
+        }
         _rssid_to_delta_column_group[each.first] = std::make_shared<DeltaColumnGroup>();
         _rssid_to_delta_column_group[each.first]->init(latest_applied_version.major_number() + 1,
                                                        dcg_column_ids[each.first], dcg_column_files[each.first]);
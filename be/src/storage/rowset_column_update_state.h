@@ -171,6 +171,16 @@ private:
     StatusOr<std::unique_ptr<SegmentWriter>> _prepare_delta_column_group_writer(
             Rowset* rowset, const std::shared_ptr<TabletSchema>& tschema, uint32_t rssid, int64_t ver, int idx);
 
+    // If segment |rssid| has at least `partial_update_merge_delta_column_group_threshold` delta column groups
+    // visible at |version|, rewrite their columns not in |unique_update_column_ids| into .cols files of
+    // |version| + 1 starting from suffix |idx|, and append them to |dcg_column_ids| and |dcg_column_files|.
+    // The new delta column group then covers all the columns of the older ones, which can be garbage collected.
+    Status _merge_delta_column_groups(Tablet* tablet, Rowset* rowset, uint32_t rssid, int64_t version,
+                                      const std::vector<uint32_t>& unique_update_column_ids, int idx,
+                                      OlapReaderStatistics* stats, MemTracker* tracker,
+                                      std::vector<std::vector<uint32_t>>* dcg_column_ids,
+                                      std::vector<std::string>* dcg_column_files);
+
     // to build `_partial_update_states`
     Status _prepare_partial_update_states(Tablet* tablet, Rowset* rowset, uint32_t start_idx, uint32_t end_idx,
                                           bool need_lock);
@@ -17,6 +17,7 @@
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
 #include "column/datum_convert.h"
+#include "common/config.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "simd/simd.h"
@@ -557,6 +558,48 @@ Status SchemaChangeUtils::parse_request(const TabletSchemaCSPtr& base_schema, co
     return parse_request_for_sort_key(base_schema, new_schema, sc_sorting, sc_directly);
 }
 
+// Whether |ref_column| can be read as |new_column| by casting on read, so that the segments can be linked instead
+// of rewritten. Key and sort key columns are excluded, the short key index and the sort order depend on their type.
+static bool is_lazy_convertible(const TabletSchemaCSPtr& base_schema, const TabletSchemaCSPtr& new_schema,
+                                const TabletColumn& ref_column, const TabletColumn& new_column) {
+    if (!config::enable_lazy_schema_change || ref_column.unique_id() != new_column.unique_id() ||
+        ref_column.is_key() || new_column.is_key() || ref_column.is_sort_key() || new_column.is_sort_key() ||
+        ref_column.is_nullable() != new_column.is_nullable() || ref_column.aggregation() != new_column.aggregation()) {
+        return false;
+    }
+    if (ref_column.is_bf_column() || new_column.is_bf_column() || ref_column.has_bitmap_index() ||
+        new_column.has_bitmap_index() || base_schema->has_index(ref_column.unique_id(), GIN) ||
+        new_schema->has_index(new_column.unique_id(), GIN) || base_schema->has_index(ref_column.unique_id(), NGRAMBF) ||
+        new_schema->has_index(new_column.unique_id(), NGRAMBF)) {
+        return false;
+    }
+    auto integer_rank = [](LogicalType type) {
+        switch (type) {
+        case TYPE_TINYINT:
+            return 1;
+        case TYPE_SMALLINT:
+            return 2;
+        case TYPE_INT:
+            return 3;
+        case TYPE_BIGINT:
+            return 4;
+        case TYPE_LARGEINT:
+            return 5;
+        default:
+            return 0;
+        }
+    };
+    const LogicalType from = ref_column.type();
+    const LogicalType to = new_column.type();
+    if (from == to) {
+        return from == TYPE_VARCHAR && new_column.length() >= ref_column.length();
+    }
+    if (from == TYPE_FLOAT && to == TYPE_DOUBLE) {
+        return true;
+    }
+    return integer_rank(from) > 0 && integer_rank(from) < integer_rank(to);
+}
+
 Status SchemaChangeUtils::parse_request_normal(const TabletSchemaCSPtr& base_schema,
                                                const TabletSchemaCSPtr& new_schema, ChunkChanger* chunk_changer,
                                                const MaterializedViewParamMap& materialized_view_param_map,
@@ -701,6 +744,9 @@ Status SchemaChangeUtils::parse_request_normal(const TabletSchemaCSPtr& base_sch
         } else {
             auto& new_column = new_schema->column(i);
             auto& ref_column = base_schema->column(column_mapping->ref_column);
+            if (!is_modify_generated_column && is_lazy_convertible(base_schema, new_schema, ref_column, new_column)) {
+                continue;
+            }
             if (new_column.type() != ref_column.type() || is_modify_generated_column) {
                 *sc_directly = true;
                 return Status::OK();
@@ -250,64 +250,39 @@ std::string ReplicateToken::debug_string() {
     return fmt::format("[ReplicateToken tablet_id: {}, txn_id: {}]", _opt->tablet_id, _opt->txn_id);
 }
 
+Status ReplicateToken::_read_file(const std::string& path, int64_t size, butil::IOBuf* data) {
+    ASSIGN_OR_RETURN(auto rfile, _fs->new_random_access_file(path));
+    auto buf = new uint8[size];
+    data->append_user_data(buf, size, [](void* buf) { delete[](uint8*) buf; });
+    return rfile->read_fully(buf, size);
+}
+
 void ReplicateToken::_sync_segment(std::unique_ptr<SegmentPB> segment, bool eos) {
     // If previous sync has failed, return directly
     if (!status().ok()) return;
 
+    // All secondary replicas have failed but the write quorum is still satisfied, there is nobody to
+    // send the segment to, so don't read it back from disk.
+    if (_failed_node_id.size() == _replicate_channels.size()) return;
+
     // 1. read segment from local storage
     butil::IOBuf data;
     if (segment) {
-        // 1.1 read segment file
+        // segment file, delete file and update file are sent in one attachment in this order
+        Status st;
         if (segment->has_path()) {
-            auto res = _fs->new_random_access_file(segment->path());
-            if (!res.ok()) {
-                LOG(WARNING) << "Failed to open segment file " << segment->DebugString() << " by " << debug_string()
-                             << " err " << res.status();
-                return set_status(res.status());
-            }
-            auto rfile = std::move(res.value());
-            auto buf = new uint8[segment->data_size()];
-            data.append_user_data(buf, segment->data_size(), [](void* buf) { delete[](uint8*) buf; });
-            auto st = rfile->read_fully(buf, segment->data_size());
-            if (!st.ok()) {
-                LOG(WARNING) << "Failed to read segment " << segment->DebugString() << " by " << debug_string()
-                             << " err " << st;
-                return set_status(st);
-            }
+            st = _read_file(segment->path(), segment->data_size(), &data);
         }
-        if (segment->has_delete_path()) {
-            auto res = _fs->new_random_access_file(segment->delete_path());
-            if (!res.ok()) {
-                LOG(WARNING) << "Failed to open delete file " << segment->DebugString() << " by " << debug_string()
-                             << " err " << res.status();
-                return set_status(res.status());
-            }
-            auto rfile = std::move(res.value());
-            auto buf = new uint8[segment->delete_data_size()];
-            data.append_user_data(buf, segment->delete_data_size(), [](void* buf) { delete[](uint8*) buf; });
-            auto st = rfile->read_fully(buf, segment->delete_data_size());
-            if (!st.ok()) {
-                LOG(WARNING) << "Failed to read delete file " << segment->DebugString() << " by " << debug_string()
-                             << " err " << st;
-                return set_status(st);
-            }
+        if (st.ok() && segment->has_delete_path()) {
+            st = _read_file(segment->delete_path(), segment->delete_data_size(), &data);
         }
-        if (segment->has_update_path()) {
-            auto res = _fs->new_random_access_file(segment->update_path());
-            if (!res.ok()) {
-                LOG(WARNING) << "Failed to open update file " << segment->DebugString() << " by " << debug_string()
-                             << " err " << res.status();
-                return set_status(res.status());
-            }
-            auto rfile = std::move(res.value());
-            auto buf = new uint8[segment->update_data_size()];
-            data.append_user_data(buf, segment->update_data_size(), [](void* buf) { delete[](uint8*) buf; });
-            auto st = rfile->read_fully(buf, segment->update_data_size());
-            if (!st.ok()) {
-                LOG(WARNING) << "Failed to read delete file " << segment->DebugString() << " by " << debug_string()
-                             << " err " << st;
-                return set_status(st);
-            }
+        if (st.ok() && segment->has_update_path()) {
+            st = _read_file(segment->update_path(), segment->update_data_size(), &data);
+        }
+        if (!st.ok()) {
+            LOG(WARNING) << "Failed to read segment " << segment->DebugString() << " by " << debug_string() << " err "
+                         << st;
+            return set_status(st);
         }
     }
 
@@ -117,6 +117,7 @@ private:
     friend class SegmentReplicateTask;
 
     void _sync_segment(std::unique_ptr<SegmentPB> segment, bool eos);
+    Status _read_file(const std::string& path, int64_t size, butil::IOBuf* data);
 
     std::unique_ptr<ThreadPoolToken> _replicate_token;
 
@@ -0,0 +1,328 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/shared_scan.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "runtime/current_thread.h"
+#include "storage/chunk_helper.h"
+
+namespace starrocks {
+
+uint64_t SharedScanStream::Entry::end() const {
+    return offset + chunk->num_rows();
+}
+
+SharedScanStream::SharedScanStream(SharedScanPassFactory factory, size_t window_chunks, MemTracker* mem_tracker)
+        : _factory(std::move(factory)), _window_chunks(std::max<size_t>(window_chunks, 1)), _mem_tracker(mem_tracker) {}
+
+SharedScanStream::~SharedScanStream() {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    if (_pass != nullptr) {
+        _pass->close();
+        _pass.reset();
+    }
+    _window.clear();
+}
+
+void SharedScanStream::subscribe(Cursor* cursor) {
+    std::lock_guard<std::mutex> l(_mutex);
+    // Start from the oldest buffered chunk, so that the rows already read are shared as well.
+    cursor->start = _window.empty() ? _next_offset : _window.front().offset;
+    cursor->pos = cursor->start;
+    cursor->detached = false;
+    _cursors.emplace_back(cursor);
+}
+
+void SharedScanStream::unsubscribe(Cursor* cursor) {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    std::vector<ChunkPtr> evicted;
+    std::lock_guard<std::mutex> l(_mutex);
+    auto it = std::find(_cursors.begin(), _cursors.end(), cursor);
+    if (it != _cursors.end()) {
+        _cursors.erase(it);
+        _evict(&evicted);
+    }
+}
+
+Status SharedScanStream::status() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _status;
+}
+
+int64_t SharedScanStream::num_passes() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _num_passes;
+}
+
+size_t SharedScanStream::num_subscribers() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _cursors.size();
+}
+
+bool SharedScanStream::_is_done(const Cursor* cursor) const {
+    return _pass_rows >= 0 && cursor->pos >= cursor->start + _pass_rows;
+}
+
+Status SharedScanStream::read(Cursor* cursor, ChunkPtr* chunk, size_t* from, size_t* size) {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    // Declared before the lock, so that the evicted chunks are released out of it.
+    std::vector<ChunkPtr> evicted;
+    std::unique_lock<std::mutex> l(_mutex);
+    *chunk = nullptr;
+    while (true) {
+        RETURN_IF_ERROR(_status);
+        if (cursor->detached) {
+            return Status::OK();
+        }
+        if (_is_done(cursor)) {
+            return Status::EndOfFile("end of shared scan");
+        }
+        if (!_window.empty() && cursor->pos < _window.back().end()) {
+            DCHECK_GE(cursor->pos, _window.front().offset);
+            auto it = std::find_if(_window.begin(), _window.end(),
+                                   [cursor](const Entry& entry) { return cursor->pos < entry.end(); });
+            uint64_t end = it->end();
+            if (_pass_rows >= 0) {
+                end = std::min<uint64_t>(end, cursor->start + _pass_rows);
+            }
+            *chunk = it->chunk;
+            *from = cursor->pos - it->offset;
+            *size = end - cursor->pos;
+            cursor->pos = end;
+            _evict(&evicted);
+            return Status::OK();
+        }
+        DCHECK_EQ(cursor->pos, _next_offset);
+        if (_reading) {
+            return Status::TimedOut("wait for the storage read of shared scan");
+        }
+        if (_window.size() >= _window_chunks) {
+            _detach_lagging(cursor);
+            _evict(&evicted);
+            if (_window.size() >= _window_chunks) {
+                return Status::TimedOut("wait for the slower subscribers of shared scan");
+            }
+        }
+        RETURN_IF_ERROR(_read_next(&l));
+    }
+}
+
+Status SharedScanStream::_read_next(std::unique_lock<std::mutex>* lock) {
+    _reading = true;
+    ChunkIteratorPtr pass = std::move(_pass);
+    lock->unlock();
+
+    // The storage is read without holding the lock, other subscribers can still consume the window.
+    bool new_pass = false;
+    ChunkPtr chunk;
+    Status st;
+    if (pass == nullptr) {
+        auto res = _factory();
+        st = res.status();
+        if (st.ok()) {
+            pass = std::move(res).value();
+            new_pass = true;
+        }
+    }
+    if (st.ok()) {
+        chunk = ChunkHelper::new_chunk(pass->output_schema(), pass->chunk_size());
+        st = pass->get_next(chunk.get());
+    }
+    if (!st.ok() && pass != nullptr) {
+        pass->close();
+        pass.reset();
+    }
+
+    lock->lock();
+    _reading = false;
+    _num_passes += new_pass;
+    if (st.is_end_of_file() && new_pass && _pass_rows > 0) {
+        // Every pass must return the same rows, otherwise the cursors would never be done.
+        _status = Status::InternalError("empty pass of a non-empty shared scan");
+        return _status;
+    }
+    if (st.is_end_of_file()) {
+        // The first pass starts from offset 0.
+        if (_pass_rows < 0) {
+            _pass_rows = static_cast<int64_t>(_next_offset);
+        }
+        return Status::OK();
+    }
+    if (!st.ok()) {
+        _status = st;
+        return st;
+    }
+    _pass = std::move(pass);
+    if (chunk->num_rows() > 0) {
+        _window.push_back(Entry{_next_offset, std::move(chunk)});
+        _next_offset += _window.back().chunk->num_rows();
+    }
+    return Status::OK();
+}
+
+void SharedScanStream::_detach_lagging(const Cursor* caller) {
+    const uint64_t oldest_end = _window.front().end();
+    for (auto it = _cursors.begin(); it != _cursors.end();) {
+        Cursor* cursor = *it;
+        if (cursor == caller || cursor->pos >= oldest_end || _is_done(cursor)) {
+            ++it;
+            continue;
+        }
+        // The rows of a pass are numbered from 0, the global offsets are the same in the first pass.
+        if (_pass_rows < 0) {
+            cursor->private_begin = cursor->pos;
+            cursor->private_end = cursor->start;
+        } else {
+            DCHECK_GT(_pass_rows, 0);
+            cursor->private_begin = cursor->pos % _pass_rows;
+            cursor->private_end = cursor->start % _pass_rows;
+        }
+        cursor->detached = true;
+        it = _cursors.erase(it);
+    }
+}
+
+void SharedScanStream::_evict(std::vector<ChunkPtr>* evicted) {
+    uint64_t min_pos = std::numeric_limits<uint64_t>::max();
+    for (const Cursor* cursor : _cursors) {
+        // A cursor having seen every row doesn't need the window any more.
+        if (!_is_done(cursor)) {
+            min_pos = std::min(min_pos, cursor->pos);
+        }
+    }
+    while (!_window.empty() && _window.front().end() <= min_pos) {
+        evicted->emplace_back(std::move(_window.front().chunk));
+        _window.pop_front();
+    }
+}
+
+SharedScanIterator::SharedScanIterator(Schema schema, int chunk_size, std::shared_ptr<SharedScanStream> stream)
+        : ChunkIterator(std::move(schema), chunk_size), _stream(std::move(stream)) {
+    _stream->subscribe(&_cursor);
+    _subscribed = true;
+}
+
+SharedScanIterator::~SharedScanIterator() {
+    if (_subscribed) {
+        _stream->unsubscribe(&_cursor);
+    }
+}
+
+void SharedScanIterator::close() {
+    if (_subscribed) {
+        _stream->unsubscribe(&_cursor);
+        _subscribed = false;
+    }
+    if (_private_pass != nullptr) {
+        _private_pass->close();
+        _private_pass.reset();
+    }
+    _private_chunk.reset();
+}
+
+Status SharedScanIterator::do_get_next(Chunk* chunk) {
+    if (_private_pass != nullptr) {
+        return _read_private(chunk);
+    }
+
+    ChunkPtr shared;
+    size_t from = 0;
+    size_t size = 0;
+    RETURN_IF_ERROR(_stream->read(&_cursor, &shared, &from, &size));
+    if (shared != nullptr) {
+        // Copied under the tracker of the query, while the shared chunk is released under the one of the stream.
+        chunk->append(*shared, from, size);
+        _shared_rows += size;
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_stream->mem_tracker());
+        shared.reset();
+        return Status::OK();
+    }
+
+    // Detached by the stream, which has already dropped the cursor.
+    DCHECK(_cursor.detached);
+    _subscribed = false;
+    ASSIGN_OR_RETURN(_private_pass, _stream->new_pass());
+    _private_chunk = ChunkHelper::new_chunk(_private_pass->output_schema(), _private_pass->chunk_size());
+    return _read_private(chunk);
+}
+
+Status SharedScanIterator::_read_private(Chunk* chunk) {
+    const uint64_t begin = _cursor.private_begin;
+    const uint64_t end = _cursor.private_end;
+    const bool wrapped = begin >= end;
+    while (chunk->num_rows() == 0) {
+        if (!wrapped && _private_row >= end) {
+            return Status::EndOfFile("end of shared scan");
+        }
+        _private_chunk->reset();
+        RETURN_IF_ERROR(_private_pass->get_next(_private_chunk.get()));
+        const uint64_t lo = _private_row;
+        const uint64_t hi = lo + _private_chunk->num_rows();
+        auto append = [&](uint64_t range_begin, uint64_t range_end) {
+            range_begin = std::max(range_begin, lo);
+            range_end = std::min(range_end, hi);
+            if (range_begin < range_end) {
+                chunk->append(*_private_chunk, range_begin - lo, range_end - range_begin);
+            }
+        };
+        if (wrapped) {
+            append(0, end);
+            append(begin, hi);
+        } else {
+            append(begin, end);
+        }
+        _private_row = hi;
+    }
+    _private_rows += chunk->num_rows();
+    return Status::OK();
+}
+
+SharedScanManager* SharedScanManager::instance() {
+    static SharedScanManager manager;
+    return &manager;
+}
+
+std::shared_ptr<SharedScanStream> SharedScanManager::get_or_create(const std::string& key,
+                                                                   const SharedScanPassFactory& factory,
+                                                                   MemTracker* mem_tracker) {
+    std::lock_guard<std::mutex> l(_mutex);
+    if (auto it = _streams.find(key); it != _streams.end()) {
+        if (auto stream = it->second.lock(); stream != nullptr && stream->status().ok()) {
+            return stream;
+        }
+    }
+    // Drop the streams without any subscriber.
+    for (auto it = _streams.begin(); it != _streams.end();) {
+        it = it->second.expired() ? _streams.erase(it) : std::next(it);
+    }
+    auto stream = std::make_shared<SharedScanStream>(factory, config::shared_scan_window_chunks, mem_tracker);
+    _streams[key] = stream;
+    return stream;
+}
+
+size_t SharedScanManager::num_streams() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    size_t num = 0;
+    for (const auto& [_, stream] : _streams) {
+        num += !stream.expired();
+    }
+    return num;
+}
+
+} // namespace starrocks
@@ -0,0 +1,164 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "storage/chunk_iterator.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+// Opens a new pass over the rows of a shared scan. Every pass must return the same rows in the same order.
+using SharedScanPassFactory = std::function<StatusOr<ChunkIteratorPtr>()>;
+
+// SharedScanStream lets the concurrent scans of the same rows, e.g. the same columns of a tablet at the same
+// version, share one storage read. The chunks read from storage are kept in a bounded window until every
+// subscriber has consumed them. A subscriber joining a running stream starts from the oldest chunk of the
+// window, follows the stream to the end of the pass and then wraps around to the rows it has missed, which
+// are read again by the next pass.
+//
+// Rows are numbered by their global offset in the stream, a subscriber wants the rows [start, start + N), where
+// N is the number of rows of a pass and is only known at the end of the first pass.
+//
+// A subscriber that falls too far behind is detached rather than blocking the others, which would deadlock if
+// the slow subscriber is waiting for a fast one, e.g. the two sides of a self join. A detached subscriber reads
+// its remaining rows with a private pass.
+//
+// The chunks of the window are shared by queries, so they are allocated and released under the mem tracker
+// given to the stream rather than the tracker of any query.
+class SharedScanStream {
+public:
+    struct Cursor {
+        // Global offsets of the first row wanted and the next row to return.
+        uint64_t start = 0;
+        uint64_t pos = 0;
+        // Set by the stream when the subscriber is detached, it wants the rows [private_begin, private_end) of
+        // a pass, wrapping around if private_begin >= private_end.
+        bool detached = false;
+        uint64_t private_begin = 0;
+        uint64_t private_end = 0;
+    };
+
+    SharedScanStream(SharedScanPassFactory factory, size_t window_chunks, MemTracker* mem_tracker);
+    ~SharedScanStream();
+
+    void subscribe(Cursor* cursor);
+    void unsubscribe(Cursor* cursor);
+
+    // Returns the next rows of |cursor| as the rows [*from, *from + *size) of |*chunk|, which is shared and must
+    // not be modified. Returns EndOfFile if the cursor has seen every row, TimedOut if it has to wait for another
+    // subscriber reading the storage or for the slower subscribers, and OK with a null chunk if it is detached.
+    Status read(Cursor* cursor, ChunkPtr* chunk, size_t* from, size_t* size);
+
+    StatusOr<ChunkIteratorPtr> new_pass() const { return _factory(); }
+
+    MemTracker* mem_tracker() const { return _mem_tracker; }
+    // The error of reading the storage, which fails every subscriber.
+    Status status() const;
+    int64_t num_passes() const;
+    size_t num_subscribers() const;
+
+private:
+    struct Entry {
+        uint64_t offset;
+        ChunkPtr chunk;
+
+        uint64_t end() const;
+    };
+
+    bool _is_done(const Cursor* cursor) const;
+    Status _read_next(std::unique_lock<std::mutex>* lock);
+    void _detach_lagging(const Cursor* caller);
+    void _evict(std::vector<ChunkPtr>* evicted);
+
+    const SharedScanPassFactory _factory;
+    const size_t _window_chunks;
+    MemTracker* const _mem_tracker;
+
+    mutable std::mutex _mutex;
+    std::vector<Cursor*> _cursors;
+    std::deque<Entry> _window;
+    ChunkIteratorPtr _pass;
+    int64_t _num_passes = 0;
+    // Global offset of the next row read from storage.
+    uint64_t _next_offset = 0;
+    // Number of rows of a pass, -1 until the end of the first pass.
+    int64_t _pass_rows = -1;
+    // Whether a subscriber is reading the storage without holding |_mutex|.
+    bool _reading = false;
+    Status _status;
+};
+
+// SharedScanIterator returns every row of a SharedScanStream exactly once, in the order of the stream starting
+// from the point it joins, so it only fits the scans that don't care about the order of rows.
+class SharedScanIterator final : public ChunkIterator {
+public:
+    SharedScanIterator(Schema schema, int chunk_size, std::shared_ptr<SharedScanStream> stream);
+    ~SharedScanIterator() override;
+
+    void close() override;
+
+    int64_t shared_rows() const { return _shared_rows; }
+    int64_t private_rows() const { return _private_rows; }
+    bool detached() const { return _private_pass != nullptr; }
+
+protected:
+    Status do_get_next(Chunk* chunk) override;
+
+private:
+    Status _read_private(Chunk* chunk);
+
+    std::shared_ptr<SharedScanStream> _stream;
+    SharedScanStream::Cursor _cursor;
+    bool _subscribed = false;
+
+    ChunkIteratorPtr _private_pass;
+    ChunkPtr _private_chunk;
+    // Row of the private pass at the head of |_private_chunk|.
+    uint64_t _private_row = 0;
+
+    int64_t _shared_rows = 0;
+    int64_t _private_rows = 0;
+};
+
+// SharedScanManager finds the running stream of a scan, identified by a key which covers everything determining
+// the rows of the scan.
+class SharedScanManager {
+public:
+    static SharedScanManager* instance();
+
+    std::shared_ptr<SharedScanStream> get_or_create(const std::string& key, const SharedScanPassFactory& factory,
+                                                    MemTracker* mem_tracker);
+
+    size_t num_streams() const;
+
+private:
+    SharedScanManager() = default;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, std::weak_ptr<SharedScanStream>> _streams;
+};
+
+} // namespace starrocks
@@ -14,10 +14,16 @@
 
 #include "storage/size_tiered_compaction_policy.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <queue>
 
+#include "column/datum_convert.h"
 #include "runtime/current_thread.h"
 #include "storage/compaction_task_factory.h"
+#include "storage/rowset/column_reader.h"
+#include "storage/rowset/segment.h"
+#include "storage/types.h"
 #include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
 #include "util/time.h"
@@ -115,6 +121,89 @@ double SizeTieredCompactionPolicy::_cal_compaction_score(int64_t segment_num, in
     return score;
 }
 
+double SizeTieredCompactionPolicy::_cal_level_score(const std::vector<RowsetSharedPtr>& rowsets, int64_t segment_num,
+                                                    int64_t level_size, int64_t total_size, KeysType keys_type,
+                                                    bool reached_max_version, bool force_base_compaction) {
+    double score = _cal_compaction_score(segment_num, level_size, total_size, keys_type, reached_max_version);
+    if (!config::enable_size_tiered_read_amplification_score || segment_num <= 1 || reached_max_version ||
+        force_base_compaction) {
+        return score;
+    }
+    int64_t read_amp = _read_amplification(rowsets);
+    if (read_amp < 0) {
+        return score;
+    }
+    // Merging the segments which overlap cuts the segments read by every query, while merging the disjoint ones
+    // mostly saves the per-segment overhead, which matters only if the tablet is scanned frequently.
+    double overlap_ratio = std::clamp(static_cast<double>(read_amp - 1) / (segment_num - 1), 0.0, 1.0);
+    double scans = std::max(0.0, _tablet->query_scan_frequency());
+    double hotness = scans / (scans + std::max(config::size_tiered_hot_tablet_scans_per_minute, 1e-6));
+    double disjoint_ratio = std::max(std::clamp(config::size_tiered_disjoint_level_min_score_ratio, 0.0, 1.0), hotness);
+    return score * (overlap_ratio + (1 - overlap_ratio) * disjoint_ratio);
+}
+
+int64_t SizeTieredCompactionPolicy::_read_amplification(const std::vector<RowsetSharedPtr>& rowsets) {
+    auto tablet_schema = _tablet->tablet_schema();
+    if (tablet_schema->sort_key_idxes().empty()) {
+        return -1;
+    }
+    const TabletColumn& column = tablet_schema->column(tablet_schema->sort_key_idxes()[0]);
+    // the zone map of string columns may be truncated, which can not tell the exact bounds
+    if (is_string_type(column.type()) || !is_scalar_field_type(column.type())) {
+        return -1;
+    }
+    TypeInfoPtr type_info = get_type_info(delegate_type(column.type()));
+
+    std::vector<std::pair<Datum, Datum>> ranges;
+    for (const auto& rowset : rowsets) {
+        if (rowset->num_segments() == 0) {
+            continue;
+        }
+        // Don't load the segments only for the score, the segments of a loaded rowset are not closed while the
+        // rowset is acquired.
+        RowsetReleaseGuard guard(rowset);
+        if (!rowset->is_loaded()) {
+            return -1;
+        }
+        for (const auto& segment : rowset->segments()) {
+            if (segment->num_rows() == 0) {
+                continue;
+            }
+            const auto* column_reader = segment->column_with_uid(column.unique_id());
+            if (column_reader == nullptr || column_reader->segment_zone_map() == nullptr) {
+                return -1;
+            }
+            const ZoneMapPB& zone_map = *column_reader->segment_zone_map();
+            if (zone_map.has_null() || !zone_map.has_not_null()) {
+                return -1;
+            }
+            Datum min_value;
+            Datum max_value;
+            if (!datum_from_string(type_info.get(), &min_value, zone_map.min(), nullptr).ok() ||
+                !datum_from_string(type_info.get(), &max_value, zone_map.max(), nullptr).ok()) {
+                return -1;
+            }
+            ranges.emplace_back(std::move(min_value), std::move(max_value));
+        }
+    }
+
+    // Sweep the ranges by their min values, and keep the max values of the ranges covering the current one.
+    std::sort(ranges.begin(), ranges.end(), [&](const auto& lhs, const auto& rhs) {
+        return type_info->cmp(lhs.first, rhs.first) < 0;
+    });
+    auto max_greater = [&](const Datum& lhs, const Datum& rhs) { return type_info->cmp(lhs, rhs) > 0; };
+    std::priority_queue<Datum, std::vector<Datum>, decltype(max_greater)> covering(max_greater);
+    int64_t read_amp = 0;
+    for (const auto& [min_value, max_value] : ranges) {
+        while (!covering.empty() && type_info->cmp(covering.top(), min_value) < 0) {
+            covering.pop();
+        }
+        covering.push(max_value);
+        read_amp = std::max<int64_t>(read_amp, covering.size());
+    }
+    return read_amp;
+}
+
 Status SizeTieredCompactionPolicy::_pick_rowsets_to_size_tiered_compact(bool force_base_compaction,
                                                                         std::vector<RowsetSharedPtr>* input_rowsets,
                                                                         double* score) {
@@ -212,7 +301,8 @@ Status SizeTieredCompactionPolicy::_pick_rowsets_to_size_tiered_compact(bool for
             if (!transient_rowsets.empty()) {
                 auto level = std::make_unique<SizeTieredLevel>(
                         transient_rowsets, segment_num, level_size, total_size,
-                        _cal_compaction_score(segment_num, level_size, total_size, keys_type, reached_max_version));
+                        _cal_level_score(transient_rowsets, segment_num, level_size, total_size, keys_type,
+                                         reached_max_version, force_base_compaction));
                 priority_levels.emplace(level.get());
                 order_levels.emplace_back(std::move(level));
             }
@@ -229,7 +319,8 @@ Status SizeTieredCompactionPolicy::_pick_rowsets_to_size_tiered_compact(bool for
             if (!transient_rowsets.empty()) {
                 auto level = std::make_unique<SizeTieredLevel>(
                         transient_rowsets, segment_num, level_size, total_size,
-                        _cal_compaction_score(segment_num, level_size, total_size, keys_type, reached_max_version));
+                        _cal_level_score(transient_rowsets, segment_num, level_size, total_size, keys_type,
+                                         reached_max_version, force_base_compaction));
                 priority_levels.emplace(level.get());
                 order_levels.emplace_back(std::move(level));
             }
@@ -268,7 +359,8 @@ Status SizeTieredCompactionPolicy::_pick_rowsets_to_size_tiered_compact(bool for
                 if (!transient_rowsets.empty() && transient_rowsets[0]->start_version() != 0) {
                     auto level = std::make_unique<SizeTieredLevel>(
                             transient_rowsets, segment_num, level_size, total_size,
-                            _cal_compaction_score(segment_num, level_size, total_size, keys_type, reached_max_version));
+                            _cal_level_score(transient_rowsets, segment_num, level_size, total_size, keys_type,
+                                             reached_max_version, force_base_compaction));
                     VLOG(1) << "Add level for tablet " << _tablet->tablet_id()
                             << " for size-tiered compaction rowset version=" << level->rowsets.front()->start_version()
                             << "-" << level->rowsets.back()->end_version() << " score=" << level->score
@@ -292,7 +384,8 @@ Status SizeTieredCompactionPolicy::_pick_rowsets_to_size_tiered_compact(bool for
             if (!transient_rowsets.empty()) {
                 auto level = std::make_unique<SizeTieredLevel>(
                         transient_rowsets, segment_num, level_size, total_size,
-                        _cal_compaction_score(segment_num, level_size, total_size, keys_type, reached_max_version));
+                        _cal_level_score(transient_rowsets, segment_num, level_size, total_size, keys_type,
+                                         reached_max_version, force_base_compaction));
                 VLOG(1) << "Add level for tablet " << _tablet->tablet_id()
                         << " for size-tiered compaction rowset version=" << level->rowsets.front()->start_version()
                         << "-" << level->rowsets.back()->end_version() << " score=" << level->score
@@ -316,7 +409,8 @@ Status SizeTieredCompactionPolicy::_pick_rowsets_to_size_tiered_compact(bool for
     if (!transient_rowsets.empty()) {
         auto level = std::make_unique<SizeTieredLevel>(
                 transient_rowsets, segment_num, level_size, total_size,
-                _cal_compaction_score(segment_num, level_size, total_size, keys_type, reached_max_version));
+                _cal_level_score(transient_rowsets, segment_num, level_size, total_size, keys_type,
+                                 reached_max_version, force_base_compaction));
         VLOG(1) << "Add level for tablet " << _tablet->tablet_id()
                 << " for size-tiered compaction rowset version=" << level->rowsets.front()->start_version() << "-"
                 << level->rowsets.back()->end_version() << " score=" << level->score
@@ -38,6 +38,14 @@ protected:
                                                 double* score);
     double _cal_compaction_score(int64_t segment_num, int64_t level_size, int64_t total_size, KeysType keys_type,
                                  bool reached_max_version);
+    // The score of a level, scaled by its read amplification if it's known, see _read_amplification.
+    double _cal_level_score(const std::vector<RowsetSharedPtr>& rowsets, int64_t segment_num, int64_t level_size,
+                            int64_t total_size, KeysType keys_type, bool reached_max_version,
+                            bool force_base_compaction);
+    // The max number of segments of |rowsets| whose ranges of the first sort key cover a same key, i.e. the number
+    // of segments a point query reads. -1 if it's unknown, e.g. the segments are not loaded or the zone maps of
+    // the sort key can't tell the exact ranges.
+    int64_t _read_amplification(const std::vector<RowsetSharedPtr>& rowsets);
     Status _check_version_continuity(const std::vector<RowsetSharedPtr>& rowsets);
 
     Tablet* _tablet;
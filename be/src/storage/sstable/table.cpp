@@ -36,6 +36,7 @@ struct Table::Rep {
     uint64_t cache_id;
     FilterBlockReader* filter;
     const char* filter_data;
+    size_t filter_size = 0;
 
     BlockHandle metaindex_handle; // Handle to metaindex_block: saved from footer
     Block* index_block;
@@ -138,6 +139,11 @@ void Table::ReadFilter(const Slice& filter_handle_value) {
         rep_->filter_data = block.data.get_data(); // Will need to delete later
     }
     rep_->filter = new FilterBlockReader(rep_->options.filter_policy, block.data);
+    rep_->filter_size = block.data.size;
+}
+
+size_t Table::MemoryUsage() const {
+    return rep_->index_block->size() + rep_->filter_size;
 }
 
 Table::~Table() {
@@ -51,6 +51,10 @@ public:
     Status MultiGet(const ReadOptions&, const Slice* keys, ForwardIt begin, ForwardIt end,
                     std::vector<std::string>* values);
 
+    // Returns the bytes of the index block and the filter block, which are kept in memory
+    // as long as the table is open.
+    size_t MemoryUsage() const;
+
 private:
     struct Rep;
 
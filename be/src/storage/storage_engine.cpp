@@ -637,6 +637,7 @@ void StorageEngine::stop() {
 
     JOIN_THREAD(_fd_cache_clean_thread)
     JOIN_THREAD(_adjust_cache_thread)
+    JOIN_THREAD(_page_cache_warmup_thread)
 
     if (config::path_gc_check) {
         JOIN_THREADS(_path_scan_threads)
@@ -1132,9 +1133,7 @@ void StorageEngine::_clean_unused_rowset_metas() {
         int64_t start_ts = MonotonicMillis();
         (void)RowsetMetaManager::traverse_rowset_metas(data_dir->get_meta(), clean_rowset_func);
         if (!invalid_rowsets.empty()) {
-            for (auto& rowset : invalid_rowsets) {
-                (void)RowsetMetaManager::remove(data_dir->get_meta(), rowset.first, rowset.second);
-            }
+            (void)RowsetMetaManager::remove_batch(data_dir->get_meta(), invalid_rowsets);
             LOG(WARNING) << "traverse_rowset_meta and remove " << invalid_rowsets.size() << "/"
                          << total_rowset_meta_count << " invalid rowset metas, path:" << data_dir->path()
                          << " duration:" << (MonotonicMillis() - start_ts) << "ms";
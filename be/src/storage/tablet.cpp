@@ -1203,6 +1203,25 @@ void Tablet::pick_all_candicate_rowsets(vector<RowsetSharedPtr>* candidate_rowse
     }
 }
 
+double Tablet::query_scan_frequency() {
+    std::lock_guard lg(_query_scan_lock);
+    int64_t now_ms = UnixMillis();
+    int64_t count = _query_scan_count.load(std::memory_order_relaxed);
+    if (_query_scan_window_start_ms == 0) {
+        _query_scan_window_start_ms = now_ms;
+        _query_scan_window_start_count = count;
+        return _query_scan_frequency;
+    }
+    int64_t elapsed_ms = now_ms - _query_scan_window_start_ms;
+    if (elapsed_ms >= 60 * 1000) {
+        double frequency = (count - _query_scan_window_start_count) * 60.0 * 1000 / elapsed_ms;
+        _query_scan_frequency = (_query_scan_frequency + frequency) / 2;
+        _query_scan_window_start_ms = now_ms;
+        _query_scan_window_start_count = count;
+    }
+    return _query_scan_frequency;
+}
+
 // For http compaction action
 void Tablet::get_compaction_status(std::string* json_result) {
     if (keys_type() == PRIMARY_KEYS) {
@@ -1413,14 +1432,15 @@ void Tablet::do_tablet_meta_checkpoint() {
     LOG(INFO) << "start to do tablet meta checkpoint, tablet=" << full_name();
     save_meta();
     // if save meta successfully, then should remove the rowset meta existing in tablet
-    // meta from rowset meta store
+    // meta from rowset meta store, all in a single write.
+    std::vector<std::pair<TabletUid, RowsetId>> persisted_rowsets;
     for (auto& rs_meta : _tablet_meta->all_rs_metas()) {
         // If we delete it from rowset manager's meta explicitly in previous checkpoint, just skip.
         if (rs_meta->is_remove_from_rowset_meta()) {
             continue;
         }
         if (RowsetMetaManager::check_rowset_meta(_data_dir->get_meta(), tablet_uid(), rs_meta->rowset_id())) {
-            (void)RowsetMetaManager::remove(_data_dir->get_meta(), tablet_uid(), rs_meta->rowset_id());
+            persisted_rowsets.emplace_back(tablet_uid(), rs_meta->rowset_id());
             VLOG(1) << "remove rowset id from meta store because it is already persistent with "
                        "tablet meta"
                     << ", rowset_id=" << rs_meta->rowset_id();
@@ -1435,12 +1455,13 @@ void Tablet::do_tablet_meta_checkpoint() {
             continue;
         }
         if (RowsetMetaManager::check_rowset_meta(_data_dir->get_meta(), tablet_uid(), rs_meta->rowset_id())) {
-            (void)RowsetMetaManager::remove(_data_dir->get_meta(), tablet_uid(), rs_meta->rowset_id());
+            persisted_rowsets.emplace_back(tablet_uid(), rs_meta->rowset_id());
             VLOG(1) << "remove rowset id from meta store because it is already persistent with tablet meta"
                     << ", rowset_id=" << rs_meta->rowset_id();
         }
         rs_meta->set_remove_from_rowset_meta();
     }
+    (void)RowsetMetaManager::remove_batch(_data_dir->get_meta(), persisted_rowsets);
 
     _newly_created_rowset_num = 0;
     _last_checkpoint_time = UnixMillis();
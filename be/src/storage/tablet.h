@@ -227,6 +227,11 @@ public:
     int64_t last_base_compaction_success_time() { return _last_base_compaction_success_millis; }
     void set_last_base_compaction_success_time(int64_t millis) { _last_base_compaction_success_millis = millis; }
 
+    // Record a scan of this tablet by a query, the scan frequency is used to rank compaction candidates.
+    void record_query_scan() { _query_scan_count.fetch_add(1, std::memory_order_relaxed); }
+    // Return the number of scans per minute, averaged with the previous value every minute.
+    double query_scan_frequency();
+
     void delete_all_files();
 
     bool check_rowset_id(const RowsetId& rowset_id);
@@ -436,6 +441,13 @@ private:
 
     std::atomic<TStatusCode::type> _last_cumu_compaction_failure_status = TStatusCode::OK;
 
+    std::atomic<int64_t> _query_scan_count{0};
+    std::mutex _query_scan_lock;
+    // protected by _query_scan_lock
+    int64_t _query_scan_window_start_ms = 0;
+    int64_t _query_scan_window_start_count = 0;
+    double _query_scan_frequency = 0;
+
     std::atomic<int64_t> _cumulative_point{0};
     std::atomic<int32_t> _newly_created_rowset_num{0};
     std::atomic<int64_t> _last_checkpoint_time{0};
@@ -103,6 +103,8 @@ StatusOr<IndexType> TabletIndex::_convert_index_type_from_thrift(TIndexType::typ
         return IndexType::BITMAP;
     case TIndexType::GIN:
         return IndexType::GIN;
+    case TIndexType::VECTOR:
+        return IndexType::VECTOR;
     default:
         // Handle other potential TIndexTypes or set a default value and/or log an error
         std::string type_str;
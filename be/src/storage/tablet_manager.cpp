@@ -38,6 +38,7 @@
 #include <fmt/format.h>
 #include <re2/re2.h>
 
+#include <algorithm>
 #include <ctime>
 #include <memory>
 
@@ -61,6 +62,7 @@
 #include "storage/txn_manager.h"
 #include "storage/update_manager.h"
 #include "storage/utils.h"
+#include "util/epoch_reclaimer.h"
 #include "util/path_util.h"
 #include "util/starrocks_metrics.h"
 
@@ -157,6 +159,7 @@ Status TabletManager::_update_tablet_map_and_partition_info(const TabletSharedPt
     if (!inserted) {
         return Status::InternalError(fmt::format("tablet {} already exist in map", tablet->tablet_id()));
     }
+    _invalidate_snapshot_unlocked(_get_tablets_shard(tablet->tablet_id()));
     _add_tablet_to_partition(*tablet);
     return Status::OK();
 }
@@ -169,7 +172,7 @@ Status TabletManager::create_tablet(const TCreateTabletReq& request, std::vector
     LOG(INFO) << "Creating tablet " << tablet_id;
 
     std::unique_lock wlock(_get_tablets_shard_lock(tablet_id), std::defer_lock);
-    std::shared_lock<std::shared_mutex> base_rlock;
+    std::shared_lock<InstrumentedSharedMutex<>> base_rlock;
 
     // If do schema change, both the shard where the source tablet is located and
     // the shard where the target tablet is located need to be locked.
@@ -395,6 +398,7 @@ Status TabletManager::drop_tablet(TTabletId tablet_id, TabletDropFlag flag) {
         LOG(INFO) << "Start to drop tablet " << tablet_id;
         dropped_tablet = it->second;
         tablet_map.erase(it);
+        _invalidate_snapshot_unlocked(_get_tablets_shard(tablet_id));
         _remove_tablet_from_partition(*dropped_tablet);
     }
     if (config::enable_event_based_compaction_framework) {
@@ -462,6 +466,7 @@ Status TabletManager::drop_tablets_on_error_root_path(const std::vector<TabletIn
                 TabletMap& tablet_map = _get_tablet_map(tablet_id);
                 _remove_tablet_from_partition(*dropped_tablet);
                 tablet_map.erase(tablet_id);
+                _invalidate_snapshot_unlocked(_get_tablets_shard(tablet_id));
 
                 dropped_tablets.push_back(dropped_tablet);
             }
@@ -485,8 +490,12 @@ Status TabletManager::drop_tablets_on_error_root_path(const std::vector<TabletIn
 }
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, bool include_deleted, std::string* err) {
-    std::shared_lock rlock(_get_tablets_shard_lock(tablet_id));
-    return _get_tablet_unlocked(tablet_id, include_deleted, err);
+    TabletSharedPtr tablet;
+    if (!_get_tablet_from_snapshot(tablet_id, &tablet)) {
+        std::shared_lock rlock(_get_tablets_shard_lock(tablet_id));
+        tablet = _get_tablet_and_take_snapshot_unlocked(tablet_id);
+    }
+    return _check_tablet(tablet_id, std::move(tablet), include_deleted, err);
 }
 
 StatusOr<TabletAndRowsets> TabletManager::capture_tablet_and_rowsets(TTabletId tablet_id, int64_t from_version,
@@ -504,7 +513,11 @@ StatusOr<TabletAndRowsets> TabletManager::capture_tablet_and_rowsets(TTabletId t
 }
 
 TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool include_deleted, std::string* err) {
-    TabletSharedPtr tablet = _get_tablet_unlocked(tablet_id);
+    return _check_tablet(tablet_id, _get_tablet_unlocked(tablet_id), include_deleted, err);
+}
+
+TabletSharedPtr TabletManager::_check_tablet(TTabletId tablet_id, TabletSharedPtr tablet, bool include_deleted,
+                                             std::string* err) {
     if (tablet == nullptr && include_deleted) {
         std::shared_lock rlock(_shutdown_tablets_lock);
         if (auto it = _shutdown_tablets.find(tablet_id); it != _shutdown_tablets.end()) {
@@ -532,8 +545,7 @@ TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool in
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, const TabletUid& tablet_uid, bool include_deleted,
                                           std::string* err) {
-    std::shared_lock rlock(_get_tablets_shard_lock(tablet_id));
-    TabletSharedPtr tablet = _get_tablet_unlocked(tablet_id, include_deleted, err);
+    TabletSharedPtr tablet = get_tablet(tablet_id, include_deleted, err);
     if (tablet != nullptr && tablet->tablet_uid() == tablet_uid) {
         return tablet;
     }
@@ -741,6 +753,33 @@ Status TabletManager::generate_pk_dump() {
     return Status::OK();
 }
 
+std::vector<TabletSharedPtr> TabletManager::pick_tablets_to_preload_primary_index(size_t num) {
+    std::vector<TabletSharedPtr> tablet_ptr_list;
+    for (const auto& tablets_shard : _tablets_shards) {
+        std::shared_lock rlock(tablets_shard.lock);
+        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+            if (tablet_ptr->keys_type() != PRIMARY_KEYS || tablet_ptr->tablet_state() != TABLET_RUNNING) {
+                continue;
+            }
+            tablet_ptr_list.push_back(tablet_ptr);
+        }
+    }
+    std::vector<std::pair<int64_t, TabletSharedPtr>> tablets_by_time;
+    tablets_by_time.reserve(tablet_ptr_list.size());
+    for (auto& tablet_ptr : tablet_ptr_list) {
+        tablets_by_time.emplace_back(tablet_ptr->updates()->max_rowset_creation_time(), std::move(tablet_ptr));
+    }
+    num = std::min(num, tablets_by_time.size());
+    std::partial_sort(tablets_by_time.begin(), tablets_by_time.begin() + num, tablets_by_time.end(),
+                      [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::vector<TabletSharedPtr> pick_tablets;
+    pick_tablets.reserve(num);
+    for (size_t i = 0; i < num; i++) {
+        pick_tablets.push_back(std::move(tablets_by_time[i].second));
+    }
+    return pick_tablets;
+}
+
 // pick tablets to do primary index compaction
 std::vector<TabletAndScore> TabletManager::pick_tablets_to_do_pk_index_major_compaction() {
     std::vector<TabletAndScore> pick_tablets;
@@ -1015,6 +1054,8 @@ Status TabletManager::start_trash_sweep() {
         }
     }
 
+    // Release the tablets referenced by the snapshots of the tablet map unlinked by the readers still in progress.
+    EpochReclaimer::instance()->reclaim();
     std::vector<DroppedTabletInfo> tablets_to_check;
     {
         std::shared_lock l(_shutdown_tablets_lock);
@@ -1470,6 +1511,7 @@ Status TabletManager::_drop_tablet_unlocked(TTabletId tablet_id, TabletDropFlag
     LOG(INFO) << "Start to drop tablet " << tablet_id;
     TabletSharedPtr dropped_tablet = it->second;
     tablet_map.erase(it);
+    _invalidate_snapshot_unlocked(_get_tablets_shard(tablet_id));
     _remove_tablet_from_partition(*dropped_tablet);
     if (config::enable_event_based_compaction_framework) {
         dropped_tablet->stop_compaction();
@@ -1521,6 +1563,40 @@ TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id) {
     return it != tablet_map.end() ? it->second : nullptr;
 }
 
+bool TabletManager::_get_tablet_from_snapshot(TTabletId tablet_id, TabletSharedPtr* tablet) {
+    EpochReclaimer::Guard guard;
+    const TabletMap* snapshot = _get_tablets_shard(tablet_id).snapshot.load(std::memory_order_acquire);
+    if (snapshot == nullptr) {
+        return false;
+    }
+    auto it = snapshot->find(tablet_id);
+    *tablet = it != snapshot->end() ? it->second : nullptr;
+    return true;
+}
+
+TabletSharedPtr TabletManager::_get_tablet_and_take_snapshot_unlocked(TTabletId tablet_id) {
+    TabletsShard& shard = _get_tablets_shard(tablet_id);
+    // The tablet map cannot change while the shared lock is held, so a new snapshot is consistent with it.
+    // Only one reader copies the map, the others go on with the locked lookup.
+    if (shard.snapshot.load(std::memory_order_acquire) == nullptr &&
+        !shard.taking_snapshot.exchange(true, std::memory_order_acquire)) {
+        const TabletMap* expected = nullptr;
+        auto* snapshot = new TabletMap(shard.tablet_map);
+        if (!shard.snapshot.compare_exchange_strong(expected, snapshot, std::memory_order_release)) {
+            delete snapshot;
+        }
+        shard.taking_snapshot.store(false, std::memory_order_release);
+    }
+    return _get_tablet_unlocked(tablet_id);
+}
+
+void TabletManager::_invalidate_snapshot_unlocked(TabletsShard& shard) {
+    const TabletMap* snapshot = shard.snapshot.exchange(nullptr, std::memory_order_acq_rel);
+    if (snapshot != nullptr) {
+        EpochReclaimer::instance()->retire([snapshot]() { delete snapshot; });
+    }
+}
+
 void TabletManager::_add_tablet_to_partition(const Tablet& tablet) {
     std::unique_lock wlock(_partition_tablet_map_lock);
     _partition_tablet_map[tablet.partition_id()].insert(tablet.get_tablet_info());
@@ -1597,7 +1673,7 @@ void TabletManager::get_tablets_basic_infos(int64_t table_id, int64_t partition_
     }
 }
 
-std::shared_mutex& TabletManager::_get_tablets_shard_lock(TTabletId tabletId) {
+InstrumentedSharedMutex<>& TabletManager::_get_tablets_shard_lock(TTabletId tabletId) {
     return _get_tablets_shard(tabletId).lock;
 }
 
@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <map>
 #include <mutex>
@@ -54,6 +55,7 @@
 #include "storage/olap_define.h"
 #include "storage/options.h"
 #include "storage/tablet.h"
+#include "util/instrumented_mutex.h"
 #include "util/spinlock.h"
 
 namespace starrocks {
@@ -146,6 +148,10 @@ public:
     Status load_tablet_from_meta(DataDir* data_dir, TTabletId tablet_id, TSchemaHash schema_hash, std::string_view meta,
                                  bool update_meta, bool force = false, bool restore = false, bool check_path = true);
 
+    // The index of the tablet map shard of |tablet_id|. Tablets of different shards can be loaded concurrently
+    // without contending on the shard locks.
+    int64_t tablets_shard_idx(TTabletId tablet_id) const { return _get_tablets_shard_idx(tablet_id); }
+
     Status load_tablet_from_dir(DataDir* data_dir, TTabletId tablet_id, SchemaHash schema_hash,
                                 const std::string& schema_hash_path, bool force = false, bool restore = false);
 
@@ -196,6 +202,9 @@ public:
 
     std::vector<TabletAndScore> pick_tablets_to_do_pk_index_major_compaction();
 
+    // pick at most |num| running primary key tablets, the most recently written first
+    std::vector<TabletSharedPtr> pick_tablets_to_preload_primary_index(size_t num);
+
     Status generate_pk_dump();
 
 private:
@@ -203,9 +212,16 @@ private:
     using TabletSet = std::unordered_set<int64_t>;
 
     struct TabletsShard {
-        mutable std::shared_mutex lock;
+        ~TabletsShard() { delete snapshot.load(std::memory_order_relaxed); }
+
+        mutable InstrumentedSharedMutex<> lock{LOCK_SITE("TabletManager::TabletsShard")};
         TabletMap tablet_map;
         TabletSet tablets_under_clone;
+        // A read-only copy of tablet_map for the lookups that do not take the lock, null after tablet_map is
+        // changed. Writers unlink it under the exclusive lock, and a reader holding the shared lock takes a new one.
+        // Unlinked copies are freed by EpochReclaimer.
+        std::atomic<const TabletMap*> snapshot{nullptr};
+        std::atomic<bool> taking_snapshot{false};
     };
 
     struct DroppedTabletInfo {
@@ -243,6 +259,14 @@ private:
 
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id);
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id, bool include_deleted, std::string* err);
+    // Look up |tablet_id| without taking the shard lock. Return false if the snapshot of the shard is stale.
+    bool _get_tablet_from_snapshot(TTabletId tablet_id, TabletSharedPtr* tablet);
+    // Look up |tablet_id| with the shard lock held in shared mode, and take a new snapshot if it is stale.
+    TabletSharedPtr _get_tablet_and_take_snapshot_unlocked(TTabletId tablet_id);
+    // Apply |include_deleted| and the checks of the tablet state to the tablet found in the tablet map.
+    TabletSharedPtr _check_tablet(TTabletId tablet_id, TabletSharedPtr tablet, bool include_deleted, std::string* err);
+    // Called after the tablet map of the shard is changed, with the shard lock held in exclusive mode.
+    static void _invalidate_snapshot_unlocked(TabletsShard& shard);
 
     TabletSharedPtr _internal_create_tablet_unlocked(AlterTabletType alter_type, const TCreateTabletReq& request,
                                                      bool is_schema_change, const Tablet* base_tablet,
@@ -259,7 +283,7 @@ private:
 
     void _remove_tablet_from_partition(const Tablet& tablet);
 
-    std::shared_mutex& _get_tablets_shard_lock(TTabletId tabletId);
+    InstrumentedSharedMutex<>& _get_tablets_shard_lock(TTabletId tabletId);
 
     TabletMap& _get_tablet_map(TTabletId tablet_id);
 
@@ -214,6 +214,7 @@ Status TabletReader::_init_collector_for_pk_index_read() {
     rs_opts.use_page_cache = _reader_params->use_page_cache;
     rs_opts.tablet_schema = _tablet_schema;
     rs_opts.global_dictmaps = _reader_params->global_dictmaps;
+    rs_opts.global_dict_versions = _reader_params->global_dict_versions;
     rs_opts.unused_output_column_ids = _reader_params->unused_output_column_ids;
     rs_opts.runtime_range_pruner = _reader_params->runtime_range_pruner;
     // single row fetch, no need to use delvec
@@ -288,6 +289,7 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.use_page_cache = params.use_page_cache;
     rs_opts.tablet_schema = _tablet_schema;
     rs_opts.global_dictmaps = params.global_dictmaps;
+    rs_opts.global_dict_versions = params.global_dict_versions;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
     rs_opts.runtime_range_pruner = params.runtime_range_pruner;
     rs_opts.column_access_paths = params.column_access_paths;
@@ -300,6 +302,10 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.short_key_ranges_option = params.short_key_ranges_option;
     rs_opts.asc_hint = _is_asc_hint;
     rs_opts.prune_column_after_index_filter = params.prune_column_after_index_filter;
+    // Aggregate and unique key tables merge rows across rowsets, so the nearest rows of a segment may be replaced.
+    if (keys_type == KeysType::DUP_KEYS || keys_type == KeysType::PRIMARY_KEYS) {
+        rs_opts.vector_search = params.vector_search;
+    }
 
     SCOPED_RAW_TIMER(&_stats.create_segment_iter_ns);
     for (auto& rowset : _rowsets) {
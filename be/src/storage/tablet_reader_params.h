@@ -26,6 +26,7 @@
 #include "storage/olap_runtime_range_pruner.h"
 #include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/tuple.h"
+#include "storage/vector_search_option.h"
 
 namespace starrocks {
 
@@ -75,6 +76,8 @@ struct TabletReaderParams {
     int chunk_size = 1024;
 
     ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
+    // versions of the global dicts in |global_dictmaps|, may be null
+    const ColumnIdToGlobalDictVersion* global_dict_versions = nullptr;
     const std::unordered_set<uint32_t>* unused_output_column_ids = &EMPTY_FILTERED_COLUMN_IDS;
 
     RowidRangeOptionPtr rowid_range_option = nullptr;
@@ -93,6 +96,8 @@ struct TabletReaderParams {
 
     bool prune_column_after_index_filter = false;
 
+    VectorSearchOptionPtr vector_search;
+
 public:
     std::string to_string() const;
 };
@@ -44,6 +44,7 @@
 #include "storage/merge_iterator.h"
 #include "storage/persistent_index.h"
 #include "storage/primary_key_dump.h"
+#include "storage/row_cache.h"
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_meta_manager.h"
@@ -77,7 +78,8 @@ std::string EditVersion::to_string() const {
     }
 }
 
-TabletUpdates::TabletUpdates(Tablet& tablet) : _tablet(tablet), _unused_rowsets(UINT64_MAX) {}
+TabletUpdates::TabletUpdates(Tablet& tablet)
+        : _tablet(tablet), _unused_rowsets(UINT64_MAX), _row_cache_generation(RowCache::next_generation()) {}
 
 TabletUpdates::~TabletUpdates() {
     _stop_and_wait_apply_done();
@@ -368,6 +370,7 @@ Status TabletUpdates::_load_from_pb(const TabletUpdatesPB& tablet_updates_pb) {
     StorageEngine::instance()->update_manager()->clear_cached_del_vec(tsids_vec);
     StorageEngine::instance()->update_manager()->clear_cached_delta_column_group(tsids_vec);
     StorageEngine::instance()->update_manager()->index_cache().try_remove_by_key(_tablet.tablet_id());
+    _invalidate_row_cache();
 
     _update_total_stats(_edit_version_infos[_apply_version_idx]->rowsets, nullptr, nullptr);
     VLOG(1) << "load tablet " << _debug_string(false, true);
@@ -901,7 +904,9 @@ void TabletUpdates::do_apply() {
             {
                 StarRocksMetrics::instance()->update_rowset_commit_apply_total.increment(1);
                 SCOPED_RAW_TIMER(&duration_ns);
+                _row_cache_seq.fetch_add(1);
                 _apply_rowset_commit(*version_info_apply);
+                _row_cache_seq.fetch_add(1);
             }
             StarRocksMetrics::instance()->update_rowset_commit_apply_duration_us.increment(duration_ns / 1000);
         } else if (version_info_apply->compaction) {
@@ -1089,6 +1094,8 @@ void TabletUpdates::_apply_column_partial_update_commit(const EditVersionInfo& v
         return;
     }
     _pk_index_write_amp_score.store(PersistentIndex::major_compaction_score(index_meta));
+    // The delta column files change the values of the rows in place.
+    _invalidate_row_cache();
 
     _update_total_stats(version_info.rowsets, nullptr, nullptr);
 }
@@ -1297,6 +1304,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                 }
                 manager->index_cache().update_object_size(index_entry, index.memory_usage());
                 if (delete_pks != nullptr) {
+                    _erase_row_cache(*delete_pks);
                     st = index.erase(*delete_pks, &new_deletes);
                     if (!st.ok()) {
                         std::string msg = strings::Substitute("_apply_rowset_commit error: index erase failed: $0 $1",
@@ -1322,6 +1330,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
             }
             auto& deletes = state.deletes();
             delete_op += deletes[i]->size();
+            _erase_row_cache(*deletes[i]);
             st = index.erase(*deletes[i], &new_deletes);
             if (!st.ok()) {
                 std::string msg = strings::Substitute("_apply_rowset_commit error: index erase failed: $0 $1",
@@ -1377,6 +1386,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                     }
                     manager->index_cache().update_object_size(index_entry, index.memory_usage());
                     if (delete_pks != nullptr) {
+                        _erase_row_cache(*delete_pks);
                         st = index.erase(*delete_pks, &new_deletes);
                         if (!st.ok()) {
                             std::string msg =
@@ -1402,6 +1412,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                 }
                 auto& deletes = state.deletes();
                 delete_op += deletes[loaded_delfile]->size();
+                _erase_row_cache(*deletes[loaded_delfile]);
                 st = index.erase(*deletes[loaded_delfile], &new_deletes);
                 if (!st.ok()) {
                     std::string msg = strings::Substitute("_apply_rowset_commit error: index erase failed: $0 $1",
@@ -1700,6 +1711,7 @@ Status TabletUpdates::_wait_for_version(const EditVersion& version, int64_t time
 Status TabletUpdates::_do_update(uint32_t rowset_id, int32_t upsert_idx, int32_t condition_column, int64_t read_version,
                                  const std::vector<ColumnUniquePtr>& upserts, PrimaryIndex& index, int64_t tablet_id,
                                  DeletesMap* new_deletes, const TabletSchemaCSPtr& tablet_schema) {
+    _erase_row_cache(*upserts[upsert_idx]);
     if (condition_column >= 0) {
         auto tablet_column = tablet_schema->column(condition_column);
         std::vector<uint32_t> read_column_ids;
@@ -3190,6 +3202,23 @@ void TabletUpdates::_calc_compaction_score(RowsetStats* stats) {
             (cost_record_read + cost_record_write) * delete_bytes - cost_record_write * stats->byte_size;
 }
 
+void TabletUpdates::_erase_row_cache(const Column& pks) {
+    auto* row_cache = RowCache::instance();
+    if (row_cache == nullptr) {
+        return;
+    }
+    auto prefix = RowCache::key_prefix(_tablet.tablet_id(), _row_cache_generation.load());
+    for (size_t i = 0; i < pks.size(); i++) {
+        row_cache->erase(RowCache::key(prefix, pks, i));
+    }
+}
+
+void TabletUpdates::_invalidate_row_cache() {
+    _row_cache_seq.fetch_add(1);
+    _row_cache_generation.store(RowCache::next_generation());
+    _row_cache_seq.fetch_add(1);
+}
+
 size_t TabletUpdates::_get_rowset_num_deletes(uint32_t rowsetid) {
     auto rowset = _get_rowset(rowsetid);
     return (rowset == nullptr) ? 0 : _get_rowset_num_deletes(*rowset);
@@ -3463,6 +3492,36 @@ void TabletUpdates::_set_error(const string& msg) {
     _apply_version_changed.notify_all();
 }
 
+bool TabletUpdates::has_no_data_committed_between(int64_t from_version, int64_t to_version) const {
+    if (_error) {
+        return false;
+    }
+    std::lock_guard lg(_lock);
+    if (_edit_version_infos.empty() || _edit_version_infos[0]->version.major_number() > from_version ||
+        _edit_version_infos[_apply_version_idx]->version.major_number() < to_version) {
+        return false;
+    }
+    std::lock_guard<std::mutex> rowsets_lg(_rowsets_lock);
+    for (size_t i = 0; i <= _apply_version_idx; i++) {
+        const auto& vi = _edit_version_infos[i];
+        const int64_t major = vi->version.major_number();
+        if (major <= from_version || major > to_version || vi->compaction != nullptr) {
+            continue;
+        }
+        // A version without deltas is not a rowset commit (e.g. a cloned version), so data may be changed by it.
+        if (vi->deltas.empty()) {
+            return false;
+        }
+        for (uint32_t rsid : vi->deltas) {
+            auto itr = _rowsets.find(rsid);
+            if (itr == _rowsets.end() || itr->second->has_data_files()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 RowsetSharedPtr TabletUpdates::get_delta_rowset(int64_t version) const {
     if (_error) {
         LOG(WARNING) << strings::Substitute("get_delta_rowset failed, tablet updates is in error state: tablet:$0 $1",
@@ -4504,6 +4563,30 @@ Status TabletUpdates::pk_index_major_compaction() {
     return st;
 }
 
+Status TabletUpdates::preload_primary_index() {
+    if (_error) {
+        return Status::InternalError(strings::Substitute("tablet $0 is in error state", _tablet.tablet_id()));
+    }
+    auto manager = StorageEngine::instance()->update_manager();
+    auto index_entry = manager->index_cache().get_or_create(_tablet.tablet_id());
+    index_entry->update_expire_time(MonotonicMillis() + manager->get_index_cache_expire_ms(_tablet));
+    auto& index = index_entry->value();
+
+    auto st = Status::OK();
+    {
+        std::lock_guard lg(_index_lock);
+        st = index.load(&_tablet);
+    }
+    if (!st.ok()) {
+        // remove index entry when loading fail
+        manager->index_cache().remove(index_entry);
+        return st;
+    }
+    manager->index_cache().update_object_size(index_entry, index.memory_usage());
+    manager->index_cache().release(index_entry);
+    return Status::OK();
+}
+
 void TabletUpdates::_to_updates_pb_unlocked(TabletUpdatesPB* updates_pb) const {
     updates_pb->Clear();
     for (const auto& version : _edit_version_infos) {
@@ -4794,6 +4877,7 @@ Status TabletUpdates::load_snapshot(const SnapshotMeta& snapshot_meta, bool rest
         index_entry->update_expire_time(MonotonicMillis() + manager->get_index_cache_expire_ms(_tablet));
         index_entry->value().unload();
         index_cache.release(index_entry);
+        _invalidate_row_cache();
 
         LOG(INFO) << "load full snapshot done " << _debug_string(false) << ss.str();
 
@@ -4866,6 +4950,7 @@ Status TabletUpdates::clear_meta() {
     STLClearObject(&_rowset_stats);
     // If this get cleared, every other thread that uses variable should recheck it's valid state after acquiring _lock
     STLClearObject(&_edit_version_infos);
+    _invalidate_row_cache();
     return Status::OK();
 }
 
@@ -5392,6 +5477,7 @@ Status TabletUpdates::recover() {
     }
     LOG(INFO) << "Primary tablet rebuild rowset stats finish. tablet_id: " << _tablet.tablet_id();
 
+    _invalidate_row_cache();
     // reset error state
     _error_msg = "";
     _error = false;
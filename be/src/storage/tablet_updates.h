@@ -224,6 +224,17 @@ public:
     // |version| does not need to be applied.
     RowsetSharedPtr get_delta_rowset(int64_t version) const;
 
+    // Return true, if no data has been committed in the versions (from_version, to_version], that is, each applied
+    // edit version in between is either a compaction or a commit of empty rowsets.
+    // Return false, if there is such data, or the edit versions are not applied or have been expired.
+    bool has_no_data_committed_between(int64_t from_version, int64_t to_version) const;
+
+    // The rows of this tablet in the RowCache are keyed by the generation. A reader may populate the rows read at the
+    // latest applied version only if the sequence is even, and the sequence is unchanged after the population,
+    // otherwise it must erase the rows it populated.
+    uint64_t row_cache_seq() const { return _row_cache_seq.load(); }
+    int64_t row_cache_generation() const { return _row_cache_generation.load(); }
+
     // Wait until |version| been applied.
     Status get_applied_rowsets(int64_t version, std::vector<RowsetSharedPtr>* rowsets,
                                EditVersion* full_version = nullptr);
@@ -342,6 +353,10 @@ public:
 
     Status pk_index_major_compaction();
 
+    // Load the primary index of this tablet into the index cache ahead of the first write, used to
+    // preload the indexes of recently written tablets after a restart.
+    Status preload_primary_index();
+
     // get the max rowset creation time for largest major version
     int64_t max_rowset_creation_time();
 
@@ -424,6 +439,11 @@ private:
                       const std::vector<ColumnUniquePtr>& upserts, PrimaryIndex& index, int64_t tablet_id,
                       DeletesMap* new_deletes, const TabletSchemaCSPtr& tablet_schema);
 
+    // Erase the rows of the encoded primary keys |pks| from the RowCache.
+    void _erase_row_cache(const Column& pks);
+    // Make all the rows of this tablet in the RowCache unreachable.
+    void _invalidate_row_cache();
+
     // This method will acquire |_lock|.
     size_t _get_rowset_num_deletes(uint32_t rowsetid);
 
@@ -545,6 +565,10 @@ private:
     // keep the scene(internal state) unchanged for further investigation, and don't crash
     // the whole BE, and more more operation on this tablet is allowed
     std::atomic<bool> _error{false};
+
+    // See RowCache, the sequence is odd while a rowset commit is being applied.
+    std::atomic<uint64_t> _row_cache_seq{0};
+    std::atomic<int64_t> _row_cache_generation{0};
     std::string _error_msg;
 
     std::atomic<double> _pk_index_write_amp_score{0.0};
@@ -37,8 +37,12 @@
 #include <fmt/format.h>
 #include <sys/stat.h>
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 #include <set>
+#include <thread>
+#include <vector>
 
 #include "agent/agent_common.h"
 #include "agent/finish_task.h"
@@ -578,10 +582,10 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
+    std::atomic<uint64_t> total_file_size = 0;
     MonotonicStopWatch watch;
     watch.start();
-    for (int i = 0; i < file_name_list.size(); ++i) {
+    auto download_file = [&](size_t i) -> Status {
         std::string& file_name = file_name_list[i];
         auto remote_file_url = remote_url_prefix + file_name;
 
@@ -621,8 +625,9 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             RETURN_IF_ERROR(client->download(local_file_path));
 
             // Check file length
-            uint64_t local_file_size = std::filesystem::file_size(local_file_path);
-            if (local_file_size != file_size) {
+            std::error_code ec;
+            uint64_t local_file_size = std::filesystem::file_size(local_file_path, ec);
+            if (ec || local_file_size != file_size) {
                 LOG(WARNING) << "Fail to download " << remote_file_url << ". file_size=" << local_file_size << "/"
                              << file_size;
                 return Status::InternalError("mismatched file size");
@@ -630,17 +635,58 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
             return Status::OK();
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    // All the files but the last one, which is the header file, are downloaded by up to
+    // clone_download_parallelism threads, the header file is downloaded after all of them succeed.
+    const size_t num_parallel_files = file_name_list.empty() ? 0 : file_name_list.size() - 1;
+    const int parallelism =
+            std::max(1, std::min<int>(config::clone_download_parallelism, static_cast<int>(num_parallel_files)));
+    std::atomic<size_t> next_file = 0;
+    std::mutex status_mutex;
+    Status download_status;
+    auto download_worker = [&]() {
+        while (true) {
+            size_t i = next_file.fetch_add(1);
+            if (i >= num_parallel_files) {
+                return;
+            }
+            Status st = StorageEngine::instance()->bg_worker_stopped()
+                                ? Status::InternalError("Process is going to quit. The download will stop.")
+                                : download_file(i);
+            if (!st.ok()) {
+                std::lock_guard l(status_mutex);
+                if (download_status.ok()) {
+                    download_status = std::move(st);
+                }
+                // Let the other workers stop after their current files.
+                next_file = num_parallel_files;
+                return;
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int i = 1; i < parallelism; i++) {
+        workers.emplace_back(download_worker);
+    }
+    download_worker();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    RETURN_IF_ERROR(download_status);
+    if (!file_name_list.empty()) {
+        RETURN_IF_ERROR(download_file(file_name_list.size() - 1));
+    }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
     if (total_time_ms > 0) {
-        copy_rate = total_file_size / ((double)total_time_ms) / 1000;
+        copy_rate = total_file_size.load() / ((double)total_time_ms) / 1000;
     }
-    LOG(INFO) << "Copied tablet " << _signature << " files=" << file_name_list.size() << ". bytes=" << total_file_size
-              << " cost=" << total_time_ms << " ms"
+    LOG(INFO) << "Copied tablet " << _signature << " files=" << file_name_list.size()
+              << ". bytes=" << total_file_size.load() << " cost=" << total_time_ms << " ms"
               << " rate=" << copy_rate << " MB/s";
     return Status::OK();
 }
@@ -29,6 +29,7 @@
 #include "storage/tablet_meta_manager.h"
 #include "util/pretty_printer.h"
 #include "util/starrocks_metrics.h"
+#include "util/stopwatch.hpp"
 #include "util/time.h"
 
 namespace starrocks {
@@ -103,6 +104,9 @@ Status UpdateManager::init() {
             config::get_pindex_worker_count > max_thread_cnt ? config::get_pindex_worker_count : max_thread_cnt * 2;
     RETURN_IF_ERROR(
             ThreadPoolBuilder("get_pindex").set_max_threads(max_get_thread_cnt).build(&_get_pindex_thread_pool));
+    RETURN_IF_ERROR(ThreadPoolBuilder("preload_pindex")
+                            .set_max_threads(std::max(1, config::pindex_preload_worker_count))
+                            .build(&_preload_pindex_thread_pool));
 
     _persistent_index_compaction_mgr = std::make_unique<PersistentIndexCompactionManager>();
     RETURN_IF_ERROR(_persistent_index_compaction_mgr->init());
@@ -110,6 +114,9 @@ Status UpdateManager::init() {
 }
 
 void UpdateManager::stop() {
+    if (_preload_pindex_thread_pool) {
+        _preload_pindex_thread_pool->shutdown();
+    }
     if (_get_pindex_thread_pool) {
         _get_pindex_thread_pool->shutdown();
     }
@@ -118,6 +125,30 @@ void UpdateManager::stop() {
     }
 }
 
+Status UpdateManager::preload_primary_indexes(const std::vector<TabletSharedPtr>& tablets) {
+    for (const auto& tablet : tablets) {
+        RETURN_IF_ERROR(_preload_pindex_thread_pool->submit_func([this, tablet]() {
+            if (_index_cache.size() * 2 >= _index_cache.capacity()) {
+                return;
+            }
+            if (tablet->tablet_state() != TABLET_RUNNING) {
+                return;
+            }
+            MonotonicStopWatch watch;
+            watch.start();
+            auto st = tablet->updates()->preload_primary_index();
+            if (!st.ok()) {
+                LOG(WARNING) << "preload primary index failed, tablet: " << tablet->tablet_id() << " " << st;
+                return;
+            }
+            VLOG(1) << "preload primary index, tablet: " << tablet->tablet_id()
+                    << " cost: " << watch.elapsed_time() / 1000000 << "ms";
+        }));
+    }
+    LOG(INFO) << "submit " << tablets.size() << " tablets to preload primary index";
+    return Status::OK();
+}
+
 int64_t UpdateManager::get_index_cache_expire_ms(const Tablet& tablet) const {
     const int32_t tablet_index_cache_expire_sec = tablet.tablet_meta()->get_primary_index_cache_expire_sec();
     if (tablet_index_cache_expire_sec > 0) {
@@ -180,6 +211,11 @@ Status UpdateManager::get_del_vec(KVStore* meta, const TabletSegmentId& tsid, in
                 *pdelvec = itr->second;
                 return Status::OK();
             }
+            auto prev_itr = _prev_del_vec_cache.find(tsid);
+            if (prev_itr != _prev_del_vec_cache.end() && version >= prev_itr->second->version()) {
+                *pdelvec = prev_itr->second;
+                return Status::OK();
+            }
         }
     }
     (*pdelvec).reset(new DelVector());
@@ -196,6 +232,8 @@ Status UpdateManager::get_del_vec(KVStore* meta, const TabletSegmentId& tsid, in
             _del_vec_cache_mem_tracker->release(itr->second->memory_usage());
             itr->second = (*pdelvec);
             _del_vec_cache_mem_tracker->consume(itr->second->memory_usage());
+            // The replaced one may not be the version right before the latest one.
+            _erase_prev_del_vec(tsid);
         }
     }
     return Status::OK();
@@ -216,6 +254,7 @@ void UpdateManager::clear_cache() {
     {
         std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
         _del_vec_cache.clear();
+        _prev_del_vec_cache.clear();
         if (_del_vec_cache_mem_tracker) {
             _del_vec_cache_mem_tracker->release(_del_vec_cache_mem_tracker->consumption());
         }
@@ -239,6 +278,15 @@ void UpdateManager::clear_cached_del_vec(const std::vector<TabletSegmentId>& tsi
             _del_vec_cache_mem_tracker->release(itr->second->memory_usage());
             _del_vec_cache.erase(itr);
         }
+        _erase_prev_del_vec(tsid);
+    }
+}
+
+void UpdateManager::_erase_prev_del_vec(const TabletSegmentId& tsid) {
+    auto itr = _prev_del_vec_cache.find(tsid);
+    if (itr != _prev_del_vec_cache.end()) {
+        _del_vec_cache_mem_tracker->release(itr->second->memory_usage());
+        _prev_del_vec_cache.erase(itr);
     }
 }
 
@@ -374,6 +422,13 @@ void UpdateManager::expire_cache() {
     if (MonotonicMillis() - _last_clear_expired_cache_millis > _cache_expire_ms) {
         _update_state_cache.clear_expired();
         _update_column_state_cache.clear_expired();
+        {
+            std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
+            for (const auto& [tsid, delvec] : _prev_del_vec_cache) {
+                _del_vec_cache_mem_tracker->release(delvec->memory_usage());
+            }
+            _prev_del_vec_cache.clear();
+        }
 
         ssize_t orig_size = _index_cache.size();
         ssize_t orig_obj_size = _index_cache.object_size();
@@ -482,7 +537,10 @@ Status UpdateManager::set_cached_del_vec(const TabletSegmentId& tsid, const DelV
             LOG(ERROR) << msg;
             return Status::InternalError(msg);
         } else {
-            _del_vec_cache_mem_tracker->release(itr->second->memory_usage());
+            // The replaced delvec is still valid for the versions before the new one, keep it for the queries
+            // on them instead of releasing it.
+            _erase_prev_del_vec(tsid);
+            _prev_del_vec_cache[tsid] = std::move(itr->second);
             itr->second = delvec;
             _del_vec_cache_mem_tracker->consume(itr->second->memory_usage());
         }
@@ -95,6 +95,11 @@ public:
 
     ThreadPool* apply_thread_pool() { return _apply_thread_pool.get(); }
     ThreadPool* get_pindex_thread_pool() { return _get_pindex_thread_pool.get(); }
+    ThreadPool* preload_pindex_thread_pool() { return _preload_pindex_thread_pool.get(); }
+
+    // Load the primary indexes of |tablets| in background, in the order of |tablets|. The preloading
+    // stops once the index cache is half full, to leave room for the indexes of the tablets being written.
+    Status preload_primary_indexes(const std::vector<std::shared_ptr<Tablet>>& tablets);
     PersistentIndexCompactionManager* get_pindex_compaction_mgr() { return _persistent_index_compaction_mgr.get(); }
 
     DynamicCache<uint64_t, PrimaryIndex>& index_cache() { return _index_cache; }
@@ -150,6 +155,9 @@ public:
     bool TEST_primary_index_refcnt(int64_t tablet_id, uint32_t expected_cnt);
 
 private:
+    // Requires |_del_vec_cache_lock|.
+    void _erase_prev_del_vec(const TabletSegmentId& tsid);
+
     // default 6min
     int64_t _cache_expire_ms = 360000;
 
@@ -169,6 +177,10 @@ private:
     // DelVector related states
     std::mutex _del_vec_cache_lock;
     std::unordered_map<TabletSegmentId, DelVectorPtr> _del_vec_cache;
+    // The delvec replaced by the latest one of each segment in |_del_vec_cache|, which is valid for the versions
+    // between them. Queries on the snapshot right before the latest apply are common while loading, they share it
+    // instead of loading and deserializing the delvec from meta. It is dropped when the cache expires.
+    std::unordered_map<TabletSegmentId, DelVectorPtr> _prev_del_vec_cache;
     std::unique_ptr<MemTracker> _del_vec_cache_mem_tracker;
 
     // Delta Column Group cache, dcg is short for `Delta Column Group`
@@ -178,6 +190,7 @@ private:
 
     std::unique_ptr<ThreadPool> _apply_thread_pool;
     std::unique_ptr<ThreadPool> _get_pindex_thread_pool;
+    std::unique_ptr<ThreadPool> _preload_pindex_thread_pool;
     std::unique_ptr<PersistentIndexCompactionManager> _persistent_index_compaction_mgr;
 
     bool _keep_pindex_bf = true;
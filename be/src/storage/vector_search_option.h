@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <fmt/format.h>
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "common/statusor.h"
+#include "gen_cpp/segment.pb.h"
+
+namespace starrocks {
+
+// Search the vector index of a column for the candidates of `ORDER BY metric(column, query_vector) LIMIT k`.
+// It is only valid when nothing but the vector index filters the rows of the scan, the segment iterators
+// keep the k nearest rows of each segment and the rows not indexed, the sort above computes the exact order.
+struct VectorSearchOption {
+    int32_t column_uid = -1;
+    std::vector<float> query_vector;
+    VectorIndexMetricPB metric = L2_DISTANCE;
+    uint32_t k = 0;
+    // Width of the search on layer 0, 0 means the default of the index.
+    uint32_t ef_search = 0;
+};
+
+using VectorSearchOptionPtr = std::shared_ptr<const VectorSearchOption>;
+
+inline StatusOr<VectorIndexMetricPB> vector_metric_from_string(std::string_view name) {
+    if (name == "l2_distance") {
+        return L2_DISTANCE;
+    }
+    if (name == "cosine_similarity") {
+        return COSINE_SIMILARITY;
+    }
+    return Status::InvalidArgument(fmt::format("unknown vector index metric type: {}", name));
+}
+
+} // namespace starrocks
@@ -63,8 +63,7 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
             &output_rs_writer, _tablet_schema));
 
     std::vector<std::vector<uint32_t>> column_groups;
-    CompactionUtils::split_column_into_groups(_tablet_schema->num_columns(), _tablet_schema->sort_key_idxes(),
-                                              config::vertical_compaction_max_columns_per_group, &column_groups);
+    _split_column_into_groups(&column_groups);
     _task_info.column_group_size = column_groups.size();
 
     auto mask_buffer = std::make_unique<RowSourceMaskBuffer>(_tablet->tablet_id(), _tablet->data_dir()->path());
@@ -162,6 +161,39 @@ Status VerticalCompactionTask::_compact_column_group(bool is_key, int column_gro
     return Status::OK();
 }
 
+void VerticalCompactionTask::_split_column_into_groups(std::vector<std::vector<uint32_t>>* column_groups) {
+    const int64_t min_columns_per_group = config::vertical_compaction_max_columns_per_group;
+    const int64_t max_columns_per_group = config::vertical_compaction_max_columns_per_group_by_memory;
+    const int64_t mem_limit = config::compaction_memory_limit_per_worker;
+    if (max_columns_per_group <= min_columns_per_group || mem_limit <= 0) {
+        CompactionUtils::split_column_into_groups(_tablet_schema->num_columns(), _tablet_schema->sort_key_idxes(),
+                                                  min_columns_per_group, column_groups);
+        return;
+    }
+    int64_t total_num_rows = 0;
+    std::vector<int64_t> column_mem_footprints(_tablet_schema->num_columns(), 0);
+    for (auto& rowset : _input_rowsets) {
+        total_num_rows += rowset->num_rows();
+        for (auto& segment : rowset->segments()) {
+            for (size_t i = 0; i < _tablet_schema->num_columns(); ++i) {
+                const auto* column_reader = segment->column_with_uid(_tablet_schema->column(i).unique_id());
+                if (column_reader != nullptr) {
+                    column_mem_footprints[i] += column_reader->total_mem_footprint();
+                }
+            }
+        }
+    }
+    // the footprint of a group whose read chunk size is not lowered by the memory limit,
+    // see CompactionUtils::get_read_chunk_size()
+    size_t source_num = std::max<size_t>(1, _task_info.input_segments_num);
+    double max_row_size = static_cast<double>(mem_limit) / (source_num * config::vector_chunk_size);
+    auto max_group_mem_footprint =
+            static_cast<int64_t>(std::min(max_row_size * (total_num_rows + 1), static_cast<double>(INT64_MAX / 2)));
+    CompactionUtils::split_column_into_groups(_tablet_schema->num_columns(), _tablet_schema->sort_key_idxes(),
+                                              min_columns_per_group, max_columns_per_group, column_mem_footprints,
+                                              max_group_mem_footprint, column_groups);
+}
+
 StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group(
         const std::vector<uint32_t>& column_group) {
     int64_t total_num_rows = 0;
@@ -48,6 +48,9 @@ private:
                                    const Schema& schema, TabletReader* reader, RowsetWriter* output_rs_writer,
                                    RowSourceMaskBuffer* mask_buffer, std::vector<RowSourceMask>* source_masks);
 
+    // Split the columns into column groups, merging narrow non-key columns into wider groups within the memory limit.
+    void _split_column_into_groups(std::vector<std::vector<uint32_t>>* column_groups);
+
     StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
 };
 
@@ -216,6 +216,50 @@ BitmapValue& BitmapValue::operator|=(const BitmapValue& rhs) {
     return *this;
 }
 
+BitmapValue& BitmapValue::union_many(size_t n, const BitmapValue* const* values) {
+    std::vector<const detail::Roaring64Map*> bitmaps;
+    for (size_t i = 0; i < n; i++) {
+        if (values[i]->_type == BITMAP) {
+            bitmaps.emplace_back(values[i]->_bitmap.get());
+        }
+    }
+    // Nothing to gain from fastunion for a single bitmap, and operator|= may share it without copy.
+    if (bitmaps.size() < 2) {
+        for (size_t i = 0; i < n; i++) {
+            *this |= *values[i];
+        }
+        return *this;
+    }
+
+    _mem_usage = 0;
+    if (_type == BITMAP) {
+        bitmaps.emplace_back(_bitmap.get());
+    }
+    auto bitmap =
+            std::make_shared<detail::Roaring64Map>(detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+    if (_type == SINGLE) {
+        bitmap->add(_sv);
+    } else if (_type == SET) {
+        for (auto x : *_set) {
+            bitmap->add(x);
+        }
+        _set.reset();
+    }
+    for (size_t i = 0; i < n; i++) {
+        const BitmapValue* value = values[i];
+        if (value->_type == SINGLE) {
+            bitmap->add(value->_sv);
+        } else if (value->_type == SET) {
+            for (auto x : *value->_set) {
+                bitmap->add(x);
+            }
+        }
+    }
+    _bitmap = std::move(bitmap);
+    _type = BITMAP;
+    return *this;
+}
+
 // Note: rhs BitmapValue is only readable after this method
 // Compute the intersection between the current bitmap and the provided bitmap.
 // Possible type transitions are:
@@ -134,6 +134,11 @@ public:
     // SINGLE -> BITMAP
     BitmapValue& operator|=(const BitmapValue& rhs);
 
+    // Note: the bitmaps of |values| are only readable after this method
+    // Compute the union between the current bitmap and all the |n| bitmaps of |values| in one pass, which is much
+    // faster than calling operator|= for every one when many of them are BITMAP.
+    BitmapValue& union_many(size_t n, const BitmapValue* const* values);
+
     // Note: rhs BitmapValue is only readable after this method
     // Compute the intersection between the current bitmap and the provided bitmap.
     // Possible type transitions are:
@@ -278,6 +278,10 @@ jobject JVMFunctionHelper::create_boxed_array(int type, int num_rows, bool nulla
     return res;
 }
 
+jobject JVMFunctionHelper::create_direct_buffer_array(int sz) {
+    return _env->NewObjectArray(sz, _direct_buffer_class, nullptr);
+}
+
 jobject JVMFunctionHelper::create_object_array(jobject o, int num_rows) {
     jobjectArray res_arr = _env->NewObjectArray(num_rows, _object_array_class, o);
     return res_arr;
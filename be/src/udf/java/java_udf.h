@@ -72,6 +72,8 @@ public:
     jobject create_boxed_array(int type, int num_rows, bool nullable, DirectByteBuffer* buffs, int sz);
     // create object array with the same elements
     jobject create_object_array(jobject o, int num_rows);
+    // create a ByteBuffer array filled with null
+    jobject create_direct_buffer_array(int sz);
 
     // batch update single
     void batch_update_single(AggBatchCallStub* stub, int state, jobject* input, int cols, int rows);
@@ -455,6 +457,17 @@ struct JavaUDFContext {
     std::unique_ptr<JavaMethodDescriptor> prepare;
     std::unique_ptr<JavaMethodDescriptor> evaluate;
     std::unique_ptr<JavaMethodDescriptor> close;
+
+    // Optional vectorized entry of the UDF, which is called with the buffers of whole columns instead of
+    // the boxed values of each row:
+    //   void evaluateBatch(int numRows, ByteBuffer[] args, ByteBuffer resultNulls, ByteBuffer resultData)
+    // |args| holds three buffers for each argument: the null flags (one byte per row, 1 means null, and null
+    // if the argument is not nullable), the offsets (int32, numRows + 1, only for strings) and the data.
+    // The result is written in place, so it is only used if the result is of a fixed length type.
+    static inline const char* evaluate_batch_name = "evaluateBatch";
+    static inline const char* evaluate_batch_signature =
+            "(I[Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)V";
+    std::unique_ptr<JavaMethodDescriptor> evaluate_batch;
 };
 
 // Function
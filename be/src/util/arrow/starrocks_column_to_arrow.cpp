@@ -14,7 +14,11 @@
 
 #include "util/arrow/starrocks_column_to_arrow.h"
 
+#include <cstring>
+#include <limits>
+
 #include "column/array_column.h"
+#include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/map_column.h"
 #include "column/type_traits.h"
@@ -22,6 +26,7 @@
 #include "exec/arrow_type_traits.h"
 #include "exprs/expr.h"
 #include "runtime/large_int_value.h"
+#include "simd/simd.h"
 #include "util/raw_container.h"
 
 namespace starrocks {
@@ -594,6 +599,103 @@ private:
     std::shared_ptr<arrow::Array>& _array;
 }; // namespace starrocks
 
+// An arrow buffer sharing the memory of a column, which keeps the column alive. The column must not be modified
+// after it is shared.
+class ColumnBuffer final : public arrow::Buffer {
+public:
+    ColumnBuffer(const void* data, int64_t size, ColumnPtr column)
+            : arrow::Buffer(reinterpret_cast<const uint8_t*>(data), size), _column(std::move(column)) {}
+
+private:
+    ColumnPtr _column;
+};
+
+static bool is_shareable_fixed_width(LogicalType lt, arrow::Type::type at) {
+    switch (lt) {
+    case TYPE_TINYINT:
+        return at == arrow::Type::INT8;
+    case TYPE_SMALLINT:
+        return at == arrow::Type::INT16;
+    case TYPE_INT:
+        return at == arrow::Type::INT32;
+    case TYPE_BIGINT:
+        return at == arrow::Type::INT64;
+    case TYPE_FLOAT:
+        return at == arrow::Type::FLOAT;
+    case TYPE_DOUBLE:
+    case TYPE_TIME:
+        return at == arrow::Type::DOUBLE;
+    default:
+        return false;
+    }
+}
+
+// Convert the column into |array| without copying its data if possible, otherwise |array| is left nullptr.
+// The values of fixed width columns and the offsets and bytes of string columns have the same layout in arrow,
+// only the validity bitmap is built from the null column.
+static arrow::Status share_column_buffers(const ColumnPtr& column, const TypeDescriptor& type_desc,
+                                          const std::shared_ptr<arrow::DataType>& arrow_type, arrow::MemoryPool* pool,
+                                          std::shared_ptr<arrow::Array>* array) {
+    const Column* data_column = ColumnHelper::get_data_column(column.get());
+    const bool is_fixed_width = is_shareable_fixed_width(type_desc.type, arrow_type->id());
+    const bool is_string = (type_desc.type == TYPE_VARCHAR || type_desc.type == TYPE_CHAR) &&
+                           arrow_type->id() == arrow::Type::STRING && data_column->is_binary();
+    if (column->is_constant() || (!is_fixed_width && !is_string)) {
+        return arrow::Status::OK();
+    }
+
+    const int64_t num_rows = column->size();
+    std::shared_ptr<arrow::Buffer> validity;
+    int64_t null_count = 0;
+    if (column->has_null()) {
+        const auto& nulls = down_cast<const NullableColumn*>(column.get())->immutable_null_column_data();
+        null_count = SIMD::count_nonzero(nulls);
+        ARROW_ASSIGN_OR_RAISE(validity, arrow::AllocateBuffer((num_rows + 7) / 8, pool));
+        uint8_t* bits = validity->mutable_data();
+        memset(bits, 0, validity->size());
+        for (int64_t i = 0; i < num_rows; i++) {
+            bits[i >> 3] |= static_cast<uint8_t>(!nulls[i]) << (i & 7);
+        }
+    }
+
+    std::shared_ptr<arrow::ArrayData> data;
+    if (is_fixed_width) {
+        auto values = std::make_shared<ColumnBuffer>(data_column->raw_data(), num_rows * data_column->type_size(),
+                                                     column);
+        data = arrow::ArrayData::Make(arrow_type, num_rows, {std::move(validity), std::move(values)}, null_count);
+    } else {
+        // The uint32_t offsets of BinaryColumn are reinterpreted as the int32_t offsets of arrow::StringType.
+        const auto* binary = down_cast<const BinaryColumn*>(data_column);
+        const auto& offsets = binary->get_offset();
+        const auto& bytes = binary->get_bytes();
+        if (offsets.back() > static_cast<uint32_t>(std::numeric_limits<int32_t>::max())) {
+            return arrow::Status::OK();
+        }
+        auto offset_buffer =
+                std::make_shared<ColumnBuffer>(offsets.data(), offsets.size() * sizeof(uint32_t), column);
+        auto byte_buffer = std::make_shared<ColumnBuffer>(bytes.data(), bytes.size(), column);
+        data = arrow::ArrayData::Make(arrow_type, num_rows,
+                                      {std::move(validity), std::move(offset_buffer), std::move(byte_buffer)},
+                                      null_count);
+    }
+    *array = arrow::MakeArray(data);
+    return arrow::Status::OK();
+}
+
+static Status convert_column_to_arrow_array(const ColumnPtr& column, const TypeDescriptor& type_desc,
+                                            const std::shared_ptr<arrow::DataType>& arrow_type,
+                                            arrow::MemoryPool* pool, std::shared_ptr<arrow::Array>* array) {
+    auto arrow_st = share_column_buffers(column, type_desc, arrow_type, pool, array);
+    if (arrow_st.ok() && *array == nullptr) {
+        ColumnToArrowArrayConverter converter(column, pool, type_desc, arrow_type, *array);
+        arrow_st = arrow::VisitTypeInline(*arrow_type, &converter);
+    }
+    if (!arrow_st.ok()) {
+        return Status::InvalidArgument(arrow_st.ToString());
+    }
+    return Status::OK();
+}
+
 Status convert_chunk_to_arrow_batch(Chunk* chunk, std::vector<ExprContext*>& _output_expr_ctxs,
                                     const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                                     std::shared_ptr<arrow::RecordBatch>* result) {
@@ -612,12 +714,8 @@ Status convert_chunk_to_arrow_batch(Chunk* chunk, std::vector<ExprContext*>& _ou
             // Don't modify the column of src chunk, otherwise the memory statistics of query is invalid.
             column = ColumnHelper::copy_and_unfold_const_column(expr->type(), column->is_nullable(), column, num_rows);
         }
-        auto& array = arrays[i];
-        ColumnToArrowArrayConverter converter(column, pool, expr->type(), schema->field(i)->type(), array);
-        auto arrow_st = arrow::VisitTypeInline(*schema->field(i)->type(), &converter);
-        if (!arrow_st.ok()) {
-            return Status::InvalidArgument(arrow_st.ToString());
-        }
+        RETURN_IF_ERROR(
+                convert_column_to_arrow_array(column, expr->type(), schema->field(i)->type(), pool, &arrays[i]));
     }
     *result = arrow::RecordBatch::Make(schema, num_rows, std::move(arrays));
     return Status::OK();
@@ -641,12 +739,8 @@ Status convert_chunk_to_arrow_batch(Chunk* chunk, const std::vector<const TypeDe
             column =
                     ColumnHelper::copy_and_unfold_const_column(*slot_types[i], column->is_nullable(), column, num_rows);
         }
-        auto& array = arrays[i];
-        ColumnToArrowArrayConverter converter(column, pool, *slot_types[i], schema->field(i)->type(), array);
-        auto arrow_st = arrow::VisitTypeInline(*schema->field(i)->type(), &converter);
-        if (!arrow_st.ok()) {
-            return Status::InvalidArgument(arrow_st.ToString());
-        }
+        RETURN_IF_ERROR(
+                convert_column_to_arrow_array(column, *slot_types[i], schema->field(i)->type(), pool, &arrays[i]));
     }
     *result = arrow::RecordBatch::Make(schema, num_rows, std::move(arrays));
     return Status::OK();
@@ -0,0 +1,209 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "util/background_executor.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "common/logging.h"
+#include "util/thread.h"
+
+namespace starrocks {
+
+BackgroundExecutor::BackgroundExecutor(std::string name, int num_threads)
+        : _name(std::move(name)), _num_threads(num_threads) {
+    for (auto& state : _classes) {
+        state.max = num_threads;
+    }
+}
+
+BackgroundExecutor::~BackgroundExecutor() {
+    shutdown();
+}
+
+Status BackgroundExecutor::init() {
+    if (_num_threads <= 0) {
+        return Status::InvalidArgument(fmt::format("invalid number of threads {} for {}", _num_threads, _name));
+    }
+    for (int i = 0; i < _num_threads; i++) {
+        scoped_refptr<Thread> thread;
+        Status st = Thread::create("background executor", _name, &BackgroundExecutor::_work, this, &thread);
+        if (!st.ok()) {
+            shutdown();
+            return st;
+        }
+        _threads.emplace_back(std::move(thread));
+    }
+    return Status::OK();
+}
+
+void BackgroundExecutor::shutdown() {
+    std::deque<std::function<void()>> to_release[NUM_TASK_CLASSES];
+    {
+        std::lock_guard l(_lock);
+        _shutdown = true;
+        // Destroy the queued tasks outside of the lock, they may own resources whose release takes it.
+        for (int i = 0; i < NUM_TASK_CLASSES; i++) {
+            to_release[i].swap(_classes[i].queue);
+        }
+        _work_cond.notify_all();
+        _idle_cond.notify_all();
+    }
+    for (auto& thread : _threads) {
+        thread->join();
+    }
+    _threads.clear();
+}
+
+Status BackgroundExecutor::submit_func(TaskClass cls, std::function<void()> f) {
+    DCHECK(cls >= 0 && cls < NUM_TASK_CLASSES);
+    std::lock_guard l(_lock);
+    if (_shutdown) {
+        return Status::ServiceUnavailable(fmt::format("background executor {} has been shut down", _name));
+    }
+    _classes[cls].queue.emplace_back(std::move(f));
+    _work_cond.notify_one();
+    return Status::OK();
+}
+
+Status BackgroundExecutor::set_concurrency(TaskClass cls, int reserved, int max) {
+    DCHECK(cls >= 0 && cls < NUM_TASK_CLASSES);
+    if (reserved < 0 || reserved > max || max <= 0) {
+        return Status::InvalidArgument(
+                fmt::format("invalid concurrency of {}: reserved={} max={}", task_class_name(cls), reserved, max));
+    }
+    std::lock_guard l(_lock);
+    int total_reserved = reserved;
+    for (int i = 0; i < NUM_TASK_CLASSES; i++) {
+        if (i != cls) {
+            total_reserved += _classes[i].reserved;
+        }
+    }
+    if (total_reserved > _num_threads) {
+        return Status::InvalidArgument(fmt::format("reserved concurrency {} exceeds the {} threads of {}",
+                                                   total_reserved, _num_threads, _name));
+    }
+    _classes[cls].reserved = reserved;
+    _classes[cls].max = max;
+    // A larger limit may allow the queued tasks to run.
+    _work_cond.notify_all();
+    return Status::OK();
+}
+
+void BackgroundExecutor::wait() {
+    std::unique_lock l(_lock);
+    _idle_cond.wait(l, [this]() {
+        if (_shutdown) {
+            return _num_running == 0;
+        }
+        if (_num_running > 0) {
+            return false;
+        }
+        for (const auto& state : _classes) {
+            if (!state.queue.empty()) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+int BackgroundExecutor::num_queued_tasks(TaskClass cls) const {
+    std::lock_guard l(_lock);
+    return static_cast<int>(_classes[cls].queue.size());
+}
+
+int BackgroundExecutor::num_running_tasks(TaskClass cls) const {
+    std::lock_guard l(_lock);
+    return _classes[cls].running;
+}
+
+const char* BackgroundExecutor::task_class_name(TaskClass cls) {
+    switch (cls) {
+    case LOAD_FLUSH:
+        return "load_flush";
+    case PUBLISH:
+        return "publish";
+    case COMPACTION:
+        return "compaction";
+    case GC:
+        return "gc";
+    default:
+        return "unknown";
+    }
+}
+
+int BackgroundExecutor::_pick_class() const {
+    int unused_reserved = 0;
+    for (const auto& state : _classes) {
+        unused_reserved += std::max(0, state.reserved - state.running);
+    }
+    // Including the calling worker.
+    const int idle_threads = _num_threads - _num_running;
+    for (int i = 0; i < NUM_TASK_CLASSES; i++) {
+        const auto& state = _classes[i];
+        if (state.queue.empty() || state.running >= state.max) {
+            continue;
+        }
+        if (state.running < state.reserved) {
+            return i;
+        }
+        // Borrow an idle thread only if the reservations of the other classes can still be met.
+        if (idle_threads - 1 >= unused_reserved) {
+            return i;
+        }
+    }
+    return NUM_TASK_CLASSES;
+}
+
+void BackgroundExecutor::_work() {
+    std::unique_lock l(_lock);
+    while (true) {
+        int cls = NUM_TASK_CLASSES;
+        _work_cond.wait(l, [&]() {
+            cls = _pick_class();
+            return _shutdown || cls != NUM_TASK_CLASSES;
+        });
+        if (_shutdown) {
+            break;
+        }
+
+        auto& state = _classes[cls];
+        auto task = std::move(state.queue.front());
+        state.queue.pop_front();
+        state.running++;
+        _num_running++;
+        l.unlock();
+
+        task();
+        // Destroy the task outside of the lock.
+        task = nullptr;
+
+        l.lock();
+        state.running--;
+        _num_running--;
+        // The finished task may have been holding back the tasks of classes at their max or the reservations.
+        _work_cond.notify_all();
+        if (_num_running == 0) {
+            _idle_cond.notify_all();
+        }
+    }
+    _idle_cond.notify_all();
+}
+
+} // namespace starrocks
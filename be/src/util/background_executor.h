@@ -0,0 +1,106 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "gutil/macros.h"
+#include "gutil/ref_counted.h"
+
+namespace starrocks {
+
+class Thread;
+
+// BackgroundExecutor runs several classes of background storage tasks on one set of worker threads, so that a class
+// backed up with work can use the threads the other classes leave idle, instead of each class owning a fixed-size
+// ThreadPool whose threads can't help the others.
+//
+// Every class has a reserved and a max concurrency. A class can always run up to its reserved number of tasks, and
+// it may borrow idle threads up to its max as long as enough threads are left for the unused reservations of the
+// other classes. An idle worker runs the oldest task of the highest priority class which is allowed to run.
+//
+// By default nothing is reserved and every class may use all the threads.
+class BackgroundExecutor {
+public:
+    // Ordered by priority, from the highest.
+    enum TaskClass {
+        LOAD_FLUSH = 0,
+        PUBLISH,
+        COMPACTION,
+        GC,
+        NUM_TASK_CLASSES,
+    };
+
+    BackgroundExecutor(std::string name, int num_threads);
+    ~BackgroundExecutor();
+
+    DISALLOW_COPY_AND_MOVE(BackgroundExecutor);
+
+    // Start the worker threads.
+    Status init();
+
+    // Wait for the running tasks and then stop the workers, the queued tasks are dropped.
+    void shutdown();
+
+    Status submit_func(TaskClass cls, std::function<void()> f);
+
+    // 0 <= |reserved| <= |max|, |max| > 0, and the reserved concurrency of all the classes can't exceed num_threads().
+    Status set_concurrency(TaskClass cls, int reserved, int max);
+
+    // Wait until there is no queued or running task.
+    void wait();
+
+    int num_threads() const { return _num_threads; }
+    int num_queued_tasks(TaskClass cls) const;
+    int num_running_tasks(TaskClass cls) const;
+
+    static const char* task_class_name(TaskClass cls);
+
+private:
+    struct ClassState {
+        std::deque<std::function<void()>> queue;
+        int running = 0;
+        int reserved = 0;
+        int max = 0;
+    };
+
+    void _work();
+
+    // The class whose oldest task can be run by an idle worker now, or NUM_TASK_CLASSES if there is none.
+    // REQUIRES: _lock is held.
+    int _pick_class() const;
+
+    const std::string _name;
+    const int _num_threads;
+    std::vector<scoped_refptr<Thread>> _threads;
+
+    mutable std::mutex _lock;
+    // Waiters wake up when a task may be runnable.
+    std::condition_variable _work_cond;
+    // Waiters wake up when there is no queued or running task.
+    std::condition_variable _idle_cond;
+    bool _shutdown = false;
+    int _num_running = 0;
+    ClassState _classes[NUM_TASK_CLASSES];
+};
+
+} // namespace starrocks
@@ -194,6 +194,19 @@ public:
     template <typename T>
     int unpack_batch(int bit_width, int num_values, T* v);
 
+    // Skips 'num_values' bit-packed values without unpacking them. 'bit_width' * 'num_values' must be
+    // a multiple of 8, which is always satisfied if 'num_values' is a multiple of 32.
+    // Returns false if there are not enough bytes left.
+    bool skip_batch(int bit_width, int num_values) {
+        DCHECK_EQ(static_cast<int64_t>(bit_width) * num_values % 8, 0);
+        int64_t num_bytes = static_cast<int64_t>(bit_width) * num_values / 8;
+        if (UNLIKELY(num_bytes > _bytes_left())) {
+            return false;
+        }
+        _buffer_pos += num_bytes;
+        return true;
+    }
+
     /// Read an unsigned ULEB-128 encoded int from the stream. The encoded int must start
     /// at the beginning of a byte. Return false if there were not enough bytes in the
     /// buffer or the int is invalid. For more details on ULEB-128:
@@ -202,6 +215,9 @@ public:
     template <typename UINT_T>
     bool get_lleb_128(UINT_T* v);
 
+    // Returns the current read position in the buffer.
+    const uint8_t* buffer_pos() const { return _buffer_pos; }
+
 private:
     /// Returns the number of bytes left in the stream.
     int _bytes_left() { return _buffer_end - _buffer_pos; }
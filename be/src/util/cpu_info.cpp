@@ -42,12 +42,14 @@
 #endif
 
 #include <linux/magic.h>
+#include <pthread.h>
 #include <sched.h>
 #include <sys/sysinfo.h>
 #include <sys/vfs.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <array>
 #include <boost/algorithm/string.hpp>
 #include <cctype>
 #include <cstdlib>
@@ -335,6 +337,40 @@ void CpuInfo::_init_numa_node_to_cores() {
     }
 }
 
+int CpuInfo::get_numa_node_of_worker(int worker_id) {
+    DCHECK_GE(worker_id, 0);
+    // Nodes without cores, e.g. memory-only nodes, can't run any thread.
+    std::vector<int> nodes;
+    for (int node = 0; node < max_num_numa_nodes_; ++node) {
+        if (!numa_node_to_cores_[node].empty()) {
+            nodes.push_back(node);
+        }
+    }
+    if (nodes.size() <= 1) {
+        return -1;
+    }
+    return nodes[worker_id % nodes.size()];
+}
+
+bool CpuInfo::bind_current_thread_to_numa_node_of_worker(int worker_id) {
+    DCHECK(initialized_);
+    int node = get_numa_node_of_worker(worker_id);
+    if (node < 0) {
+        return false;
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core : numa_node_to_cores_[node]) {
+        CPU_SET(core, &cpu_set);
+    }
+    if (int err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); err != 0) {
+        LOG_FIRST_N(WARNING, 5) << "Failed to bind thread to NUMA node " << node << ", err: " << errno_to_string(err);
+        return false;
+    }
+    return true;
+}
+
 int CpuInfo::get_current_core() {
     // sched_getcpu() is not supported on some old kernels/glibcs (like the versions that
     // shipped with CentOS 5). In that case just pretend we're always running on CPU 0
@@ -383,6 +419,16 @@ void CpuInfo::_get_cache_info(long cache_sizes[NUM_CACHE_LEVELS], long cache_lin
 #endif
 }
 
+long CpuInfo::get_cache_size(CacheLevel level) {
+    static const std::array<long, NUM_CACHE_LEVELS> cache_sizes = []() {
+        std::array<long, NUM_CACHE_LEVELS> sizes{};
+        std::array<long, NUM_CACHE_LEVELS> line_sizes{};
+        _get_cache_info(sizes.data(), line_sizes.data());
+        return sizes;
+    }();
+    return std::max<long>(cache_sizes[level], 0);
+}
+
 std::string CpuInfo::debug_string() {
     DCHECK(initialized_);
     std::stringstream stream;
@@ -80,6 +80,38 @@ public:
     /// remain stable.
     static int get_current_core();
 
+    /// Returns the maximum number of NUMA nodes that will be online in the system.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the NUMA node of the core with the given index,
+    /// the core must be in range [0, GetMaxNumCores()).
+    static int get_numa_node_of_core(int core) {
+        DCHECK(core >= 0 && core < max_num_cores_) << core;
+        return core_to_numa_node_[core];
+    }
+
+    /// Returns the NUMA node that the current thread is running on. The thread may be migrated
+    /// to another node at any time, unless it is bound to a node by bind_current_thread_to_numa_node_of_worker().
+    static int get_current_numa_node() { return get_numa_node_of_core(get_current_core()); }
+
+    /// Returns the cores in the given NUMA node.
+    static const std::vector<int>& get_cores_of_numa_node(int node) {
+        DCHECK(node >= 0 && node < max_num_numa_nodes_) << node;
+        return numa_node_to_cores_[node];
+    }
+
+    /// Returns the NUMA node of the |worker_id|-th thread of a thread pool. The threads are spread
+    /// round-robin over the nodes that have cores. Returns -1 if less than two nodes have cores.
+    static int get_numa_node_of_worker(int worker_id);
+
+    /// Restricts the current thread, the |worker_id|-th thread of a thread pool, to the cores of the NUMA
+    /// node returned by get_numa_node_of_worker(), so that both the thread and the memory it first touches
+    /// stay on this node. Returns false if there is no node to bind to or the affinity cannot be set.
+    static bool bind_current_thread_to_numa_node_of_worker(int worker_id);
+
+    /// Returns the size in bytes of the given cache level, or 0 if it cannot be detected.
+    static long get_cache_size(CacheLevel level);
+
     static std::string debug_string();
 
 private:
@@ -0,0 +1,144 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/epoch_reclaimer.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace starrocks {
+
+struct EpochReclaimer::Slot {
+    // The epoch observed by the outermost guard of the owner thread, 0 if the thread holds no guard.
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<bool> in_use{false};
+    Slot* next = nullptr;
+    // The number of nested guards, only accessed by the owner thread.
+    int depth = 0;
+};
+
+// Returns the slot to the reclaimer when the thread exits.
+class EpochSlotHolder {
+public:
+    ~EpochSlotHolder() {
+        if (slot != nullptr) {
+            EpochReclaimer::instance()->_release_slot(slot);
+        }
+    }
+
+    EpochReclaimer::Slot* slot = nullptr;
+};
+
+static thread_local EpochSlotHolder tls_epoch_slot;
+
+EpochReclaimer* EpochReclaimer::instance() {
+    static EpochReclaimer reclaimer;
+    return &reclaimer;
+}
+
+EpochReclaimer::Guard::Guard() {
+    auto* reclaimer = EpochReclaimer::instance();
+    if (tls_epoch_slot.slot == nullptr) {
+        tls_epoch_slot.slot = reclaimer->_acquire_slot();
+    }
+    auto* slot = tls_epoch_slot.slot;
+    if (slot->depth++ == 0) {
+        // Pairs with the fence in reclaim(): either the reclaimer sees this epoch, or the reads of this thread
+        // after the fence see the objects unlinked before the retirement.
+        slot->epoch.store(reclaimer->_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+EpochReclaimer::Guard::~Guard() {
+    auto* slot = tls_epoch_slot.slot;
+    if (--slot->depth == 0) {
+        slot->epoch.store(0, std::memory_order_release);
+    }
+}
+
+EpochReclaimer::Slot* EpochReclaimer::_acquire_slot() {
+    for (Slot* slot = _slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+        bool expected = false;
+        if (!slot->in_use.load(std::memory_order_relaxed) &&
+            slot->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return slot;
+        }
+    }
+    auto* slot = new Slot();
+    slot->in_use.store(true, std::memory_order_relaxed);
+    Slot* head = _slots.load(std::memory_order_relaxed);
+    do {
+        slot->next = head;
+    } while (!_slots.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+    return slot;
+}
+
+void EpochReclaimer::_release_slot(Slot* slot) {
+    slot->depth = 0;
+    slot->epoch.store(0, std::memory_order_release);
+    slot->in_use.store(false, std::memory_order_release);
+}
+
+uint64_t EpochReclaimer::_min_active_epoch() const {
+    uint64_t min_epoch = std::numeric_limits<uint64_t>::max();
+    for (Slot* slot = _slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+        const uint64_t epoch = slot->epoch.load(std::memory_order_relaxed);
+        if (epoch != 0) {
+            min_epoch = std::min(min_epoch, epoch);
+        }
+    }
+    return min_epoch;
+}
+
+void EpochReclaimer::retire(std::function<void()> deleter) {
+    // Order the unlinking of the object before the scan of the slots in reclaim().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    // Guards taken from now on observe a larger epoch, and can only see the object after it was unlinked.
+    const uint64_t epoch = _epoch.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::lock_guard l(_retired_mutex);
+        _retired.push_back(Retired{epoch, std::move(deleter)});
+    }
+    reclaim();
+}
+
+void EpochReclaimer::reclaim() {
+    std::vector<Retired> reclaimable;
+    {
+        // Only the objects retired before the scan can be reclaimed, so the scan is done under the lock.
+        std::lock_guard l(_retired_mutex);
+        if (_retired.empty()) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const uint64_t min_epoch = _min_active_epoch();
+        // A guard observing epoch e may have seen the objects retired at epoch e or later.
+        auto it = std::partition(_retired.begin(), _retired.end(),
+                                 [min_epoch](const Retired& r) { return r.epoch >= min_epoch; });
+        std::move(it, _retired.end(), std::back_inserter(reclaimable));
+        _retired.erase(it, _retired.end());
+    }
+    for (auto& retired : reclaimable) {
+        retired.deleter();
+    }
+}
+
+size_t EpochReclaimer::num_retired() const {
+    std::lock_guard l(_retired_mutex);
+    return _retired.size();
+}
+
+} // namespace starrocks
@@ -0,0 +1,91 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "gutil/macros.h"
+
+namespace starrocks {
+
+// EpochReclaimer defers the destruction of objects unlinked from lock-free read paths until no reader can still
+// hold a reference to them, i.e. epoch based reclamation.
+//
+// A reader wraps its accesses to the shared objects with a Guard, which publishes the current epoch in a slot owned
+// by the thread and never blocks. A writer unlinks an object, e.g. by swapping an atomic pointer, and then retires
+// it. A retired object is destroyed once every guard that might have observed it has been released.
+//
+// Usage:
+//      // reader
+//      {
+//          EpochReclaimer::Guard guard;
+//          const Map* map = _map.load(std::memory_order_acquire);
+//          ...
+//      }
+//      // writer
+//      const Map* old = _map.exchange(new_map, std::memory_order_acq_rel);
+//      EpochReclaimer::instance()->retire([old]() { delete old; });
+class EpochReclaimer {
+public:
+    class Guard {
+    public:
+        Guard();
+        ~Guard();
+
+    private:
+        DISALLOW_COPY_AND_MOVE(Guard);
+    };
+
+    static EpochReclaimer* instance();
+
+    // Destroy the object by |deleter| once no guard taken before the call is still alive. The object must have been
+    // unlinked before the call. |deleter| and the deleters of former retired objects may run on the calling thread.
+    void retire(std::function<void()> deleter);
+
+    // Run the deleters of the retired objects that are no longer reachable by any reader.
+    void reclaim();
+
+    // The number of retired objects not destroyed yet.
+    size_t num_retired() const;
+
+private:
+    struct Slot;
+    struct Retired {
+        uint64_t epoch;
+        std::function<void()> deleter;
+    };
+
+    EpochReclaimer() = default;
+    DISALLOW_COPY_AND_MOVE(EpochReclaimer);
+
+    Slot* _acquire_slot();
+    void _release_slot(Slot* slot);
+    uint64_t _min_active_epoch() const;
+
+    friend class EpochSlotHolder;
+
+    std::atomic<uint64_t> _epoch{1};
+    // Slots are never freed, a slot released by an exited thread is reused by the next new thread.
+    std::atomic<Slot*> _slots{nullptr};
+
+    mutable std::mutex _retired_mutex;
+    std::vector<Retired> _retired;
+};
+
+} // namespace starrocks
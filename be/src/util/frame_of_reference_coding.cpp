@@ -36,6 +36,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
+#include <type_traits>
 
 #include "util/bit_util.h"
 #include "util/coding.h"
@@ -368,6 +370,29 @@ T ForDecoder<T>::decode_frame_min_value(uint32_t frame_index) {
     return min;
 }
 
+template <typename T>
+bool ForDecoder<T>::frame_bounds(uint32_t frame_index, T* lower, T* upper) {
+    if constexpr (!std::is_integral_v<T> || sizeof(T) > 8) {
+        return false;
+    } else {
+        DCHECK_LT(frame_index, _frame_count);
+        uint8_t storage_format = _storage_formats[frame_index];
+        if (storage_format == 2) {
+            return false;
+        }
+        T min = decode_frame_min_value(frame_index);
+        __int128 max_delta = (static_cast<__int128>(1) << _bit_widths[frame_index]) - 1;
+        if (storage_format == 1) {
+            // Ascending frame, each value is at most |max_delta| larger than the previous one.
+            max_delta *= frame_size(frame_index) - 1;
+        }
+        __int128 max = static_cast<__int128>(min) + max_delta;
+        *lower = min;
+        *upper = static_cast<T>(std::min<__int128>(max, std::numeric_limits<T>::max()));
+        return true;
+    }
+}
+
 template <typename T>
 T* ForDecoder<T>::copy_value(T* val, size_t count) {
     memcpy(val, &_out_buffer[_current_index % _max_frame_size], sizeof(T) * count);
@@ -163,6 +163,15 @@ public:
 
     uint32_t count() const { return _values_num; }
 
+    uint32_t frame_count() const { return _frame_count; }
+
+    uint32_t max_frame_size() const { return _max_frame_size; }
+
+    // Get the lower and upper bounds of the values in the frame |frame_index| from the
+    // frame header and bit width, without unpacking the frame.
+    // Return false when the frame keeps original values, since no bounds are known then.
+    bool frame_bounds(uint32_t frame_index, T* lower, T* upper);
+
 private:
     void bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output);
 
@@ -0,0 +1,110 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/hardware_counters.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <memory>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+static int perf_event_open(perf_event_attr* attr, pid_t pid, int cpu, int group_fd, unsigned long flags) {
+    return static_cast<int>(syscall(__NR_perf_event_open, attr, pid, cpu, group_fd, flags));
+}
+
+static const uint64_t kEventConfigs[HardwareCounters::NUM_EVENTS] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+const char* HardwareCounters::event_name(Event event) {
+    switch (event) {
+    case CYCLES:
+        return "HwCycles";
+    case INSTRUCTIONS:
+        return "HwInstructions";
+    case LLC_MISSES:
+        return "HwLLCMisses";
+    case BRANCH_MISSES:
+        return "HwBranchMisses";
+    default:
+        return "Unknown";
+    }
+}
+
+HardwareCounters* HardwareCounters::current_thread() {
+    thread_local std::unique_ptr<HardwareCounters> tls_counters;
+    thread_local bool tls_opened = false;
+    if (!tls_opened) {
+        tls_opened = true;
+        std::unique_ptr<HardwareCounters> counters(new HardwareCounters());
+        if (counters->_open()) {
+            tls_counters = std::move(counters);
+        }
+    }
+    return tls_counters.get();
+}
+
+HardwareCounters::~HardwareCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+bool HardwareCounters::_open() {
+    for (int i = 0; i < NUM_EVENTS; i++) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = kEventConfigs[i];
+        // The group is enabled at once by the leader.
+        attr.disabled = i == 0 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        _fds[i] = perf_event_open(&attr, 0, -1, i == 0 ? -1 : _fds[0], 0);
+        if (_fds[i] < 0) {
+            LOG_FIRST_N(WARNING, 1) << "hardware counter " << event_name(static_cast<Event>(i))
+                                    << " is not available: " << strerror(errno);
+            return false;
+        }
+    }
+    return ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == 0;
+}
+
+bool HardwareCounters::read(Values* values) const {
+    struct {
+        uint64_t nr;
+        uint64_t values[NUM_EVENTS];
+    } group;
+    if (::read(_fds[0], &group, sizeof(group)) != sizeof(group) || group.nr != NUM_EVENTS) {
+        return false;
+    }
+    memcpy(values->data(), group.values, sizeof(group.values));
+    return true;
+}
+
+} // namespace starrocks
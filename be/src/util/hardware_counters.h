@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "gutil/macros.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// The hardware counters of the calling thread, read through perf_event_open(2). All the events are opened as
+// one group, so that they are scheduled onto the PMU together and cover exactly the same instructions.
+class HardwareCounters {
+public:
+    enum Event { CYCLES = 0, INSTRUCTIONS, LLC_MISSES, BRANCH_MISSES, NUM_EVENTS };
+    using Values = std::array<uint64_t, NUM_EVENTS>;
+
+    static const char* event_name(Event event);
+
+    // Return the counters of the current thread, which are opened on the first call. Return nullptr if they are
+    // not available, e.g. without PMU in a VM or denied by kernel.perf_event_paranoid.
+    static HardwareCounters* current_thread();
+
+    ~HardwareCounters();
+
+    // Read the user-space counts accumulated since the counters are opened.
+    bool read(Values* values) const;
+
+private:
+    HardwareCounters() = default;
+    DISALLOW_COPY_AND_MOVE(HardwareCounters);
+
+    bool _open();
+
+    std::array<int, NUM_EVENTS> _fds{-1, -1, -1, -1};
+};
+
+using HardwareProfileCounters = std::array<RuntimeProfile::Counter*, HardwareCounters::NUM_EVENTS>;
+
+// Add the hardware counts of the current thread during the scope to |counters|, does nothing if |counters|
+// is nullptr or the counters are not available.
+class ScopedHardwareCounters {
+public:
+    explicit ScopedHardwareCounters(const HardwareProfileCounters* counters) {
+        if (counters != nullptr && (_hw_counters = HardwareCounters::current_thread()) != nullptr &&
+            _hw_counters->read(&_start)) {
+            _counters = counters;
+        }
+    }
+
+    ~ScopedHardwareCounters() {
+        HardwareCounters::Values end;
+        if (_counters == nullptr || !_hw_counters->read(&end)) {
+            return;
+        }
+        for (int i = 0; i < HardwareCounters::NUM_EVENTS; i++) {
+            COUNTER_UPDATE((*_counters)[i], end[i] - _start[i]);
+        }
+    }
+
+    DISALLOW_COPY_AND_MOVE(ScopedHardwareCounters);
+
+private:
+    const HardwareProfileCounters* _counters = nullptr;
+    HardwareCounters* _hw_counters = nullptr;
+    HardwareCounters::Values _start;
+};
+
+} // namespace starrocks
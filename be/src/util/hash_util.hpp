@@ -44,8 +44,15 @@
 #ifdef __SSE4_2__
 #include <nmmintrin.h>
 #endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 #include <zlib.h>
 
+#include <cstring>
+
 #include "gen_cpp/Types_types.h"
 #include "storage/decimal12.h"
 #include "storage/uint24.h"
@@ -211,6 +218,81 @@ public:
         return hash;
     }
 
+    // Same as `hashes[i] = fnv_hash(&data[i], sizeof(T), hashes[i])` for every i in [0, n),
+    // but vectorized over rows for the fixed-width types of 1, 2, 4 or 8 bytes.
+    template <typename T>
+    static void fnv_hash_batch(const T* data, uint32_t* hashes, size_t n) {
+        static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+        size_t i = 0;
+#ifdef __AVX2__
+        const __m256i prime = _mm256_set1_epi32(FNV_PRIME);
+        const __m256i byte_mask = _mm256_set1_epi32(0xff);
+        // hash the lowest |bytes| bytes of every lane, from the low byte to the high byte
+        auto hash_bytes = [&](__m256i hash, __m256i value, int bytes) {
+            for (int k = 0; k < bytes; ++k) {
+                hash = _mm256_mullo_epi32(_mm256_xor_si256(hash, _mm256_and_si256(value, byte_mask)), prime);
+                value = _mm256_srli_epi32(value, 8);
+            }
+            return hash;
+        };
+        for (; i + 8 <= n; i += 8) {
+            __m256i hash = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes + i));
+            if constexpr (sizeof(T) == 1) {
+                const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i));
+                hash = hash_bytes(hash, _mm256_cvtepu8_epi32(v), 1);
+            } else if constexpr (sizeof(T) == 2) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                hash = hash_bytes(hash, _mm256_cvtepu16_epi32(v), 2);
+            } else if constexpr (sizeof(T) == 4) {
+                hash = hash_bytes(hash, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), 4);
+            } else {
+                // a = lo0..lo3 hi0..hi3, b = lo4..lo7 hi4..hi7
+                const __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+                const __m256i a = _mm256_permutevar8x32_epi32(
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), idx);
+                const __m256i b = _mm256_permutevar8x32_epi32(
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 4)), idx);
+                const __m256i lo = _mm256_permute2x128_si256(a, b, 0x20);
+                const __m256i hi = _mm256_permute2x128_si256(a, b, 0x31);
+                hash = hash_bytes(hash_bytes(hash, lo, 4), hi, 4);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(hashes + i), hash);
+        }
+#elif defined(__ARM_NEON)
+        const uint32x4_t prime = vdupq_n_u32(FNV_PRIME);
+        const uint32x4_t byte_mask = vdupq_n_u32(0xff);
+        auto hash_bytes = [&](uint32x4_t hash, uint32x4_t value, int bytes) {
+            for (int k = 0; k < bytes; ++k) {
+                hash = vmulq_u32(veorq_u32(hash, vandq_u32(value, byte_mask)), prime);
+                value = vshrq_n_u32(value, 8);
+            }
+            return hash;
+        };
+        for (; i + 4 <= n; i += 4) {
+            uint32x4_t hash = vld1q_u32(hashes + i);
+            if constexpr (sizeof(T) == 1) {
+                uint32_t packed;
+                memcpy(&packed, data + i, sizeof(packed));
+                const uint16x8_t v = vmovl_u8(vcreate_u8(packed));
+                hash = hash_bytes(hash, vmovl_u16(vget_low_u16(v)), 1);
+            } else if constexpr (sizeof(T) == 2) {
+                const uint16x4_t v = vld1_u16(reinterpret_cast<const uint16_t*>(data + i));
+                hash = hash_bytes(hash, vmovl_u16(v), 2);
+            } else if constexpr (sizeof(T) == 4) {
+                hash = hash_bytes(hash, vld1q_u32(reinterpret_cast<const uint32_t*>(data + i)), 4);
+            } else {
+                // de-interleave the low and the high words
+                const uint32x4x2_t v = vld2q_u32(reinterpret_cast<const uint32_t*>(data + i));
+                hash = hash_bytes(hash_bytes(hash, v.val[0], 4), v.val[1], 4);
+            }
+            vst1q_u32(hashes + i, hash);
+        }
+#endif
+        for (; i < n; ++i) {
+            hashes[i] = fnv_hash(&data[i], sizeof(T), hashes[i]);
+        }
+    }
+
     // Our hash function is MurmurHash2, 64 bit version.
     // It was modified in order to provide the same result in
     // big and little endian archs (endian neutral).
@@ -0,0 +1,128 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/instrumented_mutex.h"
+
+#include <algorithm>
+
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+LockSite::LockSite(std::string name) : _name(std::move(name)) {}
+
+void LockSite::record_wait(int64_t wait_ns, bool shared) {
+    wait_ns = std::max<int64_t>(wait_ns, 0);
+    _contentions.fetch_add(1, std::memory_order_relaxed);
+    if (shared) {
+        _shared_contentions.fetch_add(1, std::memory_order_relaxed);
+    }
+    _total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+    int64_t max_wait_ns = _max_wait_ns.load(std::memory_order_relaxed);
+    while (wait_ns > max_wait_ns &&
+           !_max_wait_ns.compare_exchange_weak(max_wait_ns, wait_ns, std::memory_order_relaxed)) {
+    }
+    int bucket = wait_ns <= 1 ? 0 : std::min(63 - __builtin_clzll(wait_ns), kNumBuckets - 1);
+    _buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+LockSite::Snapshot LockSite::snapshot() const {
+    Snapshot snapshot;
+    snapshot.name = _name;
+    snapshot.contentions = _contentions.load(std::memory_order_relaxed);
+    snapshot.shared_contentions = _shared_contentions.load(std::memory_order_relaxed);
+    snapshot.total_wait_ns = _total_wait_ns.load(std::memory_order_relaxed);
+    snapshot.max_wait_ns = _max_wait_ns.load(std::memory_order_relaxed);
+    for (int i = 0; i < kNumBuckets; i++) {
+        snapshot.buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+int64_t LockSite::Snapshot::wait_ns_percentile(double percentile) const {
+    int64_t total = 0;
+    for (auto count : buckets) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0;
+    }
+    int64_t threshold = std::max<int64_t>(1, static_cast<int64_t>(total * percentile));
+    int64_t accumulated = 0;
+    for (int i = 0; i < kNumBuckets; i++) {
+        accumulated += buckets[i];
+        if (accumulated >= threshold) {
+            return i == kNumBuckets - 1 ? max_wait_ns : std::min<int64_t>(max_wait_ns, 2LL << i);
+        }
+    }
+    return max_wait_ns;
+}
+
+LockStats* LockStats::instance() {
+    static LockStats lock_stats;
+    return &lock_stats;
+}
+
+LockSite* LockStats::get_or_create_site(const std::string& name) {
+    LockSite* site = nullptr;
+    bool is_first_site = false;
+    {
+        std::lock_guard l(_mutex);
+        auto it = std::find_if(_sites.begin(), _sites.end(), [&name](const auto& s) { return s->name() == name; });
+        if (it != _sites.end()) {
+            return it->get();
+        }
+        is_first_site = _sites.empty();
+        site = _sites.emplace_back(std::make_unique<LockSite>(name)).get();
+    }
+
+    // Register metrics without holding _mutex, since the hook takes MetricRegistry::mutex then _mutex.
+    auto* metrics = StarRocksMetrics::instance()->metrics();
+    if (is_first_site) {
+        metrics->register_hook("lock_stats_hook", [this]() { _update_metrics(); });
+    }
+    MetricLabels labels = MetricLabels().add("name", name);
+    metrics->register_metric("lock_contentions_total", labels, &site->_contentions_metric);
+    metrics->register_metric("lock_wait_ns_total", labels, &site->_wait_ns_metric);
+    metrics->register_metric("lock_max_wait_ns", labels, &site->_max_wait_ns_metric);
+    return site;
+}
+
+std::vector<LockSite::Snapshot> LockStats::top_contended(size_t limit) const {
+    std::vector<LockSite::Snapshot> snapshots;
+    {
+        std::lock_guard l(_mutex);
+        snapshots.reserve(_sites.size());
+        for (const auto& site : _sites) {
+            snapshots.emplace_back(site->snapshot());
+        }
+    }
+    std::sort(snapshots.begin(), snapshots.end(),
+              [](const auto& a, const auto& b) { return a.total_wait_ns > b.total_wait_ns; });
+    if (snapshots.size() > limit) {
+        snapshots.resize(limit);
+    }
+    return snapshots;
+}
+
+void LockStats::_update_metrics() {
+    std::lock_guard l(_mutex);
+    for (const auto& site : _sites) {
+        site->_contentions_metric.set_value(site->_contentions.load(std::memory_order_relaxed));
+        site->_wait_ns_metric.set_value(site->_total_wait_ns.load(std::memory_order_relaxed));
+        site->_max_wait_ns_metric.set_value(site->_max_wait_ns.load(std::memory_order_relaxed));
+    }
+}
+
+} // namespace starrocks
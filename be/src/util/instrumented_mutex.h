@@ -0,0 +1,172 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "gutil/macros.h"
+#include "util/metrics.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+// LockSite aggregates the contended acquisitions of all the locks declared at one site of the code, e.g.
+// the 32 shard mutexes of every LRUCache share the site "LRUCache". Only the acquisitions that have to
+// wait are recorded, so an uncontended lock costs nothing more than a try_lock.
+class LockSite {
+public:
+    // Bucket i counts the waits in [2^i, 2^(i+1)) ns, the last bucket is unbounded.
+    static constexpr int kNumBuckets = 32;
+
+    struct Snapshot {
+        std::string name;
+        int64_t contentions = 0;
+        int64_t shared_contentions = 0;
+        int64_t total_wait_ns = 0;
+        int64_t max_wait_ns = 0;
+        std::array<int64_t, kNumBuckets> buckets{};
+
+        // The upper bound of the bucket containing the |percentile|(0~1) of the waits.
+        int64_t wait_ns_percentile(double percentile) const;
+    };
+
+    explicit LockSite(std::string name);
+
+    const std::string& name() const { return _name; }
+
+    void record_wait(int64_t wait_ns, bool shared);
+
+    Snapshot snapshot() const;
+
+private:
+    friend class LockStats;
+
+    const std::string _name;
+    std::atomic<int64_t> _contentions{0};
+    std::atomic<int64_t> _shared_contentions{0};
+    std::atomic<int64_t> _total_wait_ns{0};
+    std::atomic<int64_t> _max_wait_ns{0};
+    std::array<std::atomic<int64_t>, kNumBuckets> _buckets{};
+
+    // Refreshed by the hook of StarRocksMetrics.
+    IntGauge _contentions_metric{MetricUnit::NOUNIT};
+    IntGauge _wait_ns_metric{MetricUnit::NANOSECONDS};
+    IntGauge _max_wait_ns_metric{MetricUnit::NANOSECONDS};
+};
+
+// The registry of all the lock sites, which never removes a site.
+class LockStats {
+public:
+    static LockStats* instance();
+
+    // Thread-safe, use LOCK_SITE to look it up only once per site.
+    LockSite* get_or_create_site(const std::string& name);
+
+    // Return the |limit| sites with the longest total wait time.
+    std::vector<LockSite::Snapshot> top_contended(size_t limit) const;
+
+private:
+    LockStats() = default;
+    DISALLOW_COPY_AND_MOVE(LockStats);
+
+    void _update_metrics();
+
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<LockSite>> _sites;
+};
+
+// The LockSite named |name|, which is looked up only once by each call site.
+#define LOCK_SITE(name)                                                                   \
+    ([]() -> ::starrocks::LockSite* {                                                     \
+        static auto* site = ::starrocks::LockStats::instance()->get_or_create_site(name); \
+        return site;                                                                      \
+    }())
+
+// A mutex recording the time waited by the contended lock() into its LockSite. |Mutex| can be any lockable
+// type with try_lock(), such as std::mutex, bthread::Mutex, SpinLock or StackTraceMutex.
+template <typename Mutex>
+class InstrumentedMutex {
+public:
+    explicit InstrumentedMutex(LockSite* site) : _site(site) {}
+
+    DISALLOW_COPY_AND_MOVE(InstrumentedMutex);
+
+    void lock() {
+        if (_mutex.try_lock()) {
+            return;
+        }
+        int64_t start_ns = MonotonicNanos();
+        _mutex.lock();
+        _site->record_wait(MonotonicNanos() - start_ns, false);
+    }
+
+    bool try_lock() { return _mutex.try_lock(); }
+
+    void unlock() { _mutex.unlock(); }
+
+    Mutex& native_mutex() { return _mutex; }
+
+private:
+    LockSite* const _site;
+    Mutex _mutex;
+};
+
+template <typename SharedMutex = std::shared_mutex>
+class InstrumentedSharedMutex {
+public:
+    explicit InstrumentedSharedMutex(LockSite* site) : _site(site) {}
+
+    DISALLOW_COPY_AND_MOVE(InstrumentedSharedMutex);
+
+    void lock() {
+        if (_mutex.try_lock()) {
+            return;
+        }
+        int64_t start_ns = MonotonicNanos();
+        _mutex.lock();
+        _site->record_wait(MonotonicNanos() - start_ns, false);
+    }
+
+    bool try_lock() { return _mutex.try_lock(); }
+
+    void unlock() { _mutex.unlock(); }
+
+    void lock_shared() {
+        if (_mutex.try_lock_shared()) {
+            return;
+        }
+        int64_t start_ns = MonotonicNanos();
+        _mutex.lock_shared();
+        _site->record_wait(MonotonicNanos() - start_ns, true);
+    }
+
+    bool try_lock_shared() { return _mutex.try_lock_shared(); }
+
+    void unlock_shared() { _mutex.unlock_shared(); }
+
+    SharedMutex& native_mutex() { return _mutex; }
+
+private:
+    LockSite* const _site;
+    SharedMutex _mutex;
+};
+
+} // namespace starrocks
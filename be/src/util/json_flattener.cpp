@@ -31,6 +31,7 @@
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "gutil/casts.h"
 #include "types/logical_type.h"
@@ -169,6 +170,50 @@ std::vector<LogicalType> JsonFlattener::get_flat_types() {
     return types;
 }
 
+JsonPathAccessStats* JsonPathAccessStats::instance() {
+    static JsonPathAccessStats stats;
+    return &stats;
+}
+
+void JsonPathAccessStats::record(const std::string& path) {
+    size_t capacity = std::max(config::json_flat_hot_path_capacity, 0);
+    if (capacity == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> l(_mutex);
+    auto iter = _accesses.find(path);
+    if (iter != _accesses.end()) {
+        iter->second++;
+        return;
+    }
+    if (_accesses.size() >= capacity) {
+        // decay all the counts to let new hot paths in, paths not accessed recently are dropped
+        for (auto it = _accesses.begin(); it != _accesses.end();) {
+            it->second >>= 1;
+            if (it->second == 0) {
+                it = _accesses.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (_accesses.size() >= capacity) {
+            return;
+        }
+    }
+    _accesses.emplace(path, 1);
+}
+
+uint64_t JsonPathAccessStats::accesses(const std::string& path) const {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto iter = _accesses.find(path);
+    return iter == _accesses.end() ? 0 : iter->second;
+}
+
+void JsonPathAccessStats::clear() {
+    std::lock_guard<std::mutex> l(_mutex);
+    _accesses.clear();
+}
+
 struct FlatColumnDesc {
     // json compatible type
     uint8_t type = JsonFlattener::JSON_NULL_TYPE_BITS;
@@ -180,6 +225,9 @@ struct FlatColumnDesc {
 
     // for json-uint, json-uint is uint64_t, check the maximum value and downgrade to bigint
     uint64_t max = 0;
+
+    // how many times queries read the path, see JsonPathAccessStats
+    uint64_t accesses = 0;
 };
 
 void JsonFlattener::derived_paths(std::vector<ColumnPtr>& json_datas) {
@@ -254,16 +302,22 @@ void JsonFlattener::derived_paths(std::vector<ColumnPtr>& json_datas) {
 
     // try downgrade json-uint to bigint
     int128_t max = RunTimeTypeLimits<TYPE_BIGINT>::max_value();
+    auto* access_stats = JsonPathAccessStats::instance();
     for (auto& [name, desc] : derived_maps) {
         if (desc.type == JSON_TYPE_BITS.at(vpack::ValueType::UInt) && desc.max <= max) {
             desc.type = JSON_BIGINT_TYPE_BITS;
         }
+        desc.accesses = access_stats->accesses(std::string(name));
     }
 
-    // sort by hit, casts
+    // sort by accesses, hit, casts
     std::vector<pair<std::string_view, FlatColumnDesc>> top_hits(derived_maps.begin(), derived_maps.end());
     std::sort(top_hits.begin(), top_hits.end(),
               [](const pair<std::string_view, FlatColumnDesc>& a, const pair<std::string_view, FlatColumnDesc>& b) {
+                  // check accesses, the paths read by queries have the highest priority.
+                  if (a.second.accesses != b.second.accesses) {
+                      return a.second.accesses > b.second.accesses;
+                  }
                   // check hits, the higher the hit rate, the higher the priority.
                   if (a.second.hits != b.second.hits) {
                       return a.second.hits > b.second.hits;
@@ -288,7 +342,8 @@ void JsonFlattener::derived_paths(std::vector<ColumnPtr>& json_datas) {
             _flat_paths.emplace_back(name);
             _flat_types.emplace_back(desc.type);
         }
-        VLOG(8) << "flat json[" << name << "], hit[" << desc.hits << "], row[" << total_rows << "]";
+        VLOG(8) << "flat json[" << name << "], hit[" << desc.hits << "], row[" << total_rows << "], accesses["
+                << desc.accesses << "]";
     }
 
     // init index map
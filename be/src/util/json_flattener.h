@@ -18,8 +18,10 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "column/vectorized_fwd.h"
@@ -58,4 +60,22 @@ private:
     std::vector<uint8_t> _flat_types;
     std::unordered_map<std::string, int> _flat_index;
 };
+
+// Counts how often queries read each sub field of json columns through access paths. derived_paths() prefers
+// the fields read by queries, so the hot fields are extracted by the next load or compaction even if they are
+// not among the most frequent keys of the json data.
+class JsonPathAccessStats {
+public:
+    static JsonPathAccessStats* instance();
+
+    void record(const std::string& path);
+
+    uint64_t accesses(const std::string& path) const;
+
+    void clear();
+
+private:
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, uint64_t> _accesses;
+};
 } // namespace starrocks
\ No newline at end of file
@@ -40,6 +40,8 @@ public:
         return success;
     }
 
+    int32_t actual_num() const { return LIMIT_SETTER_ACTUAL_NUM(_value.load(std::memory_order_relaxed)); }
+
     bool should_shrink() {
         int64_t old_value = _value.load(std::memory_order_relaxed);
         int32_t expect_num = LIMIT_SETTER_EXPECT_NUM(old_value);
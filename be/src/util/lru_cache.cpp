@@ -6,6 +6,7 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <sstream>
@@ -150,10 +151,67 @@ bool HandleTable::_resize() {
     return true;
 }
 
+// The number of counters in each row of the frequency sketch of a shard.
+static const size_t kFrequencySketchWidth = 4096;
+
+void FrequencySketch::init(size_t width) {
+    DCHECK(width > 0 && (width & (width - 1)) == 0);
+    _table = std::make_unique<std::atomic<uint8_t>[]>(width * kDepth);
+    _mask = width - 1;
+    _additions = 0;
+    _sample_size = width * 10;
+}
+
+size_t FrequencySketch::_index(uint32_t hash, int row) const {
+    // Mix the hash with a different seed for each row, by the finalizer of murmur3.
+    uint32_t h = hash + static_cast<uint32_t>(row + 1) * 0x9E3779B9U;
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16;
+    return row * (_mask + 1) + (h & _mask);
+}
+
+// The counters are updated by concurrent lookups without a lock, an increment lost
+// in a race only makes the estimation a little lower.
+void FrequencySketch::increment(uint32_t hash) {
+    bool added = false;
+    for (int row = 0; row < kDepth; row++) {
+        std::atomic<uint8_t>& counter = _table[_index(hash, row)];
+        uint8_t count = counter.load(std::memory_order_relaxed);
+        if (count < kMaxCount) {
+            counter.store(count + 1, std::memory_order_relaxed);
+            added = true;
+        }
+    }
+    if (added && _additions.fetch_add(1, std::memory_order_relaxed) + 1 == _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    uint32_t frequency = kMaxCount;
+    for (int row = 0; row < kDepth; row++) {
+        frequency = std::min<uint32_t>(frequency, _table[_index(hash, row)].load(std::memory_order_relaxed));
+    }
+    return frequency;
+}
+
+void FrequencySketch::_reset() {
+    const size_t size = (_mask + 1) * kDepth;
+    for (size_t i = 0; i < size; i++) {
+        _table[i].store(_table[i].load(std::memory_order_relaxed) >> 1, std::memory_order_relaxed);
+    }
+    _additions.fetch_sub(_sample_size / 2, std::memory_order_relaxed);
+}
+
 LRUCache::LRUCache() {
     // Make empty circular linked list
     _lru.next = &_lru;
     _lru.prev = &_lru;
+    _protected_lru.next = &_protected_lru;
+    _protected_lru.prev = &_protected_lru;
 }
 
 LRUCache::~LRUCache() noexcept {
@@ -162,14 +220,16 @@ LRUCache::~LRUCache() noexcept {
 
 bool LRUCache::_unref(LRUHandle* e) {
     DCHECK(e->refs > 0);
-    e->refs--;
-    return e->refs == 0;
+    return e->refs.fetch_sub(1, std::memory_order_acq_rel) == 1;
 }
 
 void LRUCache::_lru_remove(LRUHandle* e) {
     e->next->prev = e->prev;
     e->prev->next = e->next;
     e->prev = e->next = nullptr;
+    if (e->in_protected) {
+        _protected_usage -= e->charge;
+    }
 }
 
 void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
@@ -178,14 +238,19 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
     e->prev = list->prev;
     e->prev->next = e;
     e->next->prev = e;
+    if (list == &_protected_lru) {
+        _protected_usage += e->charge;
+    }
 }
 
 void LRUCache::set_capacity(size_t capacity) {
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
+        _drain_read_buffer();
         _capacity = capacity;
         _evict_from_lru(0, &last_ref_list);
+        _demote_protected();
     }
 
     for (auto entry : last_ref_list) {
@@ -197,39 +262,70 @@ void LRUCache::set_charge_mode(ChargeMode charge_mode) {
     _charge_mode = charge_mode;
 }
 
-uint64_t LRUCache::get_lookup_count() const {
+void LRUCache::set_eviction_policy(EvictionPolicy eviction_policy) {
     std::lock_guard l(_mutex);
-    return _lookup_count;
+    _drain_read_buffer();
+    _eviction_policy = eviction_policy;
+    if (_eviction_policy == EvictionPolicy::TINY_LFU && _sketch.empty()) {
+        _sketch.init(kFrequencySketchWidth);
+    }
+}
+
+uint64_t LRUCache::get_lookup_count() const {
+    return _lookup_count.load(std::memory_order_relaxed);
 }
 
 uint64_t LRUCache::get_hit_count() const {
-    std::lock_guard l(_mutex);
-    return _hit_count;
+    return _hit_count.load(std::memory_order_relaxed);
 }
 
 size_t LRUCache::get_usage() const {
-    std::lock_guard l(_mutex);
-    return _usage;
+    return _usage.load(std::memory_order_relaxed);
 }
 
 size_t LRUCache::get_capacity() const {
-    std::lock_guard l(_mutex);
-    return _capacity;
+    return _capacity.load(std::memory_order_relaxed);
+}
+
+// Move the entries looked up since the last write to the newest end of the LRU list, in the
+// order of the lookups. The hits beyond the capacity of the buffer are dropped, which only loses
+// a bit of recency. Called under the exclusive lock first, so that no entry in the buffer is freed.
+void LRUCache::_drain_read_buffer() {
+    const size_t size = std::min(_read_buffer_size.load(std::memory_order_relaxed), kReadBufferSize);
+    for (size_t i = 0; i < size; i++) {
+        LRUHandle* e = _read_buffer[i].load(std::memory_order_relaxed);
+        DCHECK(e->in_cache);
+        _lru_remove(e);
+        if (_eviction_policy == EvictionPolicy::TINY_LFU) {
+            // Hit after being inserted, promote it to the protected segment.
+            e->in_protected = true;
+            _lru_append(&_protected_lru, e);
+        } else {
+            _lru_append(&_lru, e);
+        }
+    }
+    _read_buffer_size.store(0, std::memory_order_relaxed);
+    _demote_protected();
 }
 
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
-    std::lock_guard l(_mutex);
-    ++_lookup_count;
+    // Lookups only share the lock. They do not move the entry in the LRU list, but record
+    // it in the read buffer, which is replayed by the next writer.
+    std::shared_lock l(_mutex);
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
+    if (_eviction_policy == EvictionPolicy::TINY_LFU) {
+        _sketch.increment(hash);
+    }
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
         DCHECK(e->in_cache);
-        if (e->refs == 1) {
-            // only in LRU free list, remove it from list
-            _lru_remove(e);
+        e->refs.fetch_add(1, std::memory_order_relaxed);
+        size_t index = _read_buffer_size.fetch_add(1, std::memory_order_relaxed);
+        if (index < kReadBufferSize) {
+            _read_buffer[index].store(e, std::memory_order_relaxed);
         }
-        e->refs++;
-        ++_hit_count;
+        _hit_count.fetch_add(1, std::memory_order_relaxed);
     }
     return reinterpret_cast<Cache::Handle*>(e);
 }
@@ -240,24 +336,23 @@ void LRUCache::release(Cache::Handle* handle) {
     }
     auto* e = reinterpret_cast<LRUHandle*>(handle);
     bool last_ref = false;
-    {
+    if (_usage.load(std::memory_order_relaxed) <= _capacity.load(std::memory_order_relaxed)) {
+        // The entries stay in the LRU list while they are referenced, so no lock is needed.
+        // The last reference can only be of an entry out of the cache, which nobody else sees.
+        last_ref = _unref(e);
+        if (last_ref) {
+            _usage -= e->charge;
+        }
+    } else {
         std::lock_guard l(_mutex);
+        _drain_read_buffer();
         last_ref = _unref(e);
         if (last_ref) {
             _usage -= e->charge;
         } else if (e->in_cache && e->refs == 1) {
-            // only exists in cache
-            if (_usage > _capacity) {
-                // take this opportunity and remove the item
-                _table.remove(e->key(), e->hash);
-                e->in_cache = false;
-                _unref(e);
-                _usage -= e->charge;
-                last_ref = true;
-            } else {
-                // put it to LRU free list
-                _lru_append(&_lru, e);
-            }
+            // only exists in cache, take this opportunity and remove the item
+            _evict_one_entry(e);
+            last_ref = true;
         }
     }
 
@@ -268,29 +363,76 @@ void LRUCache::release(Cache::Handle* handle) {
 }
 
 void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted) {
-    LRUHandle* cur = &_lru;
+    // The protected segment is evicted after the probation one, and is always empty
+    // for EvictionPolicy::LRU.
     // 1. evict normal cache entries
-    while (_usage + charge > _capacity && cur->next != &_lru) {
-        LRUHandle* old = cur->next;
-        if (old->priority == CachePriority::DURABLE) {
-            cur = cur->next;
-            continue;
+    for (LRUHandle* list : {&_lru, &_protected_lru}) {
+        LRUHandle* cur = list;
+        while (_usage + charge > _capacity && cur->next != list) {
+            LRUHandle* old = cur->next;
+            // skip the entries in use
+            if (old->priority == CachePriority::DURABLE || old->refs > 1) {
+                cur = cur->next;
+                continue;
+            }
+            _evict_one_entry(old);
+            deleted->push_back(old);
         }
-        _evict_one_entry(old);
-        deleted->push_back(old);
     }
     // 2. evict durable cache entries if need
-    while (_usage + charge > _capacity && _lru.next != &_lru) {
-        LRUHandle* old = _lru.next;
-        DCHECK(old->priority == CachePriority::DURABLE);
-        _evict_one_entry(old);
-        deleted->push_back(old);
+    for (LRUHandle* list : {&_lru, &_protected_lru}) {
+        LRUHandle* cur = list;
+        while (_usage + charge > _capacity && cur->next != list) {
+            LRUHandle* old = cur->next;
+            if (old->refs > 1) {
+                cur = cur->next;
+                continue;
+            }
+            DCHECK(old->priority == CachePriority::DURABLE);
+            _evict_one_entry(old);
+            deleted->push_back(old);
+        }
+    }
+}
+
+LRUHandle* LRUCache::_next_victim() const {
+    auto evictable = [](const LRUHandle* e) { return e->priority == CachePriority::NORMAL && e->refs == 1; };
+    for (const LRUHandle* list : {&_lru, &_protected_lru}) {
+        for (LRUHandle* e = list->next; e != list; e = e->next) {
+            if (evictable(e)) {
+                return e;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// TinyLFU admission: a new entry which needs to evict others is only admitted when it
+// is accessed no less often than the entry to be evicted first.
+bool LRUCache::_admit(const LRUHandle* e, size_t charge) const {
+    if (_eviction_policy != EvictionPolicy::TINY_LFU || e->priority == CachePriority::DURABLE ||
+        _usage + charge <= _capacity) {
+        return true;
+    }
+    const LRUHandle* victim = _next_victim();
+    return victim == nullptr || _sketch.frequency(e->hash) >= _sketch.frequency(victim->hash);
+}
+
+// Keep the protected segment within 80% of the capacity, by moving its oldest entries to
+// the newest end of the probation segment.
+void LRUCache::_demote_protected() {
+    const size_t protected_capacity = _capacity / 5 * 4;
+    while (_protected_usage > protected_capacity && _protected_lru.next != &_protected_lru) {
+        LRUHandle* e = _protected_lru.next;
+        _lru_remove(e);
+        e->in_protected = false;
+        _lru_append(&_lru, e);
     }
 }
 
 void LRUCache::_evict_one_entry(LRUHandle* e) {
     DCHECK(e->in_cache);
-    DCHECK(e->refs == 1); // LRU list contains elements which may be evicted
+    DCHECK(e->refs == 1); // only referenced by the cache
     _lru_remove(e);
     _table.remove(e->key(), e->hash);
     e->in_cache = false;
@@ -307,15 +449,28 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->charge = charge;
     e->key_length = key.size();
     e->hash = hash;
-    e->refs = 2; // one for the returned handle, one for LRUCache.
+    new (&e->refs) std::atomic<uint32_t>(2); // one for the returned handle, one for LRUCache.
     e->next = e->prev = nullptr;
     e->in_cache = true;
     e->priority = priority;
+    e->in_protected = false;
     e->value_size = value_size;
     memcpy(e->key_data, key.data(), key.size());
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
+        _drain_read_buffer();
+
+        if (_eviction_policy == EvictionPolicy::TINY_LFU) {
+            _sketch.increment(hash);
+            if (!_admit(e, charge)) {
+                // Not admitted, the entry is only kept until the returned handle is released.
+                e->in_cache = false;
+                e->refs = 1;
+                _usage += charge;
+                return reinterpret_cast<Cache::Handle*>(e);
+            }
+        }
 
         // Free the space following strict LRU policy until enough space
         // is freed or the lru list is empty
@@ -326,13 +481,12 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         // space was freed
         auto old = _table.insert(e);
         _usage += charge;
+        _lru_append(&_lru, e);
         if (old != nullptr) {
             old->in_cache = false;
+            _lru_remove(old);
             if (_unref(old)) {
                 _usage -= old->charge;
-                // old is on LRU because it's in cache and its reference count
-                // was just 1 (Unref returned 0)
-                _lru_remove(old);
                 last_ref_list.push_back(old);
             }
         }
@@ -352,17 +506,15 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
     bool last_ref = false;
     {
         std::lock_guard l(_mutex);
+        _drain_read_buffer();
         e = _table.remove(key, hash);
         if (e != nullptr) {
+            _lru_remove(e);
+            e->in_cache = false;
             last_ref = _unref(e);
             if (last_ref) {
                 _usage -= e->charge;
-                if (e->in_cache) {
-                    // locate in free list
-                    _lru_remove(e);
-                }
             }
-            e->in_cache = false;
         }
     }
     // free handle out of mutex, when last_ref is true, e must not be nullptr
@@ -375,16 +527,19 @@ int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
-        while (_lru.next != &_lru) {
-            LRUHandle* old = _lru.next;
-            DCHECK(old->in_cache);
-            DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
-            _lru_remove(old);
-            _table.remove(old->key(), old->hash);
-            old->in_cache = false;
-            _unref(old);
-            _usage -= old->charge;
-            last_ref_list.push_back(old);
+        _drain_read_buffer();
+        for (LRUHandle* list : {&_lru, &_protected_lru}) {
+            LRUHandle* cur = list;
+            while (cur->next != list) {
+                LRUHandle* old = cur->next;
+                if (old->refs > 1) {
+                    // still in use
+                    cur = cur->next;
+                    continue;
+                }
+                _evict_one_entry(old);
+                last_ref_list.push_back(old);
+            }
         }
     }
     for (auto entry : last_ref_list) {
@@ -401,12 +556,13 @@ uint32_t ShardedLRUCache::_shard(uint32_t hash) {
     return hash >> (32 - kNumShardBits);
 }
 
-ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode)
+ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode, EvictionPolicy eviction_policy)
         : _last_id(0), _capacity(capacity), _charge_mode(charge_mode) {
     const size_t per_shard = (_capacity + (kNumShards - 1)) / kNumShards;
     for (auto& _shard : _shards) {
         _shard.set_capacity(per_shard);
         _shard.set_charge_mode(_charge_mode);
+        _shard.set_eviction_policy(eviction_policy);
     }
 }
 
@@ -536,8 +692,8 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
     }
 }
 
-Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode) {
-    return new ShardedLRUCache(capacity, charge_mode);
+Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode, EvictionPolicy eviction_policy) {
+    return new ShardedLRUCache(capacity, charge_mode, eviction_policy);
 }
 
 } // namespace starrocks
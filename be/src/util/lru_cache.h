@@ -6,13 +6,17 @@
 
 #include <rapidjson/document.h>
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "util/instrumented_mutex.h"
 #include "util/slice.h"
 
 namespace starrocks {
@@ -27,9 +31,19 @@ enum class ChargeMode {
     MEMSIZE = 1
 };
 
+enum class EvictionPolicy {
+    // plain least-recently-used
+    LRU = 0,
+    // TinyLFU admission and segmented LRU, which resists large scans: an entry evicting
+    // an entry accessed more often is not admitted, and the entries hit again are kept
+    // in a protected segment, ahead of the entries only accessed once.
+    TINY_LFU = 1
+};
+
 // Create a new cache with a fixed size capacity.  This implementation
-// of Cache uses a least-recently-used eviction policy.
-extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+// of Cache uses a least-recently-used eviction policy by default.
+extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE,
+                            EvictionPolicy eviction_policy = EvictionPolicy::LRU);
 
 class CacheKey {
 public:
@@ -210,9 +224,10 @@ typedef struct LRUHandle {
     size_t charge;
     size_t key_length;
     bool in_cache; // Whether entry is in the cache.
-    uint32_t refs;
+    std::atomic<uint32_t> refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
+    bool in_protected; // Whether entry is in the protected segment, only for EvictionPolicy::TINY_LFU.
     size_t value_size;
     char key_data[1]; // Beginning of key
 
@@ -265,6 +280,33 @@ private:
     bool _resize();
 };
 
+// A count-min sketch of 4-bit counters estimating the access frequency of keys by their hash.
+// All counters are halved after a number of increments, so that the old accesses fade out.
+// Increments may race with each other, the counters are only approximate anyway.
+class FrequencySketch {
+public:
+    // |width| must be a power of two.
+    void init(size_t width);
+
+    bool empty() const { return _table == nullptr; }
+
+    void increment(uint32_t hash);
+
+    uint32_t frequency(uint32_t hash) const;
+
+private:
+    static constexpr int kDepth = 4;
+    static constexpr uint8_t kMaxCount = 15;
+
+    size_t _index(uint32_t hash, int row) const;
+    void _reset();
+
+    std::unique_ptr<std::atomic<uint8_t>[]> _table;
+    size_t _mask{0};
+    std::atomic<size_t> _additions{0};
+    size_t _sample_size{0};
+};
+
 // A single shard of sharded cache.
 class LRUCache {
 public:
@@ -276,6 +318,8 @@ public:
 
     void set_charge_mode(ChargeMode charge_mode);
 
+    void set_eviction_policy(EvictionPolicy eviction_policy);
+
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                           void (*deleter)(const CacheKey& key, void* value),
@@ -296,25 +340,47 @@ private:
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
+    LRUHandle* _next_victim() const;
+    bool _admit(const LRUHandle* e, size_t charge) const;
+    void _demote_protected();
+    void _drain_read_buffer();
+
+    static constexpr size_t kReadBufferSize = 128;
 
     // Initialized before use.
-    size_t _capacity{0};
+    std::atomic<size_t> _capacity{0};
 
     ChargeMode _charge_mode;
 
-    // _mutex protects the following state.
-    mutable std::mutex _mutex;
-    size_t _usage{0};
+    EvictionPolicy _eviction_policy{EvictionPolicy::LRU};
+
+    // _mutex protects the following state. Lookups only take it shared, as they modify
+    // nothing but the refs of entries and the read buffer.
+    mutable InstrumentedSharedMutex<> _mutex{LOCK_SITE("LRUCache")};
+    std::atomic<size_t> _usage{0};
 
     // Dummy head of LRU list.
     // lru.prev is newest entry, lru.next is oldest entry.
-    // Entries have refs==1 and in_cache==true.
+    // Entries have in_cache==true, the ones with refs>1 are in use and skipped by the eviction.
+    // For EvictionPolicy::TINY_LFU, it is the probation segment.
     LRUHandle _lru;
 
+    // Dummy head of the protected segment for EvictionPolicy::TINY_LFU, which keeps the
+    // entries hit after being inserted. Evicted after the probation segment.
+    LRUHandle _protected_lru;
+    // The charge of entries in |_protected_lru|.
+    size_t _protected_usage{0};
+
+    FrequencySketch _sketch;
+
     HandleTable _table;
 
-    uint64_t _lookup_count{0};
-    uint64_t _hit_count{0};
+    // The entries hit by lookups under the shared lock, to be moved in the LRU list by the next writer.
+    std::atomic<LRUHandle*> _read_buffer[kReadBufferSize];
+    std::atomic<size_t> _read_buffer_size{0};
+
+    std::atomic<uint64_t> _lookup_count{0};
+    std::atomic<uint64_t> _hit_count{0};
 };
 
 static const int kNumShardBits = 5;
@@ -322,7 +388,8 @@ static const int kNumShards = 1 << kNumShardBits;
 
 class ShardedLRUCache : public Cache {
 public:
-    explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+    explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE,
+                             EvictionPolicy eviction_policy = EvictionPolicy::LRU);
     ~ShardedLRUCache() override = default;
     Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
                    CachePriority priority = CachePriority::NORMAL, size_t value_size = 0) override;
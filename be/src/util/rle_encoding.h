@@ -707,6 +707,11 @@ public:
     // Returns the number of consumed values or 0 if an error occurred.
     int32_t GetBatch(T* values, int32_t batch_num);
 
+    // Consume 'batch_num' values without decoding them. Repeated runs are skipped at once, and
+    // the literal runs are skipped in whole bit-packed groups.
+    // Returns the number of skipped values or 0 if an error occurred.
+    int32_t SkipBatch(int32_t batch_num);
+
     // Like GetBatch but the values are then decoded using the provided dictionary
     template <typename TV>
     int GetBatchWithDict(const TV* dictionary, int32_t dictionary_length, TV* values, int32_t batch_num);
@@ -722,6 +727,9 @@ private:
     /// Return false if the input was truncated. This does not advance 'literal_count_'.
     bool FillLiteralBuffer() WARN_UNUSED_RESULT;
 
+    // Like GetLiteralValues but the literals are dropped instead of copied.
+    bool SkipLiteralValues(int32_t num_literals_to_skip) WARN_UNUSED_RESULT;
+
     bool HaveBufferedLiterals() const { return literal_buffer_pos_ < num_buffered_literals_; }
 
     /// Output buffered literals, advancing 'literal_buffer_pos_' and decrementing
@@ -897,6 +905,59 @@ inline int32_t RleBatchDecoder<T>::GetBatch(T* values, int32_t batch_num) {
     return num_consumed;
 }
 
+template <typename T>
+inline bool RleBatchDecoder<T>::SkipLiteralValues(int32_t num_literals_to_skip) {
+    int32_t num_skipped = 0;
+    if (HaveBufferedLiterals()) {
+        num_skipped = std::min<int32_t>(num_literals_to_skip, num_buffered_literals_ - literal_buffer_pos_);
+        literal_buffer_pos_ += num_skipped;
+        literal_count_ -= num_skipped;
+    }
+
+    int32_t num_remaining = num_literals_to_skip - num_skipped;
+    // Same as GetLiteralValues, skip batches of 32 to end on a byte boundary.
+    int32_t num_to_bypass = std::min<int32_t>(literal_count_, BitUtil::RoundDownToPowerOf2(num_remaining, 32));
+    if (num_to_bypass > 0) {
+        if (UNLIKELY(!bit_reader_.skip_batch(bit_width_, num_to_bypass))) return false;
+        literal_count_ -= num_to_bypass;
+        num_skipped += num_to_bypass;
+        num_remaining = num_literals_to_skip - num_skipped;
+    }
+
+    if (num_remaining > 0) {
+        if (UNLIKELY(!FillLiteralBuffer())) return false;
+        literal_buffer_pos_ += num_remaining;
+        literal_count_ -= num_remaining;
+    }
+    return true;
+}
+
+template <typename T>
+inline int32_t RleBatchDecoder<T>::SkipBatch(int32_t batch_num) {
+    DCHECK_GE(bit_width_, 0);
+    int32_t num_skipped = 0;
+    while (num_skipped < batch_num) {
+        int32_t num_repeats = NextNumRepeats();
+        if (num_repeats > 0) {
+            int32_t num_repeats_to_skip = std::min(num_repeats, batch_num - num_skipped);
+            GetRepeatedValue(num_repeats_to_skip);
+            num_skipped += num_repeats_to_skip;
+            continue;
+        }
+
+        int32_t num_literals = NextNumLiterals();
+        if (num_literals == 0) {
+            break;
+        }
+        int32_t num_literals_to_skip = std::min(num_literals, batch_num - num_skipped);
+        if (!SkipLiteralValues(num_literals_to_skip)) {
+            return 0;
+        }
+        num_skipped += num_literals_to_skip;
+    }
+    return num_skipped;
+}
+
 template <typename T>
 static inline bool IndexInRange(T idx, int32_t dictionary_length) {
     return idx >= 0 && idx < dictionary_length;
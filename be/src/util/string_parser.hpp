@@ -202,6 +202,24 @@ private:
     // Return PARSE_FAILURE on leading whitespace. Trailing whitespace is allowed.
     static inline bool string_to_bool_internal(const char* s, int len, ParseResult* result);
 
+    // Parses the 8 chars at s into *value if all of them are digits, the check and the conversion are done
+    // on the 8 bytes as a whole (SWAR) rather than per char.
+    static inline bool parse_eight_digits(const char* s, uint32_t* value) {
+        uint64_t v;
+        memcpy(&v, s, sizeof(v));
+        // A byte is a digit iff its high nibble is 3 and adding 6 to it doesn't carry into the high nibble.
+        if ((v & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL ||
+            ((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL) {
+            return false;
+        }
+        // Combine adjacent digits into 2-digit, 4-digit and then the 8-digit number, the first char is
+        // the lowest byte.
+        v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+        v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+        *value = static_cast<uint32_t>(((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+        return true;
+    }
+
     // Returns true if s only contains whitespace.
     static inline bool is_all_whitespace(const char* s, int len) {
         for (int i = 0; i < len; ++i) {
@@ -403,7 +421,16 @@ inline T StringParser::string_to_int_no_overflow(const char* s, int len, ParseRe
         *result = PARSE_FAILURE;
         return 0;
     }
-    for (int i = 1; i < len; ++i) {
+    int i = 1;
+    if constexpr (sizeof(T) >= sizeof(uint32_t)) {
+        // Long numbers are consumed 8 digits at a time, the loop below handles the tail and the whitespace.
+        uint32_t eight_digits;
+        while (i + 8 <= len && parse_eight_digits(s + i, &eight_digits)) {
+            val = val * 100000000 + eight_digits;
+            i += 8;
+        }
+    }
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
@@ -37,6 +37,7 @@
 
 #include <cctz/time_zone.h>
 
+#include <algorithm>
 #include <charconv>
 #include <string_view>
 #include <utility>
@@ -216,4 +217,63 @@ int64_t TimezoneUtils::to_utc_offset(const cctz::time_zone& ctz) {
     return a.cs - b.cs;
 }
 
+static const cctz::civil_second kEpochCivil(1970, 1, 1, 0, 0, 0);
+
+static int64_t to_seconds(const cctz::civil_second& cs) {
+    return cs - kEpochCivil;
+}
+
+static int64_t to_seconds(const cctz::time_point<cctz::seconds>& tp) {
+    return tp.time_since_epoch().count();
+}
+
+static cctz::time_point<cctz::seconds> to_time_point(int64_t seconds) {
+    return cctz::time_point<cctz::seconds>(cctz::seconds(seconds));
+}
+
+void TimezoneOffsetCache::_lookup_utc(int64_t seconds) {
+    const auto tp = to_time_point(seconds);
+    _utc_offset = _ctz.lookup(tp).offset;
+
+    // The civil times of a transition are the local clock right before and right after it, so the instant of
+    // the transition is either of them minus the offset of the period they belong to.
+    cctz::time_zone::civil_transition trans;
+    if (_ctz.prev_transition(tp + cctz::seconds(1), &trans)) {
+        _utc_begin = to_seconds(trans.to) - _utc_offset;
+    } else {
+        _utc_begin = std::numeric_limits<int64_t>::min();
+    }
+    if (_ctz.next_transition(tp, &trans)) {
+        _utc_end = to_seconds(trans.from) - _utc_offset;
+    } else {
+        _utc_end = std::numeric_limits<int64_t>::max();
+    }
+}
+
+int64_t TimezoneOffsetCache::_lookup_local(int64_t seconds) {
+    const auto cl = _ctz.lookup(kEpochCivil + seconds);
+    if (cl.kind == cctz::time_zone::civil_lookup::SKIPPED) {
+        return to_seconds(cl.trans);
+    }
+    if (cl.kind == cctz::time_zone::civil_lookup::REPEATED) {
+        return to_seconds(cl.pre);
+    }
+
+    const int64_t utc = to_seconds(cl.pre);
+    _local_offset = seconds - utc;
+    // Local times around a transition are skipped or repeated, which are excluded from the cached range.
+    cctz::time_zone::civil_transition trans;
+    if (_ctz.prev_transition(cl.pre + cctz::seconds(1), &trans)) {
+        _local_begin = std::max(to_seconds(trans.from), to_seconds(trans.to));
+    } else {
+        _local_begin = std::numeric_limits<int64_t>::min();
+    }
+    if (_ctz.next_transition(cl.pre, &trans)) {
+        _local_end = std::min(to_seconds(trans.from), to_seconds(trans.to));
+    } else {
+        _local_end = std::numeric_limits<int64_t>::max();
+    }
+    return utc;
+}
+
 } // namespace starrocks
@@ -37,6 +37,8 @@
 
 #include <re2/re2.h>
 
+#include <cstdint>
+#include <limits>
 #include <string_view>
 
 #include "cctz/time_zone.h"
@@ -61,4 +63,46 @@ public:
 private:
     static bool _match_cctz_time_zone(std::string_view timezone, cctz::time_zone& ctz);
 };
+
+// TimezoneOffsetCache remembers the UTC offset of the transition period of |ctz| looked up last, together with the
+// range of instants (and of local times) that the period covers. Timestamps in a chunk are usually close to each
+// other, so that most of them are converted with a range check and an addition instead of a cctz lookup.
+//
+// Local times are represented as the seconds since 1970-01-01 00:00:00 of the local clock, i.e. what
+// TimestampValue::to_unix_second returns for a local datetime.
+class TimezoneOffsetCache {
+public:
+    explicit TimezoneOffsetCache(const cctz::time_zone& ctz) : _ctz(ctz) {}
+
+    int64_t utc_to_local(int64_t seconds) {
+        if (seconds < _utc_begin || seconds >= _utc_end) {
+            _lookup_utc(seconds);
+        }
+        return seconds + _utc_offset;
+    }
+
+    // A skipped local time is mapped to its transition and a repeated one to the earlier instant,
+    // the same as cctz::convert.
+    int64_t local_to_utc(int64_t seconds) {
+        if (seconds >= _local_begin && seconds < _local_end) {
+            return seconds - _local_offset;
+        }
+        return _lookup_local(seconds);
+    }
+
+private:
+    void _lookup_utc(int64_t seconds);
+    int64_t _lookup_local(int64_t seconds);
+
+    const cctz::time_zone _ctz;
+
+    // Instants in [_utc_begin, _utc_end) are _utc_offset seconds behind the local clock.
+    int64_t _utc_begin = 0;
+    int64_t _utc_end = 0;
+    int64_t _utc_offset = 0;
+    // Local times in [_local_begin, _local_end) are unique and _local_offset seconds ahead of UTC.
+    int64_t _local_begin = 0;
+    int64_t _local_end = 0;
+    int64_t _local_offset = 0;
+};
 } // namespace starrocks
@@ -20,6 +20,7 @@
 #include <cstring>
 #include <filesystem>
 
+#include "block_cache/datacache_utils.h"
 #include "common/logging.h"
 #include "common/statusor.h"
 #include "fs/fs_util.h"
@@ -215,6 +216,32 @@ TEST_F(BlockCacheTest, write_with_overwrite_option) {
     cache->shutdown();
 }
 
+TEST_F(BlockCacheTest, exist) {
+    std::unique_ptr<BlockCache> cache(new BlockCache);
+    const size_t block_size = 1024 * 1024;
+
+    CacheOptions options;
+    options.mem_space_size = 20 * 1024 * 1024;
+    options.block_size = block_size;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.engine = "starcache";
+    ASSERT_TRUE(cache->init(options).ok());
+
+    const std::string cache_key = DataCacheUtils::calc_cache_key("test_file", 4 * block_size, 0);
+    std::string value(block_size, 'a');
+    ASSERT_TRUE(cache->write_buffer(cache_key, block_size, block_size, value.c_str()).ok());
+
+    ASSERT_FALSE(cache->exist(cache_key, 0));
+    ASSERT_TRUE(cache->exist(cache_key, block_size));
+    ASSERT_TRUE(cache->exist(cache_key, block_size + 100));
+    ASSERT_FALSE(cache->exist(cache_key, 2 * block_size));
+    // another version of the file
+    ASSERT_FALSE(cache->exist(DataCacheUtils::calc_cache_key("test_file", 4 * block_size, 1000), block_size));
+
+    cache->shutdown();
+}
+
 TEST_F(BlockCacheTest, read_cache_with_adaptor) {
     std::unique_ptr<BlockCache> cache(new BlockCache);
     const size_t block_size = 1024 * 1024;
@@ -41,4 +41,14 @@ TEST_F(DataCacheUtilsTest, test_set_metrics_from_thrift) {
     ASSERT_EQ(t_metrics.status, TDataCacheStatus::ABNORMAL);
 }
 
+TEST_F(DataCacheUtilsTest, test_calc_metacache_key) {
+    std::string key = DataCacheUtils::calc_metacache_key("file1", 1024, 1000000, "ft");
+    ASSERT_EQ(DataCacheUtils::calc_cache_key("file1", 1024, 1000000) + "ft", key);
+    // The kinds of object and the versions of the file have different keys.
+    ASSERT_NE(key, DataCacheUtils::calc_metacache_key("file1", 1024, 1000000, "ot"));
+    ASSERT_NE(key, DataCacheUtils::calc_metacache_key("file1", 1024, 2000000, "ft"));
+    ASSERT_NE(DataCacheUtils::calc_metacache_key("file1", 1024, 0, "ft"),
+              DataCacheUtils::calc_metacache_key("file1", 2048, 0, "ft"));
+}
+
 } // namespace starrocks
\ No newline at end of file
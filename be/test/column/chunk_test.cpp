@@ -374,6 +374,26 @@ TEST_F(ChunkTest, test_filter_with_extra_data) {
     check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk_extra_data1->columns()[1].get()), {2, 4});
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_filter_sparse_selection) {
+    auto chunk = std::make_unique<Chunk>(make_columns(3, 1000), make_schema(3));
+    Buffer<uint8_t> selection(1000, 0);
+    for (size_t i = 0; i < 1000; i += 100) {
+        selection[i] = 1;
+    }
+    ASSERT_LE(10 * Chunk::SPARSE_SELECTION_RATIO, 1000);
+
+    ASSERT_EQ(10, chunk->filter(selection));
+    chunk->check_or_die();
+    for (size_t i = 0; i < 3; i++) {
+        std::vector<int32_t> expect_datas;
+        for (size_t j = 0; j < 1000; j += 100) {
+            expect_datas.emplace_back(i + j);
+        }
+        check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk->columns()[i].get()), expect_datas);
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunkTest, test_clone_empty_with_extra_data) {
     auto extra_data1 = make_extra_data(2);
@@ -21,6 +21,7 @@
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
 #include "exec/sorting/sorting.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 
@@ -644,4 +645,32 @@ TEST(FixedLengthColumnTest, test_fill_range) {
     ASSERT_EQ(0, p[4]);
 }
 
+template <typename T>
+static void check_fnv_hash_batch() {
+    auto column = FixedLengthColumn<T>::create();
+    for (int i = 0; i < 37; i++) {
+        column->append(static_cast<T>(i * 2654435761u));
+    }
+    // hash from an offset so that both the vectorized body and the scalar tail are covered
+    std::vector<uint32_t> hashes(column->size(), HashUtil::FNV_SEED);
+    column->fnv_hash(hashes.data(), 3, column->size());
+    for (size_t i = 0; i < column->size(); i++) {
+        uint32_t expect = HashUtil::FNV_SEED;
+        if (i >= 3) {
+            T value = column->get_data()[i];
+            expect = HashUtil::fnv_hash(&value, sizeof(T), expect);
+        }
+        ASSERT_EQ(expect, hashes[i]) << "row " << i;
+    }
+}
+
+// NOLINTNEXTLINE
+TEST(FixedLengthColumnTest, test_fnv_hash) {
+    check_fnv_hash_batch<int8_t>();
+    check_fnv_hash_batch<int16_t>();
+    check_fnv_hash_batch<int32_t>();
+    check_fnv_hash_batch<int64_t>();
+    check_fnv_hash_batch<double>();
+}
+
 } // namespace starrocks
@@ -62,6 +62,18 @@ TEST(TimestampValueTest, toString) {
     }
 }
 
+TEST(TimestampValueTest, fromStandardString) {
+    auto from_string = [](const std::string& s) {
+        TimestampValue v;
+        return v.from_string(s.data(), s.size()) ? v.to_string() : "invalid";
+    };
+    ASSERT_EQ("2004-02-29 23:30:59", from_string("2004-02-29 23:30:59"));
+    ASSERT_EQ("2004-02-29 23:30:59", from_string("  2004/02/29T23:30:59 "));
+    ASSERT_EQ("2004-02-29 00:00:00", from_string("2004-02-29"));
+    ASSERT_EQ("0001-01-09 09:05:01", from_string("0001-01-09 09:05:01"));
+    ASSERT_EQ("invalid", from_string("2004-13-01"));
+}
+
 TEST(TimestampValueTest, calculate) {
     {
         auto v = TimestampValue::create(2004, 2, 29, 23, 30, 30).add<TimeUnit::SECOND>(30);
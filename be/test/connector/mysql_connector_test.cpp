@@ -0,0 +1,95 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connector/mysql_connector.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/assert.h"
+
+namespace starrocks::connector {
+
+using Filters = std::vector<std::string>;
+
+TEST(MySQLDataSourceProviderTest, split_partition_filters) {
+    ASSERT_EQ(Filters({"`id` < 25", "`id` >= 25 AND `id` < 50", "`id` >= 50 AND `id` < 75", "`id` >= 75"}),
+              MySQLDataSourceProvider::_split_partition_filters("`id`", "0", "100", 4));
+    ASSERT_EQ(Filters({"`id` < -3", "`id` >= -3"}),
+              MySQLDataSourceProvider::_split_partition_filters("`id`", "-10", "3", 2));
+    // A single value still gives one range per partition.
+    ASSERT_EQ(Filters({"`id` < 7", "`id` >= 7 AND `id` < 7", "`id` >= 7"}),
+              MySQLDataSourceProvider::_split_partition_filters("`id`", "7", "7", 3));
+}
+
+TEST(MySQLDataSourceProviderTest, split_full_bigint_range) {
+    // max - min doesn't fit in 64 bits.
+    ASSERT_EQ(Filters({"`id` < -4611686018427387905", "`id` >= -4611686018427387905 AND `id` < -1",
+                       "`id` >= -1 AND `id` < 4611686018427387903", "`id` >= 4611686018427387903"}),
+              MySQLDataSourceProvider::_split_partition_filters("`id`", "-9223372036854775808",
+                                                                "9223372036854775807", 4));
+}
+
+TEST(MySQLDataSourceProviderTest, no_split_without_integer_bounds) {
+    // MIN() and MAX() of an empty table are NULL, which are read as empty strings.
+    ASSERT_TRUE(MySQLDataSourceProvider::_split_partition_filters("`id`", "", "", 4).empty());
+    ASSERT_TRUE(MySQLDataSourceProvider::_split_partition_filters("`id`", "1.5", "abc", 4).empty());
+    ASSERT_TRUE(MySQLDataSourceProvider::_split_partition_filters("`id`", "1", "100", 1).empty());
+}
+
+class MySQLDataSourceProviderPartitionTest : public ::testing::Test {
+protected:
+    // The provider once the ranges have been read from the table.
+    std::unique_ptr<MySQLDataSourceProvider> create_provider(int32_t num_partitions, const Filters& filters) {
+        auto provider = std::make_unique<MySQLDataSourceProvider>(nullptr, TPlanNode());
+        provider->_num_partitions = num_partitions;
+        provider->_partition_filters = filters;
+        provider->_partition_filters_initialized = true;
+        return provider;
+    }
+};
+
+TEST_F(MySQLDataSourceProviderPartitionTest, read_by_first_partition_without_ranges) {
+    // The table is empty, or its primary key doesn't start with an integer column.
+    auto provider = create_provider(3, {});
+    for (int32_t partition = 0; partition < 3; partition++) {
+        std::string filter;
+        bool skip = false;
+        ASSERT_OK(provider->_get_partition_filter(nullptr, partition, &filter, &skip));
+        ASSERT_TRUE(filter.empty());
+        ASSERT_EQ(partition != 0, skip) << partition;
+    }
+}
+
+TEST_F(MySQLDataSourceProviderPartitionTest, read_by_ranges) {
+    auto provider = create_provider(2, {"`id` < 5", "`id` >= 5"});
+    for (int32_t partition = 0; partition < 2; partition++) {
+        std::string filter;
+        bool skip = false;
+        ASSERT_OK(provider->_get_partition_filter(nullptr, partition, &filter, &skip));
+        ASSERT_EQ(provider->_partition_filters[partition], filter);
+        ASSERT_FALSE(skip);
+    }
+}
+
+TEST_F(MySQLDataSourceProviderPartitionTest, more_data_sources_than_partitions) {
+    for (const auto& filters : {Filters{}, Filters{"`id` < 5", "`id` >= 5"}}) {
+        auto provider = create_provider(2, filters);
+        std::string filter;
+        bool skip = false;
+        auto st = provider->_get_partition_filter(nullptr, 2, &filter, &skip);
+        ASSERT_EQ(TStatusCode::INTERNAL_ERROR, st.code());
+    }
+}
+
+} // namespace starrocks::connector
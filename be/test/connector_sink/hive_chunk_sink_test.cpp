@@ -230,6 +230,52 @@ TEST_F(HiveChunkSinkTest, test_partitioned_sink) {
     }
 }
 
+TEST_F(HiveChunkSinkTest, test_evict_partition_writers) {
+    int32_t max_open_writers = config::connector_sink_max_open_partition_writers;
+    config::connector_sink_max_open_partition_writers = 1;
+    DeferOp defer([&]() { config::connector_sink_max_open_partition_writers = max_open_writers; });
+
+    std::vector<std::string> partition_column_names = {"k1"};
+    std::vector<std::unique_ptr<ColumnEvaluator>> partition_column_evaluators =
+            ColumnSlotIdEvaluator::from_types({TypeDescriptor::from_logical_type(TYPE_VARCHAR)});
+    auto mock_file_writer_factory = std::make_unique<MockFileWriterFactory>();
+    EXPECT_CALL(*mock_file_writer_factory, init()).WillOnce(Return(Status::OK()));
+    // hello, world and then hello again, every partition evicts the previous one.
+    for (int i = 0; i < 3; i++) {
+        auto mock_file_writer = std::make_shared<MockFileWriter>();
+        EXPECT_CALL(*mock_file_writer, init()).WillOnce(Return(Status::OK()));
+        EXPECT_CALL(*mock_file_writer, write(_)).WillOnce(Return(ByMove(make_ready_future(Status::OK()))));
+        EXPECT_CALL(*mock_file_writer, commit())
+                .WillOnce(Return(ByMove(make_ready_future(CommitResult{.io_status = Status::OK()}))));
+        EXPECT_CALL(*mock_file_writer_factory, create(_))
+                .WillOnce(Return(ByMove(std::static_pointer_cast<formats::FileWriter>(mock_file_writer))))
+                .RetiresOnSaturation();
+    }
+    auto location_provider = std::make_unique<LocationProvider>("base_path", "ffffff", 0, 0, "parquet");
+    auto sink = std::make_unique<HiveChunkSink>(partition_column_names, std::move(partition_column_evaluators),
+                                                std::move(location_provider), std::move(mock_file_writer_factory),
+                                                100, _runtime_state);
+    EXPECT_OK(sink->init());
+
+    for (const auto& [partition, num_commits] : std::vector<std::pair<std::string, size_t>>{
+                 {"hello", 0}, {"world", 1}, {"hello", 1}}) {
+        auto chunk = std::make_shared<Chunk>();
+        auto partition_column = BinaryColumn::create();
+        partition_column->append(partition);
+        chunk->append_column(partition_column, 0);
+
+        auto futures = sink->add(chunk);
+        ASSERT_TRUE(futures.ok());
+        EXPECT_EQ(futures.value().commit_file_futures.size(), num_commits);
+        EXPECT_EQ(futures.value().add_chunk_futures.size(), 1);
+        EXPECT_OK(futures.value().add_chunk_futures[0].get());
+    }
+
+    auto futures = sink->finish();
+    EXPECT_EQ(futures.commit_file_futures.size(), 1);
+    EXPECT_OK(futures.commit_file_futures[0].get().io_status);
+}
+
 TEST_F(HiveChunkSinkTest, test_callback) {
     {
         std::vector<std::string> partition_column_names = {"k1"};
@@ -154,6 +154,49 @@ TEST(HashMapTest, Insert) {
     }
 }
 
+TEST(HashMapTest, InsertSortedNumberKeys) {
+    const int chunk_size = 4096;
+    using TestAggHashMapKey = Int64AggHashMapWithOneNumberKey<PhmapSeed1>;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    TestAggHashMapKey key(chunk_size, &statis);
+    MemPool pool;
+
+    // runs of equal keys, as produced by scanning sorted data.
+    auto column = Int64Column::create();
+    for (int64_t i = 0; i < chunk_size; i++) {
+        column->append(i / 100);
+    }
+    Columns key_columns{column};
+    Buffer<AggDataPtr> agg_states(chunk_size);
+    auto allocate_func = [&pool](auto& key) { return pool.allocate(16); };
+    key.build_hash_map(chunk_size, key_columns, &pool, allocate_func, &agg_states);
+    ASSERT_EQ((chunk_size + 99) / 100, key.hash_map.size());
+    for (int i = 1; i < chunk_size; i++) {
+        if (i % 100 == 0) {
+            ASSERT_NE(agg_states[i - 1], agg_states[i]);
+        } else {
+            ASSERT_EQ(agg_states[i - 1], agg_states[i]);
+        }
+    }
+
+    // the same keys in another order map to the same states.
+    auto shuffled = Int64Column::create();
+    for (int64_t i = chunk_size - 1; i >= 0; i -= 37) {
+        shuffled->append(i / 100);
+    }
+    Columns shuffled_columns{shuffled};
+    Buffer<AggDataPtr> shuffled_states(chunk_size);
+    std::vector<uint8_t> not_founds;
+    key.build_hash_map_with_selection(shuffled->size(), shuffled_columns, &pool, allocate_func, &shuffled_states,
+                                      &not_founds);
+    ASSERT_EQ((chunk_size + 99) / 100, key.hash_map.size());
+    for (size_t i = 0; i < shuffled->size(); i++) {
+        ASSERT_EQ(agg_states[shuffled->get_data()[i] * 100], shuffled_states[i]);
+        ASSERT_EQ(0, not_founds[i]);
+    }
+}
+
 TEST(HashMapTest, TwoLevelConvert) {
     std::vector<std::string> keys(1000);
     for (int i = 0; i < 1000; i++) {
@@ -175,6 +218,38 @@ TEST(HashMapTest, TwoLevelConvert) {
     }
 }
 
+TEST(HashMapTest, TwoLevelConvertNumberKey) {
+    RuntimeState dummy;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    std::vector<int64_t> sums(1000);
+
+    AggHashMapVariant variant;
+    variant.init(&dummy, AggHashMapVariant::Type::phase1_int64, &statis);
+    variant.visit([&](auto& hash_map_with_key) {
+        if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type, int64_t>) {
+            for (int64_t i = 0; i < 1000; i++) {
+                hash_map_with_key->hash_map.emplace(i, (AggDataPtr)(&sums[i]));
+            }
+        }
+    });
+    ASSERT_EQ(1000, variant.size());
+
+    variant.convert_to_two_level(&dummy);
+    ASSERT_TRUE(std::holds_alternative<std::unique_ptr<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>>(
+            variant.get_variant()));
+    ASSERT_EQ(1000, variant.size());
+    variant.visit([&](auto& hash_map_with_key) {
+        if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type, int64_t>) {
+            for (int64_t i = 0; i < 1000; i++) {
+                auto iter = hash_map_with_key->hash_map.find(i);
+                ASSERT_TRUE(iter != hash_map_with_key->hash_map.end());
+                ASSERT_EQ((AggDataPtr)(&sums[i]), iter->second);
+            }
+        }
+    });
+}
+
 class AggHashMapKeyNotFoundsTest : public ::testing::Test {
 public:
     template <typename HashMapWithKey>
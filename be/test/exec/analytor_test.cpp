@@ -16,12 +16,268 @@
 
 #include <gtest/gtest.h>
 
+#include <optional>
+#include <random>
+
+#include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "common/object_pool.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 class AnalytorTest : public ::testing::Test {
 public:
     void SetUp() override { config::vector_chunk_size = 1024; }
+
+protected:
+    using Values = std::vector<std::optional<int64_t>>;
+
+    // ROWS BETWEEN |start| AND |end|, negative offsets are PRECEDING and positive ones FOLLOWING.
+    struct Frame {
+        int64_t start;
+        int64_t end;
+    };
+
+    struct Input {
+        std::vector<int32_t> partitions;
+        std::vector<int32_t> orders;
+        std::vector<std::optional<int32_t>> values;
+    };
+
+    struct Output {
+        std::string process_mode;
+        // The results of each function in the order of the input rows.
+        std::vector<Values> results;
+        int64_t removed_rows = 0;
+    };
+
+    // Rows of several partitions, with nulls, an all-null partition and runs of equal order keys.
+    static Input random_input(const std::vector<int32_t>& partition_sizes, uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int32_t> dist(-50, 50);
+        Input input;
+        for (size_t p = 0; p < partition_sizes.size(); p++) {
+            const bool all_null = p == 1;
+            for (int32_t i = 0; i < partition_sizes[p]; i++) {
+                input.partitions.push_back(static_cast<int32_t>(p));
+                input.orders.push_back(i / 4);
+                const int32_t v = dist(rng);
+                if (all_null || v % 7 == 0) {
+                    input.values.emplace_back(std::nullopt);
+                } else {
+                    input.values.emplace_back(v);
+                }
+            }
+        }
+        return input;
+    }
+
+    static TExprNode slot_ref_node(SlotDescriptor* slot) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.__set_num_children(0);
+        node.__set_type(slot->type().to_thrift());
+        TSlotRef slot_ref;
+        slot_ref.__set_slot_id(slot->id());
+        slot_ref.__set_tuple_id(slot->parent());
+        node.__set_slot_ref(slot_ref);
+        node.__set_is_nullable(slot->is_nullable());
+        return node;
+    }
+
+    static TExpr slot_ref_expr(SlotDescriptor* slot) {
+        TExpr expr;
+        expr.__set_nodes({slot_ref_node(slot)});
+        return expr;
+    }
+
+    // Evaluate |functions| (min, max or sum) of the value column over |frame| through an Analytor fed with chunks of
+    // |chunk_size| rows.
+    static Output run(const std::vector<std::string>& functions, const Frame& frame, const Input& input,
+                      size_t chunk_size) {
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        RuntimeState state(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        state.init_instance_mem_tracker();
+        ObjectPool pool;
+
+        auto result_type = [](const std::string& fn) { return fn == "sum" ? TYPE_BIGINT : TYPE_INT; };
+        TDescriptorTableBuilder desc_builder;
+        TTupleDescriptorBuilder input_tuple;
+        for (const auto& [name, nullable] : std::vector<std::pair<std::string, bool>>{
+                     {"partition", false}, {"order", false}, {"value", true}}) {
+            input_tuple.add_slot(TSlotDescriptorBuilder().type(TYPE_INT).column_name(name).nullable(nullable).build());
+        }
+        input_tuple.build(&desc_builder);
+        TTupleDescriptorBuilder result_tuple;
+        for (const auto& fn : functions) {
+            result_tuple.add_slot(
+                    TSlotDescriptorBuilder().type(result_type(fn)).column_name(fn).nullable(true).build());
+        }
+        result_tuple.build(&desc_builder);
+        DescriptorTbl* tbl = nullptr;
+        CHECK(DescriptorTbl::create(&state, &pool, desc_builder.desc_tbl(), &tbl, config::vector_chunk_size).ok());
+        state.set_desc_tbl(tbl);
+        RowDescriptor child_row_desc(*tbl, {0}, {false});
+        const TupleDescriptor* result_tuple_desc = tbl->get_tuple_descriptor(1);
+        const auto& input_slots = tbl->get_tuple_descriptor(0)->slots();
+
+        TPlanNode tnode;
+        tnode.__set_node_type(TPlanNodeType::ANALYTIC_EVAL_NODE);
+        tnode.__set_limit(-1);
+        TAnalyticNode& analytic_node = tnode.analytic_node;
+        analytic_node.__set_partition_exprs({slot_ref_expr(input_slots[0])});
+        analytic_node.__set_order_by_exprs({slot_ref_expr(input_slots[1])});
+        analytic_node.__set_buffered_tuple_id(0);
+        for (const auto& fn : functions) {
+            TFunction tfn;
+            tfn.name.__set_function_name(fn);
+            tfn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+            tfn.__set_arg_types({TypeDescriptor(TYPE_INT).to_thrift()});
+            tfn.__set_ret_type(TypeDescriptor(result_type(fn)).to_thrift());
+            TAggregateFunction agg_fn;
+            agg_fn.__set_intermediate_type(TypeDescriptor(result_type(fn)).to_thrift());
+            tfn.__set_aggregate_fn(agg_fn);
+
+            TExprNode fn_node;
+            fn_node.__set_node_type(TExprNodeType::AGG_EXPR);
+            fn_node.__set_type(TypeDescriptor(result_type(fn)).to_thrift());
+            fn_node.__set_num_children(1);
+            fn_node.__set_fn(tfn);
+            fn_node.__set_has_nullable_child(true);
+            fn_node.__set_is_nullable(true);
+            TExpr expr;
+            expr.__set_nodes({fn_node, slot_ref_node(input_slots[2])});
+            analytic_node.analytic_functions.emplace_back(std::move(expr));
+        }
+        TAnalyticWindow window;
+        window.__set_type(TAnalyticWindowType::ROWS);
+        auto boundary = [](int64_t offset) {
+            TAnalyticWindowBoundary b;
+            if (offset == 0) {
+                b.__set_type(TAnalyticWindowBoundaryType::CURRENT_ROW);
+            } else {
+                b.__set_type(offset < 0 ? TAnalyticWindowBoundaryType::PRECEDING
+                                        : TAnalyticWindowBoundaryType::FOLLOWING);
+                b.__set_rows_offset_value(std::abs(offset));
+            }
+            return b;
+        };
+        window.__set_window_start(boundary(frame.start));
+        window.__set_window_end(boundary(frame.end));
+        analytic_node.__set_window(window);
+
+        RuntimeProfile profile("analytor");
+        Output output;
+        auto analytor = std::make_shared<Analytor>(tnode, child_row_desc, result_tuple_desc, false);
+        CHECK(analytor->prepare(&state, &pool, &profile).ok());
+        CHECK(analytor->open(&state).ok());
+        output.process_mode = *profile.get_info_string("ProcessMode");
+        output.results.resize(functions.size());
+
+        auto poll = [&]() {
+            while (ChunkPtr chunk = analytor->poll_chunk_buffer()) {
+                for (size_t i = 0; i < functions.size(); i++) {
+                    const auto& column = chunk->get_column_by_slot_id(result_tuple_desc->slots()[i]->id());
+                    for (size_t row = 0; row < chunk->num_rows(); row++) {
+                        Datum datum = column->get(row);
+                        if (datum.is_null()) {
+                            output.results[i].emplace_back(std::nullopt);
+                        } else if (result_type(functions[i]) == TYPE_BIGINT) {
+                            output.results[i].emplace_back(datum.get_int64());
+                        } else {
+                            output.results[i].emplace_back(datum.get_int32());
+                        }
+                    }
+                }
+            }
+        };
+        for (size_t start = 0; start < input.values.size(); start += chunk_size) {
+            const size_t end = std::min(start + chunk_size, input.values.size());
+            auto partition = Int32Column::create();
+            auto order = Int32Column::create();
+            auto value = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+            for (size_t i = start; i < end; i++) {
+                partition->append(input.partitions[i]);
+                order->append(input.orders[i]);
+                if (input.values[i].has_value()) {
+                    value->append_datum(Datum(input.values[i].value()));
+                } else {
+                    value->append_nulls(1);
+                }
+            }
+            auto chunk = std::make_shared<Chunk>();
+            chunk->append_column(std::move(partition), input_slots[0]->id());
+            chunk->append_column(std::move(order), input_slots[1]->id());
+            chunk->append_column(std::move(value), input_slots[2]->id());
+            CHECK(analytor->process(&state, chunk).ok());
+            poll();
+        }
+        CHECK(analytor->finish_process(&state).ok());
+        poll();
+        output.removed_rows = analytor->_removed_from_buffer_rows;
+        analytor->close(&state);
+        return output;
+    }
+
+    // Evaluate |functions| over |frame| row by row.
+    static std::vector<Values> expected_results(const std::vector<std::string>& functions, const Frame& frame,
+                                                const Input& input) {
+        std::vector<Values> results(functions.size());
+        const auto num_rows = static_cast<int64_t>(input.values.size());
+        int64_t partition_start = 0;
+        for (int64_t row = 0; row < num_rows; row++) {
+            if (input.partitions[row] != input.partitions[partition_start]) {
+                partition_start = row;
+            }
+            int64_t partition_end = row;
+            while (partition_end < num_rows && input.partitions[partition_end] == input.partitions[row]) {
+                partition_end++;
+            }
+            const int64_t start = std::max(row + frame.start, partition_start);
+            const int64_t end = std::min(row + frame.end + 1, partition_end);
+            for (size_t i = 0; i < functions.size(); i++) {
+                std::optional<int64_t> result;
+                for (int64_t pos = start; pos < end; pos++) {
+                    if (!input.values[pos].has_value()) {
+                        continue;
+                    }
+                    const int64_t v = input.values[pos].value();
+                    if (!result.has_value()) {
+                        result = v;
+                    } else if (functions[i] == "min") {
+                        result = std::min(*result, v);
+                    } else if (functions[i] == "max") {
+                        result = std::max(*result, v);
+                    } else {
+                        result = *result + v;
+                    }
+                }
+                results[i].emplace_back(result);
+            }
+        }
+        return results;
+    }
+
+    static void check(const std::vector<std::string>& functions, const Frame& frame, const Input& input,
+                      size_t chunk_size, const std::string& process_mode, bool expect_removed_rows = false) {
+        Output output = run(functions, frame, input, chunk_size);
+        ASSERT_EQ(process_mode, output.process_mode);
+        const auto expected = expected_results(functions, frame, input);
+        for (size_t i = 0; i < functions.size(); i++) {
+            ASSERT_EQ(expected[i].size(), output.results[i].size());
+            for (size_t row = 0; row < expected[i].size(); row++) {
+                ASSERT_EQ(expected[i][row], output.results[i][row])
+                        << functions[i] << " of row " << row << " over [" << frame.start << ", " << frame.end << "]";
+            }
+        }
+        if (expect_removed_rows) {
+            ASSERT_GT(output.removed_rows, 0);
+        }
+    }
 };
 
 // NOLINTNEXTLINE
@@ -126,4 +382,79 @@ TEST_F(AnalytorTest, find_partition_end) {
     ASSERT_EQ(analytor3._partition.end, 0);
 }
 
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, sliding_min_max) {
+    auto enable = config::pipeline_analytic_enable_sliding_min_max_process;
+    DeferOp defer([&]() { config::pipeline_analytic_enable_sliding_min_max_process = enable; });
+    config::pipeline_analytic_enable_sliding_min_max_process = true;
+
+    // Partitions of a single row, of nulls only, and wider than the frames and the chunks.
+    const Input input = random_input({1, 20, 3, 150, 2, 400, 7}, 28);
+    for (Frame frame : std::vector<Frame>{{-10, -3}, {-5, 0}, {-5, 5}, {0, 0}, {0, 6}, {3, 10}, {-60, 40}}) {
+        for (size_t chunk_size : {1, 7, 64}) {
+            check({"min", "max"}, frame, input, chunk_size, "Streaming/SlidingMinMax");
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, segment_tree) {
+    auto enable_removable = config::pipeline_analytic_enable_removable_cumulative_process;
+    auto enable_sliding = config::pipeline_analytic_enable_sliding_min_max_process;
+    auto min_frame_rows = config::pipeline_analytic_segment_tree_min_frame_rows;
+    auto removable_chunk_num = config::pipeline_analytic_removable_chunk_num;
+    DeferOp defer([&]() {
+        config::pipeline_analytic_enable_removable_cumulative_process = enable_removable;
+        config::pipeline_analytic_enable_sliding_min_max_process = enable_sliding;
+        config::pipeline_analytic_segment_tree_min_frame_rows = min_frame_rows;
+        config::pipeline_analytic_removable_chunk_num = removable_chunk_num;
+    });
+    config::pipeline_analytic_enable_removable_cumulative_process = false;
+    config::pipeline_analytic_enable_sliding_min_max_process = false;
+    config::pipeline_analytic_segment_tree_min_frame_rows = 128;
+    // Remove the unused rows after every chunk, so the frames cross the leaves while the buffer is trimmed.
+    config::pipeline_analytic_removable_chunk_num = 1;
+
+    const Input input = random_input({1, 40, 2, 300, 70, 700}, 29);
+    for (Frame frame : std::vector<Frame>{{-100, 50}, {-200, -10}, {-130, 0}, {5, 150}, {0, 127}, {-64, 64}}) {
+        for (size_t chunk_size : {7, 37, 100}) {
+            check({"sum", "min", "max"}, frame, input, chunk_size, "Streaming/SegmentTree", true);
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, remove_unused_rows_by_buffered_bytes) {
+    auto enable_removable = config::pipeline_analytic_enable_removable_cumulative_process;
+    auto enable_sliding = config::pipeline_analytic_enable_sliding_min_max_process;
+    auto min_frame_rows = config::pipeline_analytic_segment_tree_min_frame_rows;
+    auto removable_chunk_num = config::pipeline_analytic_removable_chunk_num;
+    auto max_buffered_bytes = config::pipeline_analytic_max_buffered_bytes;
+    DeferOp defer([&]() {
+        config::pipeline_analytic_enable_removable_cumulative_process = enable_removable;
+        config::pipeline_analytic_enable_sliding_min_max_process = enable_sliding;
+        config::pipeline_analytic_segment_tree_min_frame_rows = min_frame_rows;
+        config::pipeline_analytic_removable_chunk_num = removable_chunk_num;
+        config::pipeline_analytic_max_buffered_bytes = max_buffered_bytes;
+    });
+    config::pipeline_analytic_enable_removable_cumulative_process = false;
+    config::pipeline_analytic_enable_sliding_min_max_process = true;
+    config::pipeline_analytic_segment_tree_min_frame_rows = 128;
+    // Never reached by the chunk number, every chunk in front of the first needed row is removed by the bytes.
+    config::pipeline_analytic_removable_chunk_num = 1 << 20;
+    config::pipeline_analytic_max_buffered_bytes = 1;
+
+    const Input input = random_input({1, 40, 2, 300, 70, 700}, 30);
+    const std::vector<Frame> frames = {{-200, -10}, {-100, 50}, {-5, 5}, {3, 10}, {5, 150}};
+    for (Frame frame : frames) {
+        for (size_t chunk_size : {5, 37}) {
+            check({"min", "max"}, frame, input, chunk_size, "Streaming/SlidingMinMax", true);
+            // SUM is evaluated by the segment tree for the wide frames and by definition for the narrow ones.
+            const bool wide = frame.end - frame.start + 1 >= 128;
+            check({"sum", "min"}, frame, input, chunk_size, wide ? "Streaming/SegmentTree" : "Streaming/ByDefinition",
+                  true);
+        }
+    }
+}
+
 } // namespace starrocks
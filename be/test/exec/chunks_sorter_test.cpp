@@ -29,6 +29,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "exec/chunks_sorter_full_sort.h"
+#include "exec/chunks_sorter_heap_sort.h"
 #include "exec/chunks_sorter_topn.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
@@ -464,6 +465,54 @@ TEST_F(ChunksSorterTest, topn_sort_with_limit) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunksSorterTest, topn_presorted_input) {
+    std::vector<bool> is_asc{false};
+    std::vector<bool> is_null_first{false};
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(new ExprContext(_expr_cust_key.get()));
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+
+    auto make_chunk = [](const std::vector<int32_t>& values) {
+        Chunk::SlotHashMap map;
+        map[0] = 0;
+        return std::make_shared<Chunk>(Columns{make_int32_column(values)}, map);
+    };
+    auto make_desc_chunk = [&](int32_t from, int32_t to) {
+        std::vector<int32_t> values;
+        for (int32_t v = from; v > to; v--) {
+            values.push_back(v);
+        }
+        return make_chunk(values);
+    };
+    // the first two chunks are ordered by the key, the third one precedes the boundary entirely,
+    // and the last one is not ordered
+    std::vector<ChunkPtr> inputs{make_desc_chunk(100, 50), make_desc_chunk(120, 20), make_desc_chunk(30, 0),
+                                 make_chunk({5, 200, 7, 119})};
+    std::vector<int32_t> expected{200, 120, 119, 119, 118, 117, 116, 115, 114, 113};
+
+    for (size_t limit : {3, 10}) {
+        ChunksSorterTopn topn(_runtime_state.get(), &sort_exprs, &is_asc, &is_null_first, "", 0, limit);
+        ChunksSorterHeapSort heap_sort(_runtime_state.get(), &sort_exprs, &is_asc, &is_null_first, "", 0, limit);
+        for (ChunksSorter* sorter : std::vector<ChunksSorter*>{&topn, &heap_sort}) {
+            for (const auto& input : inputs) {
+                ASSERT_OK(sorter->update(_runtime_state.get(), ChunkPtr(input->clone_unique().release())));
+            }
+            ASSERT_OK(sorter->done(_runtime_state.get()));
+
+            ChunkPtr page = consume_page_from_sorter(*sorter);
+            std::vector<int32_t> result;
+            for (size_t i = 0; i < page->num_rows(); ++i) {
+                result.push_back(page->get(i).get(0).get_int32());
+            }
+            EXPECT_EQ(std::vector<int32_t>(expected.begin(), expected.begin() + limit), result);
+        }
+    }
+
+    clear_sort_exprs(sort_exprs);
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunksSorterTest, rank_topn) {
     std::vector<bool> is_asc{true};
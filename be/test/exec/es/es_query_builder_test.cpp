@@ -42,6 +42,8 @@
 #include "column/column_helper.h"
 #include "common/logging.h"
 #include "exec/es/es_predicate.h"
+#include "exec/es/es_scan_reader.h"
+#include "exec/es/es_scroll_query.h"
 #include "rapidjson/document.h"
 #include "rapidjson/rapidjson.h"
 #include "rapidjson/stringbuffer.h"
@@ -692,4 +694,27 @@ TEST_F(BooleanQueryBuilderTest, validate_timezone) {
     EXPECT_EQ("854971200000", time_literal->to_string());
 }
 
+TEST_F(BooleanQueryBuilderTest, sliced_scroll_query) {
+    std::map<std::string, std::string> properties;
+    properties[ESScanReader::KEY_BATCH_SIZE] = "100";
+    std::vector<std::string> fields = {"k1"};
+    std::vector<EsPredicate*> predicates;
+    std::map<std::string, std::string> docvalue_context;
+    bool doc_value_mode = false;
+
+    std::string query = ESScrollQueryBuilder::build(properties, fields, predicates, docvalue_context, &doc_value_mode);
+    rapidjson::Document document;
+    document.Parse(query.c_str());
+    ASSERT_FALSE(document.HasMember("slice"));
+
+    properties[ESScanReader::KEY_SLICE_ID] = "1";
+    properties[ESScanReader::KEY_NUM_SLICES] = "4";
+    query = ESScrollQueryBuilder::build(properties, fields, predicates, docvalue_context, &doc_value_mode);
+    document.Parse(query.c_str());
+    ASSERT_TRUE(document.HasMember("slice"));
+    ASSERT_EQ(1, document["slice"]["id"].GetInt());
+    ASSERT_EQ(4, document["slice"]["max"].GetInt());
+    ASSERT_EQ(100, document["size"].GetInt());
+}
+
 } // namespace starrocks
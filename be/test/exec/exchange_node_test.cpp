@@ -0,0 +1,231 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/exchange_node.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/sorting/merge_path.h"
+#include "exprs/expr.h"
+#include "gen_cpp/internal_service.pb.h"
+#include "runtime/data_stream_mgr.h"
+#include "runtime/data_stream_recvr.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "serde/protobuf_serde.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+class ExchangeNodeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.__set_batch_size(kChunkSize);
+        query_options.__set_transmission_encode_level(0);
+        TQueryGlobals query_globals;
+        _state = std::make_shared<RuntimeState>(TUniqueId(), query_options, query_globals, nullptr);
+        _state->init_instance_mem_tracker();
+
+        TDescriptorTableBuilder desc_builder;
+        TTupleDescriptorBuilder tuple_builder;
+        tuple_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_INT).column_name("c0").column_pos(0).nullable(false).build());
+        tuple_builder.build(&desc_builder);
+        ASSERT_OK(DescriptorTbl::create(_state.get(), &_pool, desc_builder.desc_tbl(), &_desc_tbl, kChunkSize));
+        _row_desc = std::make_unique<RowDescriptor>(*_desc_tbl, std::vector<TTupleId>{0}, std::vector<bool>{false});
+        _slot_id = _row_desc->tuple_descriptors()[0]->slots()[0]->id();
+
+        _mgr.prepare_pass_through_chunk_buffer(_state->query_id());
+    }
+
+    void TearDown() override {
+        for (auto* ctx : _expr_ctxs) {
+            ctx->close(_state.get());
+        }
+        if (_recvr != nullptr) {
+            _recvr->close();
+            _recvr.reset();
+        }
+        _mgr.destroy_pass_through_chunk_buffer(_state->query_id());
+    }
+
+    TExpr slot_ref_expr() const {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.__set_num_children(0);
+        node.__set_type(TypeDescriptor(TYPE_INT).to_thrift());
+        TSlotRef slot_ref;
+        slot_ref.__set_slot_id(_slot_id);
+        slot_ref.__set_tuple_id(0);
+        node.__set_slot_ref(slot_ref);
+        TExpr expr;
+        expr.__set_nodes({node});
+        return expr;
+    }
+
+    // A merging exchange ordered by the INT slot, as planned by the FE.
+    std::unique_ptr<ExchangeNode> create_merging_exchange_node(int num_senders, int64_t limit,
+                                                               bool enable_parallel_merge) {
+        TPlanNode tnode;
+        tnode.__set_node_id(kNodeId);
+        tnode.__set_node_type(TPlanNodeType::EXCHANGE_NODE);
+        tnode.__set_num_children(0);
+        tnode.__set_limit(limit);
+        tnode.__set_row_tuples({0});
+        tnode.__set_nullable_tuples({false});
+        TExchangeNode exchange_node;
+        exchange_node.__set_input_row_tuples({0});
+        TSortInfo sort_info;
+        sort_info.__set_ordering_exprs({slot_ref_expr()});
+        sort_info.__set_is_asc_order({true});
+        sort_info.__set_nulls_first({false});
+        exchange_node.__set_sort_info(sort_info);
+        if (enable_parallel_merge) {
+            exchange_node.__set_enable_parallel_merge(true);
+        }
+        tnode.__set_exchange_node(exchange_node);
+
+        auto node = std::make_unique<ExchangeNode>(&_pool, tnode, *_desc_tbl);
+        CHECK_OK(node->init(tnode, _state.get()));
+        node->set_num_senders(num_senders);
+        return node;
+    }
+
+    ExprContext* create_slot_ref_context() {
+        ExprContext* ctx = nullptr;
+        CHECK_OK(Expr::create_expr_tree(&_pool, slot_ref_expr(), &ctx, _state.get()));
+        CHECK_OK(ctx->prepare(_state.get()));
+        CHECK_OK(ctx->open(_state.get()));
+        _expr_ctxs.push_back(ctx);
+        return ctx;
+    }
+
+    // The sender sends the rows sender, sender + num_senders, ... in ascending order, in chunks of
+    // kRowsPerChunk rows, and then its eos.
+    void send_sorted_rows(int32_t sender_id, int32_t num_senders, int32_t num_rows) {
+        PTransmitChunkParams request;
+        request.set_sender_id(sender_id);
+        request.set_be_number(sender_id);
+        request.set_sequence(0);
+        request.set_eos(false);
+        for (int32_t first = 0; first < num_rows; first += kRowsPerChunk) {
+            auto column = Int32Column::create();
+            for (int32_t i = first; i < std::min(first + kRowsPerChunk, num_rows); i++) {
+                column->append(sender_id + i * num_senders);
+            }
+            Chunk chunk;
+            chunk.append_column(std::move(column), _slot_id);
+            ASSIGN_OR_ABORT(*request.add_chunks(), serde::ProtobufChunkSerde::serialize(chunk));
+        }
+        CountingClosure closure;
+        google::protobuf::Closure* done = &closure;
+        CHECK_OK(_recvr->add_chunks(request, &done));
+        _recvr->remove_sender(sender_id, sender_id);
+    }
+
+    class CountingClosure : public google::protobuf::Closure {
+    public:
+        void Run() override { ++num_runs; }
+
+        int num_runs = 0;
+    };
+
+    static constexpr int32_t kChunkSize = 4;
+    static constexpr int32_t kRowsPerChunk = 3;
+    static constexpr int32_t kDop = 4;
+    static constexpr PlanNodeId kNodeId = 1;
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _state;
+    DescriptorTbl* _desc_tbl = nullptr;
+    std::unique_ptr<RowDescriptor> _row_desc;
+    SlotId _slot_id = 0;
+    std::vector<ExprContext*> _expr_ctxs;
+    DataStreamMgr _mgr;
+    std::shared_ptr<DataStreamRecvr> _recvr;
+};
+
+TEST_F(ExchangeNodeTest, parallel_merge_is_planned_by_fe) {
+    ASSERT_EQ(0, config::exchange_parallel_merge_min_senders);
+
+    // By default the BE keeps the choice of the FE, however many senders there are.
+    ASSERT_FALSE(create_merging_exchange_node(16, -1, false)->_use_parallel_merge(kDop));
+    ASSERT_TRUE(create_merging_exchange_node(16, -1, true)->_use_parallel_merge(kDop));
+    ASSERT_TRUE(create_merging_exchange_node(2, 10, true)->_use_parallel_merge(kDop));
+
+    int32_t old_min_senders = config::exchange_parallel_merge_min_senders;
+    config::exchange_parallel_merge_min_senders = 8;
+    DeferOp defer([&]() { config::exchange_parallel_merge_min_senders = old_min_senders; });
+    ASSERT_TRUE(create_merging_exchange_node(16, -1, false)->_use_parallel_merge(kDop));
+    ASSERT_FALSE(create_merging_exchange_node(4, -1, false)->_use_parallel_merge(kDop));
+    ASSERT_FALSE(create_merging_exchange_node(16, 10, false)->_use_parallel_merge(kDop));
+    ASSERT_FALSE(create_merging_exchange_node(16, -1, false)->_use_parallel_merge(1));
+}
+
+TEST_F(ExchangeNodeTest, parallel_merge_of_many_senders) {
+    const int32_t num_senders = 10;
+    const int32_t num_rows_per_sender = 7;
+    _recvr = _mgr.create_recvr(_state.get(), *_row_desc, _state->fragment_instance_id(), kNodeId, num_senders,
+                               1024 * 1024, true, nullptr, true, kDop, true);
+    for (int32_t i = 0; i < kDop; i++) {
+        _recvr->bind_profile(i, std::make_shared<RuntimeProfile>("driver" + std::to_string(i)));
+    }
+    // The senders finish in an order unrelated to their rows.
+    for (int32_t sender_id : {3, 9, 0, 5, 1, 8, 2, 7, 4, 6}) {
+        send_sorted_rows(sender_id, num_senders, num_rows_per_sender);
+    }
+
+    SortDescs sort_descs(std::vector<bool>{true}, std::vector<bool>{false});
+    merge_path::MergePathCascadeMerger merger(kChunkSize, kDop, {create_slot_ref_context()}, sort_descs,
+                                              _row_desc->tuple_descriptors()[0], TTopNType::ROW_NUMBER, 0, -1,
+                                              _recvr->create_merge_path_chunk_providers());
+    std::vector<std::shared_ptr<RuntimeProfile>> profiles;
+    for (int32_t i = 0; i < kDop; i++) {
+        profiles.emplace_back(std::make_shared<RuntimeProfile>("merger" + std::to_string(i)));
+        merger.bind_profile(i, profiles.back().get());
+    }
+
+    // Drive the drivers of ExchangeParallelMergeSourceOperator one after another, the chunks they output
+    // in turn form the ordered stream.
+    std::vector<int32_t> values;
+    for (int round = 0; !merger.is_finished(); round++) {
+        ASSERT_LT(round, 10000);
+        for (int32_t i = 0; i < kDop; i++) {
+            if (merger.is_current_stage_finished(i, false) || merger.is_pending(i)) {
+                continue;
+            }
+            ChunkPtr chunk = merger.try_get_next(i);
+            if (chunk == nullptr) {
+                continue;
+            }
+            auto column = chunk->get_column_by_slot_id(_slot_id);
+            for (size_t row = 0; row < chunk->num_rows(); row++) {
+                values.push_back(column->get(row).get_int32());
+            }
+        }
+    }
+
+    std::vector<int32_t> expected(num_senders * num_rows_per_sender);
+    std::iota(expected.begin(), expected.end(), 0);
+    ASSERT_EQ(expected, values);
+}
+
+} // namespace starrocks
@@ -35,6 +35,7 @@
 
 #include <gtest/gtest.h>
 
+#include "exec/iceberg/iceberg_position_delete_cache.h"
 #include "fs/fs.h"
 #include "runtime/descriptor_helper.h"
 #include "testutil/assert.h"
@@ -60,4 +61,25 @@ TEST_F(IcebergDeleteBuilderTest, TestParquetBuilder) {
     ASSERT_EQ(1, _need_skip_rowids.size());
 }
 
+TEST_F(IcebergDeleteBuilderTest, TestPositionDeleteCache) {
+    auto* cache = IcebergPositionDeleteCache::instance();
+    ASSERT_TRUE(cache->enabled());
+    ParquetPositionDeleteBuilder builder(FileSystem::Default(), _parquet_data_path);
+    ASSERT_OK(builder.build(TQueryGlobals().time_zone, _parquet_delete_path, 845, &_need_skip_rowids));
+    ASSERT_EQ(1, _need_skip_rowids.size());
+
+    // The delete file is read once, the following builds of any data file hit the cache.
+    auto delete_file = cache->get_or_load(_parquet_delete_path, 845, [](IcebergPositionDeleteCache::DeleteFile*) {
+        return Status::InternalError("the delete file is read again");
+    });
+    ASSERT_OK(delete_file.status());
+    ASSERT_EQ(1, delete_file.value()->at(_parquet_data_path).size());
+
+    std::set<int64_t> other_rowids;
+    ParquetPositionDeleteBuilder other_builder(FileSystem::Default(), "other_data_file.parquet");
+    ASSERT_OK(other_builder.build(TQueryGlobals().time_zone, _parquet_delete_path, 845, &other_rowids));
+    ASSERT_TRUE(other_rowids.empty());
+    ASSERT_GT(cache->memory_usage(), 0);
+}
+
 } // namespace starrocks
\ No newline at end of file
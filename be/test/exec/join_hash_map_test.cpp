@@ -16,9 +16,14 @@
 
 #include <gtest/gtest.h>
 
+#include "exprs/column_ref.h"
+#include "runtime/current_thread.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 class JoinHashMapTest : public ::testing::Test {
@@ -838,6 +843,91 @@ TEST_F(JoinHashMapTest, CalcBucketNums) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, CalcNumBuildPartitions) {
+    ASSERT_EQ(1, JoinHashMapHelper::calc_num_build_partitions(1 << 10));
+    ASSERT_EQ(1, JoinHashMapHelper::calc_num_build_partitions(JoinHashMapHelper::NUM_BUCKETS_PER_BUILD_PARTITION));
+    ASSERT_EQ(8, JoinHashMapHelper::calc_num_build_partitions(JoinHashMapHelper::NUM_BUCKETS_PER_BUILD_PARTITION * 8));
+    ASSERT_EQ(JoinHashMapHelper::MAX_NUM_BUILD_PARTITIONS,
+              JoinHashMapHelper::calc_num_build_partitions(JoinHashMapHelper::MAX_BUCKET_SIZE));
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, PartitionBuildRows) {
+    const uint32_t row_count = 8;
+    JoinHashTableItems table_items;
+    table_items.row_count = row_count;
+    table_items.bucket_size = 16;
+    table_items.num_build_partitions = 4;
+    table_items.build_chunk = std::make_shared<Chunk>();
+    // Row 0 is the end of chains, and the value of row i is i.
+    table_items.build_chunk->append_column(create_int32_column(row_count + 1, 0), 0);
+    table_items.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    table_items.key_columns.emplace_back(create_int32_column(row_count + 1, 0));
+
+    // Partition of bucket b is b / 4.
+    Buffer<uint32_t> buckets{0, 15, 1, 9, 2, 5, 14, 3, 8};
+    JoinHashMapHelper::partition_build_rows(&table_items, buckets);
+
+    Buffer<int32_t> expected{0, 2, 4, 7, 5, 3, 8, 1, 6};
+    auto check_column = [&](const ColumnPtr& column) {
+        ASSERT_EQ(row_count + 1, column->size());
+        const auto& data = ColumnHelper::as_raw_column<Int32Column>(column)->get_data();
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(expected[i], data[i]);
+        }
+    };
+    check_column(table_items.build_chunk->get_column_by_slot_id(0));
+    check_column(table_items.key_columns[0]);
+    ASSERT_EQ((std::vector<uint32_t>{1, 4, 5, 7, 9}), table_items.build_partition_offsets);
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, PartitionBuildRowsWithColumnRefKey) {
+    const uint32_t row_count = 8;
+    JoinHashTableItems table_items;
+    table_items.row_count = row_count;
+    table_items.bucket_size = 16;
+    table_items.num_build_partitions = 4;
+    table_items.build_chunk = std::make_shared<Chunk>();
+    table_items.build_chunk->append_column(create_int32_column(row_count + 1, 0), 0);
+    table_items.build_chunk->append_column(create_int32_column(row_count + 1, 10), 1);
+    // The key is the build column of slot 1.
+    ColumnRef col_ref(_int_type, 1);
+    table_items.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, &col_ref});
+    table_items.key_columns.emplace_back(table_items.build_chunk->get_column_by_slot_id(1));
+    std::weak_ptr<Column> old_key_column = table_items.key_columns[0];
+
+    Buffer<uint32_t> buckets{0, 15, 1, 9, 2, 5, 14, 3, 8};
+    JoinHashMapHelper::partition_build_rows(&table_items, buckets);
+
+    // The key column references the reordered build column, and the original one is released.
+    ASSERT_EQ(table_items.build_chunk->get_column_by_slot_id(1).get(), table_items.key_columns[0].get());
+    ASSERT_TRUE(old_key_column.expired());
+    Buffer<int32_t> expected{10, 12, 14, 17, 15, 13, 18, 11, 16};
+    const auto& data = ColumnHelper::as_raw_column<Int32Column>(table_items.key_columns[0])->get_data();
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], data[i]);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, BuildPartitionsInParallel) {
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("hash_join_build_test").set_max_threads(4).build(&pool));
+
+    for (int32_t dop : {1, 2, 4, 16}) {
+        const uint32_t num_partitions = 1000;
+        std::vector<std::atomic<int32_t>> num_builds(num_partitions);
+        JoinHashMapHelper::build_partitions_in_parallel(pool.get(), dop, num_partitions,
+                                                        [&](uint32_t partition) { num_builds[partition]++; });
+        for (uint32_t p = 0; p < num_partitions; p++) {
+            ASSERT_EQ(1, num_builds[p].load());
+        }
+    }
+    pool->shutdown();
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, GetHashKey) {
     auto c1 = JoinHashMapTest::create_int32_column(2, 0);
@@ -871,6 +961,41 @@ TEST_F(JoinHashMapTest, CompileFixedSizeKeyColumn) {
     ASSERT_EQ(c3->get_data()[1], 12884901889l);
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, InlineShortStringKeyColumn) {
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT);
+    auto data_column = ColumnHelper::create_column(type, false);
+    data_column->resize(5);
+
+    auto c1 = BinaryColumn::create();
+    c1->append_string("");
+    c1->append_string("a");
+    c1->append_string("abcdefg");
+    c1->append_string("abcdefgh");
+    c1->append_string("a");
+    Columns columns{c1};
+
+    JoinHashMapHelper::serialize_fixed_size_key_column<LogicalType::TYPE_BIGINT>(columns, data_column.get(), 0, 5);
+
+    const auto& data = ColumnHelper::as_raw_column<Int64Column>(data_column)->get_data();
+    const auto* row0 = reinterpret_cast<const uint8_t*>(&data[0]);
+    ASSERT_EQ(0, row0[0]);
+    const auto* row1 = reinterpret_cast<const uint8_t*>(&data[1]);
+    ASSERT_EQ(1, row1[0]);
+    ASSERT_EQ('a', row1[1]);
+    ASSERT_EQ(0, row1[2]);
+    const auto* row2 = reinterpret_cast<const uint8_t*>(&data[2]);
+    ASSERT_EQ(7, row2[0]);
+    ASSERT_EQ(0, memcmp(row2 + 1, "abcdefg", 7));
+    // too long to be inlined, so it never matches any inlined build key.
+    const auto* row3 = reinterpret_cast<const uint8_t*>(&data[3]);
+    ASSERT_EQ(JoinHashMapHelper::kNonInlinedStringLength, row3[0]);
+
+    ASSERT_NE(data[0], data[1]);
+    ASSERT_NE(data[2], data[3]);
+    ASSERT_EQ(data[1], data[4]);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, ProbeNullOutput) {
     JoinHashTableItems table_items;
@@ -1882,6 +2007,70 @@ TEST_F(JoinHashMapTest, OneNullableKeyJoinHashTable) {
     hash_table.close();
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, OneKeyJoinHashTableWithPrefetch) {
+    bool old_enable_prefetch = config::hash_join_probe_enable_prefetch;
+    config::hash_join_probe_enable_prefetch = true;
+    DeferOp defer([&]() { config::hash_join_probe_enable_prefetch = old_enable_prefetch; });
+
+    // The coroutines skip the prefetches of the build rows.
+    TQueryOptions query_options;
+    query_options.__set_batch_size(config::vector_chunk_size);
+    query_options.__set_interleaving_group_size(0);
+    RuntimeState state(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    state.init_instance_mem_tracker();
+
+    for (bool nullable : {false, true}) {
+        TDescriptorTableBuilder row_desc_builder;
+        add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, nullable);
+        add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, nullable);
+
+        auto row_desc = create_row_desc(&row_desc_builder, nullable);
+        auto probe_row_desc = create_probe_desc(&row_desc_builder, nullable);
+        auto build_row_desc = create_build_desc(&row_desc_builder, nullable);
+
+        HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+        param.row_desc = row_desc.get();
+        param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+        param.probe_row_desc = probe_row_desc.get();
+        param.build_row_desc = build_row_desc.get();
+        param.prefetch_rows_counter = ADD_COUNTER(_runtime_profile, "HashTablePrefetchRows", TUnit::UNIT);
+        COUNTER_SET(param.prefetch_rows_counter, 0);
+
+        JoinHashTable hash_table;
+        hash_table.create(param);
+
+        auto build_chunk = create_int32_build_chunk(10, nullable);
+        auto probe_chunk = create_int32_probe_chunk(5, 1, nullable);
+        Columns probe_key_columns{probe_chunk->columns()[0]};
+        Columns build_key_columns{build_chunk->columns()[0]};
+        hash_table.append_chunk(build_chunk, build_key_columns);
+        ASSERT_OK(hash_table.build(&state));
+        ASSERT_EQ(JoinHashMapType::key32, hash_table._hash_map_type);
+        // The prefetches are only issued for the hash tables too large for the cache.
+        hash_table._table_items->cache_miss_serious = true;
+
+        ChunkPtr result_chunk = std::make_shared<Chunk>();
+        bool eos = false;
+        ASSERT_OK(hash_table.probe(&state, probe_key_columns, &probe_chunk, &result_chunk, &eos));
+
+        // The prefetches don't change the result.
+        ASSERT_EQ(result_chunk->num_columns(), 6);
+        for (SlotId slot_id = 0; slot_id < 6; slot_id++) {
+            ColumnPtr column = result_chunk->get_column_by_slot_id(slot_id);
+            uint32_t start_value = 1 + 10 * (slot_id % 3);
+            if (nullable) {
+                check_int32_nullable_column(column, 5, start_value);
+            } else {
+                check_int32_column(column, 5, start_value);
+            }
+        }
+        ASSERT_GT(param.prefetch_rows_counter->value(), 0);
+
+        hash_table.close();
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, FixedSizeJoinHashTable) {
     config::vector_chunk_size = 4096;
@@ -1990,6 +2179,116 @@ TEST_F(JoinHashMapTest, SerializeJoinHashTable) {
     hash_table.close();
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, SerializeJoinHashTableShareBuild) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+
+    auto row_desc = create_row_desc(&row_desc_builder, false);
+    auto probe_row_desc = create_probe_desc(&row_desc_builder, false);
+    auto build_row_desc = create_build_desc(&row_desc_builder, false);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.row_desc = row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable built_table;
+    built_table.create(param);
+    auto build_chunk = create_binary_build_chunk(10, false);
+    Columns build_key_columns{build_chunk->columns()[0], build_chunk->columns()[1]};
+    built_table.append_chunk(build_chunk, build_key_columns);
+    ASSERT_OK(built_table.build(_runtime_state.get()));
+
+    // The rows appended to the sharing hash table are dropped.
+    JoinHashTable hash_table;
+    hash_table.create(param);
+    auto dropped_chunk = create_binary_build_chunk(3, false);
+    Columns dropped_key_columns{dropped_chunk->columns()[0], dropped_chunk->columns()[1]};
+    hash_table.append_chunk(dropped_chunk, dropped_key_columns);
+    hash_table.share_build(built_table.build_items(), _runtime_state.get());
+    // The shared build outlives the hash table which built it.
+    built_table.close();
+    ASSERT_EQ(hash_table.get_row_count(), 10);
+
+    auto probe_chunk = create_binary_probe_chunk(5, 1, false);
+    Columns probe_key_columns{probe_chunk->columns()[0], probe_chunk->columns()[1]};
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+    ASSERT_OK(hash_table.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+
+    ASSERT_EQ(result_chunk->num_columns(), 6);
+    check_binary_column(result_chunk->get_column_by_slot_id(0), 5, 1);
+    check_binary_column(result_chunk->get_column_by_slot_id(1), 5, 11);
+    check_binary_column(result_chunk->get_column_by_slot_id(2), 5, 21);
+    check_binary_column(result_chunk->get_column_by_slot_id(3), 5, 1);
+    check_binary_column(result_chunk->get_column_by_slot_id(4), 5, 11);
+    check_binary_column(result_chunk->get_column_by_slot_id(5), 5, 21);
+
+    hash_table.close();
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, SerializeJoinHashTableShareBuildMemTracker) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+
+    auto row_desc = create_row_desc(&row_desc_builder, false);
+    auto probe_row_desc = create_probe_desc(&row_desc_builder, false);
+    auto build_row_desc = create_build_desc(&row_desc_builder, false);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.row_desc = row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    // The trackers of the query and of the fragment instances which build and share the hash table.
+    auto query_mem_tracker = std::make_shared<MemTracker>(MemTracker::QUERY, -1, "query", nullptr);
+    MemTracker builder_mem_tracker(-1, "builder", query_mem_tracker.get());
+    MemTracker sharer_mem_tracker(-1, "sharer", query_mem_tracker.get());
+
+    JoinHashTable built_table;
+    JoinHashTable hash_table;
+    {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&builder_mem_tracker);
+        built_table.create(param);
+        built_table.set_mem_tracker(query_mem_tracker);
+        auto build_chunk = create_binary_build_chunk(100000, false);
+        Columns build_key_columns{build_chunk->columns()[0], build_chunk->columns()[1]};
+        built_table.append_chunk(build_chunk, build_key_columns);
+        ASSERT_OK(built_table.build(_runtime_state.get()));
+    }
+    {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&sharer_mem_tracker);
+        hash_table.create(param);
+        hash_table.set_mem_tracker(query_mem_tracker);
+        hash_table.share_build(built_table.build_items(), _runtime_state.get());
+    }
+    const int64_t build_bytes = hash_table.mem_usage();
+    ASSERT_GT(build_bytes, 0);
+
+    // The instance which built the hash table finishes first, the shared build is released by the other one.
+    {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&builder_mem_tracker);
+        built_table.close();
+    }
+    {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&sharer_mem_tracker);
+        hash_table.close();
+    }
+
+    // Neither instance is charged for the shared build, and the query gets back what was charged to it.
+    ASSERT_LT(std::abs(builder_mem_tracker.consumption()), build_bytes / 10);
+    ASSERT_LT(std::abs(sharer_mem_tracker.consumption()), build_bytes / 10);
+    ASSERT_LT(std::abs(query_mem_tracker->consumption()), build_bytes / 10);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, FixedSizeJoinBuildFuncForNotNullableColumn) {
     JoinHashTableItems table_items;
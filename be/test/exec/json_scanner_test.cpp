@@ -1456,4 +1456,61 @@ TEST_F(JsonScannerTest, file_stream) {
     EXPECT_EQ("[3, 4]", chunk->debug_row(1));
 }
 
+TEST_F(JsonScannerTest, test_rows_with_changing_keys) {
+    auto load_id = UniqueId::gen_uid();
+    auto pipe = std::make_shared<StreamLoadPipe>(1024 * 1024, 64 * 1024);
+    DeferOp remove_pipe([&]() { _state->exec_env()->load_stream_mgr()->remove(load_id); });
+    ASSERT_OK(_state->exec_env()->load_stream_mgr()->put(load_id, pipe));
+
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TYPE_INT);
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.file_type = TFileType::FILE_STREAM;
+    range.strip_outer_array = false;
+    range.__isset.strip_outer_array = false;
+    range.__isset.jsonpaths = false;
+    range.__isset.json_root = false;
+    range.__set_load_id(load_id.to_thrift());
+    ranges.emplace_back(range);
+
+    // The columns without data depend on the keys of each row, rows sharing the keys of the previous row
+    // reuse its columns without data.
+    std::string data = R"({"k1": 1, "k2": 2}
+{"k1": 3, "k2": 4}
+{"k1": 5, "k3": 6}
+{"k1": 7, "k3": 8}
+{"k1": 9}
+{"k1": 10, "k2": 11, "k3": 12}
+{"k3": 13, "k2": 14, "k1": 15}
+{"k3": 16, "k2": 17}
+{"k3": 18, "k2": 19})";
+    EXPECT_OK(pipe->append(data.c_str(), data.size()));
+    EXPECT_OK(pipe->finish());
+
+    auto scanner = create_json_scanner(types, ranges, {"k1", "k2", "k3"});
+    EXPECT_OK(scanner->open());
+
+    auto res = scanner->get_next();
+    EXPECT_OK(res.status());
+
+    ChunkPtr chunk = res.value();
+    EXPECT_EQ(3, chunk->num_columns());
+    EXPECT_EQ(9, chunk->num_rows());
+
+    EXPECT_EQ("[1, 2, NULL]", chunk->debug_row(0));
+    EXPECT_EQ("[3, 4, NULL]", chunk->debug_row(1));
+    EXPECT_EQ("[5, NULL, 6]", chunk->debug_row(2));
+    EXPECT_EQ("[7, NULL, 8]", chunk->debug_row(3));
+    EXPECT_EQ("[9, NULL, NULL]", chunk->debug_row(4));
+    EXPECT_EQ("[10, 11, 12]", chunk->debug_row(5));
+    EXPECT_EQ("[15, 14, 13]", chunk->debug_row(6));
+    EXPECT_EQ("[NULL, 17, 16]", chunk->debug_row(7));
+    EXPECT_EQ("[NULL, 19, 18]", chunk->debug_row(8));
+}
+
 } // namespace starrocks
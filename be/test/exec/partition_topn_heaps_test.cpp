@@ -0,0 +1,124 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/partition/partition_topn_heaps.h"
+
+#include <gtest/gtest.h>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "exprs/column_ref.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class PartitionTopnHeapsTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        TUniqueId fragment_id;
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        TQueryGlobals query_globals;
+        _runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+        _runtime_state->init_instance_mem_tracker();
+
+        _expr = std::make_unique<ColumnRef>(TypeDescriptor(TYPE_INT), 0);
+        _sort_exprs.push_back(new ExprContext(_expr.get()));
+        ASSERT_OK(Expr::prepare(_sort_exprs, _runtime_state.get()));
+        ASSERT_OK(Expr::open(_sort_exprs, _runtime_state.get()));
+    }
+
+    void TearDown() override {
+        for (auto* ctx : _sort_exprs) {
+            delete ctx;
+        }
+        _sort_exprs.clear();
+    }
+
+protected:
+    static ChunkPtr make_chunk(const std::vector<int32_t>& values) {
+        auto column = Int32Column::create();
+        for (auto v : values) {
+            column->append(v);
+        }
+        Chunk::SlotHashMap map;
+        map[0] = 0;
+        return std::make_shared<Chunk>(Columns{column}, map);
+    }
+
+    static std::vector<int32_t> consume(PartitionTopnHeaps& heaps, size_t chunk_size) {
+        std::vector<int32_t> result;
+        while (heaps.has_output()) {
+            ChunkPtr chunk = heaps.get_next(chunk_size);
+            EXPECT_LE(chunk->num_rows(), chunk_size);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                result.push_back(chunk->get(i).get(0).get_int32());
+            }
+        }
+        return result;
+    }
+
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::unique_ptr<ColumnRef> _expr;
+    std::vector<ExprContext*> _sort_exprs;
+};
+
+TEST_F(PartitionTopnHeapsTest, test_topn_of_each_partition) {
+    PartitionTopnHeaps heaps(&_sort_exprs, {true}, {true}, 0, 3);
+    heaps.add_partition();
+    heaps.add_partition();
+    heaps.add_partition();
+    ASSERT_OK(heaps.update(0, make_chunk({9, 3, 7})));
+    ASSERT_OK(heaps.update(1, make_chunk({5})));
+    ASSERT_OK(heaps.update(0, make_chunk({8, 1, 4, 2})));
+    ASSERT_OK(heaps.update(1, make_chunk({6, 4})));
+    ASSERT_OK(heaps.update(0, make_chunk({10})));
+    heaps.done();
+
+    // Partition 2 has no rows.
+    EXPECT_EQ((std::vector<int32_t>{1, 2, 3, 4, 5, 6}), consume(heaps, 4));
+    EXPECT_EQ(nullptr, heaps.get_next(4));
+}
+
+TEST_F(PartitionTopnHeapsTest, test_offset_and_desc) {
+    PartitionTopnHeaps heaps(&_sort_exprs, {false}, {false}, 1, 2);
+    heaps.add_partition();
+    heaps.add_partition();
+    ASSERT_OK(heaps.update(0, make_chunk({1, 5, 3, 4, 2})));
+    ASSERT_OK(heaps.update(1, make_chunk({7})));
+    heaps.done();
+
+    // The first row of each partition is skipped.
+    EXPECT_EQ((std::vector<int32_t>{4, 3}), consume(heaps, 1024));
+}
+
+TEST_F(PartitionTopnHeapsTest, test_compact_arena) {
+    PartitionTopnHeaps heaps(&_sort_exprs, {true}, {true}, 0, 2);
+    heaps.add_partition();
+    std::vector<int32_t> values(1024);
+    for (int32_t round = 0; round < 64; round++) {
+        // Every round is better than the previous one, so all of its rows get into the arena.
+        for (int32_t i = 0; i < values.size(); i++) {
+            values[i] = -round * 1024 - i;
+        }
+        ASSERT_OK(heaps.update(0, make_chunk(values)));
+        ASSERT_LT(heaps.num_arena_rows(), 8192);
+    }
+    heaps.done();
+
+    EXPECT_EQ((std::vector<int32_t>{-64 * 1024 + 1, -64 * 1024 + 2}), consume(heaps, 1024));
+}
+
+} // namespace starrocks
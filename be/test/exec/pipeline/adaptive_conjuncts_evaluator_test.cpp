@@ -0,0 +1,132 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/adaptive/adaptive_conjuncts_evaluator.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/object_pool.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+// Passes the rows whose value of the first column is a multiple of |divisor|, and counts the rows it evaluates.
+class ModuloPredicate final : public Expr {
+public:
+    ModuloPredicate(int32_t divisor, size_t* evaluated_rows)
+            : Expr(TypeDescriptor(TYPE_BOOLEAN), false), _divisor(divisor), _evaluated_rows(evaluated_rows) {}
+
+    StatusOr<ColumnPtr> evaluate_checked(ExprContext*, Chunk* chunk) override {
+        auto* values = down_cast<Int32Column*>(chunk->get_column_by_index(0).get());
+        auto result = BooleanColumn::create();
+        for (int32_t value : values->get_data()) {
+            result->append(value % _divisor == 0);
+        }
+        *_evaluated_rows += chunk->num_rows();
+        return result;
+    }
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new ModuloPredicate(*this)); }
+
+    bool is_constant() const override { return false; }
+
+private:
+    int32_t _divisor;
+    size_t* _evaluated_rows;
+};
+
+class AdaptiveConjunctsEvaluatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.batch_size = 4096;
+        _runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        _runtime_state->init_instance_mem_tracker();
+    }
+
+    ExprContext* _create_predicate(int32_t divisor, size_t* evaluated_rows) {
+        auto* expr = _pool.add(new ModuloPredicate(divisor, evaluated_rows));
+        auto* ctx = _pool.add(new ExprContext(expr));
+        CHECK(ctx->prepare(_runtime_state.get()).ok());
+        CHECK(ctx->open(_runtime_state.get()).ok());
+        return ctx;
+    }
+
+    static ChunkPtr _create_chunk(int32_t start, int32_t num_rows) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < num_rows; i++) {
+            column->append(start + i);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), 0);
+        return chunk;
+    }
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _runtime_state;
+};
+
+TEST_F(AdaptiveConjunctsEvaluatorTest, test_reorder_by_selectivity) {
+    size_t all_pass_rows = 0;
+    size_t selective_rows = 0;
+    ExprContext* all_pass = _create_predicate(1, &all_pass_rows);
+    ExprContext* selective = _create_predicate(10, &selective_rows);
+
+    AdaptiveConjunctsEvaluator evaluator;
+    evaluator.init({all_pass, selective});
+    for (int i = 0; i < 7; i++) {
+        auto chunk = _create_chunk(0, 4096);
+        ASSERT_OK(evaluator.evaluate(chunk.get()));
+        ASSERT_EQ(410, chunk->num_rows());
+    }
+    ASSERT_EQ(all_pass, evaluator.conjuncts()[0]);
+    ASSERT_EQ(7 * 4096, all_pass_rows);
+
+    // The selective predicate runs first since the 8th chunk, and the other one only evaluates the rows passing it.
+    all_pass_rows = 0;
+    selective_rows = 0;
+    auto chunk = _create_chunk(0, 4096);
+    ASSERT_OK(evaluator.evaluate(chunk.get()));
+    ASSERT_EQ(410, chunk->num_rows());
+    ASSERT_EQ(selective, evaluator.conjuncts()[0]);
+    ASSERT_EQ(4096, selective_rows);
+    ASSERT_EQ(410, all_pass_rows);
+    for (size_t i = 0; i < chunk->num_rows(); i++) {
+        ASSERT_EQ(0, chunk->get_column_by_index(0)->get(i).get_int32() % 10);
+    }
+}
+
+TEST_F(AdaptiveConjunctsEvaluatorTest, test_filter_all) {
+    size_t first_rows = 0;
+    size_t second_rows = 0;
+    AdaptiveConjunctsEvaluator evaluator;
+    evaluator.init({_create_predicate(5000, &first_rows), _create_predicate(2, &second_rows)});
+
+    auto chunk = _create_chunk(1, 4096);
+    ASSERT_OK(evaluator.evaluate(chunk.get()));
+    ASSERT_EQ(0, chunk->num_rows());
+    ASSERT_EQ(4096, first_rows);
+    ASSERT_EQ(0, second_rows);
+
+    // An empty chunk evaluates nothing.
+    ASSERT_OK(evaluator.evaluate(chunk.get()));
+    ASSERT_EQ(4096, first_rows);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,267 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/aggregate/aggregate_streaming_sink_operator.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/pipeline/query_context.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+class AggregateStreamingSinkOperatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.__set_batch_size(kChunkSize);
+        _state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        _state->init_instance_mem_tracker();
+        _state->set_query_ctx(_query_ctx.get());
+
+        // The input tuple (k INT, v BIGINT) and the tuple of the partial results (k INT, sum(v) BIGINT).
+        TDescriptorTableBuilder desc_builder;
+        TTupleDescriptorBuilder input_tuple;
+        input_tuple.add_slot(TSlotDescriptorBuilder().type(TYPE_INT).column_name("k").nullable(false).build());
+        input_tuple.add_slot(TSlotDescriptorBuilder().type(TYPE_BIGINT).column_name("v").nullable(false).build());
+        input_tuple.build(&desc_builder);
+        TTupleDescriptorBuilder result_tuple;
+        result_tuple.add_slot(TSlotDescriptorBuilder().type(TYPE_INT).column_name("k").nullable(false).build());
+        result_tuple.add_slot(TSlotDescriptorBuilder().type(TYPE_BIGINT).column_name("sum").nullable(true).build());
+        result_tuple.build(&desc_builder);
+        DescriptorTbl* desc_tbl = nullptr;
+        ASSERT_OK(DescriptorTbl::create(_state.get(), &_pool, desc_builder.desc_tbl(), &desc_tbl, kChunkSize));
+        _state->set_desc_tbl(desc_tbl);
+        const auto& input_slots = desc_tbl->get_tuple_descriptor(0)->slots();
+        _key_slot = input_slots[0];
+        _value_slot = input_slots[1];
+        const auto& result_slots = desc_tbl->get_tuple_descriptor(1)->slots();
+        _result_key_slot_id = result_slots[0]->id();
+        _result_sum_slot_id = result_slots[1]->id();
+
+        // SELECT k, sum(v) GROUP BY k, in the streaming pre-aggregation of auto mode.
+        _tnode.__set_node_id(kPlanNodeId);
+        _tnode.__set_node_type(TPlanNodeType::AGGREGATION_NODE);
+        _tnode.__set_limit(-1);
+        TAggregationNode& agg_node = _tnode.agg_node;
+        agg_node.__set_need_finalize(false);
+        agg_node.__set_streaming_preaggregation_mode(TStreamingPreaggregationMode::AUTO);
+        agg_node.__set_intermediate_tuple_id(1);
+        agg_node.__set_output_tuple_id(1);
+        agg_node.__set_grouping_exprs({slot_ref_expr(_key_slot)});
+        TFunction fn;
+        fn.name.__set_function_name("sum");
+        fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        fn.__set_arg_types({TypeDescriptor(TYPE_BIGINT).to_thrift()});
+        fn.__set_ret_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+        TAggregateFunction agg_fn;
+        agg_fn.__set_intermediate_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+        fn.__set_aggregate_fn(agg_fn);
+        TExprNode fn_node;
+        fn_node.__set_node_type(TExprNodeType::AGG_EXPR);
+        fn_node.__set_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+        fn_node.__set_num_children(1);
+        fn_node.__set_fn(fn);
+        fn_node.__set_has_nullable_child(false);
+        fn_node.__set_is_nullable(true);
+        TExpr fn_expr;
+        fn_expr.__set_nodes({fn_node, slot_ref_expr(_value_slot).nodes[0]});
+        agg_node.__set_aggregate_functions({fn_expr});
+
+        _old_min_avg_length = config::streaming_agg_sorted_run_min_avg_length;
+    }
+
+    void TearDown() override {
+        if (_sink != nullptr) {
+            _sink->close(_state.get());
+        }
+        config::streaming_agg_sorted_run_min_avg_length = _old_min_avg_length;
+    }
+
+    static TExpr slot_ref_expr(SlotDescriptor* slot) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.__set_num_children(0);
+        node.__set_type(slot->type().to_thrift());
+        TSlotRef slot_ref;
+        slot_ref.__set_slot_id(slot->id());
+        slot_ref.__set_tuple_id(slot->parent());
+        node.__set_slot_ref(slot_ref);
+        node.__set_is_nullable(slot->is_nullable());
+        TExpr expr;
+        expr.__set_nodes({node});
+        return expr;
+    }
+
+    void create_sink() {
+        auto aggregator_factory = std::make_shared<AggregatorFactory>(_tnode);
+        _sink_factory = std::make_shared<AggregateStreamingSinkOperatorFactory>(1, kPlanNodeId, aggregator_factory);
+        _sink = std::dynamic_pointer_cast<AggregateStreamingSinkOperator>(_sink_factory->create(1, 0));
+        ASSERT_OK(_sink->prepare(_state.get()));
+    }
+
+    // The rows k = i / run_length, v = i for i in [0, num_rows), in chunks of kChunkSize rows. The rows of the chunks
+    // for which |shuffled| returns true are shuffled.
+    std::vector<ChunkPtr> create_chunks(int32_t num_rows, int32_t run_length,
+                                        const std::function<bool(int32_t)>& shuffled) {
+        std::mt19937 rng(num_rows);
+        std::vector<ChunkPtr> chunks;
+        for (int32_t first = 0; first < num_rows; first += kChunkSize) {
+            std::vector<int32_t> rows;
+            for (int32_t i = first; i < std::min(first + kChunkSize, num_rows); i++) {
+                rows.push_back(i);
+            }
+            if (shuffled(static_cast<int32_t>(chunks.size()))) {
+                std::shuffle(rows.begin(), rows.end(), rng);
+            }
+            auto keys = Int32Column::create();
+            auto values = Int64Column::create();
+            for (int32_t i : rows) {
+                keys->append(i / run_length);
+                values->append(i);
+            }
+            auto chunk = std::make_shared<Chunk>();
+            chunk->append_column(std::move(keys), _key_slot->id());
+            chunk->append_column(std::move(values), _value_slot->id());
+            chunks.emplace_back(std::move(chunk));
+        }
+        return chunks;
+    }
+
+    static std::map<int32_t, int64_t> expected_sums(int32_t num_rows, int32_t run_length) {
+        std::map<int32_t, int64_t> sums;
+        for (int32_t i = 0; i < num_rows; i++) {
+            sums[i / run_length] += i;
+        }
+        return sums;
+    }
+
+    // Pushes the chunks through the sink, and merges the partial results it outputs, both through the chunk buffer
+    // and the hash table, by the group by keys.
+    std::map<int32_t, int64_t> aggregate(const std::vector<ChunkPtr>& chunks) {
+        for (const auto& chunk : chunks) {
+            CHECK_OK(_sink->push_chunk(_state.get(), chunk));
+        }
+        CHECK_OK(_sink->set_finishing(_state.get()));
+
+        std::map<int32_t, int64_t> sums;
+        auto merge = [&](const ChunkPtr& chunk) {
+            auto keys = chunk->get_column_by_slot_id(_result_key_slot_id);
+            auto values = chunk->get_column_by_slot_id(_result_sum_slot_id);
+            for (size_t row = 0; row < chunk->num_rows(); row++) {
+                sums[keys->get(row).get_int32()] += values->get(row).get_int64();
+            }
+        };
+        auto& aggregator = _sink->_aggregator;
+        while (!aggregator->is_chunk_buffer_empty()) {
+            merge(aggregator->poll_chunk_buffer());
+        }
+        if (!aggregator->is_ht_eos()) {
+            aggregator->it_hash() = aggregator->_state_allocator.begin();
+            while (!aggregator->is_ht_eos()) {
+                ChunkPtr chunk = std::make_shared<Chunk>();
+                CHECK_OK(aggregator->convert_hash_map_to_chunk(kChunkSize, &chunk));
+                merge(chunk);
+            }
+        }
+        return sums;
+    }
+
+    static constexpr int32_t kChunkSize = 256;
+    static constexpr int32_t kPlanNodeId = 1;
+
+    ObjectPool _pool;
+    std::unique_ptr<QueryContext> _query_ctx = std::make_unique<QueryContext>();
+    std::shared_ptr<RuntimeState> _state;
+    SlotDescriptor* _key_slot = nullptr;
+    SlotDescriptor* _value_slot = nullptr;
+    SlotId _result_key_slot_id = 0;
+    SlotId _result_sum_slot_id = 0;
+    TPlanNode _tnode;
+    OperatorFactoryPtr _sink_factory;
+    std::shared_ptr<AggregateStreamingSinkOperator> _sink;
+    int32_t _old_min_avg_length = 0;
+};
+
+TEST_F(AggregateStreamingSinkOperatorTest, sorted_runs_are_disabled_by_default) {
+    ASSERT_EQ(0, config::streaming_agg_sorted_run_min_avg_length);
+    create_sink();
+    ASSERT_EQ(nullptr, _sink->_sorted_aggregator);
+
+    const int32_t num_rows = 8 * kChunkSize;
+    ASSERT_EQ(expected_sums(num_rows, 32), aggregate(create_chunks(num_rows, 32, [](int32_t) { return false; })));
+    ASSERT_EQ(AggrAutoState::INIT_PREAGG, _sink->_auto_state);
+}
+
+TEST_F(AggregateStreamingSinkOperatorTest, sorted_input) {
+    config::streaming_agg_sorted_run_min_avg_length = 16;
+    create_sink();
+
+    // The runs cross the chunk boundaries, the group left open by a chunk continues in the next one.
+    const int32_t num_rows = 8 * kChunkSize;
+    const int32_t run_length = 48;
+    auto chunks = create_chunks(num_rows, run_length, [](int32_t) { return false; });
+    ASSERT_OK(_sink->push_chunk(_state.get(), chunks[0]));
+    ASSERT_EQ(AggrAutoState::SORTED_PREAGG, _sink->_auto_state);
+    // The sorted aggregator takes the group by columns the aggregator evaluated.
+    ASSERT_EQ(_sink->_aggregator->group_by_columns()[0].get(), _sink->_sorted_aggregator->group_by_columns()[0].get());
+
+    chunks.erase(chunks.begin());
+    ASSERT_EQ(expected_sums(num_rows, run_length), aggregate(chunks));
+    ASSERT_EQ(AggrAutoState::SORTED_PREAGG, _sink->_auto_state);
+    ASSERT_EQ(8, _sink->_sorted_runs_chunk_count->value());
+    ASSERT_EQ(0, _sink->_aggregator->hash_map_variant().size());
+}
+
+TEST_F(AggregateStreamingSinkOperatorTest, partially_sorted_input) {
+    config::streaming_agg_sorted_run_min_avg_length = 16;
+    create_sink();
+
+    // Three sorted chunks and then one shuffled chunk, over and over.
+    const int32_t num_chunks = 16;
+    const int32_t num_rows = num_chunks * kChunkSize;
+    const int32_t run_length = 32;
+    ASSERT_EQ(expected_sums(num_rows, run_length),
+              aggregate(create_chunks(num_rows, run_length, [](int32_t chunk) { return chunk % 4 == 3; })));
+    ASSERT_EQ(num_chunks / 4 * 3, _sink->_sorted_runs_chunk_count->value());
+    // The shuffled chunks go back to the hash table.
+    ASSERT_GT(_sink->_aggregator->hash_map_variant().size(), 0);
+    ASSERT_EQ(num_chunks / 4 * 2, _sink->_aggregator->auto_state_switch_count()->value());
+}
+
+TEST_F(AggregateStreamingSinkOperatorTest, unsorted_input) {
+    config::streaming_agg_sorted_run_min_avg_length = 16;
+    create_sink();
+
+    const int32_t num_rows = 8 * kChunkSize;
+    const int32_t run_length = 32;
+    ASSERT_EQ(expected_sums(num_rows, run_length),
+              aggregate(create_chunks(num_rows, run_length, [](int32_t) { return true; })));
+    ASSERT_EQ(0, _sink->_sorted_runs_chunk_count->value());
+    ASSERT_EQ(AggrAutoState::INIT_PREAGG, _sink->_auto_state);
+    ASSERT_EQ(num_rows / run_length, _sink->_aggregator->hash_map_variant().size());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,259 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/hashjoin/asof_join_context.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include "column/column_helper.h"
+#include "common/object_pool.h"
+#include "exec/pipeline/runtime_filter_types.h"
+#include "exprs/expr.h"
+#include "runtime/descriptor_helper.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+using Values = std::vector<std::optional<int32_t>>;
+
+class AsofJoinContextTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        TQueryGlobals query_globals;
+        _state = std::make_shared<RuntimeState>(TUniqueId(), query_options, query_globals, nullptr);
+        _state->init_instance_mem_tracker();
+
+        // The build side has the equi-join key, the asof key and a payload.
+        TDescriptorTableBuilder desc_builder;
+        TTupleDescriptorBuilder tuple_builder;
+        for (int i = 0; i < 3; i++) {
+            tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                           .type(TYPE_INT)
+                                           .column_name("c" + std::to_string(i))
+                                           .column_pos(i)
+                                           .nullable(true)
+                                           .build());
+        }
+        tuple_builder.build(&desc_builder);
+        DescriptorTbl* tbl = nullptr;
+        ASSERT_OK(DescriptorTbl::create(_state.get(), &_pool, desc_builder.desc_tbl(), &tbl,
+                                        config::vector_chunk_size));
+        _build_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{false});
+        const auto& slots = _build_row_desc->tuple_descriptors()[0]->slots();
+        _key_slot = slots[0]->id();
+        _asof_slot = slots[1]->id();
+        _value_slot = slots[2]->id();
+
+        _rf_hub.add_holder(kPlanNodeId);
+    }
+
+    static TExprNode slot_ref_node(SlotId slot_id, TupleId tuple_id) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.__set_num_children(0);
+        node.__set_type(TypeDescriptor(TYPE_INT).to_thrift());
+        TSlotRef slot_ref;
+        slot_ref.__set_slot_id(slot_id);
+        slot_ref.__set_tuple_id(tuple_id);
+        node.__set_slot_ref(slot_ref);
+        return node;
+    }
+
+    ExprContext* create_expr_context(const std::vector<TExprNode>& nodes) {
+        TExpr texpr;
+        texpr.__set_nodes(nodes);
+        ExprContext* ctx = nullptr;
+        CHECK(Expr::create_expr_tree(&_pool, texpr, &ctx, _state.get()).ok());
+        CHECK(ctx->prepare(_state.get()).ok());
+        CHECK(ctx->open(_state.get()).ok());
+        _expr_ctxs.push_back(ctx);
+        return ctx;
+    }
+
+    // probe.asof_key op build.asof_key, the probe slot is never evaluated by the context.
+    std::unique_ptr<AsofJoinContext> create_context(TJoinOp::type join_type, TExprOpcode::type op) {
+        TExprNode pred;
+        pred.__set_node_type(TExprNodeType::BINARY_PRED);
+        pred.__set_child_type(TPrimitiveType::INT);
+        pred.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+        pred.__set_opcode(op);
+        pred.__set_num_children(2);
+
+        AsofJoinContextParams params;
+        params.plan_node_id = kPlanNodeId;
+        params.join_type = join_type;
+        params.build_expr_ctxs = {create_expr_context({slot_ref_node(_key_slot, 0)})};
+        params.asof_join_ctx = create_expr_context({pred, slot_ref_node(100, 1), slot_ref_node(_asof_slot, 0)});
+        params.build_row_desc = _build_row_desc.get();
+        params.rf_hub = &_rf_hub;
+        return std::make_unique<AsofJoinContext>(std::move(params));
+    }
+
+    static ColumnPtr create_column(const Values& values) {
+        auto column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+        for (const auto& value : values) {
+            if (value.has_value()) {
+                column->append_datum(Datum(value.value()));
+            } else {
+                column->append_nulls(1);
+            }
+        }
+        return column;
+    }
+
+    ChunkPtr create_build_chunk(const Values& keys, const Values& asof_keys, const Values& values) {
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(create_column(keys), _key_slot);
+        chunk->append_column(create_column(asof_keys), _asof_slot);
+        chunk->append_column(create_column(values), _value_slot);
+        return chunk;
+    }
+
+    // The payload of the matched build row of every probe row, nullopt if there is no match.
+    Values probe(const AsofJoinContext& context, const Values& keys, const Values& asof_keys) {
+        Buffer<uint32_t> build_rows;
+        context.find({create_column(keys)}, create_column(asof_keys), &build_rows);
+        const auto& payload = context.build_chunk()->get_column_by_slot_id(_value_slot);
+        Values res;
+        for (uint32_t row : build_rows) {
+            if (row == context.null_build_row()) {
+                res.emplace_back(std::nullopt);
+            } else {
+                res.emplace_back(payload->get(row).get_int32());
+            }
+        }
+        return res;
+    }
+
+    // Build key 1 with the asof keys 10, 20, 20, 30 and key 2 with 15, spread over two builders.
+    std::unique_ptr<AsofJoinContext> build(TJoinOp::type join_type, TExprOpcode::type op) {
+        auto context = create_context(join_type, op);
+        context->incr_builder();
+        context->incr_builder();
+        EXPECT_OK(context->append_build_chunk(0, create_build_chunk({1, 2, 1}, {20, 15, 30}, {1, 4, 3})));
+        EXPECT_OK(context->append_build_chunk(1, create_build_chunk({1, 1}, {10, 20}, {0, 2})));
+        EXPECT_OK(context->finish_one_right_sinker(1, _state.get()));
+        EXPECT_FALSE(context->is_right_finished());
+        EXPECT_OK(context->finish_one_right_sinker(0, _state.get()));
+        EXPECT_TRUE(context->is_right_finished());
+        EXPECT_EQ(5, context->num_build_rows());
+        EXPECT_EQ(2, context->num_groups());
+        return context;
+    }
+
+    void TearDown() override {
+        for (auto* ctx : _expr_ctxs) {
+            ctx->close(_state.get());
+        }
+    }
+
+    static constexpr int32_t kPlanNodeId = 1;
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _state;
+    std::unique_ptr<RowDescriptor> _build_row_desc;
+    RuntimeFilterHub _rf_hub;
+    std::vector<ExprContext*> _expr_ctxs;
+    SlotId _key_slot = 0;
+    SlotId _asof_slot = 0;
+    SlotId _value_slot = 0;
+};
+
+const Values kProbeKeys = {1, 1, 1, 1, 1, 2, 3};
+const Values kProbeAsofKeys = {5, 10, 20, 25, 35, 15, 20};
+
+TEST_F(AsofJoinContextTest, greater_equal) {
+    auto context = build(TJoinOp::ASOF_INNER_JOIN, TExprOpcode::GE);
+    // The build rows with the same asof key keep their input order, the last one is the closest.
+    Values expected = {std::nullopt, 0, 2, 2, 3, 4, std::nullopt};
+    ASSERT_EQ(expected, probe(*context, kProbeKeys, kProbeAsofKeys));
+}
+
+TEST_F(AsofJoinContextTest, greater) {
+    auto context = build(TJoinOp::ASOF_INNER_JOIN, TExprOpcode::GT);
+    Values expected = {std::nullopt, std::nullopt, 0, 2, 3, std::nullopt, std::nullopt};
+    ASSERT_EQ(expected, probe(*context, kProbeKeys, kProbeAsofKeys));
+}
+
+TEST_F(AsofJoinContextTest, less_equal) {
+    auto context = build(TJoinOp::ASOF_INNER_JOIN, TExprOpcode::LE);
+    // The first one of the build rows with the same asof key is the closest.
+    Values expected = {0, 0, 1, 3, std::nullopt, 4, std::nullopt};
+    ASSERT_EQ(expected, probe(*context, kProbeKeys, kProbeAsofKeys));
+}
+
+TEST_F(AsofJoinContextTest, less) {
+    auto context = build(TJoinOp::ASOF_INNER_JOIN, TExprOpcode::LT);
+    Values expected = {0, 1, 3, 3, std::nullopt, std::nullopt, std::nullopt};
+    ASSERT_EQ(expected, probe(*context, kProbeKeys, kProbeAsofKeys));
+}
+
+TEST_F(AsofJoinContextTest, inner_join_build_chunk) {
+    auto context = build(TJoinOp::ASOF_INNER_JOIN, TExprOpcode::GE);
+    // Sorted by the equi-join key and then the asof key.
+    const auto& build_chunk = context->build_chunk();
+    ASSERT_EQ(5, build_chunk->num_rows());
+    ASSERT_EQ("[1, 1, 1, 1, 2]", build_chunk->get_column_by_slot_id(_key_slot)->debug_string());
+    ASSERT_EQ("[10, 20, 20, 30, 15]", build_chunk->get_column_by_slot_id(_asof_slot)->debug_string());
+    ASSERT_EQ("[0, 1, 2, 3, 4]", build_chunk->get_column_by_slot_id(_value_slot)->debug_string());
+}
+
+TEST_F(AsofJoinContextTest, left_outer_join_build_chunk) {
+    auto context = build(TJoinOp::ASOF_LEFT_OUTER_JOIN, TExprOpcode::GE);
+    // The unmatched probe rows refer to the trailing null row.
+    const auto& build_chunk = context->build_chunk();
+    ASSERT_EQ(6, build_chunk->num_rows());
+    ASSERT_EQ(5, context->null_build_row());
+    for (const auto& column : build_chunk->columns()) {
+        ASSERT_TRUE(column->is_nullable());
+        ASSERT_TRUE(column->is_null(context->null_build_row()));
+    }
+    Values expected = {std::nullopt, 0, 2, 2, 3, 4, std::nullopt};
+    ASSERT_EQ(expected, probe(*context, kProbeKeys, kProbeAsofKeys));
+}
+
+TEST_F(AsofJoinContextTest, null_keys) {
+    for (auto join_type : {TJoinOp::ASOF_INNER_JOIN, TJoinOp::ASOF_LEFT_OUTER_JOIN}) {
+        auto context = create_context(join_type, TExprOpcode::GE);
+        context->incr_builder();
+        // The build rows with a null equi-join key or a null asof key are dropped.
+        ASSERT_OK(context->append_build_chunk(
+                0, create_build_chunk({std::nullopt, 1, 1, 1}, {10, std::nullopt, 20, 30}, {0, 1, 2, 3})));
+        ASSERT_OK(context->finish_one_right_sinker(0, _state.get()));
+        ASSERT_EQ(2, context->num_build_rows());
+        ASSERT_EQ(1, context->num_groups());
+
+        // The probe rows with a null equi-join key or a null asof key never match.
+        Values expected = {std::nullopt, std::nullopt, 2, 3};
+        ASSERT_EQ(expected, probe(*context, {std::nullopt, 1, 1, 1}, {25, std::nullopt, 25, 35}));
+    }
+}
+
+TEST_F(AsofJoinContextTest, empty_build) {
+    auto context = create_context(TJoinOp::ASOF_LEFT_OUTER_JOIN, TExprOpcode::GE);
+    context->incr_builder();
+    ASSERT_OK(context->append_build_chunk(0, create_build_chunk({}, {}, {})));
+    ASSERT_OK(context->finish_one_right_sinker(0, _state.get()));
+    ASSERT_EQ(0, context->num_build_rows());
+    ASSERT_EQ(1, context->build_chunk()->num_rows());
+
+    Values expected = {std::nullopt, std::nullopt};
+    ASSERT_EQ(expected, probe(*context, {1, 2}, {10, 20}));
+}
+
+} // namespace starrocks::pipeline
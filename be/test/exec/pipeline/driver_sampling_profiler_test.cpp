@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/driver_sampling_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "runtime/current_thread.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace starrocks::pipeline {
+
+TEST(DriverSamplingProfilerTest, test_sample_and_fold) {
+    auto* profiler = DriverSamplingProfiler::instance();
+    const std::string agg_name = "aggregate_blocking_sink";
+    const std::string scan_name = "olap_scan";
+
+    std::thread worker([&]() {
+        profiler->register_thread();
+        DriverSamplingProfiler::sample_current_thread();
+        profiler->unregister_thread();
+        // unregistered threads are not sampled
+        DriverSamplingProfiler::sample_current_thread();
+    });
+    worker.join();
+
+    // the samples of exited threads are dropped with their rings
+    ASSERT_TRUE(profiler->collect_samples(0).empty());
+
+    const int64_t since_ns = MonotonicNanos();
+    std::vector<DriverSamplingProfiler::Sample> samples;
+    std::thread sampled([&]() {
+        profiler->register_thread();
+        TUniqueId query_id;
+        query_id.__set_hi(1);
+        query_id.__set_lo(2);
+        CurrentThread::current().set_query_id(query_id);
+        CurrentThread::current().set_pipeline_driver_id(3);
+        CurrentThread::current().set_workgroup_id(10);
+        {
+            SCOPED_SET_SAMPLED_OPERATOR(&agg_name, 4);
+            for (int i = 0; i < 3; i++) {
+                DriverSamplingProfiler::sample_current_thread();
+            }
+        }
+        {
+            SCOPED_SET_SAMPLED_OPERATOR(&scan_name, 0);
+            DriverSamplingProfiler::sample_current_thread();
+        }
+        DriverSamplingProfiler::sample_current_thread();
+        samples = profiler->collect_samples(since_ns);
+        CurrentThread::current().set_query_id({});
+        CurrentThread::current().set_pipeline_driver_id(0);
+        CurrentThread::current().set_workgroup_id(-1);
+        profiler->unregister_thread();
+    });
+    sampled.join();
+    ASSERT_EQ(5, samples.size());
+
+    const std::string query = print_id(UniqueId(1, 2));
+    auto stacks = DriverSamplingProfiler::fold(samples, DriverSamplingProfiler::GroupBy::DRIVER, {{10, "wg;1"}});
+    std::map<std::string, int64_t> expected_stacks{
+            {"wg_1;" + query + ";driver_3;aggregate_blocking_sink_(4)", 3},
+            {"wg_1;" + query + ";driver_3;olap_scan_(0)", 1},
+            {"wg_1;" + query + ";driver_3;<scheduler>", 1},
+    };
+    ASSERT_EQ(expected_stacks, stacks);
+
+    stacks = DriverSamplingProfiler::fold(samples, DriverSamplingProfiler::GroupBy::WORKGROUP, {});
+    expected_stacks = {
+            {"10;aggregate_blocking_sink_(4)", 3},
+            {"10;olap_scan_(0)", 1},
+            {"10;<scheduler>", 1},
+    };
+    ASSERT_EQ(expected_stacks, stacks);
+}
+
+} // namespace starrocks::pipeline
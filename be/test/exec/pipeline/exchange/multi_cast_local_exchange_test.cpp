@@ -0,0 +1,184 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/multi_cast_local_exchange.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/spill/dir_manager.h"
+#include "exec/spill/log_block_manager.h"
+#include "fs/fs.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/uid_util.h"
+
+namespace starrocks::pipeline {
+
+class MultiCastLocalExchangeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TUniqueId query_id = generate_uuid();
+        auto path = config::storage_root_path + "/multi_cast_local_exchange_test/" + print_id(query_id);
+        ASSERT_OK(FileSystem::Default()->create_dir_recursive(path));
+        _dir_mgr = std::make_unique<spill::DirManager>();
+        ASSERT_OK(_dir_mgr->init(path));
+        _block_mgr = std::make_unique<spill::LogBlockManager>(query_id, _dir_mgr.get());
+        ASSERT_OK(_block_mgr->open());
+        _state.set_chunk_size(kChunkSize);
+    }
+
+    // The exchanger as if spill were enabled for the query, spilling once more than |spill_chunks| chunks are
+    // buffered.
+    std::shared_ptr<MultiCastLocalExchanger> create_exchanger(size_t spill_chunks) {
+        auto exchanger = std::make_shared<MultiCastLocalExchanger>(&_state, kNumConsumers);
+        exchanger->_block_manager = _block_mgr.get();
+        exchanger->_spill_threshold = spill_chunks * create_chunk(0)->memory_usage();
+        return exchanger;
+    }
+
+    static std::unique_ptr<MultiCastLocalExchangeSinkOperator> create_sink(
+            const std::shared_ptr<MultiCastLocalExchanger>& exchanger) {
+        auto sink = std::make_unique<MultiCastLocalExchangeSinkOperator>(nullptr, 1, kPlanNodeId, 0, exchanger);
+        auto* metrics = sink->_unique_metrics.get();
+        sink->_peak_memory_usage_counter = metrics->AddHighWaterMarkCounter(
+                "ExchangerPeakMemoryUsage", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
+        sink->_peak_buffer_row_size_counter = metrics->AddHighWaterMarkCounter(
+                "ExchangerPeakBufferRowSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
+        sink->_spilled_bytes_counter = ADD_COUNTER(metrics, "ExchangerSpilledBytes", TUnit::BYTES);
+        exchanger->open_sink_operator();
+        return sink;
+    }
+
+    // The |index|-th chunk holds the rows index * kChunkSize, ..., (index + 1) * kChunkSize - 1.
+    static ChunkPtr create_chunk(int32_t index) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < kChunkSize; i++) {
+            column->append(index * kChunkSize + i);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), kSlotId);
+        return chunk;
+    }
+
+    static void pull_chunks(MultiCastLocalExchanger* exchanger, int32_t consumer, int32_t num_chunks,
+                            std::vector<int32_t>* values) {
+        for (int32_t i = 0; i < num_chunks; i++) {
+            ASSERT_TRUE(exchanger->can_pull_chunk(consumer));
+            ASSIGN_OR_ABORT(auto chunk, exchanger->pull_chunk(nullptr, consumer));
+            auto column = chunk->get_column_by_slot_id(kSlotId);
+            for (size_t row = 0; row < chunk->num_rows(); row++) {
+                values->push_back(column->get(row).get_int32());
+            }
+        }
+    }
+
+    static std::vector<int32_t> expected_values(int32_t num_chunks) {
+        std::vector<int32_t> values(num_chunks * kChunkSize);
+        std::iota(values.begin(), values.end(), 0);
+        return values;
+    }
+
+    static constexpr int32_t kChunkSize = 128;
+    static constexpr size_t kNumConsumers = 3;
+    static constexpr int32_t kPlanNodeId = 1;
+    static constexpr SlotId kSlotId = 1;
+
+    std::unique_ptr<spill::DirManager> _dir_mgr;
+    std::unique_ptr<spill::LogBlockManager> _block_mgr;
+    RuntimeState _state;
+};
+
+TEST_F(MultiCastLocalExchangeTest, spill_is_disabled_by_default) {
+    ASSERT_EQ(0, config::multi_cast_local_exchange_spill_bytes);
+    TQueryOptions query_options;
+    query_options.__set_enable_spill(true);
+    RuntimeState state(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    MultiCastLocalExchanger exchanger(&state, kNumConsumers);
+    ASSERT_EQ(nullptr, exchanger._block_manager);
+}
+
+TEST_F(MultiCastLocalExchangeTest, lagging_consumers_restore_spilled_chunks_in_order) {
+    const int32_t num_chunks = 32;
+    auto exchanger = create_exchanger(4);
+    for (int32_t i = 0; i < kNumConsumers; i++) {
+        exchanger->open_source_operator(i);
+    }
+    auto sink = create_sink(exchanger);
+
+    // The consumer 0 keeps up with the sink, the consumer 1 reads a quarter of the chunks in the middle and the
+    // consumer 2 reads none until the sink finishes.
+    std::vector<std::vector<int32_t>> values(kNumConsumers);
+    for (int32_t i = 0; i < num_chunks; i++) {
+        ASSERT_OK(exchanger->push_chunk(create_chunk(i), 0, sink.get()));
+        pull_chunks(exchanger.get(), 0, 1, &values[0]);
+        if (i == num_chunks / 2) {
+            pull_chunks(exchanger.get(), 1, num_chunks / 4, &values[1]);
+        }
+        ASSERT_LE(exchanger->_current_memory_usage, exchanger->_spill_threshold);
+    }
+    exchanger->close_sink_operator();
+
+    const int64_t spilled_chunks = exchanger->_spilled_chunks_counter->value();
+    ASSERT_GT(spilled_chunks, num_chunks / 2);
+    ASSERT_GT(sink->_spilled_bytes_counter->value(), 0);
+
+    pull_chunks(exchanger.get(), 1, num_chunks - num_chunks / 4, &values[1]);
+    pull_chunks(exchanger.get(), 2, num_chunks, &values[2]);
+    for (int32_t i = 0; i < kNumConsumers; i++) {
+        ASSERT_EQ(expected_values(num_chunks), values[i]) << "consumer " << i;
+        ASSERT_TRUE(exchanger->pull_chunk(nullptr, i).status().is_end_of_file());
+    }
+    // Each spilled chunk is written once, and read back by every consumer that had not read it yet.
+    ASSERT_GE(exchanger->_restored_chunks_counter->value(), spilled_chunks);
+    ASSERT_LE(exchanger->_restored_chunks_counter->value(), 2 * spilled_chunks);
+    // Only the last chunk, which every consumer has read, is kept.
+    ASSERT_EQ(exchanger->_head, exchanger->_tail);
+    ASSERT_EQ(exchanger->_tail->memory_usage, exchanger->_current_memory_usage);
+}
+
+TEST_F(MultiCastLocalExchangeTest, closed_consumer_releases_spilled_chunks) {
+    const int32_t num_chunks = 16;
+    auto exchanger = create_exchanger(2);
+    for (int32_t i = 0; i < kNumConsumers; i++) {
+        exchanger->open_source_operator(i);
+    }
+    auto sink = create_sink(exchanger);
+
+    std::vector<std::vector<int32_t>> values(kNumConsumers);
+    for (int32_t i = 0; i < num_chunks; i++) {
+        ASSERT_OK(exchanger->push_chunk(create_chunk(i), 0, sink.get()));
+        pull_chunks(exchanger.get(), 0, 1, &values[0]);
+    }
+    exchanger->close_sink_operator();
+    ASSERT_GT(exchanger->_spilled_chunks_counter->value(), 0);
+
+    // The consumer 1 finishes early, e.g. because of a limit, the consumer 2 still reads all the chunks.
+    pull_chunks(exchanger.get(), 1, 3, &values[1]);
+    exchanger->close_source_operator(1);
+    pull_chunks(exchanger.get(), 2, num_chunks, &values[2]);
+    ASSERT_EQ(expected_values(num_chunks), values[0]);
+    ASSERT_EQ(expected_values(3), values[1]);
+    ASSERT_EQ(expected_values(num_chunks), values[2]);
+
+    // Only the last chunk is kept once the remaining consumers have read everything.
+    ASSERT_EQ(exchanger->_head, exchanger->_tail);
+    ASSERT_EQ(exchanger->_tail->memory_usage, exchanger->_current_memory_usage);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,152 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/sink_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "exec/pipeline/exchange/zero_copy_attachments.h"
+#include "util/defer_op.h"
+
+namespace starrocks::pipeline {
+
+class SinkBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _fragment_ctx = std::make_shared<FragmentContext>();
+        _fragment_ctx->set_runtime_state(std::make_shared<RuntimeState>());
+        _fragment_ctx->runtime_state()->init_instance_mem_tracker();
+    }
+
+    static TUniqueId instance_id(int64_t lo) {
+        TUniqueId id;
+        id.__set_hi(1);
+        id.__set_lo(lo);
+        return id;
+    }
+
+    static TPlanFragmentDestination destination(int64_t lo, const std::string& host) {
+        TPlanFragmentDestination dest;
+        dest.__set_fragment_instance_id(instance_id(lo));
+        TNetworkAddress brpc_server;
+        brpc_server.__set_hostname(host);
+        brpc_server.__set_port(8060);
+        dest.__set_brpc_server(brpc_server);
+        return dest;
+    }
+
+    // A request of the instance whose attachment is num_bytes copies of the digit of the instance.
+    static TransmitChunkInfo create_request(SinkBuffer& buffer, int64_t lo, size_t num_bytes, bool eos = false) {
+        auto params = std::make_shared<PTransmitChunkParams>();
+        params->set_eos(eos);
+        butil::IOBuf attachment;
+        attachment.append(std::string(num_bytes, static_cast<char>('0' + lo)));
+        return {instance_id(lo), nullptr, std::move(params), std::move(attachment), 0, buffer._dest_addrs[lo]};
+    }
+
+    std::shared_ptr<FragmentContext> _fragment_ctx;
+};
+
+TEST_F(SinkBufferTest, coalesce_requests_of_same_host) {
+    bool old_enable_coalescing = config::pipeline_sink_enable_rpc_coalescing;
+    config::pipeline_sink_enable_rpc_coalescing = true;
+    DeferOp defer([&]() { config::pipeline_sink_enable_rpc_coalescing = old_enable_coalescing; });
+
+    std::vector<TPlanFragmentDestination> destinations = {destination(1, "host1"), destination(2, "host1"),
+                                                          destination(3, "host1"), destination(4, "host2"),
+                                                          destination(5, "host1"), destination(6, "host1")};
+    SinkBuffer buffer(_fragment_ctx.get(), destinations, false);
+    for (int64_t lo = 2; lo <= 6; lo++) {
+        // The eos is left to the instance itself.
+        buffer._buffers[lo].push(create_request(buffer, lo, 10, lo == 3));
+    }
+    // The instance waits for the acks of too many rpcs.
+    buffer._num_finished_rpcs[5] = 1;
+    buffer._num_in_flight_rpcs[5] = config::pipeline_sink_brpc_dop;
+    // The first packet of the instance is not acked yet.
+    buffer._num_in_flight_rpcs[6] = 1;
+
+    TransmitChunkInfo request = create_request(buffer, 1, 10);
+    std::vector<CoalescedRequestContext> coalesced_requests;
+    buffer._coalesce_requests(instance_id(1), request, &coalesced_requests);
+
+    // Only the request of instance 2 is packed, and stamped with its own sequence and finst id.
+    ASSERT_EQ(1, coalesced_requests.size());
+    ASSERT_EQ(instance_id(2), coalesced_requests[0].instance_id);
+    ASSERT_EQ(0, coalesced_requests[0].sequence);
+    ASSERT_EQ(10, coalesced_requests[0].attachment_bytes);
+    ASSERT_EQ(1, request.params->coalesced_requests_size());
+    const auto& coalesced_params = request.params->coalesced_requests(0);
+    ASSERT_EQ(2, coalesced_params.finst_id().lo());
+    ASSERT_EQ(0, coalesced_params.sequence());
+    ASSERT_EQ(std::string(10, '1') + std::string(10, '2'), request.attachment.to_string());
+
+    ASSERT_TRUE(buffer._buffers[2].empty());
+    ASSERT_EQ(0, buffer._request_seqs[2]);
+    ASSERT_EQ(1, buffer._num_in_flight_rpcs[2]);
+    for (int64_t lo = 3; lo <= 6; lo++) {
+        ASSERT_EQ(1, buffer._buffers[lo].size());
+        ASSERT_EQ(-1, buffer._request_seqs[lo]);
+    }
+}
+
+TEST_F(SinkBufferTest, coalesce_requests_up_to_max_bytes) {
+    bool old_enable_coalescing = config::pipeline_sink_enable_rpc_coalescing;
+    int64_t old_max_bytes = config::pipeline_sink_coalesce_rpc_max_bytes;
+    config::pipeline_sink_enable_rpc_coalescing = true;
+    config::pipeline_sink_coalesce_rpc_max_bytes = 25;
+    DeferOp defer([&]() {
+        config::pipeline_sink_enable_rpc_coalescing = old_enable_coalescing;
+        config::pipeline_sink_coalesce_rpc_max_bytes = old_max_bytes;
+    });
+
+    std::vector<TPlanFragmentDestination> destinations = {destination(1, "host1"), destination(2, "host1"),
+                                                          destination(3, "host1"), destination(4, "host1")};
+    SinkBuffer buffer(_fragment_ctx.get(), destinations, false);
+    for (int64_t lo = 2; lo <= 4; lo++) {
+        buffer._buffers[lo].push(create_request(buffer, lo, 10));
+    }
+
+    TransmitChunkInfo request = create_request(buffer, 1, 10);
+    std::vector<CoalescedRequestContext> coalesced_requests;
+    buffer._coalesce_requests(instance_id(1), request, &coalesced_requests);
+
+    ASSERT_EQ(1, coalesced_requests.size());
+    ASSERT_EQ(20, request.attachment.size());
+    size_t num_pending_requests = 0;
+    for (int64_t lo = 2; lo <= 4; lo++) {
+        num_pending_requests += buffer._buffers[lo].size();
+    }
+    ASSERT_EQ(2, num_pending_requests);
+}
+
+TEST_F(SinkBufferTest, drop_zero_copy_attachments_of_cancelled_requests) {
+    size_t num_attachments = ZeroCopyAttachments::instance()->num_attachments();
+    {
+        std::vector<TPlanFragmentDestination> destinations = {destination(1, "host1"), destination(2, "host1")};
+        SinkBuffer buffer(_fragment_ctx.get(), destinations, false);
+        for (int64_t lo = 1; lo <= 2; lo++) {
+            TransmitChunkInfo request = create_request(buffer, lo, 0);
+            std::string data(64 * 1024, static_cast<char>('0' + lo));
+            ZeroCopyAttachments::instance()->attach(&data, &request.attachment);
+            buffer._buffers[lo].push(request);
+        }
+        ASSERT_EQ(num_attachments + 2, ZeroCopyAttachments::instance()->num_attachments());
+        // The query is cancelled before the requests are sent.
+    }
+    ASSERT_EQ(num_attachments, ZeroCopyAttachments::instance()->num_attachments());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,95 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/zero_copy_attachments.h"
+
+#include <gtest/gtest.h>
+
+#include "gen_cpp/internal_service.pb.h"
+#include "util/disposable_closure.h"
+
+namespace starrocks::pipeline {
+
+class ZeroCopyAttachmentsTest : public ::testing::Test {
+protected:
+    void SetUp() override { _num_attachments = ZeroCopyAttachments::instance()->num_attachments(); }
+
+    size_t num_new_attachments() const {
+        return ZeroCopyAttachments::instance()->num_attachments() - _num_attachments;
+    }
+
+    // Attaches the data like ExchangeSinkOperator::construct_brpc_attachment() and sends the attachment like
+    // SinkBuffer::_send_rpc(), then runs the closure as brpc does once the rpc completes.
+    void send_and_complete(bool failed) {
+        std::string data(kDataSize, 'x');
+        butil::IOBuf attachment;
+        ZeroCopyAttachments::instance()->attach(&data, &attachment);
+        ASSERT_EQ(1, num_new_attachments());
+
+        bool succeeded = false;
+        bool failed_handled = false;
+        auto* closure = new DisposableClosure<PTransmitChunkResult, int>(0);
+        closure->addSuccessHandler([&](const int&, const PTransmitChunkResult&) { succeeded = true; });
+        closure->addFailedHandler([&](const int&, std::string_view) { failed_handled = true; });
+        closure->cntl.request_attachment().append(attachment);
+        attachment.clear();
+        // The request in flight keeps the data.
+        ASSERT_EQ(1, num_new_attachments());
+
+        if (failed) {
+            closure->cntl.SetFailed("connection refused");
+        }
+        closure->Run();
+        ASSERT_EQ(!failed, succeeded);
+        ASSERT_EQ(failed, failed_handled);
+        ASSERT_EQ(0, num_new_attachments());
+    }
+
+    static constexpr size_t kDataSize = 64 * 1024;
+
+    size_t _num_attachments = 0;
+};
+
+TEST_F(ZeroCopyAttachmentsTest, attach_without_copy) {
+    std::string data(kDataSize, 'x');
+    const char* ptr = data.data();
+    {
+        butil::IOBuf attachment;
+        int64_t bytes = ZeroCopyAttachments::instance()->attach(&data, &attachment);
+        ASSERT_GE(bytes, kDataSize);
+        ASSERT_TRUE(data.empty());
+        ASSERT_EQ(1, num_new_attachments());
+        ASSERT_EQ(1, attachment.backing_block_num());
+        ASSERT_EQ(ptr, attachment.backing_block(0).data());
+        ASSERT_EQ(std::string(kDataSize, 'x'), attachment.to_string());
+
+        // A broadcast shares the block among the requests, it is released with the last of them.
+        butil::IOBuf broadcast_attachment;
+        broadcast_attachment.append(attachment);
+        attachment.clear();
+        ASSERT_EQ(1, num_new_attachments());
+        ASSERT_EQ(ptr, broadcast_attachment.backing_block(0).data());
+    }
+    ASSERT_EQ(0, num_new_attachments());
+}
+
+TEST_F(ZeroCopyAttachmentsTest, released_after_rpc_succeeds) {
+    send_and_complete(false);
+}
+
+TEST_F(ZeroCopyAttachmentsTest, released_after_rpc_fails) {
+    send_and_complete(true);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,81 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/heavy_hitter_sketch.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::pipeline {
+
+TEST(HeavyHitterSketchTest, test_find_hot_keys) {
+    HeavyHitterSketch sketch(8);
+    // 1 takes 40%, 2 takes 20%, the rest are distinct
+    for (uint32_t i = 0; i < 10000; ++i) {
+        if (i % 5 < 2) {
+            sketch.update(1);
+        } else if (i % 5 == 2) {
+            sketch.update(2);
+        } else {
+            sketch.update(100 + i);
+        }
+    }
+    ASSERT_EQ(10000, sketch.num_observed());
+
+    auto hot_keys = sketch.heavy_hitters(0.1);
+    ASSERT_EQ(2, hot_keys.size());
+    ASSERT_EQ(1, hot_keys[0].first);
+    ASSERT_EQ(2, hot_keys[1].first);
+    // under-estimated by at most num_observed / (capacity + 1)
+    ASSERT_LE(hot_keys[0].second, 4000);
+    ASSERT_GE(hot_keys[0].second, 4000 - 10000 / 9);
+}
+
+TEST(HeavyHitterSketchTest, test_uniform_has_no_hot_keys) {
+    HeavyHitterSketch sketch(8);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        sketch.update(i % 64);
+    }
+    ASSERT_TRUE(sketch.heavy_hitters(1.0 / 8).empty());
+}
+
+TEST(HeavyHitterSketchTest, test_hot_key_after_distinct_keys) {
+    HeavyHitterSketch sketch(4);
+    // The distinct keys fill and evict the counters again and again before the hot key shows up.
+    for (uint32_t i = 0; i < 6000; ++i) {
+        sketch.update(1000 + i);
+    }
+    for (uint32_t i = 0; i < 4000; ++i) {
+        sketch.update(1);
+    }
+    // 1 takes 40% > 1 / (capacity + 1), so it must be kept.
+    auto hot_keys = sketch.heavy_hitters(0.2);
+    ASSERT_EQ(1, hot_keys.size());
+    ASSERT_EQ(1, hot_keys[0].first);
+    ASSERT_GE(hot_keys[0].second, 4000 - 10000 / 5);
+}
+
+TEST(HeavyHitterSketchTest, test_single_counter) {
+    // The capacity is at least one counter, which keeps the key of more than half of the values.
+    HeavyHitterSketch sketch(0);
+    for (uint32_t i = 0; i < 100; ++i) {
+        sketch.update(i % 3 == 2 ? 1000 + i : 7);
+    }
+    ASSERT_EQ(100, sketch.num_observed());
+    auto hot_keys = sketch.heavy_hitters(0.3);
+    ASSERT_EQ(1, hot_keys.size());
+    ASSERT_EQ(7, hot_keys[0].first);
+    ASSERT_EQ(34, hot_keys[0].second);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,358 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/object_pool.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+using Values = std::vector<std::optional<int32_t>>;
+
+// A join conjunct between the column |build_col| of the build side and the column |probe_col| of the probe side,
+// `build op probe` if |build_on_left|, otherwise `probe op build`.
+struct Condition {
+    int build_col;
+    TExprOpcode::type op;
+    int probe_col;
+    bool build_on_left = true;
+};
+
+class NLJoinRangeIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        TQueryGlobals query_globals;
+        _state = std::make_shared<RuntimeState>(TUniqueId(), query_options, query_globals, nullptr);
+        _state->init_instance_mem_tracker();
+
+        // The probe side has 2 columns, and the build side has 2 columns and a row id.
+        TDescriptorTableBuilder desc_builder;
+        for (int num_slots : {2, 3}) {
+            TTupleDescriptorBuilder tuple_builder;
+            for (int i = 0; i < num_slots; i++) {
+                tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                               .type(TYPE_INT)
+                                               .column_name("c" + std::to_string(i))
+                                               .column_pos(i)
+                                               .nullable(true)
+                                               .build());
+            }
+            tuple_builder.build(&desc_builder);
+        }
+        DescriptorTbl* tbl = nullptr;
+        ASSERT_OK(DescriptorTbl::create(_state.get(), &_pool, desc_builder.desc_tbl(), &tbl,
+                                        config::vector_chunk_size));
+        _probe_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{false});
+        _build_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{1}, std::vector<bool>{false});
+        for (const auto* slot : _probe_row_desc->tuple_descriptors()[0]->slots()) {
+            _probe_slots.push_back(slot->id());
+        }
+        for (const auto* slot : _build_row_desc->tuple_descriptors()[0]->slots()) {
+            _build_slots.push_back(slot->id());
+        }
+    }
+
+    void TearDown() override {
+        for (auto* ctx : _expr_ctxs) {
+            ctx->close(_state.get());
+        }
+    }
+
+    static TExprNode slot_ref_node(SlotId slot_id, TupleId tuple_id) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.__set_num_children(0);
+        node.__set_type(TypeDescriptor(TYPE_INT).to_thrift());
+        TSlotRef slot_ref;
+        slot_ref.__set_slot_id(slot_id);
+        slot_ref.__set_tuple_id(tuple_id);
+        node.__set_slot_ref(slot_ref);
+        return node;
+    }
+
+    ExprContext* create_predicate(TExprOpcode::type op, const TExprNode& left, const TExprNode& right) {
+        TExprNode pred;
+        pred.__set_node_type(TExprNodeType::BINARY_PRED);
+        pred.__set_child_type(TPrimitiveType::INT);
+        pred.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+        pred.__set_opcode(op);
+        pred.__set_num_children(2);
+        TExpr texpr;
+        texpr.__set_nodes({pred, left, right});
+        ExprContext* ctx = nullptr;
+        CHECK(Expr::create_expr_tree(&_pool, texpr, &ctx, _state.get()).ok());
+        CHECK(ctx->prepare(_state.get()).ok());
+        CHECK(ctx->open(_state.get()).ok());
+        _expr_ctxs.push_back(ctx);
+        return ctx;
+    }
+
+    ExprContext* create_conjunct(const Condition& cond) {
+        TExprNode build = slot_ref_node(_build_slots[cond.build_col], 1);
+        TExprNode probe = slot_ref_node(_probe_slots[cond.probe_col], 0);
+        return cond.build_on_left ? create_predicate(cond.op, build, probe) : create_predicate(cond.op, probe, build);
+    }
+
+    std::vector<ExprContext*> create_conjuncts(const std::vector<Condition>& conds) {
+        std::vector<ExprContext*> conjuncts;
+        for (const auto& cond : conds) {
+            conjuncts.push_back(create_conjunct(cond));
+        }
+        return conjuncts;
+    }
+
+    static ColumnPtr create_column(const Values& values, bool nullable) {
+        auto column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), nullable);
+        for (const auto& value : values) {
+            if (value.has_value()) {
+                column->append_datum(Datum(value.value()));
+            } else {
+                column->append_nulls(1);
+            }
+        }
+        return column;
+    }
+
+    static ChunkPtr create_chunk(const std::vector<SlotId>& slots, const std::vector<Values>& columns, bool nullable) {
+        auto chunk = std::make_shared<Chunk>();
+        for (size_t i = 0; i < slots.size(); i++) {
+            chunk->append_column(create_column(columns[i], nullable), slots[i]);
+        }
+        return chunk;
+    }
+
+    static bool compare(int32_t left, TExprOpcode::type op, int32_t right) {
+        switch (op) {
+        case TExprOpcode::LT:
+            return left < right;
+        case TExprOpcode::LE:
+            return left <= right;
+        case TExprOpcode::GT:
+            return left > right;
+        case TExprOpcode::GE:
+            return left >= right;
+        default:
+            return left == right;
+        }
+    }
+
+    static bool match(const std::vector<Condition>& conds, const std::vector<std::optional<int32_t>>& build_row,
+                      const std::vector<std::optional<int32_t>>& probe_row) {
+        for (const auto& cond : conds) {
+            const auto& build = build_row[cond.build_col];
+            const auto& probe = probe_row[cond.probe_col];
+            if (!build.has_value() || !probe.has_value()) {
+                return false;
+            }
+            if (!(cond.build_on_left ? compare(*build, cond.op, *probe) : compare(*probe, cond.op, *build))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static Values random_values(std::mt19937& rng, size_t num_rows, bool with_null) {
+        std::uniform_int_distribution<int32_t> dist(0, 99);
+        Values values;
+        for (size_t i = 0; i < num_rows; i++) {
+            if (with_null && dist(rng) < 10) {
+                values.emplace_back(std::nullopt);
+            } else {
+                values.emplace_back(dist(rng));
+            }
+        }
+        return values;
+    }
+
+    // Join random rows with the range index and with the cross product, both evaluating all of |conds|,
+    // the matched build rows of every probe row must be the same.
+    void check_against_cross_join(const std::vector<Condition>& conds) {
+        auto plan = NLJoinRangePlan::create(create_conjuncts(conds), *_probe_row_desc, *_build_row_desc);
+        ASSERT_NE(nullptr, plan);
+
+        std::mt19937 rng(conds.size() * 31 + conds[0].op);
+        // Build rows spread over several chunks, the first one is not nullable.
+        std::vector<std::vector<std::optional<int32_t>>> build_rows;
+        std::vector<ChunkPtr> build_chunks;
+        for (int c = 0; c < 3; c++) {
+            const bool nullable = c > 0;
+            const size_t num_rows = 100;
+            std::vector<Values> columns = {random_values(rng, num_rows, nullable),
+                                           random_values(rng, num_rows, nullable), Values()};
+            for (size_t i = 0; i < num_rows; i++) {
+                columns[2].emplace_back(static_cast<int32_t>(build_rows.size()));
+                build_rows.push_back({columns[0][i], columns[1][i]});
+            }
+            build_chunks.push_back(create_chunk(_build_slots, columns, nullable));
+        }
+        ASSIGN_OR_ABORT(auto index, NLJoinRangeIndex::build(*plan, build_chunks));
+
+        const size_t num_probe_rows = 200;
+        std::vector<Values> probe_columns = {random_values(rng, num_probe_rows, true),
+                                             random_values(rng, num_probe_rows, true)};
+        auto probe_chunk = create_chunk(_probe_slots, probe_columns, true);
+        ASSIGN_OR_ABORT(auto bounds, index->evaluate_probe(probe_chunk.get()));
+
+        const auto& sorted = index->sorted_chunk();
+        std::vector<ColumnPtr> sorted_columns;
+        for (SlotId slot : _build_slots) {
+            sorted_columns.push_back(sorted->get_column_by_slot_id(slot));
+        }
+        auto value_at = [](const ColumnPtr& column, size_t row) -> std::optional<int32_t> {
+            if (column->is_null(row)) {
+                return std::nullopt;
+            }
+            return column->get(row).get_int32();
+        };
+
+        size_t num_candidates = 0;
+        for (size_t row = 0; row < num_probe_rows; row++) {
+            std::vector<std::optional<int32_t>> probe_row = {probe_columns[0][row], probe_columns[1][row]};
+            std::vector<int32_t> expected;
+            for (size_t i = 0; i < build_rows.size(); i++) {
+                if (match(conds, build_rows[i], probe_row)) {
+                    expected.push_back(static_cast<int32_t>(i));
+                }
+            }
+
+            size_t begin = 0;
+            size_t end = 0;
+            index->find(bounds, row, &begin, &end);
+            std::vector<int32_t> actual;
+            for (size_t i = begin; i < end; i++) {
+                std::vector<std::optional<int32_t>> build_row = {value_at(sorted_columns[0], i),
+                                                                 value_at(sorted_columns[1], i)};
+                if (match(conds, build_row, probe_row)) {
+                    actual.push_back(*value_at(sorted_columns[2], i));
+                }
+            }
+            num_candidates += end - begin;
+            std::sort(actual.begin(), actual.end());
+            ASSERT_EQ(expected, actual) << "probe row " << row << ", plan " << plan->debug_string();
+        }
+        // The index narrows the candidates compared to the cross product.
+        ASSERT_LT(num_candidates, num_probe_rows * build_rows.size());
+    }
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _state;
+    std::unique_ptr<RowDescriptor> _probe_row_desc;
+    std::unique_ptr<RowDescriptor> _build_row_desc;
+    std::vector<SlotId> _probe_slots;
+    std::vector<SlotId> _build_slots;
+    std::vector<ExprContext*> _expr_ctxs;
+};
+
+TEST_F(NLJoinRangeIndexTest, plan_bounds) {
+    // build.c0 <= probe.c0 AND probe.c0 <= build.c1
+    auto plan = NLJoinRangePlan::create(
+            create_conjuncts({{0, TExprOpcode::LE, 0}, {1, TExprOpcode::LE, 0, false}}), *_probe_row_desc,
+            *_build_row_desc);
+    ASSERT_NE(nullptr, plan);
+    ASSERT_TRUE(plan->upper.has_value());
+    ASSERT_TRUE(plan->lower.has_value());
+    ASSERT_EQ(plan->upper->build_expr, plan->upper->conjunct->root()->get_child(0));
+    ASSERT_EQ(plan->lower->build_expr, plan->lower->conjunct->root()->get_child(1));
+    ASSERT_FALSE(plan->sort_by_lower);
+
+    // probe.c0 < build.c0, only a lower bound
+    plan = NLJoinRangePlan::create(create_conjuncts({{0, TExprOpcode::LT, 0, false}}), *_probe_row_desc,
+                                   *_build_row_desc);
+    ASSERT_NE(nullptr, plan);
+    ASSERT_TRUE(plan->lower.has_value());
+    ASSERT_FALSE(plan->upper.has_value());
+    ASSERT_TRUE(plan->sort_by_lower);
+
+    // The first conjunct of each bound is indexed.
+    auto conjuncts = create_conjuncts({{0, TExprOpcode::GT, 0}, {1, TExprOpcode::GE, 1}});
+    plan = NLJoinRangePlan::create(conjuncts, *_probe_row_desc, *_build_row_desc);
+    ASSERT_NE(nullptr, plan);
+    ASSERT_EQ(conjuncts[0], plan->lower->conjunct);
+    ASSERT_FALSE(plan->upper.has_value());
+}
+
+TEST_F(NLJoinRangeIndexTest, plan_no_range_condition) {
+    // equality
+    ASSERT_EQ(nullptr, NLJoinRangePlan::create(create_conjuncts({{0, TExprOpcode::EQ, 0}}), *_probe_row_desc,
+                                               *_build_row_desc));
+    // both sides reference the build side
+    std::vector<ExprContext*> conjuncts = {
+            create_predicate(TExprOpcode::LT, slot_ref_node(_build_slots[0], 1), slot_ref_node(_build_slots[1], 1))};
+    ASSERT_EQ(nullptr, NLJoinRangePlan::create(conjuncts, *_probe_row_desc, *_build_row_desc));
+    // both sides reference the probe side
+    conjuncts = {
+            create_predicate(TExprOpcode::LT, slot_ref_node(_probe_slots[0], 0), slot_ref_node(_probe_slots[1], 0))};
+    ASSERT_EQ(nullptr, NLJoinRangePlan::create(conjuncts, *_probe_row_desc, *_build_row_desc));
+    // no conjunct
+    ASSERT_EQ(nullptr, NLJoinRangePlan::create({}, *_probe_row_desc, *_build_row_desc));
+}
+
+TEST_F(NLJoinRangeIndexTest, find_upper_bound) {
+    auto plan = NLJoinRangePlan::create(create_conjuncts({{0, TExprOpcode::LE, 0}}), *_probe_row_desc,
+                                        *_build_row_desc);
+    ASSERT_NE(nullptr, plan);
+    auto build_chunk = create_chunk(_build_slots, {{30, std::nullopt, 10, 20, 20}, {0, 0, 0, 0, 0}, {0, 1, 2, 3, 4}},
+                                    true);
+    ASSIGN_OR_ABORT(auto index, NLJoinRangeIndex::build(*plan, {build_chunk}));
+    // the build row with a null bound is dropped
+    ASSERT_EQ("[10, 20, 20, 30]", index->sorted_chunk()->get_column_by_slot_id(_build_slots[0])->debug_string());
+
+    auto probe_chunk = create_chunk(_probe_slots, {{5, 10, 20, 25, 40, std::nullopt}, {0, 0, 0, 0, 0, 0}}, true);
+    ASSIGN_OR_ABORT(auto bounds, index->evaluate_probe(probe_chunk.get()));
+    std::vector<size_t> expected_ends = {0, 1, 3, 3, 4, 0};
+    for (size_t row = 0; row < expected_ends.size(); row++) {
+        size_t begin = 0;
+        size_t end = 0;
+        index->find(bounds, row, &begin, &end);
+        ASSERT_EQ(0, begin);
+        ASSERT_EQ(expected_ends[row], end) << row;
+    }
+}
+
+TEST_F(NLJoinRangeIndexTest, point_in_intervals) {
+    // build.c0 <= probe.c0 AND build.c1 >= probe.c0
+    check_against_cross_join({{0, TExprOpcode::LE, 0}, {1, TExprOpcode::GE, 0}});
+    // probe.c0 > build.c0 AND probe.c0 < build.c1
+    check_against_cross_join({{0, TExprOpcode::GT, 0, false}, {1, TExprOpcode::LT, 0, false}});
+}
+
+TEST_F(NLJoinRangeIndexTest, interval_contains_points) {
+    // build.c0 >= probe.c0 AND build.c0 <= probe.c1
+    check_against_cross_join({{0, TExprOpcode::GE, 0}, {0, TExprOpcode::LE, 1}});
+    // build.c0 > probe.c0 AND build.c0 < probe.c1 AND build.c1 >= probe.c0
+    check_against_cross_join({{0, TExprOpcode::GT, 0}, {0, TExprOpcode::LT, 1}, {1, TExprOpcode::GE, 0}});
+}
+
+TEST_F(NLJoinRangeIndexTest, one_sided) {
+    check_against_cross_join({{0, TExprOpcode::LT, 0}});
+    check_against_cross_join({{1, TExprOpcode::GE, 1}});
+}
+
+} // namespace starrocks::pipeline
@@ -305,4 +305,156 @@ TEST_F(WorkGroupDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+TEST_F(WorkGroupDriverQueueTest, test_short_query_preemption) {
+    auto sq_wg = std::make_shared<workgroup::WorkGroup>("wg500", 500, workgroup::WorkGroup::DEFAULT_VERSION, 1, 0.5,
+                                                        10, 1.0, workgroup::WorkGroupType::WG_SHORT_QUERY);
+    sq_wg->init();
+
+    QueryContext query_ctx;
+    WorkGroupDriverQueue queue;
+
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    _set_driver_level(driver1.get(), 1);
+    driver1->set_workgroup(_wg1);
+
+    // The short-query workgroup is taken first, even though its vruntime is much larger.
+    auto sq_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    _set_driver_level(sq_driver.get(), 1);
+    sq_driver->driver_acct().update_last_time_spent(100'000'000'000L);
+    sq_driver->set_workgroup(sq_wg);
+
+    queue.update_statistics(driver1.get());
+    queue.put_back(driver1.get());
+    ASSERT_FALSE(queue.has_ready_sq_drivers());
+
+    queue.update_statistics(sq_driver.get());
+    queue.put_back(sq_driver.get());
+    ASSERT_TRUE(queue.has_ready_sq_drivers());
+    ASSERT_TRUE(queue.should_yield(driver1.get(), 0));
+    ASSERT_FALSE(queue.should_yield(sq_driver.get(), 0));
+
+    auto maybe_driver = queue.take(true);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(sq_driver.get(), maybe_driver.value());
+    ASSERT_FALSE(queue.has_ready_sq_drivers());
+
+    maybe_driver = queue.take(true);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver1.get(), maybe_driver.value());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_local_first) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2);
+
+    QueryContext query_context;
+    auto local_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(local_driver.get(), 1);
+    auto shared_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(shared_driver.get(), 1);
+
+    queue.put_back(shared_driver.get());
+    queue.put_back_from_executor(local_driver.get());
+    ASSERT_EQ(2, queue.size());
+
+    // The driver put back by the current thread is taken first.
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(local_driver.get(), maybe_driver.value());
+
+    maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(shared_driver.get(), maybe_driver.value());
+
+    maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(nullptr, maybe_driver.value());
+    ASSERT_TRUE(queue.empty());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_shared_not_starved) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 1);
+
+    QueryContext query_context;
+    auto local_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(local_driver.get(), 1);
+    auto shared_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(shared_driver.get(), 1);
+
+    queue.put_back(shared_driver.get());
+    for (uint32_t i = 0; i < WorkStealingDriverQueue::LOCAL_TAKE_BATCH_SIZE; ++i) {
+        queue.put_back_from_executor(local_driver.get());
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(local_driver.get(), maybe_driver.value());
+    }
+
+    // After a batch of local takes, the shared queue is checked first.
+    queue.put_back_from_executor(local_driver.get());
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(shared_driver.get(), maybe_driver.value());
+
+    maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(local_driver.get(), maybe_driver.value());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver1.get(), 1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver2.get(), 1);
+
+    queue.put_back_from_executor(driver1.get());
+    queue.put_back_from_executor(driver2.get());
+
+    // Another thread steals from the tail of the local deque of the current thread.
+    auto thief_thread = std::make_shared<std::thread>([&queue, &driver2] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver2.get(), maybe_driver.value());
+    });
+    thief_thread->join();
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver1.get(), maybe_driver.value());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_block) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver1.get(), 1);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+
+    sleep(1);
+    queue.put_back_from_executor(driver1.get());
+
+    consumer_thread->join();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_close) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+}
+
 } // namespace starrocks::pipeline
@@ -15,6 +15,7 @@
 #include <chrono>
 #include <random>
 
+#include "exec/join_hash_map.h"
 #include "exec/pipeline/query_context.h"
 #include "exec/workgroup/work_group.h"
 #include "gtest/gtest.h"
@@ -295,4 +296,25 @@ TEST(QueryContextManagerTest, testSetWorkgroup) {
     ASSERT_EQ(0, wg->num_running_queries());
 }
 
+TEST(QueryContextManagerTest, testBroadcastJoinBuild) {
+    QueryContext query_ctx;
+    ASSERT_EQ(nullptr, query_ctx.get_broadcast_join_build(1));
+
+    auto build = std::make_shared<JoinHashTableItems>();
+    query_ctx.publish_broadcast_join_build(1, build);
+    ASSERT_EQ(build, query_ctx.get_broadcast_join_build(1));
+    ASSERT_EQ(nullptr, query_ctx.get_broadcast_join_build(2));
+
+    // The build published first is kept while a fragment instance still probes it.
+    auto other_build = std::make_shared<JoinHashTableItems>();
+    query_ctx.publish_broadcast_join_build(1, other_build);
+    ASSERT_EQ(build, query_ctx.get_broadcast_join_build(1));
+
+    // The query context does not keep a build alive.
+    build.reset();
+    ASSERT_EQ(nullptr, query_ctx.get_broadcast_join_build(1));
+    query_ctx.publish_broadcast_join_build(1, other_build);
+    ASSERT_EQ(other_build, query_ctx.get_broadcast_join_build(1));
+}
+
 } // namespace starrocks::pipeline
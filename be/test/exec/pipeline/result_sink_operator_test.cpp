@@ -0,0 +1,181 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/result_sink_operator.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/pipeline/limit_operator.h"
+#include "exec/pipeline/pipeline.h"
+#include "exec/pipeline/pipeline_driver.h"
+#include "pipeline_test_base.h"
+#include "runtime/result_buffer_mgr.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+static constexpr SlotId kSlotId = 1;
+
+// Produces the rows 0, 1, ..., num_rows - 1 of a single INT column in chunks of chunk_size rows.
+class SequenceSourceOperator final : public SourceOperator {
+public:
+    SequenceSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                           int32_t num_rows, int32_t chunk_size)
+            : SourceOperator(factory, id, "sequence_source", plan_node_id, false, driver_sequence),
+              _num_rows(num_rows),
+              _chunk_size(chunk_size) {}
+
+    bool has_output() const override { return _next_row < _num_rows; }
+    bool is_finished() const override { return !has_output(); }
+
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override {
+        return Status::InternalError("Shouldn't push chunk to source operator");
+    }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        auto column = Int32Column::create();
+        int32_t end = std::min(_next_row + _chunk_size, _num_rows);
+        for (; _next_row < end; _next_row++) {
+            column->append(_next_row);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), kSlotId);
+        return chunk;
+    }
+
+private:
+    const int32_t _num_rows;
+    const int32_t _chunk_size;
+    int32_t _next_row = 0;
+};
+
+class SequenceSourceOperatorFactory final : public SourceOperatorFactory {
+public:
+    SequenceSourceOperatorFactory(int32_t id, int32_t plan_node_id, int32_t num_rows, int32_t chunk_size)
+            : SourceOperatorFactory(id, "sequence_source", plan_node_id),
+              _num_rows(num_rows),
+              _chunk_size(chunk_size) {}
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<SequenceSourceOperator>(this, _id, _plan_node_id, driver_sequence, _num_rows,
+                                                        _chunk_size);
+    }
+
+private:
+    const int32_t _num_rows;
+    const int32_t _chunk_size;
+};
+
+class ResultSinkOperatorTest : public PipelineTestBase {
+protected:
+    void _prepare_request() override {
+        _request.params.query_id.__set_hi(110);
+        _request.params.query_id.__set_lo(1);
+        _request.params.fragment_instance_id.__set_hi(110);
+        _request.params.fragment_instance_id.__set_lo(2);
+        _request.query_options.__set_pipeline_dop(kNumSinkers);
+    }
+
+    static TExpr slot_ref_expr() {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.__set_num_children(0);
+        node.__set_type(TypeDescriptor(TYPE_INT).to_thrift());
+        TSlotRef slot_ref;
+        slot_ref.__set_slot_id(kSlotId);
+        slot_ref.__set_tuple_id(0);
+        node.__set_slot_ref(slot_ref);
+        TExpr expr;
+        expr.__set_nodes({node});
+        return expr;
+    }
+
+    // A single driver produces the rows and applies the limit, like the exchange source of a result fragment,
+    // and passes the chunks through to kNumSinkers MySQL result sinks that share one BufferControlBlock.
+    void build_pipelines(int32_t num_rows, int32_t chunk_size, int64_t limit) {
+        _pipeline_builder = [this, num_rows, chunk_size, limit](RuntimeState* state) {
+            OpFactories upstream;
+            upstream.emplace_back(std::make_shared<SequenceSourceOperatorFactory>(
+                    next_operator_id(), next_plan_node_id(), num_rows, chunk_size));
+            upstream.emplace_back(
+                    std::make_shared<LimitOperatorFactory>(next_operator_id(), next_plan_node_id(), limit));
+
+            auto mem_mgr = std::make_shared<ChunkBufferMemoryManager>(
+                    kNumSinkers, config::local_exchange_buffer_mem_limit_per_driver);
+            auto local_exchange_source = std::make_shared<LocalExchangeSourceOperatorFactory>(
+                    next_operator_id(), Operator::s_pseudo_plan_node_id_for_final_sink, mem_mgr);
+            local_exchange_source->set_runtime_state(state);
+            local_exchange_source->set_degree_of_parallelism(kNumSinkers);
+            auto local_exchange = std::make_shared<PassthroughExchanger>(mem_mgr, local_exchange_source.get());
+            upstream.emplace_back(std::make_shared<LocalExchangeSinkOperatorFactory>(
+                    next_operator_id(), Operator::s_pseudo_plan_node_id_for_final_sink, local_exchange));
+            _pipelines.emplace_back(std::make_shared<Pipeline>(next_pipeline_id(), upstream, exec_group.get()));
+
+            OpFactories downstream;
+            downstream.emplace_back(std::move(local_exchange_source));
+            downstream.emplace_back(std::make_shared<ResultSinkOperatorFactory>(
+                    next_operator_id(), TResultSinkType::MYSQL_PROTOCAL, false, TResultSinkFormatType::OTHERS,
+                    std::vector<TExpr>{slot_ref_expr()}, _fragment_ctx));
+            _pipelines.emplace_back(std::make_shared<Pipeline>(next_pipeline_id(), downstream, exec_group.get()));
+        };
+    }
+
+    // Fetches the result like FE does, and checks that the packets are numbered consecutively up to the eos.
+    std::vector<int32_t> fetch_result() {
+        std::vector<int32_t> values;
+        for (int64_t packet_num = 0;; packet_num++) {
+            TFetchDataResult result;
+            CHECK_OK(_exec_env->result_mgr()->fetch_data(_request.params.fragment_instance_id, &result));
+            EXPECT_EQ(packet_num, result.packet_num);
+            if (result.eos) {
+                break;
+            }
+            for (const auto& row : result.result_batch.rows) {
+                // A text protocol row of one INT column is the length of the value followed by its digits.
+                EXPECT_EQ(row.size() - 1, static_cast<uint8_t>(row[0]));
+                values.push_back(std::stoi(row.substr(1)));
+            }
+        }
+        return values;
+    }
+
+    static constexpr int32_t kNumSinkers = 4;
+};
+
+TEST_F(ResultSinkOperatorTest, parallel_mysql_result_sinks_with_limit) {
+    const int32_t num_rows = 1000;
+    const int64_t limit = 777;
+    build_pipelines(num_rows, 10, limit);
+    start_test();
+
+    int num_result_sinks = 0;
+    _fragment_ctx->iterate_drivers([&](const DriverPtr& driver) {
+        num_result_sinks += driver->sink_operator()->get_raw_name() == "result_sink";
+    });
+    ASSERT_EQ(kNumSinkers, num_result_sinks);
+
+    // The drivers add their batches to the shared buffer in any order, but every row is sent once,
+    // and the limit holds across them.
+    std::vector<int32_t> values = fetch_result();
+    ASSERT_EQ(std::future_status::ready, _fragment_future.wait_for(std::chrono::seconds(15)));
+    std::sort(values.begin(), values.end());
+    std::vector<int32_t> expected(limit);
+    std::iota(expected.begin(), expected.end(), 0);
+    ASSERT_EQ(expected, values);
+}
+
+} // namespace starrocks::pipeline
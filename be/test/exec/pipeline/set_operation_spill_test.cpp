@@ -0,0 +1,516 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/set/set_operation_spiller.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/set/except_build_sink_operator.h"
+#include "exec/pipeline/set/except_output_source_operator.h"
+#include "exec/pipeline/set/except_probe_sink_operator.h"
+#include "exec/pipeline/set/intersect_build_sink_operator.h"
+#include "exec/pipeline/set/intersect_output_source_operator.h"
+#include "exec/pipeline/set/intersect_probe_sink_operator.h"
+#include "exec/pipeline/spill_process_operator.h"
+#include "exec/spill/dir_manager.h"
+#include "exec/spill/log_block_manager.h"
+#include "exec/workgroup/work_group.h"
+#include "exprs/expr.h"
+#include "exprs/runtime_filter.h"
+#include "exprs/runtime_filter_bank.h"
+#include "fs/fs.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/uid_util.h"
+
+namespace starrocks::pipeline {
+
+class SetOperationSpillTest : public ::testing::Test {
+protected:
+    // The operators of an INTERSECT/EXCEPT node, indexed by the driver sequence.
+    struct SetOperationOperators {
+        // Only set if spill is enabled.
+        std::vector<std::shared_ptr<SpillProcessOperator>> spill_processes;
+        std::vector<OperatorPtr> builds;
+        // The probers of the |i|-th PROBE child are probes[i - 1].
+        std::vector<std::vector<OperatorPtr>> probes;
+        std::vector<OperatorPtr> outputs;
+    };
+
+    void SetUp() override {
+        TUniqueId query_id = generate_uuid();
+        auto path = config::storage_root_path + "/set_operation_spill_test/" + print_id(query_id);
+        ASSERT_OK(FileSystem::Default()->create_dir_recursive(path));
+        _dir_mgr = std::make_unique<spill::DirManager>();
+        ASSERT_OK(_dir_mgr->init(path));
+        _block_mgr = std::make_unique<spill::LogBlockManager>(query_id, _dir_mgr.get());
+        ASSERT_OK(_block_mgr->open());
+    }
+
+    void TearDown() override {
+        for (auto& op : _operators) {
+            op->close(_state.get());
+        }
+        for (auto& factory : _factories) {
+            factory->close(_state.get());
+        }
+    }
+
+    // FORCE spills all the rows from the beginning, and AUTO spills once BUILD is asked to release memory. The spill
+    // options are created by the test instead of by the spill manager of the query, see create_spill_options().
+    void init_state(TSpillMode::type spill_mode) {
+        TQueryOptions query_options;
+        query_options.__set_batch_size(kChunkSize);
+        query_options.__set_enable_spill(true);
+        query_options.__set_spill_mode(spill_mode);
+        query_options.__set_spillable_operator_mask(0);
+        _state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        _state->init_instance_mem_tracker();
+        _state->set_query_ctx(_query_ctx.get());
+
+        TDescriptorTableBuilder desc_builder;
+        TTupleDescriptorBuilder tuple_builder;
+        tuple_builder.add_slot(TSlotDescriptorBuilder().type(TYPE_INT).column_name("k").nullable(false).build());
+        tuple_builder.build(&desc_builder);
+        DescriptorTbl* desc_tbl = nullptr;
+        ASSERT_OK(DescriptorTbl::create(_state.get(), &_pool, desc_builder.desc_tbl(), &desc_tbl, kChunkSize));
+        _state->set_desc_tbl(desc_tbl);
+        _slot = desc_tbl->get_tuple_descriptor(kTupleId)->slots()[0];
+    }
+
+    // Every spill flushes the mem table, so the spillers are full most of the time.
+    std::shared_ptr<spill::SpilledOptions> create_spill_options(const std::string& name) const {
+        auto options = std::make_shared<spill::SpilledOptions>(kNumSpillPartitions, false);
+        options->spill_mem_table_bytes_size = 1;
+        options->mem_table_pool_size = 1;
+        options->spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+        options->min_spilled_size = 0;
+        options->block_manager = _block_mgr.get();
+        options->name = name;
+        options->plan_node_id = kPlanNodeId;
+        options->wg = workgroup::WorkGroupManager::instance()->get_default_workgroup();
+        return options;
+    }
+
+    TExpr slot_ref_expr() const {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.__set_num_children(0);
+        node.__set_type(_slot->type().to_thrift());
+        TSlotRef slot_ref;
+        slot_ref.__set_slot_id(_slot->id());
+        slot_ref.__set_tuple_id(kTupleId);
+        node.__set_slot_ref(slot_ref);
+        node.__set_is_nullable(false);
+        TExpr expr;
+        expr.__set_nodes({node});
+        return expr;
+    }
+
+    // All the children output the key slot of the dest tuple directly.
+    const std::vector<ExprContext*>& create_exprs() {
+        ExprContext* ctx = nullptr;
+        CHECK_OK(Expr::create_expr_tree(&_pool, slot_ref_expr(), &ctx, _state.get()));
+        return *_pool.add(new std::vector<ExprContext*>{ctx});
+    }
+
+    // A local runtime filter on the keys, consumed by the scan node of a PROBE child.
+    RuntimeFilterBuildDescriptor* create_rf_desc() {
+        TRuntimeFilterDescription desc;
+        desc.__set_filter_id(1);
+        desc.__set_build_expr(slot_ref_expr());
+        desc.__set_expr_order(0);
+        desc.__set_has_remote_targets(false);
+        desc.__set_build_join_mode(TRuntimeFilterBuildJoinMode::PARTITIONED);
+        desc.__set_plan_node_id_to_target_expr({{kPlanNodeId + 1, slot_ref_expr()}});
+        auto* rf_desc = _pool.add(new RuntimeFilterBuildDescriptor());
+        CHECK_OK(rf_desc->init(&_pool, desc, _state.get()));
+        return rf_desc;
+    }
+
+    // The EXCEPT probers of the same child share the partitions round-robin if there are more probers than
+    // partitions.
+    SetOperationOperators create_operators(bool is_except, int32_t dop, int32_t num_probers, bool enable_spill,
+                                           const SetOperationRuntimeFilterBuilderPtr& rf_builder = nullptr) {
+        auto prepare_factory = [&](auto factory, const std::string& spill_name) {
+            CHECK_OK(factory->prepare(_state.get()));
+            if (enable_spill) {
+                factory->_spill_options = create_spill_options(spill_name);
+            }
+            _factories.emplace_back(factory);
+            return factory;
+        };
+        auto create_operator = [&](OperatorFactory* factory, int32_t driver_sequence) {
+            auto op = factory->create(dop, driver_sequence);
+            _operators.emplace_back(op);
+            return op;
+        };
+
+        SetOperationOperators ops;
+        auto spill_channel_factory = std::make_shared<SpillProcessChannelFactory>(dop);
+        auto spill_process_factory =
+                std::make_shared<SpillProcessOperatorFactory>(0, "spill_process", kPlanNodeId, spill_channel_factory);
+        CHECK_OK(spill_process_factory->prepare(_state.get()));
+        _factories.emplace_back(spill_process_factory);
+
+        OperatorFactoryPtr build_factory;
+        std::vector<OperatorFactoryPtr> probe_factories;
+        OperatorFactoryPtr output_factory;
+        if (is_except) {
+            auto ctx_factory = std::make_shared<ExceptPartitionContextFactory>(kTupleId, kNumChildren - 1);
+            build_factory = prepare_factory(std::make_shared<ExceptBuildSinkOperatorFactory>(
+                                                    1, kPlanNodeId, ctx_factory, create_exprs(), rf_builder,
+                                                    spill_channel_factory),
+                                            "except-build");
+            for (int32_t i = 1; i < kNumChildren; i++) {
+                probe_factories.emplace_back(prepare_factory(
+                        std::make_shared<ExceptProbeSinkOperatorFactory>(1 + i, kPlanNodeId, ctx_factory,
+                                                                         create_exprs(), i - 1),
+                        "except-probe"));
+            }
+            output_factory = std::make_shared<ExceptOutputSourceOperatorFactory>(kNumChildren + 1, kPlanNodeId,
+                                                                                 ctx_factory, kNumChildren - 1);
+        } else {
+            auto ctx_factory = std::make_shared<IntersectPartitionContextFactory>(kTupleId, kNumChildren - 1);
+            build_factory = prepare_factory(std::make_shared<IntersectBuildSinkOperatorFactory>(
+                                                    1, kPlanNodeId, ctx_factory, create_exprs(), rf_builder,
+                                                    spill_channel_factory),
+                                            "intersect-build");
+            for (int32_t i = 1; i < kNumChildren; i++) {
+                probe_factories.emplace_back(prepare_factory(
+                        std::make_shared<IntersectProbeSinkOperatorFactory>(1 + i, kPlanNodeId, ctx_factory,
+                                                                            create_exprs(), i - 1),
+                        "intersect-probe"));
+            }
+            output_factory = std::make_shared<IntersectOutputSourceOperatorFactory>(kNumChildren + 1, kPlanNodeId,
+                                                                                    ctx_factory, kNumChildren - 1);
+        }
+        CHECK_OK(output_factory->prepare(_state.get()));
+        _factories.emplace_back(output_factory);
+        build_factory->_runtime_filter_hub = &_rf_hub;
+        _rf_hub.add_holder(kPlanNodeId);
+
+        // Like the pipelines of the node, the BUILDs are created before the PROBEs, which add their spillers to the
+        // context created by BUILD.
+        for (int32_t i = 0; i < dop; i++) {
+            ops.builds.emplace_back(create_operator(build_factory.get(), i));
+            if (enable_spill) {
+                ops.spill_processes.emplace_back(std::dynamic_pointer_cast<SpillProcessOperator>(
+                        create_operator(spill_process_factory.get(), i)));
+            }
+        }
+        for (auto& probe_factory : probe_factories) {
+            auto& probes = ops.probes.emplace_back();
+            for (int32_t i = 0; i < (is_except ? num_probers : dop); i++) {
+                probes.emplace_back(create_operator(probe_factory.get(), i));
+            }
+        }
+        for (int32_t i = 0; i < dop; i++) {
+            ops.outputs.emplace_back(create_operator(output_factory.get(), i));
+        }
+        for (auto& op : _operators) {
+            CHECK_OK(op->prepare(_state.get()));
+        }
+        return ops;
+    }
+
+    // Wait until |ready| returns true like the pipeline driver, meanwhile |spill_process| runs the spill tasks of its
+    // channel, if any. The spill IO runs in the background.
+    void wait_until(const std::function<bool()>& ready, SpillProcessOperator* spill_process = nullptr) {
+        for (int64_t i = 0; !ready(); i++) {
+            ASSERT_LT(i, kMaxWaitRounds);
+            if (spill_process != nullptr && spill_process->has_output()) {
+                ASSERT_OK(spill_process->pull_chunk(_state.get()).status());
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    void push_values(Operator* sink, const std::vector<int32_t>& values, SpillProcessOperator* spill_process) {
+        for (size_t from = 0; from < values.size(); from += kChunkSize) {
+            auto column = Int32Column::create();
+            for (size_t i = from; i < std::min(from + kChunkSize, values.size()); i++) {
+                column->append(values[i]);
+            }
+            auto chunk = std::make_shared<Chunk>();
+            chunk->append_column(std::move(column), _slot->id());
+            wait_until([&]() { return sink->need_input(); }, spill_process);
+            ASSERT_OK(sink->push_chunk(_state.get(), chunk));
+        }
+    }
+
+    void finish_sink(Operator* sink, SpillProcessOperator* spill_process) {
+        ASSERT_OK(sink->set_finishing(_state.get()));
+        wait_until([&]() { return sink->is_finished(); }, spill_process);
+    }
+
+    void run_sink(Operator* sink, const std::vector<int32_t>& values, SpillProcessOperator* spill_process = nullptr) {
+        push_values(sink, values, spill_process);
+        finish_sink(sink, spill_process);
+    }
+
+    static SpillProcessOperator* spill_process_of(const SetOperationOperators& ops, int32_t partition) {
+        return ops.spill_processes.empty() ? nullptr : ops.spill_processes[partition].get();
+    }
+
+    // Run the PROBEs after the BUILDs, and pull the sorted output of all the partitions.
+    void run_probes_and_output(const SetOperationOperators& ops, std::vector<int32_t>* output) {
+        const auto dop = static_cast<int32_t>(ops.builds.size());
+        for (size_t child = 1; child < kNumChildren; child++) {
+            const auto& probes = ops.probes[child - 1];
+            for (int32_t i = 0; i < static_cast<int32_t>(probes.size()); i++) {
+                run_sink(probes[i].get(), values_of(child_values(child), i % dop, dop));
+            }
+        }
+        for (const auto& op : ops.outputs) {
+            pull_output(op.get(), output);
+        }
+        std::sort(output->begin(), output->end());
+    }
+
+    void pull_output(Operator* output, std::vector<int32_t>* values) {
+        for (int64_t i = 0; !output->is_finished(); i++) {
+            ASSERT_LT(i, kMaxWaitRounds);
+            if (!output->has_output()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+            ASSIGN_OR_ABORT(auto chunk, output->pull_chunk(_state.get()));
+            if (chunk == nullptr || chunk->is_empty()) {
+                continue;
+            }
+            auto column = chunk->get_column_by_slot_id(_slot->id());
+            for (size_t row = 0; row < chunk->num_rows(); row++) {
+                values->push_back(column->get(row).get_int32());
+            }
+        }
+    }
+
+    // The first child outputs each of 0, ..., kNumRows - 1 twice, the second one the multiples of 2 and the third
+    // one the multiples of 3, both of which exceed kNumRows.
+    static std::vector<int32_t> child_values(size_t child) {
+        const int32_t step = child == 0 ? 1 : static_cast<int32_t>(child) + 1;
+        std::vector<int32_t> values;
+        for (int32_t i = 0; i < 2 * kNumRows; i += step) {
+            values.push_back(child == 0 ? i % kNumRows : i);
+        }
+        return values;
+    }
+
+    // The rows of the |partition|-th partition, like the local shuffle of the node.
+    static std::vector<int32_t> values_of(const std::vector<int32_t>& values, int32_t partition, int32_t dop) {
+        std::vector<int32_t> partition_values;
+        std::copy_if(values.begin(), values.end(), std::back_inserter(partition_values),
+                     [&](int32_t value) { return value % dop == partition; });
+        return partition_values;
+    }
+
+    static std::vector<int32_t> expected_values(const std::function<bool(int32_t)>& pred) {
+        std::vector<int32_t> values;
+        for (int32_t i = 0; i < kNumRows; i++) {
+            if (pred(i)) {
+                values.push_back(i);
+            }
+        }
+        return values;
+    }
+
+    static std::vector<int32_t> intersect_values() {
+        return expected_values([](int32_t value) { return value % 6 == 0; });
+    }
+
+    static std::vector<int32_t> except_values() {
+        return expected_values([](int32_t value) { return value % 2 != 0 && value % 3 != 0; });
+    }
+
+    static constexpr int32_t kChunkSize = 64;
+    static constexpr int32_t kNumRows = 1000;
+    static constexpr int32_t kDop = 2;
+    static constexpr size_t kNumChildren = 3;
+    static constexpr int32_t kNumSpillPartitions = 4;
+    static constexpr int32_t kPlanNodeId = 1;
+    static constexpr TupleId kTupleId = 0;
+    static constexpr int64_t kMaxWaitRounds = 100000;
+
+    ObjectPool _pool;
+    std::unique_ptr<spill::DirManager> _dir_mgr;
+    std::unique_ptr<spill::LogBlockManager> _block_mgr;
+    std::shared_ptr<QueryContext> _query_ctx = std::make_shared<QueryContext>();
+    std::shared_ptr<RuntimeState> _state;
+    SlotDescriptor* _slot = nullptr;
+    RuntimeFilterHub _rf_hub;
+    std::vector<OperatorFactoryPtr> _factories;
+    std::vector<OperatorPtr> _operators;
+};
+
+TEST_F(SetOperationSpillTest, intersect_force_spill) {
+    init_state(TSpillMode::FORCE);
+    auto ops = create_operators(false, kDop, kDop, true);
+    for (int32_t i = 0; i < kDop; i++) {
+        run_sink(ops.builds[i].get(), values_of(child_values(0), i, kDop), spill_process_of(ops, i));
+        auto* build = down_cast<IntersectBuildSinkOperator*>(ops.builds[i].get());
+        ASSERT_TRUE(build->_intersect_ctx->is_spilled());
+        ASSERT_EQ(0, build->revocable_mem_bytes());
+    }
+
+    std::vector<int32_t> output;
+    run_probes_and_output(ops, &output);
+    ASSERT_EQ(intersect_values(), output);
+    for (const auto& op : ops.outputs) {
+        auto* intersect_output = down_cast<IntersectOutputSourceOperator*>(op.get());
+        ASSERT_TRUE(intersect_output->_intersect_ctx->spiller()->is_restore_finished());
+    }
+}
+
+TEST_F(SetOperationSpillTest, except_force_spill) {
+    init_state(TSpillMode::FORCE);
+    auto ops = create_operators(true, kDop, kDop, true);
+    for (int32_t i = 0; i < kDop; i++) {
+        run_sink(ops.builds[i].get(), values_of(child_values(0), i, kDop), spill_process_of(ops, i));
+        auto* build = down_cast<ExceptBuildSinkOperator*>(ops.builds[i].get());
+        ASSERT_TRUE(build->_except_ctx->is_spilled());
+    }
+
+    std::vector<int32_t> output;
+    run_probes_and_output(ops, &output);
+    ASSERT_EQ(except_values(), output);
+}
+
+TEST_F(SetOperationSpillTest, hash_set_dumped_by_spill_process) {
+    init_state(TSpillMode::AUTO);
+    auto ops = create_operators(false, 1, 1, true);
+    auto* build = down_cast<IntersectBuildSinkOperator*>(ops.builds[0].get());
+    auto* spill_process = ops.spill_processes[0].get();
+
+    // Each key of the first half of the rows is distinct, and all of them are in the hash set.
+    const auto values = child_values(0);
+    const std::vector<int32_t> first_half(values.begin(), values.begin() + kNumRows);
+    push_values(build, first_half, spill_process);
+    ASSERT_FALSE(build->_intersect_ctx->is_spilled());
+    ASSERT_GT(build->revocable_mem_bytes(), 0);
+
+    // The hash set is dumped inline only while the spiller has room, which every spill takes up here, so the rest is
+    // left to the spill process operator. BUILD takes no more rows until the hash set is dumped.
+    build->set_execute_mode(0);
+    const std::vector<int32_t> second_half(values.begin() + kNumRows, values.end());
+    push_values(build, {second_half.begin(), second_half.begin() + kChunkSize}, spill_process);
+    ASSERT_TRUE(build->_intersect_ctx->is_spilled());
+    ASSERT_EQ(0, build->revocable_mem_bytes());
+    ASSERT_TRUE(spill_process->_channel->has_task());
+    ASSERT_FALSE(build->need_input());
+
+    push_values(build, {second_half.begin() + kChunkSize, second_half.end()}, spill_process);
+    finish_sink(build, spill_process);
+    ASSERT_FALSE(spill_process->_channel->has_task());
+
+    std::vector<int32_t> output;
+    run_probes_and_output(ops, &output);
+    ASSERT_EQ(intersect_values(), output);
+}
+
+TEST_F(SetOperationSpillTest, concurrent_except_probers) {
+    init_state(TSpillMode::FORCE);
+    // A partition probed by 3 probers of the first PROBE child and a prober of the second one, all of which run at
+    // the same time.
+    const int32_t num_probers = 3;
+    auto ops = create_operators(true, 1, num_probers, true);
+    run_sink(ops.builds[0].get(), child_values(0), spill_process_of(ops, 0));
+
+    std::vector<std::thread> threads;
+    for (size_t child = 1; child < kNumChildren; child++) {
+        const auto& probes = ops.probes[child - 1];
+        const auto num_child_probers = static_cast<int32_t>(probes.size());
+        for (int32_t i = 0; i < num_child_probers; i++) {
+            threads.emplace_back([this, probe = probes[i].get(), child, i, num_child_probers]() {
+                run_sink(probe, values_of(child_values(child), i, num_child_probers));
+            });
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Each prober spills into its own spiller.
+    auto* build = down_cast<ExceptBuildSinkOperator*>(ops.builds[0].get());
+    ASSERT_EQ(1 + num_probers + 1, build->_except_ctx->spiller()->_spillers.size());
+
+    std::vector<int32_t> output;
+    pull_output(ops.outputs[0].get(), &output);
+    std::sort(output.begin(), output.end());
+    ASSERT_EQ(except_values(), output);
+}
+
+TEST_F(SetOperationSpillTest, runtime_filters_of_in_memory_partitions) {
+    init_state(TSpillMode::AUTO);
+    auto* rf_desc = create_rf_desc();
+    auto rf_builder = SetOperationRuntimeFilterBuilder::create(_state.get(), &_pool, kPlanNodeId, {rf_desc}, kDop);
+    auto ops = create_operators(false, kDop, kDop, false, rf_builder);
+    auto* rf_holder = _rf_hub.get_holder(kPlanNodeId, -1);
+
+    // The filter is published after the hash sets of all the partitions are built.
+    run_sink(ops.builds[0].get(), values_of(child_values(0), 0, kDop));
+    ASSERT_FALSE(rf_holder->is_ready());
+    run_sink(ops.builds[1].get(), values_of(child_values(0), 1, kDop));
+    ASSERT_TRUE(rf_holder->is_ready());
+
+    // The rows of the other children out of the keys of the first one are pruned.
+    auto* filter = down_cast<RuntimeBloomFilter<TYPE_INT>*>(rf_desc->runtime_filter());
+    ASSERT_NE(nullptr, filter);
+    ASSERT_EQ(0, filter->min_value());
+    ASSERT_EQ(kNumRows - 1, filter->max_value());
+    if (filter->can_use_bf()) {
+        for (int32_t i = 0; i < kNumRows; i++) {
+            ASSERT_TRUE(filter->_test_data(i)) << i;
+        }
+    }
+
+    std::vector<int32_t> output;
+    run_probes_and_output(ops, &output);
+    ASSERT_EQ(intersect_values(), output);
+}
+
+TEST_F(SetOperationSpillTest, spilled_partition_disables_runtime_filters) {
+    init_state(TSpillMode::AUTO);
+    auto* rf_desc = create_rf_desc();
+    auto rf_builder = SetOperationRuntimeFilterBuilder::create(_state.get(), &_pool, kPlanNodeId, {rf_desc}, kDop);
+    auto ops = create_operators(true, kDop, kDop, true, rf_builder);
+
+    // The keys of the spilled partition are unknown, so no filter is published, but the waiting operators are
+    // notified.
+    run_sink(ops.builds[0].get(), values_of(child_values(0), 0, kDop), spill_process_of(ops, 0));
+    ops.builds[1]->set_execute_mode(0);
+    run_sink(ops.builds[1].get(), values_of(child_values(0), 1, kDop), spill_process_of(ops, 1));
+    ASSERT_FALSE(down_cast<ExceptBuildSinkOperator*>(ops.builds[0].get())->_except_ctx->is_spilled());
+    ASSERT_TRUE(down_cast<ExceptBuildSinkOperator*>(ops.builds[1].get())->_except_ctx->is_spilled());
+    ASSERT_TRUE(_rf_hub.get_holder(kPlanNodeId, -1)->is_ready());
+    ASSERT_EQ(nullptr, rf_desc->runtime_filter());
+
+    std::vector<int32_t> output;
+    run_probes_and_output(ops, &output);
+    ASSERT_EQ(except_values(), output);
+}
+
+} // namespace starrocks::pipeline
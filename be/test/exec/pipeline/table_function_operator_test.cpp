@@ -1,5 +1,8 @@
 #include "exec/pipeline/table_function_operator.h"
 
+#include "column/array_column.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "exec/pipeline/query_context.h"
 #include "gtest/gtest.h"
 
@@ -11,6 +14,9 @@ public:
 protected:
     void SetUp() override;
 
+    // Input rows: ([1, 2], 10), ([], 20), ([3], 30), ([4, 5, 6], 40).
+    static ChunkPtr _create_input_chunk();
+
 private:
     RuntimeState _runtime_state;
     std::unique_ptr<QueryContext> _query_ctx = std::make_unique<QueryContext>();
@@ -165,4 +171,72 @@ TEST_F(TableFunctionOperatorTest, check_mem_leak) {
     op.close(&_runtime_state);
 }
 
+ChunkPtr TableFunctionOperatorTest::_create_input_chunk() {
+    auto elements = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto offsets = UInt32Column::create();
+    offsets->append(0);
+    for (int32_t v : {1, 2, 3, 4, 5, 6}) {
+        elements->append_datum(Datum(v));
+    }
+    for (uint32_t offset : {2, 2, 3, 6}) {
+        offsets->append(offset);
+    }
+    auto outer = Int32Column::create();
+    for (int32_t v : {10, 20, 30, 40}) {
+        outer->append(v);
+    }
+
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(ArrayColumn::create(elements, offsets), 1);
+    chunk->append_column(outer, 2);
+    return chunk;
+}
+
+TEST_F(TableFunctionOperatorTest, unnest) {
+    CounterPtr counter_ptr = std::make_shared<Counter>();
+    TestNormalOperatorFactory factory(1, 1, counter_ptr, &_tnode);
+    TableFunctionOperator op(&factory, 1, 1, 0, _tnode);
+    ASSERT_TRUE(op.prepare(&_runtime_state).ok());
+
+    ASSERT_TRUE(op.push_chunk(&_runtime_state, _create_input_chunk()).ok());
+    ASSERT_TRUE(op.has_output());
+    auto result = op.pull_chunk(&_runtime_state);
+    ASSERT_TRUE(result.ok());
+    const auto& chunk = result.value();
+    ASSERT_FALSE(op.has_output());
+
+    std::vector<int32_t> expected_outer{10, 10, 30, 40, 40, 40};
+    ASSERT_EQ(expected_outer.size(), chunk->num_rows());
+    for (size_t i = 0; i < expected_outer.size(); i++) {
+        ASSERT_EQ(expected_outer[i], chunk->get_column_by_slot_id(2)->get(i).get_int32());
+        ASSERT_EQ(static_cast<int32_t>(i + 1), chunk->get_column_by_slot_id(3)->get(i).get_int32());
+    }
+    op.close(&_runtime_state);
+}
+
+TEST_F(TableFunctionOperatorTest, unnest_split_output) {
+    CounterPtr counter_ptr = std::make_shared<Counter>();
+    TestNormalOperatorFactory factory(1, 1, counter_ptr, &_tnode);
+    TableFunctionOperator op(&factory, 1, 1, 0, _tnode);
+    ASSERT_TRUE(op.prepare(&_runtime_state).ok());
+    _runtime_state.set_chunk_size(4);
+
+    ASSERT_TRUE(op.push_chunk(&_runtime_state, _create_input_chunk()).ok());
+    std::vector<int32_t> outer_values;
+    std::vector<int32_t> result_values;
+    while (op.has_output()) {
+        auto result = op.pull_chunk(&_runtime_state);
+        ASSERT_TRUE(result.ok());
+        const auto& chunk = result.value();
+        ASSERT_LE(chunk->num_rows(), 4);
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            outer_values.emplace_back(chunk->get_column_by_slot_id(2)->get(i).get_int32());
+            result_values.emplace_back(chunk->get_column_by_slot_id(3)->get(i).get_int32());
+        }
+    }
+    ASSERT_EQ(std::vector<int32_t>({10, 10, 30, 40, 40, 40}), outer_values);
+    ASSERT_EQ(std::vector<int32_t>({1, 2, 3, 4, 5, 6}), result_values);
+    op.close(&_runtime_state);
+}
+
 } // namespace starrocks::pipeline
@@ -20,7 +20,9 @@
 #include <thread>
 #include <utility>
 
+#include "column/binary_column.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
 #include "exec/pipeline/group_execution/execution_group_builder.h"
 #include "exec/pipeline/group_execution/execution_group_fwd.h"
@@ -30,6 +32,7 @@
 #include "exec/query_cache/cache_operator.h"
 #include "exec/query_cache/cache_param.h"
 #include "exec/query_cache/conjugate_operator.h"
+#include "exec/query_cache/ht_size_hints.h"
 #include "exec/query_cache/lane_arbiter.h"
 #include "exec/query_cache/multilane_operator.h"
 #include "exec/query_cache/ticket_checker.h"
@@ -160,6 +163,64 @@ TEST_F(QueryCacheTest, testCacheManager) {
     ASSERT_GE(cache_mgr->memory_usage(), 0);
 }
 
+TEST_F(QueryCacheTest, testCacheValueSerde) {
+    auto chk = std::make_shared<Chunk>();
+    auto int_col = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto str_col = BinaryColumn::create();
+    for (auto i = 0; i < 100; ++i) {
+        if (i % 7 == 0) {
+            int_col->append_nulls(1);
+        } else {
+            int_col->append_datum(Datum(i));
+        }
+        str_col->append(strings::Substitute("value_$0", i));
+    }
+    chk->append_column(int_col, 1);
+    chk->append_column(str_col, 2);
+    auto last_chk = std::make_shared<Chunk>();
+    query_cache::CacheValue value(123, 5, {chk, last_chk});
+
+    query_cache::CacheSlotTypes slot_types{{1, TypeDescriptor(TYPE_INT)}, {2, TypeDescriptor::create_varchar_type(64)}};
+    auto data = query_cache::CacheManager::serialize_cache_value(value, slot_types);
+    ASSERT_TRUE(data.ok());
+    auto restored = query_cache::CacheManager::deserialize_cache_value(Slice(data.value()));
+    ASSERT_TRUE(restored.ok());
+    ASSERT_EQ(restored.value().version, 5);
+    ASSERT_EQ(restored.value().populate_time, 123);
+    ASSERT_EQ(restored.value().result.size(), 2);
+    const auto& restored_chk = restored.value().result[0];
+    ASSERT_EQ(restored_chk->num_rows(), 100);
+    for (auto i = 0; i < 100; ++i) {
+        ASSERT_EQ(restored_chk->get_column_by_slot_id(1)->debug_item(i), int_col->debug_item(i));
+        ASSERT_EQ(restored_chk->get_column_by_slot_id(2)->debug_item(i), str_col->debug_item(i));
+    }
+    ASSERT_EQ(restored.value().result[1]->num_columns(), 0);
+
+    // Entries without the type of every slot stay in memory only.
+    slot_types.erase(2);
+    ASSERT_TRUE(query_cache::CacheManager::serialize_cache_value(value, slot_types).status().is_not_supported());
+    // A truncated entry is rejected.
+    auto truncated = Slice(data.value().data(), data.value().size() / 2);
+    ASSERT_FALSE(query_cache::CacheManager::deserialize_cache_value(truncated).ok());
+}
+
+TEST_F(QueryCacheTest, testHashTableSizeHints) {
+    query_cache::HashTableSizeHints hints(1024);
+    ASSERT_EQ(hints.lookup(1, 1), 0);
+
+    hints.update(1, 1, 100);
+    hints.update(1, 2, 200);
+    ASSERT_EQ(hints.lookup(1, 1), 100);
+    ASSERT_EQ(hints.lookup(1, 2), 200);
+    ASSERT_EQ(hints.lookup(2, 1), 0);
+
+    // the latest execution overwrites the hint.
+    hints.update(1, 1, 150);
+    ASSERT_EQ(hints.lookup(1, 1), 150);
+    ASSERT_EQ(hints.lookup_count(), 5);
+    ASSERT_EQ(hints.hit_count(), 3);
+}
+
 ChunkPtr create_test_chunk(query_cache::LaneOwnerType owner, long from, long to, bool is_last_chunk) {
     ChunkPtr chunk = std::make_shared<Chunk>();
     chunk->owner_info().set_owner_id(owner, is_last_chunk);
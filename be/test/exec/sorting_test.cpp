@@ -25,6 +25,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/sorting/merge.h"
 #include "exec/sorting/merge_path.h"
+#include "exec/sorting/normalized_key.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exprs/column_ref.h"
@@ -247,6 +248,97 @@ TEST(SortingTest, materialize_by_permutation_int) {
     ASSERT_EQ(2048, merged->get(1).get_int32());
 }
 
+TEST(SortingTest, radix_sort_fixed_width_keys) {
+    std::default_random_engine e(0);
+    std::uniform_int_distribution<int64_t> u64(std::numeric_limits<int64_t>::min(),
+                                               std::numeric_limits<int64_t>::max());
+    std::uniform_int_distribution<int> day(1, 28);
+    const size_t num_rows = kRadixSortMinRows * 4;
+
+    // two distinct values in the first column leave ties large enough to radix sort the second one
+    auto c0 = Int8Column::create();
+    auto c1 = Int64Column::create();
+    auto c2 = DateColumn::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        c0->append(i % 2 == 0 ? -1 : 1);
+        c1->append(u64(e));
+        c2->append(DateValue::create(2023, 1 + i % 12, day(e)));
+    }
+
+    std::atomic<bool> cancel{false};
+    for (bool asc : {true, false}) {
+        Columns columns{c0, c1};
+        SortDescs desc(std::vector<bool>{asc, !asc}, std::vector<bool>{true, true});
+        Permutation perm;
+        ASSERT_OK(sort_and_tie_columns(cancel, columns, desc, &perm));
+        ASSERT_EQ(num_rows, perm.size());
+        for (size_t i = 1; i < num_rows; i++) {
+            ASSERT_LE(compare_chunk_row(desc, columns, columns, perm[i - 1].index_in_chunk, perm[i].index_in_chunk),
+                      0);
+        }
+
+        Columns date_columns{c2};
+        SortDescs date_desc(std::vector<bool>{asc}, std::vector<bool>{true});
+        Permutation date_perm;
+        ASSERT_OK(sort_and_tie_columns(cancel, date_columns, date_desc, &date_perm));
+        for (size_t i = 1; i < num_rows; i++) {
+            ASSERT_LE(compare_chunk_row(date_desc, date_columns, date_columns, date_perm[i - 1].index_in_chunk,
+                                        date_perm[i].index_in_chunk),
+                      0);
+        }
+    }
+}
+
+TEST(SortingTest, normalized_keys) {
+    std::default_random_engine e(0);
+    std::uniform_int_distribution<int32_t> small(-3, 3);
+    std::vector<std::string> strings{"", "a", "ab", "abcdefgh", "abcdefghi", "abcdefghj", "b"};
+    const size_t num_rows = 200;
+
+    auto c0 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto c1 = BinaryColumn::create();
+    auto c2 = Int64Column::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        if (i % 7 == 0) {
+            c0->append_nulls(1);
+        } else {
+            c0->append_datum(Datum(small(e)));
+        }
+        c1->append(strings[(i * 3) % strings.size()]);
+        c2->append(small(e) * 1000000007L);
+    }
+    Columns columns{c0, c2, c1};
+    Columns string_first{c1, c0, c2};
+
+    auto sign = [](int x) { return (x > 0) - (x < 0); };
+    for (bool asc : {true, false}) {
+        for (bool null_first : {true, false}) {
+            SortDescs desc(std::vector<bool>{asc, !asc, asc}, std::vector<bool>{null_first, null_first, null_first});
+            for (const auto& cols : {columns, string_first}) {
+                NormalizedKeys keys;
+                build_normalized_keys(cols, desc, 32, &keys);
+                ASSERT_FALSE(keys.empty());
+                for (size_t i = 0; i < num_rows; i++) {
+                    for (size_t j = 0; j < num_rows; j += 3) {
+                        size_t first_column = 0;
+                        int res = compare_normalized_keys(keys, i, keys, j, &first_column);
+                        if (res == 0) {
+                            SortDescs rest;
+                            rest.descs.assign(desc.descs.begin() + first_column, desc.descs.end());
+                            Columns rest_columns(cols.begin() + first_column, cols.end());
+                            res = rest_columns.empty()
+                                          ? 0
+                                          : compare_chunk_row(rest, rest_columns, rest_columns, i, j);
+                        }
+                        ASSERT_EQ(sign(compare_chunk_row(desc, cols, cols, i, j)), sign(res))
+                                << "row " << i << " vs " << j;
+                    }
+                }
+            }
+        }
+    }
+}
+
 TEST(SortingTest, steal_chunk) {
     ColumnPtr col1 = build_sorted_column(TypeDescriptor(TYPE_INT), 0, 100, 1);
     ColumnPtr col2 = build_sorted_column(TypeDescriptor(TYPE_INT), 0, 100, 1);
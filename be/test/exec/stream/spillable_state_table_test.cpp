@@ -0,0 +1,182 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/stream/state/spillable_state_table.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "common/config.h"
+#include "exec/stream/stream_test.h"
+#include "fs/fs_util.h"
+#include "testutil/assert.h"
+#include "testutil/desc_tbl_helper.h"
+
+namespace starrocks::stream {
+
+class SpillableStateTableTest : public StreamTestBase {
+public:
+    void SetUp() override {
+        _runtime_state = _obj_pool.add(new RuntimeState(TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr));
+        std::vector<SlotTypeInfo> src_slots = std::vector<SlotTypeInfo>{
+                {"col1", TYPE_INT, false},
+                {"col2", TYPE_INT, false},
+                {"col3", TYPE_INT, false},
+                {"agg1", TYPE_INT, false},
+        };
+        auto slot_type_info_arrays = DescTblHelper::create_slot_type_desc_info_arrays({src_slots});
+        _tbl = DescTblHelper::generate_desc_tbl(_runtime_state, _obj_pool, slot_type_info_arrays);
+        _runtime_state->set_desc_tbl(_tbl);
+        _max_sorted_runs = config::stream_state_table_max_sorted_runs;
+        (void)fs::remove_all(kTestDir);
+    }
+
+    void TearDown() override {
+        config::stream_state_table_max_sorted_runs = _max_sorted_runs;
+        (void)fs::remove_all(kTestDir);
+    }
+
+protected:
+    static constexpr const char* const kTestDir = "./spillable_state_table_test";
+
+    std::unique_ptr<SpillableStateTable> make_state_table(size_t k_num) {
+        auto state_table = std::make_unique<SpillableStateTable>(_tbl->get_tuple_descriptor(0)->slots(), k_num,
+                                                                 std::string(kTestDir) + "/table");
+        CHECK(state_table->open(_runtime_state).ok());
+        return state_table;
+    }
+
+    // Seek all the keys of |keys| in one batch, a key is expected to be not found if its row in |expects| is empty.
+    void check_seek(StateTable* state_table, const std::vector<int32_t>& keys,
+                    const std::vector<std::vector<int32_t>>& expects) {
+        Columns key_cols{ColumnTestHelper::build_column<int32_t>(keys)};
+        StateTableResult result;
+        ASSERT_OK(state_table->seek(key_cols, result));
+        ASSERT_EQ(keys.size(), result.found.size());
+        size_t row = 0;
+        for (size_t i = 0; i < keys.size(); i++) {
+            ASSERT_EQ(!expects[i].empty(), result.found[i]) << "key " << keys[i];
+            if (expects[i].empty()) {
+                continue;
+            }
+            for (size_t c = 0; c < expects[i].size(); c++) {
+                ASSERT_EQ(expects[i][c], result.result_chunk->get_column_by_index(c)->get(row).get_int32());
+            }
+            row++;
+        }
+        ASSERT_EQ(row, result.result_chunk->num_rows());
+    }
+
+    void check_prefix_scan(StateTable* state_table, const std::vector<int32_t>& keys,
+                           const std::vector<std::vector<int32_t>>& expect_rows) {
+        Columns key_cols;
+        for (auto key : keys) {
+            key_cols.push_back(ColumnTestHelper::build_column<int32_t>({key}));
+        }
+        auto chunk_iter_or = state_table->prefix_scan(key_cols, 0);
+        if (expect_rows.empty()) {
+            ASSERT_TRUE(chunk_iter_or.status().is_end_of_file());
+            return;
+        }
+        ASSERT_OK(chunk_iter_or.status());
+        auto chunk_iter = chunk_iter_or.value();
+        ChunkPtr chunk = ChunkHelper::new_chunk(chunk_iter->schema(), 1);
+        ASSERT_OK(chunk_iter->get_next(chunk.get()));
+        ASSERT_EQ(expect_rows.size(), chunk->num_rows());
+        for (size_t i = 0; i < expect_rows.size(); i++) {
+            for (size_t c = 0; c < expect_rows[i].size(); c++) {
+                ASSERT_EQ(expect_rows[i][c], chunk->get_column_by_index(c)->get(i).get_int32());
+            }
+        }
+        chunk->reset();
+        ASSERT_TRUE(chunk_iter->get_next(chunk.get()).is_end_of_file());
+        chunk_iter->close();
+    }
+
+    RuntimeState* _runtime_state;
+    ObjectPool _obj_pool;
+    DescriptorTbl* _tbl;
+    int32_t _max_sorted_runs;
+};
+
+TEST_F(SpillableStateTableTest, test_seek_sorted_runs) {
+    auto state_table = make_state_table(1);
+    check_seek(state_table.get(), {1}, {{}});
+
+    ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>(
+                                                         {{1, 2, 3}, {1, 2, 3}, {1, 2, 3}, {11, 12, 13}}, {0, 0, 0})));
+    ASSERT_OK(state_table->spill());
+    ASSERT_EQ(1, state_table->num_sorted_runs());
+    ASSERT_EQ(0, state_table->mem_table_bytes());
+    check_seek(state_table.get(), {3, 4, 1, 2}, {{3, 3, 13}, {}, {1, 1, 11}, {2, 2, 12}});
+    ASSERT_GT(state_table->hot_key_cache_bytes(), 0);
+
+    // Update 2, delete 3 and insert 4, the newer values shadow the spilled ones.
+    ASSERT_OK(state_table->write(_runtime_state,
+                                 MakeStreamChunk<int32_t>({{2, 3, 4}, {2, 3, 4}, {2, 3, 4}, {22, 13, 24}}, {3, 1, 0})));
+    check_seek(state_table.get(), {1, 2, 3, 4}, {{1, 1, 11}, {2, 2, 22}, {}, {4, 4, 24}});
+    ASSERT_OK(state_table->spill());
+    ASSERT_EQ(2, state_table->num_sorted_runs());
+    check_seek(state_table.get(), {1, 2, 3, 4}, {{1, 1, 11}, {2, 2, 22}, {}, {4, 4, 24}});
+}
+
+TEST_F(SpillableStateTableTest, test_merge_sorted_runs) {
+    config::stream_state_table_max_sorted_runs = 2;
+    auto state_table = make_state_table(1);
+    std::vector<int32_t> all_keys;
+    std::vector<std::vector<int32_t>> expects;
+    for (int32_t round = 0; round < 3; round++) {
+        std::vector<int32_t> keys;
+        std::vector<int32_t> values;
+        for (int32_t k = 0; k < 10000; k++) {
+            keys.push_back(k);
+            values.push_back(k + round);
+        }
+        std::vector<int8_t> ops(keys.size(), 0);
+        // The odd keys are deleted in the last round.
+        for (size_t i = 1; round == 2 && i < ops.size(); i += 2) {
+            ops[i] = 1;
+        }
+        ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({keys, keys, keys, values}, ops)));
+        ASSERT_OK(state_table->spill());
+    }
+    // The third run triggers a merge.
+    ASSERT_EQ(1, state_table->num_sorted_runs());
+    for (int32_t k = 0; k < 10000; k++) {
+        all_keys.push_back(k);
+        expects.push_back(k % 2 == 0 ? std::vector<int32_t>{k, k, k + 2} : std::vector<int32_t>{});
+    }
+    check_seek(state_table.get(), all_keys, expects);
+}
+
+TEST_F(SpillableStateTableTest, test_prefix_scan) {
+    auto state_table = make_state_table(3);
+    check_prefix_scan(state_table.get(), {1, 1}, {});
+
+    ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>(
+                                                         {{1, 1, 2}, {1, 1, 1}, {1, 2, 1}, {11, 12, 13}}, {0, 0, 0})));
+    ASSERT_OK(state_table->spill());
+    ASSERT_OK(state_table->write(_runtime_state,
+                                 MakeStreamChunk<int32_t>({{1, 1}, {1, 1}, {2, 3}, {22, 23}}, {3, 0})));
+    check_prefix_scan(state_table.get(), {1, 1}, {{1, 11}, {2, 22}, {3, 23}});
+    check_prefix_scan(state_table.get(), {2, 1}, {{1, 13}});
+    check_prefix_scan(state_table.get(), {3, 1}, {});
+
+    ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({{1}, {1}, {1}, {11}}, {1})));
+    ASSERT_OK(state_table->spill());
+    check_prefix_scan(state_table.get(), {1, 1}, {{2, 22}, {3, 23}});
+}
+
+} // namespace starrocks::stream
@@ -0,0 +1,219 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/tablet_sink_index_channel.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/tablet_sink.h"
+#include "gen_cpp/internal_service.pb.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks::stream_load {
+
+// Records the add chunk requests instead of sending them. The requests stay in flight until
+// finish_requests() runs their closures.
+class RecordingRpcChannel : public google::protobuf::RpcChannel {
+public:
+    void CallMethod(const google::protobuf::MethodDescriptor* method, google::protobuf::RpcController* controller,
+                    const google::protobuf::Message* request, google::protobuf::Message* response,
+                    google::protobuf::Closure* done) override {
+        requests.emplace_back(*static_cast<const PTabletWriterAddChunkRequest*>(request));
+        _pending_closures.push_back(done);
+    }
+
+    void finish_requests() {
+        for (auto* done : _pending_closures) {
+            done->Run();
+        }
+        _pending_closures.clear();
+    }
+
+    std::vector<PTabletWriterAddChunkRequest> requests;
+
+private:
+    std::vector<google::protobuf::Closure*> _pending_closures;
+};
+
+class NodeChannelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.__set_batch_size(kChunkSize);
+        TQueryGlobals query_globals;
+        _state = std::make_shared<RuntimeState>(TUniqueId(), query_options, query_globals, nullptr);
+
+        Status st;
+        _sink = std::make_unique<OlapTableSink>(&_pool, std::vector<TExpr>{}, &st, _state.get());
+        ASSERT_OK(st);
+        _sink->_ts_profile = &_ts_profile;
+
+        TNodeInfo tnode;
+        tnode.__set_id(kNodeId);
+        tnode.__set_host("127.0.0.1");
+        _node_info = std::make_unique<NodeInfo>(tnode);
+        _stub = std::make_unique<PInternalService_Stub>(&_rpc_channel);
+
+        _old_target_bytes = config::tablet_sink_chunk_target_bytes;
+    }
+
+    void TearDown() override {
+        _rpc_channel.finish_requests();
+        _channel.reset();
+        config::tablet_sink_chunk_target_bytes = _old_target_bytes;
+    }
+
+    // Sets up the channel the way NodeChannel::init() does after the tablet writers are opened.
+    void create_channel() {
+        _channel = std::make_unique<NodeChannel>(_sink.get(), kNodeId, false, nullptr);
+        _channel->_runtime_state = _state.get();
+        _channel->_node_info = _node_info.get();
+        _channel->_stub = _stub.get();
+        auto request = _channel->_rpc_request.add_requests();
+        request->set_index_id(kIndexId);
+        request->set_eos(false);
+        auto closure = new ReusableClosure<PTabletWriterAddBatchResult>();
+        closure->ref();
+        _channel->_add_batch_closures.emplace_back(closure);
+    }
+
+    static ChunkUniquePtr create_int_chunk(int32_t num_rows) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < num_rows; i++) {
+            column->append(i);
+        }
+        auto chunk = std::make_unique<Chunk>();
+        chunk->append_column(std::move(column), kSlotId);
+        return chunk;
+    }
+
+    static ChunkUniquePtr create_string_chunk(int32_t num_rows, size_t value_size) {
+        auto column = BinaryColumn::create();
+        std::string value(value_size, 'x');
+        for (int32_t i = 0; i < num_rows; i++) {
+            column->append(value);
+        }
+        auto chunk = std::make_unique<Chunk>();
+        chunk->append_column(std::move(column), kSlotId);
+        return chunk;
+    }
+
+    Status add_chunk(Chunk* chunk) {
+        size_t num_rows = chunk->num_rows();
+        std::vector<int64_t> tablet_ids(num_rows, kTabletId);
+        std::vector<uint32_t> indexes(num_rows);
+        std::iota(indexes.begin(), indexes.end(), 0);
+        return _channel->add_chunk(chunk, tablet_ids, indexes, 0, num_rows);
+    }
+
+    static constexpr int32_t kChunkSize = 64;
+    static constexpr int64_t kNodeId = 1;
+    static constexpr int64_t kIndexId = 1;
+    static constexpr int64_t kTabletId = 10;
+    static constexpr SlotId kSlotId = 1;
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _state;
+    std::unique_ptr<OlapTableSink> _sink;
+    TabletSinkProfile _ts_profile{};
+    std::unique_ptr<NodeInfo> _node_info;
+    RecordingRpcChannel _rpc_channel;
+    std::unique_ptr<PInternalService_Stub> _stub;
+    std::unique_ptr<NodeChannel> _channel;
+    int64_t _old_target_bytes = 0;
+};
+
+TEST_F(NodeChannelTest, narrow_rows_coalesce_up_to_row_limit) {
+    create_channel();
+    const int32_t max_rows = kChunkSize * NodeChannel::kMaxCoalesceChunks;
+
+    // Chunks of narrow rows are far below the byte target, they keep coalescing past chunk_size.
+    auto chunk = create_int_chunk(kChunkSize);
+    for (int32_t i = 0; i < NodeChannel::kMaxCoalesceChunks - 1; i++) {
+        ASSERT_OK(add_chunk(chunk.get()));
+    }
+    ASSERT_TRUE(_rpc_channel.requests.empty());
+    ASSERT_EQ(max_rows - kChunkSize, _channel->_cur_chunk->num_rows());
+
+    // Until the row limit is reached.
+    ASSERT_OK(add_chunk(chunk.get()));
+    ASSERT_EQ(1, _rpc_channel.requests.size());
+    ASSERT_EQ(max_rows, _rpc_channel.requests[0].tablet_ids_size());
+    ASSERT_FALSE(_rpc_channel.requests[0].eos());
+    ASSERT_EQ(0, _channel->_cur_chunk->num_rows());
+
+    // The next full chunk waits in the queue while the first request is in flight.
+    for (int32_t i = 0; i < NodeChannel::kMaxCoalesceChunks; i++) {
+        ASSERT_OK(add_chunk(chunk.get()));
+    }
+    ASSERT_EQ(1, _rpc_channel.requests.size());
+    ASSERT_EQ(1, _channel->_request_queue.size());
+    ASSERT_EQ(max_rows, _channel->_request_queue.front().first->num_rows());
+    ASSERT_EQ(max_rows, _channel->_request_queue.front().second.requests(0).tablet_ids_size());
+}
+
+TEST_F(NodeChannelTest, wide_rows_flush_at_target_bytes) {
+    config::tablet_sink_chunk_target_bytes = 64 * 1024;
+    create_channel();
+
+    // chunk_size rows of 512 bytes are half of the target, so two of them make a request.
+    auto chunk = create_string_chunk(kChunkSize, 512);
+    ASSERT_OK(add_chunk(chunk.get()));
+    ASSERT_TRUE(_rpc_channel.requests.empty());
+    ASSERT_OK(add_chunk(chunk.get()));
+    ASSERT_EQ(1, _rpc_channel.requests.size());
+    ASSERT_EQ(2 * kChunkSize, _rpc_channel.requests[0].tablet_ids_size());
+    ASSERT_EQ(0, _channel->_cur_chunk->num_rows());
+}
+
+TEST_F(NodeChannelTest, zero_target_bytes_flushes_every_chunk_size) {
+    config::tablet_sink_chunk_target_bytes = 0;
+    create_channel();
+
+    auto chunk = create_int_chunk(kChunkSize);
+    ASSERT_OK(add_chunk(chunk.get()));
+    ASSERT_EQ(1, _rpc_channel.requests.size());
+    ASSERT_EQ(kChunkSize, _rpc_channel.requests[0].tablet_ids_size());
+
+    ASSERT_OK(add_chunk(chunk.get()));
+    ASSERT_EQ(1, _channel->_request_queue.size());
+    ASSERT_EQ(kChunkSize, _channel->_request_queue.front().first->num_rows());
+}
+
+TEST_F(NodeChannelTest, coalesced_rows_flushed_at_eos) {
+    create_channel();
+
+    // More than chunk_size rows, but still coalescing when the input ends.
+    auto chunk = create_int_chunk(kChunkSize);
+    for (int32_t i = 0; i < 3; i++) {
+        ASSERT_OK(add_chunk(chunk.get()));
+    }
+    ASSERT_TRUE(_rpc_channel.requests.empty());
+
+    ASSERT_OK(_channel->try_close());
+    ASSERT_EQ(1, _rpc_channel.requests.size());
+    ASSERT_TRUE(_rpc_channel.requests[0].eos());
+    ASSERT_EQ(3 * kChunkSize, _rpc_channel.requests[0].tablet_ids_size());
+    ASSERT_TRUE(_rpc_channel.requests[0].has_chunk());
+    ASSERT_TRUE(_channel->_request_queue.empty());
+}
+
+} // namespace starrocks::stream_load
@@ -23,11 +23,13 @@
 #include <mutex>
 #include <thread>
 
+#include "common/config.h"
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/scan_executor.h"
 #include "exec/workgroup/work_group.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 namespace starrocks::workgroup {
 
@@ -191,4 +193,29 @@ PARALLEL_TEST(ScanExecutorTest, test_yield) {
     ASSERT_EQ(submit_tasks, finished_tasks.load());
 }
 
+TEST(WorkGroupIoThrottleTest, test_token_bucket) {
+    auto wg = std::make_shared<WorkGroup>("wg_io_throttle", 10001, WorkGroup::DEFAULT_VERSION, 4, 0.5, 10, 1.0,
+                                          WorkGroupType::WG_NORMAL);
+    const int64_t prev_limit = config::resource_group_io_bytes_per_second_limit;
+    DeferOp defer([prev_limit]() { config::resource_group_io_bytes_per_second_limit = prev_limit; });
+
+    // Unlimited I/O bandwidth only accounts the bytes.
+    config::resource_group_io_bytes_per_second_limit = 0;
+    wg->incr_io_bytes(1L << 20);
+    ASSERT_EQ(1L << 20, wg->io_bytes());
+    ASSERT_EQ(0, wg->io_bytes_per_second_limit());
+    ASSERT_FALSE(wg->is_io_throttled());
+
+    config::resource_group_io_bytes_per_second_limit = 1L << 20;
+    const int64_t limit = wg->io_bytes_per_second_limit();
+    ASSERT_GT(limit, 0);
+    ASSERT_LE(limit, 1L << 20);
+
+    // The bucket is filled up the first time, and is throttled after overdrawing it.
+    ASSERT_FALSE(wg->is_io_throttled());
+    wg->incr_io_bytes(limit * 2);
+    ASSERT_EQ((1L << 20) + limit * 2, wg->io_bytes());
+    ASSERT_TRUE(wg->is_io_throttled());
+}
+
 } // namespace starrocks::workgroup
@@ -22,6 +22,7 @@
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/agg/aggregate_factory.h"
 #include "exprs/agg/any_value.h"
 #include "exprs/agg/array_agg.h"
@@ -38,7 +39,9 @@
 #include "runtime/time_types.h"
 #include "testutil/function_utils.h"
 #include "types/bitmap_value.h"
+#include "types/hll.h"
 #include "util/slice.h"
+#include "util/defer_op.h"
 #include "util/thrift_util.h"
 #include "util/unaligned_access.h"
 
@@ -1038,6 +1041,79 @@ TEST_F(AggregateTest, test_sum_distinct) {
                                                       DecimalV2Value(21));
 }
 
+TEST_F(AggregateTest, test_distinct_v2_switch_to_bitmap) {
+    auto old_threshold = config::distinct_agg_bitmap_switch_threshold;
+    config::distinct_agg_bitmap_switch_threshold = 1000;
+    DeferOp defer([&]() { config::distinct_agg_bitmap_switch_threshold = old_threshold; });
+
+    // the inputs are dense, so the states switch to bitmaps during update and merge.
+    const AggregateFunction* func = get_aggregate_function("multi_distinct_count2", TYPE_INT, TYPE_BIGINT, false);
+    test_agg_function<int32_t, int64_t>(ctx, func, 1024, 1000, 2024);
+    func = get_aggregate_function("multi_distinct_count2", TYPE_BIGINT, TYPE_BIGINT, false);
+    test_agg_function<int64_t, int64_t>(ctx, func, 1024, 1000, 2024);
+    func = get_aggregate_function("multi_distinct_sum2", TYPE_INT, TYPE_BIGINT, false);
+    test_agg_function<int32_t, int64_t>(ctx, func, 523776, 2499500, 3023276);
+    func = get_aggregate_function("multi_distinct_sum2", TYPE_BIGINT, TYPE_BIGINT, false);
+    test_agg_function<int64_t, int64_t>(ctx, func, 523776, 2499500, 3023276);
+
+    // negative values
+    func = get_aggregate_function("multi_distinct_sum2", TYPE_BIGINT, TYPE_BIGINT, false);
+    auto column = Int64Column::create();
+    for (int64_t i = -5000; i < 5000; i++) {
+        column->append(i);
+        column->append(i);
+    }
+    const Column* row_column = column.get();
+    auto state = ManagedAggrState::create(ctx, func);
+    func->update_batch_single_state(ctx, row_column->size(), &row_column, state->state());
+    auto result = Int64Column::create();
+    func->finalize_to_column(ctx, state->state(), result.get());
+    ASSERT_EQ(-5000, result->get_data()[0]);
+
+    // sparse values stay in the hash set and are still counted correctly.
+    func = get_aggregate_function("multi_distinct_count2", TYPE_BIGINT, TYPE_BIGINT, false);
+    column = Int64Column::create();
+    for (int64_t i = 0; i < 2000; i++) {
+        column->append(i * 1000003);
+    }
+    row_column = column.get();
+    state = ManagedAggrState::create(ctx, func);
+    func->update_batch_single_state(ctx, row_column->size(), &row_column, state->state());
+    result = Int64Column::create();
+    func->finalize_to_column(ctx, state->state(), result.get());
+    ASSERT_EQ(2000, result->get_data()[0]);
+}
+
+TEST_F(AggregateTest, test_ndv_batch_update) {
+    const AggregateFunction* func = get_aggregate_function("ndv", TYPE_BIGINT, TYPE_BIGINT, false);
+    auto column = Int64Column::create();
+    for (int64_t i = 0; i < 10000; i++) {
+        column->append(i % 5000);
+    }
+    const Column* row_column = column.get();
+
+    auto state = ManagedAggrState::create(ctx, func);
+    func->update_batch_single_state(ctx, row_column->size(), &row_column, state->state());
+    auto result = Int64Column::create();
+    func->finalize_to_column(ctx, state->state(), result.get());
+    int64_t estimate = result->get_data()[0];
+    ASSERT_NEAR(5000, estimate, 5000 * 0.05);
+
+    // the per-row serialized HLLs of streaming pre-aggregation merge into the same sketch.
+    ColumnPtr serialized = BinaryColumn::create();
+    func->convert_to_serialize_format(ctx, Columns{column}, column->size(), &serialized);
+    ASSERT_EQ(column->size(), serialized->size());
+    auto merged_state = ManagedAggrState::create(ctx, func);
+    func->merge_batch_single_state(ctx, merged_state->state(), serialized.get(), 0, serialized->size());
+    result = Int64Column::create();
+    func->finalize_to_column(ctx, merged_state->state(), result.get());
+    ASSERT_EQ(estimate, result->get_data()[0]);
+
+    // a single row round-trips through the explicit format.
+    HyperLogLog hll(down_cast<const BinaryColumn*>(serialized.get())->get_slice(0));
+    ASSERT_EQ(1, hll.estimate_cardinality());
+}
+
 TEST_F(AggregateTest, test_decimal_multi_distinct_sum) {
     {
         const auto* func = get_aggregate_function("decimal_multi_distinct_sum", TYPE_DECIMAL32, TYPE_DECIMAL128, false,
@@ -3142,4 +3142,38 @@ TEST_F(DecimalBinaryFunctionTest, test_overflow_report_error) {
                  std::overflow_error);
 }
 
+TEST_F(DecimalBinaryFunctionTest, test_decimal128_mul_overflow_in_batches) {
+    // Batches of small operands are multiplied without checks, and only the batch with large operands
+    // is checked per row.
+    const size_t num_rows = 200;
+    auto lhs = Decimal128Column::create(38, 2, num_rows);
+    auto rhs = Decimal128Column::create(38, 2, num_rows);
+    auto& lhs_data = lhs->get_data();
+    auto& rhs_data = rhs->get_data();
+    for (size_t i = 0; i < num_rows; ++i) {
+        lhs_data[i] = static_cast<int128_t>(i) * (i % 2 == 0 ? 1 : -1) * 1000000007;
+        rhs_data[i] = static_cast<int128_t>(i) + std::numeric_limits<int64_t>::max() / 2;
+    }
+    const auto large = static_cast<int128_t>(1) << 100;
+    lhs_data[70] = large;
+    rhs_data[70] = large;
+    lhs_data[71] = large;
+    rhs_data[71] = 3;
+    rhs_data[72] = -(static_cast<int128_t>(1) << 80);
+
+    auto result = VectorizedStrictDecimalBinaryFunction<MulOp, OverflowMode::OUTPUT_NULL>::evaluate<TYPE_DECIMAL128>(
+            lhs, rhs);
+    ASSERT_TRUE(result->is_nullable());
+    auto* nullable = down_cast<NullableColumn*>(result.get());
+    auto& result_data = down_cast<Decimal128Column*>(nullable->data_column().get())->get_data();
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (i == 70) {
+            ASSERT_TRUE(nullable->is_null(i));
+            continue;
+        }
+        ASSERT_FALSE(nullable->is_null(i)) << i;
+        ASSERT_EQ(lhs_data[i] * rhs_data[i], result_data[i]) << i;
+    }
+}
+
 } // namespace starrocks
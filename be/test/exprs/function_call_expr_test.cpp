@@ -20,6 +20,8 @@
 #include <cmath>
 
 #include "butil/time.h"
+#include "column/binary_column.h"
+#include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "exprs/cast_expr.h"
@@ -307,4 +309,58 @@ TEST_F(VectorizedFunctionCallExprTest, prepare_close) {
     expr_context.close(&_runtime_state);
 }
 
+static TExprNode create_function_call_node(const std::string& name, int64_t fid, TPrimitiveType::type type) {
+    TFunctionName fn_name;
+    fn_name.__set_function_name(name);
+    TFunction fn;
+    fn.__set_name(fn_name);
+    fn.__set_fid(fid);
+    fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+
+    TExprNode node;
+    node.__set_fn(fn);
+    node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+    node.__set_type(gen_type_desc(type));
+    return node;
+}
+
+TEST_F(VectorizedFunctionCallExprTest, common_sub_exprs) {
+    // concat(upper(c1), upper(c1), uuid(), uuid()): upper(c1) is evaluated once, but uuid() must not be shared.
+    ColumnRef col(TypeDescriptor::create_varchar_type(10), 1);
+    VectorizedFunctionCallExpr upper1(create_function_call_node("upper", 30150, TPrimitiveType::VARCHAR));
+    VectorizedFunctionCallExpr upper2(create_function_call_node("upper", 30150, TPrimitiveType::VARCHAR));
+    upper1.add_child(&col);
+    upper2.add_child(&col);
+    VectorizedFunctionCallExpr uuid1(create_function_call_node("uuid", 100015, TPrimitiveType::VARCHAR));
+    VectorizedFunctionCallExpr uuid2(create_function_call_node("uuid", 100015, TPrimitiveType::VARCHAR));
+    VectorizedFunctionCallExpr concat(create_function_call_node("concat", 30250, TPrimitiveType::VARCHAR));
+    concat.add_child(&upper1);
+    concat.add_child(&upper2);
+    concat.add_child(&uuid1);
+    concat.add_child(&uuid2);
+
+    ExprContext context(&concat);
+    ASSERT_OK(context.prepare(&_runtime_state));
+    ASSERT_OK(context.open(&_runtime_state));
+
+    auto chunk = std::make_shared<Chunk>();
+    auto data = BinaryColumn::create();
+    data->append("ab");
+    data->append("cd");
+    chunk->append_column(data, 1);
+
+    for (int i = 0; i < 2; ++i) {
+        ASSIGN_OR_ABORT(auto result, context.evaluate(chunk.get()));
+        ASSERT_EQ(2, result->size());
+        for (int row = 0; row < 2; ++row) {
+            auto value = result->get(row).get_slice().to_string();
+            ASSERT_EQ(row == 0 ? "ABAB" : "CDCD", value.substr(0, 4));
+            auto uuids = value.substr(4);
+            ASSERT_EQ(uuids.size() % 2, 0);
+            ASSERT_NE(uuids.substr(0, uuids.size() / 2), uuids.substr(uuids.size() / 2));
+        }
+    }
+    context.close(&_runtime_state);
+}
+
 } // namespace starrocks
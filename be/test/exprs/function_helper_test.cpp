@@ -118,4 +118,40 @@ TEST_F(FunctionHelperTest, testMergeNotNullableColumnMergeWithNullColumn) {
         }
     }
 }
+
+TEST_F(FunctionHelperTest, testUnionNullableColumn) {
+    auto make_nullable = [](int null_every) {
+        auto column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+        for (int i = 0; i < 100; ++i) {
+            if (null_every > 0 && i % null_every == 0) {
+                column->append_nulls(1);
+            } else {
+                column->append_datum(Datum(i));
+            }
+        }
+        return column;
+    };
+    ColumnPtr no_null = make_nullable(0);
+    ColumnPtr null2 = make_nullable(2);
+    ColumnPtr null3 = make_nullable(3);
+
+    auto check = [](const NullColumnPtr& nulls, int m1, int m2) {
+        ASSERT_EQ(100, nulls->size());
+        for (int i = 0; i < 100; ++i) {
+            bool expect = (m1 > 0 && i % m1 == 0) || (m2 > 0 && i % m2 == 0);
+            ASSERT_EQ(expect, nulls->get_data()[i] != 0) << i;
+        }
+    };
+    check(FunctionHelper::union_nullable_column(no_null, null3), 0, 3);
+    check(FunctionHelper::union_nullable_column(null2, no_null), 2, 0);
+    check(FunctionHelper::union_nullable_column(null2, null3), 2, 3);
+
+    NullColumnPtr produce_nulls = NullColumn::create(100, 0);
+    produce_nulls->get_data()[5] = 1;
+    FunctionHelper::union_produce_nullable_column(no_null, null2, &produce_nulls);
+    ASSERT_EQ(1, produce_nulls->get_data()[5]);
+    produce_nulls->get_data()[5] = 0;
+    check(produce_nulls, 2, 0);
+}
+
 } // namespace starrocks
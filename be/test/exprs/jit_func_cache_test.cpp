@@ -22,6 +22,7 @@
 #include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -200,4 +201,19 @@ TEST_F(JITFunctionCacheTest, cache) {
         }
     }
 }
+TEST_F(JITFunctionCacheTest, hot_threshold) {
+    auto old_threshold = config::jit_compile_hot_threshold;
+    DeferOp defer([&]() { config::jit_compile_hot_threshold = old_threshold; });
+
+    config::jit_compile_hot_threshold = 3;
+    ASSERT_FALSE(engine->count_and_check_hot("hot_threshold_expr"));
+    ASSERT_FALSE(engine->count_and_check_hot("hot_threshold_expr"));
+    ASSERT_TRUE(engine->count_and_check_hot("hot_threshold_expr"));
+    // the counter restarts once the expression is compiled
+    ASSERT_FALSE(engine->count_and_check_hot("hot_threshold_expr"));
+
+    config::jit_compile_hot_threshold = 1;
+    ASSERT_TRUE(engine->count_and_check_hot("hot_threshold_expr"));
+}
+
 } // namespace starrocks
@@ -658,4 +658,29 @@ TEST_F(LikeTest, constValueLikeComplicateForHyperscan) {
                         .ok());
 }
 
+TEST_F(LikeTest, sharedHyperscanPatternLike) {
+    auto str = BinaryColumn::create();
+    for (int j = 0; j < 20; ++j) {
+        str->append("test" + std::to_string(j));
+    }
+    auto pattern = ColumnHelper::create_const_column<TYPE_VARCHAR>("te_t1_", 1);
+    Columns columns{str, pattern};
+
+    // the contexts share the compiled pattern, and it must outlive the contexts closed before.
+    std::vector<std::unique_ptr<FunctionContext>> contexts;
+    for (int i = 0; i < 3; ++i) {
+        auto* context = contexts.emplace_back(FunctionContext::create_test_context()).get();
+        context->set_constant_columns(columns);
+        ASSERT_TRUE(LikePredicate::like_prepare(context, FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+    }
+    for (auto& context : contexts) {
+        auto result = LikePredicate::like(context.get(), columns).value();
+        auto v = ColumnHelper::cast_to<TYPE_BOOLEAN>(result);
+        for (int l = 0; l < 20; ++l) {
+            ASSERT_EQ(l >= 10, v->get_data()[l]) << l;
+        }
+        ASSERT_TRUE(LikePredicate::like_close(context.get(), FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+    }
+}
+
 } // namespace starrocks
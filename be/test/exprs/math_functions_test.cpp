@@ -19,6 +19,7 @@
 
 #include <cmath>
 
+#include "column/array_column.h"
 #include "exprs/mock_vectorized_expr.h"
 
 #define PI acos(-1)
@@ -1492,4 +1493,78 @@ TEST_F(VecMathFunctionsTest, OutputNanTest) {
     }
 }
 
+static ColumnPtr float_arrays(const std::vector<DatumArray>& arrays) {
+    auto column = ColumnHelper::create_column(TypeDescriptor::create_array_type(TypeDescriptor(TYPE_FLOAT)), false);
+    for (const auto& array : arrays) {
+        column->append_datum(array);
+    }
+    return column;
+}
+
+TEST_F(VecMathFunctionsTest, vectorDistanceTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    // Rows of the same dimension, and rows of different dimensions.
+    for (bool fixed_dim : {true, false}) {
+        auto base = fixed_dim ? float_arrays({DatumArray{1.0f, 2.0f}, DatumArray{3.0f, 4.0f}})
+                              : float_arrays({DatumArray{1.0f, 2.0f}, DatumArray{3.0f, 4.0f, 0.0f}});
+        auto target = fixed_dim ? float_arrays({DatumArray{1.0f, 0.0f}, DatumArray{0.0f, 1.0f}})
+                                : float_arrays({DatumArray{1.0f, 0.0f}, DatumArray{0.0f, 1.0f, 0.0f}});
+        Columns columns{base, target};
+
+        auto l2 = MathFunctions::l2_distance<TYPE_FLOAT>(ctx.get(), columns).value();
+        ASSERT_FLOAT_EQ(2.0f, l2->get(0).get_float());
+        ASSERT_FLOAT_EQ(std::sqrt(18.0f), l2->get(1).get_float());
+
+        auto dot = MathFunctions::inner_product<TYPE_FLOAT>(ctx.get(), columns).value();
+        ASSERT_FLOAT_EQ(1.0f, dot->get(0).get_float());
+        ASSERT_FLOAT_EQ(4.0f, dot->get(1).get_float());
+
+        auto cosine = MathFunctions::cosine_similarity<TYPE_FLOAT, false>(ctx.get(), columns).value();
+        ASSERT_FLOAT_EQ(1.0f / std::sqrt(5.0f), cosine->get(0).get_float());
+        ASSERT_FLOAT_EQ(0.8f, cosine->get(1).get_float());
+
+        auto sub = MathFunctions::vector_subtract<TYPE_FLOAT>(ctx.get(), columns).value();
+        ASSERT_EQ(2, sub->size());
+        ASSERT_EQ("[0,2]", sub->debug_item(0));
+    }
+}
+
+TEST_F(VecMathFunctionsTest, vectorDistanceConstTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto base = float_arrays({DatumArray{1.0f, 2.0f}, DatumArray{3.0f, 4.0f}, DatumArray{0.0f, 0.0f}});
+    auto query = ConstColumn::create(float_arrays({DatumArray{1.0f, 1.0f}}), 3);
+    Columns columns{base, query};
+
+    auto dot = MathFunctions::inner_product<TYPE_FLOAT>(ctx.get(), columns).value();
+    ASSERT_EQ(3, dot->size());
+    ASSERT_FLOAT_EQ(3.0f, dot->get(0).get_float());
+    ASSERT_FLOAT_EQ(7.0f, dot->get(1).get_float());
+    ASSERT_FLOAT_EQ(0.0f, dot->get(2).get_float());
+    // The constant argument is not expanded.
+    ASSERT_EQ(1, down_cast<ConstColumn*>(query.get())->data_column()->size());
+
+    auto sum = MathFunctions::vector_add<TYPE_FLOAT>(ctx.get(), columns).value();
+    ASSERT_EQ(3, sum->size());
+    ASSERT_EQ("[2,3]", sum->debug_item(0));
+    ASSERT_EQ("[4,5]", sum->debug_item(1));
+    ASSERT_EQ("[1,1]", sum->debug_item(2));
+}
+
+TEST_F(VecMathFunctionsTest, vectorDistanceInvalidTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    {
+        Columns columns{float_arrays({DatumArray{1.0f, 2.0f}}), float_arrays({DatumArray{1.0f}})};
+        ASSERT_FALSE(MathFunctions::l2_distance<TYPE_FLOAT>(ctx.get(), columns).ok());
+        ASSERT_FALSE(MathFunctions::vector_multiply<TYPE_FLOAT>(ctx.get(), columns).ok());
+    }
+    {
+        Columns columns{float_arrays({DatumArray{}}), float_arrays({DatumArray{}})};
+        ASSERT_FALSE(MathFunctions::inner_product<TYPE_FLOAT>(ctx.get(), columns).ok());
+    }
+    {
+        Columns columns{float_arrays({DatumArray{1.0f, Datum()}}), float_arrays({DatumArray{1.0f, 2.0f}})};
+        ASSERT_FALSE(MathFunctions::cosine_similarity<TYPE_FLOAT, false>(ctx.get(), columns).ok());
+    }
+}
+
 } // namespace starrocks
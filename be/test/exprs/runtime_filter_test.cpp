@@ -89,6 +89,45 @@ TEST_F(RuntimeFilterTest, TestSimdBlockFilterMerge) {
         EXPECT_FALSE(bf2.test_hash(i + 2));
     }
 }
+TEST_F(RuntimeFilterTest, TestSimdBlockFilterFold) {
+    // a sparse filter: 10 hashes in a filter sized for 100000
+    SimdBlockFilter bf0;
+    bf0.init(100000);
+    for (uint64_t i = 1; i <= 10; i++) {
+        bf0.insert_hash(i * 0x9E3779B97F4A7C15ULL);
+    }
+    const size_t full_size = bf0.max_serialized_size();
+    EXPECT_GT(bf0.fold_to_fpp(0.01), 0);
+    EXPECT_LT(bf0.max_serialized_size(), full_size);
+    for (uint64_t i = 1; i <= 10; i++) {
+        EXPECT_TRUE(bf0.test_hash(i * 0x9E3779B97F4A7C15ULL));
+    }
+
+    // serialize the folded filter
+    std::vector<uint8_t> buf(bf0.max_serialized_size(), 0);
+    EXPECT_EQ(bf0.serialize(buf.data()), buf.size());
+    SimdBlockFilter bf1;
+    EXPECT_EQ(bf1.deserialize(buf.data()), buf.size());
+    EXPECT_TRUE(bf0.check_equal(bf1));
+
+    // merge an unfolded filter into the folded one, and the folded one into an unfolded one
+    SimdBlockFilter bf2;
+    bf2.init(100000);
+    for (uint64_t i = 11; i <= 20; i++) {
+        bf2.insert_hash(i * 0x9E3779B97F4A7C15ULL);
+    }
+    SimdBlockFilter bf3;
+    bf3.init(100000);
+    bf3.merge(bf2);
+    bf1.merge(bf2);
+    bf3.merge(bf0);
+    EXPECT_TRUE(bf1.check_equal(bf3));
+    for (uint64_t i = 1; i <= 20; i++) {
+        EXPECT_TRUE(bf1.test_hash(i * 0x9E3779B97F4A7C15ULL));
+        EXPECT_TRUE(bf3.test_hash(i * 0x9E3779B97F4A7C15ULL));
+    }
+}
+
 static std::string alphabet0 =
         "abcdefgh"
         "igklmnop"
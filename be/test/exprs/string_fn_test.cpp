@@ -1422,6 +1422,39 @@ PARALLEL_TEST(VecStringFunctionsTest, utf8LengthChineseTest) {
     }
 }
 
+PARALLEL_TEST(VecStringFunctionsTest, utf8LengthMixedTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto str = BinaryColumn::create();
+    auto null = NullColumn::create();
+    std::vector<int> expects;
+    const std::vector<std::pair<std::string, int>> pieces = {
+            {"a", 1}, {"é", 1}, {"中文", 2}, {"😀", 1}, {"xyz", 3}};
+    // rows of different sizes cross the 64 bytes blocks of the column buffer at different positions.
+    for (int j = 0; j < 200; ++j) {
+        std::string s;
+        int expect = 0;
+        for (int k = 0; k < j % 37; ++k) {
+            const auto& [piece, length] = pieces[(j + k) % pieces.size()];
+            s.append(piece);
+            expect += length;
+        }
+        str->append(s);
+        null->append(j % 7 == 0);
+        expects.push_back(expect);
+    }
+    Columns columns{NullableColumn::create(str, null)};
+
+    ColumnPtr result = StringFunctions::utf8_length(ctx.get(), columns).value();
+    ASSERT_EQ(200, result->size());
+    for (int j = 0; j < 200; ++j) {
+        if (j % 7 == 0) {
+            ASSERT_TRUE(result->is_null(j));
+        } else {
+            ASSERT_EQ(expects[j], result->get(j).get_int32()) << j;
+        }
+    }
+}
+
 PARALLEL_TEST(VecStringFunctionsTest, upperTest) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     Columns columns;
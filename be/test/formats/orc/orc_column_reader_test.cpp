@@ -90,4 +90,69 @@ TEST(OrcColumnReaderTest, TestDateColumn) {
     }
 }
 
+TEST(OrcColumnReaderTest, TestStringColumnFromBatch) {
+    const static size_t batchSize = 5;
+
+    ORC_UNIQUE_PTR<orc::Type> schema(orc::Type::buildTypeFromString("struct<c0:string>"));
+    const orc::Type* orcType = schema->getSubtype(0);
+    const OrcMappingPtr orcMapping = nullptr;
+    OrcChunkReader orcChunkReader(batchSize, {});
+    orcChunkReader.disable_broker_load_mode();
+
+    TypeDescriptor c0Type = TypeDescriptor::create_varchar_type(16);
+    std::unique_ptr<ORCColumnReader> orcColumnReader =
+            ORCColumnReader::create(c0Type, orcType, true, orcMapping, &orcChunkReader).value();
+
+    std::vector<std::string> values = {"abc", "", "defg", "hi", "jklmn"};
+    std::string blob = "abcdefghi";
+    orc::StringVectorBatch batch(batchSize, *orc::getDefaultPool());
+    batch.hasNulls = true;
+    batch.numElements = batchSize;
+
+    // contiguous blob, as produced by direct encoding, copied in one shot.
+    {
+        size_t offset = 0;
+        for (size_t i = 0; i < batchSize - 1; i++) {
+            batch.notNull[i] = (i != 1);
+            batch.length[i] = values[i].size();
+            batch.data[i] = blob.data() + offset;
+            offset += values[i].size();
+        }
+        batch.notNull[4] = 0;
+        batch.length[4] = 0;
+        batch.data[4] = blob.data() + offset;
+
+        ColumnPtr column = ColumnHelper::create_column(c0Type, true);
+        ASSERT_TRUE(orcColumnReader->get_next(&batch, column, 0, batchSize).ok());
+        ASSERT_EQ(batchSize, column->size());
+        EXPECT_EQ("'abc'", column->debug_item(0));
+        EXPECT_EQ("NULL", column->debug_item(1));
+        EXPECT_EQ("'defg'", column->debug_item(2));
+        EXPECT_EQ("'hi'", column->debug_item(3));
+        EXPECT_EQ("NULL", column->debug_item(4));
+
+        // read a sub range starting in the middle of the blob.
+        column = ColumnHelper::create_column(c0Type, true);
+        ASSERT_TRUE(orcColumnReader->get_next(&batch, column, 2, 2).ok());
+        ASSERT_EQ(2, column->size());
+        EXPECT_EQ("'defg'", column->debug_item(0));
+        EXPECT_EQ("'hi'", column->debug_item(1));
+    }
+
+    // values scattered in memory fall back to the per row copy.
+    {
+        for (size_t i = 0; i < batchSize; i++) {
+            batch.notNull[i] = 1;
+            batch.length[i] = values[i].size();
+            batch.data[i] = values[i].data();
+        }
+        ColumnPtr column = ColumnHelper::create_column(c0Type, true);
+        ASSERT_TRUE(orcColumnReader->get_next(&batch, column, 0, batchSize).ok());
+        ASSERT_EQ(batchSize, column->size());
+        for (size_t i = 0; i < batchSize; i++) {
+            EXPECT_EQ("'" + values[i] + "'", column->debug_item(i));
+        }
+    }
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -522,4 +522,81 @@ TEST_F(ParquetEncodingTest, Boolean) {
     }
 }
 
+TEST_F(ParquetEncodingTest, DeltaBinaryPacked) {
+    // multiple blocks with negative deltas, and a padded last mini block
+    std::vector<int32_t> int32_values;
+    std::vector<int64_t> int64_values;
+    for (int i = 0; i < 1000; i++) {
+        int32_values.push_back(i % 7 == 0 ? std::numeric_limits<int32_t>::min() : i * 3 - 500);
+        int64_values.push_back(i % 5 == 0 ? std::numeric_limits<int64_t>::max() : static_cast<int64_t>(i) << 33);
+    }
+
+    const EncodingInfo* int32_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::INT32, tparquet::Encoding::DELTA_BINARY_PACKED, &int32_encoding);
+    ASSERT_TRUE(int32_encoding != nullptr);
+    {
+        std::unique_ptr<Decoder> decoder;
+        auto st = int32_encoding->create_decoder(&decoder);
+        ASSERT_TRUE(st.ok());
+
+        std::unique_ptr<Encoder> encoder;
+        st = int32_encoding->create_encoder(&encoder);
+        ASSERT_TRUE(st.ok());
+
+        st = encoder->append(reinterpret_cast<uint8_t*>(&int32_values[0]), int32_values.size());
+        ASSERT_TRUE(st.ok());
+
+        DecoderChecker<int32_t, false>::check(int32_values, encoder->build(), decoder.get());
+    }
+
+    const EncodingInfo* int64_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::INT64, tparquet::Encoding::DELTA_BINARY_PACKED, &int64_encoding);
+    ASSERT_TRUE(int64_encoding != nullptr);
+    {
+        std::unique_ptr<Decoder> decoder;
+        auto st = int64_encoding->create_decoder(&decoder);
+        ASSERT_TRUE(st.ok());
+
+        std::unique_ptr<Encoder> encoder;
+        st = int64_encoding->create_encoder(&encoder);
+        ASSERT_TRUE(st.ok());
+
+        st = encoder->append(reinterpret_cast<uint8_t*>(&int64_values[0]), int64_values.size());
+        ASSERT_TRUE(st.ok());
+
+        DecoderChecker<int64_t, false>::check(int64_values, encoder->build(), decoder.get());
+    }
+}
+
+TEST_F(ParquetEncodingTest, DeltaByteArray) {
+    std::vector<std::string> values;
+    for (int i = 0; i < 500; i++) {
+        values.push_back("prefix_" + std::to_string(i / 10) + std::string(i % 4, 'x'));
+    }
+
+    std::vector<Slice> slices;
+    for (const auto& value : values) {
+        slices.emplace_back(value);
+    }
+
+    for (auto encoding_type : {tparquet::Encoding::DELTA_LENGTH_BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY}) {
+        const EncodingInfo* encoding = nullptr;
+        EncodingInfo::get(tparquet::Type::BYTE_ARRAY, encoding_type, &encoding);
+        ASSERT_TRUE(encoding != nullptr);
+
+        std::unique_ptr<Decoder> decoder;
+        auto st = encoding->create_decoder(&decoder);
+        ASSERT_TRUE(st.ok());
+
+        std::unique_ptr<Encoder> encoder;
+        st = encoding->create_encoder(&encoder);
+        ASSERT_TRUE(st.ok());
+
+        st = encoder->append(reinterpret_cast<uint8_t*>(&slices[0]), slices.size());
+        ASSERT_TRUE(st.ok());
+
+        DecoderChecker<Slice, false>::check(slices, encoder->build(), decoder.get());
+    }
+}
+
 } // namespace starrocks::parquet
@@ -479,4 +479,66 @@ TEST_F(PageIndexTest, TestTwoColumnIntersectPageIndex) {
     EXPECT_EQ(total_row_nums, 10000);
 }
 
+TEST_F(PageIndexTest, TestSkipPagesOfLazyColumns) {
+    const std::string small_page_file = "./be/test/formats/parquet/test_data/page_index_small_page.parquet";
+
+    // c0: 1->20000, 5000 < c0 < 5100, only evaluated on c0 without page index filter,
+    // so the lazy columns c1 and c2 only need one of their 1000-row pages.
+    auto read_file = [&](int64_t* uncompressed_bytes) {
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(
+                ColumnHelper::create_column(TypeDescriptor::from_logical_type(LogicalType::TYPE_INT), true),
+                chunk->num_columns());
+        chunk->append_column(
+                ColumnHelper::create_column(TypeDescriptor::from_logical_type(LogicalType::TYPE_INT), true),
+                chunk->num_columns());
+        chunk->append_column(
+                ColumnHelper::create_column(TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR), true),
+                chunk->num_columns());
+
+        auto ctx = _create_file_c0_c1_c2_context(small_page_file);
+        auto file = _create_file(small_page_file);
+        ctx->conjunct_ctxs_by_slot[0].clear();
+        ctx->min_max_conjunct_ctxs.clear();
+
+        std::vector<TExpr> t_conjuncts;
+        ParquetUTBase::append_int_conjunct(TExprOpcode::GT, 0, 5000, &t_conjuncts);
+        ParquetUTBase::append_int_conjunct(TExprOpcode::LT, 0, 5100, &t_conjuncts);
+        ParquetUTBase::create_conjunct_ctxs(&_pool, _runtime_state, &t_conjuncts, &ctx->conjunct_ctxs_by_slot[0]);
+
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
+                                                        std::filesystem::file_size(small_page_file), 100000);
+
+        int64_t bytes_before = g_hdfs_scan_stats.request_bytes_read_uncompressed;
+        Status status = file_reader->init(ctx);
+        ASSERT_TRUE(status.ok());
+        size_t total_row_nums = 0;
+        while (!status.is_end_of_file()) {
+            chunk->reset();
+            status = file_reader->get_next(&chunk);
+            ASSERT_TRUE(status.ok() || status.is_end_of_file());
+            chunk->check_or_die();
+            total_row_nums += chunk->num_rows();
+            for (size_t row_index = 0; row_index < chunk->num_rows(); row_index++) {
+                int32_t c0_value = chunk->get_column_by_index(0)->get(row_index).get_int32();
+                EXPECT_EQ(chunk->get_column_by_index(1)->get(row_index).get_int32(), 20001 - c0_value);
+                EXPECT_EQ(chunk->get_column_by_index(2)->is_null(row_index), c0_value % 10 == 0);
+            }
+        }
+        EXPECT_EQ(total_row_nums, 99);
+        *uncompressed_bytes = g_hdfs_scan_stats.request_bytes_read_uncompressed - bytes_before;
+    };
+
+    bool skip_enable = config::parquet_lazy_column_page_skip_enable;
+    int64_t bytes_with_skip = 0;
+    int64_t bytes_without_skip = 0;
+    config::parquet_lazy_column_page_skip_enable = true;
+    read_file(&bytes_with_skip);
+    config::parquet_lazy_column_page_skip_enable = false;
+    read_file(&bytes_without_skip);
+    config::parquet_lazy_column_page_skip_enable = skip_enable;
+
+    EXPECT_LT(bytes_with_skip, bytes_without_skip);
+}
+
 } // namespace starrocks::parquet
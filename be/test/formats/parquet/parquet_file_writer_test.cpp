@@ -33,6 +33,7 @@
 #include "gutil/casts.h"
 #include "runtime/descriptor_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::formats {
 
@@ -987,6 +988,71 @@ TEST_F(ParquetFileWriterTest, TestFlushRowgroupAndCommitDependency) {
     ASSERT_EQ(result.file_statistics.record_count, 4);
 }
 
+TEST_F(ParquetFileWriterTest, TestWriteColumnsInParallel) {
+    auto type_int = TypeDescriptor::from_logical_type(TYPE_INT);
+    auto type_bigint = TypeDescriptor::from_logical_type(TYPE_BIGINT);
+    auto type_struct = TypeDescriptor::from_logical_type(TYPE_STRUCT);
+    type_struct.children = {type_int, type_bigint};
+    type_struct.field_names = {"a", "b"};
+    // The struct has two leaf columns, so the leaf columns of the last field start from 3.
+    std::vector<TypeDescriptor> type_descs{type_int, type_struct, type_bigint};
+
+    auto column_names = _make_type_names(type_descs);
+    auto output_file = _fs.new_writable_file(_file_path).value();
+    auto output_stream = std::make_unique<parquet::ParquetOutputStream>(std::move(output_file));
+    auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+    auto writer_options = std::make_shared<formats::ParquetWriterOptions>();
+    auto executors = PriorityThreadPool("test", 2, 10);
+    auto writer = std::make_unique<formats::ParquetFileWriter>(
+            _file_path, std::move(output_stream), column_names, type_descs, std::move(column_evaluators),
+            TCompressionType::NO_COMPRESSION, writer_options, []() {}, &executors, nullptr);
+    ASSERT_OK(writer->init());
+
+    auto make_int_column = [](const std::vector<int32_t>& values, const std::vector<uint8_t>& nulls) {
+        auto data_column = Int32Column::create();
+        data_column->append_numbers(values.data(), values.size() * sizeof(int32_t));
+        auto null_column = UInt8Column::create();
+        null_column->append_numbers(nulls.data(), nulls.size());
+        return NullableColumn::create(data_column, null_column);
+    };
+    auto make_bigint_column = [](const std::vector<int64_t>& values, const std::vector<uint8_t>& nulls) {
+        auto data_column = Int64Column::create();
+        data_column->append_numbers(values.data(), values.size() * sizeof(int64_t));
+        auto null_column = UInt8Column::create();
+        null_column->append_numbers(nulls.data(), nulls.size());
+        return NullableColumn::create(data_column, null_column);
+    };
+
+    auto chunk = std::make_shared<Chunk>();
+    {
+        chunk->append_column(make_int_column({1, 2, 3, 4}, {0, 1, 0, 0}), chunk->num_columns());
+
+        Columns fields{make_int_column({5, 6, 7, 8}, {0, 0, 1, 0}), make_bigint_column({9, 10, 11, 12}, {1, 0, 0, 0})};
+        auto struct_column = StructColumn::create(fields, type_struct.field_names);
+        auto null_column = UInt8Column::create();
+        std::vector<uint8_t> nulls{0, 0, 0, 1};
+        null_column->append_numbers(nulls.data(), nulls.size());
+        chunk->append_column(NullableColumn::create(struct_column, null_column), chunk->num_columns());
+
+        chunk->append_column(make_bigint_column({13, 14, 15, 16}, {0, 0, 0, 1}), chunk->num_columns());
+    }
+
+    int32_t parallelism = config::parquet_writer_encode_parallelism;
+    config::parquet_writer_encode_parallelism = 3;
+    DeferOp defer([&]() { config::parquet_writer_encode_parallelism = parallelism; });
+
+    ASSERT_TRUE(writer->write(chunk).get().ok());
+    auto result = writer->commit().get();
+
+    ASSERT_TRUE(result.io_status.ok());
+    ASSERT_EQ(result.file_statistics.record_count, 4);
+
+    auto read_chunk = _read_chunk(type_descs);
+    ASSERT_TRUE(read_chunk != nullptr);
+    ASSERT_EQ(read_chunk->num_rows(), 4);
+    parquet::Utils::assert_equal_chunk(chunk.get(), read_chunk.get());
+}
+
 TEST_F(ParquetFileWriterTest, TestWriteWithFieldID) {
     auto type_bool = TypeDescriptor::from_logical_type(TYPE_BOOLEAN);
     std::vector<TypeDescriptor> type_descs{type_bool};
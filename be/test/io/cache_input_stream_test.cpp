@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include "block_cache/block_cache.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "testutil/assert.h"
 
@@ -76,8 +77,17 @@ public:
         }
     }
 
-    void SetUp() override {}
-    void TearDown() override {}
+    // Most cases check the cache right after populating it, so populate every missed block synchronously.
+    void SetUp() override {
+        _old_min_frequency = config::datacache_populate_admission_min_frequency;
+        _old_background_populate = config::datacache_background_populate_enable;
+        config::datacache_populate_admission_min_frequency = 1;
+        config::datacache_background_populate_enable = false;
+    }
+    void TearDown() override {
+        config::datacache_populate_admission_min_frequency = _old_min_frequency;
+        config::datacache_background_populate_enable = _old_background_populate;
+    }
 
     static void read_stream_data(io::SeekableInputStream* stream, int64_t offset, int64_t size, char* data) {
         ASSERT_OK(stream->seek(offset));
@@ -103,6 +113,10 @@ public:
     }
 
     static const int64_t block_size;
+
+private:
+    int32_t _old_min_frequency = 0;
+    bool _old_background_populate = false;
 };
 
 const int64_t CacheInputStreamTest::block_size = 256 * 1024;
@@ -143,6 +157,52 @@ TEST_F(CacheInputStreamTest, test_aligned_read) {
     ASSERT_EQ(stats.read_cache_count, block_count);
 }
 
+TEST_F(CacheInputStreamTest, test_background_populate_with_admission) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+    config::datacache_populate_admission_min_frequency = 2;
+    config::datacache_background_populate_enable = true;
+
+    const int64_t block_count = 3;
+    int64_t data_size = block_size * block_count;
+    char data[data_size + 1];
+    gen_test_data(data, data_size, block_size);
+
+    const std::string file_name = "test_file_background_populate";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data, data_size));
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+    cache_stream.set_enable_populate_cache(true);
+    auto& stats = cache_stream.stats();
+
+    // The blocks missed only once are not populated.
+    for (int i = 0; i < block_count; ++i) {
+        char buffer[block_size];
+        read_stream_data(&cache_stream, i * block_size, block_size, buffer);
+        ASSERT_TRUE(check_data_content(buffer, block_size, 'a' + i));
+    }
+    ASSERT_EQ(stats.write_cache_count, 0);
+    ASSERT_EQ(stats.skip_write_cache_count, block_count);
+
+    // The blocks missed twice are populated in background.
+    for (int i = 0; i < block_count; ++i) {
+        char buffer[block_size];
+        read_stream_data(&cache_stream, i * block_size, block_size, buffer);
+        ASSERT_TRUE(check_data_content(buffer, block_size, 'a' + i));
+    }
+    ASSERT_EQ(stats.read_cache_count, 0);
+    ASSERT_EQ(stats.write_cache_count, block_count);
+    BlockCache::instance()->wait_for_background_writes();
+
+    for (int i = 0; i < block_count; ++i) {
+        char buffer[block_size];
+        read_stream_data(&cache_stream, i * block_size, block_size, buffer);
+        ASSERT_TRUE(check_data_content(buffer, block_size, 'a' + i));
+    }
+    ASSERT_EQ(stats.read_cache_count, block_count);
+}
+
 TEST_F(CacheInputStreamTest, test_random_read) {
     CacheOptions options = cache_options();
     ASSERT_OK(BlockCache::instance()->init(options));
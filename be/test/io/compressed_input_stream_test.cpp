@@ -211,4 +211,34 @@ TEST_F(CompressedInputStreamTest, test_Snappy1) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompressedInputStreamTest, test_async_decompression) {
+    const size_t M1 = 1024 * 1024;
+    const std::string data = random_string(10 * M1 + 7);
+
+    for (size_t read_buff_len : {size_t(1000), M1, 3 * M1}) {
+        auto compressed = std::make_shared<CompressedInputStream>(LZ4F_compress_to_file(data), LZ4F_decompressor());
+        auto f = std::make_shared<AsyncCompressedInputStream>(compressed, 2);
+        std::string decompressed_data;
+        std::string own_buff(read_buff_len, '\0');
+        ASSIGN_OR_ABORT(auto nread, f->read(own_buff.data(), own_buff.size()));
+        while (nread > 0) {
+            decompressed_data.append(own_buff.data(), nread);
+            ASSIGN_OR_ABORT(nread, f->read(own_buff.data(), own_buff.size()));
+        }
+        ASSERT_EQ(data, decompressed_data);
+    }
+
+    // Skip and destroy the stream before it is fully read.
+    {
+        auto compressed = std::make_shared<CompressedInputStream>(LZ4F_compress_to_file(data), LZ4F_decompressor());
+        auto f = std::make_shared<AsyncCompressedInputStream>(compressed, 1);
+        ASSERT_OK(f->skip(M1 + 1));
+        std::string own_buff(10, '\0');
+        ASSIGN_OR_ABORT(auto nread, f->read(own_buff.data(), own_buff.size()));
+        ASSERT_EQ(10, nread);
+        ASSERT_EQ(data.substr(M1 + 1, 10), own_buff);
+    }
+}
+
 } // namespace starrocks::io
@@ -20,6 +20,7 @@
 #include <sys/types.h>
 
 #include <cstdlib>
+#include <vector>
 
 #include "common/logging.h"
 #include "testutil/assert.h"
@@ -181,4 +182,34 @@ PARALLEL_TEST(FdInputStreamTest, test_op_after_close) {
     ASSERT_ERROR(in.close());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(FdInputStreamTest, test_sequential_readahead) {
+    const int64_t K = 1024;
+    int fd = open_temp_file();
+    pwrite_or_die(fd, "0", 1, 1024 * K - 1);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+    std::vector<char> buff(64 * K);
+
+    // Readahead starts after two consecutive sequential reads.
+    ASSERT_EQ(64 * K, *in.read(buff.data(), 64 * K));
+    ASSERT_EQ(64 * K, *in.read(buff.data(), 64 * K));
+    ASSERT_EQ(0, in.readahead_end());
+    ASSERT_EQ(64 * K, *in.read(buff.data(), 64 * K));
+    ASSERT_EQ(192 * K + 128 * K, in.readahead_end());
+
+    // The window doubles once the reads reach the second half of the advised range.
+    ASSERT_EQ(64 * K, *in.read(buff.data(), 64 * K));
+    ASSERT_EQ(256 * K + 256 * K, in.readahead_end());
+    ASSERT_EQ(64 * K, *in.read(buff.data(), 64 * K));
+    ASSERT_EQ(512 * K, in.readahead_end());
+
+    // A random read resets the detector.
+    ASSERT_EQ(64 * K, *in.read_at(900 * K, buff.data(), 64 * K));
+    ASSERT_EQ(0, in.readahead_end());
+    ASSERT_EQ(60 * K, *in.read_at(964 * K, buff.data(), 64 * K));
+    ASSERT_EQ(0, in.readahead_end());
+}
+
 } // namespace starrocks::io
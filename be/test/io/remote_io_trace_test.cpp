@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/remote_io_trace.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::io {
+
+TEST(RemoteIOTraceTest, test_record_in_scope) {
+    RemoteIOTrace trace;
+    // Not recorded without a scope.
+    RemoteIOTrace::record(RemoteIOTrace::S3, 100, 100);
+    ASSERT_TRUE(trace.empty());
+
+    {
+        RemoteIOTrace::Scope scope(&trace);
+        RemoteIOTrace::record(RemoteIOTrace::S3, 1000, 500 * 1000);
+        RemoteIOTrace::record(RemoteIOTrace::S3, 5 * 1024 * 1024, 10 * 1000 * 1000, 2);
+        RemoteIOTrace::record(RemoteIOTrace::S3, 0, 10L * 1000 * 1000 * 1000, 0, true);
+        {
+            RemoteIOTrace::Scope disabled(nullptr);
+            RemoteIOTrace::record(RemoteIOTrace::S3, 100, 100);
+        }
+        RemoteIOTrace::record(RemoteIOTrace::DATACACHE, 64 * 1024, 1000);
+    }
+    RemoteIOTrace::record(RemoteIOTrace::S3, 100, 100);
+
+    const auto& s3 = trace.stats(RemoteIOTrace::S3);
+    ASSERT_EQ(3, s3.requests);
+    ASSERT_EQ(1000 + 5 * 1024 * 1024, s3.bytes);
+    ASSERT_EQ(2, s3.extra_requests);
+    ASSERT_EQ(1, s3.failures);
+    ASSERT_EQ(2, s3.size_histogram[0]);
+    ASSERT_EQ(1, s3.size_histogram[6]);
+    ASSERT_EQ(1, s3.latency_histogram[0]);
+    ASSERT_EQ(1, s3.latency_histogram[2]);
+    ASSERT_EQ(1, s3.latency_histogram[RemoteIOTrace::kNumBuckets - 1]);
+
+    const auto& cache = trace.stats(RemoteIOTrace::DATACACHE);
+    ASSERT_EQ(1, cache.requests);
+    ASSERT_EQ(1, cache.size_histogram[3]);
+    ASSERT_EQ(0, trace.stats(RemoteIOTrace::STARLET).requests);
+
+    trace.reset();
+    ASSERT_TRUE(trace.empty());
+}
+
+TEST(RemoteIOTraceTest, test_bucket_names) {
+    ASSERT_STREQ("0_4KB", RemoteIOTrace::size_bucket_name(0));
+    ASSERT_STREQ("16MB_", RemoteIOTrace::size_bucket_name(RemoteIOTrace::kNumBuckets - 1));
+    ASSERT_STREQ("0_1ms", RemoteIOTrace::latency_bucket_name(0));
+    ASSERT_STREQ("4s_", RemoteIOTrace::latency_bucket_name(RemoteIOTrace::kNumBuckets - 1));
+    ASSERT_STREQ("S3", RemoteIOTrace::source_name(RemoteIOTrace::S3));
+}
+
+} // namespace starrocks::io
@@ -27,6 +27,7 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -204,4 +205,25 @@ TEST_F(S3InputStreamTest, test_read_all) {
     EXPECT_EQ(kObjectContent, s);
 }
 
+TEST_F(S3InputStreamTest, test_parallel_read) {
+    auto old_min_size = config::s3_parallel_read_min_size;
+    auto old_part_size = config::s3_read_part_size;
+    DeferOp defer([&]() {
+        config::s3_parallel_read_min_size = old_min_size;
+        config::s3_read_part_size = old_part_size;
+    });
+    config::s3_parallel_read_min_size = 4;
+    config::s3_read_part_size = 3;
+
+    auto f = new_random_access_file();
+    char buf[8];
+    ASSIGN_OR_ABORT(auto r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ("01234567", std::string_view(buf, r));
+    ASSERT_EQ(8, *f->position());
+
+    ASSIGN_OR_ABORT(r, f->read_at(5, buf, sizeof(buf)));
+    ASSERT_EQ("56789", std::string_view(buf, r));
+    ASSERT_EQ(10, *f->position());
+}
+
 } // namespace starrocks::io
@@ -27,6 +27,7 @@
 #include "common/logging.h"
 #include "io/s3_input_stream.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -154,6 +155,33 @@ TEST_F(S3OutputStreamTest, test_multipart_upload) {
     delete_object(kObjectName);
 }
 
+TEST_F(S3OutputStreamTest, test_parallel_multipart_upload) {
+    auto old_inflight_parts = config::s3_upload_max_inflight_parts;
+    DeferOp defer([&]() { config::s3_upload_max_inflight_parts = old_inflight_parts; });
+    config::s3_upload_max_inflight_parts = 4;
+
+    const char* kObjectName = "test_parallel_multipart_upload";
+    delete_object(kObjectName);
+    const int64_t part_size = 5 * 1024 * 1024;
+    S3OutputStream os(g_s3client, kBucketName, kObjectName, part_size, part_size);
+    S3InputStream is(g_s3client, kBucketName, kObjectName);
+
+    // 6 parts, the last one is smaller than part_size
+    std::string expected;
+    for (int i = 0; i < 11; i++) {
+        std::string s(part_size / 2, 'a' + i);
+        expected.append(s);
+        ASSERT_OK(os.write(s.data(), s.size()));
+    }
+    ASSERT_OK(os.close());
+
+    ASSIGN_OR_ABORT(auto content, is.read_all());
+    ASSERT_EQ(expected.size(), content.size());
+    ASSERT_TRUE(expected == content);
+
+    delete_object(kObjectName);
+}
+
 TEST_F(S3OutputStreamTest, test_skip) {
     char buff[32];
     const char* kObjectName = "test_multipart_upload";
@@ -19,6 +19,7 @@
 #include "io_test_base.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -179,4 +180,39 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
-} // namespace starrocks::io
\ No newline at end of file
+} // namespace starrocks::io
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_prefetch) {
+    size_t len = 1 * 1024 * 1024; // 1MB
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    sb_stream->set_coalesce_options({.max_dist_size = 1024, .max_buffer_size = 64 * 1024});
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("prefetch").set_max_threads(2).build(&pool));
+
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    ranges.emplace_back(0, 16 * 1024);
+    ranges.emplace_back(256 * 1024, 16 * 1024);
+    ranges.emplace_back(512 * 1024, 16 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+
+    // no prefetch pool
+    ASSERT_OK(sb_stream->prefetch(0, len));
+    ASSERT_EQ(0, sb_stream->prefetch_count());
+
+    sb_stream->set_prefetch_pool(pool.get());
+    ASSERT_OK(sb_stream->prefetch(0, 300 * 1024));
+    ASSERT_EQ(2, sb_stream->prefetch_count());
+    // being prefetched or already read
+    ASSERT_OK(sb_stream->prefetch(0, len));
+    ASSERT_EQ(3, sb_stream->prefetch_count());
+    ASSERT_EQ(48 * 1024, sb_stream->prefetch_bytes());
+
+    std::string buf(1024, '\0');
+    for (const auto& r : ranges) {
+        ASSERT_OK(sb_stream->read_at_fully(r.offset + 100, buf.data(), buf.size()));
+        ASSERT_EQ(rand_string.substr(r.offset + 100, buf.size()), buf);
+    }
+    ASSERT_EQ(3, sb_stream->shared_io_count());
+    ASSERT_EQ(0, sb_stream->direct_io_count());
+}
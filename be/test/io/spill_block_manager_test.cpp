@@ -160,6 +160,38 @@ TEST_F(SpillBlockManagerTest, dir_choose_strategy) {
     }
 }
 
+TEST_F(SpillBlockManagerTest, dir_stripe_by_writers) {
+    TUniqueId dummy_query_id = generate_uuid();
+    auto dir1 = create_spill_dir(generate_spill_path(dummy_query_id, "dir1"), 1000);
+    auto dir2 = create_spill_dir(generate_spill_path(dummy_query_id, "dir2"), 100);
+    ASSERT_OK(FileSystem::Default()->create_dir_recursive(dir1->dir()));
+    ASSERT_OK(FileSystem::Default()->create_dir_recursive(dir2->dir()));
+    auto dir_mgr = create_spill_dir_manager({dir1, dir2});
+    auto log_block_mgr = std::make_shared<spill::LogBlockManager>(dummy_query_id, dir_mgr.get());
+    ASSERT_OK(log_block_mgr->open());
+
+    spill::AcquireBlockOptions opts{.query_id = dummy_query_id,
+                                    .fragment_instance_id = dummy_query_id,
+                                    .plan_node_id = 1,
+                                    .name = "node1",
+                                    .block_size = 10};
+    // dir1 has more free space
+    ASSIGN_OR_ABORT(auto block1, log_block_mgr->acquire_block(opts));
+    ASSERT_EQ(1, dir1->num_writers());
+    // dir1 is being written, so dir2 is chosen although it has less free space
+    ASSIGN_OR_ABORT(auto block2, log_block_mgr->acquire_block(opts));
+    ASSERT_EQ(1, dir2->num_writers());
+    ASSERT_OK(log_block_mgr->release_block(block1));
+    ASSERT_EQ(0, dir1->num_writers());
+    // dir1 is idle again
+    ASSIGN_OR_ABORT(auto block3, log_block_mgr->acquire_block(opts));
+    ASSERT_EQ(1, dir1->num_writers());
+    ASSERT_OK(log_block_mgr->release_block(block2));
+    ASSERT_OK(log_block_mgr->release_block(block3));
+    ASSERT_EQ(0, dir1->num_writers());
+    ASSERT_EQ(0, dir2->num_writers());
+}
+
 TEST_F(SpillBlockManagerTest, log_block_allocation_test) {
     auto log_block_mgr = std::make_shared<spill::LogBlockManager>(dummy_query_id, local_dir_mgr.get());
     ASSERT_OK(log_block_mgr->open());
@@ -323,4 +355,45 @@ TEST_F(SpillBlockManagerTest, hybird_block_allocation_test) {
         ASSERT_EQ(block->debug_string(), expected);
     }
 }
+
+TEST_F(SpillBlockManagerTest, block_read_ahead_test) {
+    auto log_block_mgr = std::make_shared<spill::LogBlockManager>(dummy_query_id, local_dir_mgr.get());
+    ASSERT_OK(log_block_mgr->open());
+
+    spill::AcquireBlockOptions opts{.query_id = dummy_query_id,
+                                    .fragment_instance_id = dummy_query_id,
+                                    .plan_node_id = 1,
+                                    .name = "node1",
+                                    .block_size = 10};
+    auto res = log_block_mgr->acquire_block(opts);
+    ASSERT_TRUE(res.ok());
+    auto block = res.value();
+
+    std::string data(3 * 1024 * 1024 + 17, 0);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i % 251);
+    }
+    ASSERT_OK(block->append({Slice(data)}));
+    ASSERT_OK(block->flush());
+
+    for (int64_t read_ahead_bytes : {0L, 4096L, 1024L * 1024}) {
+        config::spill_read_ahead_bytes = read_ahead_bytes;
+        auto reader = block->get_reader();
+        std::string restored;
+        // mix small reads served by the buffer and large reads bypassing it
+        size_t sizes[] = {12, 100, 5000, 2 * 1024 * 1024, 1};
+        size_t k = 0;
+        while (restored.size() < data.size()) {
+            size_t n = std::min(sizes[k++ % std::size(sizes)], data.size() - restored.size());
+            std::string buf(n, 0);
+            ASSERT_OK(reader->read_fully(buf.data(), n));
+            restored += buf;
+        }
+        ASSERT_EQ(data, restored);
+        char c;
+        ASSERT_TRUE(reader->read_fully(&c, 1).is_end_of_file());
+    }
+    config::spill_read_ahead_bytes = 1024 * 1024;
+    ASSERT_OK(log_block_mgr->release_block(block));
+}
 } // namespace starrocks::vectorized
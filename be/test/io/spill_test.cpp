@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <chrono>
 #include <filesystem>
+#include <functional>
 #include <future>
 #include <iterator>
 #include <memory>
@@ -41,6 +42,7 @@
 #include "exec/spill/executor.h"
 #include "exec/spill/log_block_manager.h"
 #include "exec/spill/mem_table.h"
+#include "exec/spill/process_spill_arbitrator.h"
 #include "exec/spill/spill_components.h"
 #include "exec/spill/spiller.h"
 #include "exec/spill/spiller.hpp"
@@ -421,6 +423,84 @@ TEST_F(SpillTest, unsorted_process) {
     }
 }
 
+TEST_F(SpillTest, compressed_column_serde) {
+    ObjectPool pool;
+
+    TExprBuilder order_by_slots_builder;
+    order_by_slots_builder << TYPE_INT;
+    auto order_by_slots = order_by_slots_builder.get_res();
+    std::vector<bool> nullables = {false, true, true};
+    TExprBuilder tuple_slots_builder;
+    tuple_slots_builder << TYPE_INT << TYPE_BIGINT << TYPE_VARCHAR;
+    auto tuple_slots = tuple_slots_builder.get_res();
+
+    auto ctx_st = no_partition_context(&pool, &dummy_rt_st, order_by_slots, tuple_slots);
+    ASSERT_OK(ctx_st.status());
+    auto ctx = ctx_st.value();
+    auto& tuple = ctx->sort_exprs.sort_tuple_slot_expr_ctxs();
+
+    RandomChunkBuilder chunk_builder;
+    auto factory = spill::make_spilled_factory();
+
+    SpilledOptions spill_options;
+    spill_options.mem_table_pool_size = 1;
+    spill_options.spill_mem_table_bytes_size = 1;
+    spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN_COMPRESSED;
+    spill_options.block_manager = dummy_block_mgr.get();
+
+    auto spiller = factory->create(spill_options);
+    spiller->set_metrics(metrics);
+    SpillerCaller<spill::RawSpillerWriter*, spill::SpillerReader*> caller(spiller.get());
+    ASSERT_OK(spiller->prepare(&dummy_rt_st));
+
+    // more chunks than the sampling window so that both sampled and unsampled chunks are written
+    size_t test_loop = 16;
+    std::vector<ChunkPtr> holder;
+    for (size_t i = 0; i < test_loop; ++i) {
+        auto chunk = chunk_builder.gen(tuple, nullables);
+        ASSERT_OK(caller.spill<SyncExecutor>(&dummy_rt_st, chunk, EmptyMemGuard{}));
+        ASSERT_OK(spiller->_spilled_task_status);
+        holder.push_back(chunk);
+    }
+    ASSERT_OK(caller.flush<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+
+    std::vector<ChunkPtr> restored;
+    ASSERT_OK(caller.trigger_restore<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+    while (true) {
+        auto chunk_st = caller.restore<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{});
+        if (chunk_st.status().is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(chunk_st.status());
+        ASSERT_OK(spiller->_spilled_task_status);
+        if (chunk_st.value() != nullptr) {
+            restored.emplace_back(std::move(chunk_st.value()));
+        }
+    }
+
+    size_t input_rows = 0;
+    for (const auto& chunk : holder) {
+        input_rows += chunk->num_rows();
+    }
+    size_t output_rows = 0;
+    for (const auto& chunk : restored) {
+        output_rows += chunk->num_rows();
+    }
+    ASSERT_EQ(input_rows, output_rows);
+
+    auto input = holder[0]->clone_empty();
+    for (const auto& chunk : holder) {
+        input->append(*chunk);
+    }
+    auto output = holder[0]->clone_empty();
+    for (const auto& chunk : restored) {
+        output->append(*chunk);
+    }
+    for (size_t i = 0; i < input_rows; ++i) {
+        ASSERT_EQ(input->debug_row(i), output->debug_row(i));
+    }
+}
+
 TEST_F(SpillTest, order_by_process) {
     ObjectPool pool;
     // order by id_int
@@ -560,6 +640,102 @@ TEST_F(SpillTest, partition_process) {
     }
 }
 
+TEST_F(SpillTest, partition_split_mixed_hashes) {
+    ObjectPool pool;
+
+    std::vector<bool> nullables = {false};
+    TExprBuilder tuple_slots_builder;
+    tuple_slots_builder << TYPE_INT;
+    auto tuple_slots = tuple_slots_builder.get_res();
+
+    std::vector<ExprContext*> tuple;
+    ASSERT_OK(Expr::create_expr_trees(&pool, tuple_slots, &tuple, &dummy_rt_st));
+
+    RandomChunkBuilder chunk_builder;
+    auto factory = spill::make_spilled_factory();
+
+    // 4 partitions at level 2
+    SpilledOptions spill_options(4);
+    spill_options.mem_table_pool_size = 1;
+    spill_options.spill_mem_table_bytes_size = 1 * 1024 * 1024;
+    spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+    spill_options.block_manager = dummy_block_mgr.get();
+
+    auto spiller = factory->create(spill_options);
+    spiller->set_metrics(metrics);
+    ASSERT_OK(spiller->prepare(&dummy_rt_st));
+
+    auto max_level = [&]() {
+        auto writer = spiller->writer()->as<spill::PartitionedSpillerWriter*>();
+        return writer->level_to_partitions().rbegin()->first;
+    };
+    auto spill_chunk = [&](const std::function<uint32_t(size_t)>& hash_of) {
+        auto chunk = chunk_builder.gen(tuple, nullables);
+        auto hash_column = spill::SpillHashColumn::create(chunk->num_rows());
+        auto& hashes = hash_column->get_data();
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            hashes[i] = hash_of(i);
+        }
+        chunk->append_column(std::move(hash_column), -1);
+        ASSERT_OK(spiller->spill<SyncExecutor>(&dummy_rt_st, chunk, EmptyMemGuard{}));
+        ASSERT_OK(spiller->_spilled_task_status);
+    };
+
+    // a single hot key: partition 0 splits once, and its child at level 3 holds a single hash value
+    for (size_t i = 0; i < 1024 && max_level() < 3; ++i) {
+        spill_chunk([](size_t) { return 0; });
+    }
+    ASSERT_EQ(3, max_level());
+    spill_chunk([](size_t) { return 0; });
+    ASSERT_EQ(3, max_level());
+
+    // rows of another key spilled into the same partition must make it splittable again
+    for (size_t i = 0; i < 1024 && max_level() < 4; ++i) {
+        spill_chunk([](size_t row) { return row % 2 == 0 ? 0 : 8; });
+    }
+    ASSERT_EQ(4, max_level());
+    ASSERT_OK(spiller->flush<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+}
+
+TEST_F(SpillTest, process_spill_arbitrator) {
+    using spill::ProcessSpillArbitrator;
+    auto old_ratio = config::spill_process_mem_soft_limit_ratio;
+    DeferOp defer([&]() { config::spill_process_mem_soft_limit_ratio = old_ratio; });
+    config::spill_process_mem_soft_limit_ratio = 0.9;
+
+    const int64_t limit = 1000;
+    const int64_t min_bytes = 10;
+    // below the soft limit nothing spills
+    ASSERT_EQ(-1, ProcessSpillArbitrator::spill_bar_bytes(899, limit, min_bytes));
+    ASSERT_FALSE(ProcessSpillArbitrator::should_spill(899, limit, 1000, min_bytes));
+    // at the soft limit only an operator holding the whole headroom spills
+    ASSERT_EQ(100, ProcessSpillArbitrator::spill_bar_bytes(900, limit, min_bytes));
+    ASSERT_TRUE(ProcessSpillArbitrator::should_spill(900, limit, 100, min_bytes));
+    ASSERT_FALSE(ProcessSpillArbitrator::should_spill(900, limit, 99, min_bytes));
+    // the bar falls as the consumption grows, but not below min_bytes
+    ASSERT_EQ(50, ProcessSpillArbitrator::spill_bar_bytes(950, limit, min_bytes));
+    ASSERT_EQ(min_bytes, ProcessSpillArbitrator::spill_bar_bytes(995, limit, min_bytes));
+    ASSERT_EQ(min_bytes, ProcessSpillArbitrator::spill_bar_bytes(1200, limit, min_bytes));
+    ASSERT_FALSE(ProcessSpillArbitrator::should_spill(1200, limit, 0, min_bytes));
+    // disabled
+    config::spill_process_mem_soft_limit_ratio = 0;
+    ASSERT_EQ(-1, ProcessSpillArbitrator::spill_bar_bytes(1200, limit, min_bytes));
+    ASSERT_EQ(-1, ProcessSpillArbitrator::spill_bar_bytes(1200, -1, min_bytes));
+}
+
+TEST_F(SpillTest, spilled_partition_single_hash) {
+    spill::SpilledPartition partition(1);
+    ASSERT_FALSE(partition.single_hash());
+    std::vector<uint32_t> hashes = {7, 3, 7, 7, 9};
+    std::vector<uint32_t> selection = {0, 2, 3, 1, 4};
+    partition.observe_hashes(hashes.data(), selection.data(), 0, 3);
+    ASSERT_TRUE(partition.single_hash());
+    partition.observe_hashes(hashes.data(), selection.data(), 3, 0);
+    ASSERT_TRUE(partition.single_hash());
+    partition.observe_hashes(hashes.data(), selection.data(), 3, 1);
+    ASSERT_FALSE(partition.single_hash());
+}
+
 TEST_F(SpillTest, aligned_buffer) {
     spill::AlignedBuffer buffer;
     ASSERT_EQ(buffer.data(), nullptr);
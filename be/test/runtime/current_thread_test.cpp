@@ -0,0 +1,48 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/current_thread.h"
+
+#include <gtest/gtest.h>
+
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+TEST(CurrentThreadTest, release_is_kept_as_credit) {
+    constexpr int64_t kBlockSize = 3 * 1024 * 1024;
+    MemTracker tracker(-1, "current_thread_test");
+    auto& current = CurrentThread::current();
+    auto* prev = current.set_mem_tracker(&tracker);
+    const int64_t initial = tracker.consumption();
+
+    current.mem_consume(kBlockSize);
+    const int64_t consumed = tracker.consumption();
+    current.mem_release(kBlockSize);
+    const int64_t released = tracker.consumption();
+    current.mem_consume(kBlockSize);
+    const int64_t consumed_again = tracker.consumption();
+    current.mem_release(kBlockSize);
+
+    // Committed exactly on the context shift.
+    current.set_mem_tracker(prev);
+    const int64_t reconciled = tracker.consumption();
+
+    ASSERT_GE(consumed, kBlockSize);
+    ASSERT_EQ(consumed, released);
+    ASSERT_EQ(consumed, consumed_again);
+    ASSERT_EQ(initial, reconciled);
+}
+
+} // namespace starrocks
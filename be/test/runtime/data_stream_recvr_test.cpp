@@ -0,0 +1,253 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/data_stream_recvr.h"
+
+#include <google/protobuf/stubs/common.h>
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "gen_cpp/internal_service.pb.h"
+#include "runtime/data_stream_mgr.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "runtime/sender_queue.h"
+#include "serde/protobuf_serde.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+class CountingClosure : public google::protobuf::Closure {
+public:
+    void Run() override { ++num_runs; }
+
+    int num_runs = 0;
+};
+
+class DataStreamRecvrTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.__set_batch_size(kChunkSize);
+        query_options.__set_transmission_encode_level(0);
+        TQueryGlobals query_globals;
+        _state = std::make_shared<RuntimeState>(TUniqueId(), query_options, query_globals, nullptr);
+        _state->init_instance_mem_tracker();
+
+        TDescriptorTableBuilder desc_builder;
+        TTupleDescriptorBuilder tuple_builder;
+        tuple_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_INT).column_name("c0").column_pos(0).nullable(false).build());
+        tuple_builder.build(&desc_builder);
+        DescriptorTbl* tbl = nullptr;
+        ASSERT_OK(DescriptorTbl::create(_state.get(), &_pool, desc_builder.desc_tbl(), &tbl, kChunkSize));
+        _row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{false});
+        _slot_id = _row_desc->tuple_descriptors()[0]->slots()[0]->id();
+
+        _mgr.prepare_pass_through_chunk_buffer(_state->query_id());
+    }
+
+    void TearDown() override {
+        for (auto& recvr : _recvrs) {
+            recvr->close();
+        }
+        _recvrs.clear();
+        _recvr.reset();
+        _mgr.destroy_pass_through_chunk_buffer(_state->query_id());
+    }
+
+    static TUniqueId instance_id(int64_t lo) {
+        TUniqueId id;
+        id.__set_hi(1);
+        id.__set_lo(lo);
+        return id;
+    }
+
+    std::shared_ptr<DataStreamRecvr> create_recvr(int buffer_size, int64_t instance_lo = 0) {
+        auto recvr = _mgr.create_recvr(_state.get(), *_row_desc, instance_id(instance_lo), kNodeId, 1, buffer_size,
+                                       false, nullptr, true, kDop, false);
+        for (int32_t i = 0; i < kDop; i++) {
+            recvr->bind_profile(i, std::make_shared<RuntimeProfile>("driver" + std::to_string(i)));
+        }
+        _recvrs.emplace_back(recvr);
+        return recvr;
+    }
+
+    ChunkPB serialize_chunk(int32_t first_row) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < kRowsPerChunk; i++) {
+            column->append(first_row + i);
+        }
+        Chunk chunk;
+        chunk.append_column(std::move(column), _slot_id);
+        auto res = serde::ProtobufChunkSerde::serialize(chunk);
+        CHECK(res.ok()) << res.status();
+        return std::move(res).value();
+    }
+
+    // One pipeline level shuffled request with a chunk of kRowsPerChunk rows for each of the driver sequences,
+    // the rows of all the chunks are numbered consecutively.
+    PTransmitChunkParams create_request(const std::vector<int32_t>& driver_sequences, int64_t instance_lo = 0) {
+        PTransmitChunkParams request;
+        request.mutable_finst_id()->set_hi(1);
+        request.mutable_finst_id()->set_lo(instance_lo);
+        request.set_node_id(kNodeId);
+        request.set_sender_id(0);
+        request.set_be_number(0);
+        request.set_sequence(0);
+        request.set_eos(false);
+        request.set_is_pipeline_level_shuffle(true);
+        for (size_t i = 0; i < driver_sequences.size(); i++) {
+            *request.add_chunks() = serialize_chunk(i * kRowsPerChunk);
+            request.add_driver_sequences(driver_sequences[i]);
+        }
+        return request;
+    }
+
+    // The rows of the chunks that a driver gets from the receiver, in order.
+    std::vector<std::string> get_chunks(int32_t driver_sequence) { return get_chunks(_recvr.get(), driver_sequence); }
+
+    std::vector<std::string> get_chunks(DataStreamRecvr* recvr, int32_t driver_sequence) {
+        std::vector<std::string> res;
+        while (true) {
+            std::unique_ptr<Chunk> chunk;
+            CHECK_OK(recvr->get_chunk_for_pipeline(&chunk, driver_sequence));
+            if (chunk == nullptr) {
+                break;
+            }
+            res.emplace_back(chunk->get_column_by_slot_id(_slot_id)->debug_string());
+        }
+        return res;
+    }
+
+    int64_t num_merged_chunks() const {
+        int64_t res = 0;
+        for (const auto& metrics : _recvr->_metrics) {
+            res += metrics.merged_chunk_counter->value();
+        }
+        return res;
+    }
+
+    static constexpr int32_t kChunkSize = 5;
+    static constexpr int32_t kRowsPerChunk = 2;
+    static constexpr int32_t kDop = 2;
+    static constexpr PlanNodeId kNodeId = 1;
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _state;
+    std::unique_ptr<RowDescriptor> _row_desc;
+    SlotId _slot_id = 0;
+    DataStreamMgr _mgr;
+    std::vector<std::shared_ptr<DataStreamRecvr>> _recvrs;
+    std::shared_ptr<DataStreamRecvr> _recvr;
+};
+
+TEST_F(DataStreamRecvrTest, merge_small_chunks_by_driver_sequence) {
+    bool old_eager_deserialize = config::exchange_receiver_eager_deserialize;
+    config::exchange_receiver_eager_deserialize = true;
+    DeferOp defer([&]() { config::exchange_receiver_eager_deserialize = old_eager_deserialize; });
+
+    _recvr = create_recvr(1024 * 1024);
+    CountingClosure closure;
+    google::protobuf::Closure* done = &closure;
+    ASSERT_OK(_recvr->add_chunks(create_request({0, 0, 0, 1, 0}), &done));
+    // The buffer has room for the request, so the sender is not blocked.
+    ASSERT_EQ(&closure, done);
+
+    // Only the consecutive chunks of the same driver sequence are merged, up to chunk_size rows.
+    std::vector<std::string> expected0 = {"[0, 1, 2, 3]", "[4, 5]", "[8, 9]"};
+    ASSERT_EQ(expected0, get_chunks(0));
+    std::vector<std::string> expected1 = {"[6, 7]"};
+    ASSERT_EQ(expected1, get_chunks(1));
+    ASSERT_EQ(1, num_merged_chunks());
+    ASSERT_EQ(0, _recvr->_num_buffered_bytes.load());
+    ASSERT_EQ(0, closure.num_runs);
+}
+
+TEST_F(DataStreamRecvrTest, lazy_deserialization_beyond_buffer_limit) {
+    bool old_eager_deserialize = config::exchange_receiver_eager_deserialize;
+    config::exchange_receiver_eager_deserialize = true;
+    DeferOp defer([&]() { config::exchange_receiver_eager_deserialize = old_eager_deserialize; });
+
+    // The request doesn't fit in the buffer, so its chunks stay serialized and are not merged.
+    _recvr = create_recvr(1);
+    CountingClosure closure;
+    google::protobuf::Closure* done = &closure;
+    ASSERT_OK(_recvr->add_chunks(create_request({0, 0, 0, 1, 0}), &done));
+    // The sender is blocked until the last chunk of the request is consumed.
+    ASSERT_EQ(nullptr, done);
+
+    std::vector<std::string> expected1 = {"[6, 7]"};
+    ASSERT_EQ(expected1, get_chunks(1));
+    ASSERT_EQ(0, closure.num_runs);
+    std::vector<std::string> expected0 = {"[0, 1]", "[2, 3]", "[4, 5]", "[8, 9]"};
+    ASSERT_EQ(expected0, get_chunks(0));
+    ASSERT_EQ(1, closure.num_runs);
+    ASSERT_EQ(0, num_merged_chunks());
+    ASSERT_EQ(0, _recvr->_num_buffered_bytes.load());
+}
+
+TEST_F(DataStreamRecvrTest, lazy_deserialization_by_default) {
+    ASSERT_FALSE(config::exchange_receiver_eager_deserialize);
+
+    _recvr = create_recvr(1024 * 1024);
+    CountingClosure closure;
+    google::protobuf::Closure* done = &closure;
+    ASSERT_OK(_recvr->add_chunks(create_request({0, 0, 1}), &done));
+    ASSERT_EQ(&closure, done);
+
+    std::vector<std::string> expected0 = {"[0, 1]", "[2, 3]"};
+    ASSERT_EQ(expected0, get_chunks(0));
+    std::vector<std::string> expected1 = {"[4, 5]"};
+    ASSERT_EQ(expected1, get_chunks(1));
+    ASSERT_EQ(0, num_merged_chunks());
+}
+
+TEST_F(DataStreamRecvrTest, transmit_coalesced_chunks) {
+    // The receiver of instance 1 holds the closure, and the request of instance 3 has no chunk meta.
+    auto recvr1 = create_recvr(1, 1);
+    auto recvr2 = create_recvr(1024 * 1024, 2);
+    auto recvr3 = create_recvr(1024 * 1024, 3);
+    PTransmitChunkParams request = create_request({0, 1}, 1);
+    *request.add_coalesced_requests() = create_request({0}, 2);
+    PTransmitChunkParams request3 = create_request({1}, 3);
+    request3.mutable_chunks(0)->clear_is_nulls();
+    request3.mutable_chunks(0)->clear_slot_id_map();
+    *request.add_coalesced_requests() = std::move(request3);
+
+    CountingClosure closure;
+    google::protobuf::Closure* done = &closure;
+    auto st = _mgr.transmit_coalesced_chunks(request, &done);
+    // The first error is returned, and the other requests are still delivered.
+    ASSERT_TRUE(st.is_internal_error()) << st;
+    ASSERT_NE(&closure, done);
+    std::vector<std::string> expected2 = {"[0, 1]"};
+    ASSERT_EQ(expected2, get_chunks(recvr2.get(), 0));
+    ASSERT_TRUE(get_chunks(recvr3.get(), 1).empty());
+
+    // The rpc is replied once, after both the caller and the receiver of instance 1 release the closure.
+    done->Run();
+    ASSERT_EQ(0, closure.num_runs);
+    std::vector<std::string> expected1_0 = {"[0, 1]"};
+    ASSERT_EQ(expected1_0, get_chunks(recvr1.get(), 0));
+    ASSERT_EQ(0, closure.num_runs);
+    std::vector<std::string> expected1_1 = {"[2, 3]"};
+    ASSERT_EQ(expected1_1, get_chunks(recvr1.get(), 1));
+    ASSERT_EQ(1, closure.num_runs);
+}
+
+} // namespace starrocks
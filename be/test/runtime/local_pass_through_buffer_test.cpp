@@ -0,0 +1,107 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/local_pass_through_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <numeric>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+class LocalPassThroughBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _query_id.__set_hi(1);
+        _query_id.__set_lo(1);
+        _fragment_instance_id.__set_hi(1);
+        _fragment_instance_id.__set_lo(2);
+        _buffer_mgr.open_fragment_instance(_query_id);
+    }
+
+    void TearDown() override { _buffer_mgr.close_fragment_instance(_query_id); }
+
+    // Appends the rows in small batches like the shuffle of an exchange sink, so the column is reallocated
+    // several times while it grows.
+    static ChunkUniquePtr create_chunk(int32_t num_rows) {
+        auto chunk = std::make_unique<Chunk>();
+        chunk->append_column(Int32Column::create(), kSlotId);
+        auto rows = Int32Column::create();
+        for (int32_t i = 0; i < 64; i++) {
+            rows->append(i);
+        }
+        std::vector<uint32_t> indexes(64);
+        std::iota(indexes.begin(), indexes.end(), 0);
+        Chunk batch;
+        batch.append_column(std::move(rows), kSlotId);
+        for (int32_t i = 0; i < num_rows; i += 64) {
+            chunk->append_selective(batch, indexes.data(), 0, 64);
+        }
+        return chunk;
+    }
+
+    static int64_t net_consumed_bytes() {
+        return CurrentThread::current().get_consumed_bytes() - CurrentThread::current().get_released_bytes();
+    }
+
+    static constexpr SlotId kSlotId = 1;
+    static constexpr PlanNodeId kNodeId = 1;
+
+    TUniqueId _query_id;
+    TUniqueId _fragment_instance_id;
+    PassThroughChunkBufferManager _buffer_mgr;
+};
+
+TEST_F(LocalPassThroughBufferTest, moved_chunk_keeps_trackers_balanced) {
+    MemTracker sender_mem_tracker(-1, "sender");
+    MemTracker receiver_mem_tracker(-1, "receiver");
+    PassThroughContext sender_context(_buffer_mgr.get(_query_id), _fragment_instance_id, kNodeId);
+    sender_context.init();
+    PassThroughContext receiver_context(_buffer_mgr.get(_query_id), _fragment_instance_id, kNodeId);
+    receiver_context.init();
+
+    int64_t physical_bytes = 0;
+    {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&sender_mem_tracker);
+        int64_t before_bytes = net_consumed_bytes();
+        auto chunk = create_chunk(256 * 1024);
+        physical_bytes = net_consumed_bytes() - before_bytes;
+        sender_context.append_chunk(0, std::move(chunk), 0, physical_bytes, -1);
+    }
+    ASSERT_GE(physical_bytes, static_cast<int64_t>(256 * 1024 * sizeof(int32_t)));
+    ASSERT_EQ(physical_bytes, sender_context.total_bytes());
+
+    {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&receiver_mem_tracker);
+        ChunkUniquePtrVector chunks;
+        std::vector<size_t> bytes;
+        receiver_context.pull_chunks(0, &chunks, &bytes);
+        ASSERT_EQ(1, chunks.size());
+        ASSERT_EQ(256 * 1024, chunks[0].first->num_rows());
+    }
+    ASSERT_EQ(0, receiver_context.total_bytes());
+
+    // The sender is not charged for the chunk, and the receiver gets back what was charged to it
+    // once the chunk is freed.
+    ASSERT_LT(std::abs(sender_mem_tracker.consumption()), physical_bytes / 10);
+    ASSERT_LT(std::abs(receiver_mem_tracker.consumption()), physical_bytes / 10);
+}
+
+} // namespace starrocks
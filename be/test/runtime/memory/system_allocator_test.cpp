@@ -66,4 +66,25 @@ TEST(SystemAllocatorTest, TestNormal) {
     test_normal<false>();
 }
 
+TEST(SystemAllocatorTest, TestAdviseHugePages) {
+    std::unique_ptr<MemTracker> mem_tracker = std::make_unique<MemTracker>(-1);
+    bool old_madvise_huge_pages = config::madvise_huge_pages;
+    size_t length = 8 * 1024 * 1024;
+    auto ptr = SystemAllocator::allocate(mem_tracker.get(), length);
+    ASSERT_NE(nullptr, ptr);
+
+    config::madvise_huge_pages = false;
+    ASSERT_EQ(0, SystemAllocator::advise_huge_pages(ptr, length));
+
+    config::madvise_huge_pages = true;
+    ASSERT_EQ(0, SystemAllocator::advise_huge_pages(ptr, 4096));
+    // The kernel may not support transparent huge pages, then the memory just stays on normal pages.
+    size_t advised = SystemAllocator::advise_huge_pages(ptr, length);
+    ASSERT_EQ(0, advised % (2 * 1024 * 1024));
+    ASSERT_LE(advised, length);
+
+    config::madvise_huge_pages = old_madvise_huge_pages;
+    SystemAllocator::free(mem_tracker.get(), ptr, length);
+}
+
 } // namespace starrocks
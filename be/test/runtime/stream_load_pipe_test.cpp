@@ -234,4 +234,31 @@ PARALLEL_TEST(StreamLoadPipeTest, append_large_chunk) {
     producer.join();
 }
 
+PARALLEL_TEST(StreamLoadPipeTest, append_while_reading_buffer) {
+    StreamLoadPipe pipe(/*max_buffered_bytes=*/4, /*min_chunk_size=*/4);
+
+    auto make_buf = [](const char* data) {
+        auto buf = ByteBuffer::allocate(4);
+        buf->put_bytes(data, 4);
+        buf->flip();
+        return buf;
+    };
+    ASSERT_OK(pipe.append(make_buf("0123")));
+
+    char buf[8];
+    size_t buf_len = 2;
+    bool eof = false;
+    ASSERT_OK(pipe.read((uint8_t*)buf, &buf_len, &eof));
+    ASSERT_EQ(std::string_view("01"), std::string_view(buf, buf_len));
+
+    // the buffer being read has left the pipe, so the producer doesn't wait for it to be drained.
+    ASSERT_OK(pipe.append(make_buf("4567")));
+    ASSERT_OK(pipe.finish());
+
+    buf_len = 8;
+    ASSERT_OK(pipe.read((uint8_t*)buf, &buf_len, &eof));
+    ASSERT_EQ(std::string_view("234567"), std::string_view(buf, buf_len));
+    ASSERT_FALSE(eof);
+}
+
 } // namespace starrocks
@@ -134,4 +134,25 @@ TEST_F(SIMDTest, count_nonzero_int32) {
     EXPECT_EQ(30u, SIMD::count_nonzero(numbers));
 }
 
+TEST_F(SIMDTest, to_index) {
+    std::vector<uint32_t> indexes(100);
+    std::vector<uint8_t> data{0, 1, 0, 2};
+    EXPECT_EQ(2u, SIMD::to_index(data.data(), data.size(), indexes.data()));
+    EXPECT_EQ(1u, indexes[0]);
+    EXPECT_EQ(3u, indexes[1]);
+
+    // size greater than 16 will use SSE2 instructions.
+    data.assign(100, 0);
+    EXPECT_EQ(0u, SIMD::to_index(data.data(), data.size(), indexes.data()));
+    data[0] = 1;
+    data[17] = 1;
+    data[63] = 255;
+    data[99] = 1;
+    EXPECT_EQ(4u, SIMD::to_index(data.data(), data.size(), indexes.data()));
+    EXPECT_EQ(0u, indexes[0]);
+    EXPECT_EQ(17u, indexes[1]);
+    EXPECT_EQ(63u, indexes[2]);
+    EXPECT_EQ(99u, indexes[3]);
+}
+
 } // namespace starrocks
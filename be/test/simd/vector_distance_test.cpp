@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "simd/vector_distance.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace starrocks {
+
+class VectorDistanceTest : public testing::Test {
+protected:
+    static std::vector<float> random_vector(std::mt19937& rng, size_t dim) {
+        std::uniform_real_distribution<float> dist(-1.0, 1.0);
+        std::vector<float> v(dim);
+        for (auto& x : v) {
+            x = dist(rng);
+        }
+        return v;
+    }
+};
+
+// Dimensions around the widths of every instruction set, so that both the vector loops and the tails are covered.
+TEST_F(VectorDistanceTest, test_reductions) {
+    std::mt19937 rng(1);
+    for (size_t dim : {1, 3, 4, 7, 8, 15, 16, 17, 33, 128, 1000}) {
+        auto a = random_vector(rng, dim);
+        auto b = random_vector(rng, dim);
+        double dot = 0;
+        double l2 = 0;
+        double a_norm = 0;
+        double b_norm = 0;
+        for (size_t i = 0; i < dim; i++) {
+            dot += a[i] * b[i];
+            l2 += (a[i] - b[i]) * (a[i] - b[i]);
+            a_norm += a[i] * a[i];
+            b_norm += b[i] * b[i];
+        }
+        const double eps = 1e-4 * dim;
+        ASSERT_NEAR(dot, SIMD::dot_product(a.data(), b.data(), dim), eps) << dim;
+        ASSERT_NEAR(l2, SIMD::l2_distance_squared(a.data(), b.data(), dim), eps) << dim;
+
+        float dot2, a_norm2, b_norm2;
+        SIMD::dot_product_and_norms(a.data(), b.data(), dim, &dot2, &a_norm2, &b_norm2);
+        ASSERT_NEAR(dot, dot2, eps) << dim;
+        ASSERT_NEAR(a_norm, a_norm2, eps) << dim;
+        ASSERT_NEAR(b_norm, b_norm2, eps) << dim;
+    }
+    ASSERT_EQ(0, SIMD::dot_product(nullptr, nullptr, 0));
+}
+
+TEST_F(VectorDistanceTest, test_elementwise) {
+    std::mt19937 rng(2);
+    const size_t dim = 37;
+    auto a = random_vector(rng, dim);
+    auto b = random_vector(rng, dim);
+    std::vector<float> out(dim);
+
+    SIMD::add(a.data(), b.data(), dim, out.data());
+    for (size_t i = 0; i < dim; i++) ASSERT_FLOAT_EQ(a[i] + b[i], out[i]);
+    SIMD::subtract(a.data(), b.data(), dim, out.data());
+    for (size_t i = 0; i < dim; i++) ASSERT_FLOAT_EQ(a[i] - b[i], out[i]);
+    SIMD::multiply(a.data(), b.data(), dim, out.data());
+    for (size_t i = 0; i < dim; i++) ASSERT_FLOAT_EQ(a[i] * b[i], out[i]);
+
+    // In place
+    out = a;
+    SIMD::scale(out.data(), 2, dim, out.data());
+    for (size_t i = 0; i < dim; i++) ASSERT_FLOAT_EQ(a[i] * 2, out[i]);
+}
+
+} // namespace starrocks
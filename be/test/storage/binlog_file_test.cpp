@@ -158,6 +158,26 @@ TEST_F(BinlogFileTest, test_basic_write_read) {
     verify_seek_and_next(file_path, file_meta, 4, 32, expect_entries, 8);
     verify_seek_and_next(file_path, file_meta, 4, 40, expect_entries, 9);
     verify_seek_and_next(file_path, file_meta, 4, 59, expect_entries, 9);
+
+    // the page index shared by the readers is built by the first reader, and used by the later ones to seek
+    auto page_index = std::make_shared<BinlogPageIndex>();
+    int64_t page_index_pos;
+    int64_t page_file_pos;
+    ASSERT_FALSE(page_index->find(1, 0, file_meta->num_pages(), &page_index_pos, &page_file_pos));
+    verify_seek_and_next(file_path, file_meta, 1, 0, expect_entries, 0, page_index);
+    ASSERT_EQ(5, page_index->num_pages());
+    ASSERT_TRUE(page_index->find(4, 40, file_meta->num_pages(), &page_index_pos, &page_file_pos));
+    ASSERT_EQ(4, page_index_pos);
+    ASSERT_TRUE(page_index->find(3, 0, file_meta->num_pages(), &page_index_pos, &page_file_pos));
+    ASSERT_EQ(3, page_index_pos);
+    ASSERT_TRUE(page_index->find(4, 40, 4, &page_index_pos, &page_file_pos));
+    ASSERT_EQ(3, page_index_pos);
+    verify_seek_and_next(file_path, file_meta, 1, 150, expect_entries, 1, page_index);
+    verify_seek_and_next(file_path, file_meta, 1, 239, expect_entries, 2, page_index);
+    verify_seek_and_next(file_path, file_meta, 2, 25, expect_entries, 6, page_index);
+    verify_seek_and_next(file_path, file_meta, 3, 0, expect_entries, 7, page_index);
+    verify_seek_and_next(file_path, file_meta, 4, 40, expect_entries, 9, page_index);
+    ASSERT_EQ(5, page_index->num_pages());
 }
 
 TEST_F(BinlogFileTest, test_basic_begin_commit_abort) {
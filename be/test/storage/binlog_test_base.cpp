@@ -168,8 +168,10 @@ void BinlogTestBase::verify_file_meta(BinlogFileMetaPB* expect_file_meta,
 void BinlogTestBase::verify_seek_and_next(const std::string& file_path,
                                           const std::shared_ptr<BinlogFileMetaPB>& file_meta, int64_t seek_version,
                                           int64_t seek_seq_id, std::vector<std::shared_ptr<TestLogEntryInfo>>& expected,
-                                          int expected_first_entry_index) {
-    std::shared_ptr<BinlogFileReader> file_reader = std::make_shared<BinlogFileReader>(file_path, file_meta);
+                                          int expected_first_entry_index,
+                                          std::shared_ptr<BinlogPageIndex> page_index) {
+    std::shared_ptr<BinlogFileReader> file_reader =
+            std::make_shared<BinlogFileReader>(file_path, file_meta, std::move(page_index));
     Status st = file_reader->seek(seek_version, seek_seq_id);
     for (int i = expected_first_entry_index; i < expected.size(); i++) {
         ASSERT_TRUE(st.ok());
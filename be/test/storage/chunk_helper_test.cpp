@@ -274,6 +274,33 @@ TEST_F(ChunkPipelineAccumulatorTest, test_push) {
     ASSERT_FALSE(accumulator.has_output());
 }
 
+TEST_F(ChunkPipelineAccumulatorTest, test_max_bytes) {
+    ChunkPipelineAccumulator accumulator;
+    accumulator.set_max_bytes(2500);
+
+    // the third chunk exceeds max bytes, so the first two are emitted though they are far from max size.
+    accumulator.push(_generate_chunk(1000, 1));
+    ASSERT_FALSE(accumulator.has_output());
+    accumulator.push(_generate_chunk(1000, 1));
+    ASSERT_FALSE(accumulator.has_output());
+    accumulator.push(_generate_chunk(1000, 1));
+    ASSERT_TRUE(accumulator.has_output());
+    auto result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 2000);
+    accumulator.finalize();
+    ASSERT_TRUE(accumulator.has_output());
+    result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 1000);
+    ASSERT_FALSE(accumulator.has_output());
+
+    // a chunk reaching max bytes alone is emitted directly.
+    accumulator.reset_state();
+    accumulator.push(_generate_chunk(1000, 3));
+    ASSERT_TRUE(accumulator.has_output());
+    result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 1000);
+}
+
 TEST_F(ChunkPipelineAccumulatorTest, test_owner_info) {
     constexpr size_t kDesiredSize = 4096;
 
@@ -306,4 +306,18 @@ TEST_F(CompactionManagerTest, test_compaction_parallel) {
     ASSERT_EQ(0, _engine->compaction_manager()->running_tasks_num());
 }
 
+TEST_F(CompactionManagerTest, test_query_cost_score) {
+    const int64_t mb = 1024 * 1024;
+    // a tablet without scans is ranked by the compaction score per MB
+    ASSERT_DOUBLE_EQ(10, CompactionManager::calc_query_cost_score(10, 0, 0));
+    ASSERT_DOUBLE_EQ(1, CompactionManager::calc_query_cost_score(10, 0, 10 * mb));
+    // a frequently scanned tablet is ahead of a cold one with the same score and size
+    ASSERT_GT(CompactionManager::calc_query_cost_score(10, 100, 10 * mb),
+              CompactionManager::calc_query_cost_score(10, 1, 10 * mb));
+    // a small hot tablet is ahead of a large cold one with a higher score
+    ASSERT_GT(CompactionManager::calc_query_cost_score(5, 10, 10 * mb),
+              CompactionManager::calc_query_cost_score(20, 0, 100 * mb));
+}
+
 } // namespace starrocks
+
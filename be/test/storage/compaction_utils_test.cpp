@@ -101,6 +101,54 @@ TEST(CompactionUtilsTest, test_split_column_into_groups) {
     ASSERT_EQ(1, column_groups1[4].size());
 }
 
+TEST(CompactionUtilsTest, test_split_column_into_groups_by_memory) {
+    size_t num_columns = 17;
+    std::vector<std::vector<uint32_t>> column_groups;
+    // narrow columns are merged into one group up to the max columns per group
+    std::vector<int64_t> footprints(num_columns, 10);
+    CompactionUtils::split_column_into_groups(num_columns, {1, 2, 5}, 5, 8, footprints, 1000, &column_groups);
+    ASSERT_EQ(3, column_groups.size());
+    ASSERT_EQ(3, column_groups[0].size());
+    ASSERT_EQ(8, column_groups[1].size());
+    ASSERT_EQ(6, column_groups[2].size());
+    ASSERT_EQ(0, column_groups[1][0]);
+    ASSERT_EQ(3, column_groups[1][1]);
+    ASSERT_EQ(6, column_groups[1][3]);
+
+    // a wide column closes the group once it has the min columns per group
+    std::vector<std::vector<uint32_t>> column_groups1;
+    footprints[12] = 1000;
+    CompactionUtils::split_column_into_groups(num_columns, {0}, 5, 40, footprints, 100, &column_groups1);
+    ASSERT_EQ(4, column_groups1.size());
+    ASSERT_EQ(1, column_groups1[0].size());
+    ASSERT_EQ(10, column_groups1[1].size());
+    ASSERT_EQ(5, column_groups1[2].size());
+    ASSERT_EQ(12, column_groups1[2][1]);
+    ASSERT_EQ(1, column_groups1[3].size());
+}
+
+TEST(CompactionUtilsTest, test_split_column_into_groups_by_access) {
+    size_t num_columns = 20;
+    std::vector<std::vector<uint32_t>> column_groups;
+    // the columns read together are grouped first, the others follow in the order of schema
+    std::vector<std::vector<ColumnId>> column_sets{{17, 3, 9}, {3, 0, 12, 1, 2, 4, 5, 6}};
+    CompactionUtils::split_column_into_groups_by_access(num_columns, {0}, 5, column_sets, &column_groups);
+    ASSERT_EQ(6, column_groups.size());
+    ASSERT_EQ(std::vector<uint32_t>({0}), column_groups[0]);
+    ASSERT_EQ(std::vector<uint32_t>({3, 9, 17}), column_groups[1]);
+    ASSERT_EQ(std::vector<uint32_t>({1, 2, 4, 5, 6}), column_groups[2]);
+    ASSERT_EQ(std::vector<uint32_t>({12}), column_groups[3]);
+    ASSERT_EQ(std::vector<uint32_t>({7, 8, 10, 11, 13}), column_groups[4]);
+    ASSERT_EQ(std::vector<uint32_t>({14, 15, 16, 18, 19}), column_groups[5]);
+
+    // without any column set, it is the same as the split by the max columns per group
+    std::vector<std::vector<uint32_t>> column_groups1;
+    std::vector<std::vector<uint32_t>> column_groups2;
+    CompactionUtils::split_column_into_groups_by_access(num_columns, {1, 2}, 5, {}, &column_groups1);
+    CompactionUtils::split_column_into_groups(num_columns, {1, 2}, 5, &column_groups2);
+    ASSERT_EQ(column_groups2, column_groups1);
+}
+
 TEST(CompactionUtilsTest, test_choose_compaction_algorithm) {
     size_t num_columns = 17;
     int64_t max_columns_per_group = 5;
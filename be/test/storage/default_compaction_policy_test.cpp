@@ -17,6 +17,7 @@
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "column/schema.h"
@@ -35,7 +36,10 @@
 #include "storage/rowset/rowset_writer_context.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_meta.h"
+#include "storage/tablet_reader.h"
+#include "storage/tablet_reader_params.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -48,14 +52,14 @@ public:
             _engine = nullptr;
         }
     }
-    void write_new_version(const TabletMetaSharedPtr& tablet_meta) {
+    void write_new_version(const TabletMetaSharedPtr& tablet_meta, int32_t key_offset = 0) {
         RowsetWriterContext rowset_writer_context;
         create_rowset_writer_context(&rowset_writer_context, _version);
         _version++;
         std::unique_ptr<RowsetWriter> rowset_writer;
         ASSERT_TRUE(RowsetFactory::create_rowset_writer(rowset_writer_context, &rowset_writer).ok());
 
-        rowset_writer_add_rows(rowset_writer);
+        rowset_writer_add_rows(rowset_writer, key_offset);
 
         rowset_writer->flush();
         RowsetSharedPtr src_rowset = *rowset_writer->build();
@@ -189,7 +193,7 @@ public:
         tablet_meta->init_from_pb(&tablet_meta_pb);
     }
 
-    void rowset_writer_add_rows(std::unique_ptr<RowsetWriter>& writer) {
+    void rowset_writer_add_rows(std::unique_ptr<RowsetWriter>& writer, int32_t key_offset = 0) {
         std::vector<std::string> test_data;
         auto schema = ChunkHelper::convert_schema(_tablet_schema);
         for (size_t j = 0; j < 8; ++j) {
@@ -197,7 +201,7 @@ public:
             for (size_t i = 0; i < 128; ++i) {
                 test_data.push_back("well" + std::to_string(i));
                 auto& cols = chunk->columns();
-                cols[0]->append_datum(Datum(static_cast<int32_t>(i)));
+                cols[0]->append_datum(Datum(static_cast<int32_t>(key_offset + i)));
                 Slice field_1(test_data[i]);
                 cols[1]->append_datum(Datum(field_1));
                 cols[2]->append_datum(Datum(static_cast<int32_t>(10000 + i)));
@@ -206,6 +210,46 @@ public:
         }
     }
 
+    // The k1 of the rows of |tablet| visible at |version| in ascending order.
+    std::vector<int32_t> read_k1(const TabletSharedPtr& tablet, int64_t version) {
+        Schema schema = ChunkHelper::convert_schema(_tablet_schema);
+        auto reader = std::make_shared<TabletReader>(tablet, Version(0, version), schema);
+        CHECK_OK(reader->prepare());
+        TabletReaderParams params;
+        CHECK_OK(reader->open(params));
+        auto chunk = ChunkHelper::new_chunk(schema, 1024);
+        std::vector<int32_t> k1;
+        while (true) {
+            chunk->reset();
+            auto st = reader->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK_OK(st);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                k1.push_back(chunk->get_column_by_index(0)->get(i).get_int32());
+            }
+        }
+        reader->close();
+        std::sort(k1.begin(), k1.end());
+        return k1;
+    }
+
+    // The k1 of the rows written by write_new_version() with |key_offsets|, without the ones in |deleted|.
+    static std::vector<int32_t> expected_k1(const std::vector<int32_t>& key_offsets,
+                                            const std::vector<int32_t>& deleted = {}) {
+        std::vector<int32_t> k1;
+        for (int32_t offset : key_offsets) {
+            for (int32_t i = 0; i < 128; i++) {
+                if (std::find(deleted.begin(), deleted.end(), offset + i) == deleted.end()) {
+                    k1.insert(k1.end(), 8, offset + i);
+                }
+            }
+        }
+        std::sort(k1.begin(), k1.end());
+        return k1;
+    }
+
     void init_compaction_context(const TabletSharedPtr& tablet) {
         std::unique_ptr<CompactionContext> compaction_context = std::make_unique<CompactionContext>();
         compaction_context->policy = std::make_unique<DefaultCumulativeBaseCompactionPolicy>(tablet.get());
@@ -935,4 +979,98 @@ TEST_F(DefaultCompactionPolicyTest, test_shortcut_compaction) {
     ASSERT_EQ(2, versions[0].second);
 }
 
+TEST_F(DefaultCompactionPolicyTest, test_shortcut_compaction_of_disjoint_rowsets) {
+    LOG(INFO) << "test_shortcut_compaction_of_disjoint_rowsets";
+    auto enable_link = config::enable_compaction_link_disjoint_rowsets;
+    DeferOp defer([&]() { config::enable_compaction_link_disjoint_rowsets = enable_link; });
+    config::enable_compaction_link_disjoint_rowsets = true;
+    create_tablet_schema(DUP_KEYS);
+
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+
+    // the ranges of k1 are ascending by version
+    write_new_version(tablet_meta, 0);
+    write_new_version(tablet_meta, 1000);
+    write_new_version(tablet_meta, 2000);
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(tablet_meta, starrocks::StorageEngine::instance()->get_stores()[0]);
+    ASSERT_OK(tablet->init());
+    init_compaction_context(tablet);
+    ASSERT_EQ(3, tablet->version_count());
+
+    bool is_shortcut_compaction = false;
+    auto res = compact(tablet, &is_shortcut_compaction);
+    ASSERT_TRUE(res.ok());
+    ASSERT_TRUE(is_shortcut_compaction);
+
+    ASSERT_EQ(1, tablet->version_count());
+    std::vector<RowsetSharedPtr> rowsets;
+    ASSERT_OK(tablet->capture_consistent_rowsets(Version(0, 2), &rowsets));
+    ASSERT_EQ(1, rowsets.size());
+    ASSERT_EQ(3, rowsets[0]->num_segments());
+    ASSERT_EQ(3 * 1024, rowsets[0]->num_rows());
+    ASSERT_FALSE(rowsets[0]->rowset_meta()->is_segments_overlapping());
+    ASSERT_EQ(expected_k1({0, 1000, 2000}), read_k1(tablet, 2));
+}
+
+TEST_F(DefaultCompactionPolicyTest, test_shortcut_compaction_of_disjoint_rowsets_with_delete) {
+    LOG(INFO) << "test_shortcut_compaction_of_disjoint_rowsets_with_delete";
+    auto enable_link = config::enable_compaction_link_disjoint_rowsets;
+    DeferOp defer([&]() { config::enable_compaction_link_disjoint_rowsets = enable_link; });
+    config::enable_compaction_link_disjoint_rowsets = true;
+    create_tablet_schema(DUP_KEYS);
+
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+
+    // The delete predicate k1 IN (0) of version 2 deletes rows of version 0 only.
+    write_new_version(tablet_meta, 0);
+    write_new_version(tablet_meta, 1000);
+    write_delete_version(tablet_meta, _version);
+    _version++;
+    write_new_version(tablet_meta, 2000);
+    write_new_version(tablet_meta, 3000);
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(tablet_meta, starrocks::StorageEngine::instance()->get_stores()[0]);
+    ASSERT_OK(tablet->init());
+    init_compaction_context(tablet);
+    const auto expected = expected_k1({0, 1000, 2000, 3000}, {0});
+    ASSERT_EQ(expected, read_k1(tablet, 4));
+
+    // The rowsets before the delete version are linked, and the delete predicate still applies to them.
+    bool is_shortcut_compaction = false;
+    ASSERT_OK(compact(tablet, &is_shortcut_compaction));
+    ASSERT_TRUE(is_shortcut_compaction);
+    std::vector<RowsetSharedPtr> rowsets;
+    ASSERT_OK(tablet->capture_consistent_rowsets(Version(0, 1), &rowsets));
+    ASSERT_EQ(1, rowsets.size());
+    ASSERT_EQ(2, rowsets[0]->num_segments());
+    ASSERT_EQ(expected, read_k1(tablet, 4));
+}
+
+TEST_F(DefaultCompactionPolicyTest, test_no_shortcut_compaction_of_overlapping_rowsets) {
+    LOG(INFO) << "test_no_shortcut_compaction_of_overlapping_rowsets";
+    create_tablet_schema(DUP_KEYS);
+
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+
+    write_new_version(tablet_meta, 1000);
+    write_new_version(tablet_meta, 0);
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(tablet_meta, starrocks::StorageEngine::instance()->get_stores()[0]);
+    ASSERT_OK(tablet->init());
+    init_compaction_context(tablet);
+
+    bool is_shortcut_compaction = true;
+    auto res = compact(tablet, &is_shortcut_compaction);
+    ASSERT_TRUE(res.ok());
+    ASSERT_FALSE(is_shortcut_compaction);
+    ASSERT_EQ(1, tablet->version_count());
+}
+
 } // namespace starrocks
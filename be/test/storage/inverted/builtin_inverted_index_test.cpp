@@ -0,0 +1,153 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "fs/fs_util.h"
+#include "storage/inverted/builtin/builtin_inverted_format.h"
+#include "storage/inverted/builtin/builtin_plugin.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class BuiltinInvertedIndexTest : public testing::Test {
+public:
+    void SetUp() override {
+        CHECK_OK(fs::remove_all(_index_dir));
+        CHECK_OK(fs::create_directories(_index_dir));
+    }
+
+    void TearDown() override { (void)fs::remove_all(_index_dir); }
+
+protected:
+    // Build an index of |values|, in which nullptr is a null row
+    std::unique_ptr<InvertedReader> build_index(const std::string& parser, const std::vector<const char*>& values) {
+        auto tablet_index = std::make_shared<TabletIndex>();
+        tablet_index->add_common_properties(INVERTED_IMP_KEY, TYPE_BUILTIN);
+        tablet_index->add_index_properties(INVERTED_INDEX_PARSER_KEY, parser);
+        std::string path = _index_dir + "/" + parser;
+
+        std::unique_ptr<InvertedWriter> writer;
+        CHECK_OK(BuiltinPlugin::get_instance().create_inverted_index_writer(
+                get_type_info(TYPE_VARCHAR), "c1", path, tablet_index.get(), &writer));
+        CHECK_OK(writer->init());
+        for (const char* value : values) {
+            if (value == nullptr) {
+                writer->add_nulls(1);
+            } else {
+                Slice slice(value);
+                writer->add_values(&slice, 1);
+            }
+        }
+        CHECK_OK(writer->finish());
+
+        std::unique_ptr<InvertedReader> reader;
+        CHECK_OK(BuiltinPlugin::get_instance().create_inverted_index_reader(path, tablet_index, TYPE_VARCHAR,
+                                                                            &reader));
+        return reader;
+    }
+
+    static std::vector<uint32_t> query(InvertedReader* reader, const std::string& value,
+                                       InvertedIndexQueryType query_type) {
+        Slice slice(value);
+        roaring::Roaring result;
+        CHECK_OK(reader->query(nullptr, "c1", &slice, query_type, &result));
+        std::vector<uint32_t> rows(result.cardinality());
+        result.toUint32Array(rows.data());
+        return rows;
+    }
+
+    std::string _index_dir = "builtin_inverted_index_test";
+};
+
+TEST_F(BuiltinInvertedIndexTest, test_tokenized) {
+    auto reader = build_index(INVERTED_INDEX_PARSER_STANDARD, {"GET /index.html 200", nullptr, "get error: timeout",
+                                                               "timeout error", "POST /index.html 500", ""});
+    using Rows = std::vector<uint32_t>;
+    ASSERT_EQ(Rows({0, 2}), query(reader.get(), "get", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({0, 2}), query(reader.get(), "GET", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({2, 3}), query(reader.get(), "timeout error", InvertedIndexQueryType::MATCH_ALL_QUERY));
+    ASSERT_EQ(Rows({2}), query(reader.get(), "error timeout", InvertedIndexQueryType::MATCH_PHRASE_QUERY));
+    ASSERT_EQ(Rows({3}), query(reader.get(), "timeout error", InvertedIndexQueryType::MATCH_PHRASE_QUERY));
+    ASSERT_EQ(Rows({0, 4}), query(reader.get(), "index html", InvertedIndexQueryType::MATCH_PHRASE_QUERY));
+    ASSERT_EQ(Rows({0, 4}), query(reader.get(), "ind*", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(Rows({0, 4}), query(reader.get(), "%00", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(Rows({2, 3}), query(reader.get(), "t?meout", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(Rows(), query(reader.get(), "missing", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows(), query(reader.get(), "get missing", InvertedIndexQueryType::MATCH_PHRASE_QUERY));
+
+    roaring::Roaring nulls;
+    ASSERT_OK(reader->query_null(nullptr, "c1", &nulls));
+    ASSERT_EQ(roaring::Roaring::bitmapOf(1, 1), nulls);
+}
+
+TEST_F(BuiltinInvertedIndexTest, test_untokenized) {
+    auto reader = build_index(INVERTED_INDEX_PARSER_NONE, {"beijing", "Shanghai", "beijing", nullptr, "shenzhen"});
+    using Rows = std::vector<uint32_t>;
+    ASSERT_EQ(Rows({0, 2}), query(reader.get(), "beijing", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows(), query(reader.get(), "shanghai", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({4}), query(reader.get(), "sh%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(Rows({0, 1, 2}), query(reader.get(), "shenzhen", InvertedIndexQueryType::LESS_THAN_QUERY));
+    ASSERT_EQ(Rows({0, 1, 2, 4}), query(reader.get(), "shenzhen", InvertedIndexQueryType::LESS_EQUAL_QUERY));
+    ASSERT_EQ(Rows({4}), query(reader.get(), "beijing", InvertedIndexQueryType::GREATER_THAN_QUERY));
+    ASSERT_EQ(Rows({0, 2, 4}), query(reader.get(), "beijing", InvertedIndexQueryType::GREATER_EQUAL_QUERY));
+}
+
+// Many terms and long postings, to cover multiple dictionary blocks, packed blocks and roaring postings
+TEST_F(BuiltinInvertedIndexTest, test_large) {
+    const size_t num_rows = 10000;
+    std::vector<std::string> values;
+    for (size_t i = 0; i < num_rows; i++) {
+        values.emplace_back(fmt::format("common t{} m{}", i, i % 7));
+    }
+    std::vector<const char*> value_ptrs;
+    for (const auto& value : values) {
+        value_ptrs.push_back(value.c_str());
+    }
+    auto reader = build_index(INVERTED_INDEX_PARSER_STANDARD, value_ptrs);
+    ASSERT_EQ(num_rows, query(reader.get(), "common", InvertedIndexQueryType::EQUAL_QUERY).size());
+    ASSERT_EQ(std::vector<uint32_t>({1234}), query(reader.get(), "t1234", InvertedIndexQueryType::EQUAL_QUERY));
+    auto rows = query(reader.get(), "m3", InvertedIndexQueryType::EQUAL_QUERY);
+    ASSERT_EQ((num_rows - 3 + 6) / 7, rows.size());
+    for (uint32_t row : rows) {
+        ASSERT_EQ(3, row % 7);
+    }
+    ASSERT_EQ(std::vector<uint32_t>({77}), query(reader.get(), "t77 m0", InvertedIndexQueryType::MATCH_PHRASE_QUERY));
+    ASSERT_EQ(111, query(reader.get(), "t12*", InvertedIndexQueryType::MATCH_WILDCARD_QUERY).size());
+}
+
+TEST_F(BuiltinInvertedIndexTest, test_doc_ids_codec) {
+    std::vector<std::vector<uint32_t>> cases = {{}, {0}, {5, 6, 100}};
+    std::vector<uint32_t> sparse;
+    std::vector<uint32_t> dense;
+    for (uint32_t i = 0; i < 1000; i++) {
+        sparse.push_back(i * 1000 + i % 3);
+        dense.push_back(i);
+    }
+    cases.push_back(sparse);
+    cases.push_back(dense);
+    for (const auto& doc_ids : cases) {
+        faststring buf;
+        builtin_inverted::encode_doc_ids(doc_ids, &buf);
+        std::vector<uint32_t> decoded;
+        ASSERT_OK(builtin_inverted::decode_doc_ids(Slice(buf.data(), buf.size()), doc_ids.size(), &decoded));
+        ASSERT_EQ(doc_ids, decoded);
+        roaring::Roaring bitmap;
+        ASSERT_OK(builtin_inverted::decode_doc_ids(Slice(buf.data(), buf.size()), doc_ids.size(), &bitmap));
+        ASSERT_EQ(doc_ids.size(), bitmap.cardinality());
+    }
+}
+
+} // namespace starrocks
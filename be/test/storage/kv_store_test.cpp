@@ -42,6 +42,7 @@
 
 #include "fs/fs_util.h"
 #include "storage/olap_define.h"
+#include "storage/rowset/rowset_meta_manager.h"
 
 #ifndef BE_TEST
 #define BE_TEST
@@ -104,6 +105,27 @@ TEST_F(KVStoreTest, TestRemove) {
     ASSERT_TRUE(_kv_store->remove(META_COLUMN_FAMILY_INDEX, "key_not_exist").ok());
 }
 
+TEST_F(KVStoreTest, TestRemoveRowsetMetaBatch) {
+    TabletUid tablet_uid(1, 2);
+    std::vector<std::pair<TabletUid, RowsetId>> rowsets;
+    for (int i = 0; i < 10; i++) {
+        RowsetId rowset_id;
+        rowset_id.init(2, i, 0, 0);
+        std::string key = RowsetMetaManager::get_rowset_meta_key(tablet_uid, rowset_id);
+        ASSERT_TRUE(_kv_store->put(META_COLUMN_FAMILY_INDEX, key, "value").ok());
+        if (i % 2 == 0) {
+            rowsets.emplace_back(tablet_uid, rowset_id);
+        }
+    }
+    ASSERT_TRUE(RowsetMetaManager::remove_batch(_kv_store, rowsets).ok());
+    ASSERT_TRUE(RowsetMetaManager::remove_batch(_kv_store, {}).ok());
+    for (int i = 0; i < 10; i++) {
+        RowsetId rowset_id;
+        rowset_id.init(2, i, 0, 0);
+        ASSERT_EQ(i % 2 != 0, RowsetMetaManager::check_rowset_meta(_kv_store, tablet_uid, rowset_id));
+    }
+}
+
 TEST_F(KVStoreTest, TestIterate) {
     // normal cases
     std::string key = "hdr_key";
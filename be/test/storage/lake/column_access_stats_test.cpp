@@ -0,0 +1,67 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/lake/column_access_stats.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+namespace starrocks::lake {
+
+TEST(ColumnAccessStatsTest, test_hot_column_sets) {
+    ColumnAccessStats stats;
+    for (int i = 0; i < 10; i++) {
+        stats.record(1, 100, {5, 3, 4});
+    }
+    for (int i = 0; i < 5; i++) {
+        stats.record(1, 100, {7, 8});
+    }
+    stats.record(1, 100, {9});
+    // reads more than half of the columns
+    std::vector<ColumnUID> wide(60);
+    std::iota(wide.begin(), wide.end(), 0);
+    stats.record(1, 100, wide);
+
+    auto sets = stats.hot_column_sets(1, 0.1);
+    ASSERT_EQ(2, sets.size());
+    ASSERT_EQ(std::vector<ColumnUID>({3, 4, 5}), sets[0]);
+    ASSERT_EQ(std::vector<ColumnUID>({7, 8}), sets[1]);
+    ASSERT_EQ(3, stats.hot_column_sets(1, 0).size());
+    ASSERT_TRUE(stats.hot_column_sets(2, 0).empty());
+}
+
+TEST(ColumnAccessStatsTest, test_bounded_sets) {
+    ColumnAccessStats stats(2, 2);
+    for (int i = 0; i < 10; i++) {
+        stats.record(1, 100, {1, 2});
+    }
+    stats.record(1, 100, {3});
+    // replaces the least frequent set and inherits its count
+    stats.record(1, 100, {4});
+    auto sets = stats.hot_column_sets(1, 0);
+    ASSERT_EQ(2, sets.size());
+    ASSERT_EQ(std::vector<ColumnUID>({1, 2}), sets[0]);
+    ASSERT_EQ(std::vector<ColumnUID>({4}), sets[1]);
+
+    // the least recently recorded schema is dropped
+    stats.record(2, 100, {1});
+    stats.record(1, 100, {1, 2});
+    stats.record(3, 100, {1});
+    ASSERT_EQ(2, stats.num_schemas());
+    ASSERT_TRUE(stats.hot_column_sets(2, 0).empty());
+    ASSERT_EQ(2, stats.hot_column_sets(1, 0).size());
+}
+
+} // namespace starrocks::lake
@@ -23,6 +23,7 @@
 #include "fs/fs.h"
 #include "fs/fs_util.h"
 #include "storage/lake/join_path.h"
+#include "storage/lake/metacache.h"
 #include "storage/persistent_index.h"
 #include "storage/sstable/iterator.h"
 #include "storage/sstable/merger.h"
@@ -419,4 +420,50 @@ TEST_F(PersistentIndexSstableTest, test_persistent_index_sstable) {
     }
 }
 
+TEST_F(PersistentIndexSstableTest, test_cache_sstable_in_metacache) {
+    const int N = 1000;
+    const std::string filename = "test_cache_sstable_in_metacache.sst";
+    ASSIGN_OR_ABORT(auto file, fs::new_writable_file(lake::join_path(kTestDir, filename)));
+    phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>> map;
+    for (int i = 0; i < N; i++) {
+        std::list<IndexValueWithVer> index_value_vers;
+        index_value_vers.emplace_front(100, i);
+        map.insert({fmt::format("test_key_{:016X}", i), index_value_vers});
+    }
+    uint64_t filesize = 0;
+    ASSERT_OK(PersistentIndexSstable::build_sstable(map, file.get(), &filesize));
+    ASSERT_OK(file->close());
+
+    auto sst = std::make_shared<PersistentIndexSstable>();
+    ASSIGN_OR_ABORT(auto read_file, fs::new_random_access_file(lake::join_path(kTestDir, filename)));
+    std::unique_ptr<Cache> cache_ptr(new_lru_cache(1024 * 1024));
+    PersistentIndexSstablePB sstable_pb;
+    sstable_pb.set_filename(filename);
+    sstable_pb.set_filesize(filesize);
+    ASSERT_OK(sst->init(std::move(read_file), sstable_pb, cache_ptr.get()));
+    // the index block and the filter block are kept in memory
+    ASSERT_GT(sst->memory_usage(), N * config::lake_pk_index_sst_bloom_filter_bits_per_key / 8);
+
+    Metacache metacache(1024 * 1024);
+    metacache.cache_sstable(filename, sst);
+    ASSERT_EQ(sst->memory_usage(), metacache.memory_usage());
+    auto cached_sst = metacache.lookup_sstable(filename);
+    ASSERT_EQ(sst.get(), cached_sst.get());
+    ASSERT_EQ(nullptr, metacache.lookup_sstable("not_exist.sst"));
+
+    // keys missing from the sstable are not found
+    std::vector<std::string> keys_str(N);
+    std::vector<Slice> keys(N);
+    KeyIndexSet key_indexes;
+    for (int i = 0; i < N; i++) {
+        keys_str[i] = fmt::format("test_key_{:016X}_missing", i);
+        keys[i] = Slice(keys_str[i]);
+        key_indexes.insert(i);
+    }
+    std::vector<IndexValue> values(N, IndexValue(NullIndexValue));
+    KeyIndexSet found_key_indexes;
+    ASSERT_OK(cached_sst->multi_get(keys.data(), key_indexes, -1, values.data(), &found_key_indexes));
+    ASSERT_TRUE(found_key_indexes.empty());
+}
+
 } // namespace starrocks::lake
@@ -18,15 +18,20 @@
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/logging.h"
+#include "fs/fs_util.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/lake/metacache.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/lake/tablet_writer.h"
+#include "storage/rowset/rowset_options.h"
 #include "storage/tablet_schema.h"
 #include "test_util.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
+#include "util/defer_op.h"
 
 namespace starrocks::lake {
 
@@ -200,4 +205,70 @@ TEST_F(LakeRowsetTest, test_segment_update_cache_size) {
     }
 }
 
+TEST_F(LakeRowsetTest, test_prune_segments_by_zone_map) {
+    auto old_value = config::lake_enable_rowset_segment_zone_map;
+    config::lake_enable_rowset_segment_zone_map = true;
+    DeferOp defer([&]() { config::lake_enable_rowset_segment_zone_map = old_value; });
+
+    std::vector<int> k0{1, 2, 3, 4, 5};
+    std::vector<int> k1{30, 31, 32, 33, 34};
+    auto c0 = Int32Column::create();
+    auto c1 = Int32Column::create();
+    auto c2 = Int32Column::create();
+    auto c3 = Int32Column::create();
+    c0->append_numbers(k0.data(), k0.size() * sizeof(int));
+    c1->append_numbers(k0.data(), k0.size() * sizeof(int));
+    c2->append_numbers(k1.data(), k1.size() * sizeof(int));
+    c3->append_numbers(k1.data(), k1.size() * sizeof(int));
+    Chunk chunk0({c0, c1}, _schema);
+    Chunk chunk1({c2, c3}, _schema);
+
+    ASSIGN_OR_ABORT(auto tablet, _tablet_mgr->get_tablet(_tablet_metadata->id()));
+    {
+        ASSIGN_OR_ABORT(auto writer, tablet.new_writer(kHorizontal, next_id()));
+        ASSERT_OK(writer->open());
+        ASSERT_OK(writer->write(chunk0));
+        ASSERT_OK(writer->finish());
+        ASSERT_OK(writer->write(chunk1));
+        ASSERT_OK(writer->finish());
+        ASSERT_EQ(2, writer->segment_zone_maps().size());
+
+        auto* rowset = _tablet_metadata->add_rowsets();
+        rowset->set_overlapped(true);
+        rowset->set_id(1);
+        for (auto& file : writer->files()) {
+            rowset->add_segments(std::move(file.path));
+            rowset->add_segment_size(file.size.value());
+        }
+        for (auto& zone_map : writer->segment_zone_maps()) {
+            rowset->add_segment_zone_maps()->CopyFrom(zone_map);
+        }
+        writer->close();
+    }
+    _tablet_metadata->set_version(2);
+    CHECK_OK(_tablet_mgr->put_tablet_metadata(*_tablet_metadata));
+
+    ASSIGN_OR_ABORT(auto rowsets, tablet.get_rowsets(2));
+    ASSERT_EQ(1, rowsets.size());
+
+    auto read_segments = [&](const char* operand) -> size_t {
+        std::unique_ptr<ColumnPredicate> pred(new_column_ge_predicate(get_type_info(TYPE_INT), 0, operand));
+        OlapReaderStatistics stats;
+        RowsetReadOptions options;
+        options.stats = &stats;
+        options.tablet_schema = _tablet_schema;
+        options.predicates_for_zone_map[0].push_back(pred.get());
+        auto iters = rowsets[0]->read(*_schema, options);
+        CHECK(iters.ok()) << iters.status();
+        return iters->size();
+    };
+    ASSERT_EQ(2, read_segments("0"));
+    ASSERT_EQ(1, read_segments("30"));
+    ASSERT_EQ(0, read_segments("100"));
+
+    // The pruned segment is not opened at all.
+    ASSERT_OK(fs::delete_file(_tablet_mgr->segment_location(tablet.id(), _tablet_metadata->rowsets(0).segments(0))));
+    ASSERT_EQ(1, read_segments("30"));
+}
+
 } // namespace starrocks::lake
@@ -18,7 +18,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <fstream>
+#include <thread>
 
 #include "common/config.h"
 #include "fs/fs.h"
@@ -26,6 +28,7 @@
 #include "storage/lake/fixed_location_provider.h"
 #include "storage/lake/join_path.h"
 #include "storage/lake/location_provider.h"
+#include "storage/lake/metacache.h"
 #include "storage/lake/update_manager.h"
 #include "storage/lake/versioned_tablet.h"
 #include "storage/options.h"
@@ -94,6 +97,42 @@ TEST_F(LakeTabletManagerTest, tablet_meta_write_and_read) {
 }
 
 // NOLINTNEXTLINE
+TEST_F(LakeTabletManagerTest, batch_get_and_prefetch_tablet_metadata) {
+    std::vector<std::pair<int64_t, int64_t>> tablet_versions;
+    for (int64_t tablet_id = 100; tablet_id < 110; tablet_id++) {
+        starrocks::TabletMetadata metadata;
+        metadata.set_id(tablet_id);
+        metadata.set_version(2);
+        EXPECT_OK(_tablet_manager->put_tablet_metadata(metadata));
+        // Cache some of them only.
+        if (tablet_id % 2 == 0) {
+            _tablet_manager->metacache()->erase(_tablet_manager->tablet_metadata_location(tablet_id, 2));
+        }
+        tablet_versions.emplace_back(tablet_id, 2);
+    }
+    ASSIGN_OR_ABORT(auto metadatas, _tablet_manager->get_tablet_metadatas(tablet_versions));
+    ASSERT_EQ(tablet_versions.size(), metadatas.size());
+    for (size_t i = 0; i < metadatas.size(); i++) {
+        ASSERT_EQ(tablet_versions[i].first, metadatas[i]->id());
+        ASSERT_EQ(2, metadatas[i]->version());
+        auto path = _tablet_manager->tablet_metadata_location(tablet_versions[i].first, 2);
+        ASSERT_TRUE(_tablet_manager->metacache()->lookup_tablet_metadata(path) != nullptr);
+    }
+
+    tablet_versions.emplace_back(110, 2);
+    ASSERT_TRUE(_tablet_manager->get_tablet_metadatas(tablet_versions).status().is_not_found());
+
+    auto path = _tablet_manager->tablet_metadata_location(100, 2);
+    _tablet_manager->metacache()->erase(path);
+    _tablet_manager->prefetch_tablet_metadata(100, 2);
+    // The prefetch of a missing metadata is ignored.
+    _tablet_manager->prefetch_tablet_metadata(110, 2);
+    for (int i = 0; i < 100 && _tablet_manager->metacache()->lookup_tablet_metadata(path) == nullptr; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(_tablet_manager->metacache()->lookup_tablet_metadata(path) != nullptr);
+}
+
 TEST_F(LakeTabletManagerTest, txnlog_write_and_read) {
     starrocks::TxnLog txnLog;
     txnLog.set_tablet_id(12345);
@@ -64,7 +64,7 @@ protected:
 
     bool file_exist(const std::string& name) {
         std::string full_path;
-        if (is_tablet_metadata(name)) {
+        if (is_tablet_metadata(name) || is_vacuum_watermark(name)) {
             full_path = join_path(join_path(kTestDir, kMetadataDirectoryName), name);
         } else if (is_txn_log(name) || is_txn_slog(name) || is_txn_vlog(name) || is_combined_txn_log(name)) {
             full_path = join_path(join_path(kTestDir, kTxnLogDirectoryName), name);
@@ -1183,6 +1183,63 @@ TEST_P(LakeVacuumTest, test_commit_time) {
     SyncPoint::GetInstance()->DisableProcessing();
 }
 
+// NOLINTNEXTLINE
+TEST_P(LakeVacuumTest, test_vacuum_watermark) {
+    for (int version = 1; version <= 4; version++) {
+        auto metadata = std::make_shared<TabletMetadataPB>();
+        metadata->set_id(5100);
+        metadata->set_version(version);
+        metadata->set_commit_time(1696998530 + version);
+        metadata->set_prev_garbage_version(0);
+        ASSERT_OK(_tablet_mgr->put_tablet_metadata(metadata));
+    }
+
+    int metadata_reads = 0;
+    SyncPoint::GetInstance()->SetCallBack("collect_files_to_vacuum:get_tablet_metadata",
+                                          [&](void* arg) { metadata_reads++; });
+    SyncPoint::GetInstance()->EnableProcessing();
+
+    auto do_vacuum = [&](int64_t min_retain_version) {
+        VacuumRequest request;
+        VacuumResponse response;
+        request.add_tablet_ids(5100);
+        request.set_min_retain_version(min_retain_version);
+        request.set_grace_timestamp(1696998600);
+        request.set_min_active_txn_id(10);
+        vacuum(_tablet_mgr.get(), request, &response);
+        EXPECT_EQ(0, response.status().status_code());
+        return response.vacuumed_files();
+    };
+
+    EXPECT_EQ(2, do_vacuum(3));
+    EXPECT_EQ(1, metadata_reads);
+    EXPECT_TRUE(file_exist(vacuum_watermark_filename(5100)));
+    EXPECT_FALSE(file_exist(tablet_metadata_filename(5100, 2)));
+    EXPECT_TRUE(file_exist(tablet_metadata_filename(5100, 3)));
+
+    // Nothing after the watermark, the metadata is not read again.
+    metadata_reads = 0;
+    EXPECT_EQ(0, do_vacuum(3));
+    EXPECT_EQ(0, metadata_reads);
+
+    // The version retained by the previous vacuum can be deleted now.
+    EXPECT_EQ(1, do_vacuum(4));
+    EXPECT_EQ(1, metadata_reads);
+    EXPECT_FALSE(file_exist(tablet_metadata_filename(5100, 3)));
+    EXPECT_TRUE(file_exist(tablet_metadata_filename(5100, 4)));
+
+    SyncPoint::GetInstance()->ClearCallBack("collect_files_to_vacuum:get_tablet_metadata");
+    SyncPoint::GetInstance()->DisableProcessing();
+
+    DeleteTabletRequest request;
+    DeleteTabletResponse response;
+    request.add_tablet_ids(5100);
+    delete_tablets(_tablet_mgr.get(), request, &response);
+    EXPECT_EQ(0, response.status().status_code());
+    EXPECT_FALSE(file_exist(tablet_metadata_filename(5100, 4)));
+    EXPECT_FALSE(file_exist(vacuum_watermark_filename(5100)));
+}
+
 // NOLINTNEXTLINE
 TEST_P(LakeVacuumTest, test_thread_pool_full) {
     ASSERT_OK(_tablet_mgr->put_txn_log(json_to_pb<TxnLogPB>(R"DEL(
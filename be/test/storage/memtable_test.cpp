@@ -339,6 +339,38 @@ TEST_F(MemTableTest, testUniqKeysInsertFlushRead) {
     ASSERT_EQ(n, pkey_read);
 }
 
+TEST_F(MemTableTest, testUniqKeysMergeSortedRuns) {
+    const string path = "./MemTableTest_testUniqKeysMergeSortedRuns";
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::UNIQUE_KEYS), "pk int,name varchar,pv int",
+            path);
+    const size_t n = 1000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes;
+    indexes.reserve(2 * n);
+    for (int i = 0; i < n; i++) {
+        indexes.emplace_back(i);
+        indexes.emplace_back(i);
+    }
+    std::shuffle(indexes.begin(), indexes.end(), std::mt19937(std::random_device()()));
+    // merge after every insert, so that the memtable keeps several sorted runs
+    _mem_table->set_write_buffer_row(1);
+    const size_t batch_size = 400;
+    for (size_t from = 0; from < indexes.size(); from += batch_size) {
+        auto res = _mem_table->insert(*pchunk, indexes.data(), from, batch_size);
+        ASSERT_TRUE(res.ok());
+    }
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    auto result = _mem_table->get_result_chunk();
+    ASSERT_EQ(n, result->num_rows());
+    auto pk_column = result->get_column_by_index(0);
+    auto pv_column = result->get_column_by_index(2);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(i + 3, pk_column->get(i).get_int32());
+        ASSERT_EQ(i + 3, pv_column->get(i).get_int32());
+    }
+    ASSERT_OK(_mem_table->flush());
+}
+
 TEST_F(MemTableTest, testPrimaryKeysWithDeletes) {
     const string path = "./MemTableTest_testPrimaryKeysWithDeletes";
     MySetUp(create_tablet_schema("pk bigint,v1 int", 1, KeysType::PRIMARY_KEYS), "pk bigint,v1 int,__op tinyint", path);
@@ -184,4 +184,48 @@ TEST_F(StoragePageCacheTest, metrics) {
     ASSERT_EQ(cache.get_hit_count(), 2);
 }
 
+TEST_F(StoragePageCacheTest, compressed_tier) {
+    {
+        StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+        ASSERT_FALSE(cache.compressed_tier_enabled());
+    }
+
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048, kNumShards * 2048);
+    ASSERT_TRUE(cache.compressed_tier_enabled());
+    ASSERT_EQ(kNumShards * 2048, cache.get_compressed_capacity());
+
+    StoragePageCache::CacheKey key("abc", 0);
+    char* buf = new char[1024];
+    cache.insert_compressed(key, Slice(buf, 1024));
+    ASSERT_EQ(1024, cache.compressed_memory_usage());
+    ASSERT_EQ(0, cache.memory_usage());
+
+    {
+        // the tiers are independent
+        PageCacheHandle handle;
+        ASSERT_FALSE(cache.lookup(key, &handle));
+        ASSERT_TRUE(cache.lookup_compressed(key, &handle));
+        ASSERT_EQ(buf, handle.data().data);
+        ASSERT_EQ(1024, handle.data().size);
+    }
+
+    {
+        // promote to the decompressed tier
+        PageCacheHandle handle;
+        cache.insert(key, Slice(new char[1536], 1536), &handle, false);
+        cache.erase_compressed(key);
+        ASSERT_FALSE(cache.lookup_compressed(key, &handle));
+        ASSERT_TRUE(cache.lookup(key, &handle));
+        ASSERT_EQ(1536, handle.data().size);
+    }
+    ASSERT_EQ(0, cache.compressed_memory_usage());
+    ASSERT_EQ(2, cache.get_compressed_lookup_count());
+    ASSERT_EQ(1, cache.get_compressed_hit_count());
+    ASSERT_EQ(2, cache.get_lookup_count());
+    ASSERT_EQ(1, cache.get_hit_count());
+
+    cache.set_compressed_capacity(0);
+    ASSERT_FALSE(cache.compressed_tier_enabled());
+}
+
 } // namespace starrocks
@@ -0,0 +1,117 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/page_cache_warmer.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "common/config.h"
+#include "fs/fs_util.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class PageCacheWarmerTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _saved_capacity = config::page_cache_hot_list_capacity;
+        config::page_cache_hot_list_capacity = 1024;
+        _warmer.clear();
+        CHECK_OK(fs::remove_all(_dir));
+        CHECK_OK(fs::create_directories(_dir));
+    }
+
+    void TearDown() override {
+        config::page_cache_hot_list_capacity = _saved_capacity;
+        (void)fs::remove_all(_dir);
+    }
+
+    const std::string _dir = "./page_cache_warmer_test";
+    int32_t _saved_capacity = 0;
+    PageCacheWarmer _warmer;
+};
+
+TEST_F(PageCacheWarmerTest, test_save_and_load) {
+    for (int i = 0; i < 3; i++) {
+        _warmer.record_access("file a", 100, 10);
+    }
+    _warmer.record_access("file b", 0, 20);
+    for (int i = 0; i < 2; i++) {
+        _warmer.record_access("file b", 20, 30);
+    }
+    ASSERT_EQ(3, _warmer.num_pages());
+
+    auto pages = _warmer.hot_pages(2);
+    ASSERT_EQ(2, pages.size());
+    ASSERT_EQ("file a", pages[0].fname);
+    ASSERT_EQ(100, pages[0].offset);
+    ASSERT_EQ(3, pages[0].hits);
+    ASSERT_EQ("file b", pages[1].fname);
+    ASSERT_EQ(20, pages[1].offset);
+
+    const std::string path = _dir + "/hot_list";
+    ASSERT_OK(_warmer.save_hot_list(path, 10));
+    ASSIGN_OR_ABORT(auto loaded, PageCacheWarmer::load_hot_list(path));
+    ASSERT_EQ(3, loaded.size());
+    ASSERT_EQ("file a", loaded[0].fname);
+    ASSERT_EQ(100, loaded[0].offset);
+    ASSERT_EQ(10, loaded[0].size);
+    ASSERT_EQ(3, loaded[0].hits);
+    ASSERT_EQ("file b", loaded[2].fname);
+    ASSERT_EQ(0, loaded[2].offset);
+    ASSERT_EQ(20, loaded[2].size);
+
+    // No hot list before the first save.
+    ASSIGN_OR_ABORT(auto empty, PageCacheWarmer::load_hot_list(_dir + "/not_exist"));
+    ASSERT_TRUE(empty.empty());
+}
+
+TEST_F(PageCacheWarmerTest, test_capacity) {
+    for (int i = 0; i < 10000; i++) {
+        _warmer.record_access("file", i * 100, 100);
+    }
+    ASSERT_LE(_warmer.num_pages(), 1024);
+
+    config::page_cache_hot_list_capacity = 0;
+    _warmer.clear();
+    _warmer.record_access("file", 0, 100);
+    ASSERT_EQ(0, _warmer.num_pages());
+}
+
+TEST_F(PageCacheWarmerTest, test_warm_up) {
+    const std::string data_path = _dir + "/data";
+    {
+        std::ofstream out(data_path);
+        out << std::string(4096, 'x');
+    }
+    _warmer.record_access(data_path, 0, 1024);
+    _warmer.record_access(data_path, 1024, 1024);
+    _warmer.record_access(_dir + "/deleted", 0, 1024);
+    const std::string path = _dir + "/hot_list";
+    ASSERT_OK(_warmer.save_hot_list(path, 10));
+
+    std::atomic<bool> stopped{false};
+    ASSIGN_OR_ABORT(auto stats, PageCacheWarmer::warm_up(path, 0, stopped));
+    ASSERT_EQ(2, stats.pages);
+    ASSERT_EQ(2048, stats.bytes);
+    ASSERT_EQ(1, stats.skipped_pages);
+
+    stopped = true;
+    ASSIGN_OR_ABORT(stats, PageCacheWarmer::warm_up(path, 0, stopped));
+    ASSERT_EQ(0, stats.pages);
+}
+
+} // namespace starrocks
@@ -40,6 +40,7 @@ namespace starrocks {
 struct PersistentIndexTestParam {
     bool enable_pindex_compression;
     bool enable_pindex_read_by_page;
+    int64_t pindex_read_by_page_max_merge_bytes = 1048576;
 };
 
 class PersistentIndexTest : public testing::TestWithParam<PersistentIndexTestParam> {
@@ -48,6 +49,7 @@ public:
     void SetUp() override {
         config::enable_pindex_compression = GetParam().enable_pindex_compression;
         config::enable_pindex_read_by_page = GetParam().enable_pindex_read_by_page;
+        config::pindex_read_by_page_max_merge_bytes = GetParam().pindex_read_by_page_max_merge_bytes;
     }
 };
 
@@ -367,6 +369,72 @@ TEST_P(PersistentIndexTest, test_large_varlen_mutable_index) {
     ASSERT_EQ(upsert_not_found.size(), expect_not_found);
 }
 
+TEST_P(PersistentIndexTest, test_large_varlen_mutable_index_update) {
+    using Key = std::string;
+    const int N = 1000;
+    vector<Key> keys(N);
+    vector<Slice> key_slices;
+    vector<IndexValue> values;
+    vector<size_t> idxes;
+    key_slices.reserve(N);
+    idxes.reserve(N);
+    size_t kv_usage = 0;
+    for (int i = 0; i < N; i++) {
+        keys[i] = gen_random_string_of_random_length(65, 256);
+        values.emplace_back(i * 2);
+        key_slices.emplace_back(keys[i]);
+        idxes.push_back(i);
+        kv_usage += keys[i].size() + kIndexValueSize;
+    }
+    ASSIGN_OR_ABORT(auto idx, MutableIndex::create(0));
+    ASSERT_OK(idx->insert(key_slices.data(), values.data(), idxes));
+    ASSERT_EQ(kv_usage, idx->usage());
+    ASSERT_GE(idx->memory_usage(), kv_usage);
+
+    // values of existing keys are updated without inserting the keys again
+    vector<IndexValue> upsert_values;
+    for (int i = 0; i < N; i++) {
+        upsert_values.emplace_back(i * 3);
+    }
+    vector<IndexValue> old_values(N, IndexValue(NullIndexValue));
+    KeysInfo upsert_not_found;
+    size_t upsert_num_found = 0;
+    ASSERT_OK(idx->upsert(key_slices.data(), upsert_values.data(), old_values.data(), &upsert_not_found,
+                          &upsert_num_found, idxes));
+    ASSERT_EQ(N, upsert_num_found);
+    ASSERT_EQ(0, upsert_not_found.size());
+    ASSERT_EQ(N, idx->size());
+    ASSERT_EQ(kv_usage, idx->usage());
+    for (int i = 0; i < N; i++) {
+        ASSERT_EQ(values[i], old_values[i]);
+    }
+
+    vector<IndexValue> get_values(N);
+    KeysInfo get_not_found;
+    size_t get_num_found = 0;
+    ASSERT_OK(idx->get(key_slices.data(), get_values.data(), &get_not_found, &get_num_found, idxes));
+    ASSERT_EQ(N, get_num_found);
+    for (int i = 0; i < N; i++) {
+        ASSERT_EQ(upsert_values[i], get_values[i]);
+    }
+
+    // erased keys are kept with a null value
+    vector<IndexValue> erase_old_values(N);
+    KeysInfo erase_not_found;
+    size_t erase_num_found = 0;
+    ASSERT_OK(idx->erase(key_slices.data(), erase_old_values.data(), &erase_not_found, &erase_num_found, idxes));
+    ASSERT_EQ(N, erase_num_found);
+    ASSERT_EQ(N, idx->size());
+    get_not_found.key_infos.clear();
+    ASSERT_OK(idx->get(key_slices.data(), get_values.data(), &get_not_found, &get_num_found, idxes));
+    ASSERT_EQ(0, get_num_found);
+
+    idx->clear();
+    ASSERT_EQ(0, idx->size());
+    ASSERT_EQ(0, idx->usage());
+    ASSERT_LT(idx->memory_usage(), kv_usage);
+}
+
 TEST_P(PersistentIndexTest, test_fixlen_mutable_index_wal) {
     FileSystem* fs = FileSystem::Default();
     const std::string kPersistentIndexDir = "./PersistentIndexTest_test_fixlen_mutable_index_wal";
@@ -3183,6 +3251,7 @@ TEST_P(PersistentIndexTest, pindex_major_compact_meta) {
 
 INSTANTIATE_TEST_SUITE_P(PersistentIndexTest, PersistentIndexTest,
                          ::testing::Values(PersistentIndexTestParam{true, false},
-                                           PersistentIndexTestParam{false, true}));
+                                           PersistentIndexTestParam{false, true},
+                                           PersistentIndexTestParam{false, true, 0}));
 
 } // namespace starrocks
@@ -0,0 +1,150 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+
+#include "storage/chunk_helper.h"
+#include "storage/rowset/options.h"
+
+namespace starrocks {
+
+class AlpPageTest : public testing::Test {
+public:
+    // Compare bits, so that NaN and -0.0 are checked too.
+    template <typename CppType>
+    static void assert_bit_equal(CppType expected, CppType actual) {
+        ASSERT_EQ(0, memcmp(&expected, &actual, sizeof(CppType))) << expected << " vs " << actual;
+    }
+
+    template <LogicalType Type>
+    size_t test_encode_decode_page(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        typedef typename TypeTraits<Type>::CppType CppType;
+        const size_t size = src.size();
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        AlpPageBuilder<Type> page_builder(builder_options);
+        EXPECT_EQ(size, page_builder.add(reinterpret_cast<const uint8_t*>(src.data()), size));
+        OwnedSlice s = page_builder.finish()->build();
+        EXPECT_EQ(size, page_builder.count());
+
+        CppType first_value;
+        CppType last_value;
+        EXPECT_TRUE(page_builder.get_first_value(&first_value).ok());
+        EXPECT_TRUE(page_builder.get_last_value(&last_value).ok());
+        assert_bit_equal(src.front(), first_value);
+        assert_bit_equal(src.back(), last_value);
+
+        AlpPageDecoder<Type> page_decoder(s.slice());
+        EXPECT_TRUE(page_decoder.init().ok());
+        EXPECT_EQ(0, page_decoder.current_index());
+        EXPECT_EQ(size, page_decoder.count());
+
+        auto column = ChunkHelper::column_from_field_type(Type, false);
+        size_t size_to_fetch = size;
+        EXPECT_TRUE(page_decoder.next_batch(&size_to_fetch, column.get()).ok());
+        EXPECT_EQ(size, size_to_fetch);
+        const auto* values = reinterpret_cast<const CppType*>(column->raw_data());
+        for (size_t i = 0; i < size; i++) {
+            assert_bit_equal(src[i], values[i]);
+        }
+
+        // Seek backwards and forwards within the page.
+        for (int i = 0; i < 100; i++) {
+            uint32_t seek_off = random() % size;
+            EXPECT_TRUE(page_decoder.seek_to_position_in_page(seek_off).ok());
+            EXPECT_EQ(seek_off, page_decoder.current_index());
+            auto one = ChunkHelper::column_from_field_type(Type, false);
+            size_t n = 1;
+            EXPECT_TRUE(page_decoder.next_batch(&n, one.get()).ok());
+            EXPECT_EQ(1, n);
+            assert_bit_equal(src[seek_off], *reinterpret_cast<const CppType*>(one->raw_data()));
+        }
+
+        EXPECT_TRUE(page_decoder.seek_to_position_in_page(0).ok());
+        auto column1 = ChunkHelper::column_from_field_type(Type, false);
+        SparseRange<> read_range;
+        read_range.add(Range<>(0, size / 3));
+        read_range.add(Range<>(size / 2, (size * 2 / 3)));
+        read_range.add(Range<>((size * 3 / 4), size));
+        size_t read_num = read_range.span_size();
+        EXPECT_TRUE(page_decoder.next_batch(read_range, column1.get()).ok());
+        EXPECT_EQ(read_num, column1->size());
+        const auto* values1 = reinterpret_cast<const CppType*>(column1->raw_data());
+        SparseRangeIterator<> read_iter = read_range.new_iterator();
+        size_t offset = 0;
+        while (read_iter.has_more()) {
+            Range<> r = read_iter.next(read_num);
+            for (size_t i = 0; i < r.span_size(); ++i) {
+                assert_bit_equal(src[r.begin() + i], values1[offset + i]);
+            }
+            offset += r.span_size();
+        }
+        return s.slice().size;
+    }
+};
+
+TEST_F(AlpPageTest, TestDoubleDecimals) {
+    std::mt19937 rng(1);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(static_cast<double>(rng() % 1000000) / 100);
+    }
+    size_t encoded_size = test_encode_decode_page<TYPE_DOUBLE>(values);
+    ASSERT_LT(encoded_size, values.size() * sizeof(double) / 2);
+}
+
+TEST_F(AlpPageTest, TestDoubleExceptions) {
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(i * 0.5);
+    }
+    values[1] = std::numeric_limits<double>::quiet_NaN();
+    values[100] = -0.0;
+    values[5000] = std::numeric_limits<double>::infinity();
+    values[9999] = 1.0 / 3;
+    size_t encoded_size = test_encode_decode_page<TYPE_DOUBLE>(values);
+    ASSERT_LT(encoded_size, values.size() * sizeof(double) / 2);
+}
+
+TEST_F(AlpPageTest, TestDoubleRandom) {
+    std::mt19937_64 rng(1);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(dist(rng));
+    }
+    // Not compressible, stored as plain values.
+    size_t encoded_size = test_encode_decode_page<TYPE_DOUBLE>(values);
+    ASSERT_EQ(alp::ALP_PAGE_HEADER_SIZE + values.size() * sizeof(double), encoded_size);
+}
+
+TEST_F(AlpPageTest, TestFloatDecimals) {
+    std::mt19937 rng(1);
+    std::vector<float> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(static_cast<float>(rng() % 100000) / 10);
+    }
+    values[42] = std::numeric_limits<float>::quiet_NaN();
+    size_t encoded_size = test_encode_decode_page<TYPE_FLOAT>(values);
+    ASSERT_LT(encoded_size, values.size() * sizeof(float));
+}
+
+} // namespace starrocks
@@ -42,6 +42,7 @@
 #include "column/column.h"
 #include "common/logging.h"
 #include "gen_cpp/segment.pb.h"
+#include "runtime/global_dict/types.h"
 #include "runtime/mem_pool.h"
 #include "storage/chunk_helper.h"
 #include "storage/olap_common.h"
@@ -299,4 +300,34 @@ TEST_F(BinaryDictPageTest, TestEncodingRatio) {
     test_with_large_data_size(slices);
 }
 
+// NOLINTNEXTLINE
+TEST_F(BinaryDictPageTest, TestGlobalDictCodes) {
+    std::vector<Slice> slices{"Lifetime", "Value", "Nature", "Value", "Lifetime", "Xmas"};
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    options.dict_page_size = 256 * 1024;
+    BinaryDictPageBuilder page_builder(options);
+    ASSERT_EQ(slices.size(), page_builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+    page_builder.finish();
+
+    GlobalDictMap global_dict;
+    global_dict.emplace("Nature", 1);
+    global_dict.emplace("Lifetime", 2);
+    global_dict.emplace("Value", 3);
+    std::vector<int32_t> codes;
+    ASSERT_FALSE(page_builder.get_global_dict_codes(&global_dict, &codes));
+
+    global_dict.emplace("Xmas", 4);
+    ASSERT_TRUE(page_builder.get_global_dict_codes(&global_dict, &codes));
+    ASSERT_EQ(4, codes.size());
+
+    OwnedSlice dict_slice = page_builder.get_dictionary_page()->build();
+    BinaryPlainPageDecoder<TYPE_VARCHAR> dict_page_decoder(dict_slice.slice());
+    ASSERT_TRUE(dict_page_decoder.init().ok());
+    ASSERT_EQ(4, dict_page_decoder.dict_size());
+    for (uint32_t i = 0; i < codes.size(); i++) {
+        ASSERT_EQ(global_dict[dict_page_decoder.string_at_index(i)], codes[i]);
+    }
+}
+
 } // namespace starrocks
@@ -35,6 +35,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <vector>
 
 #include "storage/rowset/bloom_filter.h"
 #include "util/slice.h"
@@ -191,4 +192,34 @@ TEST_F(BlockBloomFilterTest, slice) {
     ASSERT_FALSE(bf->test_bytes(s.data, s.size));
 }
 
+// Test for probing several hashes at once
+TEST_F(BlockBloomFilterTest, test_any_hash) {
+    std::unique_ptr<BloomFilter> bf;
+    ASSERT_TRUE(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf).ok());
+    ASSERT_TRUE(bf->init(_expected_num, _fpp, HASH_MURMUR3_X64_64).ok());
+    std::vector<uint64_t> added;
+    for (int i = 0; i < 100; ++i) {
+        uint32_t value = i * 2;
+        added.push_back(bf->hash((char*)&value, sizeof(value)));
+        bf->add_hash(added.back());
+    }
+    std::vector<uint64_t> missing;
+    for (int i = 0; i < 100; ++i) {
+        uint32_t value = i * 2 + 1;
+        uint64_t hash = bf->hash((char*)&value, sizeof(value));
+        if (!bf->test_hash(hash)) {
+            missing.push_back(hash);
+        }
+    }
+    ASSERT_FALSE(missing.empty());
+    ASSERT_FALSE(bf->test_any_hash(missing.data(), missing.size()));
+    ASSERT_FALSE(bf->test_any_hash(nullptr, 0));
+    for (uint64_t hash : added) {
+        std::vector<uint64_t> hashes = missing;
+        hashes.push_back(hash);
+        ASSERT_TRUE(bf->test_any_hash(hashes.data(), hashes.size()));
+        ASSERT_TRUE(bf->test_any_hash(&hash, 1));
+    }
+}
+
 } // namespace starrocks
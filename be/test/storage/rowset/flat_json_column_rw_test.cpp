@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "column/column_access_path.h"
@@ -310,4 +311,39 @@ TEST_F(FlatJsonColumnRWTest, testEmptyObject) {
     EXPECT_EQ("{a: 4, b: 24}", read_json->debug_item(3));
 }
 
+TEST_F(FlatJsonColumnRWTest, testHotPathFlatJson) {
+    config::json_flat_internal_column_min_limit = 5;
+    int32_t column_max = config::json_flat_column_max;
+    config::json_flat_column_max = 2;
+    JsonPathAccessStats::instance()->clear();
+
+    ColumnPtr write_col = JsonColumn::create();
+    auto* json_col = down_cast<JsonColumn*>(write_col.get());
+    for (int i = 0; i < 5; i++) {
+        std::string json = fmt::format(R"({{"a": {0}, "b": {0}, "c": {0}, "d": {0}, "e": {0}, "f": {0}}})", i);
+        ASSIGN_OR_ABORT(auto jv, JsonValue::parse(json));
+        json_col->append(&jv);
+    }
+    std::vector<ColumnPtr> json_datas{write_col};
+
+    {
+        JsonFlattener flattener;
+        flattener.derived_paths(json_datas);
+        EXPECT_EQ(std::vector<std::string>({"a", "b"}), flattener.get_flat_paths());
+    }
+
+    // paths read by queries are extracted first
+    JsonPathAccessStats::instance()->record("e");
+    JsonPathAccessStats::instance()->record("e");
+    JsonPathAccessStats::instance()->record("f");
+    {
+        JsonFlattener flattener;
+        flattener.derived_paths(json_datas);
+        EXPECT_EQ(std::vector<std::string>({"e", "f"}), flattener.get_flat_paths());
+    }
+
+    JsonPathAccessStats::instance()->clear();
+    config::json_flat_column_max = column_max;
+}
+
 } // namespace starrocks
@@ -317,6 +317,59 @@ TEST_F(FrameOfReferencePageTest, TestInt32NormalBlockEncoderSize) {
     ASSERT_EQ(123, s.slice().size);
 }
 
+TEST_F(FrameOfReferencePageTest, TestValueBounds) {
+    std::vector<int64_t> values;
+    // frame 0: not ascending
+    for (int i = 0; i < 128; i++) {
+        values.push_back(1000 - i);
+    }
+    // frame 1: ascending
+    for (int i = 0; i < 128; i++) {
+        values.push_back(5000 + i * 2);
+    }
+    // frame 2: original values
+    for (int i = 0; i < 128; i++) {
+        values.push_back(i % 2 == 0 ? numeric_limits<int64_t>::min() : numeric_limits<int64_t>::max());
+    }
+    // frame 3: the last frame is not full
+    for (int i = 0; i < 10; i++) {
+        values.push_back(-20 + i);
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    FrameOfReferencePageBuilder<TYPE_BIGINT> page_builder(builder_options);
+    ASSERT_EQ(values.size(), page_builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+    OwnedSlice s = page_builder.finish()->build();
+
+    FrameOfReferencePageDecoder<TYPE_BIGINT> page_decoder(s.slice());
+    ASSERT_TRUE(page_decoder.init().ok());
+
+    uint32_t end = 0;
+    int64_t lower = 0;
+    int64_t upper = 0;
+    ASSERT_TRUE(page_decoder.value_bounds(5, &end, &lower, &upper));
+    ASSERT_EQ(128, end);
+    ASSERT_EQ(873, lower);
+    ASSERT_GE(upper, 1000);
+
+    ASSERT_TRUE(page_decoder.value_bounds(128, &end, &lower, &upper));
+    ASSERT_EQ(256, end);
+    ASSERT_EQ(5000, lower);
+    ASSERT_GE(upper, 5254);
+
+    ASSERT_FALSE(page_decoder.value_bounds(300, &end, &lower, &upper));
+
+    ASSERT_TRUE(page_decoder.value_bounds(390, &end, &lower, &upper));
+    ASSERT_EQ(values.size(), end);
+    ASSERT_EQ(-20, lower);
+    ASSERT_GE(upper, -11);
+
+    ASSERT_FALSE(page_decoder.value_bounds(values.size(), &end, &lower, &upper));
+
+    // The bounds do not move the decoder.
+    ASSERT_EQ(0, page_decoder.current_index());
+}
+
 TEST_F(FrameOfReferencePageTest, TestFindBitsOfInt) {
     int8_t bits_3 = 0x06;
     ASSERT_EQ(3, bits(bits_3));
@@ -0,0 +1,170 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/hnsw_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace starrocks {
+
+class HnswIndexTest : public testing::Test {
+protected:
+    static constexpr uint32_t kDim = 16;
+    static constexpr uint32_t kNumVectors = 2000;
+
+    void SetUp() override {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> dist(-1.0, 1.0);
+        _vectors.resize(kNumVectors * kDim);
+        for (auto& v : _vectors) {
+            v = dist(rng);
+        }
+        _query.resize(kDim);
+        for (auto& v : _query) {
+            v = dist(rng);
+        }
+    }
+
+    std::unique_ptr<HnswIndex> build(VectorIndexMetricPB metric) {
+        HnswIndex::Options opts;
+        opts.dim = kDim;
+        opts.metric = metric;
+        auto index = std::make_unique<HnswIndex>(opts);
+        for (uint32_t i = 0; i < kNumVectors; i++) {
+            // Leave gaps in the row ids, as null rows are not indexed.
+            index->add(i * 2, _vectors.data() + i * kDim);
+        }
+        return index;
+    }
+
+    std::vector<rowid_t> brute_force(VectorIndexMetricPB metric, uint32_t k, const roaring::Roaring* filter) {
+        auto norm = [](const float* v) {
+            float sum = 0;
+            for (uint32_t d = 0; d < kDim; d++) sum += v[d] * v[d];
+            return std::sqrt(sum);
+        };
+        std::vector<std::pair<float, rowid_t>> dists;
+        for (uint32_t i = 0; i < kNumVectors; i++) {
+            if (filter != nullptr && !filter->contains(i * 2)) {
+                continue;
+            }
+            const float* v = _vectors.data() + i * kDim;
+            float dist = 0;
+            if (metric == L2_DISTANCE) {
+                for (uint32_t d = 0; d < kDim; d++) dist += (v[d] - _query[d]) * (v[d] - _query[d]);
+            } else {
+                float dot = 0;
+                for (uint32_t d = 0; d < kDim; d++) dot += v[d] * _query[d];
+                dist = -dot / (norm(v) * norm(_query.data()));
+            }
+            dists.emplace_back(dist, i * 2);
+        }
+        std::sort(dists.begin(), dists.end());
+        std::vector<rowid_t> result;
+        for (uint32_t i = 0; i < k && i < dists.size(); i++) {
+            result.push_back(dists[i].second);
+        }
+        return result;
+    }
+
+    static double recall(const std::vector<rowid_t>& expected, const std::vector<rowid_t>& actual) {
+        size_t hits = 0;
+        for (auto rowid : actual) {
+            hits += std::find(expected.begin(), expected.end(), rowid) != expected.end();
+        }
+        return static_cast<double>(hits) / expected.size();
+    }
+
+    std::vector<float> _vectors;
+    std::vector<float> _query;
+};
+
+TEST_F(HnswIndexTest, test_l2_recall) {
+    auto index = build(L2_DISTANCE);
+    ASSERT_EQ(kNumVectors, index->size());
+    auto result = index->search(_query.data(), 10, 100, nullptr);
+    ASSERT_EQ(10, result.size());
+    ASSERT_GE(recall(brute_force(L2_DISTANCE, 10, nullptr), result), 0.9);
+}
+
+TEST_F(HnswIndexTest, test_cosine_recall) {
+    auto index = build(COSINE_SIMILARITY);
+    auto result = index->search(_query.data(), 10, 100, nullptr);
+    ASSERT_EQ(10, result.size());
+    ASSERT_GE(recall(brute_force(COSINE_SIMILARITY, 10, nullptr), result), 0.9);
+}
+
+TEST_F(HnswIndexTest, test_filtered_search) {
+    auto index = build(L2_DISTANCE);
+    roaring::Roaring filter;
+    for (uint32_t i = 0; i < kNumVectors; i += 3) {
+        filter.add(i * 2);
+    }
+    auto result = index->search(_query.data(), 10, 100, &filter);
+    ASSERT_EQ(10, result.size());
+    for (auto rowid : result) {
+        ASSERT_TRUE(filter.contains(rowid));
+    }
+    ASSERT_GE(recall(brute_force(L2_DISTANCE, 10, &filter), result), 0.9);
+
+    roaring::Roaring empty;
+    ASSERT_TRUE(index->search(_query.data(), 10, 100, &empty).empty());
+}
+
+TEST_F(HnswIndexTest, test_empty_index) {
+    HnswIndex::Options opts;
+    opts.dim = kDim;
+    HnswIndex index(opts);
+    ASSERT_TRUE(index.search(_query.data(), 10, 100, nullptr).empty());
+
+    std::string buf;
+    index.serialize(&buf);
+    auto res = HnswIndex::deserialize(Slice(buf));
+    ASSERT_TRUE(res.ok()) << res.status();
+    ASSERT_EQ(0, (*res)->size());
+}
+
+TEST_F(HnswIndexTest, test_serialize) {
+    auto index = build(COSINE_SIMILARITY);
+    std::string buf;
+    index->serialize(&buf);
+
+    auto res = HnswIndex::deserialize(Slice(buf));
+    ASSERT_TRUE(res.ok()) << res.status();
+    auto& loaded = *res;
+    ASSERT_EQ(kDim, loaded->dim());
+    ASSERT_EQ(COSINE_SIMILARITY, loaded->metric());
+    ASSERT_EQ(index->rowids(), loaded->rowids());
+    ASSERT_EQ(index->search(_query.data(), 10, 64, nullptr), loaded->search(_query.data(), 10, 64, nullptr));
+}
+
+TEST_F(HnswIndexTest, test_deserialize_corruption) {
+    auto index = build(L2_DISTANCE);
+    std::string buf;
+    index->serialize(&buf);
+
+    ASSERT_FALSE(HnswIndex::deserialize(Slice(buf.data(), 10)).ok());
+    ASSERT_FALSE(HnswIndex::deserialize(Slice(buf.data(), buf.size() - 1)).ok());
+    std::string bad_version = buf;
+    bad_version[0] = 9;
+    ASSERT_FALSE(HnswIndex::deserialize(Slice(bad_version)).ok());
+    std::string trailing = buf + "x";
+    ASSERT_FALSE(HnswIndex::deserialize(Slice(trailing)).ok());
+}
+
+} // namespace starrocks
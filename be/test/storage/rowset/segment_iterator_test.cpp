@@ -26,6 +26,7 @@
 #include "gen_cpp/tablet_schema.pb.h"
 #include "gtest/gtest.h"
 #include "storage/chunk_helper.h"
+#include "storage/delete_predicate_bitmap_cache.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/segment.h"
@@ -530,4 +531,72 @@ TEST_F(SegmentIteratorTest, TestGlobalDictNoLocalDict) {
     res_chunk->reset();
 }
 
+// NOLINTNEXTLINE
+TEST_F(SegmentIteratorTest, TestDeletePredicateBitmap) {
+    using namespace starrocks::test;
+
+    std::string file_name = kSegmentDir + "/delete_predicate_bitmap";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+    TabletSchemaBuilder builder;
+    std::shared_ptr<TabletSchema> tablet_schema =
+            builder.create(1, false, TYPE_INT, true).create(2, false, TYPE_INT).build();
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+
+    const int32_t chunk_size = config::vector_chunk_size;
+    const size_t num_rows = 10000;
+    TabletDataBuilder segment_data_builder(writer, tablet_schema, chunk_size, num_rows);
+    ASSERT_OK(segment_data_builder.append(0, [](int32_t i) { return i; }));
+    ASSERT_OK(segment_data_builder.append(1, [](int32_t i) { return i % 10; }));
+    ASSERT_OK(segment_data_builder.finalize_footer());
+
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    // DELETE WHERE c1 = 3 and DELETE WHERE c0 >= 9000.
+    ObjectPool pool;
+    auto type_int = get_type_info(TYPE_INT);
+    ConjunctivePredicates del1({pool.add(new_column_eq_predicate(type_int, 1, "3"))});
+    ConjunctivePredicates del2({pool.add(new_column_ge_predicate(type_int, 0, "9000"))});
+
+    VecSchemaBuilder schema_builder;
+    schema_builder.add(0, "c0", TYPE_INT).add(1, "c1", TYPE_INT);
+    auto vec_schema = schema_builder.build();
+
+    ASSERT_TRUE(DeletePredicateBitmapCache::instance()->enabled());
+    const size_t memory_usage = DeletePredicateBitmapCache::instance()->memory_usage();
+    // The first scan builds the bitmap and the second one reads it from the cache.
+    for (int i = 0; i < 2; i++) {
+        OlapReaderStatistics stats;
+        SegmentReadOptions seg_opts;
+        seg_opts.fs = _fs;
+        seg_opts.stats = &stats;
+        seg_opts.delete_predicates.add(del1);
+        seg_opts.delete_predicates.add(del2);
+
+        auto chunk_iter = new_segment_iterator(segment, vec_schema, seg_opts);
+        ASSERT_OK(chunk_iter->init_output_schema(std::unordered_set<uint32_t>()));
+        auto res_chunk = ChunkHelper::new_chunk(chunk_iter->output_schema(), chunk_size);
+        size_t total = 0;
+        while (true) {
+            res_chunk->reset();
+            auto st = chunk_iter->get_next(res_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (size_t row = 0; row < res_chunk->num_rows(); row++) {
+                ASSERT_LT(res_chunk->get_column_by_index(0)->get(row).get_int32(), 9000);
+                ASSERT_NE(res_chunk->get_column_by_index(1)->get(row).get_int32(), 3);
+            }
+            total += res_chunk->num_rows();
+        }
+        chunk_iter->close();
+        ASSERT_EQ(8100, total);
+        ASSERT_EQ(1900, stats.rows_del_filtered);
+        ASSERT_GT(DeletePredicateBitmapCache::instance()->memory_usage(), memory_usage);
+    }
+}
+
 } // namespace starrocks
@@ -55,6 +55,7 @@
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -271,6 +272,71 @@ TEST_F(SegmentReaderWriterTest, TestHorizontalWrite) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(SegmentReaderWriterTest, TestIOCoalesceRead) {
+    std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
+            {create_int_key_pb(1), create_int_value_pb(2), create_int_value_pb(3)});
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 100;
+
+    std::string file_name = kSegmentDir + "/io_coalesce_read_case";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    size_t num_rows = 10000;
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, num_rows);
+    auto& cols = chunk->columns();
+    for (auto i = 0; i < num_rows; ++i) {
+        cols[0]->append_datum(Datum(static_cast<int32_t>(i)));
+        cols[1]->append_datum(Datum(static_cast<int32_t>(i + 1)));
+        cols[2]->append_datum(Datum(static_cast<int32_t>(i + 2)));
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+
+    uint64_t file_size = 0;
+    uint64_t index_size;
+    uint64_t footer_position;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    // The pages of all the columns are read through one coalesced stream.
+    const bool old_enable = config::io_coalesce_local_read_enable;
+    config::io_coalesce_local_read_enable = true;
+    DeferOp defer([&]() { config::io_coalesce_local_read_enable = old_enable; });
+
+    SegmentReadOptions seg_options;
+    seg_options.fs = _fs;
+    OlapReaderStatistics stats;
+    seg_options.stats = &stats;
+    auto res = segment->new_iterator(schema, seg_options);
+    ASSERT_FALSE(res.status().is_end_of_file() || !res.ok() || res.value() == nullptr);
+    auto seg_iterator = res.value();
+
+    size_t count = 0;
+    while (true) {
+        chunk->reset();
+        auto st = seg_iterator->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_FALSE(!st.ok());
+        for (auto i = 0; i < chunk->num_rows(); ++i) {
+            EXPECT_EQ(count, chunk->get(i)[0].get_int32());
+            EXPECT_EQ(count + 1, chunk->get(i)[1].get_int32());
+            EXPECT_EQ(count + 2, chunk->get(i)[2].get_int32());
+            ++count;
+        }
+    }
+    EXPECT_EQ(count, num_rows);
+    seg_iterator->close();
+}
+
 // NOLINTNEXTLINE
 TEST_F(SegmentReaderWriterTest, TestVerticalWrite) {
     std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
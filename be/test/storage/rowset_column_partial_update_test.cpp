@@ -722,6 +722,10 @@ TEST_P(RowsetColumnPartialUpdateTest, test_dcg_gc) {
     // Only run one parameter here
     if (GetParam() != 104857600) return;
     fs::remove_all(get_stores()->path());
+    // keep all the delta column groups, to check them cleared one by one
+    int32_t old_threshold = config::partial_update_merge_delta_column_group_threshold;
+    config::partial_update_merge_delta_column_group_threshold = 0;
+    DeferOp defer([&]() { config::partial_update_merge_delta_column_group_threshold = old_threshold; });
     const int N = 100;
     auto tablet = create_tablet(rand(), rand());
     ASSERT_EQ(1, tablet->updates()->version_history_count());
@@ -767,6 +771,38 @@ TEST_P(RowsetColumnPartialUpdateTest, test_dcg_gc) {
     }));
 }
 
+TEST_P(RowsetColumnPartialUpdateTest, test_merge_delta_column_groups) {
+    // Only run one parameter here
+    if (GetParam() != 104857600) return;
+    fs::remove_all(get_stores()->path());
+    int32_t old_threshold = config::partial_update_merge_delta_column_group_threshold;
+    config::partial_update_merge_delta_column_group_threshold = 2;
+    DeferOp defer([&]() { config::partial_update_merge_delta_column_group_threshold = old_threshold; });
+    const int N = 100;
+    auto tablet = create_tablet(rand(), rand());
+    ASSERT_EQ(1, tablet->updates()->version_history_count());
+    int64_t version = 1;
+    int64_t version_before_partial_update = 1;
+    auto meta = tablet->data_dir()->get_meta();
+    prepare_tablet(this, tablet, version, version_before_partial_update, N);
+    // the newest delta column group covers both v1 and v2, so all the 9 older ones can be cleared
+    StatusOr<size_t> clear_size = StorageEngine::instance()->update_manager()->clear_delta_column_group_before_version(
+            meta, tablet->schema_hash_path(), tablet->tablet_id(), version + 1);
+    ASSERT_TRUE(clear_size.ok());
+    ASSERT_EQ(*clear_size, 9);
+    ASSERT_TRUE(check_tablet(tablet, version, N, [](int64_t k1, int64_t v1, int32_t v2) {
+        return (int16_t)(k1 % 100 + 3) == v1 && (int32_t)(k1 % 1000 + 4) == v2;
+    }));
+    // check delta column files gc
+    tablet->data_dir()->perform_delta_column_files_gc();
+    tablet->data_dir()->perform_path_gc_by_rowsetid();
+    tablet->data_dir()->perform_path_scan();
+    ASSERT_EQ(tablet->data_dir()->get_all_check_dcg_files_cnt(), 2);
+    ASSERT_TRUE(check_tablet(tablet, version, N, [](int64_t k1, int64_t v1, int32_t v2) {
+        return (int16_t)(k1 % 100 + 3) == v1 && (int32_t)(k1 % 1000 + 4) == v2;
+    }));
+}
+
 TEST_P(RowsetColumnPartialUpdateTest, test_get_column_values) {
     const int N = 100;
     auto tablet = create_tablet(rand(), rand());
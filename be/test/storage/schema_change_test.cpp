@@ -814,4 +814,57 @@ TEST_F(SchemaChangeTest, schema_change_with_materialized_column_optimization) {
     (void)StorageEngine::instance()->tablet_manager()->drop_tablet(1402);
 }
 
+TEST_F(SchemaChangeTest, parse_request_lazy_type_change) {
+    auto make_schema = [](const std::string& key_type, const std::string& value_type, int32_t value_length) {
+        TabletSchemaPB schema_pb;
+        schema_pb.set_keys_type(DUP_KEYS);
+        schema_pb.set_num_short_key_columns(1);
+        ColumnPB* key = schema_pb.add_column();
+        key->set_unique_id(0);
+        key->set_name("k");
+        key->set_type(key_type);
+        key->set_is_key(true);
+        key->set_is_nullable(false);
+        key->set_length(key_type == "INT" ? 4 : 8);
+        ColumnPB* value = schema_pb.add_column();
+        value->set_unique_id(1);
+        value->set_name("v");
+        value->set_type(value_type);
+        value->set_is_key(false);
+        value->set_is_nullable(true);
+        value->set_length(value_length);
+        value->set_aggregation("NONE");
+        return std::make_shared<TabletSchema>(schema_pb);
+    };
+    auto parse = [](const TabletSchemaCSPtr& base_schema, const TabletSchemaCSPtr& new_schema, bool* sc_directly) {
+        ChunkChanger chunk_changer(new_schema);
+        MaterializedViewParamMap materialized_view_param_map;
+        std::unique_ptr<TExpr> where_expr;
+        bool sc_sorting = false;
+        *sc_directly = false;
+        return SchemaChangeUtils::parse_request(base_schema, new_schema, &chunk_changer, materialized_view_param_map,
+                                                where_expr, false, &sc_sorting, sc_directly, nullptr);
+    };
+
+    bool sc_directly = false;
+    // widening a value column is done by linking
+    ASSERT_OK(parse(make_schema("INT", "INT", 4), make_schema("INT", "BIGINT", 8), &sc_directly));
+    ASSERT_FALSE(sc_directly);
+    ASSERT_OK(parse(make_schema("INT", "VARCHAR", 10), make_schema("INT", "VARCHAR", 20), &sc_directly));
+    ASSERT_FALSE(sc_directly);
+    // narrowing and lossy conversions rewrite the data
+    ASSERT_OK(parse(make_schema("INT", "BIGINT", 8), make_schema("INT", "INT", 4), &sc_directly));
+    ASSERT_TRUE(sc_directly);
+    ASSERT_OK(parse(make_schema("INT", "INT", 4), make_schema("INT", "VARCHAR", 20), &sc_directly));
+    ASSERT_TRUE(sc_directly);
+    // key columns are never changed lazily
+    ASSERT_OK(parse(make_schema("INT", "INT", 4), make_schema("BIGINT", "INT", 4), &sc_directly));
+    ASSERT_TRUE(sc_directly);
+
+    config::enable_lazy_schema_change = false;
+    ASSERT_OK(parse(make_schema("INT", "INT", 4), make_schema("INT", "BIGINT", 8), &sc_directly));
+    ASSERT_TRUE(sc_directly);
+    config::enable_lazy_schema_change = true;
+}
+
 } // namespace starrocks
@@ -0,0 +1,209 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/shared_scan.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "column/datum.h"
+#include "storage/chunk_helper.h"
+
+namespace starrocks {
+
+// Returns the INT rows [0, num_rows) in chunks of |chunk_rows|.
+class RangeIterator final : public ChunkIterator {
+public:
+    RangeIterator(int32_t num_rows, int32_t chunk_rows)
+            : ChunkIterator(schema(), chunk_rows), _num_rows(num_rows), _chunk_rows(chunk_rows) {}
+
+    static Schema schema() {
+        FieldPtr f = std::make_shared<Field>(0, "c0", get_type_info(TYPE_INT), false);
+        return Schema(std::vector<FieldPtr>{f});
+    }
+
+    void close() override {}
+
+protected:
+    Status do_get_next(Chunk* chunk) override {
+        if (_next >= _num_rows) {
+            return Status::EndOfFile("eof");
+        }
+        for (int32_t i = 0; i < _chunk_rows && _next < _num_rows; i++) {
+            chunk->get_column_by_index(0)->append_datum(Datum(_next++));
+        }
+        return Status::OK();
+    }
+
+private:
+    const int32_t _num_rows;
+    const int32_t _chunk_rows;
+    int32_t _next = 0;
+};
+
+class SharedScanTest : public testing::Test {
+protected:
+    std::shared_ptr<SharedScanStream> new_stream(int32_t num_rows, int32_t chunk_rows, size_t window_chunks) {
+        auto factory = [num_rows, chunk_rows]() -> StatusOr<ChunkIteratorPtr> {
+            return std::make_shared<RangeIterator>(num_rows, chunk_rows);
+        };
+        return std::make_shared<SharedScanStream>(factory, window_chunks, nullptr);
+    }
+
+    std::shared_ptr<SharedScanIterator> new_iterator(const std::shared_ptr<SharedScanStream>& stream) {
+        return std::make_shared<SharedScanIterator>(RangeIterator::schema(), 4096, stream);
+    }
+
+    // Reads the next chunk of |iter| into |rows|, returns false at the end.
+    static bool read_next(ChunkIterator* iter, std::vector<int32_t>* rows) {
+        auto chunk = ChunkHelper::new_chunk(iter->schema(), 4096);
+        Status st = iter->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            return false;
+        }
+        CHECK(st.ok()) << st;
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            rows->emplace_back(chunk->get_column_by_index(0)->get(i).get_int32());
+        }
+        return true;
+    }
+
+    static void read_all(ChunkIterator* iter, std::vector<int32_t>* rows) {
+        while (read_next(iter, rows)) {
+        }
+    }
+
+    static void assert_all_rows(std::vector<int32_t> rows, int32_t num_rows) {
+        std::sort(rows.begin(), rows.end());
+        ASSERT_EQ(num_rows, rows.size());
+        for (int32_t i = 0; i < num_rows; i++) {
+            ASSERT_EQ(i, rows[i]);
+        }
+    }
+};
+
+// NOLINTNEXTLINE
+TEST_F(SharedScanTest, test_concurrent_subscribers) {
+    auto stream = new_stream(100, 10, 4);
+    auto iter1 = new_iterator(stream);
+    auto iter2 = new_iterator(stream);
+    std::vector<int32_t> rows1;
+    std::vector<int32_t> rows2;
+    bool more1 = true;
+    bool more2 = true;
+    while (more1 || more2) {
+        more1 = more1 && read_next(iter1.get(), &rows1);
+        more2 = more2 && read_next(iter2.get(), &rows2);
+    }
+    assert_all_rows(rows1, 100);
+    assert_all_rows(rows2, 100);
+    ASSERT_EQ(1, stream->num_passes());
+    ASSERT_EQ(100, iter1->shared_rows());
+    ASSERT_EQ(100, iter2->shared_rows());
+    iter1->close();
+    iter2->close();
+    ASSERT_EQ(0, stream->num_subscribers());
+}
+
+// NOLINTNEXTLINE
+TEST_F(SharedScanTest, test_latecomer_wraps_around) {
+    auto stream = new_stream(100, 10, 4);
+    auto iter1 = new_iterator(stream);
+    std::vector<int32_t> rows1;
+    for (int i = 0; i < 5; i++) {
+        ASSERT_TRUE(read_next(iter1.get(), &rows1));
+    }
+    // Joins in the middle of the first pass, shares the rest of it and reads the rows it missed by the next pass.
+    auto iter2 = new_iterator(stream);
+    std::vector<int32_t> rows2;
+    bool more1 = true;
+    bool more2 = true;
+    while (more1 || more2) {
+        more1 = more1 && read_next(iter1.get(), &rows1);
+        more2 = more2 && read_next(iter2.get(), &rows2);
+    }
+    assert_all_rows(rows1, 100);
+    assert_all_rows(rows2, 100);
+    ASSERT_EQ(50, rows2.front());
+    ASSERT_EQ(2, stream->num_passes());
+    ASSERT_EQ(0, iter2->private_rows());
+}
+
+// NOLINTNEXTLINE
+TEST_F(SharedScanTest, test_lagging_subscriber_detached) {
+    auto stream = new_stream(100, 10, 2);
+    auto iter1 = new_iterator(stream);
+    auto iter2 = new_iterator(stream);
+    std::vector<int32_t> rows2;
+    ASSERT_TRUE(read_next(iter2.get(), &rows2));
+    // |iter2| stops consuming, |iter1| detaches it rather than waiting for it.
+    std::vector<int32_t> rows1;
+    read_all(iter1.get(), &rows1);
+    assert_all_rows(rows1, 100);
+    ASSERT_EQ(1, stream->num_subscribers());
+
+    read_all(iter2.get(), &rows2);
+    assert_all_rows(rows2, 100);
+    ASSERT_TRUE(iter2->detached());
+    ASSERT_EQ(10, iter2->shared_rows());
+    ASSERT_EQ(90, iter2->private_rows());
+}
+
+// NOLINTNEXTLINE
+TEST_F(SharedScanTest, test_wait_for_slower_subscriber) {
+    auto stream = new_stream(100, 10, 2);
+    auto iter1 = new_iterator(stream);
+    auto iter2 = new_iterator(stream);
+    std::vector<int32_t> rows1;
+    std::vector<int32_t> rows2;
+    ASSERT_TRUE(read_next(iter1.get(), &rows1));
+    ASSERT_TRUE(read_next(iter1.get(), &rows1));
+    // The window is full, |iter2| has read nothing yet but still holds the oldest chunk.
+    ASSERT_TRUE(read_next(iter2.get(), &rows2));
+    ASSERT_TRUE(read_next(iter1.get(), &rows1));
+    ASSERT_FALSE(iter2->detached());
+    read_all(iter2.get(), &rows2);
+    read_all(iter1.get(), &rows1);
+    assert_all_rows(rows1, 100);
+    assert_all_rows(rows2, 100);
+}
+
+// NOLINTNEXTLINE
+TEST_F(SharedScanTest, test_empty_stream) {
+    auto stream = new_stream(0, 10, 2);
+    auto iter = new_iterator(stream);
+    std::vector<int32_t> rows;
+    ASSERT_FALSE(read_next(iter.get(), &rows));
+    ASSERT_TRUE(rows.empty());
+}
+
+// NOLINTNEXTLINE
+TEST_F(SharedScanTest, test_manager) {
+    auto factory = []() -> StatusOr<ChunkIteratorPtr> { return std::make_shared<RangeIterator>(10, 10); };
+    auto* manager = SharedScanManager::instance();
+    auto stream1 = manager->get_or_create("shared_scan_test", factory, nullptr);
+    auto stream2 = manager->get_or_create("shared_scan_test", factory, nullptr);
+    auto stream3 = manager->get_or_create("shared_scan_test_other", factory, nullptr);
+    ASSERT_EQ(stream1, stream2);
+    ASSERT_NE(stream1, stream3);
+    stream1.reset();
+    stream2.reset();
+    auto stream4 = manager->get_or_create("shared_scan_test", factory, nullptr);
+    ASSERT_NE(nullptr, stream4);
+    ASSERT_EQ(1, stream4.use_count());
+}
+
+} // namespace starrocks
@@ -38,6 +38,7 @@
 #include "storage/storage_engine.h"
 #include "storage/tablet_meta.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -1583,4 +1584,44 @@ TEST_F(SizeTieredCompactionPolicyTest, test_one_delete_shortcut_compaction) {
     }
 }
 
+TEST_F(SizeTieredCompactionPolicyTest, test_read_amplification_score) {
+    create_tablet_schema(DUP_KEYS);
+
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+
+    // the keys of every version are greater than the ones of the previous versions
+    for (int i = 0; i < 3; ++i) {
+        write_new_version(tablet_meta);
+    }
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(tablet_meta, starrocks::StorageEngine::instance()->get_stores()[0]);
+    ASSERT_OK(tablet->init());
+
+    auto score_of = [&]() {
+        SizeTieredCompactionPolicy policy(tablet.get());
+        double score = 0;
+        CompactionType type = CUMULATIVE_COMPACTION;
+        EXPECT_TRUE(policy.need_compaction(&score, &type));
+        return score;
+    };
+    // the ranges are unknown before the segments are loaded
+    double unknown_score = score_of();
+
+    std::vector<RowsetSharedPtr> rowsets;
+    tablet->pick_all_candicate_rowsets(&rowsets);
+    for (const auto& rowset : rowsets) {
+        ASSERT_OK(rowset->load());
+    }
+    // the segments are disjoint and the tablet is never scanned
+    double disjoint_score = score_of();
+    ASSERT_LT(disjoint_score, unknown_score);
+    ASSERT_GT(disjoint_score, 0);
+
+    config::enable_size_tiered_read_amplification_score = false;
+    DeferOp defer([]() { config::enable_size_tiered_read_amplification_score = true; });
+    ASSERT_DOUBLE_EQ(unknown_score, score_of());
+}
+
 } // namespace starrocks
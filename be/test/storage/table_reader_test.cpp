@@ -19,12 +19,15 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <thread>
 
 #include "column/datum_tuple.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/descriptor_helper.h"
 #include "storage/chunk_helper.h"
+#include "storage/row_cache.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_options.h"
 #include "storage/rowset/rowset_writer.h"
@@ -37,6 +40,7 @@
 #include "storage/union_iterator.h"
 #include "storage/update_manager.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -326,4 +330,135 @@ TEST_F(TableReaderTest, test_basic_read) {
     verify_chunk_eq(scan_value_schema, expect_scan_result.get(), scan_result.get());
 }
 
+TEST_F(TableReaderTest, test_coalesced_multi_get) {
+    DatumTupleVector rows;
+    create_row(rows, (int64_t)1, (int32_t)1, (int32_t)1, (int16_t)1, (int32_t)1);
+    create_row(rows, (int64_t)1, (int32_t)1, (int32_t)2, (int16_t)2, (int32_t)2);
+    create_row(rows, (int64_t)1, (int32_t)1, (int32_t)3, (int16_t)3, (int32_t)3);
+    create_rowset(_tablets[0], 2, rows, 0, 3);
+    while (true) {
+        std::vector<RowsetSharedPtr> dummy_rowsets;
+        EditVersion full_version;
+        ASSERT_TRUE(_tablets[0]->updates()->get_applied_rowsets(2, &dummy_rowsets, &full_version).ok());
+        if (full_version.major_number() == 2) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    auto old_window = config::short_circuit_multi_get_batch_window_us;
+    config::short_circuit_multi_get_batch_window_us = 20000;
+    DeferOp defer([&]() { config::short_circuit_multi_get_batch_window_us = old_window; });
+
+    // concurrent single key lookups are coalesced, and each of them gets its own result
+    constexpr int kNumThreads = 8;
+    std::vector<Status> statuses(kNumThreads);
+    std::vector<std::vector<bool>> founds(kNumThreads);
+    std::vector<ChunkPtr> value_chunks(kNumThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumThreads; i++) {
+        threads.emplace_back([&, i]() {
+            LocalTableReaderParams params;
+            params.version = 2;
+            params.tablet_id = _tablets[0]->tablet_id();
+            auto table_reader = std::make_shared<TableReader>();
+            statuses[i] = table_reader->init(params);
+            if (!statuses[i].ok()) {
+                return;
+            }
+            ChunkPtr key_chunk = ChunkHelper::new_chunk(_key_schema, 1);
+            key_chunk->get_column_by_index(0)->append_datum(Datum((int64_t)1));
+            key_chunk->get_column_by_index(1)->append_datum(Datum((int32_t)1));
+            // key (1, 1, 4) is not found
+            key_chunk->get_column_by_index(2)->append_datum(Datum((int32_t)(i % 4 + 1)));
+            value_chunks[i] = ChunkHelper::new_chunk(_value_schema, 1);
+            statuses[i] = table_reader->multi_get(*key_chunk, {"v1", "v2"}, founds[i], *value_chunks[i]);
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (int i = 0; i < kNumThreads; i++) {
+        ASSERT_OK(statuses[i]);
+        ASSERT_EQ(1, founds[i].size());
+        if (i % 4 == 3) {
+            ASSERT_FALSE(founds[i][0]);
+            ASSERT_EQ(0, value_chunks[i]->num_rows());
+        } else {
+            ASSERT_TRUE(founds[i][0]);
+            ChunkPtr expected_value_chunk = ChunkHelper::new_chunk(_value_schema, 1);
+            expected_value_chunk->get_column_by_index(0)->append_datum(rows[i % 4].get(3));
+            expected_value_chunk->get_column_by_index(1)->append_datum(rows[i % 4].get(4));
+            verify_chunk_eq(_value_schema, expected_value_chunk.get(), value_chunks[i].get());
+        }
+    }
+}
+
+TEST_F(TableReaderTest, test_multi_get_with_row_cache) {
+    RowCache::create_global_cache(nullptr, 1024 * 1024);
+    DeferOp defer([]() { RowCache::release_global_cache(); });
+    auto* row_cache = RowCache::instance();
+
+    auto wait_for_version = [&](int64_t version) {
+        while (true) {
+            std::vector<RowsetSharedPtr> dummy_rowsets;
+            EditVersion full_version;
+            ASSERT_TRUE(_tablets[0]->updates()->get_applied_rowsets(version, &dummy_rowsets, &full_version).ok());
+            if (full_version.major_number() == version) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+    };
+    auto multi_get = [&](int64_t version, DatumTuple& row, std::vector<bool>& found, ChunkPtr& value_chunk) {
+        LocalTableReaderParams params;
+        params.version = version;
+        params.tablet_id = _tablets[0]->tablet_id();
+        auto table_reader = std::make_shared<TableReader>();
+        ASSERT_OK(table_reader->init(params));
+        ChunkPtr key_chunk = ChunkHelper::new_chunk(_key_schema, 2);
+        for (int i = 0; i < 3; i++) {
+            key_chunk->get_column_by_index(i)->append_datum(row.get(i));
+        }
+        // key (1, 1, 9) is not found
+        key_chunk->get_column_by_index(0)->append_datum(Datum((int64_t)1));
+        key_chunk->get_column_by_index(1)->append_datum(Datum((int32_t)1));
+        key_chunk->get_column_by_index(2)->append_datum(Datum((int32_t)9));
+        value_chunk = ChunkHelper::new_chunk(_value_schema, 2);
+        ASSERT_OK(table_reader->multi_get(*key_chunk, {"v1", "v2"}, found, *value_chunk));
+    };
+
+    DatumTupleVector rows;
+    create_row(rows, (int64_t)1, (int32_t)1, (int32_t)1, (int16_t)1, (int32_t)1);
+    create_row(rows, (int64_t)1, (int32_t)1, (int32_t)1, (int16_t)2, (int32_t)2);
+    create_rowset(_tablets[0], 2, rows, 0, 1);
+    wait_for_version(2);
+
+    ChunkPtr expected = ChunkHelper::new_chunk(_value_schema, 1);
+    expected->get_column_by_index(0)->append_datum(rows[0].get(3));
+    expected->get_column_by_index(1)->append_datum(rows[0].get(4));
+    for (int i = 0; i < 2; i++) {
+        std::vector<bool> found;
+        ChunkPtr value_chunk;
+        auto hit_count = row_cache->get_hit_count();
+        multi_get(2, rows[0], found, value_chunk);
+        ASSERT_EQ((std::vector<bool>{true, false}), found);
+        verify_chunk_eq(_value_schema, expected.get(), value_chunk.get());
+        // the second lookup is served by the row cache
+        ASSERT_EQ(hit_count + i, row_cache->get_hit_count());
+    }
+
+    // the upsert erases the cached row
+    create_rowset(_tablets[0], 3, rows, 1, 2);
+    wait_for_version(3);
+    expected->reset();
+    expected->get_column_by_index(0)->append_datum(rows[1].get(3));
+    expected->get_column_by_index(1)->append_datum(rows[1].get(4));
+    std::vector<bool> found;
+    ChunkPtr value_chunk;
+    multi_get(3, rows[1], found, value_chunk);
+    ASSERT_EQ((std::vector<bool>{true, false}), found);
+    verify_chunk_eq(_value_schema, expected.get(), value_chunk.get());
+}
+
 } // namespace starrocks
@@ -368,6 +368,30 @@ TEST_F(TabletUpdatesTest, writeread_with_persistent_index) {
     test_writeread(true);
 }
 
+TEST_F(TabletUpdatesTest, has_no_data_committed_between) {
+    srand(GetCurrentTimeMicros());
+    _tablet = create_tablet(rand(), rand());
+    std::vector<int64_t> keys;
+    for (int i = 0; i < 100; i++) {
+        keys.push_back(i);
+    }
+    ASSERT_TRUE(_tablet->rowset_commit(2, create_rowset(_tablet, keys)).ok());
+    ASSERT_TRUE(_tablet->rowset_commit(3, create_rowset(_tablet, keys, nullptr, true)).ok());
+    Int64Column deletes;
+    deletes.append_numbers(keys.data(), sizeof(int64_t) * 10);
+    ASSERT_TRUE(_tablet->rowset_commit(4, create_rowset(_tablet, {}, &deletes)).ok());
+    ASSERT_EQ(90, read_tablet(_tablet, 4));
+
+    auto* updates = _tablet->updates();
+    ASSERT_TRUE(updates->has_no_data_committed_between(2, 3));
+    ASSERT_TRUE(updates->has_no_data_committed_between(4, 4));
+    // Version 2 inserts rows, and version 4 only deletes rows.
+    ASSERT_FALSE(updates->has_no_data_committed_between(1, 3));
+    ASSERT_FALSE(updates->has_no_data_committed_between(2, 4));
+    // Version 5 is not applied yet.
+    ASSERT_FALSE(updates->has_no_data_committed_between(4, 5));
+}
+
 TEST_F(TabletUpdatesTest, test_pk_index_write_amp_score) {
     srand(GetCurrentTimeMicros());
     _tablet = create_tablet(rand(), rand());
@@ -412,6 +436,30 @@ TEST_F(TabletUpdatesTest, test_pk_index_write_amp_score) {
     config::l0_max_mem_usage = old_l0_max_mem_usage;
 }
 
+TEST_F(TabletUpdatesTest, test_preload_primary_index) {
+    srand(GetCurrentTimeMicros());
+    _tablet = create_tablet(rand(), rand());
+    const int N = 1000;
+    std::vector<int64_t> keys;
+    for (int i = 0; i < N; i++) {
+        keys.push_back(i);
+    }
+    ASSERT_OK(_tablet->rowset_commit(2, create_rowset(_tablet, keys)));
+    ASSERT_EQ(2, _tablet->updates()->max_version());
+
+    auto manager = StorageEngine::instance()->update_manager();
+    manager->index_cache().remove_by_key(_tablet->tablet_id());
+    ASSERT_EQ(nullptr, manager->index_cache().get(_tablet->tablet_id()));
+
+    auto tablets = StorageEngine::instance()->tablet_manager()->pick_tablets_to_preload_primary_index(1);
+    ASSERT_EQ(1, tablets.size());
+    ASSERT_OK(_tablet->updates()->preload_primary_index());
+    auto index_entry = manager->index_cache().get(_tablet->tablet_id());
+    ASSERT_NE(nullptr, index_entry);
+    ASSERT_EQ(N, index_entry->value().size());
+    manager->index_cache().release(index_entry);
+}
+
 TEST_F(TabletUpdatesTest, writeread_with_sort_key) {
     srand(GetCurrentTimeMicros());
     _tablet = create_tablet_with_sort_key(rand(), rand(), {1});
@@ -148,7 +148,8 @@ TEST_F(UpdateManagerTest, testDelVec) {
     delvec->add_dels_as_new_version(dels5, 5, &delvec5);
     _update_manager->set_del_vec_in_meta(_meta.get(), rssid, *delvec5);
     _update_manager->set_cached_del_vec(rssid, delvec5);
-    ASSERT_EQ(delvec5->memory_usage(), _root_mem_tracker->consumption());
+    // The replaced version is kept for the queries on the versions before 5.
+    ASSERT_EQ(delvec->memory_usage() + delvec5->memory_usage(), _root_mem_tracker->consumption());
     DelVectorPtr tmp;
     _update_manager->get_latest_del_vec(_meta.get(), rssid, &tmp);
     ASSERT_EQ(5, tmp->version());
@@ -156,8 +157,11 @@ TEST_F(UpdateManagerTest, testDelVec) {
     ASSERT_TRUE(tmp->empty());
     _update_manager->get_del_vec(_meta.get(), rssid, 4, &tmp);
     ASSERT_EQ(3, tmp->version());
+    ASSERT_EQ(delvec.get(), tmp.get());
     _update_manager->get_latest_del_vec(_meta.get(), rssid, &tmp);
     ASSERT_EQ(5, tmp->version());
+    _update_manager->clear_cached_del_vec({rssid});
+    ASSERT_EQ(0, _root_mem_tracker->consumption());
 }
 
 TEST_F(UpdateManagerTest, testExpireEntry) {
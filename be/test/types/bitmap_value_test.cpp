@@ -302,6 +302,52 @@ TEST_F(BitmapValueTest, bitmap_union) {
     check_bitmap(BitmapDataType::BITMAP, bitmap_14, 0, 132);
 }
 
+TEST_F(BitmapValueTest, bitmap_union_many) {
+    // Falls back to operator|= with fewer than 2 BITMAP inputs.
+    {
+        BitmapValue bitmap(100);
+        std::vector<const BitmapValue*> values{&_single_bitmap, &_medium_bitmap, &_empty_bitmap};
+        bitmap.union_many(values.size(), values.data());
+        check_bitmap(BitmapDataType::SET, bitmap, 0, 14, 100, 101);
+    }
+    // Mixes all the types, and the high 32 bits of the values differ.
+    {
+        auto bitmap_1 = gen_bitmap(64, 128);
+        auto bitmap_2 = gen_bitmap(128, 192);
+        BitmapValue bitmap_3;
+        for (uint64_t i = 0; i < 64; i++) {
+            bitmap_3.add((1ULL << 32) + i);
+        }
+        BitmapValue single(192);
+        std::vector<const BitmapValue*> values{&bitmap_1, &_empty_bitmap, &bitmap_2, &single, &bitmap_3};
+
+        BitmapValue bitmap(_medium_bitmap);
+        bitmap.union_many(values.size(), values.data());
+        ASSERT_EQ(bitmap.type(), BitmapDataType::BITMAP);
+        ASSERT_EQ(bitmap.cardinality(), 14 + 129 + 64);
+        for (uint64_t i = 0; i < 193; i++) {
+            ASSERT_EQ(bitmap.contains(i), i < 14 || i >= 64);
+        }
+        for (uint64_t i = 0; i < 64; i++) {
+            ASSERT_TRUE(bitmap.contains((1ULL << 32) + i));
+        }
+        ASSERT_EQ(bitmap.mem_usage(), bitmap.serialize_size());
+        // The inputs are unchanged.
+        check_bitmap(BitmapDataType::BITMAP, bitmap_1, 64, 128);
+        check_bitmap(BitmapDataType::BITMAP, bitmap_2, 128, 192);
+    }
+    // The current bitmap is a shared BITMAP.
+    {
+        BitmapValue bitmap(_large_bitmap);
+        auto bitmap_1 = gen_bitmap(64, 128);
+        auto bitmap_2 = gen_bitmap(100, 200);
+        std::vector<const BitmapValue*> values{&bitmap_1, &bitmap_2};
+        bitmap.union_many(values.size(), values.data());
+        check_bitmap(BitmapDataType::BITMAP, bitmap, 0, 200);
+        check_bitmap(BitmapDataType::BITMAP, _large_bitmap, 0, 64);
+    }
+}
+
 TEST_F(BitmapValueTest, bitmap_intersect) {
     auto bitmap_1 = gen_bitmap(0, 100);
     bitmap_1 &= _empty_bitmap;
@@ -548,6 +548,41 @@ void convert_to_arrow(const TypeDescriptor& type_desc, const ColumnPtr& column,
     ASSERT_EQ(array->type()->ToString(), arrow_type->ToString());
 }
 
+TEST_F(StarRocksColumnToArrowTest, testShareColumnBuffers) {
+    auto memory_pool = arrow::MemoryPool::CreateDefault();
+
+    auto int_column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    for (int32_t i = 0; i < 100; i++) {
+        i % 7 == 0 ? int_column->append_nulls(1) : int_column->append_datum(Datum(i));
+    }
+    std::shared_ptr<arrow::DataType> int_type = arrow::int32();
+    std::shared_ptr<arrow::RecordBatch> result;
+    convert_to_arrow(TypeDescriptor(TYPE_INT), int_column, int_type, memory_pool.get(), &result);
+    auto* int_array = down_cast<arrow::Int32Array*>(result->column(0).get());
+    ASSERT_EQ(int_array->raw_values(), reinterpret_cast<const int32_t*>(int_column->data_column()->raw_data()));
+    ASSERT_EQ(15, int_array->null_count());
+    for (int32_t i = 0; i < 100; i++) {
+        ASSERT_EQ(i % 7 == 0, int_array->IsNull(i));
+        if (i % 7 != 0) {
+            ASSERT_EQ(i, int_array->Value(i));
+        }
+    }
+
+    auto string_column = BinaryColumn::create();
+    std::vector<std::string> strings{"a", "", "abc", "starrocks"};
+    for (const auto& s : strings) {
+        string_column->append(Slice(s));
+    }
+    std::shared_ptr<arrow::DataType> string_type = arrow::utf8();
+    convert_to_arrow(TypeDescriptor::create_varchar_type(10), string_column, string_type, memory_pool.get(), &result);
+    auto* string_array = down_cast<arrow::StringArray*>(result->column(0).get());
+    ASSERT_EQ(string_array->value_data()->data(), string_column->get_bytes().data());
+    ASSERT_EQ(0, string_array->null_count());
+    for (size_t i = 0; i < strings.size(); i++) {
+        ASSERT_EQ(strings[i], string_array->GetString(i));
+    }
+}
+
 TEST_F(StarRocksColumnToArrowTest, testArrayColumn) {
     auto array_type_desc = TypeDescriptor::create_array_type(TypeDescriptor(TYPE_INT));
     auto column = ColumnHelper::create_column(array_type_desc, false, false, 0, false);
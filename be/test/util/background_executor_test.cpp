@@ -0,0 +1,118 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "util/background_executor.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+TEST(BackgroundExecutorTest, run_all_tasks) {
+    BackgroundExecutor executor("test", 4);
+    ASSERT_OK(executor.init());
+    std::atomic<int> count = 0;
+    for (int i = 0; i < 100; i++) {
+        auto cls = static_cast<BackgroundExecutor::TaskClass>(i % BackgroundExecutor::NUM_TASK_CLASSES);
+        ASSERT_OK(executor.submit_func(cls, [&count]() { count++; }));
+    }
+    executor.wait();
+    ASSERT_EQ(100, count);
+
+    executor.shutdown();
+    ASSERT_FALSE(executor.submit_func(BackgroundExecutor::GC, []() {}).ok());
+}
+
+TEST(BackgroundExecutorTest, priority) {
+    BackgroundExecutor executor("test", 1);
+    ASSERT_OK(executor.init());
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    ASSERT_OK(executor.submit_func(BackgroundExecutor::GC, [released]() { released.wait(); }));
+
+    std::mutex mutex;
+    std::vector<BackgroundExecutor::TaskClass> order;
+    for (auto cls : {BackgroundExecutor::GC, BackgroundExecutor::COMPACTION, BackgroundExecutor::PUBLISH,
+                     BackgroundExecutor::LOAD_FLUSH}) {
+        ASSERT_OK(executor.submit_func(cls, [&, cls]() {
+            std::lock_guard l(mutex);
+            order.push_back(cls);
+        }));
+    }
+    release.set_value();
+    executor.wait();
+    std::vector<BackgroundExecutor::TaskClass> expected{BackgroundExecutor::LOAD_FLUSH, BackgroundExecutor::PUBLISH,
+                                                        BackgroundExecutor::COMPACTION, BackgroundExecutor::GC};
+    ASSERT_EQ(expected, order);
+}
+
+TEST(BackgroundExecutorTest, max_concurrency) {
+    BackgroundExecutor executor("test", 4);
+    ASSERT_OK(executor.init());
+    ASSERT_OK(executor.set_concurrency(BackgroundExecutor::COMPACTION, 0, 2));
+    std::atomic<int> running = 0;
+    std::atomic<int> max_running = 0;
+    for (int i = 0; i < 20; i++) {
+        ASSERT_OK(executor.submit_func(BackgroundExecutor::COMPACTION, [&]() {
+            int now = ++running;
+            int prev = max_running.load();
+            while (now > prev && !max_running.compare_exchange_weak(prev, now)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            running--;
+        }));
+    }
+    executor.wait();
+    ASSERT_LE(max_running, 2);
+}
+
+TEST(BackgroundExecutorTest, reserved_concurrency) {
+    BackgroundExecutor executor("test", 2);
+    ASSERT_OK(executor.init());
+    ASSERT_OK(executor.set_concurrency(BackgroundExecutor::LOAD_FLUSH, 1, 2));
+    ASSERT_FALSE(executor.set_concurrency(BackgroundExecutor::GC, 2, 2).ok());
+    ASSERT_FALSE(executor.set_concurrency(BackgroundExecutor::GC, 2, 1).ok());
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    for (int i = 0; i < 2; i++) {
+        ASSERT_OK(executor.submit_func(BackgroundExecutor::COMPACTION, [released]() { released.wait(); }));
+    }
+    // The other thread is reserved for load flush.
+    while (executor.num_running_tasks(BackgroundExecutor::COMPACTION) == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(1, executor.num_running_tasks(BackgroundExecutor::COMPACTION));
+    ASSERT_EQ(1, executor.num_queued_tasks(BackgroundExecutor::COMPACTION));
+
+    std::promise<void> flushed;
+    ASSERT_OK(executor.submit_func(BackgroundExecutor::LOAD_FLUSH, [&flushed]() { flushed.set_value(); }));
+    ASSERT_EQ(std::future_status::ready, flushed.get_future().wait_for(std::chrono::seconds(10)));
+
+    release.set_value();
+    executor.wait();
+    ASSERT_EQ(0, executor.num_queued_tasks(BackgroundExecutor::COMPACTION));
+}
+
+} // namespace starrocks
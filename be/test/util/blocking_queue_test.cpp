@@ -71,6 +71,22 @@ TEST(BlockingQueueTest, TestGetFromShutdownQueue) {
     ASSERT_FALSE(test_queue.blocking_get(&i));
 }
 
+// NOLINTNEXTLINE
+TEST(BlockingQueueTest, TestGetBatch) {
+    BlockingQueue<int32_t> test_queue(5);
+    ASSERT_TRUE(test_queue.blocking_put(1));
+    ASSERT_TRUE(test_queue.blocking_put(2));
+    ASSERT_TRUE(test_queue.blocking_put(3));
+    std::vector<int32_t> items;
+    ASSERT_TRUE(test_queue.blocking_get_batch(&items, 2));
+    ASSERT_EQ(std::vector<int32_t>({1, 2}), items);
+    ASSERT_TRUE(test_queue.blocking_get_batch(&items, 2));
+    ASSERT_EQ(std::vector<int32_t>({1, 2, 3}), items);
+    test_queue.shutdown();
+    ASSERT_FALSE(test_queue.blocking_get_batch(&items, 2));
+    ASSERT_EQ(3, items.size());
+}
+
 class MultiThreadTest {
 public:
     MultiThreadTest() : _queue(_iterations * _nthreads / 10), _num_inserters(_nthreads) {}
@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/cpu_info.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+class CpuInfoTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _old_max_num_numa_nodes = CpuInfo::max_num_numa_nodes_;
+        _old_numa_node_to_cores = CpuInfo::numa_node_to_cores_;
+    }
+
+    void TearDown() override {
+        CpuInfo::max_num_numa_nodes_ = _old_max_num_numa_nodes;
+        CpuInfo::numa_node_to_cores_ = _old_numa_node_to_cores;
+    }
+
+    static void set_numa_topology(const std::vector<std::vector<int>>& numa_node_to_cores) {
+        CpuInfo::max_num_numa_nodes_ = numa_node_to_cores.size();
+        CpuInfo::numa_node_to_cores_ = numa_node_to_cores;
+    }
+
+    static std::vector<int> numa_nodes_of_workers(int num_workers) {
+        std::vector<int> nodes;
+        for (int i = 0; i < num_workers; i++) {
+            nodes.push_back(CpuInfo::get_numa_node_of_worker(i));
+        }
+        return nodes;
+    }
+
+private:
+    int _old_max_num_numa_nodes = 0;
+    std::vector<std::vector<int>> _old_numa_node_to_cores;
+};
+
+TEST_F(CpuInfoTest, workers_spread_round_robin_over_numa_nodes) {
+    set_numa_topology({{0, 1}, {2, 3}});
+    ASSERT_EQ(std::vector<int>({0, 1, 0, 1, 0}), numa_nodes_of_workers(5));
+
+    set_numa_topology({{0, 1}, {2, 3}, {4, 5}, {6, 7}});
+    ASSERT_EQ(std::vector<int>({0, 1, 2, 3, 0, 1}), numa_nodes_of_workers(6));
+}
+
+TEST_F(CpuInfoTest, numa_nodes_without_cores_are_skipped) {
+    set_numa_topology({{0, 1}, {}, {2, 3}});
+    ASSERT_EQ(std::vector<int>({0, 2, 0, 2}), numa_nodes_of_workers(4));
+}
+
+TEST_F(CpuInfoTest, no_binding_with_one_numa_node) {
+    set_numa_topology({{0, 1, 2, 3}});
+    ASSERT_EQ(std::vector<int>({-1, -1}), numa_nodes_of_workers(2));
+    ASSERT_FALSE(CpuInfo::bind_current_thread_to_numa_node_of_worker(0));
+
+    set_numa_topology({{}, {0, 1}});
+    ASSERT_EQ(std::vector<int>({-1, -1}), numa_nodes_of_workers(2));
+}
+
+} // namespace starrocks
@@ -0,0 +1,106 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/epoch_reclaimer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "util/countdown_latch.h"
+
+namespace starrocks {
+
+TEST(EpochReclaimerTest, test_reclaim_without_guard) {
+    auto* reclaimer = EpochReclaimer::instance();
+    bool deleted = false;
+    reclaimer->retire([&deleted]() { deleted = true; });
+    ASSERT_TRUE(deleted);
+    ASSERT_EQ(0, reclaimer->num_retired());
+}
+
+TEST(EpochReclaimerTest, test_defer_until_guard_released) {
+    auto* reclaimer = EpochReclaimer::instance();
+    CountDownLatch guard_taken(1);
+    CountDownLatch retired(1);
+    std::thread reader([&]() {
+        EpochReclaimer::Guard guard;
+        guard_taken.count_down();
+        retired.wait();
+    });
+    guard_taken.wait();
+
+    std::atomic<bool> deleted{false};
+    reclaimer->retire([&deleted]() { deleted = true; });
+    ASSERT_FALSE(deleted);
+    ASSERT_EQ(1, reclaimer->num_retired());
+
+    // Guards taken after the retirement cannot see the object.
+    {
+        EpochReclaimer::Guard guard;
+        EpochReclaimer::Guard nested_guard;
+        retired.count_down();
+        reader.join();
+        reclaimer->reclaim();
+        ASSERT_TRUE(deleted);
+    }
+    ASSERT_EQ(0, reclaimer->num_retired());
+}
+
+TEST(EpochReclaimerTest, test_concurrent_readers) {
+    struct Value {
+        explicit Value(int64_t v) : value(v) {}
+        ~Value() { value = -1; }
+        int64_t value;
+    };
+    std::atomic<Value*> current{new Value(0)};
+    std::atomic<bool> stop{false};
+    std::atomic<int64_t> num_deleted{0};
+    std::atomic<int64_t> num_invalid{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&]() {
+            int64_t last = 0;
+            while (!stop.load()) {
+                EpochReclaimer::Guard guard;
+                const int64_t value = current.load(std::memory_order_acquire)->value;
+                if (value < last) {
+                    num_invalid++;
+                }
+                last = value;
+            }
+        });
+    }
+    constexpr int64_t kNumUpdates = 10000;
+    for (int64_t i = 1; i <= kNumUpdates; i++) {
+        Value* old = current.exchange(new Value(i), std::memory_order_acq_rel);
+        EpochReclaimer::instance()->retire([old, &num_deleted]() {
+            delete old;
+            num_deleted++;
+        });
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EpochReclaimer::instance()->reclaim();
+    ASSERT_EQ(0, num_invalid.load());
+    ASSERT_EQ(kNumUpdates, num_deleted.load());
+    delete current.load();
+}
+
+} // namespace starrocks
@@ -0,0 +1,47 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/hardware_counters.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(HardwareCountersTest, test_scoped_counters) {
+    if (HardwareCounters::current_thread() == nullptr) {
+        GTEST_SKIP() << "hardware counters are not available";
+    }
+    RuntimeProfile profile("test");
+    HardwareProfileCounters counters;
+    for (int i = 0; i < HardwareCounters::NUM_EVENTS; i++) {
+        counters[i] = ADD_COUNTER(&profile, HardwareCounters::event_name(static_cast<HardwareCounters::Event>(i)),
+                                  TUnit::UNIT);
+    }
+    {
+        ScopedHardwareCounters scoped(&counters);
+        volatile int64_t sum = 0;
+        for (int i = 0; i < 1000000; i++) {
+            sum += i;
+        }
+    }
+    ASSERT_GT(counters[HardwareCounters::CYCLES]->value(), 0);
+    ASSERT_GT(counters[HardwareCounters::INSTRUCTIONS]->value(), 1000000);
+
+    // disabled
+    {
+        ScopedHardwareCounters scoped(nullptr);
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,94 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/instrumented_mutex.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "util/stack_trace_mutex.h"
+
+namespace starrocks {
+
+TEST(InstrumentedMutexTest, test_record_contended_wait) {
+    auto* site = LockStats::instance()->get_or_create_site("InstrumentedMutexTest::mutex");
+    ASSERT_EQ(site, LockStats::instance()->get_or_create_site("InstrumentedMutexTest::mutex"));
+    InstrumentedMutex<StackTraceMutex<bthread::Mutex>> mutex(site);
+
+    // uncontended acquisitions are not recorded
+    {
+        std::lock_guard l(mutex);
+    }
+    ASSERT_EQ(0, site->snapshot().contentions);
+
+    mutex.lock();
+    std::thread waiter([&]() { std::lock_guard l(mutex); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    mutex.unlock();
+    waiter.join();
+
+    auto snapshot = site->snapshot();
+    ASSERT_EQ(1, snapshot.contentions);
+    ASSERT_EQ(0, snapshot.shared_contentions);
+    ASSERT_GE(snapshot.total_wait_ns, 10 * 1000 * 1000);
+    ASSERT_EQ(snapshot.total_wait_ns, snapshot.max_wait_ns);
+    ASSERT_EQ(snapshot.max_wait_ns, snapshot.wait_ns_percentile(0.99));
+}
+
+TEST(InstrumentedMutexTest, test_shared_mutex) {
+    InstrumentedSharedMutex<> mutex(LOCK_SITE("InstrumentedMutexTest::shared_mutex"));
+    auto* site = LOCK_SITE("InstrumentedMutexTest::shared_mutex");
+
+    {
+        std::shared_lock l1(mutex);
+        std::shared_lock l2(mutex);
+    }
+    ASSERT_EQ(0, site->snapshot().contentions);
+
+    mutex.lock();
+    std::thread reader([&]() { std::shared_lock l(mutex); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    mutex.unlock();
+    reader.join();
+
+    auto snapshot = site->snapshot();
+    ASSERT_EQ(1, snapshot.contentions);
+    ASSERT_EQ(1, snapshot.shared_contentions);
+
+    auto top = LockStats::instance()->top_contended(100);
+    auto it = std::find_if(top.begin(), top.end(),
+                           [](const auto& s) { return s.name == "InstrumentedMutexTest::shared_mutex"; });
+    ASSERT_TRUE(it != top.end());
+    for (size_t i = 1; i < top.size(); i++) {
+        ASSERT_GE(top[i - 1].total_wait_ns, top[i].total_wait_ns);
+    }
+}
+
+TEST(InstrumentedMutexTest, test_wait_percentile) {
+    LockSite site("InstrumentedMutexTest::percentile");
+    for (int i = 0; i < 99; i++) {
+        site.record_wait(1000, false);
+    }
+    site.record_wait(1000000, false);
+    auto snapshot = site.snapshot();
+    ASSERT_EQ(100, snapshot.contentions);
+    // 1000 falls in [512, 1024)
+    ASSERT_EQ(1024, snapshot.wait_ns_percentile(0.5));
+    ASSERT_EQ(1024, snapshot.wait_ns_percentile(0.99));
+    ASSERT_EQ(1000000, snapshot.wait_ns_percentile(1.0));
+}
+
+} // namespace starrocks
@@ -36,6 +36,7 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
 #include <vector>
 
 using namespace starrocks;
@@ -272,6 +273,120 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(950, cache.get_usage());
 }
 
+static void noop_deleter(const CacheKey& key, void* v) {}
+
+// Access the hot keys a few times, then scan many keys once, like a page cache does.
+static int hot_keys_after_scan(EvictionPolicy eviction_policy) {
+    LRUCache cache;
+    cache.set_capacity(100);
+    cache.set_eviction_policy(eviction_policy);
+    auto access = [&](int k) {
+        std::string result;
+        CacheKey key = EncodeKey(&result, k);
+        uint32_t hash = key.hash(key.data(), key.size(), 0);
+        Cache::Handle* handle = cache.lookup(key, hash);
+        if (handle == nullptr) {
+            handle = cache.insert(key, hash, EncodeValue(k), 1, &noop_deleter);
+        }
+        cache.release(handle);
+    };
+    for (int i = 0; i < 4; i++) {
+        for (int k = 0; k < 50; k++) {
+            access(k);
+        }
+    }
+    for (int k = 1000; k < 3000; k++) {
+        access(k);
+    }
+    int hot_keys = 0;
+    for (int k = 0; k < 50; k++) {
+        std::string result;
+        CacheKey key = EncodeKey(&result, k);
+        Cache::Handle* handle = cache.lookup(key, key.hash(key.data(), key.size(), 0));
+        if (handle != nullptr) {
+            hot_keys++;
+            cache.release(handle);
+        }
+    }
+    EXPECT_LE(cache.get_usage(), 100);
+    return hot_keys;
+}
+
+TEST_F(CacheTest, TinyLfuScanResistance) {
+    ASSERT_EQ(0, hot_keys_after_scan(EvictionPolicy::LRU));
+    ASSERT_EQ(50, hot_keys_after_scan(EvictionPolicy::TINY_LFU));
+}
+
+TEST_F(CacheTest, TinyLfuNotAdmitted) {
+    LRUCache cache;
+    cache.set_capacity(1);
+    cache.set_eviction_policy(EvictionPolicy::TINY_LFU);
+    CacheKey key1("100");
+    uint32_t hash1 = key1.hash(key1.data(), key1.size(), 0);
+    cache.release(cache.insert(key1, hash1, EncodeValue(100), 1, &noop_deleter));
+    for (int i = 0; i < 3; i++) {
+        cache.release(cache.lookup(key1, hash1));
+    }
+
+    // The new entry is accessed less often than the one to evict, it is still readable
+    // through the returned handle, but not kept in the cache.
+    CacheKey key2("200");
+    uint32_t hash2 = key2.hash(key2.data(), key2.size(), 0);
+    Cache::Handle* handle = cache.insert(key2, hash2, EncodeValue(200), 1, &noop_deleter);
+    ASSERT_NE(nullptr, handle);
+    ASSERT_EQ(200, DecodeValue(reinterpret_cast<LRUHandle*>(handle)->value));
+    ASSERT_EQ(2, cache.get_usage());
+    cache.release(handle);
+    ASSERT_EQ(1, cache.get_usage());
+    Cache::Handle* found = cache.lookup(key1, hash1);
+    ASSERT_NE(nullptr, found);
+    cache.release(found);
+
+    // Durable entries are always admitted.
+    CacheKey key3("300");
+    uint32_t hash3 = key3.hash(key3.data(), key3.size(), 0);
+    cache.release(cache.insert(key3, hash3, EncodeValue(300), 1, &noop_deleter, CachePriority::DURABLE));
+    found = cache.lookup(key3, hash3);
+    ASSERT_NE(nullptr, found);
+    cache.release(found);
+    ASSERT_EQ(1, cache.get_usage());
+}
+
+TEST_F(CacheTest, ConcurrentLookup) {
+    LRUCache cache;
+    cache.set_capacity(64);
+    std::vector<std::string> keys(128);
+    for (int i = 0; i < 128; i++) {
+        keys[i] = std::to_string(i);
+    }
+
+    // Lookups share the lock, while inserts evict the entries concurrently.
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t]() {
+            for (int n = 0; n < 10000; n++) {
+                int i = (n * 7 + t) % 128;
+                CacheKey key(keys[i]);
+                uint32_t hash = key.hash(key.data(), key.size(), 0);
+                if (t == 0) {
+                    cache.release(cache.insert(key, hash, EncodeValue(i), 1, &noop_deleter));
+                    continue;
+                }
+                Cache::Handle* handle = cache.lookup(key, hash);
+                if (handle != nullptr) {
+                    ASSERT_EQ(i, DecodeValue(reinterpret_cast<LRUHandle*>(handle)->value));
+                    cache.release(handle);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(64, cache.get_usage());
+    ASSERT_EQ(30000, cache.get_lookup_count());
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
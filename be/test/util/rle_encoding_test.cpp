@@ -521,4 +521,35 @@ TEST_F(TestRle, TestGetBatchWithDictOutOfRange) {
     ASSERT_EQ(-1, n);
 }
 
+TEST_F(TestRle, TestSkipBatch) {
+    faststring buffer;
+    RleEncoder<int> encoder(&buffer, 10);
+    std::vector<int> values;
+    // mixed repeated and literal runs
+    for (int i = 0; i < 4000; ++i) {
+        int value = (i / 100) % 2 == 0 ? 7 : i % 997;
+        values.push_back(value);
+        encoder.Put(value);
+    }
+    encoder.Flush();
+
+    RleBatchDecoder<int> decoder(buffer.data(), buffer.size(), 10);
+    std::vector<int> to_check(64);
+    size_t pos = 0;
+    int step = 0;
+    while (pos < values.size()) {
+        int num_to_skip = std::min<int>(3 + step * 7 % 131, values.size() - pos);
+        ASSERT_EQ(num_to_skip, decoder.SkipBatch(num_to_skip));
+        pos += num_to_skip;
+        int num_to_get = std::min<int>(1 + step % 64, values.size() - pos);
+        ASSERT_EQ(num_to_get, decoder.GetBatch(to_check.data(), num_to_get));
+        for (int i = 0; i < num_to_get; i++) {
+            ASSERT_EQ(values[pos + i], to_check[i]);
+        }
+        pos += num_to_get;
+        step++;
+    }
+    ASSERT_EQ(0, decoder.SkipBatch(1));
+}
+
 } // namespace starrocks
@@ -239,6 +239,18 @@ TEST(StringToInt, InvalidLeadingTrailing) {
     test_int_value<int8_t>("   ", 0, StringParser::PARSE_FAILURE);
 }
 
+TEST(StringToInt, EightDigitsAtATime) {
+    test_int_value<int32_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("-12345678 ", -12345678, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("1234567890123456789", 1234567890123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("+00000000000000012", 12, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("12345678901234   ", 12345678901234, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("1234567890 234", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1234*678901234", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("123456789:1234", 0, StringParser::PARSE_FAILURE);
+    test_unsigned_int_value<uint64_t>("98765432109876543", 98765432109876543, StringParser::PARSE_SUCCESS);
+}
+
 TEST(StringToInt, Limit) {
     test_int_value<int8_t>("127", 127, StringParser::PARSE_SUCCESS);
     test_int_value<int8_t>("-128", -128, StringParser::PARSE_SUCCESS);
@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 #include "common/logging.h"
 #include "runtime/datetime_value.h"
@@ -62,4 +63,40 @@ PARALLEL_TEST(TimezoneUtilTest, find_time_zone) {
     }
 }
 
+PARALLEL_TEST(TimezoneUtilTest, offset_cache) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("America/New_York", ctz));
+    const cctz::civil_second epoch(1970, 1, 1, 0, 0, 0);
+
+    // Walk across the DST transitions of 2023 back and forth, so that both the hits and misses of the cache
+    // are compared with cctz.
+    TimezoneOffsetCache cache(ctz);
+    const int64_t begin = cctz::civil_second(2023, 3, 11, 0, 0, 0) - epoch;
+    const int64_t end = cctz::civil_second(2023, 11, 6, 0, 0, 0) - epoch;
+    std::vector<int64_t> seconds;
+    for (int64_t s = begin; s < end; s += 997) {
+        seconds.push_back(s);
+        seconds.push_back(end - (s - begin));
+    }
+    for (int64_t s : seconds) {
+        const auto tp = cctz::time_point<cctz::seconds>(cctz::seconds(s));
+        EXPECT_EQ(cctz::convert(tp, ctz) - epoch, cache.utc_to_local(s)) << s;
+        EXPECT_EQ(cctz::convert(epoch + s, ctz).time_since_epoch().count(), cache.local_to_utc(s)) << s;
+    }
+
+    // Skipped and repeated local times.
+    const int64_t skipped = cctz::civil_second(2023, 3, 12, 2, 30, 0) - epoch;
+    EXPECT_EQ(cctz::civil_second(2023, 3, 12, 7, 0, 0) - epoch, cache.local_to_utc(skipped));
+    const int64_t repeated = cctz::civil_second(2023, 11, 5, 1, 30, 0) - epoch;
+    EXPECT_EQ(cctz::civil_second(2023, 11, 5, 5, 30, 0) - epoch, cache.local_to_utc(repeated));
+    EXPECT_EQ(cctz::civil_second(2023, 11, 5, 7, 0, 0) - epoch, cache.local_to_utc(repeated + 1800));
+
+    // A fixed offset time zone never misses after the first lookup.
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("+08:00", ctz));
+    TimezoneOffsetCache fixed(ctz);
+    EXPECT_EQ(28800, fixed.utc_to_local(0));
+    EXPECT_EQ(-28800, fixed.local_to_utc(0));
+    EXPECT_EQ(int64_t(4102444800) + 28800, fixed.utc_to_local(4102444800));
+}
+
 } // namespace starrocks
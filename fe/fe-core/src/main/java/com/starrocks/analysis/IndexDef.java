@@ -196,6 +196,8 @@ public class IndexDef implements ParseNode {
             InvertedIndexUtil.checkInvertedIndexValid(column, properties, keysType);
         } else if (indexType == IndexType.NGRAMBF) {
             BloomFilterIndexUtil.checkNgramBloomFilterIndexValid(column, properties, keysType);
+        } else if (indexType == IndexType.VECTOR) {
+            VectorIndexUtil.checkVectorIndexValid(column, properties, keysType);
         } else {
             throw new SemanticException("Unsupported index type: " + indexType);
         }
@@ -204,7 +206,8 @@ public class IndexDef implements ParseNode {
     public enum IndexType {
         BITMAP,
         GIN("GIN"),
-        NGRAMBF("NGRAMBF");
+        NGRAMBF("NGRAMBF"),
+        VECTOR("VECTOR");
 
         IndexType(String name) {
             this.displayName = name;
@@ -226,6 +229,8 @@ public class IndexDef implements ParseNode {
                 index = IndexDef.IndexType.GIN;
             } else if (indexTypeContext.NGRAMBF() != null) {
                 index = IndexType.NGRAMBF;
+            } else if (indexTypeContext.VECTOR() != null) {
+                index = IndexType.VECTOR;
             } else {
                 throw new ParsingException("Not specify index type");
             }
@@ -28,6 +28,7 @@ import java.util.Map;
 import java.util.stream.Collectors;
 
 import static com.starrocks.common.InvertedIndexParams.CommonIndexParamKey.IMP_LIB;
+import static com.starrocks.common.InvertedIndexParams.InvertedIndexImpType.BUILTIN;
 import static com.starrocks.common.InvertedIndexParams.InvertedIndexImpType.CLUCENE;
 
 public class InvertedIndexUtil {
@@ -79,8 +80,12 @@ public class InvertedIndexUtil {
         String impLibKey = IMP_LIB.name().toLowerCase(Locale.ROOT);
         if (properties.containsKey(impLibKey)) {
             String impValue = properties.get(impLibKey);
-            if (!CLUCENE.name().equalsIgnoreCase(impValue)) {
-                throw new SemanticException("Only support clucene implement for now. ");
+            if (!CLUCENE.name().equalsIgnoreCase(impValue) && !BUILTIN.name().equalsIgnoreCase(impValue)) {
+                throw new SemanticException("Only support clucene and builtin implement for now. ");
+            }
+            if (BUILTIN.name().equalsIgnoreCase(impValue)
+                    && INVERTED_INDEX_PARSER_CHINESE.equals(getInvertedIndexParser(properties))) {
+                throw new SemanticException("The builtin implement does not support the chinese parser. ");
             }
         }
 
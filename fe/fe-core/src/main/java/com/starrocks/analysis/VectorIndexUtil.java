@@ -0,0 +1,75 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package com.starrocks.analysis;
+
+import com.starrocks.catalog.ArrayType;
+import com.starrocks.catalog.Column;
+import com.starrocks.catalog.KeysType;
+import com.starrocks.catalog.Type;
+import com.starrocks.common.VectorIndexParamsKey;
+import com.starrocks.sql.analyzer.SemanticException;
+
+import java.util.Locale;
+import java.util.Map;
+import java.util.Set;
+
+public class VectorIndexUtil {
+    public static final Set<String> METRIC_TYPES = Set.of("l2_distance", "cosine_similarity");
+
+    public static void checkVectorIndexValid(Column column, Map<String, String> properties, KeysType keysType)
+            throws SemanticException {
+        Type type = column.getType();
+        if (!type.isArrayType() || !((ArrayType) type).getItemType().isFloat()) {
+            throw new SemanticException(String.format("Invalid vector index column '%s': unsupported type %s, " +
+                    "only array<float> is supported", column.getName(), type));
+        }
+
+        // The rows of a segment are merged with the rows of the others by the aggregate and unique tables,
+        // so the nearest rows of the segments are not the nearest rows of the table.
+        if (keysType != KeysType.DUP_KEYS && keysType != KeysType.PRIMARY_KEYS) {
+            throw new SemanticException("Vector index only used in columns of DUP_KEYS/PRIMARY_KEYS table. " +
+                    "invalid column: " + column.getName());
+        }
+
+        if (properties == null) {
+            return;
+        }
+        checkPositiveInt(properties, VectorIndexParamsKey.DIM, 1);
+        checkPositiveInt(properties, VectorIndexParamsKey.M, 2);
+        checkPositiveInt(properties, VectorIndexParamsKey.EF_CONSTRUCTION, 1);
+        String metricKey = VectorIndexParamsKey.METRIC_TYPE.name().toLowerCase(Locale.ROOT);
+        if (properties.containsKey(metricKey) && !METRIC_TYPES.contains(properties.get(metricKey))) {
+            throw new SemanticException(String.format("Vector index %s should be one of %s, but got %s",
+                    metricKey, METRIC_TYPES, properties.get(metricKey)));
+        }
+    }
+
+    private static void checkPositiveInt(Map<String, String> properties, VectorIndexParamsKey paramsKey, int minValue)
+            throws SemanticException {
+        String key = paramsKey.name().toLowerCase(Locale.ROOT);
+        if (!properties.containsKey(key)) {
+            return;
+        }
+        int value;
+        try {
+            value = Integer.parseInt(properties.get(key));
+        } catch (NumberFormatException e) {
+            throw new SemanticException(String.format("Vector index %s should be an integer", key));
+        }
+        if (value < minValue) {
+            throw new SemanticException(String.format("Vector index %s should be at least %d", key, minValue));
+        }
+    }
+}
@@ -41,6 +41,7 @@ import com.starrocks.common.InvertedIndexParams.CommonIndexParamKey;
 import com.starrocks.common.InvertedIndexParams.IndexParamsKey;
 import com.starrocks.common.InvertedIndexParams.SearchParamsKey;
 import com.starrocks.common.NgramBfIndexParamsKey;
+import com.starrocks.common.VectorIndexParamsKey;
 import com.starrocks.common.io.Text;
 import com.starrocks.common.io.Writable;
 import com.starrocks.common.util.PrintableMap;
@@ -275,6 +276,12 @@ public class Index implements Writable {
                         .map(e -> e.name().toUpperCase(Locale.ROOT))
                         .collect(Collectors.toSet());
                 searchIndexParamKeySet = Collections.emptySet();
+            } else if (indexType == IndexType.VECTOR) {
+                commonIndexParamKeySet = Collections.emptySet();
+                indexIndexParamKeySet = Arrays.stream(VectorIndexParamsKey.values())
+                        .map(e -> e.name().toUpperCase(Locale.ROOT))
+                        .collect(Collectors.toSet());
+                searchIndexParamKeySet = Collections.emptySet();
             } else {
                 commonIndexParamKeySet = Collections.emptySet();
                 indexIndexParamKeySet = Collections.emptySet();
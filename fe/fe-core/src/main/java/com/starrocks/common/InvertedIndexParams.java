@@ -37,7 +37,9 @@ public class InvertedIndexParams {
 
 
     public enum InvertedIndexImpType {
-        CLUCENE
+        CLUCENE,
+        // the native inverted index of BE, which does not support the chinese parser
+        BUILTIN
     }
 
     public enum CommonIndexParamKey implements ParamsKey {
@@ -0,0 +1,61 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package com.starrocks.common;
+
+import com.starrocks.common.io.ParamsKey;
+
+public enum VectorIndexParamsKey implements ParamsKey {
+    /**
+     * dimension of the indexed arrays, inferred from the first array of each segment if not set
+     */
+    DIM,
+
+    /**
+     * l2_distance or cosine_similarity
+     */
+    METRIC_TYPE("l2_distance", true),
+
+    /**
+     * max number of the neighbors of a node on the upper layers of the HNSW graph, twice on the bottom layer
+     */
+    M("16", true),
+
+    /**
+     * width of the search when a vector is inserted into the HNSW graph
+     */
+    EF_CONSTRUCTION("64", true);
+
+    private final String defaultValue;
+    private boolean needDefault = false;
+
+    VectorIndexParamsKey() {
+        this.defaultValue = null;
+    }
+
+    VectorIndexParamsKey(String defaultValue, boolean needDefault) {
+        this.defaultValue = defaultValue;
+        this.needDefault = needDefault;
+    }
+
+    @Override
+    public String defaultValue() {
+        return defaultValue;
+    }
+
+    @Override
+    public boolean needDefault() {
+        return needDefault;
+    }
+}
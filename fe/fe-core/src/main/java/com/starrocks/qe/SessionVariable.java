@@ -518,6 +518,10 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // their ordinal position in the Hive table definition.
     public static final String ORC_USE_COLUMN_NAMES = "orc_use_column_names";
 
+    // Collect cycles, instructions, LLC misses and branch misses of every operator into the query profile.
+    // It costs two syscalls per operator invocation, so it is only meant for tuning.
+    public static final String ENABLE_PROFILE_HARDWARE_COUNTERS = "enable_profile_hardware_counters";
+
     // Flag to control whether to proxy follower's query statement to leader/follower.
     public enum FollowerQueryForwardMode {
         DEFAULT,    // proxy queries by the follower's replay progress (default)
@@ -2025,6 +2029,9 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VarAttr(name = ORC_USE_COLUMN_NAMES)
     private boolean orcUseColumnNames = false;
 
+    @VarAttr(name = ENABLE_PROFILE_HARDWARE_COUNTERS)
+    private boolean enableProfileHardwareCounters = false;
+
     @VarAttr(name = FOLLOWER_QUERY_FORWARD_MODE, flag = VariableMgr.INVISIBLE | VariableMgr.DISABLE_FORWARD_TO_LEADER)
     private String followerForwardMode = "";
 
@@ -3850,6 +3857,7 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         tResult.setEnable_wait_dependent_event(enableWaitDependentEvent);
         tResult.setConnector_max_split_size(connectorMaxSplitSize);
         tResult.setOrc_use_column_names(orcUseColumnNames);
+        tResult.setEnable_profile_hardware_counters(enableProfileHardwareCounters);
         return tResult;
     }
 
@@ -60,6 +60,16 @@ vectorized_functions = [
      "MathFunctions::cosine_similarity<TYPE_FLOAT, false>"],
     [10103, "cosine_similarity_norm", True, False, "FLOAT", ["ARRAY_FLOAT", "ARRAY_FLOAT"],
      "MathFunctions::cosine_similarity<TYPE_FLOAT, true>"],
+    [10104, "l2_distance", True, False, "FLOAT", ["ARRAY_FLOAT", "ARRAY_FLOAT"],
+     "MathFunctions::l2_distance<TYPE_FLOAT>"],
+    [10105, "inner_product", True, False, "FLOAT", ["ARRAY_FLOAT", "ARRAY_FLOAT"],
+     "MathFunctions::inner_product<TYPE_FLOAT>"],
+    [10106, "vector_add", True, False, "ARRAY_FLOAT", ["ARRAY_FLOAT", "ARRAY_FLOAT"],
+     "MathFunctions::vector_add<TYPE_FLOAT>"],
+    [10107, "vector_subtract", True, False, "ARRAY_FLOAT", ["ARRAY_FLOAT", "ARRAY_FLOAT"],
+     "MathFunctions::vector_subtract<TYPE_FLOAT>"],
+    [10108, "vector_multiply", True, False, "ARRAY_FLOAT", ["ARRAY_FLOAT", "ARRAY_FLOAT"],
+     "MathFunctions::vector_multiply<TYPE_FLOAT>"],
 
     [10110, "ceil", True, False, "BIGINT", ["DOUBLE"], "MathFunctions::ceil"],
     [10111, "ceiling", True, False, "BIGINT", ["DOUBLE"], "MathFunctions::ceil"],
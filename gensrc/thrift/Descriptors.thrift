@@ -183,7 +183,8 @@ enum THdfsCompression {
 enum TIndexType {
   BITMAP,
   GIN,
-  NGRAMBF
+  NGRAMBF,
+  VECTOR
 }
 
 // Mapping from names defined by Avro to the enum.
@@ -113,6 +113,7 @@ enum TSpillableOperatorType {
   AGG_DISTINCT = 2;
   SORT = 3;
   NL_JOIN = 4;
+  SET_OPERATION = 5;
 }
 
 enum TTabletInternalParallelMode {
@@ -288,6 +289,9 @@ struct TQueryOptions {
 
   132: optional bool enable_datacache_async_populate_mode;
   133: optional bool enable_datacache_io_adaptor;
+
+  // Collect the hardware counters of every operator into the profile, only meaningful when enable_profile=true
+  134: optional bool enable_profile_hardware_counters = false;
 }
 
 
@@ -288,6 +288,10 @@ struct TEsScanRange {
   2: required string index
   3: optional string type
   4: required i32 shard_id
+  // The shard is read by num_slices sliced scrolls, and this range reads the slice slice_id of them.
+  // They are set by BE when it splits a shard into slices.
+  5: optional i32 slice_id
+  6: optional i32 num_slices
 }
 
 enum TIcebergFileContent {
@@ -499,6 +503,17 @@ struct TColumnAccessPath {
     5: optional Types.TTypeDesc type_desc
 }
 
+// Search the vector index of a column for the candidates of `ORDER BY <metric>(column, query_vector) LIMIT k`,
+// only set when the scan has no other predicates.
+struct TVectorSearchOptions {
+  1: optional string vector_column_name
+  2: optional list<double> query_vector
+  3: optional i64 k
+  // l2_distance or cosine_similarity
+  4: optional string metric_type
+  5: optional i32 ef_search
+}
+
 // If you find yourself changing this struct, see also TLakeScanNode
 struct TOlapScanNode {
   1: required Types.TTupleId tuple_id
@@ -527,6 +542,7 @@ struct TOlapScanNode {
   33: optional bool output_asc_hint
   34: optional bool partition_order_hint
   35: optional bool enable_prune_column_after_index_filter
+  36: optional TVectorSearchOptions vector_search_options
 }
 
 struct TJDBCScanNode {
@@ -590,7 +606,13 @@ enum TJoinOp {
   // on the build side. Those NULLs are considered candidate matches, and therefore could
   // be rejected (ANTI-join), based on the other join conjuncts. This is in contrast
   // to LEFT_ANTI_JOIN where NULLs are not matches and therefore always returned.
-  NULL_AWARE_LEFT_ANTI_JOIN
+  NULL_AWARE_LEFT_ANTI_JOIN,
+
+  // Match every probe row with the closest build row that has the same equi-join keys and
+  // satisfies THashJoinNode.asof_join_condition. ASOF_LEFT_OUTER_JOIN also returns the
+  // unmatched probe rows.
+  ASOF_INNER_JOIN,
+  ASOF_LEFT_OUTER_JOIN
 }
 
 enum TJoinDistributionMode {
@@ -635,6 +657,10 @@ struct THashJoinNode {
 
   // used in pipeline engine
   55: optional bool interpolate_passthrough = false
+
+  // The inequality of an ASOF join, a binary predicate with operator <, <=, > or >=, whose left child
+  // only references the probe side and right child only references the build side.
+  56: optional Exprs.TExpr asof_join_condition
 }
 
 struct TMergeJoinNode {
@@ -955,6 +981,8 @@ struct TIntersectNode {
     3: required list<list<Exprs.TExpr>> const_expr_lists
     // Index of the first child that needs to be materialized.
     4: required i64 first_materialized_child_idx
+    // Runtime filters built from the keys of the first child, which can be applied to the other children.
+    5: optional list<RuntimeFilter.TRuntimeFilterDescription> build_runtime_filters
 }
 
 struct TExceptNode {
@@ -967,6 +995,8 @@ struct TExceptNode {
     3: required list<list<Exprs.TExpr>> const_expr_lists
     // Index of the first child that needs to be materialized.
     4: required i64 first_materialized_child_idx
+    // Runtime filters built from the keys of the first child, which can be applied to the other children.
+    5: optional list<RuntimeFilter.TRuntimeFilterDescription> build_runtime_filters
 }
 
 
@@ -22,6 +22,7 @@ struct TResourceGroupUsage {
     2: optional i32 cpu_core_used_permille
     3: optional i64 mem_used_bytes;
     4: optional i32 num_running_queries;
+    5: optional i64 io_bytes_per_second;
 }
 
 struct TResourceUsage {